@@ -29,7 +29,7 @@ namespace {
 	typedef device::ETHERC0 ETHERC;      // Ethernet Controller
 	typedef device::EDMAC0 EDMAC;        // Ethernet DMA Controller
 	typedef chip::phy_base<ETHERC> PHY;  // Ethernet PHY (LAN8720)
-	typedef device::ether_io<ETHERC, EDMAC, PHY> ETHD;  // EthernetDriver
+	typedef device::ether_io<ETHERC, EDMAC, PHY, 8, 8> ETHD;  // EthernetDriver (TX/RX descriptors)
 	ETHD 	ethd_;
 
 	volatile bool tcpip_flag_ = false;
@@ -326,6 +326,7 @@ int main(int argc, char** argv)
 	{  // Ethernet の開始
 		uint8_t intr_level = 4;
 		ethd_.start(intr_level);
+		ethd_.set_tx_coalesce(4);  // 送信割り込みは４フレーム毎
 
 		static uint8_t mac[6] = { 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED };
 		net_.start(mac);
@@ -1,7 +1,12 @@
 #pragma once
 //=====================================================================//
 /*! @file
-    @brief  A/D 変換、キャプチャー制御クラス
+    @brief  A/D 変換、キャプチャー制御クラス @n
+			・２面のバッファを持ち、連続（STREAM）モードでは、割り込みが片方に @n
+			  書き込む間、もう片方（完了したブロック）を解析、描画できる。@n
+			・解析、描画の前に「acquire」で完了したバッファを固定し、終わったら @n
+			  「release」する。固定中のバッファに割り込みは書き込まない（その間に @n
+			  完了したブロックは捨てて、オーバーラン数を数える）
     @author 平松邦仁 (hira@rvf-rc45.net)
     @copyright  Copyright (C) 2018 Kunihito Hiramatsu @n
                 Released under the MIT license @n
@@ -32,6 +37,7 @@ namespace utils {
 	enum class capture_trigger : uint8_t {
 		NONE,		///< 何もしない
 		SINGLE,		///< シングル取り込み
+		STREAM,		///< 連続取り込み（ブロック毎にバッファを切り替える）
 	};
 
 
@@ -46,13 +52,22 @@ namespace utils {
 		static const uint32_t CAP_NUM = CAPN;
 
 	private:
-		static capture_data				data_[CAPN];
+		static_assert((CAPN & (CAPN - 1)) == 0, "CAPN must be a power of two");
+
+		static capture_data				data_[2][CAPN];
 
 		typedef device::S12AD  ADC0;
 		typedef device::S12AD1 ADC1;
 
 		static volatile uint16_t		pos_;
 		static volatile capture_trigger	trigger_;
+		static volatile uint8_t			bank_;		///< 書き込み中のバッファ
+		static volatile uint8_t			ready_;		///< 完了したバッファ
+		static volatile uint8_t			lock_;		///< 固定中のバッファ（BANK_NONE なら無し）
+		static volatile uint32_t		count_;		///< 完了したブロック数
+		static volatile uint32_t		overrun_;	///< 捨てたブロック数
+
+		static const uint8_t BANK_NONE = 2;
 
 		class tpu_task {
 		public:
@@ -64,14 +79,30 @@ namespace utils {
 					ADC1::ADCSR = ADC1::ADCSR.ADCS.b(0b01) | ADC1::ADCSR.ADST.b();
 					break;
 				case capture_trigger::SINGLE:
-					data_[pos_].ch0_ = ADC0::ADDR(ADC0::analog::AIN000);
-					data_[pos_].ch1_ = ADC1::ADDR(ADC1::analog::AIN114);
+				case capture_trigger::STREAM:
+					{
+						auto& d = data_[bank_][pos_];
+						d.ch0_ = ADC0::ADDR(ADC0::analog::AIN000);
+						d.ch1_ = ADC1::ADDR(ADC1::analog::AIN114);
+					}
 					ADC0::ADCSR = ADC0::ADCSR.ADCS.b(0b01) | ADC0::ADCSR.ADST.b();
 					ADC1::ADCSR = ADC1::ADCSR.ADCS.b(0b01) | ADC1::ADCSR.ADST.b();
 					++pos_;
 					if(pos_ >= CAPN) {
-						trigger_ = capture_trigger::NONE;
+						pos_ = 0;
+						uint8_t next = bank_ ^ 1;
+						if(next == lock_) {  // 固定中なら、このブロックを捨てて書き直す
+							++overrun_;
+						} else {
+							ready_ = bank_;
+							bank_ = next;
+							++count_;
+							if(trigger_ == capture_trigger::SINGLE) {
+								trigger_ = capture_trigger::NONE;
+							}
+						}
 					}
+					break;
 				}
 			}
 		};
@@ -174,17 +205,69 @@ namespace utils {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  波形を取得
+			@brief  完了したブロック数を取得（新しいブロックの検出に使う）
+			@return ブロック数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_count() const noexcept { return count_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  捨てたブロック数を取得（固定中に完了したブロック）
+			@return ブロック数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_overrun() const noexcept { return overrun_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  最後に完了したバッファを固定する @n
+					「release」するまで、割り込みはこのバッファに書き込まない。
+			@return 固定したバッファ
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t acquire() noexcept
+		{
+			uint8_t bank;
+			do {
+				bank = ready_;
+				lock_ = bank;
+				// 固定する前に、割り込みが切り替えていたらやり直す
+			} while(bank_ == bank);
+			return bank;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  バッファの固定を解除
+		*/
+		//-----------------------------------------------------------------//
+		void release() noexcept { lock_ = BANK_NONE; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  波形を取得（「acquire」で固定したバッファ）
+			@param[in]	pos	位置
+			@return 波形
 		*/
 		//-----------------------------------------------------------------//
-		const capture_data& get(uint32_t pos) noexcept
+		const capture_data& get(uint32_t pos) const noexcept
 		{
-			return data_[pos & (CAPN - 1)];
+			return data_[lock_ & 1][pos & (CAPN - 1)];
 		}
 	};
 
-	template <uint32_t CAPN> capture_data capture<CAPN>::data_[CAPN];
+	template <uint32_t CAPN> capture_data capture<CAPN>::data_[2][CAPN];
 	template <uint32_t CAPN> volatile uint16_t capture<CAPN>::pos_ = 0;
+	template <uint32_t CAPN> volatile uint8_t capture<CAPN>::bank_ = 0;
+	template <uint32_t CAPN> volatile uint8_t capture<CAPN>::ready_ = 1;
+	template <uint32_t CAPN> volatile uint8_t capture<CAPN>::lock_ = capture<CAPN>::BANK_NONE;
+	template <uint32_t CAPN> volatile uint32_t capture<CAPN>::count_ = 0;
+	template <uint32_t CAPN> volatile uint32_t capture<CAPN>::overrun_ = 0;
 	template <uint32_t CAPN>
 	volatile capture_trigger capture<CAPN>::trigger_ = capture_trigger::NONE;
 }
@@ -0,0 +1,116 @@
+#pragma once
+//=====================================================================//
+/*! @file
+    @brief  最小／最大デシメーション・クラス @n
+			キャプチャー後に一度だけ、２のべき乗毎の最小値、最大値のテーブル @n
+			を作り、描画時は画面幅分のエントリーだけを参照する。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+    @copyright  Copyright (C) 2020 Kunihito Hiramatsu @n
+                Released under the MIT license @n
+                https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  最小／最大デシメーション・クラス
+		@param[in]	N		サンプル数（２のべき乗）
+		@param[in]	LVL		最大レベル（レベル n で 2^n サンプルを１エントリー）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <uint32_t N, uint32_t LVL>
+	class decimate {
+
+		static_assert((N & (N - 1)) == 0, "N must be a power of two");
+		static_assert(LVL > 0 && (N >> LVL) > 0, "LVL out of range");
+
+	public:
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  最小、最大
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct minmax_t {
+			int16_t	min_;
+			int16_t	max_;
+		};
+
+	private:
+		// レベル１（N/2）、レベル２（N/4）... の順に格納
+		minmax_t	table_[N - (N >> LVL)];
+
+		static uint32_t offset_(uint32_t lvl) noexcept
+		{
+			return N - (N >> (lvl - 1));
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクタ
+		*/
+		//-----------------------------------------------------------------//
+		decimate() noexcept : table_{ } { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  テーブルの作成
+			@param[in]	src		サンプル取得ファンクタ（int16_t src(uint32_t pos)）
+		*/
+		//-----------------------------------------------------------------//
+		template <class SRC>
+		void build(SRC src) noexcept
+		{
+			minmax_t* dst = &table_[0];
+			for(uint32_t i = 0; i < (N / 2); ++i) {
+				int16_t a = src(i * 2 + 0);
+				int16_t b = src(i * 2 + 1);
+				if(a < b) {
+					dst[i].min_ = a;
+					dst[i].max_ = b;
+				} else {
+					dst[i].min_ = b;
+					dst[i].max_ = a;
+				}
+			}
+			for(uint32_t lvl = 2; lvl <= LVL; ++lvl) {
+				const minmax_t* s = &table_[offset_(lvl - 1)];
+				minmax_t* d = &table_[offset_(lvl)];
+				for(uint32_t i = 0; i < (N >> lvl); ++i) {
+					const minmax_t& a = s[i * 2 + 0];
+					const minmax_t& b = s[i * 2 + 1];
+					d[i].min_ = a.min_ < b.min_ ? a.min_ : b.min_;
+					d[i].max_ = a.max_ > b.max_ ? a.max_ : b.max_;
+				}
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  エントリー数の取得
+			@param[in]	lvl		レベル（１～LVL）
+			@return エントリー数
+		*/
+		//-----------------------------------------------------------------//
+		static uint32_t size(uint32_t lvl) noexcept { return N >> lvl; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  最小、最大の取得
+			@param[in]	lvl		レベル（１～LVL）
+			@param[in]	pos		位置（０～size(lvl)－１）
+			@return 最小、最大
+		*/
+		//-----------------------------------------------------------------//
+		const minmax_t& get(uint32_t lvl, uint32_t pos) const noexcept
+		{
+			return table_[offset_(lvl) + pos];
+		}
+	};
+}
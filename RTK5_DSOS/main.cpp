@@ -155,9 +155,17 @@ namespace {
 		if(cmd_.cmp_word(0, "cap")) { // capture
 			trigger_ = utils::capture_trigger::SINGLE;
 			capture_.set_trigger(trigger_);			
+		} else if(cmd_.cmp_word(0, "run")) { // continuous capture
+			trigger_ = utils::capture_trigger::STREAM;
+			capture_.set_trigger(trigger_);
+		} else if(cmd_.cmp_word(0, "stop")) {
+			trigger_ = utils::capture_trigger::NONE;
+			capture_.set_trigger(trigger_);
 		} else if(cmd_.cmp_word(0, "help")) {
 			shell_.help();
 			utils::format("    cap        single trigger\n");
+			utils::format("    run        continuous capture\n");
+			utils::format("    stop       stop capture\n");
 		} else {
 			utils::format("Command error: '%s'\n") % cmd_.get_command();
 		}
@@ -313,6 +321,7 @@ int main(int argc, char** argv)
 	}
 #endif
 
+	uint32_t cap_count = capture_.get_count();
 	while(1) {
 		glcdc_mgr_.sync_vpos();
 
@@ -325,12 +334,21 @@ int main(int argc, char** argv)
 		// タッチ操作による画面更新が必要か？
 		bool f = render_wave_.ui_service();
 
-		// 波形をキャプチャーしたら描画
-		if(f || (trigger_ != utils::capture_trigger::NONE
-			&& capture_.get_trigger() == utils::capture_trigger::NONE)) {
-			trigger_ = utils::capture_trigger::NONE;
+		// 解析、描画の間は、バッファを固定する（固定中はブロック数が変わらない）
+		capture_.acquire();
+		// 新しいブロックをキャプチャーしたら、解析して描画
+		bool cap = cap_count != capture_.get_count();
+		if(cap) {
+			cap_count = capture_.get_count();
+			render_wave_.analyze();
+		}
+		if(f || cap) {
 			render_wave_.update();
 		}
+		capture_.release();
+		if(capture_.get_trigger() == utils::capture_trigger::NONE) {
+			trigger_ = utils::capture_trigger::NONE;
+		}
 
 		update_led_();
 	}
@@ -1,7 +1,9 @@
 #pragma once
 //=====================================================================//
 /*! @file
-    @brief  波形描画クラス
+    @brief  波形描画クラス @n
+			・時間軸は、最小／最大デシメーションで、長いキャプチャーも画面幅で描く。@n
+			・スペクトラム（FFT）表示モード（平均、ピーク・ホールド）
     @author 平松邦仁 (hira@rvf-rc45.net)
     @copyright  Copyright (C) 2018 Kunihito Hiramatsu @n
                 Released under the MIT license @n
@@ -13,6 +15,8 @@
 #include "common/intmath.hpp"
 #include "graphics/color.hpp"
 #include "graphics/dialog.hpp"
+#include "spectrum.hpp"
+#include "decimate.hpp"
 
 namespace utils {
 
@@ -38,13 +42,23 @@ namespace utils {
 		static const int16_t VOLT_BEGIN_POS   = 0;
 		static const int16_t VOLT_LIMIT_POS   = RENDER::glc_type::width - MENU_SIZE;
 
+		static const uint32_t FFT_NUM   = CAPTURE::CAP_NUM < 1024 ? CAPTURE::CAP_NUM : 1024;
+		static const uint32_t DECI_LVL  = 4;
+
 		typedef gui::dialog<RENDER, TOUCH> DIALOG;
+		typedef spectrum<FFT_NUM> SPECTRUM;
+		typedef decimate<CAPTURE::CAP_NUM, DECI_LVL> DECIMATE;
 
 		RENDER&		render_;
 		CAPTURE&	capture_;
 		TOUCH&		touch_;
 		DIALOG		dialog_;
 
+		SPECTRUM	spec_[2];
+		DECIMATE	deci_[2];
+		bool		fft_mode_;
+		uint8_t		deci_lvl_;	///< ０で全サンプル、n で 2^n サンプル／ピクセル
+
 		int16_t		time_pos_;
 		int16_t		time_org_;
 
@@ -118,6 +132,73 @@ namespace utils {
 		}
 
 
+		static int16_t volt_y_(int16_t v) noexcept
+		{
+			v -= 2048;
+			return v / -17;
+		}
+
+
+		void draw_wave_(uint32_t ch, int16_t vpos) noexcept
+		{
+			int16_t ofs = vpos + 272 / 2;
+			if(deci_lvl_ == 0) {
+				for(int16_t x = 0; x < (440 - 1); ++x) {
+					int16_t p0 = time_pos_ + x;
+					int16_t p1 = time_pos_ + x + 1;
+					if(p1 >= static_cast<int16_t>(CAPTURE::CAP_NUM)) {
+						break;
+					}
+					const auto& d0 = capture_.get(p0);
+					const auto& d1 = capture_.get(p1);
+					int16_t y0 = volt_y_(ch == 0 ? d0.ch0_ : d0.ch1_);
+					int16_t y1 = volt_y_(ch == 0 ? d1.ch0_ : d1.ch1_);
+					render_.line(vtx::spos(x, ofs + y0), vtx::spos(x + 1, ofs + y1));
+				}
+			} else {
+				// 縦線で最小から最大を描く（電圧は反転するので max が上）
+				const auto& deci = deci_[ch];
+				for(int16_t x = 0; x < 440; ++x) {
+					uint32_t p = time_pos_ + x;
+					if(p >= DECIMATE::size(deci_lvl_)) {
+						break;
+					}
+					const auto& mm = deci.get(deci_lvl_, p);
+					int16_t y0 = ofs + volt_y_(mm.max_);
+					int16_t y1 = ofs + volt_y_(mm.min_);
+					render_.line_v(x, y0, y1 - y0 + 1);
+				}
+			}
+		}
+
+
+		void draw_spectrum_(uint32_t ch, const graphics::share_color& c) noexcept
+		{
+			// 0 ～ 96 dB を 240 ピクセル
+			const auto& sp = spec_[ch];
+			int16_t py = 0;
+			for(int16_t x = 0; x < 440; ++x) {
+				uint32_t b0 = (x * SPECTRUM::BIN_NUM) / 440;
+				uint32_t b1 = ((x + 1) * SPECTRUM::BIN_NUM) / 440;
+				if(b1 <= b0) b1 = b0 + 1;
+				uint32_t pow = 0;
+				uint32_t peak = 0;
+				for(uint32_t b = b0; b < b1; ++b) {
+					if(sp.get_power(b) > pow) pow = sp.get_power(b);
+					if(sp.get_peak(b) > peak) peak = sp.get_peak(b);
+				}
+				int16_t y = 256 - (SPECTRUM::to_db(pow) * 5 / 2);
+				if(x > 0) {
+					render_.set_fore_color(c);
+					render_.line(vtx::spos(x - 1, py), vtx::spos(x, y));
+				}
+				py = y;
+				render_.set_fore_color(DEF_COLOR::White);
+				render_.line_h(256 - (SPECTRUM::to_db(peak) * 5 / 2), x, 1);
+			}
+		}
+
+
 		void auto_scale_(float a, char unit, char* out, uint32_t len)
 		{
 			char sc = 0;
@@ -166,6 +247,7 @@ namespace utils {
 		//-----------------------------------------------------------------//
 		render_wave(RENDER& render, CAPTURE& capture, TOUCH& touch) noexcept :
 			render_(render), capture_(capture), touch_(touch), dialog_(render, touch),
+			spec_(), deci_(), fft_mode_(false), deci_lvl_(0),
 			time_pos_(0), time_org_(0),
 			ch0_vpos_(0), ch0_vorg_(0), ch1_vpos_(0), ch1_vorg_(0),
 			rate_div_(11), ch0_div_(3), ch1_div_(3),
@@ -317,6 +399,15 @@ namespace utils {
 						capture_.set_trigger(utils::capture_trigger::SINGLE);
 					} else if(menu_run_ == MENU::MES) {
 						measere_ = enum_utils::inc(measere_, MEASERE::NONE, MEASERE::VOLT);
+					} else if(menu_run_ == MENU::SMP) {
+						++deci_lvl_;
+						if(deci_lvl_ > DECI_LVL) deci_lvl_ = 0;
+						time_pos_ = 0;
+					} else if(menu_run_ == MENU::OPT) {
+						fft_mode_ = !fft_mode_;
+						spec_[0].clear();
+						spec_[1].clear();
+						analyze();
 					}
 					return true;
 				} else {
@@ -399,6 +490,30 @@ namespace utils {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  キャプチャーしたブロックの解析 @n
+					デシメーション・テーブルの作成、FFT モードならスペクトラム更新
+		*/
+		//-----------------------------------------------------------------//
+		void analyze() noexcept
+		{
+			deci_[0].build([this](uint32_t pos) { return static_cast<int16_t>(capture_.get(pos).ch0_); });
+			deci_[1].build([this](uint32_t pos) { return static_cast<int16_t>(capture_.get(pos).ch1_); });
+
+			if(!fft_mode_) return;
+
+			// 12 ビットの A/D 値を、中心 0、±16384 にする
+			for(uint32_t i = 0; i < FFT_NUM; ++i) {
+				const auto& d = capture_.get(i);
+				spec_[0].set(i, (static_cast<int16_t>(d.ch0_) - 2048) << 3);
+				spec_[1].set(i, (static_cast<int16_t>(d.ch1_) - 2048) << 3);
+			}
+			spec_[0].update();
+			spec_[1].update();
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  アップ・デート（再描画）
@@ -434,36 +549,14 @@ namespace utils {
 				}
 			}
 
-			for(int16_t x = 0; x < (440 - 1); ++x) {
-				int16_t p0 = time_pos_ + x;
-				int16_t p1 = time_pos_ + x + 1;
-				if(p1 >= static_cast<int16_t>(CAPTURE::CAP_NUM)) {
-					break;
-				}
-				const auto& d0 = capture_.get(p0);
-				const auto& d1 = capture_.get(p1);
-				{
-					int16_t ofs = ch0_vpos_ + 272 / 2;
-					int16_t y0 = d0.ch0_;
-					y0 -= 2048;
-					y0 /= -17;
-					int16_t y1 = d1.ch0_;
-					y1 -= 2048;
-					y1 /= -17;
-					render_.set_fore_color(DEF_COLOR::Lime);
-					render_.line(vtx::spos(x, ofs + y0), vtx::spos(x + 1, ofs + y1));
-				}
-				{
-					int16_t ofs = ch1_vpos_ + 272 / 2;
-					int16_t y0 = d0.ch1_;
-					y0 -= 2048;
-					y0 /= -17;
-					int16_t y1 = d1.ch1_;
-					y1 -= 2048;
-					y1 /= -17;
-					render_.set_fore_color(DEF_COLOR::Fuchsi);
-					render_.line(vtx::spos(x, ofs + y0), vtx::spos(x + 1, ofs + y1));
-				}
+			if(fft_mode_) {
+				draw_spectrum_(0, DEF_COLOR::Lime);
+				draw_spectrum_(1, DEF_COLOR::Fuchsi);
+			} else {
+				render_.set_fore_color(DEF_COLOR::Lime);
+				draw_wave_(0, ch0_vpos_);
+				render_.set_fore_color(DEF_COLOR::Fuchsi);
+				draw_wave_(1, ch1_vpos_);
 			}
 
 			draw_sampling_info();
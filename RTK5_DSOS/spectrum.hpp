@@ -0,0 +1,226 @@
+#pragma once
+//=====================================================================//
+/*! @file
+    @brief  スペクトラム解析クラス（固定小数点 FFT） @n
+			・radix-2 時間間引き、各段で 1/2 にスケーリング（Q15）@n
+			・ハン窓、指数移動平均、ピーク・ホールド @n
+			・回転因子、窓のテーブルは、同じ点数のインスタンスで共有
+    @author 平松邦仁 (hira@rvf-rc45.net)
+    @copyright  Copyright (C) 2020 Kunihito Hiramatsu @n
+                Released under the MIT license @n
+                https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <cmath>
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  スペクトラム解析クラス
+		@param[in]	N	FFT の点数（２のべき乗）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <uint32_t N>
+	class spectrum {
+
+		static_assert(N >= 16 && (N & (N - 1)) == 0, "N must be a power of two (16 or more)");
+
+	public:
+		static const uint32_t BIN_NUM = N / 2;	///< 周波数ビンの数
+
+	private:
+		static int16_t	cos_[N / 2];
+		static int16_t	sin_[N / 2];
+		static int16_t	win_[N];
+		static bool		table_ok_;
+
+		int16_t		re_[N];
+		int16_t		im_[N];
+
+		uint32_t	avg_[N / 2];
+		uint32_t	peak_[N / 2];
+
+		uint8_t		avg_shift_;
+		bool		avg_ok_;
+
+		static void init_table_() noexcept
+		{
+			if(table_ok_) return;
+
+			static const float pi = 3.14159265358979f;
+			for(uint32_t i = 0; i < (N / 2); ++i) {
+				float a = 2.0f * pi * static_cast<float>(i) / static_cast<float>(N);
+				cos_[i] = static_cast<int16_t>(std::cos(a) * 32767.0f);
+				sin_[i] = static_cast<int16_t>(std::sin(a) * 32767.0f);
+			}
+			for(uint32_t i = 0; i < N; ++i) {
+				float a = 2.0f * pi * static_cast<float>(i) / static_cast<float>(N - 1);
+				win_[i] = static_cast<int16_t>((0.5f - 0.5f * std::cos(a)) * 32767.0f);
+			}
+			table_ok_ = true;
+		}
+
+
+		void transform_() noexcept
+		{
+			// ビット反転の並べ替え
+			for(uint32_t i = 1, j = 0; i < N; ++i) {
+				uint32_t bit = N >> 1;
+				while(j & bit) {
+					j ^= bit;
+					bit >>= 1;
+				}
+				j |= bit;
+				if(i < j) {
+					auto t = re_[i]; re_[i] = re_[j]; re_[j] = t;
+					t = im_[i]; im_[i] = im_[j]; im_[j] = t;
+				}
+			}
+
+			// バタフライ（各段で 1/2 にして、オーバーフローを防ぐ）
+			for(uint32_t len = 2; len <= N; len <<= 1) {
+				uint32_t half = len / 2;
+				uint32_t step = N / len;
+				for(uint32_t k = 0; k < half; ++k) {
+					int32_t wr =  cos_[k * step];
+					int32_t wi = -sin_[k * step];
+					for(uint32_t a = k; a < N; a += len) {
+						uint32_t b = a + half;
+						int32_t tr = (re_[b] * wr - im_[b] * wi) >> 15;
+						int32_t ti = (re_[b] * wi + im_[b] * wr) >> 15;
+						int32_t ar = re_[a];
+						int32_t ai = im_[a];
+						re_[b] = (ar - tr) >> 1;
+						im_[b] = (ai - ti) >> 1;
+						re_[a] = (ar + tr) >> 1;
+						im_[a] = (ai + ti) >> 1;
+					}
+				}
+			}
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクタ
+		*/
+		//-----------------------------------------------------------------//
+		spectrum() noexcept : re_{ 0 }, im_{ 0 }, avg_{ 0 }, peak_{ 0 },
+			avg_shift_(0), avg_ok_(false)
+		{
+			init_table_();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  平均化の設定
+			@param[in]	shift	指数移動平均の係数（1/2^shift、０で平均しない）
+		*/
+		//-----------------------------------------------------------------//
+		void set_average(uint8_t shift) noexcept
+		{
+			avg_shift_ = shift;
+			avg_ok_ = false;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  平均とピーク・ホールドをクリア
+		*/
+		//-----------------------------------------------------------------//
+		void clear() noexcept
+		{
+			for(uint32_t i = 0; i < (N / 2); ++i) {
+				avg_[i] = 0;
+				peak_[i] = 0;
+			}
+			avg_ok_ = false;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  サンプルの設定（窓を掛けて格納）
+			@param[in]	pos	位置（０～Ｎ－１）
+			@param[in]	v	サンプル（符号付き、±16384 程度を推奨）
+		*/
+		//-----------------------------------------------------------------//
+		void set(uint32_t pos, int16_t v) noexcept
+		{
+			re_[pos] = (static_cast<int32_t>(v) * win_[pos]) >> 15;
+			im_[pos] = 0;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  変換して、パワー、平均、ピーク・ホールドを更新
+		*/
+		//-----------------------------------------------------------------//
+		void update() noexcept
+		{
+			transform_();
+
+			for(uint32_t i = 0; i < (N / 2); ++i) {
+				int32_t r = re_[i];
+				int32_t m = im_[i];
+				uint32_t p = static_cast<uint32_t>(r * r) + static_cast<uint32_t>(m * m);
+				if(avg_shift_ == 0 || !avg_ok_) {
+					avg_[i] = p;
+				} else if(p >= avg_[i]) {
+					avg_[i] += (p - avg_[i]) >> avg_shift_;
+				} else {
+					avg_[i] -= (avg_[i] - p) >> avg_shift_;
+				}
+				if(avg_[i] > peak_[i]) peak_[i] = avg_[i];
+			}
+			avg_ok_ = true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  パワー（平均済み）の取得
+			@param[in]	bin	周波数ビン
+			@return パワー
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_power(uint32_t bin) const noexcept { return avg_[bin]; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ピーク・ホールドの取得
+			@param[in]	bin	周波数ビン
+			@return パワー
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_peak(uint32_t bin) const noexcept { return peak_[bin]; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  パワーをデシベルに変換（log2 の近似）
+			@param[in]	pow	パワー
+			@return デシベル（０～９３）
+		*/
+		//-----------------------------------------------------------------//
+		static int16_t to_db(uint32_t pow) noexcept
+		{
+			if(pow == 0) return 0;
+			uint32_t msb = 31 - __builtin_clz(pow);
+			uint32_t frac = ((pow << (31 - msb)) >> 23) & 0xff;
+			uint32_t lg = (msb << 8) | frac;  // log2 (Q8)
+			return (lg * 771) >> 16;  // 10 * log10(2) = 3.0103
+		}
+	};
+
+	template <uint32_t N> int16_t spectrum<N>::cos_[N / 2];
+	template <uint32_t N> int16_t spectrum<N>::sin_[N / 2];
+	template <uint32_t N> int16_t spectrum<N>::win_[N];
+	template <uint32_t N> bool spectrum<N>::table_ok_ = false;
+}
@@ -338,17 +338,6 @@ extern "C" {
 ///		rtc_.get_time(t);
 		return utils::str::get_fattime(t);
 	}
-
-
-#if 0
-	void gr_plot(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b)
-	{
-		uint16_t c =   (static_cast<uint16_t>(r & 0xf8) << 8)
-              | (static_cast<uint16_t>(g & 0xfc) << 3)
-              | (static_cast<uint16_t>(b & 0xf8) >> 3);
-		render_.plot(x, y, c);
-	}
-#endif
 }
 
 int main(int argc, char** argv);
@@ -76,13 +76,13 @@ namespace app {
 			rdr.draw_text(vtx::spos(0, 16*3), tmp);
 			{
 				const auto& t = nmea.get_satellite_info(0);
-				utils::sformat("Satellite NO: %s", tmp, sizeof(tmp)) % t.no_;
+				utils::sformat("Satellite NO: %u", tmp, sizeof(tmp)) % t.no_;
 				rdr.draw_text(vtx::spos(0, 16*5), tmp);
-				utils::sformat("Elevation: %s", tmp, sizeof(tmp)) % t.elv_;
+				utils::sformat("Elevation: %d", tmp, sizeof(tmp)) % t.elv_;
 				rdr.draw_text(vtx::spos(0, 16*6), tmp);
-				utils::sformat("Azimuth: %s", tmp, sizeof(tmp)) % t.azi_;
+				utils::sformat("Azimuth: %u", tmp, sizeof(tmp)) % t.azi_;
 				rdr.draw_text(vtx::spos(0, 16*7), tmp);
-				utils::sformat("Carria noise: %s [dB]", tmp, sizeof(tmp)) % t.cn_;
+				utils::sformat("Carria noise: %u [dB]", tmp, sizeof(tmp)) % t.cn_;
 				rdr.draw_text(vtx::spos(0, 16*8), tmp);
 			}
 			const auto& touch = at_scenes_base().at_touch();
@@ -46,6 +46,22 @@
 
 static nes_t nes_;
 
+/* profiling (kept across nes_create) */
+static nestimerfunc_t nes_timer = NULL;
+static uint32 nes_cpu_time = 0;
+static uint32 nes_ppu_time = 0;
+
+void nes_settimer(nestimerfunc_t func)
+{
+	nes_timer = func;
+}
+
+void nes_gettime(uint32 *cpu_time, uint32 *ppu_time)
+{
+	if(cpu_time) *cpu_time = nes_cpu_time;
+	if(ppu_time) *ppu_time = nes_ppu_time;
+}
+
 nes_t *nes_getcontext(void)
 {
    return &nes_;
@@ -267,8 +283,16 @@ static void nes_renderframe(bool draw_flag)
 	const mapintf_t *mapintf = nes_.mmc->intf;
 	int in_vblank = 0;
 
+	uint32 t0 = 0;
+	uint32 t1 = 0;
+
 	while(262 != nes_.scanline) {
+		if(nes_timer) t0 = nes_timer();
 		ppu_scanline(nes_.vidbuf, nes_.scanline, draw_flag);
+		if(nes_timer) {
+			t1 = nes_timer();
+			nes_ppu_time += t1 - t0;
+		}
 
 		if(241 == nes_.scanline) {
 			/* 7-9 cycle delay between when VINT flag goes up and NMI is taken */
@@ -292,6 +316,7 @@ static void nes_renderframe(bool draw_flag)
 		elapsed_cycles = nes6502_execute((int) nes_.scanline_cycles);
 		nes_.scanline_cycles -= (float) elapsed_cycles;
 		nes_checkfiq(elapsed_cycles);
+		if(nes_timer) nes_cpu_time += nes_timer() - t1;
 
 		ppu_endscanline(nes_.scanline);
 		nes_.scanline++;
@@ -319,6 +344,17 @@ void nes_emulate(int frames)
 	}
 }
 
+
+void nes_emulate_frame(bool draw_flag)
+{
+	if(nes_.pause) return;
+
+	nes_.scanline_cycles = 0;
+	nes_.fiq_cycles = (int) NES_FIQ_PERIOD;
+
+	nes_renderframe(draw_flag);
+}
+
 static void mem_trash(uint8 *buffer, int length)
 {
    int i;
@@ -54,6 +54,9 @@ enum
 };
 
 
+/* free running tick counter for the optional profiling */
+typedef uint32 (*nestimerfunc_t)(void);
+
 typedef struct nes_s
 {
    /* hardware things */
@@ -103,6 +106,10 @@ extern void nes_setfiq(uint8 state);
 extern void nes_nmi(void);
 extern void nes_irq(void);
 extern void nes_emulate(int frame);
+extern void nes_emulate_frame(bool draw_flag);
+
+extern void nes_settimer(nestimerfunc_t func);
+extern void nes_gettime(uint32 *cpu_time, uint32 *ppu_time);
 
 extern void nes_reset(int reset_type);
 
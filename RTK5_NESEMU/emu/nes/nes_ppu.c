@@ -50,6 +50,10 @@
 /* the NES PPU */
 static ppu_t ppu;
 
+/* scanline output hook (kept across ppu_create) */
+static ppulinefunc_t ppu_linefunc = NULL;
+static void *ppu_linecontext = NULL;
+
 void ppu_displaysprites(bool display)
 {
    ppu.drawsprites = display;
@@ -544,6 +548,12 @@ void ppu_setvromswitch(ppuvromswitch_t func)
    ppu.vromswitch = func;
 }
 
+void ppu_setlinefunc(ppulinefunc_t func, void *context)
+{
+   ppu_linefunc = func;
+   ppu_linecontext = context;
+}
+
 /* rendering routines */
 INLINE void draw_bgtile(uint8 *surface, uint8 pat1, uint8 pat2, 
                         const uint8 *colors)
@@ -1005,6 +1015,10 @@ static void ppu_renderscanline(bitmap_t *bmp, int scanline, bool draw_flag)
    } else {
       ppu_fakeoam(scanline);
    }
+
+   /* hand the finished line over while it is still in cache */
+   if (draw_flag && ppu_linefunc)
+      ppu_linefunc(ppu_linecontext, scanline, buf);
 }
 
 
@@ -71,6 +71,9 @@
 typedef void (*ppulatchfunc_t)(uint32 address, uint8 value);
 typedef void (*ppuvromswitch_t)(uint8 value);
 
+/* rendered scanline output (palette indices, NES_SCREEN_WIDTH pixels) */
+typedef void (*ppulinefunc_t)(void *context, int scanline, const uint8 *line);
+
 typedef struct ppu_s
 {
    /* big nasty memory chunks */
@@ -115,6 +118,7 @@ extern "C" {
 /* TODO: should use this pointers */
 extern void ppu_setlatchfunc(ppulatchfunc_t func);
 extern void ppu_setvromswitch(ppuvromswitch_t func);
+extern void ppu_setlinefunc(ppulinefunc_t func, void *context);
 
 extern ppu_t *ppu_getcontext(void);
 
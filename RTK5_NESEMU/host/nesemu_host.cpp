@@ -0,0 +1,228 @@
+//=====================================================================//
+/*!	@file
+	@brief	NES エミュレーター、ヘッドレスのホスト・ビルド @n
+			ROM を指定フレーム数実行し、CPU/PPU/APU/転送の時間を表示する。@n
+			（nesemu.hpp の時間関数、カウンターをそのまま使う）@n
+			ROM を指定しない場合、NROM の合成 ROM（背景、スクロール、@n
+			矩形波）を作って実行し、フレーム数と描画を検査する。@n
+			nesemu_host [-f フレーム数] [-s 最大スキップ数] [ROM ファイル]
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <vector>
+#include "nesemu.hpp"
+
+namespace {
+
+	static const uint32_t LCD_X = 480;
+	static const uint32_t LCD_Y = 272;
+
+	uint16_t	fb_[LCD_X * LCD_Y];
+
+	emu::nesemu	nesemu_;
+
+	const char* rom_path_ = "release/test.nes";
+
+	uint32_t get_us_()
+	{
+		static auto org = std::chrono::steady_clock::now();
+		auto d = std::chrono::steady_clock::now() - org;
+		return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+	}
+
+
+	// 合成 ROM（NROM-128、PRG 16K、CHR 8K）@n
+	// 起動後、パレットとネーム・テーブルを埋めて、NMI 毎に横スクロールする。
+	bool make_rom_(const char* path) noexcept
+	{
+		static const uint8_t prg[] = {
+			// $C000: reset
+			0x78,						// SEI
+			0xD8,						// CLD
+			0xA2, 0xFF,					// LDX #$FF
+			0x9A,						// TXS
+			0x2C, 0x02, 0x20,			// BIT $2002（VBLANK 待ち）
+			0x10, 0xFB,					// BPL -5
+			0x2C, 0x02, 0x20,			// BIT $2002
+			0x10, 0xFB,					// BPL -5
+			// パレット（$3F00～$3F1F）
+			0xA9, 0x3F, 0x8D, 0x06, 0x20,	// LDA #$3F, STA $2006
+			0xA9, 0x00, 0x8D, 0x06, 0x20,	// LDA #$00, STA $2006
+			0xA2, 0x00,					// LDX #0
+			0x8A,						// TXA
+			0x8D, 0x07, 0x20,			// STA $2007
+			0xE8,						// INX
+			0xE0, 0x20,					// CPX #$20
+			0xD0, 0xF7,					// BNE -9
+			// ネーム・テーブル、属性（$2000～$23FF）
+			0xA9, 0x20, 0x8D, 0x06, 0x20,	// LDA #$20, STA $2006
+			0xA9, 0x00, 0x8D, 0x06, 0x20,	// LDA #$00, STA $2006
+			0xA0, 0x04,					// LDY #4
+			0xA2, 0x00,					// LDX #0
+			0x8A,						// TXA
+			0x8D, 0x07, 0x20,			// STA $2007
+			0xE8,						// INX
+			0xD0, 0xF9,					// BNE -7
+			0x88,						// DEY
+			0xD0, 0xF6,					// BNE -10
+			// 矩形波
+			0xA9, 0x01, 0x8D, 0x15, 0x40,	// LDA #$01, STA $4015
+			0xA9, 0xBF, 0x8D, 0x00, 0x40,	// LDA #$BF, STA $4000
+			0xA9, 0xFD, 0x8D, 0x02, 0x40,	// LDA #$FD, STA $4002
+			0xA9, 0x00, 0x8D, 0x03, 0x40,	// LDA #$00, STA $4003
+			// スクロール、NMI と描画を有効
+			0xA9, 0x00, 0x8D, 0x05, 0x20, 0x8D, 0x05, 0x20,
+			0xA9, 0x80, 0x8D, 0x00, 0x20,	// LDA #$80, STA $2000
+			0xA9, 0x1E, 0x8D, 0x01, 0x20,	// LDA #$1E, STA $2001
+			// メイン・ループ
+			0xE6, 0x00,					// INC $00
+			0x4C, 0x00, 0x00,			// JMP（アドレスは後で設定）
+			// NMI
+			0xE6, 0x01,					// INC $01
+			0xAD, 0x02, 0x20,			// LDA $2002
+			0xA5, 0x01,					// LDA $01
+			0x8D, 0x05, 0x20,			// STA $2005
+			0xA9, 0x00, 0x8D, 0x05, 0x20,	// LDA #$00, STA $2005
+			0x40,						// RTI
+		};
+		static const uint32_t loop = 0x62;	// メイン・ループの位置
+		static const uint32_t nmi = 0x67;	// NMI の位置
+		if(prg[loop] != 0xE6 || prg[nmi] != 0xE6 || prg[nmi - 1] != 0x00) return false;
+
+		std::vector<uint8_t> rom(16 + 16384 + 8192, 0);
+		static const uint8_t head[] = { 'N', 'E', 'S', 0x1A, 1, 1, 0, 0 };
+		memcpy(&rom[0], head, sizeof(head));
+		uint8_t* p = &rom[16];
+		memcpy(p, prg, sizeof(prg));
+		p[loop + 3] = (0xC000 + loop) & 0xff;
+		p[loop + 4] = (0xC000 + loop) >> 8;
+		p[0x3FFA] = (0xC000 + nmi) & 0xff;	// NMI
+		p[0x3FFB] = (0xC000 + nmi) >> 8;
+		p[0x3FFC] = 0x00;					// RESET
+		p[0x3FFD] = 0xC0;
+		p[0x3FFE] = (0xC000 + nmi + 15) & 0xff;	// IRQ（NMI の RTI）
+		p[0x3FFF] = (0xC000 + nmi) >> 8;
+		// CHR：タイル毎に違う模様
+		uint8_t* chr = &rom[16 + 16384];
+		for(uint32_t i = 0; i < 8192; ++i) {
+			uint32_t t = i >> 4;
+			chr[i] = (t * 0x35) ^ (i * 0x1D) ^ ((i & 8) ? 0xAA : 0x00);
+		}
+
+		FILE* fp = fopen(path, "wb");
+		if(fp == nullptr) return false;
+		bool ok = fwrite(&rom[0], 1, rom.size(), fp) == rom.size();
+		fclose(fp);
+		return ok;
+	}
+
+
+	uint32_t fnv_(const uint16_t* p, uint32_t n) noexcept
+	{
+		uint32_t h = 2166136261;
+		for(uint32_t i = 0; i < n; ++i) {
+			h = (h ^ (p[i] & 0xff)) * 16777619;
+			h = (h ^ (p[i] >> 8)) * 16777619;
+		}
+		return h;
+	}
+
+
+	bool drawn_() noexcept
+	{
+		for(auto c : fb_) {
+			if(c != 0) return true;
+		}
+		return false;
+	}
+}
+
+
+extern "C" {
+
+	uint8_t get_fami_pad()
+	{
+		return 0;
+	}
+
+
+	int emu_log(const char* text)
+	{
+		fputs(text, stdout);
+		return 0;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	uint32_t frames = 600;
+	uint32_t skip = 0;
+	const char* rom = nullptr;
+	for(int i = 1; i < argc; ++i) {
+		if(strcmp(argv[i], "-f") == 0 && (i + 1) < argc) {
+			frames = strtoul(argv[++i], nullptr, 10);
+		} else if(strcmp(argv[i], "-s") == 0 && (i + 1) < argc) {
+			skip = strtoul(argv[++i], nullptr, 10);
+		} else {
+			rom = argv[i];
+		}
+	}
+	bool self = rom == nullptr;
+	if(self) {
+		if(!make_rom_(rom_path_)) {
+			printf("Can't write: '%s'\n", rom_path_);
+			return 1;
+		}
+		rom = rom_path_;
+	}
+
+	nesemu_.start();
+	if(!nesemu_.open(rom)) {
+		printf("Can't open ROM: '%s'\n", rom);
+		return 1;
+	}
+	nesemu_.set_time_func(get_us_, 1000000);
+	nesemu_.set_frame_skip(skip);
+
+	uint32_t audio = 0;
+	uint32_t sum = 0;
+	bool moved = false;
+	auto t0 = get_us_();
+	for(uint32_t i = 0; i < frames; ) {
+		nesemu_.service(fb_, LCD_X, LCD_Y);
+		audio += nesemu_.get_audio_len();
+		i = nesemu_.get_counter().frame_;
+		auto h = fnv_(fb_, LCD_X * LCD_Y);
+		if(i > 2 && h != sum) moved = true;
+		sum = h;
+	}
+	auto us = get_us_() - t0;
+
+	const auto& c = nesemu_.get_counter();
+	double n = c.frame_;
+	printf("ROM: '%s'\n", rom);
+	printf("Frames: %u (skip %u), %.1f ms, %.1f fps (x%.2f real time)\n",
+		c.frame_, c.skip_, us / 1000.0, n * 1e6 / us, n * 1e6 / us / 60.0);
+	printf("Per frame: CPU %.1f us, PPU %.1f us, APU %.1f us, Blit %.1f us\n",
+		c.cpu_ / n, c.ppu_ / n, c.apu_ / n, c.blit_ / n);
+	printf("Audio: %u samples, Frame buffer: %08X\n", audio, sum);
+
+	nesemu_.close();
+
+	if(self) {
+		// 合成 ROM：全フレームを描画し、スクロールで画面が変わる事
+		bool ok = c.frame_ >= frames && (skip > 0 || c.skip_ == 0) && moved
+			&& audio >= (frames * 367) && drawn_();
+		printf("nesemu_host: %s\n", ok ? "OK" : "NG");
+		return ok ? 0 : 1;
+	}
+	return 0;
+}
@@ -118,9 +118,14 @@ namespace {
 	typedef utils::sound_out<1024, 512> SOUND_OUT;
 	SOUND_OUT	sound_out_;
 
+	volatile uint32_t	sample_count_;
+
+	uint32_t get_sample_count_() { return sample_count_; }
+
 	class tpu_task {
 	public:
 		void operator() () {
+			++sample_count_;
 			uint32_t tmp = wpos_;
 			++wpos_;
 			if((tmp ^ wpos_) & 64) {
@@ -435,6 +440,9 @@ int main(int argc, char** argv)
 	}
 
 	nesemu_.start();
+	// 再生サンプル数を時間として、遅れた場合フレームをスキップする
+	nesemu_.set_time_func(get_sample_count_, 22050);
+	nesemu_.set_frame_skip(2);
 
 	rootm_.clear();
 	rootm_.set_gap(20);
@@ -1,7 +1,13 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	NES Emulator ハンドラー
+	@brief	NES Emulator ハンドラー @n
+			・PPU がレンダリングしたスキャンラインを、その場で RGB565 に変換して @n
+			  フレームバッファに書き込む。（フレーム全体の２回目のコピーを行わない）@n
+			・パレットの変更は、エントリー毎に追跡して LUT を更新する。@n
+			・時間関数を設定すると、遅れたフレームを描画せずにエミュレートする @n
+			  （APU は毎フレーム実行）フレーム・スキップと、CPU/PPU/APU/転送の @n
+			  時間計測が有効になる。
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2018, 2019 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -31,6 +37,29 @@ namespace emu {
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	class nesemu {
+	public:
+
+		static const uint32_t SKIP_MAX = 3;	///< 最大フレーム・スキップ数
+
+		typedef uint32_t (*time_func)();
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  時間計測カウンター（時間関数のカウント）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct counter_t {
+			uint32_t	frame_;		///< エミュレートしたフレーム数
+			uint32_t	skip_;		///< 描画をスキップしたフレーム数
+			uint32_t	cpu_;		///< CPU の時間
+			uint32_t	ppu_;		///< PPU の時間（転送を除く）
+			uint32_t	apu_;		///< APU の時間
+			uint32_t	blit_;		///< RGB565 変換と転送の時間
+
+			counter_t() noexcept : frame_(0), skip_(0), cpu_(0), ppu_(0), apu_(0), blit_(0) { }
+		};
+
+	private:
 
 		static const int nes_width_  = 256;
 		static const int nes_height_ = 240;
@@ -38,7 +67,23 @@ namespace emu {
 		static const int sample_bits_ = 16;
 		static const int audio_len_ = (sample_rate_ / 60) + 1;
 
-		uint16_t		audio_buf_[audio_len_];
+		uint16_t		audio_buf_[audio_len_ * (SKIP_MAX + 1)];
+		uint32_t		audio_num_;
+
+		uint16_t		lut_[256];
+		rgb_t			pal_[64];
+		bool			pal_ok_;
+
+		uint16_t*		dst_;
+		uint32_t		xs_;
+
+		time_func		time_func_;
+		uint32_t		time_rate_;
+		uint32_t		time_org_;
+		uint32_t		time_acc_;
+		uint32_t		skip_max_;
+
+		counter_t		counter_;
 
 		bool			nesrom_;
 
@@ -48,18 +93,127 @@ namespace emu {
 
 		nesinput_t		inp_[2];
 
+		// パレットの変更されたエントリーだけ LUT を更新
+		void update_lut_(const rgb_t* pal) noexcept
+		{
+			for(uint32_t i = 0; i < 64; ++i) {
+				if(pal_ok_ && pal[i].r == pal_[i].r && pal[i].g == pal_[i].g && pal[i].b == pal_[i].b) {
+					continue;
+				}
+				pal_[i] = pal[i];
+				// R(5), G(6), B(5)
+				uint16_t c = ((pal[i].r & 0xf8) << 8) | ((pal[i].g & 0xfc) << 3) | (pal[i].b >> 3);
+				lut_[i + 128 + 64] = lut_[i + 128] = lut_[i + 64] = lut_[i] = c;
+			}
+			pal_ok_ = true;
+		}
+
+
+		// PPU のスキャンライン出力（RGB565 に変換して書き込む）
+		static void put_line_(void* context, int scanline, const uint8* src)
+		{
+			auto& t = *static_cast<nesemu*>(context);
+			if(t.dst_ == nullptr || scanline < 16) return;
+
+			uint32_t t0 = 0;
+			if(t.time_func_ != nullptr) t0 = t.time_func_();
+			uint16_t* dst = t.dst_ + (scanline - 16) * t.xs_;
+			const uint16_t* lut = t.lut_;
+			for(int w = 0; w < nes_width_ / 8; ++w) {
+				dst[0] = lut[src[0]]; dst[1] = lut[src[1]];
+				dst[2] = lut[src[2]]; dst[3] = lut[src[3]];
+				dst[4] = lut[src[4]]; dst[5] = lut[src[5]];
+				dst[6] = lut[src[6]]; dst[7] = lut[src[7]];
+				dst += 8;
+				src += 8;
+			}
+			if(t.time_func_ != nullptr) t.counter_.blit_ += t.time_func_() - t0;
+		}
+
+
+		// 経過時間から、エミュレートするフレーム数を求める
+		uint32_t get_frames_() noexcept
+		{
+			if(time_func_ == nullptr || time_rate_ == 0 || skip_max_ == 0) return 1;
+
+			auto t = time_func_();
+			auto d = t - time_org_;
+			time_org_ = t;
+			if(d > time_rate_) d = time_rate_;
+			time_acc_ += d * 60;  // １フレームが「time_rate_」
+
+			uint32_t n = time_acc_ / time_rate_;
+			if(n < 1) n = 1;
+			else if(n > (skip_max_ + 1)) n = skip_max_ + 1;
+			if(time_acc_ > (n * time_rate_)) time_acc_ -= n * time_rate_;
+			else time_acc_ = 0;
+			// 取り戻せない遅れは捨てる
+			if(time_acc_ > time_rate_) time_acc_ = time_rate_;
+			return n;
+		}
+
 	public:
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  コンストラクタ
 		*/
 		//-----------------------------------------------------------------//
-		nesemu() noexcept : audio_buf_{ 0 }, nesrom_(false),
+		nesemu() noexcept : audio_buf_{ 0 }, audio_num_(audio_len_),
+			lut_{ 0 }, pal_{ }, pal_ok_(false), dst_(nullptr), xs_(0),
+			time_func_(nullptr), time_rate_(0), time_org_(0), time_acc_(0), skip_max_(0),
+			counter_(), nesrom_(false),
 			disa_(nes6502_getbyte, nes6502_putbyte),
 			mon_val_{ 0 }
 		{ }
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  時間関数の設定
+			@param[in]	func	時間関数（フリーランのカウンター）
+			@param[in]	rate	時間関数の１秒あたりのカウント
+		*/
+		//-----------------------------------------------------------------//
+		void set_time_func(time_func func, uint32_t rate) noexcept
+		{
+			time_func_ = func;
+			time_rate_ = rate;
+			time_acc_ = 0;
+			if(func != nullptr) time_org_ = func();
+			nes_settimer(func);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  フレーム・スキップの設定（時間関数が必要）
+			@param[in]	max		最大スキップ数（０で無効、最大 SKIP_MAX）
+		*/
+		//-----------------------------------------------------------------//
+		void set_frame_skip(uint32_t max) noexcept
+		{
+			skip_max_ = max > SKIP_MAX ? SKIP_MAX : max;
+			time_acc_ = 0;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  カウンターの取得
+			@return カウンター
+		*/
+		//-----------------------------------------------------------------//
+		const counter_t& get_counter() const noexcept { return counter_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  カウンターのリセット
+		*/
+		//-----------------------------------------------------------------//
+		void reset_counter() noexcept { counter_ = counter_t(); }
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  開始
@@ -71,6 +225,8 @@ namespace emu {
 		{
 			log_init();
 			nes_create(sample_rate_, sample_bits_);
+			ppu_setlinefunc(put_line_, this);
+			nes_settimer(time_func_);
 
             inp_[0].type = INP_JOYPAD0;
             inp_[0].data = 0;
@@ -207,49 +363,54 @@ namespace emu {
 				}
 			}
 
-			uint16_t luttmp[256];
-			for(uint32_t i = 0; i < 64; ++i) {
-               	uint16_t r = lut[i].r;  // R
-				uint16_t g = lut[i].g;  // G
-				uint16_t b = lut[i].b;  // B
-				// R(5), G(6), B(5)
-				luttmp[i] = ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
-				luttmp[i+128+64] = luttmp[i+128] = luttmp[i+64] = luttmp[i];
-			}
+			update_lut_(lut);
 			uint16_t* dst = static_cast<uint16_t*>(org);
 			dst += ((ys - (nes_height_ - 16)) / 2) * xs;
-			const uint8_t* src = v->data;
-			src += v->pitch * 16;
-			for(int h = 0; h < (nes_height_ - 16); ++h) {
-				uint16_t* tmp = dst;
-				tmp += (xs - nes_width_) / 2;
-				for(int w = 0; w < nes_width_ / 16; ++w) {
-					*tmp++ = luttmp[*src++]; *tmp++ = luttmp[*src++];
-					*tmp++ = luttmp[*src++]; *tmp++ = luttmp[*src++];
-					*tmp++ = luttmp[*src++]; *tmp++ = luttmp[*src++];
-					*tmp++ = luttmp[*src++]; *tmp++ = luttmp[*src++];
-					*tmp++ = luttmp[*src++]; *tmp++ = luttmp[*src++];
-					*tmp++ = luttmp[*src++]; *tmp++ = luttmp[*src++];
-					*tmp++ = luttmp[*src++]; *tmp++ = luttmp[*src++];
-					*tmp++ = luttmp[*src++]; *tmp++ = luttmp[*src++];
-				}
-				src += v->pitch - nes_width_;
-				dst += xs;
+			dst += (xs - nes_width_) / 2;
+			dst_ = dst;
+			xs_ = xs;
+
+			audio_num_ = audio_len_;
+			if(!nesrom_) return;
+
+			uint32_t cpu0 = 0;
+			uint32_t ppu0 = 0;
+			nes_gettime(&cpu0, &ppu0);
+			auto blit0 = counter_.blit_;
+
+			auto n = get_frames_();
+			audio_num_ = 0;
+			for(uint32_t i = 0; i < n; ++i) {
+				uint32_t t0 = 0;
+				if(time_func_ != nullptr) t0 = time_func_();
+				apu_process(&audio_buf_[audio_num_], audio_len_);
+				if(time_func_ != nullptr) counter_.apu_ += time_func_() - t0;
+				audio_num_ += audio_len_;
+
+				// 最後のフレームだけ描画する
+				bool draw = (i + 1) == n;
+				nes_emulate_frame(draw);
+				++counter_.frame_;
+				if(!draw) ++counter_.skip_;
 			}
-			if(nesrom_) {
-				apu_process(audio_buf_, audio_len_);
-				nes_emulate(1);
+
+			if(time_func_ != nullptr) {
+				uint32_t cpu1 = 0;
+				uint32_t ppu1 = 0;
+				nes_gettime(&cpu1, &ppu1);
+				counter_.cpu_ += cpu1 - cpu0;
+				counter_.ppu_ += (ppu1 - ppu0) - (counter_.blit_ - blit0);
 			}
 		}
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  オーディオ・バッファの長さを取得
+			@brief  オーディオ・バッファの長さを取得（エミュレートしたフレーム分）
 			@return オーディオ・バッファの長さ
 		*/
 		//-----------------------------------------------------------------//
-		uint32_t get_audio_len() const noexcept { return audio_len_; }
+		uint32_t get_audio_len() const noexcept { return audio_num_; }
 
 
 		//-----------------------------------------------------------------//
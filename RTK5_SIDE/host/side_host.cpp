@@ -0,0 +1,227 @@
+//=====================================================================//
+/*!	@file
+	@brief	Space Invaders エミュレーター（i8080）、ヘッドレスのホスト・ビルド @n
+			ROM を指定しない場合、合成プログラム（メモリー転送、演算、@n
+			サブルーチン）を、次の３つの方法で同じサイクル数実行し、@n
+			結果（レジスター、メモリー、サイクル数）が一致する事を検査して、@n
+			それぞれのエミュレーション速度（MHz）を表示する。@n
+			・仮想関数（readByte/writeByte）、１命令毎の step（従来の呼び出し）@n
+			・ページ・マップ、step @n
+			・ページ・マップ、run（スレッデッド・ディスパッチ）@n
+			ROM のディレクトリー（invaders.h、g、f、e）を指定した場合、@n
+			InvadersMachine を指定フレーム数実行し、速度を表示する。@n
+			side_host [-f フレーム数] [ROM ディレクトリー]
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include "side/arcade.h"
+
+namespace {
+
+	static const unsigned CPU_CLOCK = 2000000;	///< 2MHz
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	64K バイトの RAM だけを持つ環境 @n
+				map が「true」なら、全てのページをマップする。
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class ram_env : public I8080Environment {
+		unsigned char	mem_[0x10000];
+	public:
+		ram_env(bool map) {
+			memset(mem_, 0, sizeof(mem_));
+			if(map) {
+				mapRead(0, sizeof(mem_), mem_);
+				mapWrite(0, sizeof(mem_), mem_);
+			}
+		}
+
+		unsigned char readByte(unsigned addr) override {
+			return mem_[addr & 0xffff];
+		}
+
+		void writeByte(unsigned addr, unsigned char value) override {
+			mem_[addr & 0xffff] = value;
+		}
+
+		unsigned char* at_mem() { return mem_; }
+	};
+
+
+	// 合成プログラム：256 バイトのブロックを、加工しながら転送し、@n
+	// 転送毎にサブルーチンを呼ぶ。ブロック毎にカウンター（9000）を増やす。
+	void make_program_(unsigned char* mem) noexcept
+	{
+		static const unsigned char prg[] = {
+			0x31, 0x00, 0xF0,	// 0000: LXI  SP,F000
+			0x21, 0x00, 0x40,	// 0003: LXI  H,4000
+			0x11, 0x00, 0x80,	// 0006: LXI  D,8000
+			0x06, 0x00,			// 0009: MVI  B,0
+			0x7E,				// 000B: MOV  A,M
+			0x80,				// 000C: ADD  B
+			0x12,				// 000D: STAX D
+			0x23,				// 000E: INX  H
+			0x13,				// 000F: INX  D
+			0xCD, 0x20, 0x00,	// 0010: CALL 0020
+			0x05,				// 0013: DCR  B
+			0xC2, 0x0B, 0x00,	// 0014: JNZ  000B
+			0x2A, 0x00, 0x90,	// 0017: LHLD 9000
+			0x23,				// 001A: INX  H
+			0x22, 0x00, 0x90,	// 001B: SHLD 9000
+			0xC3, 0x03, 0x00,	// 001E: JMP  0003（0020 の手前で折り返す）
+		};
+		static const unsigned char sub[] = {
+			0xC5,				// 0020: PUSH B
+			0x4F,				// 0021: MOV  C,A
+			0x07,				// 0022: RLC
+			0xA9,				// 0023: XRA  C
+			0x4F,				// 0024: MOV  C,A
+			0xC1,				// 0025: POP  B
+			0xC9,				// 0026: RET
+		};
+		memcpy(mem, prg, sizeof(prg));
+		memcpy(mem + 0x20, sub, sizeof(sub));
+		unsigned x = 2463534242u;
+		for(unsigned i = 0; i < 256; ++i) {
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			mem[0x4000 + i] = x;
+		}
+	}
+
+
+	double get_sec_(std::chrono::steady_clock::time_point t0) noexcept
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	合成プログラムを実行
+		@param[in]	cpu		CPU
+		@param[in]	cycles	実行するサイクル数（目安）
+		@param[in]	thread	run を使う場合「true」
+		@return 時間（秒）
+	*/
+	//-----------------------------------------------------------------//
+	double exec_(I8080& cpu, unsigned cycles, bool thread) noexcept
+	{
+		auto t0 = std::chrono::steady_clock::now();
+		if(thread) {
+			cpu.run(cycles);
+		} else {
+			while(cpu.getCycles() < cycles) cpu.step();
+		}
+		return get_sec_(t0);
+	}
+
+
+	bool same_(const I8080& a, ram_env& ea, const I8080& b, ram_env& eb) noexcept
+	{
+		return a.AF() == b.AF() && a.BC() == b.BC() && a.DE() == b.DE() && a.HL() == b.HL()
+			&& a.PC == b.PC && a.SP == b.SP && a.getCycles() == b.getCycles()
+			&& memcmp(ea.at_mem(), eb.at_mem(), 0x10000) == 0;
+	}
+
+
+	void report_(const char* name, unsigned cycles, double sec) noexcept
+	{
+		double mhz = cycles / sec / 1e6;
+		printf("%-24s %6.1f ms, %7.1f MHz (x%.1f of 2MHz)\n", name, sec * 1000.0, mhz,
+			mhz * 1e6 / CPU_CLOCK);
+	}
+
+
+	bool load_rom_(const std::string& dir, char* rom) noexcept
+	{
+		static const char* name[] = { "invaders.h", "invaders.g", "invaders.f", "invaders.e" };
+		for(int i = 0; i < 4; ++i) {
+			auto path = dir + "/" + name[i];
+			FILE* fp = fopen(path.c_str(), "rb");
+			if(fp == nullptr) {
+				printf("Can't open ROM: '%s'\n", path.c_str());
+				return false;
+			}
+			bool ok = fread(rom + i * 0x800, 1, 0x800, fp) == 0x800;
+			fclose(fp);
+			if(!ok) return false;
+		}
+		return true;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	unsigned frames = 600;
+	const char* rom_dir = nullptr;
+	for(int i = 1; i < argc; ++i) {
+		if(strcmp(argv[i], "-f") == 0 && (i + 1) < argc) {
+			frames = strtoul(argv[++i], nullptr, 10);
+		} else {
+			rom_dir = argv[i];
+		}
+	}
+
+	if(rom_dir != nullptr) {
+		static char rom[0x2000];
+		if(!load_rom_(rom_dir, rom)) return 1;
+		static InvadersMachine machine;
+		machine.setROM(rom);
+		machine.reset();
+		auto t0 = std::chrono::steady_clock::now();
+		for(unsigned i = 0; i < frames; ++i) {
+			machine.step();
+		}
+		auto sec = get_sec_(t0);
+		unsigned cycles = frames * (CPU_CLOCK / machine.getFrameRate());
+		printf("ROM: '%s'\n", rom_dir);
+		printf("Frames: %u, %.1f fps (x%.2f real time)\n", frames, frames / sec,
+			frames / sec / machine.getFrameRate());
+		report_("InvadersMachine (run)", cycles, sec);
+		return 0;
+	}
+
+	// 合成プログラム（フレーム数分のサイクル）
+	unsigned cycles = frames * (CPU_CLOCK / 60);
+	static ram_env env_v(false);
+	static ram_env env_s(true);
+	static ram_env env_r(true);
+	make_program_(env_v.at_mem());
+	make_program_(env_s.at_mem());
+	make_program_(env_r.at_mem());
+	I8080 cpu_v(env_v);
+	I8080 cpu_s(env_s);
+	I8080 cpu_r(env_r);
+	cpu_v.reset();
+	cpu_s.reset();
+	cpu_r.reset();
+
+	// run はブロックの終わりで止まるので、その命令の境界まで step で進める
+	auto sec_r = exec_(cpu_r, cycles, true);
+	auto sec_v = exec_(cpu_v, cpu_r.getCycles(), false);
+	auto sec_s = exec_(cpu_s, cpu_r.getCycles(), false);
+
+	const auto* m = env_r.at_mem();
+	unsigned blocks = m[0x9000] | (m[0x9001] << 8);
+	printf("Cycles: %u (%u frames at 2MHz/60), blocks %u\n", cpu_r.getCycles(), frames, blocks);
+	report_("virtual, step", cpu_v.getCycles(), sec_v);
+	report_("page map, step", cpu_s.getCycles(), sec_s);
+	report_("page map, run", cpu_r.getCycles(), sec_r);
+
+	bool ok = same_(cpu_r, env_r, cpu_v, env_v) && same_(cpu_r, env_r, cpu_s, env_s)
+		&& cpu_r.getCycles() >= cycles && blocks > 0;
+	printf("side_host: %s\n", ok ? "OK" : "NG");
+	return ok ? 0 : 1;
+}
@@ -348,15 +348,12 @@ int main(int argc, char** argv)
 		if(inv_ok_) {
 			spinv_.service(LCD_ORG, GLCDC_MGR::width, GLCDC_MGR::height);
 
+			// FIFO に直接ミックス（空きが出来るまで待つ）
 			SPINV::SND_MGR& snd = spinv_.at_sound();
 			uint32_t len = snd.get_length();
-			const int16_t* wav = snd.get_buffer();
-			for(uint32_t i = 0; i < len; ++i) {
-				while((sound_out_.at_fifo().size() - sound_out_.at_fifo().length()) < 8) {
-				}
-				sound::wave_t t;
-				t.l_ch = t.r_ch = *wav++;
-				sound_out_.at_fifo().put(t);
+			uint32_t pos = 0;
+			while(pos < len) {
+				pos += snd.render(sound_out_.at_fifo(), len - pos);
 			}
 		}
 
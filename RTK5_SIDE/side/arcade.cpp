@@ -22,6 +22,12 @@
 InvadersMachine::InvadersMachine()
 {
     cpu_ = new I8080( *this );
+
+    // ROM and work RAM are plain memory: let the CPU access them directly.
+    // Writes to the ROM and to video memory still go through writeByte().
+    mapRead( 0x0000, sizeof(ram_), ram_ );
+    mapWrite( 0x2000, 0x0400, ram_ + 0x2000 );
+
     reset();
     memset( ram_, 0, 0x2000 );  // Clear the ROM area
     setFrameRate( 60 );
@@ -144,8 +150,7 @@ void InvadersMachine::step()
     // Before a frame is fully rendered, two interrupts have to occur
     for( int i=0; i<2; i++ ) {
         // Go on until an interrupt occurs
-        while( cpu_->getCycles() < cycles_per_interrupt_ )
-            cpu_->step();
+        cpu_->run( cycles_per_interrupt_ );
 
         // Adjust the cycles count
         cpu_->setCycles( cpu_->getCycles() - cycles_per_interrupt_ );
@@ -69,7 +69,7 @@ void I8080::reset()
 
 void I8080::step()
 {
-    unsigned op = env_.readByte( PC++ );
+    unsigned op = env_.fetchByte( PC++ );
 
     // Execute
     cycles_ += Opcode_[ op ].cycles;
@@ -79,6 +79,491 @@ void I8080::step()
     PC &= 0xFFFF;
 }
 
+#if defined(__GNUC__)
+
+/*
+    Threaded dispatch: each handler jumps directly to the next one through a table of
+    label addresses (GCC "labels as values"). Straight-line instructions do not check
+    the cycle budget, which is only tested at the end of a basic block.
+*/
+#define I8080_NEXT      PC &= 0xFFFF; op = env_.fetchByte( PC++ ); cycles_ += Opcode_[ op ].cycles; goto *Dispatch[ op ]
+#define I8080_BLOCK     if( cycles_ >= cycles ) goto done; I8080_NEXT
+
+void I8080::run( unsigned cycles )
+{
+    static const void * const Dispatch[256] = {
+        &&op_00, &&op_01, &&op_02, &&op_03,
+        &&generic, &&generic, &&op_06, &&generic,
+        &&generic, &&generic, &&op_0a, &&generic,
+        &&generic, &&generic, &&op_0e, &&generic,
+        &&generic, &&op_11, &&op_12, &&op_13,
+        &&generic, &&generic, &&op_16, &&generic,
+        &&generic, &&generic, &&op_1a, &&generic,
+        &&generic, &&generic, &&op_1e, &&generic,
+        &&generic, &&op_21, &&generic, &&op_23,
+        &&generic, &&generic, &&op_26, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&op_2e, &&generic,
+        &&generic, &&op_31, &&op_32, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&op_3a, &&generic,
+        &&generic, &&generic, &&op_3e, &&generic,
+        &&op_40, &&op_41, &&op_42, &&op_43,
+        &&op_44, &&op_45, &&op_46, &&op_47,
+        &&op_48, &&op_49, &&op_4a, &&op_4b,
+        &&op_4c, &&op_4d, &&op_4e, &&op_4f,
+        &&op_50, &&op_51, &&op_52, &&op_53,
+        &&op_54, &&op_55, &&op_56, &&op_57,
+        &&op_58, &&op_59, &&op_5a, &&op_5b,
+        &&op_5c, &&op_5d, &&op_5e, &&op_5f,
+        &&op_60, &&op_61, &&op_62, &&op_63,
+        &&op_64, &&op_65, &&op_66, &&op_67,
+        &&op_68, &&op_69, &&op_6a, &&op_6b,
+        &&op_6c, &&op_6d, &&op_6e, &&op_6f,
+        &&op_70, &&op_71, &&op_72, &&op_73,
+        &&op_74, &&op_75, &&generic, &&op_77,
+        &&op_78, &&op_79, &&op_7a, &&op_7b,
+        &&op_7c, &&op_7d, &&op_7e, &&op_7f,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&op_c2, &&op_c3,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&op_c9, &&op_ca, &&generic,
+        &&generic, &&op_cd, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&op_eb,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic,
+        &&generic, &&generic, &&generic, &&generic
+    };
+
+    unsigned op;
+
+    if( cycles_ >= cycles ) return;
+    I8080_NEXT;
+
+generic:
+    if( Opcode_[ op ].handler )
+        (this->*(Opcode_[ op ].handler))();
+    I8080_BLOCK;
+
+op_00:
+    I8080_BLOCK;
+
+op_01:
+    C = env_.fetchByte( PC++ );
+    B = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_02:
+    env_.storeByte( BC(), A );
+    I8080_NEXT;
+
+op_03:
+    if( ++C == 0 ) ++B;
+    I8080_NEXT;
+
+op_06:
+    B = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_0a:
+    A = env_.fetchByte( BC() );
+    I8080_NEXT;
+
+op_0e:
+    C = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_11:
+    E = env_.fetchByte( PC++ );
+    D = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_12:
+    env_.storeByte( DE(), A );
+    I8080_NEXT;
+
+op_13:
+    if( ++E == 0 ) ++D;
+    I8080_NEXT;
+
+op_16:
+    D = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_1a:
+    A = env_.fetchByte( DE() );
+    I8080_NEXT;
+
+op_1e:
+    E = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_21:
+    L = env_.fetchByte( PC++ );
+    H = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_23:
+    if( ++L == 0 ) ++H;
+    I8080_NEXT;
+
+op_26:
+    H = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_2e:
+    L = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_31:
+    SP = env_.fetchWord( PC );
+    PC += 2;
+    I8080_NEXT;
+
+op_32:
+    env_.storeByte( nextWord(), A );
+    I8080_NEXT;
+
+op_3a:
+    A = env_.fetchByte( nextWord() );
+    I8080_NEXT;
+
+op_3e:
+    A = env_.fetchByte( PC++ );
+    I8080_NEXT;
+
+op_40:
+    I8080_NEXT;
+
+op_41:
+    B = C;
+    I8080_NEXT;
+
+op_42:
+    B = D;
+    I8080_NEXT;
+
+op_43:
+    B = E;
+    I8080_NEXT;
+
+op_44:
+    B = H;
+    I8080_NEXT;
+
+op_45:
+    B = L;
+    I8080_NEXT;
+
+op_46:
+    B = env_.fetchByte( HL() );
+    I8080_NEXT;
+
+op_47:
+    B = A;
+    I8080_NEXT;
+
+op_48:
+    C = B;
+    I8080_NEXT;
+
+op_49:
+    I8080_NEXT;
+
+op_4a:
+    C = D;
+    I8080_NEXT;
+
+op_4b:
+    C = E;
+    I8080_NEXT;
+
+op_4c:
+    C = H;
+    I8080_NEXT;
+
+op_4d:
+    C = L;
+    I8080_NEXT;
+
+op_4e:
+    C = env_.fetchByte( HL() );
+    I8080_NEXT;
+
+op_4f:
+    C = A;
+    I8080_NEXT;
+
+op_50:
+    D = B;
+    I8080_NEXT;
+
+op_51:
+    D = C;
+    I8080_NEXT;
+
+op_52:
+    I8080_NEXT;
+
+op_53:
+    D = E;
+    I8080_NEXT;
+
+op_54:
+    D = H;
+    I8080_NEXT;
+
+op_55:
+    D = L;
+    I8080_NEXT;
+
+op_56:
+    D = env_.fetchByte( HL() );
+    I8080_NEXT;
+
+op_57:
+    D = A;
+    I8080_NEXT;
+
+op_58:
+    E = B;
+    I8080_NEXT;
+
+op_59:
+    E = C;
+    I8080_NEXT;
+
+op_5a:
+    E = D;
+    I8080_NEXT;
+
+op_5b:
+    I8080_NEXT;
+
+op_5c:
+    E = H;
+    I8080_NEXT;
+
+op_5d:
+    E = L;
+    I8080_NEXT;
+
+op_5e:
+    E = env_.fetchByte( HL() );
+    I8080_NEXT;
+
+op_5f:
+    E = A;
+    I8080_NEXT;
+
+op_60:
+    H = B;
+    I8080_NEXT;
+
+op_61:
+    H = C;
+    I8080_NEXT;
+
+op_62:
+    H = D;
+    I8080_NEXT;
+
+op_63:
+    H = E;
+    I8080_NEXT;
+
+op_64:
+    I8080_NEXT;
+
+op_65:
+    H = L;
+    I8080_NEXT;
+
+op_66:
+    H = env_.fetchByte( HL() );
+    I8080_NEXT;
+
+op_67:
+    H = A;
+    I8080_NEXT;
+
+op_68:
+    L = B;
+    I8080_NEXT;
+
+op_69:
+    L = C;
+    I8080_NEXT;
+
+op_6a:
+    L = D;
+    I8080_NEXT;
+
+op_6b:
+    L = E;
+    I8080_NEXT;
+
+op_6c:
+    L = H;
+    I8080_NEXT;
+
+op_6d:
+    I8080_NEXT;
+
+op_6e:
+    L = env_.fetchByte( HL() );
+    I8080_NEXT;
+
+op_6f:
+    L = A;
+    I8080_NEXT;
+
+op_70:
+    env_.storeByte( HL(), B );
+    I8080_NEXT;
+
+op_71:
+    env_.storeByte( HL(), C );
+    I8080_NEXT;
+
+op_72:
+    env_.storeByte( HL(), D );
+    I8080_NEXT;
+
+op_73:
+    env_.storeByte( HL(), E );
+    I8080_NEXT;
+
+op_74:
+    env_.storeByte( HL(), H );
+    I8080_NEXT;
+
+op_75:
+    env_.storeByte( HL(), L );
+    I8080_NEXT;
+
+op_77:
+    env_.storeByte( HL(), A );
+    I8080_NEXT;
+
+op_78:
+    A = B;
+    I8080_NEXT;
+
+op_79:
+    A = C;
+    I8080_NEXT;
+
+op_7a:
+    A = D;
+    I8080_NEXT;
+
+op_7b:
+    A = E;
+    I8080_NEXT;
+
+op_7c:
+    A = H;
+    I8080_NEXT;
+
+op_7d:
+    A = L;
+    I8080_NEXT;
+
+op_7e:
+    A = env_.fetchByte( HL() );
+    I8080_NEXT;
+
+op_7f:
+    I8080_NEXT;
+
+op_c2:
+    {
+        unsigned pc = nextWord();
+        if( ! (F & Zero) ) {
+            PC = pc;
+            cycles_ += 5;
+        }
+    }
+    I8080_BLOCK;
+
+op_c3:
+    PC = env_.fetchWord( PC );
+    I8080_BLOCK;
+
+op_c9:
+    retFromSub();
+    I8080_BLOCK;
+
+op_ca:
+    {
+        unsigned pc = nextWord();
+        if( F & Zero ) {
+            PC = pc;
+            cycles_ += 5;
+        }
+    }
+    I8080_BLOCK;
+
+op_cd:
+    callSub( nextWord() );
+    I8080_BLOCK;
+
+op_eb:
+    {
+        unsigned char x;
+        x = D; D = H; H = x;
+        x = E; E = L; L = x;
+    }
+    I8080_NEXT;
+
+done:
+    PC &= 0xFFFF;
+}
+
+#undef I8080_BLOCK
+#undef I8080_NEXT
+
+#else
+
+void I8080::run( unsigned cycles )
+{
+    while( cycles_ < cycles ) {
+        unsigned op = env_.fetchByte( PC++ );
+
+        cycles_ += Opcode_[ op ].cycles;
+        if( Opcode_[ op ].handler )
+            (this->*(Opcode_[ op ].handler))();
+
+        PC &= 0xFFFF;
+    }
+}
+
+#endif
+
 void I8080::interrupt( unsigned address )
 {
     if( F & Interrupt ) {
@@ -86,8 +571,8 @@ void I8080::interrupt( unsigned address )
             PC++;
             halted_ = 0;
         }
-        env_.writeByte( --SP, (PC >> 8) & 0xFF );
-        env_.writeByte( --SP, PC & 0xFF );
+        env_.storeByte( --SP, (PC >> 8) & 0xFF );
+        env_.storeByte( --SP, PC & 0xFF );
         PC = address & 0xFFFF;
     }
 }
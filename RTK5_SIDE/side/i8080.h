@@ -30,11 +30,23 @@
     ports: users of the I8080 emulator should provide the desired behaviour by writing a
     descendant of this class that overrides the required functions.
 
+    Plain memory can also be mapped in 256 byte pages with <i>mapRead()</i> and
+    <i>mapWrite()</i>: the CPU then accesses those pages directly, and only unmapped
+    pages (memory mapped I/O, video memory with side effects...) go through the
+    virtual functions.
+
     @author Alessandro Scotti
 */
 class I8080Environment
 {
 public:
+    /** Page table definitions. */
+    enum PageConstants {
+        PageShift   = 8,
+        PageSize    = 1 << PageShift,
+        PageCount   = 0x10000 >> PageShift
+    };
+
     /** 
         Constructor. 
 
@@ -42,6 +54,10 @@ public:
         ports.
     */
     I8080Environment() {
+        for( unsigned i=0; i<PageCount; i++ ) {
+            readPage_[i] = 0;
+            writePage_[i] = 0;
+        }
     }
 
     /** Destructor. */
@@ -145,6 +161,83 @@ public:
     */
     virtual void writePort( unsigned port, unsigned char value ) {
     }
+
+    /**
+        Maps plain memory for direct reads.
+
+        @param  addr    start address (multiple of PageSize)
+        @param  size    size of the area (multiple of PageSize)
+        @param  mem     memory backing the area, or 0 to unmap it
+    */
+    void mapRead( unsigned addr, unsigned size, const unsigned char * mem ) {
+        for( unsigned ofs=0; ofs<size; ofs+=PageSize ) {
+            readPage_[(addr + ofs) >> PageShift] = mem ? mem + ofs : 0;
+        }
+    }
+
+    /**
+        Maps plain memory for direct writes.
+
+        @param  addr    start address (multiple of PageSize)
+        @param  size    size of the area (multiple of PageSize)
+        @param  mem     memory backing the area, or 0 to unmap it
+    */
+    void mapWrite( unsigned addr, unsigned size, unsigned char * mem ) {
+        for( unsigned ofs=0; ofs<size; ofs+=PageSize ) {
+            writePage_[(addr + ofs) >> PageShift] = mem ? mem + ofs : 0;
+        }
+    }
+
+    /** Reads one byte, directly from a mapped page if possible. */
+    unsigned char fetchByte( unsigned addr ) {
+        if( addr < 0x10000 ) {
+            const unsigned char * p = readPage_[addr >> PageShift];
+            if( p ) return p[addr & (PageSize - 1)];
+        }
+        return readByte( addr );
+    }
+
+    /** Reads a 16 bit word, directly from a mapped page if possible. */
+    unsigned fetchWord( unsigned addr ) {
+        if( addr < 0x10000 && (addr & (PageSize - 1)) != (PageSize - 1) ) {
+            const unsigned char * p = readPage_[addr >> PageShift];
+            if( p ) {
+                p += addr & (PageSize - 1);
+                return p[0] | ((unsigned)p[1] << 8);
+            }
+        }
+        return readWord( addr );
+    }
+
+    /** Writes one byte, directly to a mapped page if possible. */
+    void storeByte( unsigned addr, unsigned char value ) {
+        if( addr < 0x10000 ) {
+            unsigned char * p = writePage_[addr >> PageShift];
+            if( p ) {
+                p[addr & (PageSize - 1)] = value;
+                return;
+            }
+        }
+        writeByte( addr, value );
+    }
+
+    /** Writes a 16 bit word, directly to a mapped page if possible. */
+    void storeWord( unsigned addr, unsigned value ) {
+        if( addr < 0x10000 && (addr & (PageSize - 1)) != (PageSize - 1) ) {
+            unsigned char * p = writePage_[addr >> PageShift];
+            if( p ) {
+                p += addr & (PageSize - 1);
+                p[0] = value & 0xFF;
+                p[1] = (value >> 8) & 0xFF;
+                return;
+            }
+        }
+        writeWord( addr, value );
+    }
+
+private:
+    const unsigned char *   readPage_[PageCount];
+    unsigned char *         writePage_[PageCount];
 };
 
 /**
@@ -213,6 +306,18 @@ public:
     /** Executes one CPU instruction. */
     virtual void step();
 
+    /**
+        Executes instructions until the cycle counter reaches the specified value.
+
+        Frequently used instructions are executed inline by a threaded dispatch loop,
+        and the cycle counter is only checked at the end of each basic block (jumps,
+        calls, returns and the less common instructions), so the counter may slightly
+        exceed <i>cycles</i> on return.
+
+        @param  cycles  cycle count to reach
+    */
+    void run( unsigned cycles );
+
     /** 
         Informs the CPU that an interrupt has occurred.
 
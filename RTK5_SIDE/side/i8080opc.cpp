@@ -284,13 +284,13 @@ void I8080::opcode_00()    // NOP
 
 void I8080::opcode_01()    // LD   BC,nn
 {
-    C = env_.readByte( PC++ );
-    B = env_.readByte( PC++ );
+    C = env_.fetchByte( PC++ );
+    B = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_02()    // LD   (BC),A
 {
-    env_.writeByte( BC(), A );
+    env_.storeByte( BC(), A );
 }
 
 void I8080::opcode_03()    // INC  BC
@@ -310,7 +310,7 @@ void I8080::opcode_05()    // DEC  B
 
 void I8080::opcode_06()    // LD   B,n
 {
-    B = env_.readByte( PC++ );
+    B = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_07()    // RLCA
@@ -336,7 +336,7 @@ void I8080::opcode_09()    // ADD  HL,BC
 
 void I8080::opcode_0a()    // LD   A,(BC)
 {
-    A = env_.readByte( BC() );
+    A = env_.fetchByte( BC() );
 }
 
 void I8080::opcode_0b()    // DEC  BC
@@ -356,7 +356,7 @@ void I8080::opcode_0d()    // DEC  C
 
 void I8080::opcode_0e()    // LD   C,n
 {
-    C = env_.readByte( PC++ );
+    C = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_0f()    // RRCA
@@ -368,13 +368,13 @@ void I8080::opcode_0f()    // RRCA
 
 void I8080::opcode_11()    // LD   DE,nn
 {
-    E = env_.readByte( PC++ );
-    D = env_.readByte( PC++ );
+    E = env_.fetchByte( PC++ );
+    D = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_12()    // LD   (DE),A
 {
-    env_.writeByte( DE(), A );
+    env_.storeByte( DE(), A );
 }
 
 void I8080::opcode_13()    // INC  DE
@@ -394,7 +394,7 @@ void I8080::opcode_15()    // DEC  D
 
 void I8080::opcode_16()    // LD   D,n
 {
-    D = env_.readByte( PC++ );
+    D = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_17()    // RLA
@@ -423,7 +423,7 @@ void I8080::opcode_19()    // ADD  HL,DE
 
 void I8080::opcode_1a()    // LD   A,(DE)
 {
-    A = env_.readByte( DE() );
+    A = env_.fetchByte( DE() );
 }
 
 void I8080::opcode_1b()    // DEC  DE
@@ -443,7 +443,7 @@ void I8080::opcode_1d()    // DEC  E
 
 void I8080::opcode_1e()    // LD   E,n
 {
-    E = env_.readByte( PC++ );
+    E = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_1f()    // RRA
@@ -458,16 +458,16 @@ void I8080::opcode_1f()    // RRA
 
 void I8080::opcode_21()    // LD   HL,nn
 {
-    L = env_.readByte( PC++ );
-    H = env_.readByte( PC++ );
+    L = env_.fetchByte( PC++ );
+    H = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_22()    // LD   (nn),HL
 {
     unsigned x = nextWord();
 
-    env_.writeByte( x  , L );
-    env_.writeByte( x+1, H );
+    env_.storeByte( x  , L );
+    env_.storeByte( x+1, H );
 }
 
 void I8080::opcode_23()    // INC  HL
@@ -487,7 +487,7 @@ void I8080::opcode_25()    // DEC  H
 
 void I8080::opcode_26()    // LD   H,n
 {
-    H = env_.readByte( PC++ );
+    H = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_27()    // DAA
@@ -529,8 +529,8 @@ void I8080::opcode_2a()    // LD   HL,(nn)
 {
     unsigned x = nextWord();
 
-    L = env_.readByte( x );
-    H = env_.readByte( x+1 );
+    L = env_.fetchByte( x );
+    H = env_.fetchByte( x+1 );
 }
 
 void I8080::opcode_2b()    // DEC  HL
@@ -550,7 +550,7 @@ void I8080::opcode_2d()    // DEC  L
 
 void I8080::opcode_2e()    // LD   L,n
 {
-    L = env_.readByte( PC++ );
+    L = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_2f()    // CPL
@@ -566,7 +566,7 @@ void I8080::opcode_31()    // LD   SP,nn
 
 void I8080::opcode_32()    // LD   (nn),A
 {
-    env_.writeByte( nextWord(), A );
+    env_.storeByte( nextWord(), A );
 }
 
 void I8080::opcode_33()    // INC  SP
@@ -576,17 +576,17 @@ void I8080::opcode_33()    // INC  SP
 
 void I8080::opcode_34()    // INC  (HL)
 {
-    env_.writeByte( HL(), incByte( env_.readByte( HL() ) ) );
+    env_.storeByte( HL(), incByte( env_.fetchByte( HL() ) ) );
 }
 
 void I8080::opcode_35()    // DEC  (HL)
 {
-    env_.writeByte( HL(), decByte( env_.readByte( HL() ) ) );
+    env_.storeByte( HL(), decByte( env_.fetchByte( HL() ) ) );
 }
 
 void I8080::opcode_36()    // LD   (HL),n
 {
-    env_.writeByte( HL(), env_.readByte( PC++ ) );
+    env_.storeByte( HL(), env_.fetchByte( PC++ ) );
 }
 
 void I8080::opcode_37()    // SCF
@@ -610,7 +610,7 @@ void I8080::opcode_39()    // ADD  HL,SP
 
 void I8080::opcode_3a()    // LD   A,(nn)
 {
-    A = env_.readByte( nextWord() );
+    A = env_.fetchByte( nextWord() );
 }
 
 void I8080::opcode_3b()    // DEC  SP
@@ -630,7 +630,7 @@ void I8080::opcode_3d()    // DEC  A
 
 void I8080::opcode_3e()    // LD   A,n
 {
-    A = env_.readByte( PC++ );
+    A = env_.fetchByte( PC++ );
 }
 
 void I8080::opcode_3f()    // CCF
@@ -669,7 +669,7 @@ void I8080::opcode_45()    // LD   B,L
 
 void I8080::opcode_46()    // LD   B,(HL)
 {
-    B = env_.readByte( HL() );
+    B = env_.fetchByte( HL() );
 }
 
 void I8080::opcode_47()    // LD   B,A
@@ -708,7 +708,7 @@ void I8080::opcode_4d()    // LD   C,L
 
 void I8080::opcode_4e()    // LD   C,(HL)
 {
-    C = env_.readByte( HL() );
+    C = env_.fetchByte( HL() );
 }
 
 void I8080::opcode_4f()    // LD   C,A
@@ -747,7 +747,7 @@ void I8080::opcode_55()    // LD   D,L
 
 void I8080::opcode_56()    // LD   D,(HL)
 {
-    D = env_.readByte( HL() );
+    D = env_.fetchByte( HL() );
 }
 
 void I8080::opcode_57()    // LD   D,A
@@ -786,7 +786,7 @@ void I8080::opcode_5d()    // LD   E,L
 
 void I8080::opcode_5e()    // LD   E,(HL)
 {
-    E = env_.readByte( HL() );
+    E = env_.fetchByte( HL() );
 }
 
 void I8080::opcode_5f()    // LD   E,A
@@ -825,7 +825,7 @@ void I8080::opcode_65()    // LD   H,L
 
 void I8080::opcode_66()    // LD   H,(HL)
 {
-    H = env_.readByte( HL() );
+    H = env_.fetchByte( HL() );
 }
 
 void I8080::opcode_67()    // LD   H,A
@@ -864,7 +864,7 @@ void I8080::opcode_6d()    // LD   L,L
 
 void I8080::opcode_6e()    // LD   L,(HL)
 {
-    L = env_.readByte( HL() );
+    L = env_.fetchByte( HL() );
 }
 
 void I8080::opcode_6f()    // LD   L,A
@@ -874,32 +874,32 @@ void I8080::opcode_6f()    // LD   L,A
 
 void I8080::opcode_70()    // LD   (HL),B
 {
-    env_.writeByte( HL(), B );
+    env_.storeByte( HL(), B );
 }
 
 void I8080::opcode_71()    // LD   (HL),C
 {
-    env_.writeByte( HL(), C );
+    env_.storeByte( HL(), C );
 }
 
 void I8080::opcode_72()    // LD   (HL),D
 {
-    env_.writeByte( HL(), D );
+    env_.storeByte( HL(), D );
 }
 
 void I8080::opcode_73()    // LD   (HL),E
 {
-    env_.writeByte( HL(), E );
+    env_.storeByte( HL(), E );
 }
 
 void I8080::opcode_74()    // LD   (HL),H
 {
-    env_.writeByte( HL(), H );
+    env_.storeByte( HL(), H );
 }
 
 void I8080::opcode_75()    // LD   (HL),L
 {
-    env_.writeByte( HL(), L );
+    env_.storeByte( HL(), L );
 }
 
 void I8080::opcode_76()    // HALT
@@ -910,7 +910,7 @@ void I8080::opcode_76()    // HALT
 
 void I8080::opcode_77()    // LD   (HL),A
 {
-    env_.writeByte( HL(), A );
+    env_.storeByte( HL(), A );
 }
 
 void I8080::opcode_78()    // LD   A,B
@@ -945,7 +945,7 @@ void I8080::opcode_7d()    // LD   A,L
 
 void I8080::opcode_7e()    // LD   A,(HL)
 {
-    A = env_.readByte( HL() );
+    A = env_.fetchByte( HL() );
 }
 
 void I8080::opcode_7f()    // LD   A,A
@@ -984,7 +984,7 @@ void I8080::opcode_85()    // ADD  A,L
 
 void I8080::opcode_86()    // ADD  A,(HL)
 {
-    addByte( env_.readByte( HL() ), 0 );
+    addByte( env_.fetchByte( HL() ), 0 );
 }
 
 void I8080::opcode_87()    // ADD  A,A
@@ -1024,7 +1024,7 @@ void I8080::opcode_8d()    // ADC  A,L
 
 void I8080::opcode_8e()    // ADC  A,(HL)
 {
-    addByte( env_.readByte( HL() ), F & Carry );
+    addByte( env_.fetchByte( HL() ), F & Carry );
 }
 
 void I8080::opcode_8f()    // ADC  A,A
@@ -1064,7 +1064,7 @@ void I8080::opcode_95()    // SUB  L
 
 void I8080::opcode_96()    // SUB  (HL)
 {
-    A = subByte( env_.readByte( HL() ), 0 );
+    A = subByte( env_.fetchByte( HL() ), 0 );
 }
 
 void I8080::opcode_97()    // SUB  A
@@ -1104,7 +1104,7 @@ void I8080::opcode_9d()    // SBC  A,L
 
 void I8080::opcode_9e()    // SBC  A,(HL)
 {
-    A = subByte( env_.readByte( HL() ), F & Carry );
+    A = subByte( env_.fetchByte( HL() ), F & Carry );
 }
 
 void I8080::opcode_9f()    // SBC  A,A
@@ -1150,7 +1150,7 @@ void I8080::opcode_a5()    // AND  L
 
 void I8080::opcode_a6()    // AND  (HL)
 {
-    A &= env_.readByte( HL() );
+    A &= env_.fetchByte( HL() );
     clearAndSetFlagsPSZ();
 }
 
@@ -1197,7 +1197,7 @@ void I8080::opcode_ad()    // XOR  L
 
 void I8080::opcode_ae()    // XOR  (HL)
 {
-    A ^= env_.readByte( HL() );
+    A ^= env_.fetchByte( HL() );
     clearAndSetFlagsPSZ();
 }
 
@@ -1245,7 +1245,7 @@ void I8080::opcode_b5()    // OR   L
 
 void I8080::opcode_b6()    // OR   (HL)
 {
-    A |= env_.readByte( HL() );
+    A |= env_.fetchByte( HL() );
     clearAndSetFlagsPSZ();
 }
 
@@ -1286,7 +1286,7 @@ void I8080::opcode_bd()    // CP   L
 
 void I8080::opcode_be()    // CP   (HL)
 {
-    subByte( env_.readByte( HL() ), 0 );
+    subByte( env_.fetchByte( HL() ), 0 );
 }
 
 void I8080::opcode_bf()    // CP   A
@@ -1304,8 +1304,8 @@ void I8080::opcode_c0()    // RET  NZ
 
 void I8080::opcode_c1()    // POP  BC
 {
-    C = env_.readByte( SP++ );
-    B = env_.readByte( SP++ );
+    C = env_.fetchByte( SP++ );
+    B = env_.fetchByte( SP++ );
 }
 
 void I8080::opcode_c2()    // JP   NZ,nn
@@ -1320,7 +1320,7 @@ void I8080::opcode_c2()    // JP   NZ,nn
 
 void I8080::opcode_c3()    // JP   nn
 {
-     PC = env_.readWord( PC );
+     PC = env_.fetchWord( PC );
 }
 
 void I8080::opcode_c4()    // CALL NZ,nn
@@ -1335,13 +1335,13 @@ void I8080::opcode_c4()    // CALL NZ,nn
 
 void I8080::opcode_c5()    // PUSH BC
 {
-    env_.writeByte( --SP, B );
-    env_.writeByte( --SP, C );
+    env_.storeByte( --SP, B );
+    env_.storeByte( --SP, C );
 }
 
 void I8080::opcode_c6()    // ADD  A,n
 {
-    addByte( env_.readByte( PC++ ), 0 );
+    addByte( env_.fetchByte( PC++ ), 0 );
 }
 
 void I8080::opcode_c7()    // RST  0
@@ -1389,7 +1389,7 @@ void I8080::opcode_cd()    // CALL nn
 
 void I8080::opcode_ce()    // ADC  A,n
 {
-    addByte( env_.readByte( PC++ ), F & Carry );
+    addByte( env_.fetchByte( PC++ ), F & Carry );
 }
 
 void I8080::opcode_cf()    // RST  8
@@ -1407,8 +1407,8 @@ void I8080::opcode_d0()    // RET  NC
 
 void I8080::opcode_d1()    // POP  DE
 {
-    E = env_.readByte( SP++ );
-    D = env_.readByte( SP++ );
+    E = env_.fetchByte( SP++ );
+    D = env_.fetchByte( SP++ );
 }
 
 void I8080::opcode_d2()    // JP   NC,nn
@@ -1423,7 +1423,7 @@ void I8080::opcode_d2()    // JP   NC,nn
 
 void I8080::opcode_d3()    // OUT  (n),A
 {
-    env_.writePort( env_.readByte( PC++ ), A );
+    env_.writePort( env_.fetchByte( PC++ ), A );
 }
 
 void I8080::opcode_d4()    // CALL NC,nn
@@ -1438,13 +1438,13 @@ void I8080::opcode_d4()    // CALL NC,nn
 
 void I8080::opcode_d5()    // PUSH DE
 {
-    env_.writeByte( --SP, D );
-    env_.writeByte( --SP, E );
+    env_.storeByte( --SP, D );
+    env_.storeByte( --SP, E );
 }
 
 void I8080::opcode_d6()    // SUB  n
 {
-    A = subByte( env_.readByte( PC++ ), 0 );
+    A = subByte( env_.fetchByte( PC++ ), 0 );
 }
 
 void I8080::opcode_d7()    // RST  10H
@@ -1472,7 +1472,7 @@ void I8080::opcode_da()    // JP   C,nn
 
 void I8080::opcode_db()    // IN   A,(n)
 {
-    A = env_.readPort( env_.readByte( PC++ ) );
+    A = env_.readPort( env_.fetchByte( PC++ ) );
 }
 
 void I8080::opcode_dc()    // CALL C,nn
@@ -1487,7 +1487,7 @@ void I8080::opcode_dc()    // CALL C,nn
 
 void I8080::opcode_de()    // SBC  A,n
 {
-    A = subByte( env_.readByte( PC++ ), F & Carry );
+    A = subByte( env_.fetchByte( PC++ ), F & Carry );
 }
 
 void I8080::opcode_df()    // RST  18H
@@ -1505,8 +1505,8 @@ void I8080::opcode_e0()    // RET  PO
 
 void I8080::opcode_e1()    // POP  HL
 {
-    L = env_.readByte( SP++ );
-    H = env_.readByte( SP++ );
+    L = env_.fetchByte( SP++ );
+    H = env_.fetchByte( SP++ );
 }
 
 void I8080::opcode_e2()    // JP   PO,nn
@@ -1523,8 +1523,8 @@ void I8080::opcode_e3()    // EX   (SP),HL
 {
     unsigned char   x;
 
-    x = env_.readByte( SP   ); env_.writeByte( SP,   L ); L = x;
-    x = env_.readByte( SP+1 ); env_.writeByte( SP+1, H ); H = x;
+    x = env_.fetchByte( SP   ); env_.storeByte( SP,   L ); L = x;
+    x = env_.fetchByte( SP+1 ); env_.storeByte( SP+1, H ); H = x;
 }
 
 void I8080::opcode_e4()    // CALL PO,nn
@@ -1539,13 +1539,13 @@ void I8080::opcode_e4()    // CALL PO,nn
 
 void I8080::opcode_e5()    // PUSH HL
 {
-    env_.writeByte( --SP, H );
-    env_.writeByte( --SP, L );
+    env_.storeByte( --SP, H );
+    env_.storeByte( --SP, L );
 }
 
 void I8080::opcode_e6()    // AND  n
 {
-    A &= env_.readByte( PC++ );
+    A &= env_.fetchByte( PC++ );
     clearAndSetFlagsPSZ();
 }
 
@@ -1597,7 +1597,7 @@ void I8080::opcode_ec()    // CALL PE,nn
 
 void I8080::opcode_ee()    // XOR  n
 {
-    A ^= env_.readByte( PC++ );
+    A ^= env_.fetchByte( PC++ );
     clearAndSetFlagsPSZ();
 }
 
@@ -1616,8 +1616,8 @@ void I8080::opcode_f0()    // RET  P
 
 void I8080::opcode_f1()    // POP  AF
 {
-    F = env_.readByte( SP++ );
-    A = env_.readByte( SP++ );
+    F = env_.fetchByte( SP++ );
+    A = env_.fetchByte( SP++ );
 }
 
 void I8080::opcode_f2()    // JP   P,nn
@@ -1647,13 +1647,13 @@ void I8080::opcode_f4()    // CALL P,nn
 
 void I8080::opcode_f5()    // PUSH AF
 {
-    env_.writeByte( --SP, A );
-    env_.writeByte( --SP, F );
+    env_.storeByte( --SP, A );
+    env_.storeByte( --SP, F );
 }
 
 void I8080::opcode_f6()    // OR   n
 {
-    A |= env_.readByte( PC++ );
+    A |= env_.fetchByte( PC++ );
     clearAndSetFlagsPSZ();
 }
 
@@ -1704,7 +1704,7 @@ void I8080::opcode_fc()    // CALL M,nn
 
 void I8080::opcode_fe()    // CP   n
 {
-    subByte( env_.readByte( PC++ ), 0 );
+    subByte( env_.fetchByte( PC++ ), 0 );
 }
 
 void I8080::opcode_ff()    // RST  38H
@@ -119,7 +119,7 @@ void I8080::addByte( unsigned char op, unsigned char cf )
 void I8080::callSub( unsigned addr )
 {
     SP -= 2;
-    env_.writeWord( SP, PC );
+    env_.storeWord( SP, PC );
     PC = addr & 0xFFFF;
 }
 
@@ -154,14 +154,14 @@ unsigned char I8080::incByte( unsigned char b )
 
 unsigned I8080::nextWord()
 {
-    unsigned x = env_.readWord( PC );
+    unsigned x = env_.fetchWord( PC );
     PC += 2;
     return x;
 }
 
 void I8080::retFromSub()
 {
-    PC = env_.readWord( SP );
+    PC = env_.fetchWord( SP );
     SP += 2;
 }
 
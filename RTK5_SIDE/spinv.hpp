@@ -244,8 +244,6 @@ namespace emu {
 				}
 			}
 			req_lvl_ = lvl;
-
-			snd_mgr_.update();
 		}
 
 
@@ -33,7 +33,7 @@ namespace device {
 			@brief  D/A データレジスタ 0（DADR0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000880C0> DADR0;
+		static IO_SIM_INLINE rw16_t<0x000880C0> DADR0;
 
 
 		//-----------------------------------------------------------------//
@@ -52,7 +52,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B6> DAOE0;
 		};
-		static dacr_t<0x000880C4> DACR;
+		static IO_SIM_INLINE dacr_t<0x000880C4> DACR;
 
 
 		//-----------------------------------------------------------------//
@@ -71,7 +71,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7> DPSEL;
 		};
-		static dadpr_t<0x000880C5> DADPR;
+		static IO_SIM_INLINE dadpr_t<0x000880C5> DADPR;
 
 
 		//-----------------------------------------------------------------//
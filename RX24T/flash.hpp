@@ -35,7 +35,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> DFLEN;
 		};
-		static dflctl_t<0x007FC090> DFLCTL;
+		static IO_SIM_INLINE dflctl_t<0x007FC090> DFLCTL;
 
 
 		//-----------------------------------------------------------------//
@@ -56,7 +56,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B7>     FENTRYD;
 			bits_rw_t<io_, bitpos::B8, 8>  FEKEY;
 		};
-		static fentryr_t<0x007FFFB2> FENTRYR;
+		static IO_SIM_INLINE fentryr_t<0x007FFFB2> FENTRYR;
 
 
 		//-----------------------------------------------------------------//
@@ -64,7 +64,7 @@ namespace device {
 			@brief  プロテクト解除レジスタ (FPR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x007FC180> FPR;
+		static IO_SIM_INLINE rw8_t<0x007FC180> FPR;
 
 
 		//-----------------------------------------------------------------//
@@ -80,7 +80,7 @@ namespace device {
 
 			bit_ro_t<io_, bitpos::B0> PERR;
 		};
-		static fpsr_t<0x007FC184> FPSR;
+		static IO_SIM_INLINE fpsr_t<0x007FC184> FPSR;
 
 
 		//-----------------------------------------------------------------//
@@ -103,7 +103,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  LVPE;
 			bit_rw_t<io_, bitpos::B7>  FMS2;
 		};
-		static fpmcr_t<0x007FC100> FPMCR;
+		static IO_SIM_INLINE fpmcr_t<0x007FC100> FPMCR;
 
 
 		//-----------------------------------------------------------------//
@@ -123,7 +123,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 5>  PCKA;
 			bits_rw_t<io_, bitpos::B6, 2>  SAS;
 		};
-		static fisr_t<0x007FC1D8> FISR;
+		static IO_SIM_INLINE fisr_t<0x007FC1D8> FISR;
 
 
 		//-----------------------------------------------------------------//
@@ -142,7 +142,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  FRESET;
 		};
-		static fresetr_t<0x007FC124> FRESETR;
+		static IO_SIM_INLINE fresetr_t<0x007FC124> FRESETR;
 
 
 		//-----------------------------------------------------------------//
@@ -161,7 +161,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  EXS;
 		};
-		static fasr_t<0x007FC104> FASR;
+		static IO_SIM_INLINE fasr_t<0x007FC104> FASR;
 
 
 		//-----------------------------------------------------------------//
@@ -182,7 +182,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>     STOP;
 			bit_rw_t <io_, bitpos::B7>     OPST;
 		};
-		static fcr_t<0x007FC114> FCR;
+		static IO_SIM_INLINE fcr_t<0x007FC114> FCR;
 
 
 		//-----------------------------------------------------------------//
@@ -202,7 +202,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>  CMD;
 			bit_rw_t <io_, bitpos::B7>     OPST;
 		};
-		static fexcr_t<0x007FC1DC> FEXCR;
+		static IO_SIM_INLINE fexcr_t<0x007FC1DC> FEXCR;
 
 
 		//-----------------------------------------------------------------//
@@ -210,7 +210,7 @@ namespace device {
 			@brief  フラッシュ処理開始アドレスレジスタ H (FSARH)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC110> FSARH;
+		static IO_SIM_INLINE rw16_t<0x007FC110> FSARH;
 
 
 		//-----------------------------------------------------------------//
@@ -218,7 +218,7 @@ namespace device {
 			@brief  フラッシュ処理開始アドレスレジスタ L (FSARL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC108> FSARL;
+		static IO_SIM_INLINE rw16_t<0x007FC108> FSARL;
 
 
 		//-----------------------------------------------------------------//
@@ -226,7 +226,7 @@ namespace device {
 			@brief  フラッシュ処理終了アドレスレジスタ H (FEARH)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC120> FEARH;
+		static IO_SIM_INLINE rw16_t<0x007FC120> FEARH;
 
 
 		//-----------------------------------------------------------------//
@@ -234,7 +234,7 @@ namespace device {
 			@brief  フラッシュ処理終了アドレスレジスタ L (FEARL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC118> FEARL;
+		static IO_SIM_INLINE rw16_t<0x007FC118> FEARL;
 
 
 		//-----------------------------------------------------------------//
@@ -242,10 +242,10 @@ namespace device {
 			@brief  フラッシュライトバッファ n レジスタ (FWBn) (n = 0 ～ 3)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC130> FWB0;
-		static rw16_t<0x007FC138> FWB1;
-		static rw16_t<0x007FC140> FWB2;
-		static rw16_t<0x007FC144> FWB3;
+		static IO_SIM_INLINE rw16_t<0x007FC130> FWB0;
+		static IO_SIM_INLINE rw16_t<0x007FC138> FWB1;
+		static IO_SIM_INLINE rw16_t<0x007FC140> FWB2;
+		static IO_SIM_INLINE rw16_t<0x007FC144> FWB3;
 
 
 		//-----------------------------------------------------------------//
@@ -265,7 +265,7 @@ namespace device {
 			bit_ro_t<io_, bitpos::B4>  ILGLERR;
 			bit_ro_t<io_, bitpos::B5>  EILGLERR;
 		};
-		static fstatr0_t<0x007FC1F0> FSTATR0;
+		static IO_SIM_INLINE fstatr0_t<0x007FC1F0> FSTATR0;
 
 
 		//-----------------------------------------------------------------//
@@ -282,7 +282,7 @@ namespace device {
 			bit_ro_t<io_, bitpos::B6>  FRDY;
 			bit_ro_t<io_, bitpos::B7>  EXRDY;
 		};
-		static fstatr1_t<0x007FC12C> FSTATR1;
+		static IO_SIM_INLINE fstatr1_t<0x007FC12C> FSTATR1;
 
 
 		//-----------------------------------------------------------------//
@@ -290,7 +290,7 @@ namespace device {
 			@brief  フラッシュエラーアドレスモニタレジスタ H (FEAMH)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC1E8> FEAMH;
+		static IO_SIM_INLINE rw16_t<0x007FC1E8> FEAMH;
 
 
 		//-----------------------------------------------------------------//
@@ -298,7 +298,7 @@ namespace device {
 			@brief  フラッシュエラーアドレスモニタレジスタ L (FEAML)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC1E0> FEAML;
+		static IO_SIM_INLINE rw16_t<0x007FC1E0> FEAML;
 
 
 		//-----------------------------------------------------------------//
@@ -317,7 +317,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B8>  SASMF;
 		};
-		static fscmr_t<0x007FC1C0> FSCMR;
+		static IO_SIM_INLINE fscmr_t<0x007FC1C0> FSCMR;
 
 
 		//-----------------------------------------------------------------//
@@ -325,7 +325,7 @@ namespace device {
 			@brief  フラッシュアクセスウィンドウ開始アドレスモニタレジスタ (FAWSMR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC1C8> FAWSMR;
+		static IO_SIM_INLINE rw16_t<0x007FC1C8> FAWSMR;
 
 
 		//-----------------------------------------------------------------//
@@ -333,7 +333,7 @@ namespace device {
 			@brief  フラッシュアクセスウィンドウ終了アドレスモニタレジスタ (FAWEMR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x007FC1D0> FAWEMR;
+		static IO_SIM_INLINE rw16_t<0x007FC1D0> FAWEMR;
 
 
 		//-----------------------------------------------------------------//
@@ -341,10 +341,10 @@ namespace device {
 			@brief  ユニーク ID レジスタ n (UIDRn) (n = 0 ～ 3)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x007FC350> UIDR0;
-		static rw32_t<0x007FC354> UIDR1;
-		static rw32_t<0x007FC358> UIDR2;
-		static rw32_t<0x007FC35C> UIDR3;
+		static IO_SIM_INLINE rw32_t<0x007FC350> UIDR0;
+		static IO_SIM_INLINE rw32_t<0x007FC354> UIDR1;
+		static IO_SIM_INLINE rw32_t<0x007FC358> UIDR2;
+		static IO_SIM_INLINE rw32_t<0x007FC35C> UIDR3;
 
 
 		//-----------------------------------------------------------------//
@@ -363,7 +363,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ROMCEN;
 		};
-		static romce_t<0x00081000> ROMCE;
+		static IO_SIM_INLINE romce_t<0x00081000> ROMCE;
 
 
 		//-----------------------------------------------------------------//
@@ -382,7 +382,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ROMCIV;
 		};
-		static romciv_t<0x00081004> ROMCIV;
+		static IO_SIM_INLINE romciv_t<0x00081004> ROMCIV;
 
 
 	};
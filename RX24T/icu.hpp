@@ -332,7 +332,7 @@ namespace device {
 			rw8_t<base + 248> RIIC_TXI0;
 			rw8_t<base + 249> RIIC_TEI0;
 		};
-		static ir_t<0x00087010> IR;
+		static IO_SIM_INLINE ir_t<0x00087010> IR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -495,7 +495,7 @@ namespace device {
 			bit_rw_t<ier1f, bitpos::B0>	RIIC_TXI0;
 			bit_rw_t<ier1f, bitpos::B1>	RIIC_TEI0;
 		};
-		static ier_t<0x00087200> IER;
+		static IO_SIM_INLINE ier_t<0x00087200> IER;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -580,7 +580,7 @@ namespace device {
 			rw8_t<base + 248> RIIC_TXI0;
 			rw8_t<base + 249> RIIC_TEI0;
 		};
-		static ipr_t<0x00087300> IPR;
+		static IO_SIM_INLINE ipr_t<0x00087300> IPR;
 
 	};
 	typedef icu_t ICU;
@@ -35,7 +35,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> PFSWE;
 			bit_rw_t<io_, bitpos::B7> B0WI;
 		};
-		static pwpr_t<0x0008C11F> PWPR;
+		static IO_SIM_INLINE pwpr_t<0x0008C11F> PWPR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -132,9 +132,9 @@ namespace device {
 			@brief  P0n 端子機能制御レジスタ（P0nPFS）（n = 0 ～ 3, 5, 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C140> P00PFS;
-		static pfsx_t<0x0008C141> P01PFS;
-		static pfsx_t<0x0008C142> P02PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C140> P00PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C141> P01PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C142> P02PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -142,8 +142,8 @@ namespace device {
 			@brief  P1n 端子機能制御レジスタ（P1nPFS）（n = 0, 1）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C148> P10PFS;
-		static pfsx_t<0x0008C149> P11PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C148> P10PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C149> P11PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -151,11 +151,11 @@ namespace device {
 			@brief  P2n 端子機能制御レジスタ（P2nPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C150> P20PFS;
-		static pfsy_t<0x0008C151> P21PFS;
-		static pfsy_t<0x0008C152> P22PFS;
-		static pfsy_t<0x0008C153> P23PFS;
-		static pfsy_t<0x0008C154> P24PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C150> P20PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C151> P21PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C152> P22PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C153> P23PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C154> P24PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -163,10 +163,10 @@ namespace device {
 			@brief  P3n 端子機能制御レジスタ（P3nPFS）（n = 0 ～ 4）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C158> P30PFS;
-		static pfsx_t<0x0008C159> P31PFS;
-		static pfsx_t<0x0008C15A> P32PFS;
-		static pfsx_t<0x0008C15B> P33PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C158> P30PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C159> P31PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C15A> P32PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C15B> P33PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -174,14 +174,14 @@ namespace device {
 			@brief  P4n 端子機能制御レジスタ（P4nPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsz_t<0x0008C160> P40PFS;
-		static pfsz_t<0x0008C161> P41PFS;
-		static pfsz_t<0x0008C162> P42PFS;
-		static pfsz_t<0x0008C163> P43PFS;
-		static pfsz_t<0x0008C164> P44PFS;
-		static pfsz_t<0x0008C165> P45PFS;
-		static pfsz_t<0x0008C166> P46PFS;
-		static pfsz_t<0x0008C167> P47PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C160> P40PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C161> P41PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C162> P42PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C163> P43PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C164> P44PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C165> P45PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C166> P46PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C167> P47PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -189,12 +189,12 @@ namespace device {
 			@brief  P5n 端子機能制御レジスタ（P5nPFS）（n = 0 ～ 5）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsw_t<0x0008C168> P50PFS;
-		static pfsw_t<0x0008C169> P51PFS;
-		static pfsw_t<0x0008C16A> P52PFS;
-		static pfsw_t<0x0008C16B> P53PFS;
-		static pfsw_t<0x0008C16C> P54PFS;
-		static pfsw_t<0x0008C16D> P55PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C168> P50PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C169> P51PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C16A> P52PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C16B> P53PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C16C> P54PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C16D> P55PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -202,12 +202,12 @@ namespace device {
 			@brief  P6n 端子機能制御レジスタ（P6nPFS）（n = 0 ～ 5）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsw_t<0x0008C170> P60PFS;
-		static pfsw_t<0x0008C171> P61PFS;
-		static pfsw_t<0x0008C172> P62PFS;
-		static pfsw_t<0x0008C173> P63PFS;
-		static pfsw_t<0x0008C174> P64PFS;
-		static pfsw_t<0x0008C175> P65PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C170> P60PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C171> P61PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C172> P62PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C173> P63PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C174> P64PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C175> P65PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -215,12 +215,12 @@ namespace device {
 			@brief  P7n 端子機能制御レジスタ（P7nPFS）（n = 1 ～ 6）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C179> P71PFS;
-		static pfsx_t<0x0008C17A> P72PFS;
-		static pfsx_t<0x0008C17B> P73PFS;
-		static pfsx_t<0x0008C17C> P74PFS;
-		static pfsx_t<0x0008C17D> P75PFS;
-		static pfsx_t<0x0008C17E> P76PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C179> P71PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C17A> P72PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C17B> P73PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C17C> P74PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C17D> P75PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C17E> P76PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -228,9 +228,9 @@ namespace device {
 			@brief  P8n 端子機能制御レジスタ（P8nPFS）（n = 0 ～ 2）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsm_t<0x0008C180> P80PFS;
-		static pfsm_t<0x0008C181> P81PFS;
-		static pfsm_t<0x0008C182> P82PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C180> P80PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C181> P81PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C182> P82PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -238,13 +238,13 @@ namespace device {
 			@brief  P9n 端子機能制御レジスタ（P9nPFS）（n = 0 ～ 6）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C188> P90PFS;
-		static pfsx_t<0x0008C189> P91PFS;
-		static pfsx_t<0x0008C18A> P92PFS;
-		static pfsx_t<0x0008C18B> P93PFS;
-		static pfsx_t<0x0008C18C> P94PFS;
-		static pfsx_t<0x0008C18D> P95PFS;
-		static pfsx_t<0x0008C18E> P96PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C188> P90PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C189> P91PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C18A> P92PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C18B> P93PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C18C> P94PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C18D> P95PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C18E> P96PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -252,12 +252,12 @@ namespace device {
 			@brief  PAn 端子機能制御レジスタ（PAnPFS）（n = 0 ～ 5）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C190> PA0PFS;
-		static pfsx_t<0x0008C191> PA1PFS;
-		static pfsx_t<0x0008C192> PA2PFS;
-		static pfsx_t<0x0008C193> PA3PFS;
-		static pfsx_t<0x0008C194> PA4PFS;
-		static pfsx_t<0x0008C195> PA5PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C190> PA0PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C191> PA1PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C192> PA2PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C193> PA3PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C194> PA4PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C195> PA5PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -265,14 +265,14 @@ namespace device {
 			@brief  PBn 端子機能制御レジスタ（PBnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C198> PB0PFS;
-		static pfsx_t<0x0008C199> PB1PFS;
-		static pfsx_t<0x0008C19A> PB2PFS;
-		static pfsx_t<0x0008C19B> PB3PFS;
-		static pfsx_t<0x0008C19C> PB4PFS;
-		static pfsx_t<0x0008C19D> PB5PFS;
-		static pfsx_t<0x0008C19E> PB6PFS;
-		static pfsx_t<0x0008C19F> PB7PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C198> PB0PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C199> PB1PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C19A> PB2PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C19B> PB3PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C19C> PB4PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C19D> PB5PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C19E> PB6PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C19F> PB7PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -280,14 +280,14 @@ namespace device {
 			@brief  PDn 端子機能制御レジスタ（PDnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C1A8> PD0PFS;
-		static pfsx_t<0x0008C1A9> PD1PFS;
-		static pfsx_t<0x0008C1AA> PD2PFS;
-		static pfsx_t<0x0008C1AB> PD3PFS;
-		static pfsx_t<0x0008C1AC> PD4PFS;
-		static pfsx_t<0x0008C1AD> PD5PFS;
-		static pfsx_t<0x0008C1AE> PD6PFS;
-		static pfsx_t<0x0008C1AF> PD7PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1A8> PD0PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1A9> PD1PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AA> PD2PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AB> PD3PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AC> PD4PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AD> PD5PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AE> PD6PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AF> PD7PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -295,12 +295,12 @@ namespace device {
 			@brief  PEn 端子機能制御レジスタ（PEnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C1B0> PE0PFS;
-		static pfsx_t<0x0008C1B1> PE1PFS;
-		static pfsx_t<0x0008C1B2> PE2PFS;
-		static pfsx_t<0x0008C1B3> PE3PFS;
-		static pfsx_t<0x0008C1B4> PE4PFS;
-		static pfsx_t<0x0008C1B5> PE5PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B0> PE0PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B1> PE1PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B2> PE2PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B3> PE3PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B4> PE4PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B5> PE5PFS;
 
 	};
 	typedef mpc_t MPC;
@@ -30,7 +30,7 @@ namespace device {
 			@brief  A/D データレジスタ 0（ADDR0）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x20> ADDR0;
+		static IO_SIM_INLINE ro16_t<base + 0x20> ADDR0;
 
 
 		//-----------------------------------------------------------------//
@@ -38,7 +38,7 @@ namespace device {
 			@brief  A/D データレジスタ 1（ADDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x22> ADDR1;
+		static IO_SIM_INLINE ro16_t<base + 0x22> ADDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -46,7 +46,7 @@ namespace device {
 			@brief  A/D データレジスタ 2（ADDR2）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x24> ADDR2;
+		static IO_SIM_INLINE ro16_t<base + 0x24> ADDR2;
 
 
 		//-----------------------------------------------------------------//
@@ -54,7 +54,7 @@ namespace device {
 			@brief  A/D データレジスタ 3（ADDR3）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x26> ADDR3;
+		static IO_SIM_INLINE ro16_t<base + 0x26> ADDR3;
 
 
 		//-----------------------------------------------------------------//
@@ -62,7 +62,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ（ADDBLDR）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x18> ADDBLDR;
+		static IO_SIM_INLINE ro16_t<base + 0x18> ADDBLDR;
 
 
 		//-----------------------------------------------------------------//
@@ -70,7 +70,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ A（ADDBLDRA）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x84> ADDBLDRA;
+		static IO_SIM_INLINE ro16_t<base + 0x84> ADDBLDRA;
 
 
 		//-----------------------------------------------------------------//
@@ -78,7 +78,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ B（ADDBLDRB）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x86> ADDBLDRB;
+		static IO_SIM_INLINE ro16_t<base + 0x86> ADDBLDRB;
 
 
 		//-----------------------------------------------------------------//
@@ -105,7 +105,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B13, 2> ADCS;
 			bit_rw_t <io_, bitpos::B15>    ADST;
 		};
-		static adcsr_t<base + 0x00>  ADCSR;
+		static IO_SIM_INLINE adcsr_t<base + 0x00>  ADCSR;
 
 
 		//-----------------------------------------------------------------//
@@ -125,7 +125,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>  ADC;
 			bit_rw_t <io_, bitpos::B7>     AVEE;
 		};
-		static adadc_t<base + 0x0C>  ADADC;
+		static IO_SIM_INLINE adadc_t<base + 0x0C>  ADADC;
 
 
 		//-----------------------------------------------------------------//
@@ -148,7 +148,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B11>    DIAGM;
 			bit_rw_t <io_, bitpos::B15>    ADRFMT;
 		};
-		static adcer_t<base + 0x0E>  ADCER;
+		static IO_SIM_INLINE adcer_t<base + 0x0E>  ADCER;
 
 
 		//-----------------------------------------------------------------//
@@ -168,7 +168,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 6>  TRSB;
 			bits_rw_t<io_, bitpos::B8, 6>  TRSA;
 		};
-		static adstrgr_t<base + 0x10>  ADSTRGR;
+		static IO_SIM_INLINE adstrgr_t<base + 0x10>  ADSTRGR;
 
 
 		//-----------------------------------------------------------------//
@@ -189,7 +189,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>     GCADIE;
 			bit_rw_t <io_, bitpos::B7>     GRCE;
 		};
-		static adgctrgr_t<base + 0xD9>  ADGCTRGR;
+		static IO_SIM_INLINE adgctrgr_t<base + 0xD9>  ADGCTRGR;
 
 
 		//-----------------------------------------------------------------//
@@ -208,7 +208,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5>  ADNDIS;
 		};
-		static addiscr_t<base + 0x7A>  ADDISCR;
+		static IO_SIM_INLINE addiscr_t<base + 0x7A>  ADDISCR;
 
 
 		//-----------------------------------------------------------------//
@@ -230,7 +230,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  LGRRS;
 			bit_rw_t<io_, bitpos::B15>  GBRP;
 		};
-		static adgspcr_t<base + 0x80>  ADGSPCR;
+		static IO_SIM_INLINE adgspcr_t<base + 0x80>  ADGSPCR;
 
 	};
 
@@ -319,7 +319,7 @@ namespace device {
 				return rd16_(base + 0x20 + static_cast<uint32_t>(an) * 2);
 			}
 		};
-		static addr_t ADDR;
+		static IO_SIM_INLINE addr_t ADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -327,7 +327,7 @@ namespace device {
 			@brief  A/D データレジスタ 16（ADDR16）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x40> ADDR16;
+		static IO_SIM_INLINE ro16_t<base + 0x40> ADDR16;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -368,7 +368,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 A
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x04> ADANSA;
+		static IO_SIM_INLINE adans_t<base + 0x04> ADANSA;
 
 
 		//-----------------------------------------------------------------//
@@ -390,7 +390,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  ANSA002;
 			bit_rw_t<io_, bitpos::B3>  ANSA003;
 		};
-		static adansa0_t<base + 0x04>   ADANSA0;
+		static IO_SIM_INLINE adansa0_t<base + 0x04>   ADANSA0;
 
 
 		//-----------------------------------------------------------------//
@@ -409,7 +409,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ANSA100;
 		};
-		static adansa1_t<base + 0x06>   ADANSA1;
+		static IO_SIM_INLINE adansa1_t<base + 0x06>   ADANSA1;
 
 
 		//-----------------------------------------------------------------//
@@ -417,7 +417,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 B
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x14> ADANSB;
+		static IO_SIM_INLINE adans_t<base + 0x14> ADANSB;
 
 
 		//-----------------------------------------------------------------//
@@ -439,7 +439,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  ANSB002;
 			bit_rw_t<io_, bitpos::B3>  ANSB003;
 		};
-		static adansb0_t<base + 0x14>   ADANSB0;
+		static IO_SIM_INLINE adansb0_t<base + 0x14>   ADANSB0;
 
 
 		//-----------------------------------------------------------------//
@@ -458,7 +458,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ANSB100;
 		};
-		static adansb1_t<base + 0x16>   ADANSB1;
+		static IO_SIM_INLINE adansb1_t<base + 0x16>   ADANSB1;
 
 
 		//-----------------------------------------------------------------//
@@ -466,7 +466,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 C
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0xD4> ADANSC;
+		static IO_SIM_INLINE adans_t<base + 0xD4> ADANSC;
 
 
 		//-----------------------------------------------------------------//
@@ -488,7 +488,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  ANSC002;
 			bit_rw_t<io_, bitpos::B3>  ANSC003;
 		};
-		static adansc0_t<base + 0xD4>   ADANSC0;
+		static IO_SIM_INLINE adansc0_t<base + 0xD4>   ADANSC0;
 
 
 		//-----------------------------------------------------------------//
@@ -507,7 +507,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ANSC100;
 		};
-		static adansc1_t<base + 0xD6>   ADANSC1;
+		static IO_SIM_INLINE adansc1_t<base + 0xD6>   ADANSC1;
 
 
 		//-----------------------------------------------------------------//
@@ -529,7 +529,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  ADS002;
 			bit_rw_t<io_, bitpos::B3>  ADS003;
 		};
-		static adads0_t<base + 0x08>   ADADS0;
+		static IO_SIM_INLINE adads0_t<base + 0x08>   ADADS0;
 
 
 		//-----------------------------------------------------------------//
@@ -548,7 +548,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ADS100;
 		};
-		static adads1_t<base + 0x0A>   ADADS1;
+		static IO_SIM_INLINE adads1_t<base + 0x0A>   ADADS1;
 
 
 		//-----------------------------------------------------------------//
@@ -565,7 +565,7 @@ namespace device {
 				}
 			}
 		};
-		static adsstr_t ADSSTR;
+		static IO_SIM_INLINE adsstr_t ADSSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -573,7 +573,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ L（ADSSTRL）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xDD> ADSSTRL;
+		static IO_SIM_INLINE rw8_t<base + 0xDD> ADSSTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -581,7 +581,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 0（ADSSTR0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE0> ADSSTR0;
+		static IO_SIM_INLINE rw8_t<base + 0xE0> ADSSTR0;
 
 
 		//-----------------------------------------------------------------//
@@ -589,7 +589,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 1（ADSSTR1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE1> ADSSTR1;
+		static IO_SIM_INLINE rw8_t<base + 0xE1> ADSSTR1;
 
 
 		//-----------------------------------------------------------------//
@@ -597,7 +597,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 2（ADSSTR2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE2> ADSSTR2;
+		static IO_SIM_INLINE rw8_t<base + 0xE2> ADSSTR2;
 
 
 		//-----------------------------------------------------------------//
@@ -605,7 +605,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 3（ADSSTR3）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE3> ADSSTR3;
+		static IO_SIM_INLINE rw8_t<base + 0xE3> ADSSTR3;
 
 
 		//-----------------------------------------------------------------//
@@ -625,7 +625,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1>  P000SEL1;
 			bit_rw_t<io_, bitpos::B2>  P000ENAMP;
 		};
-		static adpgacr_t<base + 0x1A0>  ADPGACR;
+		static IO_SIM_INLINE adpgacr_t<base + 0x1A0>  ADPGACR;
 
 
 		//-----------------------------------------------------------------//
@@ -644,7 +644,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3>  P000GAIN;
 		};
-		static adpgags0_t<base + 0x1A2>  ADPGAGS0;
+		static IO_SIM_INLINE adpgags0_t<base + 0x1A2>  ADPGAGS0;
 
 
 		//-----------------------------------------------------------------//
@@ -768,7 +768,7 @@ namespace device {
 				return rd16_(base + 0x20 + static_cast<uint32_t>(an) * 2);
 			}
 		};
-		static addr_t ADDR;
+		static IO_SIM_INLINE addr_t ADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -776,7 +776,7 @@ namespace device {
 			@brief  A/D データレジスタ 16（ADDR16）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x40> ADDR16;
+		static IO_SIM_INLINE ro16_t<base + 0x40> ADDR16;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -817,7 +817,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 A
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x04> ADANSA;
+		static IO_SIM_INLINE adans_t<base + 0x04> ADANSA;
 
 
 		//-----------------------------------------------------------------//
@@ -839,7 +839,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  ANSA002;
 			bit_rw_t<io_, bitpos::B3>  ANSA003;
 		};
-		static adansa0_t<base + 0x04>   ADANSA0;
+		static IO_SIM_INLINE adansa0_t<base + 0x04>   ADANSA0;
 
 
 		//-----------------------------------------------------------------//
@@ -858,7 +858,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ANSA100;
 		};
-		static adansa1_t<base + 0x06>   ADANSA1;
+		static IO_SIM_INLINE adansa1_t<base + 0x06>   ADANSA1;
 
 
 		//-----------------------------------------------------------------//
@@ -866,7 +866,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 B
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x14> ADANSB;
+		static IO_SIM_INLINE adans_t<base + 0x14> ADANSB;
 
 
 		//-----------------------------------------------------------------//
@@ -888,7 +888,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  ANSB002;
 			bit_rw_t<io_, bitpos::B3>  ANSB003;
 		};
-		static adansb0_t<base + 0x14>   ADANSB0;
+		static IO_SIM_INLINE adansb0_t<base + 0x14>   ADANSB0;
 
 
 		//-----------------------------------------------------------------//
@@ -907,7 +907,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ANSB100;
 		};
-		static adansb1_t<base + 0x16>   ADANSB1;
+		static IO_SIM_INLINE adansb1_t<base + 0x16>   ADANSB1;
 
 
 		//-----------------------------------------------------------------//
@@ -915,7 +915,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 C
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0xD4> ADANSC;
+		static IO_SIM_INLINE adans_t<base + 0xD4> ADANSC;
 
 
 		//-----------------------------------------------------------------//
@@ -937,7 +937,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  ANSC002;
 			bit_rw_t<io_, bitpos::B3>  ANSC003;
 		};
-		static adansc0_t<base + 0xD4>   ADANSC0;
+		static IO_SIM_INLINE adansc0_t<base + 0xD4>   ADANSC0;
 
 
 		//-----------------------------------------------------------------//
@@ -956,7 +956,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ANSC100;
 		};
-		static adansc1_t<base + 0xD6>   ADANSC1;
+		static IO_SIM_INLINE adansc1_t<base + 0xD6>   ADANSC1;
 
 
 		//-----------------------------------------------------------------//
@@ -973,7 +973,7 @@ namespace device {
 				}
 			}
 		};
-		static adsstr_t ADSSTR;
+		static IO_SIM_INLINE adsstr_t ADSSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -981,7 +981,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ L（ADSSTRL）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xDD> ADSSTRL;
+		static IO_SIM_INLINE rw8_t<base + 0xDD> ADSSTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -989,7 +989,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 0（ADSSTR0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE0> ADSSTR0;
+		static IO_SIM_INLINE rw8_t<base + 0xE0> ADSSTR0;
 
 
 		//-----------------------------------------------------------------//
@@ -997,7 +997,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 1（ADSSTR1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE1> ADSSTR1;
+		static IO_SIM_INLINE rw8_t<base + 0xE1> ADSSTR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1005,7 +1005,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 2（ADSSTR2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE2> ADSSTR2;
+		static IO_SIM_INLINE rw8_t<base + 0xE2> ADSSTR2;
 
 
 		//-----------------------------------------------------------------//
@@ -1013,7 +1013,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 3（ADSSTR3）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE3> ADSSTR3;
+		static IO_SIM_INLINE rw8_t<base + 0xE3> ADSSTR3;
 
 
 		//-----------------------------------------------------------------//
@@ -1033,7 +1033,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 8>  SSTSH;
 			bits_rw_t<io_, bitpos::B8, 3>  SHANS;
 		};
-		static adshcr_t<base + 0x66>   ADSHCR;
+		static IO_SIM_INLINE adshcr_t<base + 0x66>   ADSHCR;
 
 
 		//-----------------------------------------------------------------//
@@ -1192,7 +1192,7 @@ namespace device {
 				return rd16_(base + 0x20 + static_cast<uint32_t>(an) * 2);
 			}
 		};
-		static addr_t ADDR;
+		static IO_SIM_INLINE addr_t ADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1200,7 +1200,7 @@ namespace device {
 			@brief  A/D データレジスタ 4（ADDR4）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x28> ADDR4;
+		static IO_SIM_INLINE ro16_t<base + 0x28> ADDR4;
 
 
 		//-----------------------------------------------------------------//
@@ -1208,7 +1208,7 @@ namespace device {
 			@brief  A/D データレジスタ 5（ADDR5）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2A> ADDR5;
+		static IO_SIM_INLINE ro16_t<base + 0x2A> ADDR5;
 
 
 		//-----------------------------------------------------------------//
@@ -1216,7 +1216,7 @@ namespace device {
 			@brief  A/D データレジスタ 6（ADDR6）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2C> ADDR6;
+		static IO_SIM_INLINE ro16_t<base + 0x2C> ADDR6;
 
 
 		//-----------------------------------------------------------------//
@@ -1224,7 +1224,7 @@ namespace device {
 			@brief  A/D データレジスタ 7（ADDR7）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2E> ADDR7;
+		static IO_SIM_INLINE ro16_t<base + 0x2E> ADDR7;
 
 
 		//-----------------------------------------------------------------//
@@ -1232,7 +1232,7 @@ namespace device {
 			@brief  A/D データレジスタ 8（ADDR8）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x30> ADDR8;
+		static IO_SIM_INLINE ro16_t<base + 0x30> ADDR8;
 
 
 		//-----------------------------------------------------------------//
@@ -1240,7 +1240,7 @@ namespace device {
 			@brief  A/D データレジスタ 9（ADDR9）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x32> ADDR9;
+		static IO_SIM_INLINE ro16_t<base + 0x32> ADDR9;
 
 
 		//-----------------------------------------------------------------//
@@ -1248,7 +1248,7 @@ namespace device {
 			@brief  A/D データレジスタ 10（ADDR10）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x34> ADDR10;
+		static IO_SIM_INLINE ro16_t<base + 0x34> ADDR10;
 
 
 		//-----------------------------------------------------------------//
@@ -1256,7 +1256,7 @@ namespace device {
 			@brief  A/D データレジスタ 11（ADDR11）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x36> ADDR11;
+		static IO_SIM_INLINE ro16_t<base + 0x36> ADDR11;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1287,7 +1287,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 A
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x04> ADANSA;
+		static IO_SIM_INLINE adans_t<base + 0x04> ADANSA;
 
 
 		//-----------------------------------------------------------------//
@@ -1317,7 +1317,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B10> ANSB010;
 			bit_rw_t<io_, bitpos::B11> ANSB011;
 		};
-		static adansa0_t<base + 0x04>   ADANSA0;
+		static IO_SIM_INLINE adansa0_t<base + 0x04>   ADANSA0;
 
 
 		//-----------------------------------------------------------------//
@@ -1325,7 +1325,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 B
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x14> ADANSB;
+		static IO_SIM_INLINE adans_t<base + 0x14> ADANSB;
 
 
 		//-----------------------------------------------------------------//
@@ -1355,7 +1355,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B10> ANSB010;
 			bit_rw_t<io_, bitpos::B11> ANSB011;
 		};
-		static adansb0_t<base + 0x14>   ADANSB0;
+		static IO_SIM_INLINE adansb0_t<base + 0x14>   ADANSB0;
 
 
 		//-----------------------------------------------------------------//
@@ -1363,7 +1363,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 C
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0xD4> ADANSC;
+		static IO_SIM_INLINE adans_t<base + 0xD4> ADANSC;
 
 
 		//-----------------------------------------------------------------//
@@ -1393,7 +1393,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B10> ANSB010;
 			bit_rw_t<io_, bitpos::B11> ANSB011;
 		};
-		static adansc0_t<base + 0xD4>   ADANSC0;
+		static IO_SIM_INLINE adansc0_t<base + 0xD4>   ADANSC0;
 
 
 		//-----------------------------------------------------------------//
@@ -1401,7 +1401,7 @@ namespace device {
 			@brief  A/D 内部基準電圧データレジスタ（ADOCDR）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x1C> ADOCDR;
+		static IO_SIM_INLINE ro16_t<base + 0x1C> ADOCDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1421,7 +1421,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1>  OCSAD;
 			bit_rw_t<io_, bitpos::B9>  OCSA;
 		};
-		static adexicr_t<base + 0x12>  ADEXICR;
+		static IO_SIM_INLINE adexicr_t<base + 0x12>  ADEXICR;
 
 
 		//-----------------------------------------------------------------//
@@ -1434,7 +1434,7 @@ namespace device {
 				wr8_(base + 0xE0 + static_cast<uint32_t>(an), v);
 			}
 		};
-		static adsstr_t ADSSTR;
+		static IO_SIM_INLINE adsstr_t ADSSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -1442,7 +1442,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 0（ADSSTR0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE0> ADSSTR0;
+		static IO_SIM_INLINE rw8_t<base + 0xE0> ADSSTR0;
 
 
 		//-----------------------------------------------------------------//
@@ -1450,7 +1450,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 1（ADSSTR1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE1> ADSSTR1;
+		static IO_SIM_INLINE rw8_t<base + 0xE1> ADSSTR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1458,7 +1458,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 2（ADSSTR2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE2> ADSSTR2;
+		static IO_SIM_INLINE rw8_t<base + 0xE2> ADSSTR2;
 
 
 		//-----------------------------------------------------------------//
@@ -1466,7 +1466,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 3（ADSSTR3）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE3> ADSSTR3;
+		static IO_SIM_INLINE rw8_t<base + 0xE3> ADSSTR3;
 
 
 		//-----------------------------------------------------------------//
@@ -1474,7 +1474,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 4（ADSSTR4）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE4> ADSSTR4;
+		static IO_SIM_INLINE rw8_t<base + 0xE4> ADSSTR4;
 
 
 		//-----------------------------------------------------------------//
@@ -1482,7 +1482,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 5（ADSSTR5）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE5> ADSSTR5;
+		static IO_SIM_INLINE rw8_t<base + 0xE5> ADSSTR5;
 
 
 		//-----------------------------------------------------------------//
@@ -1490,7 +1490,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 6（ADSSTR6）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE6> ADSSTR6;
+		static IO_SIM_INLINE rw8_t<base + 0xE6> ADSSTR6;
 
 
 		//-----------------------------------------------------------------//
@@ -1498,7 +1498,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 7（ADSSTR7）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE7> ADSSTR7;
+		static IO_SIM_INLINE rw8_t<base + 0xE7> ADSSTR7;
 
 
 		//-----------------------------------------------------------------//
@@ -1506,7 +1506,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 8（ADSSTR8）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE8> ADSSTR8;
+		static IO_SIM_INLINE rw8_t<base + 0xE8> ADSSTR8;
 
 
 		//-----------------------------------------------------------------//
@@ -1514,7 +1514,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 9（ADSSTR9）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE9> ADSSTR9;
+		static IO_SIM_INLINE rw8_t<base + 0xE9> ADSSTR9;
 
 
 		//-----------------------------------------------------------------//
@@ -1522,7 +1522,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 10（ADSSTR10）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xEA> ADSSTR10;
+		static IO_SIM_INLINE rw8_t<base + 0xEA> ADSSTR10;
 
 
 		//-----------------------------------------------------------------//
@@ -1530,7 +1530,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 11（ADSSTR11）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xEB> ADSSTR11;
+		static IO_SIM_INLINE rw8_t<base + 0xEB> ADSSTR11;
 
 
 		//-----------------------------------------------------------------//
@@ -38,7 +38,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B24, 4> ICK;
 			bits_rw_t<io_, bitpos::B28, 4> FCK;
 		};
-		static sckcr_t<0x00080020> SCKCR;
+		static IO_SIM_INLINE sckcr_t<0x00080020> SCKCR;
 
 
 		//-----------------------------------------------------------------//
@@ -56,7 +56,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B8, 3> CKSEL;
 		};
-		static sckcr3_t<0x00080026> SCKCR3;
+		static IO_SIM_INLINE sckcr3_t<0x00080026> SCKCR3;
 
 
 		//-----------------------------------------------------------------//
@@ -75,7 +75,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2> PLIDIV;
 			bits_rw_t<io_, bitpos::B8, 6> STC;
 		};
-		static pllcr_t<0x00080028> PLLCR;
+		static IO_SIM_INLINE pllcr_t<0x00080028> PLLCR;
 
 
 		//-----------------------------------------------------------------//
@@ -93,7 +93,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> PLLEN;
 		};
-		static pllcr2_t<0x0008002A> PLLCR2;
+		static IO_SIM_INLINE pllcr2_t<0x0008002A> PLLCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -111,7 +111,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> MOSTP;
 		};
-		static mosccr_t<0x00080032> MOSCCR;
+		static IO_SIM_INLINE mosccr_t<0x00080032> MOSCCR;
 
 
 		//-----------------------------------------------------------------//
@@ -129,7 +129,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> LCSTP;
 		};
-		static lococr_t<0x00080034> LOCOCR;
+		static IO_SIM_INLINE lococr_t<0x00080034> LOCOCR;
 
 
 		//-----------------------------------------------------------------//
@@ -147,7 +147,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> ILCSTP;
 		};
-		static ilococr_t<0x00080035> ILOCOCR;
+		static IO_SIM_INLINE ilococr_t<0x00080035> ILOCOCR;
 
 
 		//-----------------------------------------------------------------//
@@ -166,7 +166,7 @@ namespace device {
 			bit_ro_t<ro8_t<base>, bitpos::B0> MOOVF;
 			bit_ro_t<ro8_t<base>, bitpos::B2> PLOVF;
 		};
-		static oscovfsr_t<0x0008003C> OSCOVFSR;
+		static IO_SIM_INLINE oscovfsr_t<0x0008003C> OSCOVFSR;
 
 
 		//-----------------------------------------------------------------//
@@ -185,7 +185,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0> OSTDIE;
 			bit_rw_t<io_, bitpos::B7> OSTDE;
 		};
-		static ostdcr_t<0x00080040> OSTDCR;
+		static IO_SIM_INLINE ostdcr_t<0x00080040> OSTDCR;
 
 
 		//-----------------------------------------------------------------//
@@ -203,7 +203,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> OSTDF;
 		};
-		static ostdsr_t<0x00080041> OSTDSR;
+		static IO_SIM_INLINE ostdsr_t<0x00080041> OSTDSR;
 
 
 		//-----------------------------------------------------------------//
@@ -221,7 +221,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5> MSTS;
 		};
-		static moscwtcr_t<0x000800A2> MOSCWTCR;
+		static IO_SIM_INLINE moscwtcr_t<0x000800A2> MOSCWTCR;
 
 
 		//-----------------------------------------------------------------//
@@ -240,7 +240,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5> MODRV21;
 			bit_rw_t<io_, bitpos::B6> MOSEL;
 		};
-		static mofcr_t<0x0008C293> MOFCR;
+		static IO_SIM_INLINE mofcr_t<0x0008C293> MOFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -248,7 +248,7 @@ namespace device {
 			@brief  メモリウェイトサイクル設定レジスタ（MEMWAIT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x00080031> MEMWAIT;
+		static IO_SIM_INLINE rw8_t<0x00080031> MEMWAIT;
 
 
 		//-----------------------------------------------------------------//
@@ -266,7 +266,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B15>	SSBY;
 		};
-		static sbycr_t<0x0008000C> SBYCR;
+		static IO_SIM_INLINE sbycr_t<0x0008000C> SBYCR;
 
 
 		//-----------------------------------------------------------------//
@@ -302,7 +302,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B28> MSTPA28;
 		};
-		static mstpcra_t<0x00080010> MSTPCRA;
+		static IO_SIM_INLINE mstpcra_t<0x00080010> MSTPCRA;
 
 
 		//-----------------------------------------------------------------//
@@ -335,7 +335,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B30> MSTPB30;
 		};
-		static mstpcrb_t<0x00080014> MSTPCRB;
+		static IO_SIM_INLINE mstpcrb_t<0x00080014> MSTPCRB;
 
 
 		//-----------------------------------------------------------------//
@@ -357,7 +357,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B31> DSLPE;
 		};
-		static mstpcrb_t<0x00080018> MSTPCRC;
+		static IO_SIM_INLINE mstpcrb_t<0x00080018> MSTPCRC;
 
 
 		//-----------------------------------------------------------------//
@@ -377,7 +377,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B4>    OPCMTSF;
 		};
-		static opccr_t<0x000800A0> OPCCR;
+		static IO_SIM_INLINE opccr_t<0x000800A0> OPCCR;
 
 
 		//-----------------------------------------------------------------//
@@ -398,7 +398,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B3>    PRC3;
 			bits_rw_t<io_, bitpos::B8, 8> PRKEY;
 		};
-		static prcr_t<0x000803FE> PRCR;
+		static IO_SIM_INLINE prcr_t<0x000803FE> PRCR;
 	};
 
 	typedef system_t SYSTEM;
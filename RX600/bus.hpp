@@ -38,16 +38,16 @@ namespace device {
 			bit_rw_t <io_, bitpos::B12>    MPXEN;
 		};
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX66T) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csncr_t<0x00083802> CS0CR;
-		static csncr_t<0x00083812> CS1CR;
-		static csncr_t<0x00083822> CS2CR;
-		static csncr_t<0x00083832> CS3CR;
+		static IO_SIM_INLINE csncr_t<0x00083802> CS0CR;
+		static IO_SIM_INLINE csncr_t<0x00083812> CS1CR;
+		static IO_SIM_INLINE csncr_t<0x00083822> CS2CR;
+		static IO_SIM_INLINE csncr_t<0x00083832> CS3CR;
 #endif
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csncr_t<0x00083842> CS4CR;
-		static csncr_t<0x00083852> CS5CR;
-		static csncr_t<0x00083862> CS6CR;
-		static csncr_t<0x00083872> CS7CR;
+		static IO_SIM_INLINE csncr_t<0x00083842> CS4CR;
+		static IO_SIM_INLINE csncr_t<0x00083852> CS5CR;
+		static IO_SIM_INLINE csncr_t<0x00083862> CS6CR;
+		static IO_SIM_INLINE csncr_t<0x00083872> CS7CR;
 #endif
 
 
@@ -68,16 +68,16 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8, 4> WRCV;
 		};
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX66T) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csncr_t<0x0008380A> CS0REC;
-		static csncr_t<0x0008381A> CS1REC;
-		static csncr_t<0x0008382A> CS2REC;
-		static csncr_t<0x0008383A> CS3REC;
+		static IO_SIM_INLINE csncr_t<0x0008380A> CS0REC;
+		static IO_SIM_INLINE csncr_t<0x0008381A> CS1REC;
+		static IO_SIM_INLINE csncr_t<0x0008382A> CS2REC;
+		static IO_SIM_INLINE csncr_t<0x0008383A> CS3REC;
 #endif
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csncr_t<0x0008384A> CS4REC;
-		static csncr_t<0x0008385A> CS5REC;
-		static csncr_t<0x0008386A> CS6REC;
-		static csncr_t<0x0008387A> CS7REC;
+		static IO_SIM_INLINE csncr_t<0x0008384A> CS4REC;
+		static IO_SIM_INLINE csncr_t<0x0008385A> CS5REC;
+		static IO_SIM_INLINE csncr_t<0x0008386A> CS6REC;
+		static IO_SIM_INLINE csncr_t<0x0008387A> CS7REC;
 #endif
 
 
@@ -112,7 +112,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14> RCVENM6;
 			bit_rw_t<io_, bitpos::B15> RCVENM7;
 		};
-		static csrecen_t<0x00083880> CSRECEN;
+		static IO_SIM_INLINE csrecen_t<0x00083880> CSRECEN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -135,16 +135,16 @@ namespace device {
 			bit_rw_t<io_, bitpos::B15> PRMOD;
 		};
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX66T) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csnmod_t<0x00083002> CS0MOD;
-		static csnmod_t<0x00083012> CS1MOD;
-		static csnmod_t<0x00083022> CS2MOD;
-		static csnmod_t<0x00083032> CS3MOD;
+		static IO_SIM_INLINE csnmod_t<0x00083002> CS0MOD;
+		static IO_SIM_INLINE csnmod_t<0x00083012> CS1MOD;
+		static IO_SIM_INLINE csnmod_t<0x00083022> CS2MOD;
+		static IO_SIM_INLINE csnmod_t<0x00083032> CS3MOD;
 #endif
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csnmod_t<0x00083042> CS4MOD;
-		static csnmod_t<0x00083052> CS5MOD;
-		static csnmod_t<0x00083062> CS6MOD;
-		static csnmod_t<0x00083072> CS7MOD;
+		static IO_SIM_INLINE csnmod_t<0x00083042> CS4MOD;
+		static IO_SIM_INLINE csnmod_t<0x00083052> CS5MOD;
+		static IO_SIM_INLINE csnmod_t<0x00083062> CS6MOD;
+		static IO_SIM_INLINE csnmod_t<0x00083072> CS7MOD;
 #endif
 
 
@@ -167,16 +167,16 @@ namespace device {
 			bits_rw_t<io_, bitpos::B24, 5> CSRWWAIT;
 		};
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX66T) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csnwcr1_t<0x00083004> CS0WCR1;
-		static csnwcr1_t<0x00083014> CS1WCR1;
-		static csnwcr1_t<0x00083024> CS2WCR1;
-		static csnwcr1_t<0x00083034> CS3WCR1;
+		static IO_SIM_INLINE csnwcr1_t<0x00083004> CS0WCR1;
+		static IO_SIM_INLINE csnwcr1_t<0x00083014> CS1WCR1;
+		static IO_SIM_INLINE csnwcr1_t<0x00083024> CS2WCR1;
+		static IO_SIM_INLINE csnwcr1_t<0x00083034> CS3WCR1;
 #endif
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csnwcr1_t<0x00083044> CS4WCR1;
-		static csnwcr1_t<0x00083054> CS5WCR1;
-		static csnwcr1_t<0x00083064> CS6WCR1;
-		static csnwcr1_t<0x00083074> CS7WCR1;
+		static IO_SIM_INLINE csnwcr1_t<0x00083044> CS4WCR1;
+		static IO_SIM_INLINE csnwcr1_t<0x00083054> CS5WCR1;
+		static IO_SIM_INLINE csnwcr1_t<0x00083064> CS6WCR1;
+		static IO_SIM_INLINE csnwcr1_t<0x00083074> CS7WCR1;
 #endif
 
 
@@ -203,16 +203,16 @@ namespace device {
 			bits_rw_t<io_, bitpos::B28, 3> CSON;
 		};
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX66T) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csnwcr2_t<0x00083008> CS0WCR2;
-		static csnwcr2_t<0x00083018> CS1WCR2;
-		static csnwcr2_t<0x00083028> CS2WCR2;
-		static csnwcr2_t<0x00083038> CS3WCR2;
+		static IO_SIM_INLINE csnwcr2_t<0x00083008> CS0WCR2;
+		static IO_SIM_INLINE csnwcr2_t<0x00083018> CS1WCR2;
+		static IO_SIM_INLINE csnwcr2_t<0x00083028> CS2WCR2;
+		static IO_SIM_INLINE csnwcr2_t<0x00083038> CS3WCR2;
 #endif
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static csnwcr2_t<0x00083048> CS4WCR2;
-		static csnwcr2_t<0x00083058> CS5WCR2;
-		static csnwcr2_t<0x00083068> CS6WCR2;
-		static csnwcr2_t<0x00083078> CS7WCR2;
+		static IO_SIM_INLINE csnwcr2_t<0x00083048> CS4WCR2;
+		static IO_SIM_INLINE csnwcr2_t<0x00083058> CS5WCR2;
+		static IO_SIM_INLINE csnwcr2_t<0x00083068> CS6WCR2;
+		static IO_SIM_INLINE csnwcr2_t<0x00083078> CS7WCR2;
 #endif
 
 
@@ -233,7 +233,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>    EXENB;
 			bits_rw_t<io_, bitpos::B4, 2> BSIZE;
 		};
-		static sdccr_t<0x00083C00> SDCCR;
+		static IO_SIM_INLINE sdccr_t<0x00083C00> SDCCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -251,7 +251,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0> EMODE;
 		};
-		static sdcmod_t<0x00083C01> SDCMOD;
+		static IO_SIM_INLINE sdcmod_t<0x00083C01> SDCMOD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -269,7 +269,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0> BE;
 		};
-		static sdamod_t<0x00083C02> SDAMOD;
+		static IO_SIM_INLINE sdamod_t<0x00083C02> SDAMOD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -287,7 +287,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0> SFEN;
 		};
-		static sdself_t<0x00083C10> SDSELF;
+		static IO_SIM_INLINE sdself_t<0x00083C10> SDSELF;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -306,7 +306,7 @@ namespace device {
 			bits_rw_t <io_, bitpos::B0,  12> RFC;
 			bits_rw_t <io_, bitpos::B12, 4>  REFW;
 		};
-		static sdrfcr_t<0x00083C14> SDRFCR;
+		static IO_SIM_INLINE sdrfcr_t<0x00083C14> SDRFCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -324,7 +324,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0> RFEN;
 		};
-		static sdrfen_t<0x00083C16> SDRFEN;
+		static IO_SIM_INLINE sdrfen_t<0x00083C16> SDRFEN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -342,7 +342,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0> INIRQ;
 		};
-		static sdicr_t<0x00083C20> SDICR;
+		static IO_SIM_INLINE sdicr_t<0x00083C20> SDICR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -362,7 +362,7 @@ namespace device {
 			bits_rw_t <io_, bitpos::B4, 4> ARFC;
 			bits_rw_t <io_, bitpos::B8, 3> PRC;
 		};
-		static sdir_t<0x00083C24> SDIR;
+		static IO_SIM_INLINE sdir_t<0x00083C24> SDIR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -380,7 +380,7 @@ namespace device {
 
 			bits_rw_t <io_, bitpos::B0, 2> MXC;
 		};
-		static sdadr_t<0x00083C40> SDADR;
+		static IO_SIM_INLINE sdadr_t<0x00083C40> SDADR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -402,7 +402,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 2> RCD;
 			bits_rw_t<io_, bitpos::B16, 3> RAS;
 		};
-		static sdtr_t<0x00083C44> SDTR;
+		static IO_SIM_INLINE sdtr_t<0x00083C44> SDTR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -420,7 +420,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 14> MR;
 		};
-		static sdmod_t<0x00083C48> SDMOD;
+		static IO_SIM_INLINE sdmod_t<0x00083C48> SDMOD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -440,7 +440,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3> INIST;
 			bit_rw_t<io_, bitpos::B4> SRFST;
 		};
-		static sdsr_t<0x00083C50> SDSR;
+		static IO_SIM_INLINE sdsr_t<0x00083C50> SDSR;
 #endif
 
 
@@ -459,7 +459,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> STSCLR;
 		};
-		static berclr_t<0x00081300> BERCLR;
+		static IO_SIM_INLINE berclr_t<0x00081300> BERCLR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -478,7 +478,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0> IGAEN;
 			bit_rw_t<io_, bitpos::B1> TOEN;
 		};
-		static beren_t<0x00081304> BEREN;
+		static IO_SIM_INLINE beren_t<0x00081304> BEREN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -498,7 +498,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B1>    TO;
 			bits_rw_t<io_, bitpos::B4, 3> MST;
 		};
-		static bersr1_t<0x00081308> BERSR1;
+		static IO_SIM_INLINE bersr1_t<0x00081308> BERSR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -516,7 +516,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B3, 13> ADDR;
 		};
-		static bersr2_t<0x0008130A> BERSR2;
+		static IO_SIM_INLINE bersr2_t<0x0008130A> BERSR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -540,7 +540,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B10, 2> BPFB;
 			bits_rw_t<io_, bitpos::B12, 2> BPEB;
 		};
-		static buspri_t<0x00081310> BUSPRI;
+		static IO_SIM_INLINE buspri_t<0x00081310> BUSPRI;
 
 
 #if defined(SIG_RX65N)
@@ -567,7 +567,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B31>     PRERR;
 		};
-		static ebmapcr_t<0x000C5800> EBMAPCR;
+		static IO_SIM_INLINE ebmapcr_t<0x000C5800> EBMAPCR;
 #endif
 	};
 	
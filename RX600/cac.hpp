@@ -41,7 +41,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>   CFME;
 		};
-		static cacr0_t<0x0008B000> CACR0;
+		static IO_SIM_INLINE cacr0_t<0x0008B000> CACR0;
 
 
 		//-----------------------------------------------------------------//
@@ -63,7 +63,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2>  TCSS;
 			bits_rw_t<io_, bitpos::B6, 2>  EDGES;
 		};
-		static cacr1_t<0x0008B001> CACR1;
+		static IO_SIM_INLINE cacr1_t<0x0008B001> CACR1;
 
 
 		//-----------------------------------------------------------------//
@@ -85,7 +85,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2>  RCDS;
 			bits_rw_t<io_, bitpos::B6, 2>  DFS;
 		};
-		static cacr2_t<0x0008B002> CACR2;
+		static IO_SIM_INLINE cacr2_t<0x0008B002> CACR2;
 
 
 		//-----------------------------------------------------------------//
@@ -110,7 +110,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5>   MENDFCL;
 			bit_rw_t<io_, bitpos::B6>   OVFFCL;
 		};
-		static caicr_t<0x0008B003> CAICR;
+		static IO_SIM_INLINE caicr_t<0x0008B003> CAICR;
 
 
 		//-----------------------------------------------------------------//
@@ -128,7 +128,7 @@ namespace device {
 			bit_ro_t<io_, bitpos::B1>   MENDF;
 			bit_ro_t<io_, bitpos::B2>   OVFF;
 		};
-		static castr_t<0x0008B004> CASTR;
+		static IO_SIM_INLINE castr_t<0x0008B004> CASTR;
 
 
 		//-----------------------------------------------------------------//
@@ -136,7 +136,7 @@ namespace device {
 			@brief  CAC 上限値設定レジスタ（CAULVR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x0008B006>  CAULVR;
+		static IO_SIM_INLINE rw16_t<0x0008B006>  CAULVR;
 
 
 		//-----------------------------------------------------------------//
@@ -144,7 +144,7 @@ namespace device {
 			@brief  CAC 下限値設定レジスタ（CALLVR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x0008B008>  CALLVR;
+		static IO_SIM_INLINE rw16_t<0x0008B008>  CALLVR;
 
 
 		//-----------------------------------------------------------------//
@@ -152,7 +152,7 @@ namespace device {
 			@brief  CAC カウンタバッファレジスタ（CACNTBR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x0008B00A>  CACNTBR;
+		static IO_SIM_INLINE rw16_t<0x0008B00A>  CACNTBR;
 
 
 		//-----------------------------------------------------------------//
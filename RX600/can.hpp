@@ -47,7 +47,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B11, 2>  BOM;
 			bit_rw_t <io_, bitpos::B13>     RBOC;
 		};
-		static ctlr_t<base + 0x0640> CTLR;
+		static IO_SIM_INLINE ctlr_t<base + 0x0640> CTLR;
 
 
 		//-----------------------------------------------------------------//
@@ -70,7 +70,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 10> BRP;
 			bits_rw_t<io_, bitpos::B28, 4>  TSEG1;
 		};
-		static bcr_t<base + 0x0644> BCR;
+		static IO_SIM_INLINE bcr_t<base + 0x0644> BCR;
 
 
 		//-----------------------------------------------------------------//
@@ -90,14 +90,14 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  18>  EID;
 			bits_rw_t<io_, bitpos::B18, 11>  SID;
 		};
-		static mkrk_t<base + 0x0200> MKR0;
-		static mkrk_t<base + 0x0204> MKR1;
-		static mkrk_t<base + 0x0208> MKR2;
-		static mkrk_t<base + 0x020C> MKR3;
-		static mkrk_t<base + 0x0210> MKR4;
-		static mkrk_t<base + 0x0214> MKR5;
-		static mkrk_t<base + 0x0218> MKR6;
-		static mkrk_t<base + 0x021C> MKR7;
+		static IO_SIM_INLINE mkrk_t<base + 0x0200> MKR0;
+		static IO_SIM_INLINE mkrk_t<base + 0x0204> MKR1;
+		static IO_SIM_INLINE mkrk_t<base + 0x0208> MKR2;
+		static IO_SIM_INLINE mkrk_t<base + 0x020C> MKR3;
+		static IO_SIM_INLINE mkrk_t<base + 0x0210> MKR4;
+		static IO_SIM_INLINE mkrk_t<base + 0x0214> MKR5;
+		static IO_SIM_INLINE mkrk_t<base + 0x0218> MKR6;
+		static IO_SIM_INLINE mkrk_t<base + 0x021C> MKR7;
 
 
 		//-----------------------------------------------------------------//
@@ -119,8 +119,8 @@ namespace device {
 			bit_rw_t <io_, bitpos::B30>      RTR;
 			bit_rw_t <io_, bitpos::B31>      IDE;
 		};
-		static fidcrx_t<base + 0x0220> FIDCR0;
-		static fidcrx_t<base + 0x0224> FIDCR1;
+		static IO_SIM_INLINE fidcrx_t<base + 0x0220> FIDCR0;
+		static IO_SIM_INLINE fidcrx_t<base + 0x0224> FIDCR1;
 
 
 		//-----------------------------------------------------------------//
@@ -170,31 +170,35 @@ namespace device {
 			bit_rw_t <io_, bitpos::B30>  MB30;
 			bit_rw_t <io_, bitpos::B31>  MB31;
 		};
-		static mbn_t<base + 0x0228> MKIVLR;
+		static IO_SIM_INLINE mbn_t<base + 0x0228> MKIVLR;
 
-/// 構成を検討中・・・
-#if 0
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  メールボックスレジスタ j （ MBj ）（ j = 0 ～ 31 ）
+			@brief  メールボックスレジスタ j （ MBj ）（ j = 0 ～ 31 ） @n
+					ID（+0）、DLC（+4）、DATA（+6～+13）、TS（+14）
 			@param[in]	ofs	オフセット
 		*/
 		//-----------------------------------------------------------------//
 		template <uint32_t ofs>
-		struct mbx_t : public rw32_t<ofs> {
-			typedef rw32_t<ofs> io_;
-			using io_::operator =;
-			using io_::operator ();
-			using io_::operator |=;
-			using io_::operator &=;
+		struct mb_t {
 
-			bits_rw_t<io_, bitpos::B0,  18>  EID;
-			bits_rw_t<io_, bitpos::B18, 11>  SID;
-			bit_rw_t <io_, bitpos::B30>      RTR;
-			bit_rw_t <io_, bitpos::B31>      IDE;
+			static const uint32_t IDE = 1UL << 31;	///< 拡張 ID
+			static const uint32_t RTR = 1UL << 30;	///< リモート・フレーム
+
+			static address_type address(uint32_t idx) noexcept { return ofs + idx * 16; }
+
+			static uint32_t get_id(uint32_t idx) noexcept { return rd32_(address(idx)); }
+			static void set_id(uint32_t idx, uint32_t val) noexcept { wr32_(address(idx), val); }
+
+			static uint8_t get_dlc(uint32_t idx) noexcept { return rd16_(address(idx) + 4) & 0x0F; }
+			static void set_dlc(uint32_t idx, uint8_t len) noexcept { wr16_(address(idx) + 4, len & 0x0F); }
+
+			static uint8_t get_data(uint32_t idx, uint32_t pos) noexcept { return rd8_(address(idx) + 6 + pos); }
+			static void set_data(uint32_t idx, uint32_t pos, uint8_t val) noexcept { wr8_(address(idx) + 6 + pos, val); }
+
+			static uint16_t get_ts(uint32_t idx) noexcept { return rd16_(address(idx) + 14); }
 		};
-///		static mbx_t<base + 0x0000> MB0;
-#endif
+		static IO_SIM_INLINE mb_t<base + 0x0000> MB;
 
 
 		//-----------------------------------------------------------------//
@@ -203,9 +207,8 @@ namespace device {
 			@param[in]	ofs	オフセット
 		*/
 		//-----------------------------------------------------------------//
-		static mbn_t<base + 0x022C> MIER;
+		static IO_SIM_INLINE mbn_t<base + 0x022C> MIER;
 
-#if 0
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  メッセージ制御レジスタ j （ MCTLj ）（ j ＝ 0 ～ 31 ）
@@ -213,20 +216,22 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 		template <uint32_t ofs>
-		struct mctln_t : public rw8_t<ofs> {
-			typedef rw8_t<ofs> io_;
-			using io_::operator =;
-			using io_::operator ();
-			using io_::operator |=;
-			using io_::operator &=;
-
-			bits_rw_t<io_, bitpos::B0,  18>  EID;
-			bits_rw_t<io_, bitpos::B18, 11>  SID;
-			bit_rw_t <io_, bitpos::B30>      RTR;
-			bit_rw_t <io_, bitpos::B31>      IDE;
+		struct mctl_t {
+
+			static const uint8_t NEWDATA   = 1 << 0;	///< 受信：新データ
+			static const uint8_t SENTDATA  = 1 << 0;	///< 送信：送信完了
+			static const uint8_t INVALDATA = 1 << 1;	///< 受信：データ更新中
+			static const uint8_t TRMACTIVE = 1 << 1;	///< 送信：送信中
+			static const uint8_t MSGLOST   = 1 << 2;	///< 受信：メッセージ・ロスト
+			static const uint8_t TRMABT    = 1 << 2;	///< 送信：アボート完了
+			static const uint8_t ONESHOT   = 1 << 4;	///< ワンショット
+			static const uint8_t RECREQ    = 1 << 6;	///< 受信要求
+			static const uint8_t TRMREQ    = 1 << 7;	///< 送信要求
+
+			static void set(uint32_t idx, uint8_t val) noexcept { wr8_(ofs + idx, val); }
+			static uint8_t get(uint32_t idx) noexcept { return rd8_(ofs + idx); }
 		};
-		static mctln_t<base + 0x0620> MCTL0;
-#endif
+		static IO_SIM_INLINE mctl_t<base + 0x0620> MCTL;
 
 
 		//-----------------------------------------------------------------//
@@ -250,7 +255,7 @@ namespace device {
 			bit_ro_t <io_, bitpos::B6>      RFWST;
 			bit_ro_t <io_, bitpos::B7>      RFEST;
 		};
-		static rfcr_t<base + 0x0648> RFCR;
+		static IO_SIM_INLINE rfcr_t<base + 0x0648> RFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -258,7 +263,7 @@ namespace device {
 			@brief  受信 FIFO ポインタ制御レジスタ（ RFPCR ）
 		*/
 		//-----------------------------------------------------------------//
-		static wo8_t<base + 0x0649>  RFPCR;
+		static IO_SIM_INLINE wo8_t<base + 0x0649>  RFPCR;
 
 
 		//-----------------------------------------------------------------//
@@ -280,7 +285,7 @@ namespace device {
 			bit_ro_t <io_, bitpos::B6>      TFFST;
 			bit_ro_t <io_, bitpos::B7>      TFEST;
 		};
-		static tfcr_t<base + 0x064A> TFCR;
+		static IO_SIM_INLINE tfcr_t<base + 0x064A> TFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -288,7 +293,7 @@ namespace device {
 			@brief  送信 FIFO ポインタ制御レジスタ（ TFPCR ）
 		*/
 		//-----------------------------------------------------------------//
-		static wo8_t<base + 0x064B>  TFPCR;
+		static IO_SIM_INLINE wo8_t<base + 0x064B>  TFPCR;
 
 
 		//-----------------------------------------------------------------//
@@ -318,7 +323,7 @@ namespace device {
 			bit_ro_t <in_, bitpos::B13>  TRMST;
 			bit_ro_t <in_, bitpos::B14>  RECST;
 		};
-		static str_t<base + 0x0642> STR;
+		static IO_SIM_INLINE str_t<base + 0x0642> STR;
 
 
 		//-----------------------------------------------------------------//
@@ -337,7 +342,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>  MBSM;
 		};
-		static msmr_t<base + 0x0654> MSMR;
+		static IO_SIM_INLINE msmr_t<base + 0x0653> MSMR;
 
 
 		//-----------------------------------------------------------------//
@@ -357,7 +362,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 5>  MBNST;
 			bit_rw_t <io_, bitpos::B7>     SEST;
 		};
-		static mssr_t<base + 0x0652> MSSR;
+		static IO_SIM_INLINE mssr_t<base + 0x0652> MSSR;
 
 
 		//-----------------------------------------------------------------//
@@ -365,7 +370,7 @@ namespace device {
 			@brief  チャネルサーチサポートレジスタ（ CSSR ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x0651>  CSSR;
+		static IO_SIM_INLINE rw8_t<base + 0x0651>  CSSR;
 
 
 		//-----------------------------------------------------------------//
@@ -373,7 +378,7 @@ namespace device {
 			@brief  アクセプタンスフィルタサポートレジスタ（ AFSR ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x0656>  AFSR;
+		static IO_SIM_INLINE rw16_t<base + 0x0656>  AFSR;
 
 
 		//-----------------------------------------------------------------//
@@ -399,7 +404,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  OLIE;
 			bit_rw_t<io_, bitpos::B7>  BLIE;
 		};
-		static eier_t<base + 0x064C> EIER;
+		static IO_SIM_INLINE eier_t<base + 0x064C> EIER;
 
 
 		//-----------------------------------------------------------------//
@@ -425,7 +430,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  OLIF;
 			bit_rw_t<io_, bitpos::B7>  BLIF;
 		};
-		static eifr_t<base + 0x064D> EIFR;
+		static IO_SIM_INLINE eifr_t<base + 0x064D> EIFR;
 
 
 		//-----------------------------------------------------------------//
@@ -433,7 +438,7 @@ namespace device {
 			@brief  受信エラーカウントレジスタ（ RECR ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x064E>  RECR;
+		static IO_SIM_INLINE rw8_t<base + 0x064E>  RECR;
 
 
 		//-----------------------------------------------------------------//
@@ -441,7 +446,7 @@ namespace device {
 			@brief  送信エラーカウントレジスタ（ TECR ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x064F>  TECR;
+		static IO_SIM_INLINE rw8_t<base + 0x064F>  TECR;
 
 
 		//-----------------------------------------------------------------//
@@ -467,7 +472,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  ADEF;
 			bit_rw_t<io_, bitpos::B7>  EDPM;
 		};
-		static ecsr_t<base + 0x0650> ECSR;
+		static IO_SIM_INLINE ecsr_t<base + 0x0650> ECSR;
 
 
 		//-----------------------------------------------------------------//
@@ -475,7 +480,7 @@ namespace device {
 			@brief  タイムスタンプレジスタ（ TSR ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x0654>  TSR;
+		static IO_SIM_INLINE rw16_t<base + 0x0654>  TSR;
 
 
 		//-----------------------------------------------------------------//
@@ -495,7 +500,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>     TSTE;
 			bits_rw_t<io_, bitpos::B1, 2>  TSTM;
 		};
-		static tcr_t<base + 0x0658> TCR;
+		static IO_SIM_INLINE tcr_t<base + 0x0658> TCR;
 
 
 		//-----------------------------------------------------------------//
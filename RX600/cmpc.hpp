@@ -48,7 +48,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B5, 2>  CDFS;
 			bit_rw_t <io_, bitpos::B7>     HCMPON;
 		};
-		static cmpctl_t<base + 0x00> CMPCTL;
+		static IO_SIM_INLINE cmpctl_t<base + 0x00> CMPCTL;
 
 
 		//-----------------------------------------------------------------//
@@ -67,7 +67,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>  CMPSEL;
 		};
-		static cmpsel0_t<base + 0x04> CMPSEL0;
+		static IO_SIM_INLINE cmpsel0_t<base + 0x04> CMPSEL0;
 
 
 		//-----------------------------------------------------------------//
@@ -86,7 +86,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>  CVRS;
 		};
-		static cmpsel1_t<base + 0x08> CMPSEL1;
+		static IO_SIM_INLINE cmpsel1_t<base + 0x08> CMPSEL1;
 
 
 		//-----------------------------------------------------------------//
@@ -105,7 +105,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  CMPMON0;
 		};
-		static cmpmon_t<base + 0x0C> CMPMON;
+		static IO_SIM_INLINE cmpmon_t<base + 0x0C> CMPMON;
 
 
 		//-----------------------------------------------------------------//
@@ -124,7 +124,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  CPOE;
 		};
-		static cmpioc_t<base + 0x10> CMPIOC;
+		static IO_SIM_INLINE cmpioc_t<base + 0x10> CMPIOC;
 
 
 		//-----------------------------------------------------------------//
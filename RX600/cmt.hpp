@@ -39,7 +39,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0> STR0;
 			bit_rw_t<io_, bitpos::B1> STR1;
 		};
-		static cmstr0_t	CMSTR0;
+		static IO_SIM_INLINE cmstr0_t	CMSTR0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -57,7 +57,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0> STR2;
 			bit_rw_t<io_, bitpos::B1> STR3;
 		};
-		static cmstr1_t	CMSTR1;
+		static IO_SIM_INLINE cmstr1_t	CMSTR1;
 
 
 
@@ -76,7 +76,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2> CKS;
 			bit_rw_t <io_, bitpos::B6>    CMIE;
 		};
-		static cmcr_t CMCR;
+		static IO_SIM_INLINE cmcr_t CMCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -84,7 +84,7 @@ namespace device {
 			@brief  CMCNT レジスタ
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw16_t<base + 0x02> CMCNT;
+		static IO_SIM_INLINE rw16_t<base + 0x02> CMCNT;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -92,7 +92,7 @@ namespace device {
 			@brief  CMCOR レジスタ
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw16_t<base + 0x04> CMCOR;
+		static IO_SIM_INLINE rw16_t<base + 0x04> CMCOR;
 
 
 		//-----------------------------------------------------------------//
@@ -42,7 +42,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>   STR;
 		};
-		static cmwstr_t CMWSTR;
+		static IO_SIM_INLINE cmwstr_t CMWSTR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -69,7 +69,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B13, 3>  CCLR;
 		};
-		static cmwcr_t CMWCR;
+		static IO_SIM_INLINE cmwcr_t CMWCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -98,7 +98,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B15>     CMWE;
 		};
-		static cmwior_t CMWIOR;
+		static IO_SIM_INLINE cmwior_t CMWIOR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -106,7 +106,7 @@ namespace device {
 			@brief  タイマカウンタ（CMWCNT）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x10> CMWCNT;
+		static IO_SIM_INLINE rw32_t<base + 0x10> CMWCNT;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -114,7 +114,7 @@ namespace device {
 			@brief  コンペアマッチコンスタントレジスタ（CMWCOR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x14> CMWCOR;
+		static IO_SIM_INLINE rw32_t<base + 0x14> CMWCOR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -122,7 +122,7 @@ namespace device {
 			@brief  インプットキャプチャレジスタ 0（CMWICR0）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x18> CMWICR0;
+		static IO_SIM_INLINE rw32_t<base + 0x18> CMWICR0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -130,7 +130,7 @@ namespace device {
 			@brief  インプットキャプチャレジスタ 1（CMWICR1）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x1C> CMWICR1;
+		static IO_SIM_INLINE rw32_t<base + 0x1C> CMWICR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -138,7 +138,7 @@ namespace device {
 			@brief  アウトプットコンペアレジスタ 0（CMWOCR0）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x20> CMWOCR0;
+		static IO_SIM_INLINE rw32_t<base + 0x20> CMWOCR0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -146,7 +146,7 @@ namespace device {
 			@brief  アウトプットコンペアレジスタ 1（CMWOCR1）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x24> CMWOCR1;
+		static IO_SIM_INLINE rw32_t<base + 0x24> CMWOCR1;
 
 
 		//-----------------------------------------------------------------//
@@ -39,7 +39,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B2>     LMS;
 			bit_rw_t <io_, bitpos::B7>     DORCLR;
 		};
-		static crccr_t<base + 0x00> CRCCR;
+		static IO_SIM_INLINE crccr_t<base + 0x00> CRCCR;
 
 
 		//-----------------------------------------------------------------//
@@ -47,7 +47,7 @@ namespace device {
 			@brief  CRC データ入力レジスタ（CRCDIR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x01> CRCDIR;
+		static IO_SIM_INLINE rw8_t<base + 0x01> CRCDIR;
 
 
 		//-----------------------------------------------------------------//
@@ -55,7 +55,7 @@ namespace device {
 			@brief  CRC データ出力レジスタ（CRCDOR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x02> CRCDOR;
+		static IO_SIM_INLINE rw16_t<base + 0x02> CRCDOR;
 
 	};
 	typedef crc_t<0x00088280> CRC;
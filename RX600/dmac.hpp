@@ -28,7 +28,7 @@ namespace device {
 			@brief  DMA 転送元アドレスレジスタ (DMSAR)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x00> DMSAR;
+		static IO_SIM_INLINE rw32_t<base + 0x00> DMSAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -36,7 +36,7 @@ namespace device {
 			@brief  DMA 転送先アドレスレジスタ (DMDAR)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x04> DMDAR;
+		static IO_SIM_INLINE rw32_t<base + 0x04> DMDAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -44,7 +44,7 @@ namespace device {
 			@brief  DMA 転送カウントレジスタ (DMCRA)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x08> DMCRA;
+		static IO_SIM_INLINE rw32_t<base + 0x08> DMCRA;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -52,7 +52,7 @@ namespace device {
 			@brief  DMA ブロック転送カウントレジスタ (DMCRB)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw16_t<base + 0x0C> DMCRB;
+		static IO_SIM_INLINE rw16_t<base + 0x0C> DMCRB;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -74,7 +74,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 2>   DTS;
 			bits_rw_t<io_, bitpos::B14, 2>   MD;
 		};
-		static dmtmd_t<base + 0x10> DMTMD;
+		static IO_SIM_INLINE dmtmd_t<base + 0x10> DMTMD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -97,7 +97,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>   ESIE;
 			bit_rw_t<io_, bitpos::B4>   DTIE;
 		};
-		static dmint_t<base + 0x13> DMINT;
+		static IO_SIM_INLINE dmint_t<base + 0x13> DMINT;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -119,7 +119,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  5>   SARA;
 			bits_rw_t<io_, bitpos::B14, 2>   SM;
 		};
-		static dmamd_t<base + 0x14> DMAMD;
+		static IO_SIM_INLINE dmamd_t<base + 0x14> DMAMD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -127,7 +127,7 @@ namespace device {
 			@brief  DMA オフセットレジスタ (DMOFR)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x18> DMOFR;
+		static IO_SIM_INLINE rw32_t<base + 0x18> DMOFR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -146,7 +146,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>   DTE;
 		};
-		static dmcnt_t<base + 0x1C> DMCNT;
+		static IO_SIM_INLINE dmcnt_t<base + 0x1C> DMCNT;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -166,7 +166,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>   SWREQ;
 			bit_rw_t<io_, bitpos::B4>   CLRS;
 		};
-		static dmreq_t<base + 0x1D> DMREQ;
+		static IO_SIM_INLINE dmreq_t<base + 0x1D> DMREQ;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -187,7 +187,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>   DTIF;
 			bit_rw_t<io_, bitpos::B7>   ACT;
 		};
-		static dmsts_t<base + 0x1E> DMSTS;
+		static IO_SIM_INLINE dmsts_t<base + 0x1E> DMSTS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -206,7 +206,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>   DISEL;
 		};
-		static dmcsl_t<base + 0x1F> DMCSL;
+		static IO_SIM_INLINE dmcsl_t<base + 0x1F> DMCSL;
 
 
 		//-----------------------------------------------------------------//
@@ -244,7 +244,7 @@ namespace device {
 
 		bit_rw_t<io_, bitpos::B0>   DMST;
 	};
-	static dmast_t<0x00082200> DMAST;
+	static IO_SIM_INLINE dmast_t<0x00082200> DMAST;
 
 
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -263,7 +263,7 @@ namespace device {
 		bit_ro_t<in_, bitpos::B6>   DMIS6;
 		bit_ro_t<in_, bitpos::B7>   DMIS7;
 	};
-	static dmist_t<0x00082204> DMIST;
+	static IO_SIM_INLINE dmist_t<0x00082204> DMIST;
 
 
 	typedef dmac_t<0x00082000, peripheral::DMAC0, ICU::VECTOR::DMAC0I>    DMAC0;
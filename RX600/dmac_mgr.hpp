@@ -39,6 +39,9 @@ namespace device {
 			SP_DN_16,		///< ソース＋、ディストネーション固定（16 bits）
 			SN_DP_32,		///< ソース固定、ディストネーション＋（32 bits）
 			SP_DN_32,		///< ソース＋、ディストネーション固定（32 bits）
+			SN_DN_8,		///< ソース固定、ディストネーション固定（8 bits）
+			SN_DN_16,		///< ソース固定、ディストネーション固定（16 bits）
+			SN_DN_32,		///< ソース固定、ディストネーション固定（32 bits）
 		};
 
 	private:
@@ -116,6 +119,60 @@ namespace device {
 		}
 
 
+		static void get_mode_(trans_type tft, uint8_t& dm, uint8_t& sm, uint8_t& sz) noexcept
+		{
+			switch(tft) {
+			case trans_type::SN_DP_8:
+				sm = 0b00;  // n
+				dm = 0b10;  // ++
+				sz = 0;
+				break;
+			case trans_type::SP_DN_8:
+				sm = 0b10;  // ++
+				dm = 0b00;  // n
+				sz = 0;
+				break;
+			case trans_type::SN_DP_16:
+				sm = 0b00;  // n
+				dm = 0b10;  // ++
+				sz = 1;
+				break;
+			case trans_type::SP_DN_16:
+				sm = 0b10;  // ++
+				dm = 0b00;  // n
+				sz = 1;
+				break;
+			case trans_type::SN_DP_32:
+				sm = 0b00;  // n
+				dm = 0b10;  // ++
+				sz = 2;
+				break;
+			case trans_type::SP_DN_32:
+				sm = 0b10;  // ++
+				dm = 0b00;  // n
+				sz = 2;
+				break;
+			case trans_type::SN_DN_8:
+				sm = 0b00;  // n
+				dm = 0b00;  // n
+				sz = 0;
+				break;
+			case trans_type::SN_DN_16:
+				sm = 0b00;  // n
+				dm = 0b00;  // n
+				sz = 1;
+				break;
+			case trans_type::SN_DN_32:
+				sm = 0b00;  // n
+				dm = 0b00;  // n
+				sz = 2;
+				break;
+			default:
+				break;
+			}
+		}
+
+
 	public:
 		//-----------------------------------------------------------------//
 		/*!
@@ -169,45 +226,14 @@ namespace device {
 			uint8_t dm = 0;
 			uint8_t sm = 0;
 			uint8_t sz = 0;
-			switch(tft) {
-			case trans_type::SN_DP_8:
-				sm = 0b00;  // n
-				dm = 0b10;  // ++
-				sz = 0;
-				break;
-			case trans_type::SP_DN_8:
-				sm = 0b10;  // ++
-				dm = 0b00;  // n
-				sz = 0;
-				break;
-			case trans_type::SN_DP_16:
-				sm = 0b00;  // n
-				dm = 0b10;  // ++
-				sz = 1;
-				break;
-			case trans_type::SP_DN_16:
-				sm = 0b10;  // ++
-				dm = 0b00;  // n
-				sz = 1;
-				break;
-			case trans_type::SN_DP_32:
-				sm = 0b00;  // n
-				dm = 0b10;  // ++
-				sz = 2;
-				break;
-			case trans_type::SP_DN_32:
-				sm = 0b10;  // ++
-				dm = 0b00;  // n
-				sz = 2;
-				break;
-			default:
-				break;
-			}
+			get_mode_(tft, dm, sm, sz);
 
+			// リピート領域は、アドレスが進む側（ソース＋なら転送元、それ以外は転送先）
+			uint8_t dts = (sm == 0b10) ? 0b01 : 0b00;
 			DMAC::DMAMD = DMAC::DMAMD.DM.b(dm) | DMAC::DMAMD.SM.b(sm);
 			// リピート転送
 			DMAC::DMTMD = DMAC::DMTMD.DCTG.b(0b01) | DMAC::DMTMD.SZ.b(sz) |
-						  DMAC::DMTMD.DTS.b(0b01)  | DMAC::DMTMD.MD.b(0b01);
+						  DMAC::DMTMD.DTS.b(dts)  | DMAC::DMTMD.MD.b(0b01);
 			DMAC::DMSAR = src;
 			DMAC::DMDAR = dst;
 
@@ -233,6 +259,54 @@ namespace device {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	割り込み要因によるノーマル転送 @n
+					１要求毎に１データを転送し、指定数で終了する。@n
+					※事前に「start(lvl)」で終了割り込みレベルを設定しておく。
+			@param[in]	trg		転送開始要因
+			@param[in]	tft		転送タイプ
+			@param[in]	src		元アドレス
+			@param[in]	dst		先アドレス
+			@param[in]	len		転送数（最大 65535、※カウント数なので注意）
+			@param[in]	tae		終了時タスクを起動する場合「true」
+			@return 成功なら「true」
+		 */
+		//-----------------------------------------------------------------//
+		bool trans(ICU::VECTOR trg, trans_type tft, uint32_t src, uint32_t dst, uint32_t len,
+			bool tae = false) noexcept
+		{
+			if(len == 0 || len > 65535) return false;
+
+			DMAC::DMCNT.DTE = 0;  // 念のため停止させる。
+
+			uint8_t dm = 0;
+			uint8_t sm = 0;
+			uint8_t sz = 0;
+			get_mode_(tft, dm, sm, sz);
+
+			DMAC::DMAMD = DMAC::DMAMD.DM.b(dm) | DMAC::DMAMD.SM.b(sm);
+			// ノーマル転送、周辺割り込み起動
+			DMAC::DMTMD = DMAC::DMTMD.DCTG.b(0b01) | DMAC::DMTMD.SZ.b(sz) |
+						  DMAC::DMTMD.DTS.b(0b10)  | DMAC::DMTMD.MD.b(0b00);
+			DMAC::DMSAR = src;
+			DMAC::DMDAR = dst;
+			DMAC::DMCRA = len;
+
+			icu_mgr::set_dmac(DMAC::get_peripheral(), trg);
+			if(tae && level_ > 0) {
+				DMAC::DMINT = DMAC::DMINT.DTIE.b();
+			} else {
+				DMAC::DMINT = 0x00;
+			}
+			DMAC::DMCSL.DISEL = 0;
+
+			DMAC::DMCNT.DTE = 1;
+
+			return true;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	転送再開 @n
@@ -272,6 +346,28 @@ namespace device {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	現在の転送元アドレスの取得
+			@return 転送元アドレス
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t get_src_adr() const noexcept {
+			return DMAC::DMSAR();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	現在の転送先アドレスの取得
+			@return 転送先アドレス
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t get_dst_adr() const noexcept {
+			return DMAC::DMDAR();
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	DMA 動作中か検査
@@ -300,7 +396,7 @@ namespace device {
 
 			DMAC::DMCNT.DTE = 0;  // 念のため停止させる。
 
-			uint32_t src_adr = reinterpret_cast<uint32_t>(org);
+			uint32_t src_adr = get_address(org);
 			uint32_t dst_adr = src_adr + frz;
 			len -= frz;
 
@@ -340,7 +436,7 @@ namespace device {
 			uint8_t* dst = static_cast<uint8_t*>(org);
 			*dst++ = val;
 			uint32_t frz = 1;
-			uint32_t adr = reinterpret_cast<uint32_t>(org);
+			uint32_t adr = get_address(org);
 			if((adr & 1) == 0 && (len & 1) == 0 && len > 2) {
 				++frz;
 				*dst++ = val;
@@ -367,7 +463,7 @@ namespace device {
 		bool memset16(void* org, uint16_t val, uint32_t len, bool tae = false) noexcept
 		{
 			if(org == nullptr || len < 2) return false;
-			uint32_t adr = reinterpret_cast<uint32_t>(org);
+			uint32_t adr = get_address(org);
 			if(adr & 1) return false;  // 奇数アドレスはNG
 
 			uint16_t* dst = static_cast<uint16_t*>(org);
@@ -396,7 +492,7 @@ namespace device {
 		{
 			if(org == nullptr || len < 4) return false;
 
-			uint32_t adr = reinterpret_cast<uint32_t>(org);
+			uint32_t adr = get_address(org);
 			if((adr & 3) != 0 || (len & 4) != 0) return false;  // 32ビット境界がNGの場合・・
 
 			uint32_t* dst = static_cast<uint32_t*>(org);
@@ -428,8 +524,8 @@ namespace device {
 
 			DMAC::DMCNT.DTE = 0;  // 念のため停止させる。
 
-			uint32_t src_adr = reinterpret_cast<uint32_t>(src);
-			uint32_t dst_adr = reinterpret_cast<uint32_t>(dst);
+			uint32_t src_adr = get_address(src);
+			uint32_t dst_adr = get_address(dst);
 
 			bool ret = false;
 			if(dst_adr < (src_adr + len)) {
@@ -41,7 +41,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B5>     DOPCF;
 			bit_rw_t <io_, bitpos::B6>     DOPCFCL;
 		};
-		static docr_t<base + 0x00> DOCR;
+		static IO_SIM_INLINE docr_t<base + 0x00> DOCR;
 
 
 		//-----------------------------------------------------------------//
@@ -49,7 +49,7 @@ namespace device {
 			@brief  DOC データインプットレジスタ（DODIR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x02> DODIR;
+		static IO_SIM_INLINE rw16_t<base + 0x02> DODIR;
 
 
 		//-----------------------------------------------------------------//
@@ -57,7 +57,7 @@ namespace device {
 			@brief  DOC データセッティングレジスタ（DODSR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x04> DODSR;
+		static IO_SIM_INLINE rw16_t<base + 0x04> DODSR;
 
 	};
 
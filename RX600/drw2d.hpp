@@ -61,7 +61,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B22>  SPANABT;
 			bit_rw_t<io_, bitpos::B23>  SPANSTR;
 		};
-		static control_t<base + 0x00> CONTROL;
+		static IO_SIM_INLINE control_t<base + 0x00> CONTROL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -106,7 +106,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B29>     BDIA;
 			bits_rw_t<io_, bitpos::B30, 2>  RLEPIXW;
 		};
-		static control2_t<base + 0x04> CONTROL2;
+		static IO_SIM_INLINE control2_t<base + 0x04> CONTROL2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -128,7 +128,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B2>      ENUIRCLR;
 			bit_rw_t <io_, bitpos::B3>      DLIRCLR;
 		};
-		static irqctl_t<base + 0xC0> IRQCTL;
+		static IO_SIM_INLINE irqctl_t<base + 0xC0> IRQCTL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -150,7 +150,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B2>      CENTX;
 			bit_rw_t <io_, bitpos::B3>      CFLUTX;
 		};
-		static cachectl_t<base + 0xC4> CACHECTL;
+		static IO_SIM_INLINE cachectl_t<base + 0xC4> CACHECTL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -171,7 +171,7 @@ namespace device {
 			bit_ro_t <io_, bitpos::B4>      ENUIR;
 			bit_ro_t <io_, bitpos::B5>      DLIR;
 		};
-		static status_t<base + 0x00> STATUS;
+		static IO_SIM_INLINE status_t<base + 0x00> STATUS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -198,7 +198,7 @@ namespace device {
 
 			bit_ro_t <io_, bitpos::B27>     ACBLD;
 		};
-		static hwver_t<base + 0x04> HWVER;
+		static IO_SIM_INLINE hwver_t<base + 0x04> HWVER;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -220,7 +220,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 8>    COL1R;
 			bits_rw_t<io_, bitpos::B24, 8>    COL1A;
 		};
-		static color1_t<base + 0x64> COLOR1;
+		static IO_SIM_INLINE color1_t<base + 0x64> COLOR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -242,7 +242,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 8>    COL2R;
 			bits_rw_t<io_, bitpos::B24, 8>    COL2A;
 		};
-		static color2_t<base + 0x68> COLOR2;
+		static IO_SIM_INLINE color2_t<base + 0x68> COLOR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -261,7 +261,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0,  8>    PATTERN;
 		};
-		static pattern_t<base + 0x74> PATTERN;
+		static IO_SIM_INLINE pattern_t<base + 0x74> PATTERN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -269,12 +269,12 @@ namespace device {
 			@brief	リミッタ n 開始値レジスタ (LnSTART) (n = 1 ～ 6)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x10> L1START;
-		static trw32_t<base + 0x14> L2START;
-		static trw32_t<base + 0x18> L3START;
-		static trw32_t<base + 0x1C> L4START;
-		static trw32_t<base + 0x20> L5START;
-		static trw32_t<base + 0x24> L6START;
+		static IO_SIM_INLINE trw32_t<base + 0x10> L1START;
+		static IO_SIM_INLINE trw32_t<base + 0x14> L2START;
+		static IO_SIM_INLINE trw32_t<base + 0x18> L3START;
+		static IO_SIM_INLINE trw32_t<base + 0x1C> L4START;
+		static IO_SIM_INLINE trw32_t<base + 0x20> L5START;
+		static IO_SIM_INLINE trw32_t<base + 0x24> L6START;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -282,12 +282,12 @@ namespace device {
 			@brief	リミッタ n X 軸インクリメントレジスタ (LnXADD) (n = 1 ～ 6)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x28> L1XADD;
-		static trw32_t<base + 0x2C> L2XADD;
-		static trw32_t<base + 0x30> L3XADD;
-		static trw32_t<base + 0x34> L4XADD;
-		static trw32_t<base + 0x38> L5XADD;
-		static trw32_t<base + 0x3C> L6XADD;
+		static IO_SIM_INLINE trw32_t<base + 0x28> L1XADD;
+		static IO_SIM_INLINE trw32_t<base + 0x2C> L2XADD;
+		static IO_SIM_INLINE trw32_t<base + 0x30> L3XADD;
+		static IO_SIM_INLINE trw32_t<base + 0x34> L4XADD;
+		static IO_SIM_INLINE trw32_t<base + 0x38> L5XADD;
+		static IO_SIM_INLINE trw32_t<base + 0x3C> L6XADD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -295,12 +295,12 @@ namespace device {
 			@brief	リミッタ n Y 軸インクリメントレジスタ (LnYADD) (n = 1 ～ 6)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x40> L1YADD;
-		static trw32_t<base + 0x44> L2YADD;
-		static trw32_t<base + 0x48> L3YADD;
-		static trw32_t<base + 0x4C> L4YADD;
-		static trw32_t<base + 0x50> L5YADD;
-		static trw32_t<base + 0x54> L6YADD;
+		static IO_SIM_INLINE trw32_t<base + 0x40> L1YADD;
+		static IO_SIM_INLINE trw32_t<base + 0x44> L2YADD;
+		static IO_SIM_INLINE trw32_t<base + 0x48> L3YADD;
+		static IO_SIM_INLINE trw32_t<base + 0x4C> L4YADD;
+		static IO_SIM_INLINE trw32_t<base + 0x50> L5YADD;
+		static IO_SIM_INLINE trw32_t<base + 0x54> L6YADD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -308,8 +308,8 @@ namespace device {
 			@brief	リミッタ m バンド幅パラメータレジスタ (LmBAND) (m = 1, 2)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x58> L1BAND;
-		static trw32_t<base + 0x5C> L2BAND;
+		static IO_SIM_INLINE trw32_t<base + 0x58> L1BAND;
+		static IO_SIM_INLINE trw32_t<base + 0x5C> L2BAND;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -317,7 +317,7 @@ namespace device {
 			@brief	テクスチャベースアドレスレジスタ (TEXORG)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0xBC> TEXORG;
+		static IO_SIM_INLINE trw32_t<base + 0xBC> TEXORG;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -325,7 +325,7 @@ namespace device {
 			@brief	テクスチャラインテクセル数レジスタ (TEXPITCH)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0xB4> TEXPITCH;
+		static IO_SIM_INLINE trw32_t<base + 0xB4> TEXPITCH;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -345,7 +345,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  11>  TEXUMASK;
 			bits_rw_t<io_, bitpos::B11, 21>  TEXVMASK;
 		};
-		static texmsk_t<base + 0xB8> TEXMSK;
+		static IO_SIM_INLINE texmsk_t<base + 0xB8> TEXMSK;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -353,7 +353,7 @@ namespace device {
 			@brief	U リミッタ開始値レジスタ (LUST)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x90> LUST;
+		static IO_SIM_INLINE trw32_t<base + 0x90> LUST;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -361,7 +361,7 @@ namespace device {
 			@brief	U リミッタ X 軸インクリメントレジスタ (LUXADD)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x94> LUXADD;
+		static IO_SIM_INLINE trw32_t<base + 0x94> LUXADD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -369,7 +369,7 @@ namespace device {
 			@brief	U リミッタ Y 軸インクリメントレジスタ (LUYADD)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x98> LUYADD;
+		static IO_SIM_INLINE trw32_t<base + 0x98> LUYADD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -377,7 +377,7 @@ namespace device {
 			@brief	V リミッタ開始値整数部レジスタ (LVSTI)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x9C> LVSTI;
+		static IO_SIM_INLINE trw32_t<base + 0x9C> LVSTI;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -386,7 +386,7 @@ namespace device {
 					※下位１６ビットのみが有効
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0xA0> LVSTF;
+		static IO_SIM_INLINE trw32_t<base + 0xA0> LVSTF;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -394,7 +394,7 @@ namespace device {
 			@brief	V リミッタ X 軸インクリメント整数部レジスタ (LVXADDI)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0xA4> LVXADDI;
+		static IO_SIM_INLINE trw32_t<base + 0xA4> LVXADDI;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -402,7 +402,7 @@ namespace device {
 			@brief	V リミッタ Y 軸インクリメント整数部レジスタ (LVYADDI)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0xA8> LVYADDI;
+		static IO_SIM_INLINE trw32_t<base + 0xA8> LVYADDI;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -422,7 +422,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  16>  LVYADDF;
 			bits_rw_t<io_, bitpos::B16, 16>  LVXADDF;
 		};
-		static lvyxaddf_t<base + 0xAC> LVYXADDF;
+		static IO_SIM_INLINE lvyxaddf_t<base + 0xAC> LVYXADDF;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -441,7 +441,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0,  8>  CLADDR;
 		};
-		static texcladdr_t<base + 0xDC> TEXCLADDR;
+		static IO_SIM_INLINE texcladdr_t<base + 0xDC> TEXCLADDR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -449,7 +449,7 @@ namespace device {
 			@brief	CLUT データレジスタ (TEXCLDATA)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0xE0> TEXCLDATA;
+		static IO_SIM_INLINE trw32_t<base + 0xE0> TEXCLDATA;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -468,7 +468,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0,  8>  CLOFST;
 		};
-		static texclofst_t<base + 0xE4> TEXCLOFST;
+		static IO_SIM_INLINE texclofst_t<base + 0xE4> TEXCLOFST;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -489,7 +489,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  8>  G;
 			bits_rw_t<io_, bitpos::B16, 8>  R;
 		};
-		static colkey_t<base + 0xE8> COLKEY;
+		static IO_SIM_INLINE colkey_t<base + 0xE8> COLKEY;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -509,7 +509,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  16>  X;
 			bits_rw_t<io_, bitpos::B16, 16>  Y;
 		};
-		static size_t<base + 0x78> SIZE;
+		static IO_SIM_INLINE size_t<base + 0x78> SIZE;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -529,7 +529,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  16>  PITCH;
 			bits_rw_t<io_, bitpos::B16, 16>  SSD;
 		};
-		static pitch_t<base + 0x7C> PITCH;
+		static IO_SIM_INLINE pitch_t<base + 0x7C> PITCH;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -537,7 +537,7 @@ namespace device {
 			@brief	フレームバッファベースアドレスレジスタ (ORIGIN)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0x80> ORIGIN;
+		static IO_SIM_INLINE trw32_t<base + 0x80> ORIGIN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -545,7 +545,7 @@ namespace device {
 			@brief	ディスプレイリスト開始アドレスレジスタ (DLISTST)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0xC8> DLISTST;
+		static IO_SIM_INLINE trw32_t<base + 0xC8> DLISTST;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -565,7 +565,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  16>  TRG1;
 			bits_rw_t<io_, bitpos::B16, 16>  TRG2;
 		};
-		static perftrg_t<base + 0xD4> PERFTRG;
+		static IO_SIM_INLINE perftrg_t<base + 0xD4> PERFTRG;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -573,8 +573,8 @@ namespace device {
 			@brief	パフォーマンスカウンタ k (PERFCNTk) (k = 1, 2)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static trw32_t<base + 0xCC> PERFCNT1;
-		static trw32_t<base + 0xD0> PERFCNT2;
+		static IO_SIM_INLINE trw32_t<base + 0xCC> PERFCNT1;
+		static IO_SIM_INLINE trw32_t<base + 0xD0> PERFCNT2;
 
 
 		//-----------------------------------------------------------------//
@@ -8,7 +8,9 @@
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
 //=====================================================================//
+#include <cstring>
 #include "graphics/color.hpp"
+#include "graphics/copy_row.hpp"
 #include "RX600/drw2d.hpp"
 
 #include "dave_base.h"
@@ -101,7 +103,9 @@ namespace device {
 				set_back_color_ = true;
 			}
 			if(!set_clip_) {
-				d2_cliprect(d2_, clip_.org.x, clip_.org.y, clip_.size.x, clip_.size.y);
+				// xmax、ymax は、領域に含まれる最後のピクセル
+				d2_cliprect(d2_, clip_.org.x, clip_.org.y,
+					clip_.org.x + clip_.size.x - 1, clip_.org.y + clip_.size.y - 1);
 				set_clip_ = true;
 			}
 		}
@@ -360,6 +364,8 @@ namespace device {
 			}
 			if(static_cast<uint16_t>(pos.x) >= static_cast<uint16_t>(GLC::width)) return false;
 			if(static_cast<uint16_t>(pos.y) >= static_cast<uint16_t>(GLC::height)) return false;
+			if(static_cast<uint16_t>(pos.x - clip_.org.x) >= static_cast<uint16_t>(clip_.size.x)) return false;
+			if(static_cast<uint16_t>(pos.y - clip_.org.y) >= static_cast<uint16_t>(clip_.size.y)) return false;
 			fb_[pos.y * line_offset + pos.x] = c;
 			return true;
 		}
@@ -380,6 +386,25 @@ namespace device {
         }
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	１行のピクセルを転送する（画像デコーダーの行出力用） @n
+					クリッピング領域の外は転送しない。@n
+					破線パターンが設定されている場合は転送しない（plot を使う）
+			@param[in]	pos	開始点を指定
+			@param[in]	src	ソース（RGB565）
+			@param[in]	len	ピクセル数
+			@return 破線パターンが設定されている場合「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool copy_row(const vtx::spos& pos, const value_type* src, int16_t len) noexcept
+		{
+			if(~stipple_ != 0) return false;
+			graphics::copy_row<GLC::width, GLC::height>(fb_, line_offset, clip_, pos, src, len);
+			return true;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	ペンサイズの設定
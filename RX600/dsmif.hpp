@@ -54,7 +54,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B28, 4>  OCSH;
 		};
-		static dscr_t<base + 0x00> DSCR;
+		static IO_SIM_INLINE dscr_t<base + 0x00> DSCR;
 
 
 
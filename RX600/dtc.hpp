@@ -37,7 +37,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B4> RRS;
 		};
-		static dtccr_t<0x00082400> DTCCR;
+		static IO_SIM_INLINE dtccr_t<0x00082400> DTCCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -45,7 +45,7 @@ namespace device {
 			@brief  DTC ベクタベースレジスタ（DTCVBR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<0x00082404> DTCVBR;
+		static IO_SIM_INLINE rw32_t<0x00082404> DTCVBR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -64,7 +64,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> SHORT;
 		};
-		static dtcadmod_t<0x00082408> DTCADMOD;
+		static IO_SIM_INLINE dtcadmod_t<0x00082408> DTCADMOD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -83,7 +83,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> DTCST;
 		};
-		static dtcst_t<0x0008240C> DTCST;
+		static IO_SIM_INLINE dtcst_t<0x0008240C> DTCST;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -103,7 +103,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 8> VECN;
 			bit_rw_t <io_, bitpos::B15>   ACT;
 		};
-		static dtcsts_t<0x0008240E> DTCSTS;
+		static IO_SIM_INLINE dtcsts_t<0x0008240E> DTCSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -47,7 +47,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> DE;
 
 		};
-		static edmr_t<base + 0x00> EDMR;
+		static IO_SIM_INLINE edmr_t<base + 0x00> EDMR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -67,7 +67,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0> TR;
 
 		};
-		static edtrr_t<base + 0x08> EDTRR;
+		static IO_SIM_INLINE edtrr_t<base + 0x08> EDTRR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -86,7 +86,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> RR;
 		};
-		static edrrr_t<base + 0x10> EDRRR;
+		static IO_SIM_INLINE edrrr_t<base + 0x10> EDRRR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -94,7 +94,7 @@ namespace device {
 			@brief  送信ディスクリプタリスト先頭アドレスレジスタ（TDLAR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x18> TDLAR;
+		static IO_SIM_INLINE rw32_t<base + 0x18> TDLAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -102,7 +102,7 @@ namespace device {
 			@brief  受信ディスクリプタリスト先頭アドレスレジスタ（RDLAR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x20> RDLAR;
+		static IO_SIM_INLINE rw32_t<base + 0x20> RDLAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -121,7 +121,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16> MFC;
 		};
-		static rmfcr_t<base + 0x40> RMFCR;
+		static IO_SIM_INLINE rmfcr_t<base + 0x40> RMFCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -140,7 +140,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 11> TFT;
 		};
-		static tftr_t<base + 0x48> TFTR;
+		static IO_SIM_INLINE tftr_t<base + 0x48> TFTR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -160,7 +160,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 5> RFD;
 			bits_rw_t<io_, bitpos::B8, 5> TFD;
 		};
-		static fdr_t<base + 0x50> FDR;
+		static IO_SIM_INLINE fdr_t<base + 0x50> FDR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -179,7 +179,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> RNR;
 		};
-		static rmcr_t<base + 0x58> RMCR;
+		static IO_SIM_INLINE rmcr_t<base + 0x58> RMCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -198,7 +198,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16> UNDER;
 		};
-		static tfucr_t<base + 0x64> TFUCR;
+		static IO_SIM_INLINE tfucr_t<base + 0x64> TFUCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -217,7 +217,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16> OVER;
 		};
-		static rfocr_t<base + 0x68> RFOCR;
+		static IO_SIM_INLINE rfocr_t<base + 0x68> RFOCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -238,7 +238,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B16, 3> RFFO;
 		};
-		static fcftr_t<base + 0x70> FCFTR;
+		static IO_SIM_INLINE fcftr_t<base + 0x70> FCFTR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -259,7 +259,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B16, 2> PADS;
 		};
-		static rpadir_t<base + 0x78> RPADIR;
+		static IO_SIM_INLINE rpadir_t<base + 0x78> RPADIR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -280,7 +280,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B4> TIM;
 		};
-		static trimd_t<base + 0x7C> TRIMD;
+		static IO_SIM_INLINE trimd_t<base + 0x7C> TRIMD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -288,7 +288,7 @@ namespace device {
 			@brief  受信バッファライトアドレスレジスタ（RBWAR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xC8> RBWAR;
+		static IO_SIM_INLINE rw32_t<base + 0xC8> RBWAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -296,7 +296,7 @@ namespace device {
 			@brief  受信ディスクリプタフェッチアドレスレジスタ（RDFAR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xCC> RDFAR;
+		static IO_SIM_INLINE rw32_t<base + 0xCC> RDFAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -304,7 +304,7 @@ namespace device {
 			@brief  送信バッファリードアドレスレジスタ（TBRAR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xD4> TBRAR;
+		static IO_SIM_INLINE rw32_t<base + 0xD4> TBRAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -312,7 +312,7 @@ namespace device {
 			@brief  送信ディスクリプタフェッチアドレスレジスタ（TDFAR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xD8> TDFAR;
+		static IO_SIM_INLINE rw32_t<base + 0xD8> TDFAR;
 	};
 
 
@@ -366,7 +366,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B30> TWB;
 		};
-		static eesr_t<base + 0x28> EESR;
+		static IO_SIM_INLINE eesr_t<base + 0x28> EESR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -409,7 +409,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B30> TWBIP;
 		};
-		static eesipr_t<base + 0x30> EESIPR;
+		static IO_SIM_INLINE eesipr_t<base + 0x30> EESIPR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -430,7 +430,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  RMAFCE;
 		};
-		static trscer_t<base + 0x38> TRSCER;
+		static IO_SIM_INLINE trscer_t<base + 0x38> TRSCER;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -449,7 +449,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> ELB;
 		};
-		static iosr_t<base + 0x6C> IOSR;
+		static IO_SIM_INLINE iosr_t<base + 0x6C> IOSR;
 
 
 		//-----------------------------------------------------------------//
@@ -506,7 +506,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B30>    TWB;
 		};
-		static eesr_t<base + 0x28> EESR;
+		static IO_SIM_INLINE eesr_t<base + 0x28> EESR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -542,7 +542,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B30>  TWBIP;
 		};
-		static eesipr_t<base + 0x30> EESIPR;
+		static IO_SIM_INLINE eesipr_t<base + 0x30> EESIPR;
 
 
 		//-----------------------------------------------------------------//
@@ -37,7 +37,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  ELCON;
 		};
-		static elcr_t<base + 0x00> ERCR;
+		static IO_SIM_INLINE elcr_t<base + 0x00> ERCR;
 
 
 		//-----------------------------------------------------------------//
@@ -46,37 +46,37 @@ namespace device {
 					（n = 0、3、4、7、10 ～ 13、15、16、18 ～ 28、33、35 ～ 38、41 ～ 45）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x01>  ELSR0;
-		static rw8_t<base + 0x04>  ELSR3;
-		static rw8_t<base + 0x05>  ELSR4;
-		static rw8_t<base + 0x08>  ELSR7;
-		static rw8_t<base + 0x0B>  ELSR10;
-		static rw8_t<base + 0x0C>  ELSR11;
-		static rw8_t<base + 0x0D>  ELSR12;
-		static rw8_t<base + 0x0E>  ELSR13;
-		static rw8_t<base + 0x10>  ELSR15;
-		static rw8_t<base + 0x11>  ELSR16;
-		static rw8_t<base + 0x13>  ELSR18;
-		static rw8_t<base + 0x14>  ELSR19;
-		static rw8_t<base + 0x15>  ELSR20;
-		static rw8_t<base + 0x16>  ELSR21;
-		static rw8_t<base + 0x17>  ELSR22;
-		static rw8_t<base + 0x18>  ELSR23;
-		static rw8_t<base + 0x19>  ELSR24;
-		static rw8_t<base + 0x1A>  ELSR25;
-		static rw8_t<base + 0x1B>  ELSR26;
-		static rw8_t<base + 0x1C>  ELSR27;
-		static rw8_t<base + 0x1D>  ELSR28;
-		static rw8_t<base + 0x31>  ELSR33;
-		static rw8_t<base + 0x33>  ELSR35;
-		static rw8_t<base + 0x34>  ELSR36;
-		static rw8_t<base + 0x35>  ELSR37;
-		static rw8_t<base + 0x36>  ELSR38;
-		static rw8_t<base + 0x39>  ELSR41;
-		static rw8_t<base + 0x3A>  ELSR42;
-		static rw8_t<base + 0x3B>  ELSR43;
-		static rw8_t<base + 0x3C>  ELSR44;
-		static rw8_t<base + 0x3D>  ELSR45;
+		static IO_SIM_INLINE rw8_t<base + 0x01>  ELSR0;
+		static IO_SIM_INLINE rw8_t<base + 0x04>  ELSR3;
+		static IO_SIM_INLINE rw8_t<base + 0x05>  ELSR4;
+		static IO_SIM_INLINE rw8_t<base + 0x08>  ELSR7;
+		static IO_SIM_INLINE rw8_t<base + 0x0B>  ELSR10;
+		static IO_SIM_INLINE rw8_t<base + 0x0C>  ELSR11;
+		static IO_SIM_INLINE rw8_t<base + 0x0D>  ELSR12;
+		static IO_SIM_INLINE rw8_t<base + 0x0E>  ELSR13;
+		static IO_SIM_INLINE rw8_t<base + 0x10>  ELSR15;
+		static IO_SIM_INLINE rw8_t<base + 0x11>  ELSR16;
+		static IO_SIM_INLINE rw8_t<base + 0x13>  ELSR18;
+		static IO_SIM_INLINE rw8_t<base + 0x14>  ELSR19;
+		static IO_SIM_INLINE rw8_t<base + 0x15>  ELSR20;
+		static IO_SIM_INLINE rw8_t<base + 0x16>  ELSR21;
+		static IO_SIM_INLINE rw8_t<base + 0x17>  ELSR22;
+		static IO_SIM_INLINE rw8_t<base + 0x18>  ELSR23;
+		static IO_SIM_INLINE rw8_t<base + 0x19>  ELSR24;
+		static IO_SIM_INLINE rw8_t<base + 0x1A>  ELSR25;
+		static IO_SIM_INLINE rw8_t<base + 0x1B>  ELSR26;
+		static IO_SIM_INLINE rw8_t<base + 0x1C>  ELSR27;
+		static IO_SIM_INLINE rw8_t<base + 0x1D>  ELSR28;
+		static IO_SIM_INLINE rw8_t<base + 0x31>  ELSR33;
+		static IO_SIM_INLINE rw8_t<base + 0x33>  ELSR35;
+		static IO_SIM_INLINE rw8_t<base + 0x34>  ELSR36;
+		static IO_SIM_INLINE rw8_t<base + 0x35>  ELSR37;
+		static IO_SIM_INLINE rw8_t<base + 0x36>  ELSR38;
+		static IO_SIM_INLINE rw8_t<base + 0x39>  ELSR41;
+		static IO_SIM_INLINE rw8_t<base + 0x3A>  ELSR42;
+		static IO_SIM_INLINE rw8_t<base + 0x3B>  ELSR43;
+		static IO_SIM_INLINE rw8_t<base + 0x3C>  ELSR44;
+		static IO_SIM_INLINE rw8_t<base + 0x3D>  ELSR45;
 
 
 		//-----------------------------------------------------------------//
@@ -96,7 +96,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2>  MTU0MD;
 			bits_rw_t<io_, bitpos::B6, 2>  MTU3MD;
 		};
-		static elopa_t<base + 0x1F> ELOPA;
+		static IO_SIM_INLINE elopa_t<base + 0x1F> ELOPA;
 
 
 		//-----------------------------------------------------------------//
@@ -115,7 +115,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>  MTU4MD;
 		};
-		static elopb_t<base + 0x20> ELOPB;
+		static IO_SIM_INLINE elopb_t<base + 0x20> ELOPB;
 
 
 		//-----------------------------------------------------------------//
@@ -134,7 +134,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B2, 2>  CMT1MD;
 		};
-		static elopc_t<base + 0x21> ELOPC;
+		static IO_SIM_INLINE elopc_t<base + 0x21> ELOPC;
 
 
 		//-----------------------------------------------------------------//
@@ -156,7 +156,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2>  TMR2MD;
 			bits_rw_t<io_, bitpos::B6, 2>  TMR3MD;
 		};
-		static elopd_t<base + 0x22> ELOPD;
+		static IO_SIM_INLINE elopd_t<base + 0x22> ELOPD;
 
 
 		//-----------------------------------------------------------------//
@@ -178,7 +178,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2>  TPU2MD;
 			bits_rw_t<io_, bitpos::B6, 2>  TPU3MD;
 		};
-		static elopf_t<base + 0x3F> ELOPF;
+		static IO_SIM_INLINE elopf_t<base + 0x3F> ELOPF;
 
 
 		//-----------------------------------------------------------------//
@@ -197,7 +197,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>  CMTW0MD;
 		};
-		static eloph_t<base + 0x41> ELOPH;
+		static IO_SIM_INLINE eloph_t<base + 0x41> ELOPH;
 
 
 		//-----------------------------------------------------------------//
@@ -217,7 +217,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>  GPT0MD;
 			bits_rw_t<io_, bitpos::B4, 3>  GPT1MD;
 		};
-		static elopi_t<base + 0x42> ELOPI;
+		static IO_SIM_INLINE elopi_t<base + 0x42> ELOPI;
 
 
 		//-----------------------------------------------------------------//
@@ -237,7 +237,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>  GPT2MD;
 			bits_rw_t<io_, bitpos::B4, 3>  GPT3MD;
 		};
-		static elopj_t<base + 0x43> ELOPJ;
+		static IO_SIM_INLINE elopj_t<base + 0x43> ELOPJ;
 
 
 		//-----------------------------------------------------------------//
@@ -263,8 +263,8 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  PGR6;
 			bit_rw_t<io_, bitpos::B7>  PGR7;
 		};
-		static pgrn_t<base + 0x23> PGR1;
-		static pgrn_t<base + 0x24> PGR2;
+		static IO_SIM_INLINE pgrn_t<base + 0x23> PGR1;
+		static IO_SIM_INLINE pgrn_t<base + 0x24> PGR2;
 
 
 		//-----------------------------------------------------------------//
@@ -285,8 +285,8 @@ namespace device {
 			bit_rw_t <io_, bitpos::B2>     PGCOVE;
 			bits_rw_t<io_, bitpos::B4, 3>  PGCO;
 		};
-		static pgcn_t<base + 0x25> PGC1;
-		static pgcn_t<base + 0x26> PGC2;
+		static IO_SIM_INLINE pgcn_t<base + 0x25> PGC1;
+		static IO_SIM_INLINE pgcn_t<base + 0x26> PGC2;
 
 
 		//-----------------------------------------------------------------//
@@ -312,8 +312,8 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  PDBF6;
 			bit_rw_t<io_, bitpos::B7>  PDBF7;
 		};
-		static pdbfn_t<base + 0x27> PDBF1;
-		static pdbfn_t<base + 0x28> PDBF2;
+		static IO_SIM_INLINE pdbfn_t<base + 0x27> PDBF1;
+		static IO_SIM_INLINE pdbfn_t<base + 0x28> PDBF2;
 
 
 		//-----------------------------------------------------------------//
@@ -334,10 +334,10 @@ namespace device {
 			bits_rw_t<io_, bitpos::B3, 2>  PSP;
 			bits_rw_t<io_, bitpos::B5, 2>  PSM;
 		};
-		static peln_t<base + 0x29> PEL0;
-		static peln_t<base + 0x2A> PEL1;
-		static peln_t<base + 0x2B> PEL2;
-		static peln_t<base + 0x2C> PEL3;
+		static IO_SIM_INLINE peln_t<base + 0x29> PEL0;
+		static IO_SIM_INLINE peln_t<base + 0x2A> PEL1;
+		static IO_SIM_INLINE peln_t<base + 0x2B> PEL2;
+		static IO_SIM_INLINE peln_t<base + 0x2C> PEL3;
 
 
 		//-----------------------------------------------------------------//
@@ -358,7 +358,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  WE;
 			bit_rw_t<io_, bitpos::B7>  WI;	// write-only
 		};
-		static elsegr_t<base + 0x2D> ELSEGR;
+		static IO_SIM_INLINE elsegr_t<base + 0x2D> ELSEGR;
 	};
 	typedef elc_t<0x0008B100> ELC;
 }
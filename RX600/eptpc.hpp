@@ -47,7 +47,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B20>  CYC4;
 			bit_rw_t<io_, bitpos::B21>  CYC5;
 		};
-		static miesr_t<0x000C4000>  MIESR;
+		static IO_SIM_INLINE miesr_t<0x000C4000>  MIESR;
 
 
 		//-----------------------------------------------------------------//
@@ -55,7 +55,7 @@ namespace device {
 			@brief  MINT 割り込み要求許可レジスタ (MIEIPR)
 		*/
 		//-----------------------------------------------------------------//
-		static miesr_t<0x000C4004>  MIEIPR;
+		static IO_SIM_INLINE miesr_t<0x000C4004>  MIEIPR;
 
 
 		//-----------------------------------------------------------------//
@@ -89,7 +89,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B16>  PLSP;
 			bit_rw_t<io_, bitpos::B24>  PLSN;
 		};
-		static elippr_t<0x000C4010>  ELIPPR;
+		static IO_SIM_INLINE elippr_t<0x000C4010>  ELIPPR;
 
 
 		//-----------------------------------------------------------------//
@@ -98,7 +98,7 @@ namespace device {
 			@param[in]	base	ベースアドレス
 		*/
 		//-----------------------------------------------------------------//
-		static elippr_t<0x000C4010>  ELIPACR;
+		static IO_SIM_INLINE elippr_t<0x000C4010>  ELIPACR;
 
 
 		//-----------------------------------------------------------------//
@@ -121,7 +121,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>  SYNTOUT;
 			bit_rw_t<io_, bitpos::B4>  W10D;
 		};
-		static stsr_t<0x000C4040>  STSR;
+		static IO_SIM_INLINE stsr_t<0x000C4040>  STSR;
 
 
 		//-----------------------------------------------------------------//
@@ -130,7 +130,7 @@ namespace device {
 			@param[in]	base	ベースアドレス
 		*/
 		//-----------------------------------------------------------------//
-		static stsr_t<0x000C4044>  STIPR;
+		static IO_SIM_INLINE stsr_t<0x000C4044>  STIPR;
 
 
 		//-----------------------------------------------------------------//
@@ -149,7 +149,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>  STCF;
 		};
-		static stcfr_t<0x000C4050>  STCFR;
+		static IO_SIM_INLINE stcfr_t<0x000C4050>  STCFR;
 
 
 		//-----------------------------------------------------------------//
@@ -177,7 +177,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B28>     ALEN0;
 			bit_rw_t <io_, bitpos::B29>     ALEN1;
 		};
-		static stmr_t<0x000C4054>  STMR;
+		static IO_SIM_INLINE stmr_t<0x000C4054>  STMR;
 
 
 		//-----------------------------------------------------------------//
@@ -185,7 +185,7 @@ namespace device {
 			@brief	Sync メッセージ受信タイムアウトレジスタ (SYNTOR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4058> SYNTOR;
+		static IO_SIM_INLINE rw32_t<0x000C4058> SYNTOR;
 
 
 		//-----------------------------------------------------------------//
@@ -209,7 +209,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>  IPTSEL4;
 			bit_rw_t<io_, bitpos::B5>  IPTSEL5;
 		};
-		static iptselr_t<0x000C4060>  IPTSELR;
+		static IO_SIM_INLINE iptselr_t<0x000C4060>  IPTSELR;
 
 
 		//-----------------------------------------------------------------//
@@ -233,7 +233,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>  MINTEN4;
 			bit_rw_t<io_, bitpos::B5>  MINTEN5;
 		};
-		static mitselr_t<0x000C4064>  MITSELR;
+		static IO_SIM_INLINE mitselr_t<0x000C4064>  MITSELR;
 
 
 		//-----------------------------------------------------------------//
@@ -257,7 +257,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>  ELTDIS4;
 			bit_rw_t<io_, bitpos::B5>  ELTDIS5;
 		};
-		static eltselr_t<0x000C4068>  ELTSELR;
+		static IO_SIM_INLINE eltselr_t<0x000C4068>  ELTSELR;
 
 
 		//-----------------------------------------------------------------//
@@ -276,7 +276,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  SYSEL;
 		};
-		static stchselr_t<0x000C406C>  STCHSELR;
+		static IO_SIM_INLINE stchselr_t<0x000C406C>  STCHSELR;
 
 
 		//-----------------------------------------------------------------//
@@ -295,7 +295,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  STR;
 		};
-		static synstartr_t<0x000C4080>  SYNSTARTR;
+		static IO_SIM_INLINE synstartr_t<0x000C4080>  SYNSTARTR;
 
 
 		//-----------------------------------------------------------------//
@@ -314,7 +314,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  LOAD;
 		};
-		static lcivldr_t<0x000C4084>  LCIVLDR;
+		static IO_SIM_INLINE lcivldr_t<0x000C4084>  LCIVLDR;
 
 
 		//-----------------------------------------------------------------//
@@ -322,7 +322,7 @@ namespace device {
 			@brief	同期外れ検出しきい値レジスタ U (SYNTDARU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4090> SYNTDARU;
+		static IO_SIM_INLINE rw32_t<0x000C4090> SYNTDARU;
 
 
 		//-----------------------------------------------------------------//
@@ -330,7 +330,7 @@ namespace device {
 			@brief	同期外れ検出しきい値レジスタ L (SYNTDARL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4094> SYNTDARL;
+		static IO_SIM_INLINE rw32_t<0x000C4094> SYNTDARL;
 
 
 		//-----------------------------------------------------------------//
@@ -338,7 +338,7 @@ namespace device {
 			@brief	同期検出しきい値レジスタ U (SYNTDBRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4098> SYNTDBRU;
+		static IO_SIM_INLINE rw32_t<0x000C4098> SYNTDBRU;
 
 
 		//-----------------------------------------------------------------//
@@ -346,7 +346,7 @@ namespace device {
 			@brief	同期検出しきい値レジスタ L (SYNTDBRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C409C> SYNTDBRL;
+		static IO_SIM_INLINE rw32_t<0x000C409C> SYNTDBRL;
 
 
 		//-----------------------------------------------------------------//
@@ -354,7 +354,7 @@ namespace device {
 			@brief	ローカルクロックカウンタ初期値レジスタ U (LCIVRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C40B0> LCIVRU;
+		static IO_SIM_INLINE rw32_t<0x000C40B0> LCIVRU;
 
 
 		//-----------------------------------------------------------------//
@@ -362,7 +362,7 @@ namespace device {
 			@brief	ローカルクロックカウンタ初期値レジスタ M (LCIVRM)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C40B4> LCIVRM;
+		static IO_SIM_INLINE rw32_t<0x000C40B4> LCIVRM;
 
 
 		//-----------------------------------------------------------------//
@@ -370,7 +370,7 @@ namespace device {
 			@brief	ローカルクロックカウンタ初期値レジスタ L (LCIVRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C40B8> LCIVRL;
+		static IO_SIM_INLINE rw32_t<0x000C40B8> LCIVRL;
 
 
 		//-----------------------------------------------------------------//
@@ -389,7 +389,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  GW10;
 		};
-		static getw10r_t<0x000C4124>  GETW10R;
+		static IO_SIM_INLINE getw10r_t<0x000C4124>  GETW10R;
 
 
 		//-----------------------------------------------------------------//
@@ -397,7 +397,7 @@ namespace device {
 			@brief	プラス側傾き制限値レジスタ U (PLIMITRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4128> PLIMITRU;
+		static IO_SIM_INLINE rw32_t<0x000C4128> PLIMITRU;
 
 
 		//-----------------------------------------------------------------//
@@ -405,7 +405,7 @@ namespace device {
 			@brief	プラス側傾き制限値レジスタ M (PLIMITRM)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C412C> PLIMITRM;
+		static IO_SIM_INLINE rw32_t<0x000C412C> PLIMITRM;
 
 
 		//-----------------------------------------------------------------//
@@ -413,7 +413,7 @@ namespace device {
 			@brief	プラス側傾き制限値レジスタ L (PLIMITRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4130> PLIMITRL;
+		static IO_SIM_INLINE rw32_t<0x000C4130> PLIMITRL;
 
 
 		//-----------------------------------------------------------------//
@@ -421,7 +421,7 @@ namespace device {
 			@brief	マイナス側傾き制限値レジスタ U (MLIMITRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4134> MLIMITRU;
+		static IO_SIM_INLINE rw32_t<0x000C4134> MLIMITRU;
 
 
 		//-----------------------------------------------------------------//
@@ -429,7 +429,7 @@ namespace device {
 			@brief	マイナス側傾き制限値レジスタ M (MLIMITRM)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4138> MLIMITRM;
+		static IO_SIM_INLINE rw32_t<0x000C4138> MLIMITRM;
 
 
 		//-----------------------------------------------------------------//
@@ -437,7 +437,7 @@ namespace device {
 			@brief	マイナス側傾き制限値レジスタ L (MLIMITRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C413C> MLIMITRL;
+		static IO_SIM_INLINE rw32_t<0x000C413C> MLIMITRL;
 
 
 		//-----------------------------------------------------------------//
@@ -456,7 +456,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  INFO;
 		};
-		static getinfor_t<0x000C4140>  GETINFOR;
+		static IO_SIM_INLINE getinfor_t<0x000C4140>  GETINFOR;
 
 
 		//-----------------------------------------------------------------//
@@ -464,7 +464,7 @@ namespace device {
 			@brief	ローカルクロックカウンタ U (LCCVRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4170> LCCVRU;
+		static IO_SIM_INLINE rw32_t<0x000C4170> LCCVRU;
 
 
 		//-----------------------------------------------------------------//
@@ -472,7 +472,7 @@ namespace device {
 			@brief	ローカルクロックカウンタ M (LCCVRM)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4174> LCCVRM;
+		static IO_SIM_INLINE rw32_t<0x000C4174> LCCVRM;
 
 
 		//-----------------------------------------------------------------//
@@ -480,7 +480,7 @@ namespace device {
 			@brief	ローカルクロックカウンタ L (LCCVRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4178> LCCVRL;
+		static IO_SIM_INLINE rw32_t<0x000C4178> LCCVRL;
 
 
 		//-----------------------------------------------------------------//
@@ -488,7 +488,7 @@ namespace device {
 			@brief	プラス側傾きワースト 10 値レジスタ U (PW10VRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4210> PW10VRU;
+		static IO_SIM_INLINE rw32_t<0x000C4210> PW10VRU;
 
 
 		//-----------------------------------------------------------------//
@@ -496,7 +496,7 @@ namespace device {
 			@brief	プラス側傾きワースト 10 値レジスタ M (PW10VRM)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4214> PW10VRM;
+		static IO_SIM_INLINE rw32_t<0x000C4214> PW10VRM;
 
 
 		//-----------------------------------------------------------------//
@@ -504,7 +504,7 @@ namespace device {
 			@brief	プラス側傾きワースト 10 値レジスタ L (PW10VRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4218> PW10VRL;
+		static IO_SIM_INLINE rw32_t<0x000C4218> PW10VRL;
 
 
 		//-----------------------------------------------------------------//
@@ -512,7 +512,7 @@ namespace device {
 			@brief	マイナス側傾きワースト 10 値レジスタ U (MW10RU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C42D0> MW10RU;
+		static IO_SIM_INLINE rw32_t<0x000C42D0> MW10RU;
 
 
 		//-----------------------------------------------------------------//
@@ -520,7 +520,7 @@ namespace device {
 			@brief	マイナス側傾きワースト 10 値レジスタ M (MW10RM)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C42D4> MW10RM;
+		static IO_SIM_INLINE rw32_t<0x000C42D4> MW10RM;
 
 
 		//-----------------------------------------------------------------//
@@ -528,7 +528,7 @@ namespace device {
 			@brief	マイナス側傾きワースト 10 値レジスタ L (MW10RL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C42D8> MW10RL;
+		static IO_SIM_INLINE rw32_t<0x000C42D8> MW10RL;
 
 
 		//-----------------------------------------------------------------//
@@ -536,12 +536,12 @@ namespace device {
 			@brief	タイマスタート時刻設定レジスタ m (TMSTTRUm) (m=0~5)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4300> TMSTTRU0;
-		static rw32_t<0x000C4310> TMSTTRU1;
-		static rw32_t<0x000C4320> TMSTTRU2;
-		static rw32_t<0x000C4330> TMSTTRU3;
-		static rw32_t<0x000C4340> TMSTTRU4;
-		static rw32_t<0x000C4350> TMSTTRU5;
+		static IO_SIM_INLINE rw32_t<0x000C4300> TMSTTRU0;
+		static IO_SIM_INLINE rw32_t<0x000C4310> TMSTTRU1;
+		static IO_SIM_INLINE rw32_t<0x000C4320> TMSTTRU2;
+		static IO_SIM_INLINE rw32_t<0x000C4330> TMSTTRU3;
+		static IO_SIM_INLINE rw32_t<0x000C4340> TMSTTRU4;
+		static IO_SIM_INLINE rw32_t<0x000C4350> TMSTTRU5;
 
 
 		//-----------------------------------------------------------------//
@@ -549,12 +549,12 @@ namespace device {
 			@brief	タイマスタート時刻設定レジスタ m (TMSTTRLm) (m=0~5)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4304> TMSTTRL0;
-		static rw32_t<0x000C4314> TMSTTRL1;
-		static rw32_t<0x000C4324> TMSTTRL2;
-		static rw32_t<0x000C4334> TMSTTRL3;
-		static rw32_t<0x000C4344> TMSTTRL4;
-		static rw32_t<0x000C4354> TMSTTRL5;
+		static IO_SIM_INLINE rw32_t<0x000C4304> TMSTTRL0;
+		static IO_SIM_INLINE rw32_t<0x000C4314> TMSTTRL1;
+		static IO_SIM_INLINE rw32_t<0x000C4324> TMSTTRL2;
+		static IO_SIM_INLINE rw32_t<0x000C4334> TMSTTRL3;
+		static IO_SIM_INLINE rw32_t<0x000C4344> TMSTTRL4;
+		static IO_SIM_INLINE rw32_t<0x000C4354> TMSTTRL5;
 
 
 		//-----------------------------------------------------------------//
@@ -562,12 +562,12 @@ namespace device {
 			@brief	タイマ周期設定レジスタ m (TMCYCRm) (m=0~5)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4308> TMCYCR0;
-		static rw32_t<0x000C4318> TMCYCR1;
-		static rw32_t<0x000C4328> TMCYCR2;
-		static rw32_t<0x000C4338> TMCYCR3;
-		static rw32_t<0x000C4348> TMCYCR4;
-		static rw32_t<0x000C4358> TMCYCR5;
+		static IO_SIM_INLINE rw32_t<0x000C4308> TMCYCR0;
+		static IO_SIM_INLINE rw32_t<0x000C4318> TMCYCR1;
+		static IO_SIM_INLINE rw32_t<0x000C4328> TMCYCR2;
+		static IO_SIM_INLINE rw32_t<0x000C4338> TMCYCR3;
+		static IO_SIM_INLINE rw32_t<0x000C4348> TMCYCR4;
+		static IO_SIM_INLINE rw32_t<0x000C4358> TMCYCR5;
 
 
 		//-----------------------------------------------------------------//
@@ -575,12 +575,12 @@ namespace device {
 			@brief	タイマパルス幅設定レジスタ m (TMPLSRm) (m=0~5)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C430C> TMPLSR0;
-		static rw32_t<0x000C431C> TMPLSR1;
-		static rw32_t<0x000C432C> TMPLSR2;
-		static rw32_t<0x000C433C> TMPLSR3;
-		static rw32_t<0x000C434C> TMPLSR4;
-		static rw32_t<0x000C435C> TMPLSR5;
+		static IO_SIM_INLINE rw32_t<0x000C430C> TMPLSR0;
+		static IO_SIM_INLINE rw32_t<0x000C431C> TMPLSR1;
+		static IO_SIM_INLINE rw32_t<0x000C432C> TMPLSR2;
+		static IO_SIM_INLINE rw32_t<0x000C433C> TMPLSR3;
+		static IO_SIM_INLINE rw32_t<0x000C434C> TMPLSR4;
+		static IO_SIM_INLINE rw32_t<0x000C435C> TMPLSR5;
 
 
 		//-----------------------------------------------------------------//
@@ -604,7 +604,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>  EN4;
 			bit_rw_t<io_, bitpos::B5>  EN5;
 		};
-		static tmstartr_t<0x000C437C>  TMSTARTR;
+		static IO_SIM_INLINE tmstartr_t<0x000C437C>  TMSTARTR;
 
 
 		//-----------------------------------------------------------------//
@@ -631,7 +631,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B28>  URE0;
 			bit_rw_t<io_, bitpos::B29>  URE1;
 		};
-		static prsr_t<0x000C4400>  PRSR;
+		static IO_SIM_INLINE prsr_t<0x000C4400>  PRSR;
 
 
 		//-----------------------------------------------------------------//
@@ -640,7 +640,7 @@ namespace device {
 			@param[in]	base	ベースアドレス
 		*/
 		//-----------------------------------------------------------------//
-		static prsr_t<0x000C4404>  PRIPR;
+		static IO_SIM_INLINE prsr_t<0x000C4404>  PRIPR;
 
 
 		//-----------------------------------------------------------------//
@@ -648,7 +648,7 @@ namespace device {
 			@brief	チャネル 0 自局 MAC アドレスレジスタ U (PRMACRU0)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4410> PRMACRU0;
+		static IO_SIM_INLINE rw32_t<0x000C4410> PRMACRU0;
 
 
 		//-----------------------------------------------------------------//
@@ -656,7 +656,7 @@ namespace device {
 			@brief	チャネル 0 自局 MAC アドレスレジスタ L (PRMACRL0)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4414> PRMACRL0;
+		static IO_SIM_INLINE rw32_t<0x000C4414> PRMACRL0;
 
 
 		//-----------------------------------------------------------------//
@@ -664,7 +664,7 @@ namespace device {
 			@brief	チャネル 1 自局 MAC アドレスレジスタ U (PRMACRU1)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4418> PRMACRU1;
+		static IO_SIM_INLINE rw32_t<0x000C4418> PRMACRU1;
 
 
 		//-----------------------------------------------------------------//
@@ -672,7 +672,7 @@ namespace device {
 			@brief	チャネル 1 自局 MAC アドレスレジスタ L (PRMACRL1)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C441C> PRMACRL1;
+		static IO_SIM_INLINE rw32_t<0x000C441C> PRMACRL1;
 
 
 		//-----------------------------------------------------------------//
@@ -691,7 +691,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>  TDIS;
 		};
-		static trndisr_t<0x000C4420>  TRNDISR;
+		static IO_SIM_INLINE trndisr_t<0x000C4420>  TRNDISR;
 
 
 		//-----------------------------------------------------------------//
@@ -713,7 +713,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B8>  FWD0;
 			bit_rw_t<io_, bitpos::B9>  FWD1;
 		};
-		static trnmr_t<0x000C4430>  TRNMR;
+		static IO_SIM_INLINE trnmr_t<0x000C4430>  TRNMR;
 
 
 		//-----------------------------------------------------------------//
@@ -732,7 +732,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 11>  THVAL;
 		};
-		static trncttdr_t<0x000C4434>  TRNCTTDR;
+		static IO_SIM_INLINE trncttdr_t<0x000C4434>  TRNCTTDR;
 
 
 		//-----------------------------------------------------------------//
@@ -751,7 +751,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>   RESET;
 		};
-		static ptrstr_t<0x000C0500>  PTRSTR;
+		static IO_SIM_INLINE ptrstr_t<0x000C0500>  PTRSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -772,7 +772,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B8, 3>   SCLKSEL;
 		};
-		static stcselr_t<0x000C0504>  STCSELR;
+		static IO_SIM_INLINE stcselr_t<0x000C0504>  STCSELR;
 
 
 		//-----------------------------------------------------------------//
@@ -824,7 +824,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B16>  RESDN;
 			bit_rw_t<io_, bitpos::B17>  GENDN;
 		};
-		static sysr_t<0x000C4800 + ofs>  SYSR;
+		static IO_SIM_INLINE sysr_t<0x000C4800 + ofs>  SYSR;
 
 
 		//-----------------------------------------------------------------//
@@ -832,7 +832,7 @@ namespace device {
 			@brief	SYNFP ステータス通知許可レジスタ (SYIPR)
 		*/
 		//-----------------------------------------------------------------//
-		static sysr_t<0x000C4804 + ofs>  SYIPR;
+		static IO_SIM_INLINE sysr_t<0x000C4804 + ofs>  SYIPR;
 
 
 		//-----------------------------------------------------------------//
@@ -840,7 +840,7 @@ namespace device {
 			@brief	SYNFP MAC アドレスレジスタ U (SYMACRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4810 + ofs> SYMACRU;
+		static IO_SIM_INLINE rw32_t<0x000C4810 + ofs> SYMACRU;
 
 
 		//-----------------------------------------------------------------//
@@ -848,7 +848,7 @@ namespace device {
 			@brief	SYNFP MAC アドレスレジスタ L (SYMACRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4814 + ofs> SYMACRL;
+		static IO_SIM_INLINE rw32_t<0x000C4814 + ofs> SYMACRL;
 
 
 		//-----------------------------------------------------------------//
@@ -867,7 +867,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 8>  CTL;
 		};
-		static syllcctlr_t<0x000C4818 + ofs>  SYLLCCTLR;
+		static IO_SIM_INLINE syllcctlr_t<0x000C4818 + ofs>  SYLLCCTLR;
 
 
 		//-----------------------------------------------------------------//
@@ -875,7 +875,7 @@ namespace device {
 			@brief	SYNFP 自局 IP アドレスレジスタ (SYIPADDRR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C481C + ofs> SYIPADDRR;
+		static IO_SIM_INLINE rw32_t<0x000C481C + ofs> SYIPADDRR;
 
 
 		//-----------------------------------------------------------------//
@@ -895,7 +895,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  VER;
 			bits_rw_t<io_, bitpos::B4, 4>  TRSP;
 		};
-		static syspvrr_t<0x000C4840 + ofs>  SYSPVRR;
+		static IO_SIM_INLINE syspvrr_t<0x000C4840 + ofs>  SYSPVRR;
 
 
 		//-----------------------------------------------------------------//
@@ -914,7 +914,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 8>  DNUM;
 		};
-		static sydomr_t<0x000C4844 + ofs>  SYDOMR;
+		static IO_SIM_INLINE sydomr_t<0x000C4844 + ofs>  SYDOMR;
 
 
 		//-----------------------------------------------------------------//
@@ -945,7 +945,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B13>  FLAG13;
 			bit_rw_t<io_, bitpos::B14>  FLAG14;
 		};
-		static anfr_t<0x000C4850 + ofs>  ANFR;
+		static IO_SIM_INLINE anfr_t<0x000C4850 + ofs>  ANFR;
 
 
 		//-----------------------------------------------------------------//
@@ -969,7 +969,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B13>  FLAG13;
 			bit_rw_t<io_, bitpos::B14>  FLAG14;
 		};
-		static synfr_t<0x000C4854 + ofs>  SYNFR;
+		static IO_SIM_INLINE synfr_t<0x000C4854 + ofs>  SYNFR;
 
 
 		//-----------------------------------------------------------------//
@@ -991,7 +991,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B13>  FLAG13;
 			bit_rw_t<io_, bitpos::B14>  FLAG14;
 		};
-		static dyrqfr_t<0x000C4858 + ofs>  DYRQFR;
+		static IO_SIM_INLINE dyrqfr_t<0x000C4858 + ofs>  DYRQFR;
 
 
 		//-----------------------------------------------------------------//
@@ -1015,7 +1015,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B13>  FLAG13;
 			bit_rw_t<io_, bitpos::B14>  FLAG14;
 		};
-		static dyrpfr_t<0x000C485C + ofs>  DYRPFR;
+		static IO_SIM_INLINE dyrpfr_t<0x000C485C + ofs>  DYRPFR;
 
 
 		//-----------------------------------------------------------------//
@@ -1023,7 +1023,7 @@ namespace device {
 			@brief	SYNFP 自局クロック ID レジスタ U (SYCIDRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4860 + ofs> SYCIDRU;
+		static IO_SIM_INLINE rw32_t<0x000C4860 + ofs> SYCIDRU;
 
 
 		//-----------------------------------------------------------------//
@@ -1031,7 +1031,7 @@ namespace device {
 			@brief	SYNFP 自局クロック ID レジスタ L (SYCIDRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4864 + ofs> SYCIDRL;
+		static IO_SIM_INLINE rw32_t<0x000C4864 + ofs> SYCIDRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1050,7 +1050,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   PNUM;
 		};
-		static sypnumr_t<0x000C4868 + ofs>  SYPNUMR;
+		static IO_SIM_INLINE sypnumr_t<0x000C4868 + ofs>  SYPNUMR;
 
 
 		//-----------------------------------------------------------------//
@@ -1071,7 +1071,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1>   STUP;
 			bit_rw_t<io_, bitpos::B2>   ANUP;
 		};
-		static syrvldr_t<0x000C4880 + ofs>  SYRVLDR;
+		static IO_SIM_INLINE syrvldr_t<0x000C4880 + ofs>  SYRVLDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1097,7 +1097,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B24, 3>  PDRP;
 			bits_rw_t<io_, bitpos::B28, 3>  PDFUP;
 		};
-		static syrfl1r_t<0x000C4890 + ofs>  SYRFL1R;
+		static IO_SIM_INLINE syrfl1r_t<0x000C4890 + ofs>  SYRFL1R;
 
 
 		//-----------------------------------------------------------------//
@@ -1118,7 +1118,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4,  2>  SIG;
 			bits_rw_t<io_, bitpos::B28, 2>  ILL;
 		};
-		static syrfl2r_t<0x000C4894 + ofs>  SYRFL2R;
+		static IO_SIM_INLINE syrfl2r_t<0x000C4894 + ofs>  SYRFL2R;
 
 
 		//-----------------------------------------------------------------//
@@ -1140,7 +1140,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B8>   DRQ;
 			bit_rw_t<io_, bitpos::B12>  PDRQ;
 		};
-		static sytrenr_t<0x000C4894 + ofs>  SYTRENR;
+		static IO_SIM_INLINE sytrenr_t<0x000C4894 + ofs>  SYTRENR;
 
 
 		//-----------------------------------------------------------------//
@@ -1148,7 +1148,7 @@ namespace device {
 			@brief	マスタクロック ID レジスタ U (MTCIDU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48A0 + ofs> MTCIDU;
+		static IO_SIM_INLINE rw32_t<0x000C48A0 + ofs> MTCIDU;
 
 
 		//-----------------------------------------------------------------//
@@ -1156,7 +1156,7 @@ namespace device {
 			@brief	マスタクロック ID レジスタ L (MTCIDL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48A4 + ofs> MTCIDL;
+		static IO_SIM_INLINE rw32_t<0x000C48A4 + ofs> MTCIDL;
 
 
 		//-----------------------------------------------------------------//
@@ -1175,7 +1175,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>  PNUM;
 		};
-		static mtpid_t<0x000C48A8 + ofs>  MTPID;
+		static IO_SIM_INLINE mtpid_t<0x000C48A8 + ofs>  MTPID;
 
 
 		//-----------------------------------------------------------------//
@@ -1196,7 +1196,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  8>  SYNC;
 			bits_rw_t<io_, bitpos::B16, 8>  DREQ;
 		};
-		static sytlir_t<0x000C48C0 + ofs>  SYTLIR;
+		static IO_SIM_INLINE sytlir_t<0x000C48C0 + ofs>  SYTLIR;
 
 
 		//-----------------------------------------------------------------//
@@ -1217,7 +1217,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  8>  SYNC;
 			bits_rw_t<io_, bitpos::B16, 8>  DRESP;
 		};
-		static syrlir_t<0x000C48C4 + ofs>  SYRLIR;
+		static IO_SIM_INLINE syrlir_t<0x000C48C4 + ofs>  SYRLIR;
 
 
 		//-----------------------------------------------------------------//
@@ -1225,7 +1225,7 @@ namespace device {
 			@brief	offsetFromMaster 値レジスタ U (OFMRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48C8 + ofs> OFMRU;
+		static IO_SIM_INLINE rw32_t<0x000C48C8 + ofs> OFMRU;
 
 
 		//-----------------------------------------------------------------//
@@ -1233,7 +1233,7 @@ namespace device {
 			@brief	offsetFromMaster 値レジスタ L (OFMRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48CC + ofs> OFMRL;
+		static IO_SIM_INLINE rw32_t<0x000C48CC + ofs> OFMRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1241,7 +1241,7 @@ namespace device {
 			@brief	meanPathDelay 値レジスタ U (MPDRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48D0 + ofs> MPDRU;
+		static IO_SIM_INLINE rw32_t<0x000C48D0 + ofs> MPDRU;
 
 
 		//-----------------------------------------------------------------//
@@ -1249,7 +1249,7 @@ namespace device {
 			@brief	meanPathDelay 値レジスタ L (MPDRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48D4 + ofs> MPDRL;
+		static IO_SIM_INLINE rw32_t<0x000C48D4 + ofs> MPDRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1270,7 +1270,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B16, 8>  GMPR1;
 		};
-		static gmpr_t<0x000C48E0 + ofs>  GMPR;
+		static IO_SIM_INLINE gmpr_t<0x000C48E0 + ofs>  GMPR;
 
 
 		//-----------------------------------------------------------------//
@@ -1278,7 +1278,7 @@ namespace device {
 			@brief	grandmasterClockQuality フィールド設定レジスタ (GMCQR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48E4 + ofs> GMCQR;
+		static IO_SIM_INLINE rw32_t<0x000C48E4 + ofs> GMCQR;
 
 
 		//-----------------------------------------------------------------//
@@ -1286,7 +1286,7 @@ namespace device {
 			@brief	grandmasterIdentity フィールド設定レジスタ U (GMIDRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48E8 + ofs> GMIDRU;
+		static IO_SIM_INLINE rw32_t<0x000C48E8 + ofs> GMIDRU;
 
 
 		//-----------------------------------------------------------------//
@@ -1294,7 +1294,7 @@ namespace device {
 			@brief	grandmasterIdentity フィールド設定レジスタ L (GMIDRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C48EC + ofs> GMIDRL;
+		static IO_SIM_INLINE rw32_t<0x000C48EC + ofs> GMIDRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1315,7 +1315,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B16, 16>  CUTO;
 		};
-		static cuotsr_t<0x000C48F0 + ofs>  CUOTSR;
+		static IO_SIM_INLINE cuotsr_t<0x000C48F0 + ofs>  CUOTSR;
 
 
 		//-----------------------------------------------------------------//
@@ -1334,7 +1334,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   SRMV;
 		};
-		static srr_t<0x000C48F4 + ofs>  SRR;
+		static IO_SIM_INLINE srr_t<0x000C48F4 + ofs>  SRR;
 
 
 		//-----------------------------------------------------------------//
@@ -1342,7 +1342,7 @@ namespace device {
 			@brief	PTP-primary メッセージ用宛先 MAC アドレス設定レジスタ U (PPMACRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4900 + ofs> PPMACRU;
+		static IO_SIM_INLINE rw32_t<0x000C4900 + ofs> PPMACRU;
 
 
 		//-----------------------------------------------------------------//
@@ -1350,7 +1350,7 @@ namespace device {
 			@brief	PTP-primary メッセージ用宛先 MAC アドレス設定レジスタ L (PPMACRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4904 + ofs> PPMACRL;
+		static IO_SIM_INLINE rw32_t<0x000C4904 + ofs> PPMACRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1358,7 +1358,7 @@ namespace device {
 			@brief	PTP-pdelay メッセージ用 MAC アドレス設定レジスタ U (PDMACRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4908 + ofs> PDMACRU;
+		static IO_SIM_INLINE rw32_t<0x000C4908 + ofs> PDMACRU;
 
 
 		//-----------------------------------------------------------------//
@@ -1366,7 +1366,7 @@ namespace device {
 			@brief	PTP-pdelay メッセージ用 MAC アドレス設定レジスタ L (PDMACRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C490C + ofs> PDMACRL;
+		static IO_SIM_INLINE rw32_t<0x000C490C + ofs> PDMACRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1385,7 +1385,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   TYPE;
 		};
-		static petyper_t<0x000C4910 + ofs>  PETYPER;
+		static IO_SIM_INLINE petyper_t<0x000C4910 + ofs>  PETYPER;
 
 
 		//-----------------------------------------------------------------//
@@ -1393,7 +1393,7 @@ namespace device {
 			@brief	PTP-primary メッセージ用宛先 IP アドレス設定レジスタ (PPIPR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4920 + ofs> PPIPR;
+		static IO_SIM_INLINE rw32_t<0x000C4920 + ofs> PPIPR;
 
 
 		//-----------------------------------------------------------------//
@@ -1401,7 +1401,7 @@ namespace device {
 			@brief	PTP-pdelay メッセージ用宛先 IP アドレス設定レジスタ (PDIPR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4924 + ofs> PDIPR;
+		static IO_SIM_INLINE rw32_t<0x000C4924 + ofs> PDIPR;
 
 
 		//-----------------------------------------------------------------//
@@ -1420,7 +1420,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 8>   EVTO;
 		};
-		static petosr_t<0x000C4928 + ofs>  PETOSR;
+		static IO_SIM_INLINE petosr_t<0x000C4928 + ofs>  PETOSR;
 
 
 		//-----------------------------------------------------------------//
@@ -1439,7 +1439,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 8>   GETO;
 		};
-		static pgtosr_t<0x000C492C + ofs>  PGTOSR;
+		static IO_SIM_INLINE pgtosr_t<0x000C492C + ofs>  PGTOSR;
 
 
 		//-----------------------------------------------------------------//
@@ -1458,7 +1458,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 8>   PRTL;
 		};
-		static ppttlr_t<0x000C4930 + ofs>  PPTTLR;
+		static IO_SIM_INLINE ppttlr_t<0x000C4930 + ofs>  PPTTLR;
 
 
 		//-----------------------------------------------------------------//
@@ -1477,7 +1477,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 8>   PDTL;
 		};
-		static pdttlr_t<0x000C4934 + ofs>  PDTTLR;
+		static IO_SIM_INLINE pdttlr_t<0x000C4934 + ofs>  PDTTLR;
 
 
 		//-----------------------------------------------------------------//
@@ -1496,7 +1496,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   EVUPT;
 		};
-		static peudpr_t<0x000C4938 + ofs>  PEUDPR;
+		static IO_SIM_INLINE peudpr_t<0x000C4938 + ofs>  PEUDPR;
 
 
 		//-----------------------------------------------------------------//
@@ -1515,7 +1515,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   GEUPT;
 		};
-		static pgudpr_t<0x000C493C + ofs>  PGUDPR;
+		static IO_SIM_INLINE pgudpr_t<0x000C493C + ofs>  PGUDPR;
 
 
 		//-----------------------------------------------------------------//
@@ -1538,7 +1538,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B16>  EXTPRM;
 		};
-		static ffltr_t<0x000C4940 + ofs>  FFLTR;
+		static IO_SIM_INLINE ffltr_t<0x000C4940 + ofs>  FFLTR;
 
 
 		//-----------------------------------------------------------------//
@@ -1546,7 +1546,7 @@ namespace device {
 			@brief	フレーム受信フィルタ用 MAC アドレス 0 設定レジスタ U (FMAC0RU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4960 + ofs> FMAC0RU;
+		static IO_SIM_INLINE rw32_t<0x000C4960 + ofs> FMAC0RU;
 
 
 		//-----------------------------------------------------------------//
@@ -1554,7 +1554,7 @@ namespace device {
 			@brief	フレーム受信フィルタ用 MAC アドレス 0 設定レジスタ L (FMAC0RL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4964 + ofs> FMAC0RL;
+		static IO_SIM_INLINE rw32_t<0x000C4964 + ofs> FMAC0RL;
 
 
 		//-----------------------------------------------------------------//
@@ -1562,7 +1562,7 @@ namespace device {
 			@brief	フレーム受信フィルタ用 MAC アドレス 1 設定レジスタ U (FMAC1RU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C4968 + ofs> FMAC1RU;
+		static IO_SIM_INLINE rw32_t<0x000C4968 + ofs> FMAC1RU;
 
 
 		//-----------------------------------------------------------------//
@@ -1570,7 +1570,7 @@ namespace device {
 			@brief	フレーム受信フィルタ用 MAC アドレス 1 設定レジスタ L (FMAC1RL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C496C + ofs> FMAC1RL;
+		static IO_SIM_INLINE rw32_t<0x000C496C + ofs> FMAC1RL;
 
 
 		//-----------------------------------------------------------------//
@@ -1578,7 +1578,7 @@ namespace device {
 			@brief	非対称遅延値設定レジスタ U (DASYMRU)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C49C0 + ofs> DASYMRU;
+		static IO_SIM_INLINE rw32_t<0x000C49C0 + ofs> DASYMRU;
 
 
 		//-----------------------------------------------------------------//
@@ -1586,7 +1586,7 @@ namespace device {
 			@brief	非対称遅延値設定レジスタ L (DASYMRL)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C49C4 + ofs> DASYMRL;
+		static IO_SIM_INLINE rw32_t<0x000C49C4 + ofs> DASYMRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1606,7 +1606,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  16>  EGP;
 			bits_rw_t<io_, bitpos::B16, 16>  INGP;
 		};
-		static tslatr_t<0x000C49C8 + ofs>  TSLATR;
+		static IO_SIM_INLINE tslatr_t<0x000C49C8 + ofs>  TSLATR;
 
 
 		//-----------------------------------------------------------------//
@@ -1631,7 +1631,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B20>      TCMOD;
 		};
-		static syconfr_t<0x000C49CC + ofs>  SYCONFR;
+		static IO_SIM_INLINE syconfr_t<0x000C49CC + ofs>  SYCONFR;
 
 
 		//-----------------------------------------------------------------//
@@ -1651,7 +1651,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>   FORM0;
 			bit_rw_t <io_, bitpos::B1>   FORM1;
 		};
-		static syformr_t<0x000C49D0 + ofs>  SYFORMR;
+		static IO_SIM_INLINE syformr_t<0x000C49D0 + ofs>  SYFORMR;
 
 
 		//-----------------------------------------------------------------//
@@ -1659,7 +1659,7 @@ namespace device {
 			@brief	レスポンスメッセージ受信タイムアウトレジスタ (RSTOUTR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C49D4 + ofs> RSTOUTR;
+		static IO_SIM_INLINE rw32_t<0x000C49D4 + ofs> RSTOUTR;
 
 
 		//-----------------------------------------------------------------//
@@ -130,6 +130,8 @@ namespace device {
 		static const uint32_t TXD_NUM = TXDN;	///< 送信バッファ数
 		static const uint32_t RXD_NUM = RXDN;	///< 受信バッファ数
 
+		static_assert(TXDN >= 2 && RXDN >= 2, "ether_io: descriptor number too small.");
+
 	private:
 #ifndef ETHRC_DEBUG
 		typedef utils::null_format debug_format;
@@ -279,6 +281,9 @@ namespace device {
 
 		bool			link_stat_;
 
+		uint8_t			tx_coalesce_;
+		uint8_t			tx_count_;
+
 		ether_stat_t	stat_;
 
 		const uint8_t*	recv_ptr_;
@@ -354,7 +359,16 @@ namespace device {
 				// Sets up interrupt when you use interrupts.
 				// Enable interrupts of interest only.
 				EDMAC::EESIPR.FRIP = 1;
-				EDMAC::EESIPR.TCIP = 1;
+				if(tx_coalesce_ > 0) {
+					// 送信割り込みは TWBI を付けたディスクリプターのライトバック時のみ
+					EDMAC::TRIMD = 0;
+					EDMAC::TRIMD.TIS = 1;
+					EDMAC::TRIMD.TIM = 1;
+					EDMAC::EESIPR.TWBIP = 1;
+				} else {
+					EDMAC::TRIMD = 0;
+					EDMAC::EESIPR.TCIP = 1;
+				}
 	    	}
 
 			// Ethernet length 1514bytes + CRC and intergap is 96-bit time
@@ -368,16 +382,16 @@ namespace device {
     		EDMAC::EDMR.DE = 0;
 #endif
 			{
-				uint32_t a = reinterpret_cast<uint32_t>(&ether_buffers_);
+				uint32_t a = get_address(&ether_buffers_);
 				if(a & 0x1f) {  // 32 bytes aligned test
 					debug_format("Alignd error: Ether buffer adr: %08X\n") % a;
 				}
 			}
-			uint32_t rxa = reinterpret_cast<uint32_t>(app_rx_desc_);
+			uint32_t rxa = get_address(app_rx_desc_);
 			if(rxa & 0x1f) {  // 32 bytes aligned test
 				debug_format("Alignd error: Ether RX adr: %08X\n") % rxa;
 			}
-			uint32_t txa = reinterpret_cast<uint32_t>(app_tx_desc_);
+			uint32_t txa = get_address(app_tx_desc_);
 			if(txa & 0x1f) {  // 32 bytes aligned test
 				debug_format("Alignd error: Ether TX adr: %08X\n") % txa;
 			}
@@ -569,7 +583,7 @@ namespace device {
 
 
 		// EDMA interrupt task
-		static void ether_task_() __attribute__ ((interrupt))
+		static INTERRUPT_FUNC void ether_task_()
 		{
 			uint32_t status_ecsr = ETHRC::ECSR();
 			uint32_t status_eesr = EDMAC::EESR();
@@ -635,7 +649,8 @@ namespace device {
 			intr_level_(0), mac_addr_{ 0 },
 			pause_frame_enable_(false), magic_packet_detect_(magic_packet_mode::no_use),
 			lchng_flag_(FLAG_OFF), transfer_enable_(false),
-			link_stat_(false), stat_(), recv_ptr_(nullptr), recv_mod_(0), err_data_(nullptr)
+			link_stat_(false), tx_coalesce_(0), tx_count_(0),
+			stat_(), recv_ptr_(nullptr), recv_mod_(0), err_data_(nullptr)
 			{ }
 
 
@@ -650,6 +665,22 @@ namespace device {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  送信割り込みの間引き設定 @n
+					※リンク・アップ前に設定する事 @n
+					※送信リングが満杯になる場合は、間引き数に関係なく割り込みを発生
+			@param[in]	num		割り込みを発生させる送信フレーム間隔（０なら毎フレーム）
+		*/
+		//-----------------------------------------------------------------//
+		void set_tx_coalesce(uint8_t num) noexcept
+		{
+			if(num > TXDN) num = TXDN;
+			tx_coalesce_ = num;
+			tx_count_ = 0;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  物理層クラスへの参照
@@ -854,6 +885,10 @@ namespace device {
 				ret = ERROR_MPDE;
 			} else {  // When the Link up processing is completed
 				if(RACT != (app_rx_desc_->status & RACT)) {  // When receive data exists
+					if((app_rx_desc_->status & RFE) == 0) {
+						stat_.recv_request_++;
+						stat_.recv_bytes_ += app_rx_desc_->size;
+					}
 					// Move to next descriptor
 					app_rx_desc_->status |= RACT;
 					app_rx_desc_->status &= ~(RFP1 | RFP0 | RFE | RFS9_RFOVER | RFS8_RAD | RFS7_RMAF |
@@ -919,11 +954,23 @@ namespace device {
 			} else {  // When the Link up processing is completed
 				// The data of the buffer is made active.
 				app_tx_desc_->bufsize = len;
-				app_tx_desc_->status &= ~(TFP1 | TFP0);
-				app_tx_desc_->status |= (TFP1 | TFP0 | TACT);
+				uint32_t st = app_tx_desc_->status & ~(TFP1 | TFP0 | TWBI);
+				st |= TFP1 | TFP0 | TACT;
+				if(tx_coalesce_ > 0) {
+					++tx_count_;
+					// 間隔に達したか、次のディスクリプターが使用中なら割り込みを要求
+					if(tx_count_ >= tx_coalesce_ || (app_tx_desc_->next->status & TACT) != 0) {
+						st |= TWBI;
+						tx_count_ = 0;
+					}
+				}
+				app_tx_desc_->status = st;
 
 				app_tx_desc_ = app_tx_desc_->next;
 
+				stat_.send_request_++;
+				stat_.send_bytes_ += len;
+
 				if(0x00000000L == EDMAC::EDTRR()) {
 					// Restart if stopped
 					EDMAC::EDTRR = 0x00000001L;
@@ -973,8 +1020,6 @@ namespace device {
 					l = len;
 					recv_ptr_ += l;
 				}
-				stat_.recv_request_++;
-				stat_.recv_bytes_ += l;
 				ret = l;
 				memcpy(dst, ptr, l);
 				if(recv_ptr_ == nullptr) {
@@ -1006,8 +1051,6 @@ namespace device {
 					memcpy(static_cast<uint8_t*>(buf) + hlen, bsrc, blen);
 					ret =  send(hlen + blen);
 					if(OK == ret) {
-						stat_.send_request_++;
-						stat_.send_bytes_ += hlen + blen;
 						return 0;
 					}
 				}
@@ -1037,10 +1080,7 @@ namespace device {
 					memcpy(ptr, src, len);
 					ret = len;
 				}
-				if(send(ret) == OK) {
-					stat_.send_request_++;
-					stat_.send_bytes_ += ret;
-				}
+				send(ret);
 			}
 			return ret;
 		}
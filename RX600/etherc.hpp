@@ -54,7 +54,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B19> ZPF;
 			bit_rw_t<io_, bitpos::B20> TPC;
 		};
-		static ecmr_t<base + 0x00> ECMR;
+		static IO_SIM_INLINE ecmr_t<base + 0x00> ECMR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -73,7 +73,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 12> RFL;
 		};
-		static rflr_t<base + 0x08> RFLR;
+		static IO_SIM_INLINE rflr_t<base + 0x08> RFLR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -97,7 +97,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4> PSRTO;
 			bit_rw_t<io_, bitpos::B5> BFR;
 		};
-		static ecsr_t<base + 0x10> ECSR;
+		static IO_SIM_INLINE ecsr_t<base + 0x10> ECSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -121,7 +121,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4> PSRTOIP;
 			bit_rw_t<io_, bitpos::B5> BFSIPR;
 		};
-		static ecsipr_t<base + 0x18> ECSIPR;
+		static IO_SIM_INLINE ecsipr_t<base + 0x18> ECSIPR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -143,7 +143,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2> MDO;
 			bit_rw_t<io_, bitpos::B3> MDI;
 		};
-		static pir_t<base + 0x20> PIR;
+		static IO_SIM_INLINE pir_t<base + 0x20> PIR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -159,7 +159,7 @@ namespace device {
 
 			bit_ro_t<io_, bitpos::B0> LMON;
 		};
-		static psr_t<base + 0x28> PSR;
+		static IO_SIM_INLINE psr_t<base + 0x28> PSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -178,7 +178,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 20> RMD;
 		};
-		static rdmlr_t<base + 0x40> RDMLR;
+		static IO_SIM_INLINE rdmlr_t<base + 0x40> RDMLR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -197,7 +197,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5> IPG;
 		};
-		static ipgr_t<base + 0x50> IPGR;
+		static IO_SIM_INLINE ipgr_t<base + 0x50> IPGR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -216,7 +216,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16> AP;
 		};
-		static apr_t<base + 0x54> APR;
+		static IO_SIM_INLINE apr_t<base + 0x54> APR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -235,7 +235,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16> MP;
 		};
-		static mpr_t<base + 0x58> MPR;
+		static IO_SIM_INLINE mpr_t<base + 0x58> MPR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -251,7 +251,7 @@ namespace device {
 
 			bits_ro_t<io_, bitpos::B0, 8> RPAUSE;
 		};
-		static rfcf_t<base + 0x60> RFCF;
+		static IO_SIM_INLINE rfcf_t<base + 0x60> RFCF;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -270,7 +270,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16> TPAUSE;
 		};
-		static tpauser_t<base + 0x64> TPAUSER;
+		static IO_SIM_INLINE tpauser_t<base + 0x64> TPAUSER;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -286,7 +286,7 @@ namespace device {
 
 			bits_ro_t<io_, bitpos::B0, 8> TXP;
 		};
-		static tpausecr_t<base + 0x68> TPAUSECR;
+		static IO_SIM_INLINE tpausecr_t<base + 0x68> TPAUSECR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -305,7 +305,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16> BCF;
 		};
-		static bcfrr_t<base + 0x6C> BCFRR;
+		static IO_SIM_INLINE bcfrr_t<base + 0x6C> BCFRR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -313,7 +313,7 @@ namespace device {
 			@brief  MAC アドレス上位設定レジスタ（MAHR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xC0> MAHR;
+		static IO_SIM_INLINE rw32_t<base + 0xC0> MAHR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -321,7 +321,7 @@ namespace device {
 			@brief  MAC アドレス下位設定レジスタ（MALR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xC8> MALR;
+		static IO_SIM_INLINE rw32_t<base + 0xC8> MALR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -329,7 +329,7 @@ namespace device {
 			@brief  送信リトライオーバカウンタレジスタ（TROCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xD0> TROCR;
+		static IO_SIM_INLINE rw32_t<base + 0xD0> TROCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -337,7 +337,7 @@ namespace device {
 			@brief  遅延衝突検出カウンタレジスタ（CDCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xD4> CDCR;
+		static IO_SIM_INLINE rw32_t<base + 0xD4> CDCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -345,7 +345,7 @@ namespace device {
 			@brief  キャリア消失カウンタレジスタ（LCCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xD8> LCCR;
+		static IO_SIM_INLINE rw32_t<base + 0xD8> LCCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -353,7 +353,7 @@ namespace device {
 			@brief  キャリア未検出カウンタレジスタ（CNDCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xDC> CNDCR;
+		static IO_SIM_INLINE rw32_t<base + 0xDC> CNDCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -361,7 +361,7 @@ namespace device {
 			@brief  CRC エラーフレーム受信カウンタレジスタ（CEFCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xE4> CEFCR;
+		static IO_SIM_INLINE rw32_t<base + 0xE4> CEFCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -369,7 +369,7 @@ namespace device {
 			@brief  フレーム受信エラーカウンタレジスタ（FRECR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xE8> FRECR;
+		static IO_SIM_INLINE rw32_t<base + 0xE8> FRECR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -377,7 +377,7 @@ namespace device {
 			@brief  ショートフレーム受信カウンタレジスタ（TSFRCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xEC> TSFRCR;
+		static IO_SIM_INLINE rw32_t<base + 0xEC> TSFRCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -385,7 +385,7 @@ namespace device {
 			@brief  ロングフレーム受信カウンタレジスタ（TLFRCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xF0> TLFRCR;
+		static IO_SIM_INLINE rw32_t<base + 0xF0> TLFRCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -393,7 +393,7 @@ namespace device {
 			@brief  端数ビットフレーム受信カウンタレジスタ（RFCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xF4> RFCR;
+		static IO_SIM_INLINE rw32_t<base + 0xF4> RFCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -401,7 +401,7 @@ namespace device {
 			@brief  マルチキャストアドレスフレーム受信カウンタレジスタ（MAFCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0xF8> MAFCR;
+		static IO_SIM_INLINE rw32_t<base + 0xF8> MAFCR;
 
 
 		//-----------------------------------------------------------------//
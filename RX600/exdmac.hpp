@@ -26,7 +26,7 @@ namespace device {
 			@brief  EXDMA 転送元アドレスレジスタ（EDMSAR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x00> EDMSAR;
+		static IO_SIM_INLINE rw32_t<base + 0x00> EDMSAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -34,7 +34,7 @@ namespace device {
 			@brief  EXDMA 転送先アドレスレジスタ（EDMDAR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x04> EDMDAR;
+		static IO_SIM_INLINE rw32_t<base + 0x04> EDMDAR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -42,7 +42,7 @@ namespace device {
 			@brief  EXDMA 転送カウントレジスタ（EDMCRA）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x08> EDMCRA;
+		static IO_SIM_INLINE rw32_t<base + 0x08> EDMCRA;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -50,7 +50,7 @@ namespace device {
 			@brief  EXDMA ブロック転送カウントレジスタ（EDMCRB）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw16_t<base + 0x0C> EDMCRB;
+		static IO_SIM_INLINE rw16_t<base + 0x0C> EDMCRB;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -74,7 +74,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 2> DTS;
 			bits_rw_t<io_, bitpos::B14, 2> MD;
 		};
-		static edmtmd_t<base + 0x10> EDMTMD;
+		static IO_SIM_INLINE edmtmd_t<base + 0x10> EDMTMD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -96,7 +96,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2> DACKE;
 			bit_rw_t<io_, bitpos::B3> DACKS;
 		};
-		static edmomd_t<base + 0x12> EDMOMD;
+		static IO_SIM_INLINE edmomd_t<base + 0x12> EDMOMD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -119,7 +119,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3> ESIE;
 			bit_rw_t<io_, bitpos::B4> DTIE;
 		};
-		static edmint_t<base + 0x13> EDMINT;
+		static IO_SIM_INLINE edmint_t<base + 0x13> EDMINT;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -145,7 +145,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B16>     DIR;
 			bit_rw_t <io_, bitpos::B17>     AMS;
 		};
-		static edmamd_t<base + 0x14> EDMAMD;
+		static IO_SIM_INLINE edmamd_t<base + 0x14> EDMAMD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -164,7 +164,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> DTE;
 		};
-		static edmcnt_t<base + 0x1C> EDMCNT;
+		static IO_SIM_INLINE edmcnt_t<base + 0x1C> EDMCNT;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -184,7 +184,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0> SWREQ;
 			bit_rw_t<io_, bitpos::B4> CLRS;
 		};
-		static edmreq_t<base + 0x1D> EDMREQ;
+		static IO_SIM_INLINE edmreq_t<base + 0x1D> EDMREQ;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -206,7 +206,7 @@ namespace device {
 
 			bit_ro_t<io_, bitpos::B7> ACT;
 		};
-		static edmsts_t<base + 0x1E> EDMSTS;
+		static IO_SIM_INLINE edmsts_t<base + 0x1E> EDMSTS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -225,7 +225,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2> DREQS;
 		};
-		static edmrmd_t<base + 0x20> EDMRMD;
+		static IO_SIM_INLINE edmrmd_t<base + 0x20> EDMRMD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -244,7 +244,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> EREQ;
 		};
-		static edmerf_t<base + 0x21> EDMERF;
+		static IO_SIM_INLINE edmerf_t<base + 0x21> EDMERF;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -263,7 +263,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> PREQ;
 		};
-		static edmprf_t<base + 0x22> EDMPRF;
+		static IO_SIM_INLINE edmprf_t<base + 0x22> EDMPRF;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -282,7 +282,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> DMST;
 		};
-		static edmast_t<0x00082A00> EDMAST;
+		static IO_SIM_INLINE edmast_t<0x00082A00> EDMAST;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -290,14 +290,14 @@ namespace device {
 			@brief  クラスタバッファレジスタ y（CLSBRy）（y = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<0x00082BE0> CLSBR0;
-		static rw32_t<0x00082BE4> CLSBR1;
-		static rw32_t<0x00082BE8> CLSBR2;
-		static rw32_t<0x00082BEC> CLSBR3;
-		static rw32_t<0x00082BF0> CLSBR4;
-		static rw32_t<0x00082BF4> CLSBR5;
-		static rw32_t<0x00082BF8> CLSBR6;
-		static rw32_t<0x00082BFC> CLSBR7;
+		static IO_SIM_INLINE rw32_t<0x00082BE0> CLSBR0;
+		static IO_SIM_INLINE rw32_t<0x00082BE4> CLSBR1;
+		static IO_SIM_INLINE rw32_t<0x00082BE8> CLSBR2;
+		static IO_SIM_INLINE rw32_t<0x00082BEC> CLSBR3;
+		static IO_SIM_INLINE rw32_t<0x00082BF0> CLSBR4;
+		static IO_SIM_INLINE rw32_t<0x00082BF4> CLSBR5;
+		static IO_SIM_INLINE rw32_t<0x00082BF8> CLSBR6;
+		static IO_SIM_INLINE rw32_t<0x00082BFC> CLSBR7;
 	};
 
 
@@ -318,7 +318,7 @@ namespace device {
 			@param[in]	ofs	オフセット
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x18> EDMOFR;
+		static IO_SIM_INLINE rw32_t<base + 0x18> EDMOFR;
 
 
 		//-----------------------------------------------------------------//
@@ -35,7 +35,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2> FLWE;
 		};
-		static fwepror_t<0x0008C296> FWEPROR;
+		static IO_SIM_INLINE fwepror_t<0x0008C296> FWEPROR;
 
 
 		//-----------------------------------------------------------------//
@@ -60,7 +60,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B7>  CFAE;
 
 		};
-		static fastat_t<0x007FE010> FASTAT;
+		static IO_SIM_INLINE fastat_t<0x007FE010> FASTAT;
 
 
 		//-----------------------------------------------------------------//
@@ -86,7 +86,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B7>  CFAEIE;
 
 		};
-		static faeint_t<0x007FE014> FAEINT;
+		static IO_SIM_INLINE faeint_t<0x007FE014> FAEINT;
 
 
 		//-----------------------------------------------------------------//
@@ -105,7 +105,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  FRDYIE;
 		};
-		static frdyie_t<0x007FE018> FRDYIE;
+		static IO_SIM_INLINE frdyie_t<0x007FE018> FRDYIE;
 
 
 		//-----------------------------------------------------------------//
@@ -113,7 +113,7 @@ namespace device {
 			@brief  FACI コマンド処理開始アドレスレジスタ（FSADDR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x007FE030> FSADDR;
+		static IO_SIM_INLINE rw32_t<0x007FE030> FSADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -121,7 +121,7 @@ namespace device {
 			@brief  FACI コマンド処理終了アドレスレジスタ（FEADDR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x007FE034> FEADDR;
+		static IO_SIM_INLINE rw32_t<0x007FE034> FEADDR;
 
 
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N)
@@ -143,7 +143,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B1>     FRAMTRAN;
 			bits_rw_t<io_, bitpos::B8, 8>  KEY;
 		};
-		static fcurame_t<0x007FE054> FCURAME;
+		static IO_SIM_INLINE fcurame_t<0x007FE054> FCURAME;
 #endif
 
 
@@ -180,7 +180,7 @@ namespace device {
 			bit_ro_t <io_, bitpos::B23>  ILGCOMERR;
 #endif
 		};
-		static fstatr_t<0x007FE080> FSTATR;
+		static IO_SIM_INLINE fstatr_t<0x007FE080> FSTATR;
 
 
 		//-----------------------------------------------------------------//
@@ -201,7 +201,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B7>     FENTRYD;
 			bits_rw_t<io_, bitpos::B8, 8>  KEY;
 		};
-		static fentryr_t<0x007FE084> FENTRYR;
+		static IO_SIM_INLINE fentryr_t<0x007FE084> FENTRYR;
 
 
 #if defined(SIG_RX64M) || defined(SIG_RX71M) 
@@ -222,7 +222,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>     FPROTCN;
 			bits_rw_t<io_, bitpos::B8, 8>  KEY;
 		};
-		static fprotr_t<0x007FE088> FPROTR;
+		static IO_SIM_INLINE fprotr_t<0x007FE088> FPROTR;
 #endif
 
 
@@ -243,7 +243,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>     SUINIT;
 			bits_rw_t<io_, bitpos::B8, 8>  KEY;
 		};
-		static fsuinitr_t<0x007FE08C> FSUINITR;
+		static IO_SIM_INLINE fsuinitr_t<0x007FE08C> FSUINITR;
 
 
 #if defined(SIG_RX64M) || defined(SIG_RX71M) 
@@ -263,7 +263,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>  FLOCKST;
 		};
-		static flkstat_t<0x007FE090> FLKSTAT;
+		static IO_SIM_INLINE flkstat_t<0x007FE090> FLKSTAT;
 #endif
 
 
@@ -281,7 +281,7 @@ namespace device {
 			bits_ro_t<io_, bitpos::B0, 8>  PCMDR;
 			bits_ro_t<io_, bitpos::B8, 8>  CMDDR;
 		};
-		static fcmdr_t<0x007FE0A0> FCMDR;
+		static IO_SIM_INLINE fcmdr_t<0x007FE0A0> FCMDR;
 
 
 #if defined(SIG_RX64M) || defined(SIG_RX71M) 
@@ -298,7 +298,7 @@ namespace device {
 
 			bits_ro_t<io_, bitpos::B0, 8>  PEERRST;
 		};
-		static fpestat_t<0x007FE0C0> FPESTAT;
+		static IO_SIM_INLINE fpestat_t<0x007FE0C0> FPESTAT;
 #endif
 
 
@@ -318,7 +318,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  BCDIR;
 		};
-		static fbccnt_t<0x007FE0D0> FBCCNT;
+		static IO_SIM_INLINE fbccnt_t<0x007FE0D0> FBCCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -337,7 +337,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  BCST;
 		};
-		static fbcstat_t<0x007FE0D4> FBCSTAT;
+		static IO_SIM_INLINE fbcstat_t<0x007FE0D4> FBCSTAT;
 
 
 		//-----------------------------------------------------------------//
@@ -353,7 +353,7 @@ namespace device {
 
 			bits_ro_t<io_, bitpos::B0, 19>  PSADR;
 		};
-		static fpsaddr_t<0x007FE0D8> FPSADDR;
+		static IO_SIM_INLINE fpsaddr_t<0x007FE0D8> FPSADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -372,7 +372,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  ESUSPMD;
 		};
-		static fcpsr_t<0x007FE0E0> FCPSR;
+		static IO_SIM_INLINE fcpsr_t<0x007FE0E0> FCPSR;
 
 
 		//-----------------------------------------------------------------//
@@ -392,7 +392,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 8>  PCKA;
 			bits_rw_t<io_, bitpos::B8, 8>  KEY;
 		};
-		static fpckar_t<0x007FE0E4> FPCKAR;
+		static IO_SIM_INLINE fpckar_t<0x007FE0E4> FPCKAR;
 
 
 #if defined(SIG_RX72M)
@@ -412,7 +412,7 @@ namespace device {
 			bits_ro_t<io_, bitpos::B16, 12>  FAWE;
 			bit_ro_t <io_, bitpos::B31>      BTFLG;
 		};
-		static fawmon_t<0x007FE0DC> FAWMON;
+		static IO_SIM_INLINE fawmon_t<0x007FE0DC> FAWMON;
 
 
 		//-----------------------------------------------------------------//
@@ -432,7 +432,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2>  SAS;
 			bits_rw_t<io_, bitpos::B8, 8>  KEY;
 		};
-		static fsuacr_t<0x007FE0E8> FSUACR;
+		static IO_SIM_INLINE fsuacr_t<0x007FE0E8> FSUACR;
 
 
 		//-----------------------------------------------------------------//
@@ -440,7 +440,7 @@ namespace device {
 			@brief  データフラッシュメモリアクセス周波数設定レジスタ (EEPFCLK)
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x007FC040> EEPFCLK;
+		static IO_SIM_INLINE rw8_t<0x007FC040> EEPFCLK;
 #endif
 
 
@@ -451,19 +451,19 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 #if defined(SIG_RX24T)
-		static ro32_t<0x007FC350> UIDR0;
-		static ro32_t<0x007FC354> UIDR1;
-		static ro32_t<0x007FC358> UIDR2;
-		static ro32_t<0x007FC35C> UIDR3;
+		static IO_SIM_INLINE ro32_t<0x007FC350> UIDR0;
+		static IO_SIM_INLINE ro32_t<0x007FC354> UIDR1;
+		static IO_SIM_INLINE ro32_t<0x007FC358> UIDR2;
+		static IO_SIM_INLINE ro32_t<0x007FC35C> UIDR3;
 #elif defined(SIG_RX65N) || defined(SIG_RX72M) || defined(SIG_RX72N)
-		static ro32_t<0xFE7F7D90> UIDR0;
-		static ro32_t<0xFE7F7D94> UIDR1;
-		static ro32_t<0xFE7F7D98> UIDR2;
-		static ro32_t<0xFE7F7D9C> UIDR3;
+		static IO_SIM_INLINE ro32_t<0xFE7F7D90> UIDR0;
+		static IO_SIM_INLINE ro32_t<0xFE7F7D94> UIDR1;
+		static IO_SIM_INLINE ro32_t<0xFE7F7D98> UIDR2;
+		static IO_SIM_INLINE ro32_t<0xFE7F7D9C> UIDR3;
 #elif defined(SIG_RX66T) || defined(SIG_RX72T)
-		static ro32_t<0x007FB174> UIDR0;
-		static ro32_t<0x007FB1E4> UIDR1;
-		static ro32_t<0x007FB1E8> UIDR2;
+		static IO_SIM_INLINE ro32_t<0x007FB174> UIDR0;
+		static IO_SIM_INLINE ro32_t<0x007FB1E4> UIDR1;
+		static IO_SIM_INLINE ro32_t<0x007FB1E8> UIDR2;
 #endif
 	};
 	typedef flash_t FLASH;
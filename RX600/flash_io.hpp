@@ -82,9 +82,9 @@ namespace device {
 		bool	trans_farm_;
 
 		/// FACIコマンド発行領域 007E 0000h 4バイト
-		static rw8_t<0x007E0000> FACI_CMD_AREA;		///< byte 書き込み
+		static IO_SIM_INLINE rw8_t<0x007E0000> FACI_CMD_AREA;		///< byte 書き込み
 
-		static rw16_t<0x007E0000> FACI_CMD_AREA16;	///< word(16) 書き込み
+		static IO_SIM_INLINE rw16_t<0x007E0000> FACI_CMD_AREA16;	///< word(16) 書き込み
 
 		// return 「true」正常、「false」ロック状態
 		// 強制終了コマンド
@@ -49,10 +49,10 @@ namespace device {
 				return *reinterpret_cast<volatile uint32_t*>(ofs + (idx & 0xff));
 			}
 		};
-		static grclut_t<base + 0x0000> GR1CLUT0;
-		static grclut_t<base + 0x0400> GR1CLUT1;
-		static grclut_t<base + 0x0800> GR2CLUT0;
-		static grclut_t<base + 0x0C00> GR2CLUT1;
+		static IO_SIM_INLINE grclut_t<base + 0x0000> GR1CLUT0;
+		static IO_SIM_INLINE grclut_t<base + 0x0400> GR1CLUT1;
+		static IO_SIM_INLINE grclut_t<base + 0x0800> GR2CLUT0;
+		static IO_SIM_INLINE grclut_t<base + 0x0C00> GR2CLUT1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -73,7 +73,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B8>  VEN;
 			bit_rw_t<io_, bitpos::B0>  EN;
 		};
-		static bgen_t<base + 0x1000> BGEN;
+		static IO_SIM_INLINE bgen_t<base + 0x1000> BGEN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -93,7 +93,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  FV;
 			bits_rw_t<io_, bitpos::B0,  11>  FH;
 		};
-		static bgperi_t<base + 0x1004> BGPERI;
+		static IO_SIM_INLINE bgperi_t<base + 0x1004> BGPERI;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -113,7 +113,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 4>  VP;
 			bits_rw_t<io_, bitpos::B0,  4>  HP;
 		};
-		static bgsync_t<base + 0x1008> BGSYNC;
+		static IO_SIM_INLINE bgsync_t<base + 0x1008> BGSYNC;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -133,7 +133,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  VP;
 			bits_rw_t<io_, bitpos::B0,  11>  VW;
 		};
-		static bgvsize_t<base + 0x100C> BGVSIZE;
+		static IO_SIM_INLINE bgvsize_t<base + 0x100C> BGVSIZE;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -153,7 +153,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  HP;
 			bits_rw_t<io_, bitpos::B0,  11>  HW;
 		};
-		static bghsize_t<base + 0x1010> BGHSIZE;
+		static IO_SIM_INLINE bghsize_t<base + 0x1010> BGHSIZE;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -174,7 +174,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  8>  G;
 			bits_rw_t<io_, bitpos::B0,  8>  B;
 		};
-		static bgcolor_t<base + 0x1014> BGCOLOR;
+		static IO_SIM_INLINE bgcolor_t<base + 0x1014> BGCOLOR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -195,7 +195,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B8>  VEN;
 			bit_rw_t<io_, bitpos::B0>  EN;
 		};
-		static bgmon_t<base + 0x1018> BGMON;
+		static IO_SIM_INLINE bgmon_t<base + 0x1018> BGMON;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -214,8 +214,8 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  VEN;
 		};
-		static grnven_t<base + 0x1100> GR1VEN;
-		static grnven_t<base + 0x1200> GR2VEN;
+		static IO_SIM_INLINE grnven_t<base + 0x1100> GR1VEN;
+		static IO_SIM_INLINE grnven_t<base + 0x1200> GR2VEN;
 
 
 
@@ -236,8 +236,8 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  RENB;
 		};
-		static grnflmrd_t<base + 0x1104> GR1FLMRD;
-		static grnflmrd_t<base + 0x1204> GR2FLMRD;
+		static IO_SIM_INLINE grnflmrd_t<base + 0x1104> GR1FLMRD;
+		static IO_SIM_INLINE grnflmrd_t<base + 0x1204> GR2FLMRD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -246,8 +246,8 @@ namespace device {
 			        ※下位６ビットは「０」にする事
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x110C> GR1FLM2;
-		static rw32_t<base + 0x120C> GR2FLM2;
+		static IO_SIM_INLINE rw32_t<base + 0x110C> GR1FLM2;
+		static IO_SIM_INLINE rw32_t<base + 0x120C> GR2FLM2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -266,8 +266,8 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B16, 16>  LNOFF;
 		};
-		static grnflm3_t<base + 0x1110> GR1FLM3;
-		static grnflm3_t<base + 0x1210> GR2FLM3;
+		static IO_SIM_INLINE grnflm3_t<base + 0x1110> GR1FLM3;
+		static IO_SIM_INLINE grnflm3_t<base + 0x1210> GR2FLM3;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -287,8 +287,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  LNNUM;
 			bits_rw_t<io_, bitpos::B0,  16>  DATANUM;
 		};
-		static grnflm5_t<base + 0x1118> GR1FLM5;
-		static grnflm5_t<base + 0x1218> GR2FLM5;
+		static IO_SIM_INLINE grnflm5_t<base + 0x1118> GR1FLM5;
+		static IO_SIM_INLINE grnflm5_t<base + 0x1218> GR2FLM5;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -307,8 +307,8 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B28, 3>  FORMAT;
 		};
-		static grnflm6_t<base + 0x111C> GR1FLM6;
-		static grnflm6_t<base + 0x121C> GR2FLM6;
+		static IO_SIM_INLINE grnflm6_t<base + 0x111C> GR1FLM6;
+		static IO_SIM_INLINE grnflm6_t<base + 0x121C> GR2FLM6;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -330,8 +330,8 @@ namespace device {
 			bit_rw_t<io_,  bitpos::B4>     GRCDISPON;
 			bits_rw_t<io_, bitpos::B0, 2>  DISPSEL;
 		};
-		static grnab1_t<base + 0x1120> GR1AB1;
-		static grnab1_t<base + 0x1220> GR2AB1;
+		static IO_SIM_INLINE grnab1_t<base + 0x1120> GR1AB1;
+		static IO_SIM_INLINE grnab1_t<base + 0x1220> GR2AB1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -351,8 +351,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GRCVS;
 			bits_rw_t<io_, bitpos::B0,  11>  GRCVW;
 		};
-		static grnab2_t<base + 0x1124> GR1AB2;
-		static grnab2_t<base + 0x1224> GR2AB2;
+		static IO_SIM_INLINE grnab2_t<base + 0x1124> GR1AB2;
+		static IO_SIM_INLINE grnab2_t<base + 0x1224> GR2AB2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -372,8 +372,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GRCHS;
 			bits_rw_t<io_, bitpos::B0,  11>  GRCHW;
 		};
-		static grnab3_t<base + 0x1128> GR1AB3;
-		static grnab3_t<base + 0x1228> GR2AB3;
+		static IO_SIM_INLINE grnab3_t<base + 0x1128> GR1AB3;
+		static IO_SIM_INLINE grnab3_t<base + 0x1228> GR2AB3;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -393,8 +393,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  ARCVS;
 			bits_rw_t<io_, bitpos::B0,  11>  ARCVW;
 		};
-		static grnab4_t<base + 0x112C> GR1AB4;
-		static grnab4_t<base + 0x122C> GR2AB4;
+		static IO_SIM_INLINE grnab4_t<base + 0x112C> GR1AB4;
+		static IO_SIM_INLINE grnab4_t<base + 0x122C> GR2AB4;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -414,8 +414,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  ARCHS;
 			bits_rw_t<io_, bitpos::B0,  11>  ARCHW;
 		};
-		static grnab5_t<base + 0x1130> GR1AB5;
-		static grnab5_t<base + 0x1230> GR2AB5;
+		static IO_SIM_INLINE grnab5_t<base + 0x1130> GR1AB5;
+		static IO_SIM_INLINE grnab5_t<base + 0x1230> GR2AB5;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -435,8 +435,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 9>  ARCCOEF;
 			bits_rw_t<io_, bitpos::B0,  8>  ARCRATE;
 		};
-		static grnab6_t<base + 0x1134> GR1AB6;
-		static grnab6_t<base + 0x1234> GR2AB6;
+		static IO_SIM_INLINE grnab6_t<base + 0x1134> GR1AB6;
+		static IO_SIM_INLINE grnab6_t<base + 0x1234> GR2AB6;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -456,8 +456,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 8>  ARCDEF;
 			bit_rw_t <io_, bitpos::B0>      CKON;
 		};
-		static grnab7_t<base + 0x1138> GR1AB7;
-		static grnab7_t<base + 0x1238> GR2AB7;
+		static IO_SIM_INLINE grnab7_t<base + 0x1138> GR1AB7;
+		static IO_SIM_INLINE grnab7_t<base + 0x1238> GR2AB7;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -478,8 +478,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  8>  CKKB;
 			bits_rw_t<io_, bitpos::B0,  8>  CKKR;
 		};
-		static grnab8_t<base + 0x113C> GR1AB8;
-		static grnab8_t<base + 0x123C> GR2AB8;
+		static IO_SIM_INLINE grnab8_t<base + 0x113C> GR1AB8;
+		static IO_SIM_INLINE grnab8_t<base + 0x123C> GR2AB8;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -501,8 +501,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  8>  CKB;
 			bits_rw_t<io_, bitpos::B0,  8>  CKR;
 		};
-		static grnab9_t<base + 0x1140> GR1AB9;
-		static grnab9_t<base + 0x1240> GR2AB9;
+		static IO_SIM_INLINE grnab9_t<base + 0x1140> GR1AB9;
+		static IO_SIM_INLINE grnab9_t<base + 0x1240> GR2AB9;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -523,8 +523,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  8>  B;
 			bits_rw_t<io_, bitpos::B0,  8>  R;
 		};
-		static grnbase_t<base + 0x114C> GR1BASE;
-		static grnbase_t<base + 0x124C> GR2BASE;
+		static IO_SIM_INLINE grnbase_t<base + 0x114C> GR1BASE;
+		static IO_SIM_INLINE grnbase_t<base + 0x124C> GR2BASE;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -544,8 +544,8 @@ namespace device {
 			bit_rw_t <io_, bitpos::B16>     SEL;
 			bits_rw_t<io_, bitpos::B0, 11>  LINE;
 		};
-		static grnclutint_t<base + 0x1150> GR1CLUTINT;
-		static grnclutint_t<base + 0x1250> GR2CLUTINT;
+		static IO_SIM_INLINE grnclutint_t<base + 0x1150> GR1CLUTINT;
+		static IO_SIM_INLINE grnclutint_t<base + 0x1250> GR2CLUTINT;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -565,8 +565,8 @@ namespace device {
 			bit_rw_t<io_, bitpos::B16> UFST;
 			bit_rw_t<io_, bitpos::B0>  ARCST;
 		};
-		static grnmon_t<base + 0x1154> GR1MON;
-		static grnmon_t<base + 0x1254> GR2MON;
+		static IO_SIM_INLINE grnmon_t<base + 0x1154> GR1MON;
+		static IO_SIM_INLINE grnmon_t<base + 0x1254> GR2MON;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -585,9 +585,9 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  VEN;
 		};
-		static gamxven_t<base + 0x1300> GAMGVEN;
-		static gamxven_t<base + 0x1340> GAMBVEN;
-		static gamxven_t<base + 0x1380> GAMRVEN;
+		static IO_SIM_INLINE gamxven_t<base + 0x1300> GAMGVEN;
+		static IO_SIM_INLINE gamxven_t<base + 0x1340> GAMBVEN;
+		static IO_SIM_INLINE gamxven_t<base + 0x1380> GAMRVEN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -606,7 +606,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  GAMON;
 		};
-		static gamsw_t<base + 0x1304> GAMSW;
+		static IO_SIM_INLINE gamsw_t<base + 0x1304> GAMSW;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -626,9 +626,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GGAIN00;
 			bits_rw_t<io_, bitpos::B0,  11>  GGAIN01;
 		};
-		static gamxlut1_t<base + 0x1308> GAMGLUT1;
-		static gamxlut1_t<base + 0x1348> GAMBLUT1;
-		static gamxlut1_t<base + 0x1388> GAMRLUT1;
+		static IO_SIM_INLINE gamxlut1_t<base + 0x1308> GAMGLUT1;
+		static IO_SIM_INLINE gamxlut1_t<base + 0x1348> GAMBLUT1;
+		static IO_SIM_INLINE gamxlut1_t<base + 0x1388> GAMRLUT1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -648,9 +648,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GGAIN02;
 			bits_rw_t<io_, bitpos::B0,  11>  GGAIN03;
 		};
-		static gamxlut2_t<base + 0x130C> GAMGLUT2;
-		static gamxlut2_t<base + 0x134C> GAMBLUT2;
-		static gamxlut2_t<base + 0x138C> GAMRLUT2;
+		static IO_SIM_INLINE gamxlut2_t<base + 0x130C> GAMGLUT2;
+		static IO_SIM_INLINE gamxlut2_t<base + 0x134C> GAMBLUT2;
+		static IO_SIM_INLINE gamxlut2_t<base + 0x138C> GAMRLUT2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -670,9 +670,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GGAIN04;
 			bits_rw_t<io_, bitpos::B0,  11>  GGAIN05;
 		};
-		static gamxlut3_t<base + 0x1310> GAMGLUT3;
-		static gamxlut3_t<base + 0x1350> GAMBLUT3;
-		static gamxlut3_t<base + 0x1390> GAMRLUT3;
+		static IO_SIM_INLINE gamxlut3_t<base + 0x1310> GAMGLUT3;
+		static IO_SIM_INLINE gamxlut3_t<base + 0x1350> GAMBLUT3;
+		static IO_SIM_INLINE gamxlut3_t<base + 0x1390> GAMRLUT3;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -692,9 +692,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GGAIN06;
 			bits_rw_t<io_, bitpos::B0,  11>  GGAIN07;
 		};
-		static gamxlut4_t<base + 0x1314> GAMGLUT4;
-		static gamxlut4_t<base + 0x1354> GAMBLUT4;
-		static gamxlut4_t<base + 0x1394> GAMRLUT4;
+		static IO_SIM_INLINE gamxlut4_t<base + 0x1314> GAMGLUT4;
+		static IO_SIM_INLINE gamxlut4_t<base + 0x1354> GAMBLUT4;
+		static IO_SIM_INLINE gamxlut4_t<base + 0x1394> GAMRLUT4;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -714,9 +714,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GGAIN08;
 			bits_rw_t<io_, bitpos::B0,  11>  GGAIN09;
 		};
-		static gamxlut5_t<base + 0x1318> GAMGLUT5;
-		static gamxlut5_t<base + 0x1358> GAMBLUT5;
-		static gamxlut5_t<base + 0x1398> GAMRLUT5;
+		static IO_SIM_INLINE gamxlut5_t<base + 0x1318> GAMGLUT5;
+		static IO_SIM_INLINE gamxlut5_t<base + 0x1358> GAMBLUT5;
+		static IO_SIM_INLINE gamxlut5_t<base + 0x1398> GAMRLUT5;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -736,9 +736,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GGAIN10;
 			bits_rw_t<io_, bitpos::B0,  11>  GGAIN11;
 		};
-		static gamxlut6_t<base + 0x131C> GAMGLUT6;
-		static gamxlut6_t<base + 0x135C> GAMBLUT6;
-		static gamxlut6_t<base + 0x139C> GAMRLUT6;
+		static IO_SIM_INLINE gamxlut6_t<base + 0x131C> GAMGLUT6;
+		static IO_SIM_INLINE gamxlut6_t<base + 0x135C> GAMBLUT6;
+		static IO_SIM_INLINE gamxlut6_t<base + 0x139C> GAMRLUT6;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -758,9 +758,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GGAIN12;
 			bits_rw_t<io_, bitpos::B0,  11>  GGAIN13;
 		};
-		static gamxlut7_t<base + 0x1320> GAMGLUT7;
-		static gamxlut7_t<base + 0x1360> GAMBLUT7;
-		static gamxlut7_t<base + 0x13A0> GAMRLUT7;
+		static IO_SIM_INLINE gamxlut7_t<base + 0x1320> GAMGLUT7;
+		static IO_SIM_INLINE gamxlut7_t<base + 0x1360> GAMBLUT7;
+		static IO_SIM_INLINE gamxlut7_t<base + 0x13A0> GAMRLUT7;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -780,9 +780,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  GGAIN14;
 			bits_rw_t<io_, bitpos::B0,  11>  GGAIN15;
 		};
-		static gamxlut8_t<base + 0x1320> GAMGLUT8;
-		static gamxlut8_t<base + 0x1360> GAMBLUT8;
-		static gamxlut8_t<base + 0x13A0> GAMRLUT8;
+		static IO_SIM_INLINE gamxlut8_t<base + 0x1320> GAMGLUT8;
+		static IO_SIM_INLINE gamxlut8_t<base + 0x1360> GAMBLUT8;
+		static IO_SIM_INLINE gamxlut8_t<base + 0x13A0> GAMRLUT8;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -803,9 +803,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B10, 10>  TH02;
 			bits_rw_t<io_, bitpos::B0,  10>  TH03;
 		};
-		static gamxarea1_t<base + 0x1328> GAMGAREA1;
-		static gamxarea1_t<base + 0x1368> GAMBAREA1;
-		static gamxarea1_t<base + 0x13A8> GAMRAREA1;
+		static IO_SIM_INLINE gamxarea1_t<base + 0x1328> GAMGAREA1;
+		static IO_SIM_INLINE gamxarea1_t<base + 0x1368> GAMBAREA1;
+		static IO_SIM_INLINE gamxarea1_t<base + 0x13A8> GAMRAREA1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -826,9 +826,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B10, 10>  TH05;
 			bits_rw_t<io_, bitpos::B0,  10>  TH06;
 		};
-		static gamxarea2_t<base + 0x132C> GAMGAREA2;
-		static gamxarea2_t<base + 0x136C> GAMBAREA2;
-		static gamxarea2_t<base + 0x13AC> GAMRAREA2;
+		static IO_SIM_INLINE gamxarea2_t<base + 0x132C> GAMGAREA2;
+		static IO_SIM_INLINE gamxarea2_t<base + 0x136C> GAMBAREA2;
+		static IO_SIM_INLINE gamxarea2_t<base + 0x13AC> GAMRAREA2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -849,9 +849,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B10, 10>  TH08;
 			bits_rw_t<io_, bitpos::B0,  10>  TH09;
 		};
-		static gamxarea3_t<base + 0x1330> GAMGAREA3;
-		static gamxarea3_t<base + 0x1370> GAMBAREA3;
-		static gamxarea3_t<base + 0x13B0> GAMRAREA3;
+		static IO_SIM_INLINE gamxarea3_t<base + 0x1330> GAMGAREA3;
+		static IO_SIM_INLINE gamxarea3_t<base + 0x1370> GAMBAREA3;
+		static IO_SIM_INLINE gamxarea3_t<base + 0x13B0> GAMRAREA3;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -872,9 +872,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B10, 10>  TH11;
 			bits_rw_t<io_, bitpos::B0,  10>  TH12;
 		};
-		static gamxarea4_t<base + 0x1334> GAMGAREA4;
-		static gamxarea4_t<base + 0x1374> GAMBAREA4;
-		static gamxarea4_t<base + 0x13B4> GAMRAREA4;
+		static IO_SIM_INLINE gamxarea4_t<base + 0x1334> GAMGAREA4;
+		static IO_SIM_INLINE gamxarea4_t<base + 0x1374> GAMBAREA4;
+		static IO_SIM_INLINE gamxarea4_t<base + 0x13B4> GAMRAREA4;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -895,9 +895,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B10, 10>  TH14;
 			bits_rw_t<io_, bitpos::B0,  10>  TH15;
 		};
-		static gamxarea5_t<base + 0x1338> GAMGAREA5;
-		static gamxarea5_t<base + 0x1378> GAMBAREA5;
-		static gamxarea5_t<base + 0x13B8> GAMRAREA5;
+		static IO_SIM_INLINE gamxarea5_t<base + 0x1338> GAMGAREA5;
+		static IO_SIM_INLINE gamxarea5_t<base + 0x1378> GAMBAREA5;
+		static IO_SIM_INLINE gamxarea5_t<base + 0x13B8> GAMRAREA5;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -916,7 +916,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  VEN;
 		};
-		static outven_t<base + 0x13C0> OUTVEN;
+		static IO_SIM_INLINE outven_t<base + 0x13C0> OUTVEN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -940,7 +940,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B4>      DIRSEL;
 			bits_rw_t<io_, bitpos::B0,  2>  PHASE;
 		};
-		static outset_t<base + 0x13C4> OUTSET;
+		static IO_SIM_INLINE outset_t<base + 0x13C4> OUTSET;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -959,7 +959,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>  BRTG;
 		};
-		static bright1_t<base + 0x13C8> BRIGHT1;
+		static IO_SIM_INLINE bright1_t<base + 0x13C8> BRIGHT1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -979,7 +979,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 10>  BRTB;
 			bits_rw_t<io_, bitpos::B0,  10>  BRTR;
 		};
-		static bright2_t<base + 0x13CC> BRIGHT2;
+		static IO_SIM_INLINE bright2_t<base + 0x13CC> BRIGHT2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1000,7 +1000,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  8>  CONTB;
 			bits_rw_t<io_, bitpos::B0,  8>  CONTR;
 		};
-		static contrast_t<base + 0x13D0> CONTRAST;
+		static IO_SIM_INLINE contrast_t<base + 0x13D0> CONTRAST;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1024,7 +1024,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4,  2>  PC;
 			bits_rw_t<io_, bitpos::B0,  2>  PD;
 		};
-		static paneldtha_t<base + 0x13D4> PANELDTHA;
+		static IO_SIM_INLINE paneldtha_t<base + 0x13D4> PANELDTHA;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1048,7 +1048,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>  TCON2EDG;
 			bit_rw_t<io_, bitpos::B3>  TCON3EDG;
 		};
-		static clkphase_t<base + 0x13E4> CLKPHASE;
+		static IO_SIM_INLINE clkphase_t<base + 0x13E4> CLKPHASE;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1068,7 +1068,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  HALF;
 			bits_rw_t<io_, bitpos::B0,  11>  OFFSET;
 		};
-		static tcontim_t<base + 0x1404> TCONTIM;
+		static IO_SIM_INLINE tcontim_t<base + 0x1404> TCONTIM;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1088,8 +1088,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  VS;
 			bits_rw_t<io_, bitpos::B0,  11>  VW;
 		};
-		static tconstvy1_t<base + 0x1408> TCONSTVA1;
-		static tconstvy1_t<base + 0x1410> TCONSTVB1;
+		static IO_SIM_INLINE tconstvy1_t<base + 0x1408> TCONSTVA1;
+		static IO_SIM_INLINE tconstvy1_t<base + 0x1410> TCONSTVB1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1109,8 +1109,8 @@ namespace device {
 			bit_rw_t <io_, bitpos::B4>     INV;
 			bits_rw_t<io_, bitpos::B0, 3>  SEL;
 		};
-		static tconstvy2_t<base + 0x140C> TCONSTVA2;
-		static tconstvy2_t<base + 0x1414> TCONSTVB2;
+		static IO_SIM_INLINE tconstvy2_t<base + 0x140C> TCONSTVA2;
+		static IO_SIM_INLINE tconstvy2_t<base + 0x1414> TCONSTVB2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1130,8 +1130,8 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 11>  HS;
 			bits_rw_t<io_, bitpos::B0,  11>  HW;
 		};
-		static tconsthy1_t<base + 0x1418> TCONSTHA1;
-		static tconsthy1_t<base + 0x1420> TCONSTHB1;
+		static IO_SIM_INLINE tconsthy1_t<base + 0x1418> TCONSTHA1;
+		static IO_SIM_INLINE tconsthy1_t<base + 0x1420> TCONSTHB1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1152,8 +1152,8 @@ namespace device {
 			bit_rw_t <io_, bitpos::B4>     INV;
 			bits_rw_t<io_, bitpos::B0, 3>  SEL;
 		};
-		static tconsthy2_t<base + 0x141C> TCONSTHA2;
-		static tconsthy2_t<base + 0x1424> TCONSTHB2;
+		static IO_SIM_INLINE tconsthy2_t<base + 0x141C> TCONSTHA2;
+		static IO_SIM_INLINE tconsthy2_t<base + 0x1424> TCONSTHB2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1172,7 +1172,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  INV;
 		};
-		static tconde_t<base + 0x1428>  TCONDE;
+		static IO_SIM_INLINE tconde_t<base + 0x1428>  TCONDE;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1193,7 +1193,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1>  GR1UFDTC;
 			bit_rw_t<io_, bitpos::B0>  VPOSDTC;
 		};
-		static dtcten_t<base + 0x1440>  DTCTEN;
+		static IO_SIM_INLINE dtcten_t<base + 0x1440>  DTCTEN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1235,7 +1235,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1>  GR1UFCLR;
 			bit_rw_t<io_, bitpos::B0>  VPOSCLR;
 		};
-		static stclr_t<base + 0x1448>  STCLR;
+		static IO_SIM_INLINE stclr_t<base + 0x1448>  STCLR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1253,7 +1253,7 @@ namespace device {
 			bit_ro_t<io_, bitpos::B1>  GR1UF;
 			bit_ro_t<io_, bitpos::B0>  VPOS;
 		};
-		static stmon_t<base + 0x144C>  STMON;
+		static IO_SIM_INLINE stmon_t<base + 0x144C>  STMON;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1275,7 +1275,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>     CLKEN;
 			bits_rw_t<io_, bitpos::B0, 6>  DCDR;
 		};
-		static panelclk_t<base + 0x1450>  PANELCLK;
+		static IO_SIM_INLINE panelclk_t<base + 0x1450>  PANELCLK;
 
 
 		//-----------------------------------------------------------------//
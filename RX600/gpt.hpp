@@ -36,7 +36,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  CST2;
 			bit_rw_t<io_, bitpos::B3>  CST3;
 		};
-		static gtstr_t GTSTR;
+		static IO_SIM_INLINE gtstr_t GTSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -64,7 +64,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 2> NFCS2;
 			bits_rw_t<io_, bitpos::B14, 2> NFCS3;
 		};
-		static nfcr_t NFCR;
+		static IO_SIM_INLINE nfcr_t NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -88,7 +88,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 2> CPHW2;
 			bits_rw_t<io_, bitpos::B14, 2> CPHW3;
 		};
-		static gthscr_t GTHSCR;
+		static IO_SIM_INLINE gthscr_t GTHSCR;
 
 
 		//-----------------------------------------------------------------//
@@ -112,7 +112,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B10>    CCSW2;
 			bit_rw_t< io_, bitpos::B11>    CCSW3;
 		};
-		static gthccr_t GTHCCR;
+		static IO_SIM_INLINE gthccr_t GTHCCR;
 
 
 		//-----------------------------------------------------------------//
@@ -132,7 +132,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  4>  CSHSL2;
 			bits_rw_t<io_, bitpos::B12, 4>  CSHSL3;
 		};
-		static gthssr_t GTHSSR;
+		static IO_SIM_INLINE gthssr_t GTHSSR;
 
 
 		//-----------------------------------------------------------------//
@@ -152,7 +152,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  4>  CSHPL2;
 			bits_rw_t<io_, bitpos::B12, 4>  CSHPL3;
 		};
-		static gthpsr_t GTHPSR;
+		static IO_SIM_INLINE gthpsr_t GTHPSR;
 
 
 		//-----------------------------------------------------------------//
@@ -172,7 +172,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>   WP2;
 			bit_rw_t<io_, bitpos::B3>   WP3;
 		};
-		static gtwp_t GTWP;
+		static IO_SIM_INLINE gtwp_t GTWP;
 
 
 		//-----------------------------------------------------------------//
@@ -192,7 +192,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  2>  SYNC2;
 			bits_rw_t<io_, bitpos::B12, 2>  SYNC3;
 		};
-		static gtsync_t GTSYNC;
+		static IO_SIM_INLINE gtsync_t GTSYNC;
 
 
 		//-----------------------------------------------------------------//
@@ -212,7 +212,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B13, 2>  GTENFCS;
 			bit_rw_t< io_, bitpos::B15>     GTETRGEN;
 		};
-		static gtetint_t GTETINT;
+		static IO_SIM_INLINE gtetint_t GTETINT;
 
 
 		//-----------------------------------------------------------------//
@@ -244,7 +244,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>   BD32;
 			bit_rw_t<io_, bitpos::B15>   BD33;
 		};
-		static gtbdr_t GTBDR;
+		static IO_SIM_INLINE gtbdr_t GTBDR;
 
 
 		//-----------------------------------------------------------------//
@@ -264,7 +264,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  SWP2;
 			bit_rw_t<io_, bitpos::B3>  SWP3;
 		};
-		static gtswp_t GTSWP;
+		static IO_SIM_INLINE gtswp_t GTSWP;
 
 
 		//-----------------------------------------------------------------//
@@ -284,7 +284,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  CWP2;
 			bit_rw_t<io_, bitpos::B3>  CWP3;
 		};
-		static gtcwp_t GTCWP;
+		static IO_SIM_INLINE gtcwp_t GTCWP;
 
 
 		//-----------------------------------------------------------------//
@@ -301,7 +301,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  CMNWP;
 		};
-		static gtcmnwp_t GTCMNWP;
+		static IO_SIM_INLINE gtcmnwp_t GTCMNWP;
 
 
 		//-----------------------------------------------------------------//
@@ -319,7 +319,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  LWA01;
 			bit_rw_t<io_, bitpos::B1>  LWA23;
 		};
-		static gtmdr_t GTMDR;
+		static IO_SIM_INLINE gtmdr_t GTMDR;
 
 
 		//-----------------------------------------------------------------//
@@ -349,7 +349,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B20, 2>  NFCSECC;
 			bits_rw_t<io_, bitpos::B22, 2>  NFCSECD;
 		};
-		static gtecnfcr_t GTECNFCR;
+		static IO_SIM_INLINE gtecnfcr_t GTECNFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -370,7 +370,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 4>  ADSMS1;
 			bit_rw_t< io_, bitpos::B24>     ADSMEN1;
 		};
-		static gtadsmr_t GTADSMR;
+		static IO_SIM_INLINE gtadsmr_t GTADSMR;
 	};
 	typedef gpt_t GPT;
 
@@ -405,7 +405,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>   OBDFLT;
 			bit_rw_t <io_, bitpos::B15>   OBHLD;
 		};
-		static gtior_t GTIOR;
+		static IO_SIM_INLINE gtior_t GTIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -434,7 +434,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B14>   ADTRBUEN;
 			bit_rw_t< io_, bitpos::B15>   ADTRBDEN;
 		};
-		static gtintad_t GTINTAD;
+		static IO_SIM_INLINE gtintad_t GTINTAD;
 
 
 		//-----------------------------------------------------------------//
@@ -453,7 +453,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8, 4>  TPCS;
 			bits_rw_t<io_, bitpos::B12, 2> CCLR;
 		};
-		static gtcr_t GTCR;
+		static IO_SIM_INLINE gtcr_t GTCR;
 
 
 		//-----------------------------------------------------------------//
@@ -477,7 +477,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 2> ADTTB;
 			bit_rw_t< io_, bitpos::B14>    ADTDB;
 		};
-		static gtber_t GTBER;
+		static IO_SIM_INLINE gtber_t GTBER;
 
 
 		//-----------------------------------------------------------------//
@@ -501,7 +501,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B14>    OBDTYF;
 			bit_rw_t< io_, bitpos::B15>    OBDTYR;
 		};
-		static gtudc_t GTUDC;
+		static IO_SIM_INLINE gtudc_t GTUDC;
 
 
 		//-----------------------------------------------------------------//
@@ -527,7 +527,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B12>    ADTAL;
 			bit_rw_t< io_, bitpos::B14>    ADTBL;
 		};
-		static gtitc_t GTITC;
+		static IO_SIM_INLINE gtitc_t GTITC;
 
 
 		//-----------------------------------------------------------------//
@@ -546,7 +546,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B11>   DTEF;
 			bit_rw_t< io_, bitpos::B15>   TUCF;
 		};
-		static gtst_t GTST;
+		static IO_SIM_INLINE gtst_t GTST;
 
 
 		//-----------------------------------------------------------------//
@@ -554,7 +554,7 @@ namespace device {
 			@brief  汎用 PWM タイマカウンタ (GTCNT)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x0E> GTCNT;
+		static IO_SIM_INLINE rw16_t<base + 0x0E> GTCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -562,12 +562,12 @@ namespace device {
 			@brief	汎用 PWM タイマコンペアキャプチャレジスタ m（GTCCRm）（m = A ～ F）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x10> GTCCRA;
-		static rw16_t<base + 0x12> GTCCRB;
-		static rw16_t<base + 0x14> GTCCRC;
-		static rw16_t<base + 0x16> GTCCRD;
-		static rw16_t<base + 0x18> GTCCRE;
-		static rw16_t<base + 0x1A> GTCCRF;
+		static IO_SIM_INLINE rw16_t<base + 0x10> GTCCRA;
+		static IO_SIM_INLINE rw16_t<base + 0x12> GTCCRB;
+		static IO_SIM_INLINE rw16_t<base + 0x14> GTCCRC;
+		static IO_SIM_INLINE rw16_t<base + 0x16> GTCCRD;
+		static IO_SIM_INLINE rw16_t<base + 0x18> GTCCRE;
+		static IO_SIM_INLINE rw16_t<base + 0x1A> GTCCRF;
 
 
 		//-----------------------------------------------------------------//
@@ -575,7 +575,7 @@ namespace device {
 			@brief  汎用 PWM タイマ周期設定レジスタ (GTPR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x1C> GTPR;
+		static IO_SIM_INLINE rw16_t<base + 0x1C> GTPR;
 
 
 		//-----------------------------------------------------------------//
@@ -583,7 +583,7 @@ namespace device {
 			@brief  汎用 PWM タイマ周期設定バッファレジスタ (GTPBR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x1E> GTPBR;
+		static IO_SIM_INLINE rw16_t<base + 0x1E> GTPBR;
 
 
 		//-----------------------------------------------------------------//
@@ -591,7 +591,7 @@ namespace device {
 			@brief  汎用 PWM タイマ周期設定ダブルバッファレジスタ (GTPDBR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x20> GTPDBR;
+		static IO_SIM_INLINE rw16_t<base + 0x20> GTPDBR;
 
 
 		//-----------------------------------------------------------------//
@@ -599,8 +599,8 @@ namespace device {
 			@brief  A/D 変換開始要求タイミングレジスタｍ (GTADTRm)(m=A, B)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x24> GTADTRA;
-		static rw16_t<base + 0x2C> GTADTRB;
+		static IO_SIM_INLINE rw16_t<base + 0x24> GTADTRA;
+		static IO_SIM_INLINE rw16_t<base + 0x2C> GTADTRB;
 
 
 		//-----------------------------------------------------------------//
@@ -608,8 +608,8 @@ namespace device {
 			@brief  A/D 変換開始要求タイミングバッファレジスタｍ (GTADTBRm)(m=A, B)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x26> GTADTBRA;
-		static rw16_t<base + 0x2E> GTADTBRB;
+		static IO_SIM_INLINE rw16_t<base + 0x26> GTADTBRA;
+		static IO_SIM_INLINE rw16_t<base + 0x2E> GTADTBRB;
 
 
 		//-----------------------------------------------------------------//
@@ -617,8 +617,8 @@ namespace device {
 			@brief  A/D 変換開始要求タイミングダブルバッファレジスタｍ (GTADTDBRm)(m=A, B)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x28> GTADTDBRA;
-		static rw16_t<base + 0x30> GTADTDBRB;
+		static IO_SIM_INLINE rw16_t<base + 0x28> GTADTDBRA;
+		static IO_SIM_INLINE rw16_t<base + 0x30> GTADTDBRB;
 
 
 		//-----------------------------------------------------------------//
@@ -645,7 +645,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B14>   OAE;
 			bit_rw_t< io_, bitpos::B15>   OBE;
 		};
-		static gtoncr_t GTONCR;
+		static IO_SIM_INLINE gtoncr_t GTONCR;
 
 
 		//-----------------------------------------------------------------//
@@ -665,7 +665,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B5>  TDBDE;
 			bit_rw_t< io_, bitpos::B8>  TDFER;
 		};
-		static gtdtcr_t GTDTCR;
+		static IO_SIM_INLINE gtdtcr_t GTDTCR;
 
 
 		//-----------------------------------------------------------------//
@@ -673,8 +673,8 @@ namespace device {
 			@brief  汎用 PWM タイマデッドタイム値レジスタｍ (GTDVm)(m=U, D)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x38> GTDVU;
-		static rw16_t<base + 0x3A> GTDVD;
+		static IO_SIM_INLINE rw16_t<base + 0x38> GTDVU;
+		static IO_SIM_INLINE rw16_t<base + 0x3A> GTDVD;
 
 
 		//-----------------------------------------------------------------//
@@ -682,8 +682,8 @@ namespace device {
 			@brief  汎用 PWM タイマデッドタイムバッファレジスタｍ (GTDBm)(m=U, D)
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x3C> GTDBU;
-		static rw16_t<base + 0x3E> GTDBD;
+		static IO_SIM_INLINE rw16_t<base + 0x3C> GTDBU;
+		static IO_SIM_INLINE rw16_t<base + 0x3E> GTDBD;
 
 
 		//-----------------------------------------------------------------//
@@ -700,7 +700,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>  SOS;
 		};
-		static gtsos_t GTSOS;
+		static IO_SIM_INLINE gtsos_t GTSOS;
 
 
 		//-----------------------------------------------------------------//
@@ -717,7 +717,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  SOTR;
 		};
-		static gtsos_t GTSOTR;
+		static IO_SIM_INLINE gtsos_t GTSOTR;
 
 
 		//-----------------------------------------------------------------//
@@ -757,7 +757,7 @@ namespace device {
 			@brief  汎用 PWM タイマロングワードカウンタレジスタ（GTCNTLW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x00> GTCNTLW;
+		static IO_SIM_INLINE rw32_t<base + 0x00> GTCNTLW;
 
 
 		//-----------------------------------------------------------------//
@@ -765,12 +765,12 @@ namespace device {
 			@brief	汎用 PWM タイマロングワードコンペアキャプチャレジスタ m（GTCCRmLW）（m = A ～ F）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x04> GTCCRALW;
-		static rw32_t<base + 0x08> GTCCRBLW;
-		static rw32_t<base + 0x0C> GTCCRCLW;
-		static rw32_t<base + 0x10> GTCCRDLW;
-		static rw32_t<base + 0x14> GTCCRELW;
-		static rw32_t<base + 0x18> GTCCRFLW;
+		static IO_SIM_INLINE rw32_t<base + 0x04> GTCCRALW;
+		static IO_SIM_INLINE rw32_t<base + 0x08> GTCCRBLW;
+		static IO_SIM_INLINE rw32_t<base + 0x0C> GTCCRCLW;
+		static IO_SIM_INLINE rw32_t<base + 0x10> GTCCRDLW;
+		static IO_SIM_INLINE rw32_t<base + 0x14> GTCCRELW;
+		static IO_SIM_INLINE rw32_t<base + 0x18> GTCCRFLW;
 
 
 		//-----------------------------------------------------------------//
@@ -778,7 +778,7 @@ namespace device {
 			@brief  汎用 PWM タイマロングワード周期設定レジスタ（GTPRLW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x1C> GTPRLW;
+		static IO_SIM_INLINE rw32_t<base + 0x1C> GTPRLW;
 
 
 		//-----------------------------------------------------------------//
@@ -786,7 +786,7 @@ namespace device {
 			@brief  汎用 PWM タイマロングワード周期設定バッファレジスタ（GTPBRLW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x20> GTPBRLW;
+		static IO_SIM_INLINE rw32_t<base + 0x20> GTPBRLW;
 
 
 		//-----------------------------------------------------------------//
@@ -794,7 +794,7 @@ namespace device {
 			@brief  汎用 PWM タイマロングワード周期設定ダブルバッファレジスタ（GTPDBRLW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x24> GTPDBRLW;
+		static IO_SIM_INLINE rw32_t<base + 0x24> GTPDBRLW;
 
 
 		//-----------------------------------------------------------------//
@@ -802,8 +802,8 @@ namespace device {
 			@brief  ロングワード A/D 変換開始要求タイミングレジスタ m（GTADTRmLW）（m = A, B）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x28> GTADTRALW;
-		static rw32_t<base + 0x34> GTADTRBLW;
+		static IO_SIM_INLINE rw32_t<base + 0x28> GTADTRALW;
+		static IO_SIM_INLINE rw32_t<base + 0x34> GTADTRBLW;
 
 
 		//-----------------------------------------------------------------//
@@ -811,8 +811,8 @@ namespace device {
 			@brief  ロングワード A/D 変換開始要求タイミングバッファレジスタ m（GTADTBRmLW）（m = A, B）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x2C> GTADTBRALW;
-		static rw32_t<base + 0x38> GTADTBRBLW;
+		static IO_SIM_INLINE rw32_t<base + 0x2C> GTADTBRALW;
+		static IO_SIM_INLINE rw32_t<base + 0x38> GTADTBRBLW;
 
 
 		//-----------------------------------------------------------------//
@@ -820,16 +820,16 @@ namespace device {
 			@brief  ロングワード A/D 変換開始要求タイミングダブルバッファレジスタ m（GTADTDBRmLW）（m = A, B）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x30> GTADTDBRALW;
-		static rw32_t<base + 0x3C> GTADTDBRBLW;
+		static IO_SIM_INLINE rw32_t<base + 0x30> GTADTDBRALW;
+		static IO_SIM_INLINE rw32_t<base + 0x3C> GTADTDBRBLW;
 
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  汎用 PWM タイマロングワードデッドタイム値レジスタ m（GTDVmLW）（m = U, D）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x40> GTDVULW;
-		static rw32_t<base + 0x44> GTDVDLW;
+		static IO_SIM_INLINE rw32_t<base + 0x40> GTDVULW;
+		static IO_SIM_INLINE rw32_t<base + 0x44> GTDVDLW;
 
 
 		//-----------------------------------------------------------------//
@@ -837,8 +837,8 @@ namespace device {
 			@brief  汎用 PWM タイマロングワードデッドタイムバッファレジスタ m（GTDBmLW）（m = U, D）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x48> GTDBULW;
-		static rw32_t<base + 0x4C> GTDBDLW;
+		static IO_SIM_INLINE rw32_t<base + 0x48> GTDBULW;
+		static IO_SIM_INLINE rw32_t<base + 0x4C> GTDBDLW;
 
 	};
 
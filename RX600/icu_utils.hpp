@@ -36,8 +36,8 @@ namespace device {
 				return rd8_(base + idx);
 			}
 
-			volatile uint8_t& operator [] (uint8_t idx) {
-				return *reinterpret_cast<volatile uint8_t*>(base + idx);
+			ref8_type operator [] (uint8_t idx) {
+				return ref8_(base + idx);
 			}
 		};
 
@@ -26,7 +26,7 @@ namespace device {
 			@brief  IWDT リフレッシュレジスタ（IWDTRR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x00> IWDTRR;
+		static IO_SIM_INLINE rw8_t<base + 0x00> IWDTRR;
 
 
 		//-----------------------------------------------------------------//
@@ -48,7 +48,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B12, 2> RPSS;
 		};
-		static iwdtcr_t IWDTCR;
+		static IO_SIM_INLINE iwdtcr_t IWDTCR;
 
 
 		//-----------------------------------------------------------------//
@@ -68,7 +68,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>    UNDFF;
 			bit_rw_t <io_, bitpos::B15>    REFEF;
 		};
-		static iwdtsr_t IWDTSR;
+		static IO_SIM_INLINE iwdtsr_t IWDTSR;
 
 
 		//-----------------------------------------------------------------//
@@ -85,7 +85,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B7>  RSTIRQS;
 		};
-		static iwdtrcr_t IWDTRCR;
+		static IO_SIM_INLINE iwdtrcr_t IWDTRCR;
 
 
 		//-----------------------------------------------------------------//
@@ -102,7 +102,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B7>  SLCSTP;
 		};
-		static iwdtcstpr_t IWDTCSTPR;
+		static IO_SIM_INLINE iwdtcstpr_t IWDTCSTPR;
 	};
 	typedef iwdt_t<0x00088030> IWDT;
 }
@@ -36,7 +36,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2>  LVD1IDTSEL;
 			bit_rw_t <io_, bitpos::B2>     LVD1IRQSEL;
 		};
-		static lvd1cr1_t<0x000800E0>  LVD1CR1;
+		static IO_SIM_INLINE lvd1cr1_t<0x000800E0>  LVD1CR1;
 
 
 		//-----------------------------------------------------------------//
@@ -56,7 +56,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>   LVD1DET;
 			bit_ro_t <io_, bitpos::B1>   LVD1MON;
 		};
-		static lvd1sr_t<0x000800E1>  LVD1SR;
+		static IO_SIM_INLINE lvd1sr_t<0x000800E1>  LVD1SR;
 
 
 		//-----------------------------------------------------------------//
@@ -76,7 +76,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2>  LVD2IDTSEL;
 			bit_rw_t <io_, bitpos::B2>     LVD2IRQSEL;
 		};
-		static lvd2cr1_t<0x000800E2>  LVD2CR1;
+		static IO_SIM_INLINE lvd2cr1_t<0x000800E2>  LVD2CR1;
 
 
 		//-----------------------------------------------------------------//
@@ -96,7 +96,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>   LVD2DET;
 			bit_ro_t <io_, bitpos::B1>   LVD2MON;
 		};
-		static lvd2sr_t<0x000800E3>  LVD2SR;
+		static IO_SIM_INLINE lvd2sr_t<0x000800E3>  LVD2SR;
 
 
 		//-----------------------------------------------------------------//
@@ -116,7 +116,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5>   LVD1E;
 			bit_rw_t<io_, bitpos::B6>   LVD2E;
 		};
-		static lvcmpcr_t<0x0008C297>  LVCMPCR;
+		static IO_SIM_INLINE lvcmpcr_t<0x0008C297>  LVCMPCR;
 
 
 		//-----------------------------------------------------------------//
@@ -140,7 +140,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 4>   LVD2LVL;
 #endif
 		};
-		static lvdlvlr_t<0x0008C298>  LVDLVLR;
+		static IO_SIM_INLINE lvdlvlr_t<0x0008C298>  LVDLVLR;
 
 
 		//-----------------------------------------------------------------//
@@ -169,7 +169,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>     LVD1RI;
 			bit_rw_t <io_, bitpos::B7>     LVD1RN;
 		};
-		static lvd1cr0_t<0x0008C29A>  LVD1CR0;
+		static IO_SIM_INLINE lvd1cr0_t<0x0008C29A>  LVD1CR0;
 
 
 		//-----------------------------------------------------------------//
@@ -198,7 +198,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>     LVD2RI;
 			bit_rw_t <io_, bitpos::B7>     LVD2RN;
 		};
-		static lvd2cr0_t<0x0008C29B>  LVD2CR0;
+		static IO_SIM_INLINE lvd2cr0_t<0x0008C29B>  LVD2CR0;
 	};
 	typedef lvda_t LVDA;
 }
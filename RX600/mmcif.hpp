@@ -54,7 +54,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B24, 6>  CMD;
 			bit_rw_t <io_, bitpos::B30>     BOOT;
 		};
-		static cecmdset_t<0x00088500> CECMDSET;
+		static IO_SIM_INLINE cecmdset_t<0x00088500> CECMDSET;
 
 
 		//-----------------------------------------------------------------//
@@ -62,7 +62,7 @@ namespace device {
 			@brief  アーギュメントレジスタ（ CEARG ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x00088508>  CEARG;
+		static IO_SIM_INLINE rw32_t<0x00088508>  CEARG;
 
 
 		//-----------------------------------------------------------------//
@@ -70,7 +70,7 @@ namespace device {
 			@brief  自動 CMD12 アーギュメントレジスタ（ CEARGCMD12 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x0008850C>  CEARGCMD12;
+		static IO_SIM_INLINE rw32_t<0x0008850C>  CEARGCMD12;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -88,7 +88,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B3>  BREAK;
 		};
-		static cecmdctrl_t<0x00088510> CECMDCTRL;
+		static IO_SIM_INLINE cecmdctrl_t<0x00088510> CECMDCTRL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -107,7 +107,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  16>  BLKSIZ;
 			bits_rw_t<io_, bitpos::B16, 16>  BLKCNT;
 		};
-		static ceblockset_t<0x00088514> CEBLOCKSET;
+		static IO_SIM_INLINE ceblockset_t<0x00088514> CEBLOCKSET;
 
 
 
@@ -36,7 +36,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> PFSWE;
 			bit_rw_t<io_, bitpos::B7> B0WI;
 		};
-		static pwpr_t<0x0008C11F> PWPR;
+		static IO_SIM_INLINE pwpr_t<0x0008C11F> PWPR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -135,12 +135,12 @@ namespace device {
 			@brief  P0n 端子機能制御レジスタ（P0nPFS）（n = 0 ～ 3, 5, 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C140> P00PFS;
-		static pfsx_t<0x0008C141> P01PFS;
-		static pfsx_t<0x0008C142> P02PFS;
-		static pfsx_t<0x0008C143> P03PFS;
-		static pfsx_t<0x0008C145> P05PFS;
-		static pfsx_t<0x0008C147> P07PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C140> P00PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C141> P01PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C142> P02PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C143> P03PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C145> P05PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C147> P07PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -148,14 +148,14 @@ namespace device {
 			@brief  P1n 端子機能制御レジスタ（P1nPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C148> P10PFS;
-		static pfsy_t<0x0008C149> P11PFS;
-		static pfsy_t<0x0008C14A> P12PFS;
-		static pfsy_t<0x0008C14B> P13PFS;
-		static pfsy_t<0x0008C14C> P14PFS;
-		static pfsy_t<0x0008C14D> P15PFS;
-		static pfsy_t<0x0008C14E> P16PFS;
-		static pfsy_t<0x0008C14F> P17PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C148> P10PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C149> P11PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C14A> P12PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C14B> P13PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C14C> P14PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C14D> P15PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C14E> P16PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C14F> P17PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -163,14 +163,14 @@ namespace device {
 			@brief  P2n 端子機能制御レジスタ（P2nPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C150> P20PFS;
-		static pfsy_t<0x0008C151> P21PFS;
-		static pfsy_t<0x0008C152> P22PFS;
-		static pfsy_t<0x0008C153> P23PFS;
-		static pfsy_t<0x0008C154> P24PFS;
-		static pfsy_t<0x0008C155> P25PFS;
-		static pfsy_t<0x0008C156> P26PFS;
-		static pfsy_t<0x0008C157> P27PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C150> P20PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C151> P21PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C152> P22PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C153> P23PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C154> P24PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C155> P25PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C156> P26PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C157> P27PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -178,11 +178,11 @@ namespace device {
 			@brief  P3n 端子機能制御レジスタ（P3nPFS）（n = 0 ～ 4）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C158> P30PFS;
-		static pfsy_t<0x0008C159> P31PFS;
-		static pfsy_t<0x0008C15A> P32PFS;
-		static pfsy_t<0x0008C15B> P33PFS;
-		static pfsy_t<0x0008C15C> P34PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C158> P30PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C159> P31PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C15A> P32PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C15B> P33PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C15C> P34PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -190,14 +190,14 @@ namespace device {
 			@brief  P4n 端子機能制御レジスタ（P4nPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsz_t<0x0008C160> P40PFS;
-		static pfsz_t<0x0008C161> P41PFS;
-		static pfsz_t<0x0008C162> P42PFS;
-		static pfsz_t<0x0008C163> P43PFS;
-		static pfsz_t<0x0008C164> P44PFS;
-		static pfsz_t<0x0008C165> P45PFS;
-		static pfsz_t<0x0008C166> P46PFS;
-		static pfsz_t<0x0008C167> P47PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C160> P40PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C161> P41PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C162> P42PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C163> P43PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C164> P44PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C165> P45PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C166> P46PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C167> P47PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -205,13 +205,13 @@ namespace device {
 			@brief  P5n 端子機能制御レジスタ（P5nPFS）（n = 0 ～ 2, 4 ～ 6）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C168> P50PFS;
-		static pfsy_t<0x0008C169> P51PFS;
-		static pfsy_t<0x0008C16A> P52PFS;
-		static pfsy_t<0x0008C16C> P54PFS;
-		static pfsy_t<0x0008C16D> P55PFS;
-		static pfsy_t<0x0008C16E> P56PFS;
-		static pfsy_t<0x0008C16F> P57PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C168> P50PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C169> P51PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C16A> P52PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C16C> P54PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C16D> P55PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C16E> P56PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C16F> P57PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -220,16 +220,16 @@ namespace device {
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N)
-		static pfsy_t<0x0008C170> P60PFS;
-		static pfsy_t<0x0008C176> P66PFS;
-		static pfsy_t<0x0008C177> P67PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C170> P60PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C176> P66PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C177> P67PFS;
 #elif defined(SIG_RX66T)
-		static pfsz_t<0x0008C170> P60PFS;
-		static pfsz_t<0x0008C171> P61PFS;
-		static pfsz_t<0x0008C172> P62PFS;
-		static pfsz_t<0x0008C173> P63PFS;
-		static pfsz_t<0x0008C174> P64PFS;
-		static pfsz_t<0x0008C175> P65PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C170> P60PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C171> P61PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C172> P62PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C173> P63PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C174> P64PFS;
+		static IO_SIM_INLINE pfsz_t<0x0008C175> P65PFS;
 #endif
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -237,13 +237,13 @@ namespace device {
 			@brief  P7n 端子機能制御レジスタ（P7nPFS）（n = 1 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsw_t<0x0008C179> P71PFS;
-		static pfsw_t<0x0008C17A> P72PFS;
-		static pfsw_t<0x0008C17B> P73PFS;
-		static pfsw_t<0x0008C17C> P74PFS;
-		static pfsw_t<0x0008C17D> P75PFS;
-		static pfsw_t<0x0008C17E> P76PFS;
-		static pfsw_t<0x0008C17F> P77PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C179> P71PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C17A> P72PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C17B> P73PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C17C> P74PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C17D> P75PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C17E> P76PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C17F> P77PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -251,14 +251,14 @@ namespace device {
 			@brief  P8n 端子機能制御レジスタ（P8nPFS）（n = 0 ～ 3, 6, 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsw_t<0x0008C180> P80PFS;
-		static pfsw_t<0x0008C181> P81PFS;
-		static pfsw_t<0x0008C182> P82PFS;
-		static pfsw_t<0x0008C183> P83PFS;
-		static pfsw_t<0x0008C184> P84PFS;
-		static pfsw_t<0x0008C185> P85PFS;
-		static pfsw_t<0x0008C186> P86PFS;
-		static pfsw_t<0x0008C187> P87PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C180> P80PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C181> P81PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C182> P82PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C183> P83PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C184> P84PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C185> P85PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C186> P86PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C187> P87PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -266,14 +266,14 @@ namespace device {
 			@brief  P9n 端子機能制御レジスタ（P9nPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsm_t<0x0008C188> P90PFS;
-		static pfsm_t<0x0008C189> P91PFS;
-		static pfsm_t<0x0008C18A> P92PFS;
-		static pfsm_t<0x0008C18B> P93PFS;
-		static pfsm_t<0x0008C18C> P94PFS;
-		static pfsm_t<0x0008C18D> P95PFS;
-		static pfsm_t<0x0008C18E> P96PFS;
-		static pfsm_t<0x0008C18F> P97PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C188> P90PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C189> P91PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C18A> P92PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C18B> P93PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C18C> P94PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C18D> P95PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C18E> P96PFS;
+		static IO_SIM_INLINE pfsm_t<0x0008C18F> P97PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -281,14 +281,14 @@ namespace device {
 			@brief  PAn 端子機能制御レジスタ（PAnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C190> PA0PFS;
-		static pfsy_t<0x0008C191> PA1PFS;
-		static pfsy_t<0x0008C192> PA2PFS;
-		static pfsy_t<0x0008C193> PA3PFS;
-		static pfsy_t<0x0008C194> PA4PFS;
-		static pfsy_t<0x0008C195> PA5PFS;
-		static pfsy_t<0x0008C196> PA6PFS;
-		static pfsy_t<0x0008C197> PA7PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C190> PA0PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C191> PA1PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C192> PA2PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C193> PA3PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C194> PA4PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C195> PA5PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C196> PA6PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C197> PA7PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -296,14 +296,14 @@ namespace device {
 			@brief  PBn 端子機能制御レジスタ（PBnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C198> PB0PFS;
-		static pfsy_t<0x0008C199> PB1PFS;
-		static pfsy_t<0x0008C19A> PB2PFS;
-		static pfsy_t<0x0008C19B> PB3PFS;
-		static pfsy_t<0x0008C19C> PB4PFS;
-		static pfsy_t<0x0008C19D> PB5PFS;
-		static pfsy_t<0x0008C19E> PB6PFS;
-		static pfsy_t<0x0008C19F> PB7PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C198> PB0PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C199> PB1PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C19A> PB2PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C19B> PB3PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C19C> PB4PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C19D> PB5PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C19E> PB6PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C19F> PB7PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -311,14 +311,14 @@ namespace device {
 			@brief  PCn 端子機能制御レジスタ（PCnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C1A0> PC0PFS;
-		static pfsy_t<0x0008C1A1> PC1PFS;
-		static pfsy_t<0x0008C1A2> PC2PFS;
-		static pfsy_t<0x0008C1A3> PC3PFS;
-		static pfsy_t<0x0008C1A4> PC4PFS;
-		static pfsy_t<0x0008C1A5> PC5PFS;
-		static pfsy_t<0x0008C1A6> PC6PFS;
-		static pfsy_t<0x0008C1A7> PC7PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1A0> PC0PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1A1> PC1PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1A2> PC2PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1A3> PC3PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1A4> PC4PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1A5> PC5PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1A6> PC6PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1A7> PC7PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -326,14 +326,14 @@ namespace device {
 			@brief  PDn 端子機能制御レジスタ（PDnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C1A8> PD0PFS;
-		static pfsx_t<0x0008C1A9> PD1PFS;
-		static pfsx_t<0x0008C1AA> PD2PFS;
-		static pfsx_t<0x0008C1AB> PD3PFS;
-		static pfsx_t<0x0008C1AC> PD4PFS;
-		static pfsx_t<0x0008C1AD> PD5PFS;
-		static pfsx_t<0x0008C1AE> PD6PFS;
-		static pfsx_t<0x0008C1AF> PD7PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1A8> PD0PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1A9> PD1PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AA> PD2PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AB> PD3PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AC> PD4PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AD> PD5PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AE> PD6PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1AF> PD7PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -341,14 +341,14 @@ namespace device {
 			@brief  PEn 端子機能制御レジスタ（PEnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsx_t<0x0008C1B0> PE0PFS;
-		static pfsx_t<0x0008C1B1> PE1PFS;
-		static pfsx_t<0x0008C1B2> PE2PFS;
-		static pfsx_t<0x0008C1B3> PE3PFS;
-		static pfsx_t<0x0008C1B4> PE4PFS;
-		static pfsx_t<0x0008C1B5> PE5PFS;
-		static pfsx_t<0x0008C1B6> PE6PFS;
-		static pfsx_t<0x0008C1B7> PE7PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B0> PE0PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B1> PE1PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B2> PE2PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B3> PE3PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B4> PE4PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B5> PE5PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B6> PE6PFS;
+		static IO_SIM_INLINE pfsx_t<0x0008C1B7> PE7PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -356,12 +356,12 @@ namespace device {
 			@brief  PFn 端子機能制御レジスタ（PFnPFS）（n = 0 ～ 2）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsy_t<0x0008C1B8> PF0PFS;
-		static pfsy_t<0x0008C1B9> PF1PFS;
-		static pfsy_t<0x0008C1BA> PF2PFS;
-		static pfsy_t<0x0008C1BB> PF3PFS;
-		static pfsy_t<0x0008C1BC> PF4PFS;
-		static pfsy_t<0x0008C1BD> PF5PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1B8> PF0PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1B9> PF1PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1BA> PF2PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1BB> PF3PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1BC> PF4PFS;
+		static IO_SIM_INLINE pfsy_t<0x0008C1BD> PF5PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -369,14 +369,14 @@ namespace device {
 			@brief  PGn 端子機能制御レジスタ（PGnPFS）（n = 0 ～ 7）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsw_t<0x0008C1C0> PG0PFS;
-		static pfsw_t<0x0008C1C1> PG1PFS;
-		static pfsw_t<0x0008C1C2> PG2PFS;
-		static pfsw_t<0x0008C1C3> PG3PFS;
-		static pfsw_t<0x0008C1C4> PG4PFS;
-		static pfsw_t<0x0008C1C5> PG5PFS;
-		static pfsw_t<0x0008C1C6> PG6PFS;
-		static pfsw_t<0x0008C1C7> PG7PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1C0> PG0PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1C1> PG1PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1C2> PG2PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1C3> PG3PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1C4> PG4PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1C5> PG5PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1C6> PG6PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1C7> PG7PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -384,8 +384,8 @@ namespace device {
 			@brief  PJn 端子機能制御レジスタ（PJnPFS）（n = 3, 5）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pfsw_t<0x0008C1D3> PJ3PFS;
-		static pfsw_t<0x0008C1D5> PJ5PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1D3> PJ3PFS;
+		static IO_SIM_INLINE pfsw_t<0x0008C1D5> PJ5PFS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -410,7 +410,7 @@ namespace device {
 			bit_rw_t<io, bitpos::B6>  CS6E;
 			bit_rw_t<io, bitpos::B7>  CS7E;
 		};
-		static pfcse_t<0x0008C100> PFCSE;
+		static IO_SIM_INLINE pfcse_t<0x0008C100> PFCSE;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -431,7 +431,7 @@ namespace device {
 			bits_rw_t<io, bitpos::B4, 2>  CS2S;
 			bits_rw_t<io, bitpos::B6, 2>  CS3S;
 		};
-		static pfcss0_t<0x0008C102> PFCSS0;
+		static IO_SIM_INLINE pfcss0_t<0x0008C102> PFCSS0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -452,7 +452,7 @@ namespace device {
 			bits_rw_t<io, bitpos::B4, 2>  CS6S;
 			bits_rw_t<io, bitpos::B6, 2>  CS7S;
 		};
-		static pfcss1_t<0x0008C103> PFCSS1;
+		static IO_SIM_INLINE pfcss1_t<0x0008C103> PFCSS1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -477,7 +477,7 @@ namespace device {
 			bit_rw_t<io, bitpos::B6>  A14E;
 			bit_rw_t<io, bitpos::B7>  A15E;
 		};
-		static pfaoe0_t<0x0008C104> PFAOE0;
+		static IO_SIM_INLINE pfaoe0_t<0x0008C104> PFAOE0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -502,7 +502,7 @@ namespace device {
 			bit_rw_t<io, bitpos::B6>  A22E;
 			bit_rw_t<io, bitpos::B7>  A23E;
 		};
-		static pfaoe0_t<0x0008C105> PFAOE1;
+		static IO_SIM_INLINE pfaoe0_t<0x0008C105> PFAOE1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -527,7 +527,7 @@ namespace device {
 			bit_rw_t<io, bitpos::B6>  WR1BC1E;
 			bit_rw_t<io, bitpos::B7>  WR32BC32E;
 		};
-		static pfbcr0_t<0x0008C106> PFBCR0;
+		static IO_SIM_INLINE pfbcr0_t<0x0008C106> PFBCR0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -550,7 +550,7 @@ namespace device {
 			bit_rw_t <io, bitpos::B6>     DQM1E;
 			bit_rw_t <io, bitpos::B7>     SDCLKE;
 		};
-		static pfbcr1_t<0x0008C107> PFBCR1;
+		static IO_SIM_INLINE pfbcr1_t<0x0008C107> PFBCR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -569,7 +569,7 @@ namespace device {
 			bit_rw_t<io, bitpos::B4>  PHYMODE0;
 			bit_rw_t<io, bitpos::B5>  PHYMODE1;
 		};
-		static pfenet_t<0x0008C10E> PFENET;
+		static IO_SIM_INLINE pfenet_t<0x0008C10E> PFENET;
 
 	};
 	typedef mpc_t MPC;
@@ -35,14 +35,14 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B4, 28> RSPN;
 		};
-		static rspage_t<0x00086400> RSPAGE0;
-		static rspage_t<0x00086408> RSPAGE1;
-		static rspage_t<0x00086410> RSPAGE2;
-		static rspage_t<0x00086418> RSPAGE3;
-		static rspage_t<0x00086420> RSPAGE4;
-		static rspage_t<0x00086428> RSPAGE5;
-		static rspage_t<0x00086430> RSPAGE6;
-		static rspage_t<0x00086438> RSPAGE7;
+		static IO_SIM_INLINE rspage_t<0x00086400> RSPAGE0;
+		static IO_SIM_INLINE rspage_t<0x00086408> RSPAGE1;
+		static IO_SIM_INLINE rspage_t<0x00086410> RSPAGE2;
+		static IO_SIM_INLINE rspage_t<0x00086418> RSPAGE3;
+		static IO_SIM_INLINE rspage_t<0x00086420> RSPAGE4;
+		static IO_SIM_INLINE rspage_t<0x00086428> RSPAGE5;
+		static IO_SIM_INLINE rspage_t<0x00086430> RSPAGE6;
+		static IO_SIM_INLINE rspage_t<0x00086438> RSPAGE7;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -63,14 +63,14 @@ namespace device {
 			bits_rw_t<io_, bitpos::B1, 3>   UAC;
 			bits_rw_t<io_, bitpos::B4, 28>  REPN;
 		};
-		static repage_t<0x00086404> REPAGE0;
-		static repage_t<0x0008640C> REPAGE1;
-		static repage_t<0x00086414> REPAGE2;
-		static repage_t<0x0008641C> REPAGE3;
-		static repage_t<0x00086424> REPAGE4;
-		static repage_t<0x0008642C> REPAGE5;
-		static repage_t<0x00086434> REPAGE6;
-		static repage_t<0x0008643C> REPAGE7;
+		static IO_SIM_INLINE repage_t<0x00086404> REPAGE0;
+		static IO_SIM_INLINE repage_t<0x0008640C> REPAGE1;
+		static IO_SIM_INLINE repage_t<0x00086414> REPAGE2;
+		static IO_SIM_INLINE repage_t<0x0008641C> REPAGE3;
+		static IO_SIM_INLINE repage_t<0x00086424> REPAGE4;
+		static IO_SIM_INLINE repage_t<0x0008642C> REPAGE5;
+		static IO_SIM_INLINE repage_t<0x00086434> REPAGE6;
+		static IO_SIM_INLINE repage_t<0x0008643C> REPAGE7;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -89,7 +89,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  MPEN;
 		};
-		static mpen_t<0x00086500> MPEN;
+		static IO_SIM_INLINE mpen_t<0x00086500> MPEN;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -108,7 +108,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B1, 3>  UBAC;
 		};
-		static mpbac_t<0x00086504> MPBAC;
+		static IO_SIM_INLINE mpbac_t<0x00086504> MPBAC;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -127,7 +127,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>   CLR;
 		};
-		static mpeclr_t<0x00086508> MPECLR;
+		static IO_SIM_INLINE mpeclr_t<0x00086508> MPECLR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -145,7 +145,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1>  DMPER;
 			bit_rw_t<io_, bitpos::B2>  DRW;
 		};
-		static mpests_t<0x0008650C> MPESTS;
+		static IO_SIM_INLINE mpests_t<0x0008650C> MPESTS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -161,7 +161,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 32>  DEA;
 		};
-		static mpdea_t<0x00086514> MPEDEA;
+		static IO_SIM_INLINE mpdea_t<0x00086514> MPEDEA;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -180,7 +180,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 32>  SA;
 		};
-		static mpsa_t<0x00086520> MPSA;
+		static IO_SIM_INLINE mpsa_t<0x00086520> MPSA;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -199,7 +199,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  S;
 		};
-		static mpops_t<0x00086524> MPOPS;
+		static IO_SIM_INLINE mpops_t<0x00086524> MPOPS;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -218,7 +218,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  INV;
 		};
-		static mpopi_t<0x00086526> MPOPI;
+		static IO_SIM_INLINE mpopi_t<0x00086526> MPOPI;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -238,7 +238,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B1,  3>  UHACI;
 			bits_rw_t<io_, bitpos::B16, 8>  HITI;
 		};
-		static mhiti_t<0x00086528> MHIHI;
+		static IO_SIM_INLINE mhiti_t<0x00086528> MHIHI;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -258,7 +258,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B1,  3>  UHACD;
 			bits_rw_t<io_, bitpos::B16, 8>  HITD;
 		};
-		static mhitd_t<0x00086528> MHITD;
+		static IO_SIM_INLINE mhitd_t<0x00086528> MHITD;
 	};
 	typedef mpu_t MPU;
 }
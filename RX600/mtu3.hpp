@@ -158,7 +158,7 @@ namespace device {
 			@brief  タイマモードレジスタ 2（TMDR2A）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr_t<0x000C1270> TMDR2A;
+		static IO_SIM_INLINE tmdr_t<0x000C1270> TMDR2A;
 
 
 		//-----------------------------------------------------------------//
@@ -166,7 +166,7 @@ namespace device {
 			@brief  タイマモードレジスタ 2（TMDR2B）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr_t<0x000C1A70> TMDR2B;
+		static IO_SIM_INLINE tmdr_t<0x000C1A70> TMDR2B;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -381,7 +381,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> CST3;
 			bit_rw_t<io_, bitpos::B7> CST4;
 		};
-		static tstra_t<0x000C1280> TSTRA;
+		static IO_SIM_INLINE tstra_t<0x000C1280> TSTRA;
 
 
 		//-----------------------------------------------------------------//
@@ -401,7 +401,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> CST6;
 			bit_rw_t<io_, bitpos::B7> CST7;
 		};
-		static tstrb_t<0x000C1A80> TSTRB;
+		static IO_SIM_INLINE tstrb_t<0x000C1A80> TSTRB;
 
 
 		//-----------------------------------------------------------------//
@@ -422,7 +422,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1> CSV5;
 			bit_rw_t<io_, bitpos::B2> CSU5;
 		};
-		static tstr_t<0x000C1CB4> TSTR;
+		static IO_SIM_INLINE tstr_t<0x000C1CB4> TSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -447,7 +447,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> SYNC3;
 			bit_rw_t<io_, bitpos::B7> SYNC4;
 		};
-		static tsyra_t<0x000C1281> TSYRA;
+		static IO_SIM_INLINE tsyra_t<0x000C1281> TSYRA;
 
 
 		//-----------------------------------------------------------------//
@@ -467,7 +467,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> SYNC6;
 			bit_rw_t<io_, bitpos::B7> SYNC7;
 		};
-		static tsyrb_t<0x000C1A81> TSYRB;
+		static IO_SIM_INLINE tsyrb_t<0x000C1A81> TSYRB;
 
 
 		//-----------------------------------------------------------------//
@@ -493,7 +493,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> SCH1;
 			bit_rw_t<io_, bitpos::B7> SCH0;
 		};
-		static tcsystr_t<0x000C1282> TCSYSTR;
+		static IO_SIM_INLINE tcsystr_t<0x000C1282> TCSYSTR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -519,7 +519,7 @@ namespace device {
 			@brief	タイマリードライトイネーブルレジスタ（TRWERA）
 		*/
 		//-----------------------------------------------------------------//
-		static trwer_t<0x000C1284> TRWERA;
+		static IO_SIM_INLINE trwer_t<0x000C1284> TRWERA;
 
 
 		//-----------------------------------------------------------------//
@@ -527,7 +527,7 @@ namespace device {
 			@brief	タイマリードライトイネーブルレジスタ（TRWERB）
 		*/
 		//-----------------------------------------------------------------//
-		static trwer_t<0x000C1A84> TRWERB;
+		static IO_SIM_INLINE trwer_t<0x000C1A84> TRWERB;
 
 
 		//-----------------------------------------------------------------//
@@ -551,7 +551,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4> OE4C;
 			bit_rw_t<io_, bitpos::B5> OE4D;
 		};
-		static toera_t<0x000C120A> TOERA; 
+		static IO_SIM_INLINE toera_t<0x000C120A> TOERA; 
 
 
 		//-----------------------------------------------------------------//
@@ -575,7 +575,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4> OE7C;
 			bit_rw_t<io_, bitpos::B5> OE7D;
 		};
-		static toerb_t<0x000C120A> TOERB; 
+		static IO_SIM_INLINE toerb_t<0x000C120A> TOERB; 
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -606,7 +606,7 @@ namespace device {
 			@brief	タイマアウトプットコントロールレジスタ 1（TOCR1A）
 		*/
 		//-----------------------------------------------------------------//
-		static tocr1_t<0x000C120E> TOCR1A; 
+		static IO_SIM_INLINE tocr1_t<0x000C120E> TOCR1A; 
 
 
 		//-----------------------------------------------------------------//
@@ -614,7 +614,7 @@ namespace device {
 			@brief	タイマアウトプットコントロールレジスタ 1（TOCR1B）
 		*/
 		//-----------------------------------------------------------------//
-		static tocr1_t<0x000C1A0E> TOCR1B; 
+		static IO_SIM_INLINE tocr1_t<0x000C1A0E> TOCR1B; 
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -646,7 +646,7 @@ namespace device {
 			@brief	タイマアウトプットコントロールレジスタ 2（TOCR2A）
 		*/
 		//-----------------------------------------------------------------//
-		static tocr2_t<0x000C120F> TOCR2A; 
+		static IO_SIM_INLINE tocr2_t<0x000C120F> TOCR2A; 
 
 
 		//-----------------------------------------------------------------//
@@ -654,7 +654,7 @@ namespace device {
 			@brief	タイマアウトプットコントロールレジスタ 2（TOCR2B）
 		*/
 		//-----------------------------------------------------------------//
-		static tocr2_t<0x000C1A0F> TOCR2B; 
+		static IO_SIM_INLINE tocr2_t<0x000C1A0F> TOCR2B; 
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -685,7 +685,7 @@ namespace device {
 			@brief	タイマアウトプットレベルバッファレジスタ（TOLBRA）
 		*/
 		//-----------------------------------------------------------------//
-		static tolbr_t<0x000C1236> TOLBRA; 
+		static IO_SIM_INLINE tolbr_t<0x000C1236> TOLBRA; 
 
 
 		//-----------------------------------------------------------------//
@@ -693,7 +693,7 @@ namespace device {
 			@brief	タイマアウトプットレベルバッファレジスタ（TOLBRB）
 		*/
 		//-----------------------------------------------------------------//
-		static tolbr_t<0x000C1A36> TOLBRB; 
+		static IO_SIM_INLINE tolbr_t<0x000C1A36> TOLBRB; 
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -725,7 +725,7 @@ namespace device {
 			@brief	タイマゲートコントロールレジスタ（TGCRA）
 		*/
 		//-----------------------------------------------------------------//
-		static tgcra_t<0x000C120D> TGCRA; 
+		static IO_SIM_INLINE tgcra_t<0x000C120D> TGCRA; 
 
 
 		//-----------------------------------------------------------------//
@@ -733,7 +733,7 @@ namespace device {
 			@brie	タイマゲートコントロールレジスタ（TGCRB）
 		*/
 		//-----------------------------------------------------------------//
-		static tgcra_t<0x000C1A0D> TGCRB; 
+		static IO_SIM_INLINE tgcra_t<0x000C1A0D> TGCRB; 
 
 
 		//-----------------------------------------------------------------//
@@ -741,7 +741,7 @@ namespace device {
 			@brie	タイマサブカウンタ（TCNTSA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1220> TCNTSA;
+		static IO_SIM_INLINE rw16_t<0x000C1220> TCNTSA;
 
 
 		//-----------------------------------------------------------------//
@@ -749,7 +749,7 @@ namespace device {
 			@brie	タイマサブカウンタ（TCNTSB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A20> TCNTSB;
+		static IO_SIM_INLINE rw16_t<0x000C1A20> TCNTSB;
 
 
 		//-----------------------------------------------------------------//
@@ -757,7 +757,7 @@ namespace device {
 			@brie	タイマ周期データレジスタ（TCDRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1214> TCDRA;
+		static IO_SIM_INLINE rw16_t<0x000C1214> TCDRA;
 
 
 		//-----------------------------------------------------------------//
@@ -765,7 +765,7 @@ namespace device {
 			@brie	タイマ周期データレジスタ（TCDRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A14> TCDRB;
+		static IO_SIM_INLINE rw16_t<0x000C1A14> TCDRB;
 
 
 		//-----------------------------------------------------------------//
@@ -773,7 +773,7 @@ namespace device {
 			@brie	タイマ周期バッファレジスタ（TCBRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1222> TCBRA;
+		static IO_SIM_INLINE rw16_t<0x000C1222> TCBRA;
 
 
 		//-----------------------------------------------------------------//
@@ -781,7 +781,7 @@ namespace device {
 			@brie	タイマ周期バッファレジスタ（TCBRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A22> TCBRB;
+		static IO_SIM_INLINE rw16_t<0x000C1A22> TCBRB;
 
 
 		//-----------------------------------------------------------------//
@@ -789,7 +789,7 @@ namespace device {
 			@brie	タイマデッドタイムデータレジスタ（TDDRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1216> TDDRA;
+		static IO_SIM_INLINE rw16_t<0x000C1216> TDDRA;
 
 
 		//-----------------------------------------------------------------//
@@ -797,7 +797,7 @@ namespace device {
 			@brie	タイマデッドタイムデータレジスタ（TDDRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A16> TDDRB;
+		static IO_SIM_INLINE rw16_t<0x000C1A16> TDDRB;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -823,7 +823,7 @@ namespace device {
 			@brief	タイマデッドタイムイネーブルレジスタ（TDERA）
 		*/
 		//-----------------------------------------------------------------//
-		static tder_t<0x000C1234> TDERA;
+		static IO_SIM_INLINE tder_t<0x000C1234> TDERA;
 
 
 		//-----------------------------------------------------------------//
@@ -831,7 +831,7 @@ namespace device {
 			@brief	タイマデッドタイムイネーブルレジスタ（TDERB）
 		*/
 		//-----------------------------------------------------------------//
-		static tder_t<0x000C1A34> TDERB;
+		static IO_SIM_INLINE tder_t<0x000C1A34> TDERB;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -857,7 +857,7 @@ namespace device {
 			@brief	タイマバッファ転送設定レジスタ（TBTERA）
 		*/
 		//-----------------------------------------------------------------//
-		static tbter_t<0x000C1232> TBTERA;
+		static IO_SIM_INLINE tbter_t<0x000C1232> TBTERA;
 
 
 		//-----------------------------------------------------------------//
@@ -865,7 +865,7 @@ namespace device {
 			@brief	タイマバッファ転送設定レジスタ（TBTERB）
 		*/
 		//-----------------------------------------------------------------//
-		static tbter_t<0x000C1A32> TBTERB;
+		static IO_SIM_INLINE tbter_t<0x000C1A32> TBTERB;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -894,7 +894,7 @@ namespace device {
 			@brief	タイマ波形コントロールレジスタ（TWCRA）
 		*/
 		//-----------------------------------------------------------------//
-		static twcr_t<0x000C1260> TWCRA;
+		static IO_SIM_INLINE twcr_t<0x000C1260> TWCRA;
 
 
 		//-----------------------------------------------------------------//
@@ -902,7 +902,7 @@ namespace device {
 			@brief	タイマ波形コントロールレジスタ（TWCRB）
 		*/
 		//-----------------------------------------------------------------//
-		static twcr_t<0x000C1A60> TWCRB;
+		static IO_SIM_INLINE twcr_t<0x000C1A60> TWCRB;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -951,7 +951,7 @@ namespace device {
 			@brief	タイマ割り込み間引きモードレジスタ（TITMRA）
 		*/
 		//-----------------------------------------------------------------//
-		static titmr_t<0x000C123A> TITMRA;
+		static IO_SIM_INLINE titmr_t<0x000C123A> TITMRA;
 
 
 		//-----------------------------------------------------------------//
@@ -959,7 +959,7 @@ namespace device {
 			@brief	タイマ割り込み間引きモードレジスタ（TITMRB）
 		*/
 		//-----------------------------------------------------------------//
-		static titmr_t<0x000C1A3A> TITMRB;
+		static IO_SIM_INLINE titmr_t<0x000C1A3A> TITMRB;
 
 
 		//-----------------------------------------------------------------//
@@ -981,7 +981,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 3>  T3ACOR;
 			bit_rw_t <io_, bitpos::B7>     T3AEN;
 		};
-		static titcr1a_t<0x000C1230> TITCR1A;
+		static IO_SIM_INLINE titcr1a_t<0x000C1230> TITCR1A;
 
 
 		//-----------------------------------------------------------------//
@@ -1003,7 +1003,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 3>  T6ACOR;
 			bit_rw_t <io_, bitpos::B7>     T6AEN;
 		};
-		static titcr1b_t<0x000C1230> TITCR1B;
+		static IO_SIM_INLINE titcr1b_t<0x000C1230> TITCR1B;
 
 
 		//-----------------------------------------------------------------//
@@ -1023,7 +1023,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>  T4VCNT;
 			bits_rw_t<io_, bitpos::B4, 3>  T3ACNT;
 		};
-		static titcnt1a_t<0x000C1231> TITCNT1A;
+		static IO_SIM_INLINE titcnt1a_t<0x000C1231> TITCNT1A;
 
 
 		//-----------------------------------------------------------------//
@@ -1043,7 +1043,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>  T7VCNT;
 			bits_rw_t<io_, bitpos::B4, 3>  T6ACNT;
 		};
-		static titcnt1b_t<0x000C1A31> TITCNT1B;
+		static IO_SIM_INLINE titcnt1b_t<0x000C1A31> TITCNT1B;
 
 
 		//-----------------------------------------------------------------//
@@ -1062,7 +1062,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3>  TRG4COR;
 		};
-		static titcr2a_t<0x000C123B> TITCR2A;
+		static IO_SIM_INLINE titcr2a_t<0x000C123B> TITCR2A;
 
 
 		//-----------------------------------------------------------------//
@@ -1081,7 +1081,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3>  TRG7COR;
 		};
-		static titcr2b_t<0x000C1A3B> TITCR2B;
+		static IO_SIM_INLINE titcr2b_t<0x000C1A3B> TITCR2B;
 
 
 		//-----------------------------------------------------------------//
@@ -1100,7 +1100,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3>  TRG4CNT;
 		};
-		static titcnt2a_t<0x000C123C> TITCNT2A;
+		static IO_SIM_INLINE titcnt2a_t<0x000C123C> TITCNT2A;
 
 
 		//-----------------------------------------------------------------//
@@ -1119,7 +1119,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3>  TRG7CNT;
 		};
-		static titcnt2b_t<0x000C1A3C> TITCNT2B;
+		static IO_SIM_INLINE titcnt2b_t<0x000C1A3C> TITCNT2B;
 
 
 		//-----------------------------------------------------------------//
@@ -1138,7 +1138,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5>  TADSTRS0;
 		};
-		static tadstrgr0_t<0x000C1D30> TADSTRGR0;
+		static IO_SIM_INLINE tadstrgr0_t<0x000C1D30> TADSTRGR0;
 
 
 		//-----------------------------------------------------------------//
@@ -1157,7 +1157,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5>  TADSTRS1;
 		};
-		static tadstrgr1_t<0x000C1D32> TADSTRGR1;
+		static IO_SIM_INLINE tadstrgr1_t<0x000C1D32> TADSTRGR1;
 
 	};
 	typedef mtu_t MTU;
@@ -1242,7 +1242,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCR）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1300> TCR;
+		static IO_SIM_INLINE tcr_t<0x000C1300> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -1250,7 +1250,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ 2（TCR2）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr2_t<0x000C1328> TCR2;
+		static IO_SIM_INLINE tcr2_t<0x000C1328> TCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -1258,7 +1258,7 @@ namespace device {
 			@brief  タイマモードレジスタ 1（TMDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr1x_t<0x000C1301> TMDR1;
+		static IO_SIM_INLINE tmdr1x_t<0x000C1301> TMDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1266,7 +1266,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORH）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorh_t<0x000C1302> TIORH;
+		static IO_SIM_INLINE tiorh_t<0x000C1302> TIORH;
 
 
 		//-----------------------------------------------------------------//
@@ -1274,7 +1274,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORL）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorl_t<0x000C1303> TIORL;
+		static IO_SIM_INLINE tiorl_t<0x000C1303> TIORL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1339,7 +1339,7 @@ namespace device {
 				}
 			}
 		};
-		static tior_t TIOR;
+		static IO_SIM_INLINE tior_t TIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -1347,7 +1347,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER）
 		*/
 		//-----------------------------------------------------------------//
-		static tiery_t<0x000C1304> TIER;
+		static IO_SIM_INLINE tiery_t<0x000C1304> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -1355,7 +1355,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER2）
 		*/
 		//-----------------------------------------------------------------//
-		static tier2_t<0x000C1324> TIER2;
+		static IO_SIM_INLINE tier2_t<0x000C1324> TIER2;
 
 
 		//-----------------------------------------------------------------//
@@ -1363,7 +1363,7 @@ namespace device {
 			@brief  タイマバッファ動作転送モードレジスタ（TBTM）
 		*/
 		//-----------------------------------------------------------------//
-		static tbtmx_t<0x000C1326> TBTM;
+		static IO_SIM_INLINE tbtmx_t<0x000C1326> TBTM;
 
 
 		//-----------------------------------------------------------------//
@@ -1371,7 +1371,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1306> TCNT;
+		static IO_SIM_INLINE rw16_t<0x000C1306> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -1379,7 +1379,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1308> TGRA;
+		static IO_SIM_INLINE rw16_t<0x000C1308> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -1387,7 +1387,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C130A> TGRB;
+		static IO_SIM_INLINE rw16_t<0x000C130A> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -1395,7 +1395,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRC）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C130C> TGRC;
+		static IO_SIM_INLINE rw16_t<0x000C130C> TGRC;
 
 
 		//-----------------------------------------------------------------//
@@ -1403,7 +1403,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRD）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C130E> TGRD;
+		static IO_SIM_INLINE rw16_t<0x000C130E> TGRD;
 
 
 		//-----------------------------------------------------------------//
@@ -1411,7 +1411,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRE）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1320> TGRE;
+		static IO_SIM_INLINE rw16_t<0x000C1320> TGRE;
 
 
 		//-----------------------------------------------------------------//
@@ -1419,7 +1419,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRF）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1322> TGRF;
+		static IO_SIM_INLINE rw16_t<0x000C1322> TGRF;
 
 
 		//-----------------------------------------------------------------//
@@ -1427,7 +1427,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタ（NFCR）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1290> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1290> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -1435,7 +1435,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタクロック（NFCRC）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1299> NFCRC;
+		static IO_SIM_INLINE nfcr_t<0x000C1299> NFCRC;
 
 
 		//-----------------------------------------------------------------//
@@ -1541,7 +1541,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCR）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1380> TCR;
+		static IO_SIM_INLINE tcr_t<0x000C1380> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -1549,7 +1549,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ 2（TCR2）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr2x_t<0x000C1394> TCR2;
+		static IO_SIM_INLINE tcr2x_t<0x000C1394> TCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -1557,7 +1557,7 @@ namespace device {
 			@brief  タイマモードレジスタ 1（TMDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr1y_t<0x000C1381> TMDR1;
+		static IO_SIM_INLINE tmdr1y_t<0x000C1381> TMDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1577,7 +1577,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0> LWA;
 			bit_rw_t<io_, bitpos::B1> PHCKSEL;
 		};
-		static tmdr3_t<0x000C1391> TMDR3;
+		static IO_SIM_INLINE tmdr3_t<0x000C1391> TMDR3;
 
 
 		//-----------------------------------------------------------------//
@@ -1585,7 +1585,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORH）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorh_t<0x000C1382> TIORH;
+		static IO_SIM_INLINE tiorh_t<0x000C1382> TIORH;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1638,7 +1638,7 @@ namespace device {
 				}
 			}
 		};
-		static tior_t TIOR;
+		static IO_SIM_INLINE tior_t TIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -1646,7 +1646,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER）
 		*/
 		//-----------------------------------------------------------------//
-		static tierx_t<0x000C1384> TIER;
+		static IO_SIM_INLINE tierx_t<0x000C1384> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -1654,7 +1654,7 @@ namespace device {
 			@brief  タイマステータスレジスタ（TSR）
 		*/
 		//-----------------------------------------------------------------//
-		static tsr_t<0x000C1385> TSR;
+		static IO_SIM_INLINE tsr_t<0x000C1385> TSR;
 
 
 		//-----------------------------------------------------------------//
@@ -1676,7 +1676,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2> I2AE;
 			bit_rw_t<io_, bitpos::B3> I2BE;
 		};
-		static ticcr_t<0x000C1390> TICCR;
+		static IO_SIM_INLINE ticcr_t<0x000C1390> TICCR;
 
 
 		//-----------------------------------------------------------------//
@@ -1684,7 +1684,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1386> TCNT;
+		static IO_SIM_INLINE rw16_t<0x000C1386> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -1692,7 +1692,7 @@ namespace device {
 			@brief  タイマロングワードカウンタ（TCNTLW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C13A0> TCNTLW;
+		static IO_SIM_INLINE rw32_t<0x000C13A0> TCNTLW;
 
 
 		//-----------------------------------------------------------------//
@@ -1700,7 +1700,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1388> TGRA;
+		static IO_SIM_INLINE rw16_t<0x000C1388> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -1708,7 +1708,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C138A> TGRB;
+		static IO_SIM_INLINE rw16_t<0x000C138A> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -1716,7 +1716,7 @@ namespace device {
 			@brief	タイマロングワードジェネラルレジスタ（TGRALW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C13A4> TGRALW;
+		static IO_SIM_INLINE rw32_t<0x000C13A4> TGRALW;
 
 
 		//-----------------------------------------------------------------//
@@ -1724,7 +1724,7 @@ namespace device {
 			@brief	タイマロングワードジェネラルレジスタ（TGRBLW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000C13A8> TGRBLW;
+		static IO_SIM_INLINE rw32_t<0x000C13A8> TGRBLW;
 
 
 		//-----------------------------------------------------------------//
@@ -1732,7 +1732,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタ（NFCR）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1291> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1291> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -1835,7 +1835,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCR）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1400> TCR;
+		static IO_SIM_INLINE tcr_t<0x000C1400> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -1843,7 +1843,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ 2（TCR2）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr2x_t<0x000C140C> TCR2;
+		static IO_SIM_INLINE tcr2x_t<0x000C140C> TCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -1851,7 +1851,7 @@ namespace device {
 			@brief  タイマモードレジスタ 1（TMDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr1y_t<0x000C1401> TMDR1;
+		static IO_SIM_INLINE tmdr1y_t<0x000C1401> TMDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1859,7 +1859,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORH）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorh_t<0x000C1402> TIORH;
+		static IO_SIM_INLINE tiorh_t<0x000C1402> TIORH;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1912,7 +1912,7 @@ namespace device {
 				}
 			}
 		};
-		static tior_t TIOR;
+		static IO_SIM_INLINE tior_t TIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -1920,7 +1920,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER）
 		*/
 		//-----------------------------------------------------------------//
-		static tierx_t<0x000C1404> TIER;
+		static IO_SIM_INLINE tierx_t<0x000C1404> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -1928,7 +1928,7 @@ namespace device {
 			@brief  タイマステータスレジスタ（TSR）
 		*/
 		//-----------------------------------------------------------------//
-		static tsr_t<0x000C1405> TSR;
+		static IO_SIM_INLINE tsr_t<0x000C1405> TSR;
 
 
 		//-----------------------------------------------------------------//
@@ -1936,7 +1936,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1406> TCNT;
+		static IO_SIM_INLINE rw16_t<0x000C1406> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -1944,7 +1944,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1408> TGRA;
+		static IO_SIM_INLINE rw16_t<0x000C1408> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -1952,7 +1952,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C140A> TGRB;
+		static IO_SIM_INLINE rw16_t<0x000C140A> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -1960,7 +1960,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタ（NFCR）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1292> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1292> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -2065,7 +2065,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCR）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1200> TCR;
+		static IO_SIM_INLINE tcr_t<0x000C1200> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -2073,7 +2073,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ 2（TCR2）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr2_t<0x000C124C> TCR2;
+		static IO_SIM_INLINE tcr2_t<0x000C124C> TCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -2081,7 +2081,7 @@ namespace device {
 			@brief  タイマモードレジスタ 1（TMDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr1z_t<0x000C1202> TMDR1;
+		static IO_SIM_INLINE tmdr1z_t<0x000C1202> TMDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -2089,7 +2089,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORH）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorh_t<0x000C1204> TIORH;
+		static IO_SIM_INLINE tiorh_t<0x000C1204> TIORH;
 
 
 		//-----------------------------------------------------------------//
@@ -2097,7 +2097,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORL）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorl_t<0x000C1205> TIORL;
+		static IO_SIM_INLINE tiorl_t<0x000C1205> TIORL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -2162,7 +2162,7 @@ namespace device {
 				}
 			}
 		};
-		static tior_t TIOR;
+		static IO_SIM_INLINE tior_t TIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -2170,7 +2170,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER）
 		*/
 		//-----------------------------------------------------------------//
-		static tiery_t<0x000C1208> TIER;
+		static IO_SIM_INLINE tiery_t<0x000C1208> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -2178,7 +2178,7 @@ namespace device {
 			@brief  タイマステータスレジスタ（TSR）
 		*/
 		//-----------------------------------------------------------------//
-		static tsr_t<0x000C122C> TSR;
+		static IO_SIM_INLINE tsr_t<0x000C122C> TSR;
 
 
 		//-----------------------------------------------------------------//
@@ -2186,7 +2186,7 @@ namespace device {
 			@brief  タイマバッファ動作転送モードレジスタ（TBTM）
 		*/
 		//-----------------------------------------------------------------//
-		static tbtmy_t<0x000C1238> TBTM;
+		static IO_SIM_INLINE tbtmy_t<0x000C1238> TBTM;
 
 
 		//-----------------------------------------------------------------//
@@ -2194,7 +2194,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1210> TCNT;
+		static IO_SIM_INLINE rw16_t<0x000C1210> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -2202,7 +2202,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1218> TGRA;
+		static IO_SIM_INLINE rw16_t<0x000C1218> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -2210,7 +2210,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C121A> TGRB;
+		static IO_SIM_INLINE rw16_t<0x000C121A> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -2218,7 +2218,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRC）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1224> TGRC;
+		static IO_SIM_INLINE rw16_t<0x000C1224> TGRC;
 
 
 		//-----------------------------------------------------------------//
@@ -2226,7 +2226,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRD）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1226> TGRD;
+		static IO_SIM_INLINE rw16_t<0x000C1226> TGRD;
 
 
 		//-----------------------------------------------------------------//
@@ -2234,7 +2234,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRE）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1272> TGRE;
+		static IO_SIM_INLINE rw16_t<0x000C1272> TGRE;
 
 
 		//-----------------------------------------------------------------//
@@ -2242,7 +2242,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタ（NFCR）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1293> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1293> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -2348,7 +2348,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCR）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1201> TCR;
+		static IO_SIM_INLINE tcr_t<0x000C1201> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -2356,7 +2356,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ 2（TCR2）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr2_t<0x000C124D> TCR2;
+		static IO_SIM_INLINE tcr2_t<0x000C124D> TCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -2364,7 +2364,7 @@ namespace device {
 			@brief  タイマモードレジスタ 1（TMDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr1z_t<0x000C1203> TMDR1;
+		static IO_SIM_INLINE tmdr1z_t<0x000C1203> TMDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -2372,7 +2372,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORH）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorh_t<0x000C1206> TIORH;
+		static IO_SIM_INLINE tiorh_t<0x000C1206> TIORH;
 
 
 		//-----------------------------------------------------------------//
@@ -2380,7 +2380,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORL）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorl_t<0x000C1207> TIORL;
+		static IO_SIM_INLINE tiorl_t<0x000C1207> TIORL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -2445,7 +2445,7 @@ namespace device {
 				}
 			}
 		};
-		static tior_t TIOR;
+		static IO_SIM_INLINE tior_t TIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -2453,7 +2453,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER）
 		*/
 		//-----------------------------------------------------------------//
-		static tierz_t<0x000C1209> TIER;
+		static IO_SIM_INLINE tierz_t<0x000C1209> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -2461,7 +2461,7 @@ namespace device {
 			@brief  タイマステータスレジスタ（TSR）
 		*/
 		//-----------------------------------------------------------------//
-		static tsr_t<0x000C122D> TSR;
+		static IO_SIM_INLINE tsr_t<0x000C122D> TSR;
 
 
 		//-----------------------------------------------------------------//
@@ -2469,7 +2469,7 @@ namespace device {
 			@brief  タイマバッファ動作転送モードレジスタ（TBTM）
 		*/
 		//-----------------------------------------------------------------//
-		static tbtmy_t<0x000C1239> TBTM;
+		static IO_SIM_INLINE tbtmy_t<0x000C1239> TBTM;
 
 
 		//-----------------------------------------------------------------//
@@ -2477,7 +2477,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1212> TCNT;
+		static IO_SIM_INLINE rw16_t<0x000C1212> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -2485,7 +2485,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C121C> TGRA;
+		static IO_SIM_INLINE rw16_t<0x000C121C> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -2493,7 +2493,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C121E> TGRB;
+		static IO_SIM_INLINE rw16_t<0x000C121E> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -2501,7 +2501,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRC）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1228> TGRC;
+		static IO_SIM_INLINE rw16_t<0x000C1228> TGRC;
 
 
 		//-----------------------------------------------------------------//
@@ -2509,7 +2509,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRD）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C122A> TGRD;
+		static IO_SIM_INLINE rw16_t<0x000C122A> TGRD;
 
 
 		//-----------------------------------------------------------------//
@@ -2517,7 +2517,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRE）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1274> TGRE;
+		static IO_SIM_INLINE rw16_t<0x000C1274> TGRE;
 
 
 		//-----------------------------------------------------------------//
@@ -2525,7 +2525,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRF）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1276> TGRF;
+		static IO_SIM_INLINE rw16_t<0x000C1276> TGRF;
 
 
 		//-----------------------------------------------------------------//
@@ -2533,7 +2533,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタ（NFCR）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1294> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1294> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -2561,7 +2561,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B14, 2> BF;
 		};
-		static tadcr_t<0x000C1240> TADCR;
+		static IO_SIM_INLINE tadcr_t<0x000C1240> TADCR;
 
 
 		//-----------------------------------------------------------------//
@@ -2569,7 +2569,7 @@ namespace device {
 			@brief  タイマ A/D 変換開始要求周期設定レジスタ（TADCORA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1244> TADCORA;
+		static IO_SIM_INLINE rw16_t<0x000C1244> TADCORA;
 
 
 		//-----------------------------------------------------------------//
@@ -2577,7 +2577,7 @@ namespace device {
 			@brief  タイマ A/D 変換開始要求周期設定レジスタ（TADCORB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1246> TADCORB;
+		static IO_SIM_INLINE rw16_t<0x000C1246> TADCORB;
 
 
 		//-----------------------------------------------------------------//
@@ -2585,7 +2585,7 @@ namespace device {
 			@brief  タイマ A/D 変換開始要求周期設定バッファレジスタ（TADCOBRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1248> TADCOBRA;
+		static IO_SIM_INLINE rw16_t<0x000C1248> TADCOBRA;
 
 
 		//-----------------------------------------------------------------//
@@ -2593,7 +2593,7 @@ namespace device {
 			@brief  タイマ A/D 変換開始要求周期設定バッファレジスタ（TADCOBRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C124A> TADCOBRB;
+		static IO_SIM_INLINE rw16_t<0x000C124A> TADCOBRB;
 
 
 		//-----------------------------------------------------------------//
@@ -2718,7 +2718,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCRU）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1C84> TCRU;
+		static IO_SIM_INLINE tcr_t<0x000C1C84> TCRU;
 
 
 		//-----------------------------------------------------------------//
@@ -2726,7 +2726,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCRV）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1C94> TCRV;
+		static IO_SIM_INLINE tcr_t<0x000C1C94> TCRV;
 
 
 		//-----------------------------------------------------------------//
@@ -2734,7 +2734,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCRW）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1CA4> TCRW;
+		static IO_SIM_INLINE tcr_t<0x000C1CA4> TCRW;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -2760,7 +2760,7 @@ namespace device {
 			@brief  タイマ I/O コントロールレジスタ（TIORU）
 		*/
 		//-----------------------------------------------------------------//
-		static tior_t<0x000C1C86> TIORU;
+		static IO_SIM_INLINE tior_t<0x000C1C86> TIORU;
 
 
 		//-----------------------------------------------------------------//
@@ -2768,7 +2768,7 @@ namespace device {
 			@brief  タイマ I/O コントロールレジスタ（TIORV）
 		*/
 		//-----------------------------------------------------------------//
-		static tior_t<0x000C1C96> TIORV;
+		static IO_SIM_INLINE tior_t<0x000C1C96> TIORV;
 
 
 		//-----------------------------------------------------------------//
@@ -2776,7 +2776,7 @@ namespace device {
 			@brief  タイマ I/O コントロールレジスタ（TIORW）
 		*/
 		//-----------------------------------------------------------------//
-		static tior_t<0x000C1CA6> TIORW;
+		static IO_SIM_INLINE tior_t<0x000C1CA6> TIORW;
 
 
 		//-----------------------------------------------------------------//
@@ -2797,7 +2797,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1> CMPCLR5V;
 			bit_rw_t<io_, bitpos::B2> CMPCLR5U;
 		};
-		static tcntcmpclr_t<0x000C1CB6> TCNTCMPCLR;
+		static IO_SIM_INLINE tcntcmpclr_t<0x000C1CB6> TCNTCMPCLR;
 
 
 		//-----------------------------------------------------------------//
@@ -2818,7 +2818,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1> TGIE5V;
 			bit_rw_t<io_, bitpos::B2> TGIE5U;
 		};
-		static tier_t<0x000C1CB2> TIER;
+		static IO_SIM_INLINE tier_t<0x000C1CB2> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -2826,7 +2826,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNTU）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1C80> TCNTU;
+		static IO_SIM_INLINE rw16_t<0x000C1C80> TCNTU;
 
 
 		//-----------------------------------------------------------------//
@@ -2834,7 +2834,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNTV）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1C90> TCNTV;
+		static IO_SIM_INLINE rw16_t<0x000C1C90> TCNTV;
 
 
 		//-----------------------------------------------------------------//
@@ -2842,7 +2842,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNTW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1CA0> TCNTW;
+		static IO_SIM_INLINE rw16_t<0x000C1CA0> TCNTW;
 
 
 		//-----------------------------------------------------------------//
@@ -2850,7 +2850,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRU）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1C82> TGRU;
+		static IO_SIM_INLINE rw16_t<0x000C1C82> TGRU;
 
 
 		//-----------------------------------------------------------------//
@@ -2858,7 +2858,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRV）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1C92> TGRV;
+		static IO_SIM_INLINE rw16_t<0x000C1C92> TGRV;
 
 
 		//-----------------------------------------------------------------//
@@ -2866,7 +2866,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1CA2> TGRW;
+		static IO_SIM_INLINE rw16_t<0x000C1CA2> TGRW;
 
 
 		//-----------------------------------------------------------------//
@@ -2887,7 +2887,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1> CSTV5;
 			bit_rw_t<io_, bitpos::B2> CSTU5;
 		};
-		static tstr_t<0x000C1CB4> TSTR;
+		static IO_SIM_INLINE tstr_t<0x000C1CB4> TSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -2910,7 +2910,7 @@ namespace device {
 
 			bits_rw_t <io_, bitpos::B4, 2>  NFCS;
 		};
-		static nfcr_t<0x000C1A95> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1A95> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -3014,7 +3014,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCR）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1A00> TCR;
+		static IO_SIM_INLINE tcr_t<0x000C1A00> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -3022,7 +3022,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ 2（TCR2）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr2_t<0x000C1A4C> TCR2;
+		static IO_SIM_INLINE tcr2_t<0x000C1A4C> TCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -3030,7 +3030,7 @@ namespace device {
 			@brief  タイマモードレジスタ 1（TMDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr1z_t<0x000C1A02> TMDR1;
+		static IO_SIM_INLINE tmdr1z_t<0x000C1A02> TMDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -3038,7 +3038,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORH）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorh_t<0x000C1A04> TIORH;
+		static IO_SIM_INLINE tiorh_t<0x000C1A04> TIORH;
 
 
 		//-----------------------------------------------------------------//
@@ -3046,7 +3046,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORL）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorl_t<0x000C1A05> TIORL;
+		static IO_SIM_INLINE tiorl_t<0x000C1A05> TIORL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -3111,7 +3111,7 @@ namespace device {
 				}
 			}
 		};
-		static tior_t TIOR;
+		static IO_SIM_INLINE tior_t TIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -3119,7 +3119,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER）
 		*/
 		//-----------------------------------------------------------------//
-		static tiery_t<0x000C1A08> TIER;
+		static IO_SIM_INLINE tiery_t<0x000C1A08> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -3127,7 +3127,7 @@ namespace device {
 			@brief  タイマステータスレジスタ（TSR）
 		*/
 		//-----------------------------------------------------------------//
-		static tsr_t<0x000C1A2C> TSR;
+		static IO_SIM_INLINE tsr_t<0x000C1A2C> TSR;
 
 
 		//-----------------------------------------------------------------//
@@ -3135,7 +3135,7 @@ namespace device {
 			@brief  タイマバッファ動作転送モードレジスタ（TBTM）
 		*/
 		//-----------------------------------------------------------------//
-		static tbtmy_t<0x000C1A38> TBTM;
+		static IO_SIM_INLINE tbtmy_t<0x000C1A38> TBTM;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -3161,7 +3161,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> CE0B;
 			bit_rw_t<io_, bitpos::B7> CE0A;
 		};
-		static tsycr_t<0x000C1A50> TSYCR;
+		static IO_SIM_INLINE tsycr_t<0x000C1A50> TSYCR;
 
 
 		//-----------------------------------------------------------------//
@@ -3169,7 +3169,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A10> TCNT;
+		static IO_SIM_INLINE rw16_t<0x000C1A10> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -3177,7 +3177,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A18> TGRA;
+		static IO_SIM_INLINE rw16_t<0x000C1A18> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -3185,7 +3185,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A1A> TGRB;
+		static IO_SIM_INLINE rw16_t<0x000C1A1A> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -3193,7 +3193,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRC）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A24> TGRC;
+		static IO_SIM_INLINE rw16_t<0x000C1A24> TGRC;
 
 
 		//-----------------------------------------------------------------//
@@ -3201,7 +3201,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRD）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A26> TGRD;
+		static IO_SIM_INLINE rw16_t<0x000C1A26> TGRD;
 
 
 		//-----------------------------------------------------------------//
@@ -3209,7 +3209,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRE）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A72> TGRE;
+		static IO_SIM_INLINE rw16_t<0x000C1A72> TGRE;
 
 
 		//-----------------------------------------------------------------//
@@ -3217,7 +3217,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタ（NFCR）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1A93> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1A93> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -3323,7 +3323,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCR）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1A01> TCR;
+		static IO_SIM_INLINE tcr_t<0x000C1A01> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -3331,7 +3331,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ 2（TCR2）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr2_t<0x000C1A4D> TCR2;
+		static IO_SIM_INLINE tcr2_t<0x000C1A4D> TCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -3339,7 +3339,7 @@ namespace device {
 			@brief  タイマモードレジスタ 1（TMDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr1z_t<0x000C1A03> TMDR1;
+		static IO_SIM_INLINE tmdr1z_t<0x000C1A03> TMDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -3347,7 +3347,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORH）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorh_t<0x000C1A06> TIORH;
+		static IO_SIM_INLINE tiorh_t<0x000C1A06> TIORH;
 
 
 		//-----------------------------------------------------------------//
@@ -3355,7 +3355,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORL）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorl_t<0x000C1A07> TIORL;
+		static IO_SIM_INLINE tiorl_t<0x000C1A07> TIORL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -3420,7 +3420,7 @@ namespace device {
 				}
 			}
 		};
-		static tior_t TIOR;
+		static IO_SIM_INLINE tior_t TIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -3428,7 +3428,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER）
 		*/
 		//-----------------------------------------------------------------//
-		static tierz_t<0x000C1A09> TIER;
+		static IO_SIM_INLINE tierz_t<0x000C1A09> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -3436,7 +3436,7 @@ namespace device {
 			@brief  タイマステータスレジスタ（TSR）
 		*/
 		//-----------------------------------------------------------------//
-		static tsr_t<0x000C1A2D> TSR;
+		static IO_SIM_INLINE tsr_t<0x000C1A2D> TSR;
 
 
 		//-----------------------------------------------------------------//
@@ -3444,7 +3444,7 @@ namespace device {
 			@brief  タイマバッファ動作転送モードレジスタ（TBTM）
 		*/
 		//-----------------------------------------------------------------//
-		static tbtmy_t<0x000C1A39> TBTM;
+		static IO_SIM_INLINE tbtmy_t<0x000C1A39> TBTM;
 
 
 		//-----------------------------------------------------------------//
@@ -3452,7 +3452,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A12> TCNT;
+		static IO_SIM_INLINE rw16_t<0x000C1A12> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -3460,7 +3460,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A1C> TGRA;
+		static IO_SIM_INLINE rw16_t<0x000C1A1C> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -3468,7 +3468,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A1E> TGRB;
+		static IO_SIM_INLINE rw16_t<0x000C1A1E> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -3476,7 +3476,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRC）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A28> TGRC;
+		static IO_SIM_INLINE rw16_t<0x000C1A28> TGRC;
 
 
 		//-----------------------------------------------------------------//
@@ -3484,7 +3484,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRD）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A2A> TGRD;
+		static IO_SIM_INLINE rw16_t<0x000C1A2A> TGRD;
 
 
 		//-----------------------------------------------------------------//
@@ -3492,7 +3492,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRE）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A74> TGRE;
+		static IO_SIM_INLINE rw16_t<0x000C1A74> TGRE;
 
 
 		//-----------------------------------------------------------------//
@@ -3500,7 +3500,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRF）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A76> TGRF;
+		static IO_SIM_INLINE rw16_t<0x000C1A76> TGRF;
 
 
 		//-----------------------------------------------------------------//
@@ -3508,7 +3508,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタ（NFCR）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1A94> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1A94> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -3536,7 +3536,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B14, 2> BF;
 		};
-		static tadcr_t<0x000C1A40> TADCR;
+		static IO_SIM_INLINE tadcr_t<0x000C1A40> TADCR;
 
 
 		//-----------------------------------------------------------------//
@@ -3544,7 +3544,7 @@ namespace device {
 			@brief  タイマ A/D 変換開始要求周期設定レジスタ（TADCORA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A44> TADCORA;
+		static IO_SIM_INLINE rw16_t<0x000C1A44> TADCORA;
 
 
 		//-----------------------------------------------------------------//
@@ -3552,7 +3552,7 @@ namespace device {
 			@brief  タイマ A/D 変換開始要求周期設定レジスタ（TADCORB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A46> TADCORB;
+		static IO_SIM_INLINE rw16_t<0x000C1A46> TADCORB;
 
 
 		//-----------------------------------------------------------------//
@@ -3560,7 +3560,7 @@ namespace device {
 			@brief  タイマ A/D 変換開始要求周期設定バッファレジスタ（TADCOBRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A48> TADCOBRA;
+		static IO_SIM_INLINE rw16_t<0x000C1A48> TADCOBRA;
 
 
 		//-----------------------------------------------------------------//
@@ -3568,7 +3568,7 @@ namespace device {
 			@brief  タイマ A/D 変換開始要求周期設定バッファレジスタ（TADCOBRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1A4A> TADCOBRB;
+		static IO_SIM_INLINE rw16_t<0x000C1A4A> TADCOBRB;
 
 
 		//-----------------------------------------------------------------//
@@ -3679,7 +3679,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ（TCR）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr_t<0x000C1580> TCR;
+		static IO_SIM_INLINE tcr_t<0x000C1580> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -3687,7 +3687,7 @@ namespace device {
 			@brief  タイマコントロールレジスタ 2（TCR2）
 		*/
 		//-----------------------------------------------------------------//
-		static tcr2_t<0x000C15A8> TCR2;
+		static IO_SIM_INLINE tcr2_t<0x000C15A8> TCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -3695,7 +3695,7 @@ namespace device {
 			@brief  タイマモードレジスタ 1（TMDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static tmdr1x_t<0x000C1581> TMDR1;
+		static IO_SIM_INLINE tmdr1x_t<0x000C1581> TMDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -3703,7 +3703,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORH）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorh_t<0x000C1582> TIORH;
+		static IO_SIM_INLINE tiorh_t<0x000C1582> TIORH;
 
 
 		//-----------------------------------------------------------------//
@@ -3711,7 +3711,7 @@ namespace device {
 			@brief	タイマ I/O コントロールレジスタ（TIORL）
 		*/
 		//-----------------------------------------------------------------//
-		static tiorl_t<0x000C1583> TIORL;
+		static IO_SIM_INLINE tiorl_t<0x000C1583> TIORL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -3776,7 +3776,7 @@ namespace device {
 				}
 			}
 		};
-		static tior_t TIOR;
+		static IO_SIM_INLINE tior_t TIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -3784,7 +3784,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER）
 		*/
 		//-----------------------------------------------------------------//
-		static tiery_t<0x000C1584> TIER;
+		static IO_SIM_INLINE tiery_t<0x000C1584> TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -3792,7 +3792,7 @@ namespace device {
 			@brief  タイマインタラプトイネーブルレジスタ（TIER2）
 		*/
 		//-----------------------------------------------------------------//
-		static tier2_t<0x000C15A4> TIER2;
+		static IO_SIM_INLINE tier2_t<0x000C15A4> TIER2;
 
 
 		//-----------------------------------------------------------------//
@@ -3800,7 +3800,7 @@ namespace device {
 			@brief  タイマバッファ動作転送モードレジスタ（TBTM）
 		*/
 		//-----------------------------------------------------------------//
-		static tbtmx_t<0x000C15A6> TBTM;
+		static IO_SIM_INLINE tbtmx_t<0x000C15A6> TBTM;
 
 
 		//-----------------------------------------------------------------//
@@ -3808,7 +3808,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1586> TCNT;
+		static IO_SIM_INLINE rw16_t<0x000C1586> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -3816,7 +3816,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C1588> TGRA;
+		static IO_SIM_INLINE rw16_t<0x000C1588> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -3824,7 +3824,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C158A> TGRB;
+		static IO_SIM_INLINE rw16_t<0x000C158A> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -3832,7 +3832,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRC）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C158C> TGRC;
+		static IO_SIM_INLINE rw16_t<0x000C158C> TGRC;
 
 
 		//-----------------------------------------------------------------//
@@ -3840,7 +3840,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRD）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C158E> TGRD;
+		static IO_SIM_INLINE rw16_t<0x000C158E> TGRD;
 
 
 		//-----------------------------------------------------------------//
@@ -3848,7 +3848,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRE）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C15A0> TGRE;
+		static IO_SIM_INLINE rw16_t<0x000C15A0> TGRE;
 
 
 		//-----------------------------------------------------------------//
@@ -3856,7 +3856,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ（TGRF）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x000C15A2> TGRF;
+		static IO_SIM_INLINE rw16_t<0x000C15A2> TGRF;
 
 
 		//-----------------------------------------------------------------//
@@ -3864,7 +3864,7 @@ namespace device {
 			@brief  ノイズフィルタコントロールレジスタ（NFCR）
 		*/
 		//-----------------------------------------------------------------//
-		static nfcr_t<0x000C1296> NFCR;
+		static IO_SIM_INLINE nfcr_t<0x000C1296> NFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -49,7 +49,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B11, 3>  PCKDIV;
 			bit_rw_t <io_, bitpos::B14>     EDS;
 		};
-		static pccr0_t<0x000A0500>  PCCR0;
+		static IO_SIM_INLINE pccr0_t<0x000A0500>  PCCR0;
 
 
 		//-----------------------------------------------------------------//
@@ -68,7 +68,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>      PCE;
 		};
-		static pccr1_t<0x000A0504>  PCCR1;
+		static IO_SIM_INLINE pccr1_t<0x000A0504>  PCCR1;
 
 
 		//-----------------------------------------------------------------//
@@ -93,7 +93,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5>  VERF;
 			bit_rw_t<io_, bitpos::B6>  HERF;
 		};
-		static pcsr_t<0x000A0508>  PCSR;
+		static IO_SIM_INLINE pcsr_t<0x000A0508>  PCSR;
 
 
 		//-----------------------------------------------------------------//
@@ -110,7 +110,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  VSYNC;
 			bit_rw_t<io_, bitpos::B1>  HSYNC;
 		};
-		static pcmonr_t<0x000A050C>  PCMONR;
+		static IO_SIM_INLINE pcmonr_t<0x000A050C>  PCMONR;
 
 
 		//-----------------------------------------------------------------//
@@ -118,7 +118,7 @@ namespace device {
 			@brief  PDC 受信データレジスタ（ PCDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x000A0510>  PCDR;
+		static IO_SIM_INLINE rw32_t<0x000A0510>  PCDR;
 
 
 		//-----------------------------------------------------------------//
@@ -138,7 +138,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  12>  VST;
 			bits_rw_t<io_, bitpos::B16, 12>  VSZ;
 		};
-		static vcr_t<0x000A0514>  VCR;
+		static IO_SIM_INLINE vcr_t<0x000A0514>  VCR;
 
 
 		//-----------------------------------------------------------------//
@@ -158,7 +158,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  12>  HST;
 			bits_rw_t<io_, bitpos::B16, 12>  HSZ;
 		};
-		static hcr_t<0x000A0518>  HCR;
+		static IO_SIM_INLINE hcr_t<0x000A0518>  HCR;
 
 
 		//-----------------------------------------------------------------//
@@ -41,7 +41,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 3>  PSMHT;
 			bits_rw_t<io_, bitpos::B20, 3>  PSMCT;
 		};
-		static pmgcr_t<base + 0x00> PMGCR;
+		static IO_SIM_INLINE pmgcr_t<base + 0x00> PMGCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -66,7 +66,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B16, 16> PRD;
 		};
-		static psmr_t<base + 0x04> PSMR;
+		static IO_SIM_INLINE psmr_t<base + 0x04> PSMR;
 
 
 		//-----------------------------------------------------------------//
@@ -46,7 +46,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>     PIE1;
 			bit_rw_t <io_, bitpos::B12>    POE0F;
 		};
-		static icsr1_t<org + 0x00> ICSR1;
+		static IO_SIM_INLINE icsr1_t<org + 0x00> ICSR1;
 
 
 		//-----------------------------------------------------------------//
@@ -72,7 +72,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>     PIE2;
 			bit_rw_t <io_, bitpos::B12>    POE4F;
 		};
-		static icsr2_t<org + 0x04> ICSR2;
+		static IO_SIM_INLINE icsr2_t<org + 0x04> ICSR2;
 
 
 		//-----------------------------------------------------------------//
@@ -99,7 +99,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B9>     POE8E;
 			bit_rw_t <io_, bitpos::B12>    POE8F;
 		};
-		static icsr3_t<org + 0x08> ICSR3;
+		static IO_SIM_INLINE icsr3_t<org + 0x08> ICSR3;
 
 
 		//-----------------------------------------------------------------//
@@ -126,7 +126,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B9>     POE10E;
 			bit_rw_t <io_, bitpos::B12>    POE10F;
 		};
-		static icsr4_t<org + 0x16> ICSR4;
+		static IO_SIM_INLINE icsr4_t<org + 0x16> ICSR4;
 
 
 		//-----------------------------------------------------------------//
@@ -153,7 +153,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B9>     POE11E;
 			bit_rw_t <io_, bitpos::B12>    POE11F;
 		};
-		static icsr5_t<org + 0x18> ICSR5;
+		static IO_SIM_INLINE icsr5_t<org + 0x18> ICSR5;
 
 
 		//-----------------------------------------------------------------//
@@ -173,7 +173,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B9>     OSTSTE;
 			bit_rw_t <io_, bitpos::B12>    OSTSTF;
 		};
-		static icsr6_t<org + 0x1C> ICSR6;
+		static IO_SIM_INLINE icsr6_t<org + 0x1C> ICSR6;
 
 #if defined(SIG_RX24T) || defined(SIG_RX66T)
 		//-----------------------------------------------------------------//
@@ -200,7 +200,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B9>     POE12E;
 			bit_rw_t <io_, bitpos::B12>    POE12F;
 		};
-		static icsr7_t<org + 0x20> ICSR7;
+		static IO_SIM_INLINE icsr7_t<org + 0x20> ICSR7;
 #endif
 
 #if defined(SIG_RX66T)
@@ -224,7 +224,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B9>     POE9E;
 			bit_rw_t <io_, bitpos::B12>    POE9F;
 		};
-		static icsr8_t<org + 0x40> ICSR8;
+		static IO_SIM_INLINE icsr8_t<org + 0x40> ICSR8;
 
 
 		//-----------------------------------------------------------------//
@@ -247,7 +247,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B9>     POE13E;
 			bit_rw_t <io_, bitpos::B12>    POE13F;
 		};
-		static icsr9_t<org + 0x42> ICSR9;
+		static IO_SIM_INLINE icsr9_t<org + 0x42> ICSR9;
 
 
 		//-----------------------------------------------------------------//
@@ -270,7 +270,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B9>     POE14E;
 			bit_rw_t <io_, bitpos::B12>    POE14F;
 		};
-		static icsr10_t<org + 0x44> ICSR10;
+		static IO_SIM_INLINE icsr10_t<org + 0x44> ICSR10;
 #endif
 
 
@@ -292,7 +292,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>   OCE1;
 			bit_rw_t<io_, bitpos::B15>  OSF1;
 		};
-		static ocsr1_t<org + 0x02> OCSR1;
+		static IO_SIM_INLINE ocsr1_t<org + 0x02> OCSR1;
 
 
 		//-----------------------------------------------------------------//
@@ -313,7 +313,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>   OCE2;
 			bit_rw_t<io_, bitpos::B15>  OSF2;
 		};
-		static ocsr2_t<org + 0x06> OCSR2;
+		static IO_SIM_INLINE ocsr2_t<org + 0x06> OCSR2;
 
 
 #if defined(SIG_RX66T)
@@ -335,7 +335,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>   OCE3;
 			bit_rw_t<io_, bitpos::B15>  OSF3;
 		};
-		static ocsr3_t<org + 0x2A> OCSR3;
+		static IO_SIM_INLINE ocsr3_t<org + 0x2A> OCSR3;
 
 
 		//-----------------------------------------------------------------//
@@ -356,7 +356,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>   OCE4;
 			bit_rw_t<io_, bitpos::B15>  OSF4;
 		};
-		static ocsr4_t<org + 0x46> OCSR4;
+		static IO_SIM_INLINE ocsr4_t<org + 0x46> OCSR4;
 
 
 		//-----------------------------------------------------------------//
@@ -377,7 +377,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>   OCE5;
 			bit_rw_t<io_, bitpos::B15>  OSF5;
 		};
-		static ocsr5_t<org + 0x48> OCSR5;
+		static IO_SIM_INLINE ocsr5_t<org + 0x48> OCSR5;
 #endif
 
 
@@ -404,7 +404,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  OLSEN;
 		};
-		static alr1_t<org + 0x1A> ALR1;
+		static IO_SIM_INLINE alr1_t<org + 0x1A> ALR1;
 
 
 #if defined(SIG_RX24T) || defined(SIG_RX66T)
@@ -431,7 +431,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  OLSEN;
 		};
-		static alr2_t<org + 0x1E> ALR2;
+		static IO_SIM_INLINE alr2_t<org + 0x1E> ALR2;
 #endif
 
 
@@ -459,7 +459,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  OLSEN;
 		};
-		static alr3_t<org + 0x2C> ALR3;
+		static IO_SIM_INLINE alr3_t<org + 0x2C> ALR3;
 
 
 		//-----------------------------------------------------------------//
@@ -485,7 +485,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  OLSEN;
 		};
-		static alr4_t<org + 0x4A> ALR4;
+		static IO_SIM_INLINE alr4_t<org + 0x4A> ALR4;
 
 
 		//-----------------------------------------------------------------//
@@ -511,7 +511,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  OLSEN;
 		};
-		static alr5_t<org + 0x4C> ALR5;
+		static IO_SIM_INLINE alr5_t<org + 0x4C> ALR5;
 #endif
 
 
@@ -536,7 +536,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>  GPT01HIZ;
 			bit_rw_t<io_, bitpos::B4>  GPT23HIZ;
 		};
-		static spoer_t<org + 0x0A> SPOER;
+		static IO_SIM_INLINE spoer_t<org + 0x0A> SPOER;
 #elif defined(SIG_RX24T)
 		template <uint32_t base>
 		struct spoer_t : public rw8_t<base> {
@@ -554,7 +554,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B6>  MTUCH9HIZ;
 		};
-		static spoer_t<org + 0x0A> SPOER;
+		static IO_SIM_INLINE spoer_t<org + 0x0A> SPOER;
 #elif defined(SIG_RX66T)
 		template <uint32_t base>
 		struct spoer_t : public rw16_t<base> {
@@ -576,7 +576,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>  GPT46HIZ;
 			bit_rw_t<io_, bitpos::B10> GPT79HIZ;
 		};
-		static spoer_t<org + 0x2E> SPOER;
+		static IO_SIM_INLINE spoer_t<org + 0x2E> SPOER;
 #endif
 
 
@@ -603,7 +603,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5>  MTU0B1ZE;
 #endif
 		};
-		static poecr1_t<org + 0x0B> POECR1;
+		static IO_SIM_INLINE poecr1_t<org + 0x0B> POECR1;
 
 
 		//-----------------------------------------------------------------//
@@ -628,7 +628,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>  MTU4ACZE;
 			bit_rw_t<io_, bitpos::B10> MTU3BDZE;
 		};
-		static poecr2_t<org + 0x0C> POECR2;
+		static IO_SIM_INLINE poecr2_t<org + 0x0C> POECR2;
 
 
 		//-----------------------------------------------------------------//
@@ -672,7 +672,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>   GPT9ABZE;
 #endif
 		};
-		static poecr3_t<org + 0x0E> POECR3;
+		static IO_SIM_INLINE poecr3_t<org + 0x0E> POECR3;
 
 
 		//-----------------------------------------------------------------//
@@ -730,7 +730,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B10> IC10ADDMT34ZE;
 #endif
 		};
-		static poecr4_t<org + 0x10> POECR4;
+		static IO_SIM_INLINE poecr4_t<org + 0x10> POECR4;
 
 
 #if defined(SIG_RX66T)
@@ -760,7 +760,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>  IC9ADDMT67ZE;
 			bit_rw_t<io_, bitpos::B10> IC10ADDMT67ZE;
 		};
-		static poecr4b_t<org + 0x4E> POECR4B;
+		static IO_SIM_INLINE poecr4b_t<org + 0x4E> POECR4B;
 #endif
 
 
@@ -806,7 +806,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B10> IC10ADDMT0ZE;
 #endif 
 		};
-		static poecr5_t<org + 0x12> POECR5;
+		static IO_SIM_INLINE poecr5_t<org + 0x12> POECR5;
 
 
 		//-----------------------------------------------------------------//
@@ -857,7 +857,7 @@ namespace device {
 #endif 
 		};
 #if defined(SIG_RX24T) || defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX66T)
-		static poecr6_t<org + 0x14> POECR6;
+		static IO_SIM_INLINE poecr6_t<org + 0x14> POECR6;
 #endif
 
 
@@ -888,7 +888,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>  IC9ADDGPT23ZE;
 			bit_rw_t<io_, bitpos::B10> IC10ADDGPT23ZE;
 		};
-		static poecr6B_t<org + 0x50> POECR6B;
+		static IO_SIM_INLINE poecr6B_t<org + 0x50> POECR6B;
 #endif
 
 
@@ -918,7 +918,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B7>  MTU9D1ZE;
 #endif
 		};
-		static poecr7_t<org + 0x22> POECR7;
+		static IO_SIM_INLINE poecr7_t<org + 0x22> POECR7;
 #endif
 
 
@@ -951,7 +951,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B10> IC10ADDMT9ZE;
 #endif
 		};
-		static poecr8_t<org + 0x24> POECR8;
+		static IO_SIM_INLINE poecr8_t<org + 0x24> POECR8;
 #endif
 
 
@@ -982,7 +982,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>  IC9ADDGPT02ZE;
 			bit_rw_t<io_, bitpos::B10> IC10ADDGPT02ZE;
 		};
-		static poecr9_t<org + 0x52> POECR9;
+		static IO_SIM_INLINE poecr9_t<org + 0x52> POECR9;
 
 
 		//-----------------------------------------------------------------//
@@ -1011,7 +1011,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>  IC9ADDGPT46ZE;
 			bit_rw_t<io_, bitpos::B10> IC10ADDGPT46ZE;
 		};
-		static poecr10_t<org + 0x54> POECR10;
+		static IO_SIM_INLINE poecr10_t<org + 0x54> POECR10;
 
 
 		//-----------------------------------------------------------------//
@@ -1040,7 +1040,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>  IC9ADDGPT79ZE;
 			bit_rw_t<io_, bitpos::B10> IC10ADDGPT79ZE;
 		};
-		static poecr11_t<org + 0x56> POECR11;
+		static IO_SIM_INLINE poecr11_t<org + 0x56> POECR11;
 #endif
 
 
@@ -1066,7 +1066,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>  MTU0A1ME;
 			bit_rw_t<io_, bitpos::B5>  MTU0B1ME;
 		};
-		static pmmcr0_t<org + 0x30> PMMCR0;
+		static IO_SIM_INLINE pmmcr0_t<org + 0x30> PMMCR0;
 #elif defined(SIG_RX66T)
 		//-----------------------------------------------------------------//
 		/*!
@@ -1092,7 +1092,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B10> MTU9CME;
 			bit_rw_t<io_, bitpos::B11> MTU9DME;
 		};
-		static pmmcr0_t<org + 0x30> PMMCR0;
+		static IO_SIM_INLINE pmmcr0_t<org + 0x30> PMMCR0;
 #endif
 
 
@@ -1125,7 +1125,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B12> MTU4CME;
 			bit_rw_t<io_, bitpos::B13> MTU3DME;
 		};
-		static pmmcr1_t<org + 0x32> PMMCR1;
+		static IO_SIM_INLINE pmmcr1_t<org + 0x32> PMMCR1;
 #endif
 
 
@@ -1153,7 +1153,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14> GPT3A1ME;
 			bit_rw_t<io_, bitpos::B15> GPT3B1ME;
 		};
-		static pmmcr2_t<org + 0x34> PMMCR2;
+		static IO_SIM_INLINE pmmcr2_t<org + 0x34> PMMCR2;
 #elif defined(SIG_RX66T)
 		//-----------------------------------------------------------------//
 		/*!
@@ -1186,7 +1186,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14> GPT7AME;
 			bit_rw_t<io_, bitpos::B15> GPT7BME;
 		};
-		static pmmcr2_t<org + 0x34> PMMCR2;
+		static IO_SIM_INLINE pmmcr2_t<org + 0x34> PMMCR2;
 #endif
 
 
@@ -1214,7 +1214,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  MTU9C1ME;
 			bit_rw_t<io_, bitpos::B7>  MTU9D1ME;
 		};
-		static pmmcr3_t<org + 0x36> PMMCR3;
+		static IO_SIM_INLINE pmmcr3_t<org + 0x36> PMMCR3;
 #elif defined(SIG_RX66T)
 		//-----------------------------------------------------------------//
 		/*!
@@ -1235,7 +1235,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  GPT9AME;
 			bit_rw_t<io_, bitpos::B3>  GPT9BME;
 		};
-		static pmmcr3_t<org + 0x36> PMMCR3;
+		static IO_SIM_INLINE pmmcr3_t<org + 0x36> PMMCR3;
 #endif
 
 
@@ -1263,7 +1263,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5>  C5FLAG;
 #endif
 		};
-		static poecmpfr_t<org + 0x26> POECMPFR;
+		static IO_SIM_INLINE poecmpfr_t<org + 0x26> POECMPFR;
 #endif
 
 
@@ -1291,7 +1291,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5>  POEREQ5;
 #endif
 		};
-		static poecmpsel_t<org + 0x28> POECMPSEL;
+		static IO_SIM_INLINE poecmpsel_t<org + 0x28> POECMPSEL;
 #endif
 
 
@@ -1316,11 +1316,11 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  POEREQ2;
 			bit_rw_t<io_, bitpos::B3>  POEREQ3;
 		};
-		static poecmpex_t<org + 0x38> POECMPEX0;
-		static poecmpex_t<org + 0x39> POECMPEX1;
-		static poecmpex_t<org + 0x3A> POECMPEX2;
-		static poecmpex_t<org + 0x3C> POECMPEX4;
-		static poecmpex_t<org + 0x3D> POECMPEX5;
+		static IO_SIM_INLINE poecmpex_t<org + 0x38> POECMPEX0;
+		static IO_SIM_INLINE poecmpex_t<org + 0x39> POECMPEX1;
+		static IO_SIM_INLINE poecmpex_t<org + 0x3A> POECMPEX2;
+		static IO_SIM_INLINE poecmpex_t<org + 0x3C> POECMPEX4;
+		static IO_SIM_INLINE poecmpex_t<org + 0x3D> POECMPEX5;
 #elif defined(SIG_RX66T)
 		//-----------------------------------------------------------------//
 		/*!
@@ -1344,15 +1344,15 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>  POEREQ4;
 			bit_rw_t<io_, bitpos::B5>  POEREQ5;
 		};
-		static poecmpex_t<org + 0x38> POECMPEX0;
-		static poecmpex_t<org + 0x39> POECMPEX1;
-		static poecmpex_t<org + 0x3A> POECMPEX2;
-		static poecmpex_t<org + 0x3B> POECMPEX3;
-		static poecmpex_t<org + 0x3C> POECMPEX4;
-		static poecmpex_t<org + 0x3D> POECMPEX5;
-		static poecmpex_t<org + 0x58> POECMPEX6;
-		static poecmpex_t<org + 0x59> POECMPEX7;
-		static poecmpex_t<org + 0x5A> POECMPEX8;
+		static IO_SIM_INLINE poecmpex_t<org + 0x38> POECMPEX0;
+		static IO_SIM_INLINE poecmpex_t<org + 0x39> POECMPEX1;
+		static IO_SIM_INLINE poecmpex_t<org + 0x3A> POECMPEX2;
+		static IO_SIM_INLINE poecmpex_t<org + 0x3B> POECMPEX3;
+		static IO_SIM_INLINE poecmpex_t<org + 0x3C> POECMPEX4;
+		static IO_SIM_INLINE poecmpex_t<org + 0x3D> POECMPEX5;
+		static IO_SIM_INLINE poecmpex_t<org + 0x58> POECMPEX6;
+		static IO_SIM_INLINE poecmpex_t<org + 0x59> POECMPEX7;
+		static IO_SIM_INLINE poecmpex_t<org + 0x5A> POECMPEX8;
 #endif
 
 
@@ -1374,7 +1374,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G0ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G0BSEL;
 		};
-		static g0selr_t<org + 0x20> G0SELR;
+		static IO_SIM_INLINE g0selr_t<org + 0x20> G0SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1394,7 +1394,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G1ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G1BSEL;
 		};
-		static g1selr_t<org + 0x21> G1SELR;
+		static IO_SIM_INLINE g1selr_t<org + 0x21> G1SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1414,7 +1414,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G2ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G2BSEL;
 		};
-		static g2selr_t<org + 0x22> G2SELR;
+		static IO_SIM_INLINE g2selr_t<org + 0x22> G2SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1434,7 +1434,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G3ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G3BSEL;
 		};
-		static g3selr_t<org + 0x23> G3SELR;
+		static IO_SIM_INLINE g3selr_t<org + 0x23> G3SELR;
 #endif
 
 
@@ -1535,17 +1535,17 @@ namespace device {
 #endif
 
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX65N)
-		static m0selr1_t<org + 0x24> M0SELR1;
-		static m0selr2_t<org + 0x25> M0SELR2;
-		static m3selr_t<org + 0x26>  M3SELR;
-		static m4selr1_t<org + 0x27> M4SELR1;
-		static m4selr2_t<org + 0x28> M4SELR2;
+		static IO_SIM_INLINE m0selr1_t<org + 0x24> M0SELR1;
+		static IO_SIM_INLINE m0selr2_t<org + 0x25> M0SELR2;
+		static IO_SIM_INLINE m3selr_t<org + 0x26>  M3SELR;
+		static IO_SIM_INLINE m4selr1_t<org + 0x27> M4SELR1;
+		static IO_SIM_INLINE m4selr2_t<org + 0x28> M4SELR2;
 #elif defined(SIG_RX66T)
-		static m0selr1_t<org + 0x60> M0SELR1;
-		static m0selr2_t<org + 0x61> M0SELR2;
-		static m3selr_t<org + 0x62>  M3SELR;
-		static m4selr1_t<org + 0x63> M4SELR1;
-		static m4selr2_t<org + 0x64> M4SELR2;
+		static IO_SIM_INLINE m0selr1_t<org + 0x60> M0SELR1;
+		static IO_SIM_INLINE m0selr2_t<org + 0x61> M0SELR2;
+		static IO_SIM_INLINE m3selr_t<org + 0x62>  M3SELR;
+		static IO_SIM_INLINE m4selr1_t<org + 0x63> M4SELR1;
+		static IO_SIM_INLINE m4selr2_t<org + 0x64> M4SELR2;
 #endif
 
 
@@ -1568,7 +1568,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1>  M4G1SEL;
 			bit_rw_t<io_, bitpos::B2>  M4G2SEL;
 		};
-		static mgselr_t<org + 0x29> MGSELR;
+		static IO_SIM_INLINE mgselr_t<org + 0x29> MGSELR;
 #endif
 
 
@@ -1590,7 +1590,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  M6BSEL;
 			bits_rw_t<io_, bitpos::B4, 4>  M6DSEL;
 		};
-		static m6selr_t<org + 0x65> M6SELR;
+		static IO_SIM_INLINE m6selr_t<org + 0x65> M6SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1610,7 +1610,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  M7ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  M7CSEL;
 		};
-		static m7selr1_t<org + 0x66> M7SELR1;
+		static IO_SIM_INLINE m7selr1_t<org + 0x66> M7SELR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1630,7 +1630,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  M7BSEL;
 			bits_rw_t<io_, bitpos::B4, 4>  M7DSEL;
 		};
-		static m7selr2_t<org + 0x67> M7SELR2;
+		static IO_SIM_INLINE m7selr2_t<org + 0x67> M7SELR2;
 
 
 		//-----------------------------------------------------------------//
@@ -1650,7 +1650,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  M9ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  M9BSEL;
 		};
-		static m9selr1_t<org + 0x68> M9SELR1;
+		static IO_SIM_INLINE m9selr1_t<org + 0x68> M9SELR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1670,7 +1670,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  M9CSEL;
 			bits_rw_t<io_, bitpos::B4, 4>  M9DSEL;
 		};
-		static m9selr2_t<org + 0x69> M9SELR2;
+		static IO_SIM_INLINE m9selr2_t<org + 0x69> M9SELR2;
 
 
 		//-----------------------------------------------------------------//
@@ -1690,7 +1690,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G0ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G0BSEL;
 		};
-		static g0selr_t<org + 0x6A> G0SELR;
+		static IO_SIM_INLINE g0selr_t<org + 0x6A> G0SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1710,7 +1710,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G1ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G1BSEL;
 		};
-		static g1selr_t<org + 0x6B> G1SELR;
+		static IO_SIM_INLINE g1selr_t<org + 0x6B> G1SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1730,7 +1730,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G2ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G2BSEL;
 		};
-		static g2selr_t<org + 0x6C> G2SELR;
+		static IO_SIM_INLINE g2selr_t<org + 0x6C> G2SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1750,7 +1750,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G3ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G3BSEL;
 		};
-		static g3selr_t<org + 0x6D> G3SELR;
+		static IO_SIM_INLINE g3selr_t<org + 0x6D> G3SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1770,7 +1770,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G4ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G4BSEL;
 		};
-		static g4selr_t<org + 0x6E> G4SELR;
+		static IO_SIM_INLINE g4selr_t<org + 0x6E> G4SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1790,7 +1790,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G5ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G5BSEL;
 		};
-		static g5selr_t<org + 0x6F> G5SELR;
+		static IO_SIM_INLINE g5selr_t<org + 0x6F> G5SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1810,7 +1810,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G6ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G6BSEL;
 		};
-		static g6selr_t<org + 0x70> G6SELR;
+		static IO_SIM_INLINE g6selr_t<org + 0x70> G6SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1830,7 +1830,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G7ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G7BSEL;
 		};
-		static g7selr_t<org + 0x71> G7SELR;
+		static IO_SIM_INLINE g7selr_t<org + 0x71> G7SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1850,7 +1850,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G8ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G8BSEL;
 		};
-		static g8selr_t<org + 0x72> G8SELR;
+		static IO_SIM_INLINE g8selr_t<org + 0x72> G8SELR;
 
 
 		//-----------------------------------------------------------------//
@@ -1870,7 +1870,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  G9ASEL;
 			bits_rw_t<io_, bitpos::B4, 4>  G9BSEL;
 		};
-		static g9selr_t<org + 0x73> G9SELR;
+		static IO_SIM_INLINE g9selr_t<org + 0x73> G9SELR;
 #endif
 
 
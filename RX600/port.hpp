@@ -31,7 +31,7 @@ namespace device {
 			@brief  ポート方向レジスタ（PDR）
 		*/
 		//-----------------------------------------------------------------//
-		static basic_rw_t<rw8_t<base + 0x00> > PDR;
+		static IO_SIM_INLINE basic_rw_t<rw8_t<base + 0x00> > PDR;
 
 
 		//-----------------------------------------------------------------//
@@ -39,7 +39,7 @@ namespace device {
 			@brief  ポート出力データレジスタ（PODR）
 		*/
 		//-----------------------------------------------------------------//
-		static basic_rw_t<rw8_t<base + 0x20> > PODR;
+		static IO_SIM_INLINE basic_rw_t<rw8_t<base + 0x20> > PODR;
 
 
 		//-----------------------------------------------------------------//
@@ -47,7 +47,7 @@ namespace device {
 			@brief  ポート入力データレジスタ（PIDR）
 		*/
 		//-----------------------------------------------------------------//
-		static basic_ro_t<ro8_t<base + 0x40> > PIDR;
+		static IO_SIM_INLINE basic_ro_t<ro8_t<base + 0x40> > PIDR;
 
 
 		//-----------------------------------------------------------------//
@@ -55,7 +55,7 @@ namespace device {
 			@brief  ポートモードレジスタ（PMR）
 		*/
 		//-----------------------------------------------------------------//
-		static basic_rw_t<rw8_t<base + 0x60> > PMR;
+		static IO_SIM_INLINE basic_rw_t<rw8_t<base + 0x60> > PMR;
 
 
 		//-----------------------------------------------------------------//
@@ -63,7 +63,7 @@ namespace device {
 			@brief  プルアップ制御レジスタ（PCR）
 		*/
 		//-----------------------------------------------------------------//
-		static basic_rw_t<rw8_t<base + 0xC0> > PCR;
+		static IO_SIM_INLINE basic_rw_t<rw8_t<base + 0xC0> > PCR;
 
 
 		//-----------------------------------------------------------------//
@@ -71,7 +71,7 @@ namespace device {
 			@brief  駆動能力制御レジスタ（DSCR）
 		*/
 		//-----------------------------------------------------------------//
-		static basic_rw_t<rw8_t<base + 0xE0> > DSCR;
+		static IO_SIM_INLINE basic_rw_t<rw8_t<base + 0xE0> > DSCR;
 	};
 
 
@@ -117,7 +117,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4> B4;
 			bit_rw_t<io_, bitpos::B6> B6;
 		};
-		static odr0_t<base + 0> ODR0;
+		static IO_SIM_INLINE odr0_t<base + 0> ODR0;
 
 
 		//-----------------------------------------------------------------//
@@ -141,7 +141,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> B6;
 #endif
 		};
-		static odr1_t<base + 1> ODR1;
+		static IO_SIM_INLINE odr1_t<base + 1> ODR1;
 	};
 
 
@@ -175,7 +175,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4> B4;
 			bit_rw_t<io_, bitpos::B6> B6;
 		};
-		static odr0_t<base> ODR0;
+		static IO_SIM_INLINE odr0_t<base> ODR0;
 	};
 
 
@@ -362,7 +362,7 @@ namespace device {
 			@brief  ポート方向レジスタ
 		*/
 		//-----------------------------------------------------------------//
-		static bit_rw_t<rw8_t<PORTX::base_address_ + 0x00>, BPOS> DIR;
+		static IO_SIM_INLINE bit_rw_t<rw8_t<PORTX::base_address_ + 0x00>, BPOS> DIR;
 
 
 		//-----------------------------------------------------------------//
@@ -386,7 +386,7 @@ namespace device {
 			@brief  プルアップ制御・レジスタ
 		*/
 		//-----------------------------------------------------------------//
-		static bit_rw_t<rw8_t<PORTX::base_address_ + 0xC0>, BPOS> PU;
+		static IO_SIM_INLINE bit_rw_t<rw8_t<PORTX::base_address_ + 0xC0>, BPOS> PU;
 
 
 		//-----------------------------------------------------------------//
@@ -395,8 +395,8 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 		struct od_t {
-			static rw8_t<PORTX::base_address_ + 0x80> ODR0;
-			static rw8_t<PORTX::base_address_ + 0x81> ODR1;
+			static IO_SIM_INLINE rw8_t<PORTX::base_address_ + 0x80> ODR0;
+			static IO_SIM_INLINE rw8_t<PORTX::base_address_ + 0x81> ODR1;
 
 			void operator = (OD_TYPE val) {
 				uint8_t pos = static_cast<uint8_t>(BPOS);
@@ -419,7 +419,7 @@ namespace device {
 				}
 			}
 		};
-		static od_t OD;
+		static IO_SIM_INLINE od_t OD;
 
 
 		//-----------------------------------------------------------------//
@@ -429,13 +429,13 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 		struct port_t {
-			static bit_rw_t<rw8_t<PORTX::base_address_ + 0x20>, BPOS> PO;  // ポート出力用
-			static bit_ro_t<ro8_t<PORTX::base_address_ + 0x40>, BPOS> PI;  // ポート入力用
+			static IO_SIM_INLINE bit_rw_t<rw8_t<PORTX::base_address_ + 0x20>, BPOS> PO;  // ポート出力用
+			static IO_SIM_INLINE bit_ro_t<ro8_t<PORTX::base_address_ + 0x40>, BPOS> PI;  // ポート入力用
 
 			void operator = (bool val) { PO = val; }
 			bool operator () () { return PI(); }
 		};
-		static port_t P;
+		static IO_SIM_INLINE port_t P;
 	};
 
 
@@ -456,7 +456,7 @@ namespace device {
 			@brief  ポート方向レジスタ
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<PORTx::base_address_ + 0x00> DIR;
+		static IO_SIM_INLINE rw8_t<PORTx::base_address_ + 0x00> DIR;
 
 
 		//-----------------------------------------------------------------//
@@ -464,7 +464,7 @@ namespace device {
 			@brief  プルアップ制御・レジスタ
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<PORTx::base_address_ + 0xC0> PU;
+		static IO_SIM_INLINE rw8_t<PORTx::base_address_ + 0xC0> PU;
 
 
 #if 0
@@ -474,8 +474,8 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 		struct od_t {
-			static rw8_t<PORTx::base_address_ + 0x80> ODR0;
-			static rw8_t<PORTx::base_address_ + 0x81> ODR1;
+			static IO_SIM_INLINE rw8_t<PORTx::base_address_ + 0x80> ODR0;
+			static IO_SIM_INLINE rw8_t<PORTx::base_address_ + 0x81> ODR1;
 
 			void operator = (bool val) {
 				uint8_t pos = static_cast<uint8_t>(bpos);
@@ -498,7 +498,7 @@ namespace device {
 				}
 			}
 		};
-		static od_t OD;
+		static IO_SIM_INLINE od_t OD;
 #endif
 
 		//-----------------------------------------------------------------//
@@ -508,13 +508,13 @@ namespace device {
 		*/
 		//-----------------------------------------------------------------//
 		struct port_t {
-			static rw8_t<PORTx::base_address_ + 0x20> PO;  // ポート出力用
-			static ro8_t<PORTx::base_address_ + 0x40> PI;  // ポート入力用
+			static IO_SIM_INLINE rw8_t<PORTx::base_address_ + 0x20> PO;  // ポート出力用
+			static IO_SIM_INLINE ro8_t<PORTx::base_address_ + 0x40> PI;  // ポート入力用
 
 			void operator = (uint8_t val) { PO = val; }
 			uint8_t operator () () { return PI(); }
 		};
-		static port_t P;
+		static IO_SIM_INLINE port_t P;
 	};
 
 
@@ -538,7 +538,7 @@ namespace device {
 			@brief  ポート方向レジスタ
 		*/
 		//-----------------------------------------------------------------//
-		static null_t DIR;
+		static IO_SIM_INLINE null_t DIR;
 
 
 		//-----------------------------------------------------------------//
@@ -546,7 +546,7 @@ namespace device {
 			@brief  プルアップ制御・レジスタ
 		*/
 		//-----------------------------------------------------------------//
-		static null_t PU;
+		static IO_SIM_INLINE null_t PU;
 
 
 		//-----------------------------------------------------------------//
@@ -554,7 +554,7 @@ namespace device {
 			@brief  オープンドレイン制御・レジスタ
 		*/
 		//-----------------------------------------------------------------//
-		static null_t OD;
+		static IO_SIM_INLINE null_t OD;
 
 
 		//-----------------------------------------------------------------//
@@ -562,7 +562,7 @@ namespace device {
 			@brief  ポート・レジスタ
 		*/
 		//-----------------------------------------------------------------//
-		static null_t P;
+		static IO_SIM_INLINE null_t P;
 	};
 
 
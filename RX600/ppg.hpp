@@ -38,7 +38,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  PTRSL;
 		};
-		static ptrslr_t<0x000881F0> PTRSLR;
+		static IO_SIM_INLINE ptrslr_t<0x000881F0> PTRSLR;
 
 
 		//-----------------------------------------------------------------//
@@ -64,7 +64,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  NDR14;
 			bit_rw_t<io_, bitpos::B7>  NDR15;
 		};
-		static ndrh_t<0x000881EC + ch * 2> NDRH;
+		static IO_SIM_INLINE ndrh_t<0x000881EC + ch * 2> NDRH;
 
 
 		//-----------------------------------------------------------------//
@@ -90,7 +90,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  NDR6;
 			bit_rw_t<io_, bitpos::B7>  NDR7;
 		};
-		static ndrl_t<0x000881ED + ch * 2> NDRL;
+		static IO_SIM_INLINE ndrl_t<0x000881ED + ch * 2> NDRL;
 
 
 		//-----------------------------------------------------------------//
@@ -112,7 +112,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2>  G2CMS;
 			bits_rw_t<io_, bitpos::B6, 2>  G3CMS;
 		};
-		static pcr_t<0x000881E6 + ch * 0x10> PCR;
+		static IO_SIM_INLINE pcr_t<0x000881E6 + ch * 0x10> PCR;
 
 
 		//-----------------------------------------------------------------//
@@ -138,7 +138,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  G2INV;
 			bit_rw_t<io_, bitpos::B7>  G3INV;
 		};
-		static pmr_t<0x000881E7 + ch * 0x10> PMR;
+		static IO_SIM_INLINE pmr_t<0x000881E7 + ch * 0x10> PMR;
 
 
 		//-----------------------------------------------------------------//
@@ -184,7 +184,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  NDER14;
 			bit_rw_t<io_, bitpos::B7>  NDER15;
 		};
-		static nderh_t<0x000881E8> NDERH;
+		static IO_SIM_INLINE nderh_t<0x000881E8> NDERH;
 
 
 		//-----------------------------------------------------------------//
@@ -210,7 +210,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  NDER6;
 			bit_rw_t<io_, bitpos::B7>  NDER7;
 		};
-		static nderl_t<0x000881E9> NDERL;
+		static IO_SIM_INLINE nderl_t<0x000881E9> NDERL;
 
 
 		//-----------------------------------------------------------------//
@@ -236,7 +236,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  POD14;
 			bit_rw_t<io_, bitpos::B7>  POD15;
 		};
-		static podrh_t<0x000881EA> PODRH;
+		static IO_SIM_INLINE podrh_t<0x000881EA> PODRH;
 
 
 		//-----------------------------------------------------------------//
@@ -262,7 +262,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  POD6;
 			bit_rw_t<io_, bitpos::B7>  POD7;
 		};
-		static podrl_t<0x000881EB> PODRL;
+		static IO_SIM_INLINE podrl_t<0x000881EB> PODRL;
 	};
 
 
@@ -299,7 +299,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  NDER30;
 			bit_rw_t<io_, bitpos::B7>  NDER31;
 		};
-		static nderh_t<0x000881F8> NDERH;
+		static IO_SIM_INLINE nderh_t<0x000881F8> NDERH;
 
 
 		//-----------------------------------------------------------------//
@@ -325,7 +325,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  NDER22;
 			bit_rw_t<io_, bitpos::B7>  NDER23;
 		};
-		static nderl_t<0x000881F9> NDERL;
+		static IO_SIM_INLINE nderl_t<0x000881F9> NDERL;
 
 
 		//-----------------------------------------------------------------//
@@ -351,7 +351,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  POD30;
 			bit_rw_t<io_, bitpos::B7>  POD31;
 		};
-		static podrh_t<0x000881FA> PODRH;
+		static IO_SIM_INLINE podrh_t<0x000881FA> PODRH;
 
 
 		//-----------------------------------------------------------------//
@@ -377,7 +377,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  POD22;
 			bit_rw_t<io_, bitpos::B7>  POD23;
 		};
-		static podrl_t<0x000881FB> PODRL;
+		static IO_SIM_INLINE podrl_t<0x000881FB> PODRL;
 	};
 
 
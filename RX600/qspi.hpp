@@ -43,7 +43,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> SPE;
 			bit_rw_t<io_, bitpos::B7> SPRIE;
 		};
-		static spcr_t<base + 0x00> SPCR;
+		static IO_SIM_INLINE spcr_t<base + 0x00> SPCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -62,7 +62,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> SSLP;
 		};
-		static sslp_t<base + 0x01> SSLP;
+		static IO_SIM_INLINE sslp_t<base + 0x01> SSLP;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -85,7 +85,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>	MOIFV;
 			bit_rw_t<io_, bitpos::B5>	MOIFE;
 		};
-		static sppcr_t<base + 0x02> SPPCR;
+		static IO_SIM_INLINE sppcr_t<base + 0x02> SPPCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -107,7 +107,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> TREND;
 			bit_rw_t<io_, bitpos::B7> SPRFF;
 		};
-		static spsr_t<base + 0x03> SPSR;
+		static IO_SIM_INLINE spsr_t<base + 0x03> SPSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -116,9 +116,9 @@ namespace device {
 			@param[in]	ofs	レジスター・オフセット
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<base + 0x04> SPDR;
-		static rw16_t<base + 0x04> SPDR16;
-		static rw8_t<base + 0x04> SPDR8;
+		static IO_SIM_INLINE rw32_t<base + 0x04> SPDR;
+		static IO_SIM_INLINE rw16_t<base + 0x04> SPDR16;
+		static IO_SIM_INLINE rw8_t<base + 0x04> SPDR8;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -137,7 +137,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2> SPSC;
 		};
-		static spscr_t<base + 0x08> SPSCR;
+		static IO_SIM_INLINE spscr_t<base + 0x08> SPSCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -156,7 +156,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2> SPSS;
 		};
-		static spssr_t<base + 0x09> SPSSR;
+		static IO_SIM_INLINE spssr_t<base + 0x09> SPSSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -164,7 +164,7 @@ namespace device {
 			@brief  QSPI ビットレートレジスタ（SPBR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw8_t<base + 0x0A> SPBR;
+		static IO_SIM_INLINE rw8_t<base + 0x0A> SPBR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -183,7 +183,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B7>  TXDMY;
 		};
-		static spdcr_t<base + 0x0B> SPDCR;
+		static IO_SIM_INLINE spdcr_t<base + 0x0B> SPDCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -202,7 +202,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3> SCKDL;
 		};
-		static spckd_t<base + 0x0C> SPCKD;
+		static IO_SIM_INLINE spckd_t<base + 0x0C> SPCKD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -221,7 +221,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3> SLNDL;
 		};
-		static sslnd_t<base + 0x0D> SSLND;
+		static IO_SIM_INLINE sslnd_t<base + 0x0D> SSLND;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -240,7 +240,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3> SPNDL;
 		};
-		static spnd_t<base + 0x0E> SPND;
+		static IO_SIM_INLINE spnd_t<base + 0x0E> SPND;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -269,10 +269,10 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>   SLNDEN;
 			bit_rw_t <io_, bitpos::B15>   SCKDEN;
 		};
-		static spcmd_t<base + 0x10> SPCMD0;
-		static spcmd_t<base + 0x12> SPCMD1;
-		static spcmd_t<base + 0x14> SPCMD2;
-		static spcmd_t<base + 0x16> SPCMD3;
+		static IO_SIM_INLINE spcmd_t<base + 0x10> SPCMD0;
+		static IO_SIM_INLINE spcmd_t<base + 0x12> SPCMD1;
+		static IO_SIM_INLINE spcmd_t<base + 0x14> SPCMD2;
+		static IO_SIM_INLINE spcmd_t<base + 0x16> SPCMD3;
 
 
 		//-----------------------------------------------------------------//
@@ -31,7 +31,7 @@ namespace device {
 			@brief  D/A データレジスタ 0（DADR0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x00088040> DADR0;
+		static IO_SIM_INLINE rw16_t<0x00088040> DADR0;
 
 
 		//-----------------------------------------------------------------//
@@ -39,7 +39,7 @@ namespace device {
 			@brief  D/A データレジスタ 1（DADR1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x00088042> DADR1;
+		static IO_SIM_INLINE rw16_t<0x00088042> DADR1;
 
 
 		//-----------------------------------------------------------------//
@@ -60,7 +60,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> DAOE0;
 			bit_rw_t<io_, bitpos::B7> DAOE1;
 		};
-		static dacr_t<0x00088044> DACR;
+		static IO_SIM_INLINE dacr_t<0x00088044> DACR;
 
 
 		//-----------------------------------------------------------------//
@@ -79,7 +79,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7> DPSEL;
 		};
-		static dadpr_t<0x00088045> DADPR;
+		static IO_SIM_INLINE dadpr_t<0x00088045> DADPR;
 
 
 		//-----------------------------------------------------------------//
@@ -98,7 +98,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7> DAADST;
 		};
-		static daadscr_t<0x00088046> DAADSCR;
+		static IO_SIM_INLINE daadscr_t<0x00088046> DAADSCR;
 
 
 		//-----------------------------------------------------------------//
@@ -151,7 +151,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> DAAMP0;
 			bit_rw_t<io_, bitpos::B7> DAAMP1;
 		};
-		static daampcr_t<0x00088048> DAAMPCR;
+		static IO_SIM_INLINE daampcr_t<0x00088048> DAAMPCR;
 
 
 		//-----------------------------------------------------------------//
@@ -170,7 +170,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B1> AMADSEL1;
 		};
-		static daadusr_t<0x0008C5C0> DAADUSR;
+		static IO_SIM_INLINE daadusr_t<0x0008C5C0> DAADUSR;
 
 
 		//-----------------------------------------------------------------//
@@ -244,7 +244,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  OUTREF0;
 			bit_rw_t<io_, bitpos::B3>  OUTREF1;
 		};
-		static dadselr_t<0x00088049> DADSELR;
+		static IO_SIM_INLINE dadselr_t<0x00088049> DADSELR;
 
 
 		//-----------------------------------------------------------------//
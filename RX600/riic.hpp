@@ -50,7 +50,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> IICRST;
 			bit_rw_t<io_, bitpos::B7> ICE;
 		};
-		static iccr1_t<base + 0x00> ICCR1;
+		static IO_SIM_INLINE iccr1_t<base + 0x00> ICCR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -73,7 +73,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> MST;
 			bit_rw_t<io_, bitpos::B7> BBSY;
 		};
-		static iccr2_t<base + 0x01> ICCR2;
+		static IO_SIM_INLINE iccr2_t<base + 0x01> ICCR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -94,7 +94,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 3> CKS;
 			bit_rw_t <io_, bitpos::B7>    MTWP;
 		};
-		static icmr1_t<base + 0x02> ICMR1;
+		static IO_SIM_INLINE icmr1_t<base + 0x02> ICMR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -116,7 +116,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 3> SDDL;
 			bit_rw_t <io_, bitpos::B7>    DLCS;
 		};
-		static icmr2_t<base + 0x03> ICMR2;
+		static IO_SIM_INLINE icmr2_t<base + 0x03> ICMR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -140,7 +140,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>    WAIT;
 			bit_rw_t <io_, bitpos::B7>    SMBS;
 		};
-		static icmr3_t<base + 0x04> ICMR3;
+		static IO_SIM_INLINE icmr3_t<base + 0x04> ICMR3;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -165,7 +165,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> SCLE;
 			bit_rw_t<io_, bitpos::B7> FMPE;
 		};
-		static icfer_t<base + 0x05> ICFER;
+		static IO_SIM_INLINE icfer_t<base + 0x05> ICFER;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -188,7 +188,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5> DIDE;
 			bit_rw_t<io_, bitpos::B7> HOAE;
 		};
-		static icser_t<base + 0x06> ICSER;
+		static IO_SIM_INLINE icser_t<base + 0x06> ICSER;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -213,7 +213,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> TEIE;
 			bit_rw_t<io_, bitpos::B7> TIE;
 		};
-		static icier_t<base + 0x07> ICIER;
+		static IO_SIM_INLINE icier_t<base + 0x07> ICIER;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -236,7 +236,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5> DID;
 			bit_rw_t<io_, bitpos::B7> HOA;
 		};
-		static icsr1_t<base + 0x08> ICSR1;
+		static IO_SIM_INLINE icsr1_t<base + 0x08> ICSR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -261,7 +261,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> TEND;
 			bit_rw_t<io_, bitpos::B7> TDRE;
 		};
-		static icsr2_t<base + 0x09> ICSR2;
+		static IO_SIM_INLINE icsr2_t<base + 0x09> ICSR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -280,9 +280,9 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>    SVA0;
 			bits_rw_t<io_, bitpos::B1, 7> SVA;
 		};
-		static sarly_t<base + 0x0A> SARL0;
-		static sarly_t<base + 0x0C> SARL1;
-		static sarly_t<base + 0x0E> SARL2;
+		static IO_SIM_INLINE sarly_t<base + 0x0A> SARL0;
+		static IO_SIM_INLINE sarly_t<base + 0x0C> SARL1;
+		static IO_SIM_INLINE sarly_t<base + 0x0E> SARL2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -301,9 +301,9 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>    FS;
 			bits_rw_t<io_, bitpos::B1, 2> SVA;
 		};
-		static saruy_t<base + 0x0B> SARU0;
-		static saruy_t<base + 0x0D> SARU1;
-		static saruy_t<base + 0x0F> SARU2;
+		static IO_SIM_INLINE saruy_t<base + 0x0B> SARU0;
+		static IO_SIM_INLINE saruy_t<base + 0x0D> SARU1;
+		static IO_SIM_INLINE saruy_t<base + 0x0F> SARU2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -321,7 +321,7 @@ namespace device {
 
 			bits_rw_t <io_, bitpos::B0, 5> BRL;
 		};
-		static icbrl_t<base + 0x10> ICBRL;
+		static IO_SIM_INLINE icbrl_t<base + 0x10> ICBRL;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -339,7 +339,7 @@ namespace device {
 
 			bits_rw_t <io_, bitpos::B0, 5> BRH;
 		};
-		static icbrh_t<base + 0x11> ICBRH;
+		static IO_SIM_INLINE icbrh_t<base + 0x11> ICBRH;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -347,7 +347,7 @@ namespace device {
 			@brief  I 2 C バス送信データレジスタ (ICDRT)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw8_t<base + 0x12> ICDRT;
+		static IO_SIM_INLINE rw8_t<base + 0x12> ICDRT;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -355,7 +355,7 @@ namespace device {
 			@brief  I 2 C バス受信データレジスタ (ICDRR)
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw8_t<base + 0x13> ICDRR;
+		static IO_SIM_INLINE rw8_t<base + 0x13> ICDRR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -383,7 +383,7 @@ namespace device {
 			@return ベクター型
 		*/
 		//-----------------------------------------------------------------//
-		static ICU::VECTOR get_ee_vec() { return eev; }
+		static INT get_ee_vec() { return eev; }
 
 
 		//-----------------------------------------------------------------//
@@ -410,7 +410,7 @@ namespace device {
 			@return ベクター型
 		*/
 		//-----------------------------------------------------------------//
-		static ICU::VECTOR get_te_vec() { return tev; }
+		static INT get_te_vec() { return tev; }
 	};
 #if defined(SIG_RX24T)
 	typedef riic_t<0x00088300, peripheral::RIIC0, ICU::VECTOR, ICU::VECTOR::RIIC_EEI0,
@@ -47,7 +47,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> SPE;
 			bit_rw_t<io_, bitpos::B7> SPRIE;
 		};
-		static spcr_t<base + 0x00> SPCR;
+		static IO_SIM_INLINE spcr_t<base + 0x00> SPCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -69,7 +69,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2> SSLP2;
 			bit_rw_t<io_, bitpos::B3> SSLP3;
 		};
-		static sslp_t<base + 0x01> SSLP;
+		static IO_SIM_INLINE sslp_t<base + 0x01> SSLP;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -91,7 +91,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>	MOIFV;
 			bit_rw_t<io_, bitpos::B5>	MOIFE;
 		};
-		static sppcr_t<base + 0x02> SPPCR;
+		static IO_SIM_INLINE sppcr_t<base + 0x02> SPPCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -115,7 +115,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5> SPTEF;
 			bit_rw_t<io_, bitpos::B7> SPRF;
 		};
-		static spsr_t<base + 0x03> SPSR;
+		static IO_SIM_INLINE spsr_t<base + 0x03> SPSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -134,7 +134,7 @@ namespace device {
 
 			rw16_t<ofs> H;
 		};
-		static spdr_t<base + 0x04> SPDR;
+		static IO_SIM_INLINE spdr_t<base + 0x04> SPDR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -153,7 +153,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3> SPSLN;
 		};
-		static spscr_t<base + 0x08> SPSCR;
+		static IO_SIM_INLINE spscr_t<base + 0x08> SPSCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -173,7 +173,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3> SPCP;
 			bits_rw_t<io_, bitpos::B4, 3> SPECM;
 		};
-		static spssr_t<base + 0x09> SPSSR;
+		static IO_SIM_INLINE spssr_t<base + 0x09> SPSSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -181,7 +181,7 @@ namespace device {
 			@brief  RSPI ビットレートレジスタ（SPBR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw8_t<base + 0x0A> SPBR;
+		static IO_SIM_INLINE rw8_t<base + 0x0A> SPBR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -201,8 +201,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2> SPFC;
 			bit_rw_t <io_, bitpos::B4>    SPRDTD;
 			bit_rw_t <io_, bitpos::B5>    SPLW;
+			bit_rw_t <io_, bitpos::B6>    SPBYT;
 		};
-		static spdcr_t<base + 0x0B> SPDCR;
+		static IO_SIM_INLINE spdcr_t<base + 0x0B> SPDCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -221,7 +222,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3> SCKDL;
 		};
-		static spckd_t<base + 0x0C> SPCKD;
+		static IO_SIM_INLINE spckd_t<base + 0x0C> SPCKD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -240,7 +241,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3> SLNDL;
 		};
-		static sslnd_t<base + 0x0D> SSLND;
+		static IO_SIM_INLINE sslnd_t<base + 0x0D> SSLND;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -259,7 +260,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3> SPNDL;
 		};
-		static spnd_t<base + 0x0E> SPND;
+		static IO_SIM_INLINE spnd_t<base + 0x0E> SPND;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -282,7 +283,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3> PTE;
 			bit_rw_t<io_, bitpos::B4> SCKASE;
 		};
-		static spcr2_t<base + 0x0F> SPCR2;
+		static IO_SIM_INLINE spcr2_t<base + 0x0F> SPCR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -310,14 +311,14 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>   SLNDEN;
 			bit_rw_t <io_, bitpos::B15>   SCKDEN;
 		};
-		static spcmd_t<base + 0x10> SPCMD0;
-		static spcmd_t<base + 0x12> SPCMD1;
-		static spcmd_t<base + 0x14> SPCMD2;
-		static spcmd_t<base + 0x16> SPCMD3;
-		static spcmd_t<base + 0x18> SPCMD4;
-		static spcmd_t<base + 0x1A> SPCMD5;
-		static spcmd_t<base + 0x1C> SPCMD6;
-		static spcmd_t<base + 0x1E> SPCMD7;
+		static IO_SIM_INLINE spcmd_t<base + 0x10> SPCMD0;
+		static IO_SIM_INLINE spcmd_t<base + 0x12> SPCMD1;
+		static IO_SIM_INLINE spcmd_t<base + 0x14> SPCMD2;
+		static IO_SIM_INLINE spcmd_t<base + 0x16> SPCMD3;
+		static IO_SIM_INLINE spcmd_t<base + 0x18> SPCMD4;
+		static IO_SIM_INLINE spcmd_t<base + 0x1A> SPCMD5;
+		static IO_SIM_INLINE spcmd_t<base + 0x1C> SPCMD6;
+		static IO_SIM_INLINE spcmd_t<base + 0x1E> SPCMD7;
 
 
 		//-----------------------------------------------------------------//
@@ -399,7 +400,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  BYSW;
 		};
-		static spdcr2_t<base + 0x20> SPDCR2;
+		static IO_SIM_INLINE spdcr2_t<base + 0x20> SPDCR2;
 	};
 #if defined(SIG_RX66T)
 	typedef rspi_c_t<0x000D0100, peripheral::RSPI0, ICU::VECTOR::SPRI0, ICU::VECTOR::SPTI0>  RSPI0;
@@ -48,7 +48,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5>	F2HZ;
 			bit_rw_t<io_, bitpos::B6>	F1HZ;
 		};
-		static r64cnt_t<0x0008C400> R64CNT;
+		static IO_SIM_INLINE r64cnt_t<0x0008C400> R64CNT;
 
 
 		//-----------------------------------------------------------------//
@@ -68,7 +68,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  SEC1;
 			bits_rw_t<io_, bitpos::B4, 3>  SEC10;
 		};
-		static rseccnt_t<0x0008C402> RSECCNT;
+		static IO_SIM_INLINE rseccnt_t<0x0008C402> RSECCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -76,7 +76,7 @@ namespace device {
 			@brief  バイナリカウンタ 0（BCNT0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C402> BCNT0;
+		static IO_SIM_INLINE rw8_t<0x0008C402> BCNT0;
 
 
 		//-----------------------------------------------------------------//
@@ -96,7 +96,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4>  MIN1;
 			bits_rw_t<io_, bitpos::B4, 3>  MIN10;
 		};
-		static rmincnt_t<0x0008C404> RMINCNT;
+		static IO_SIM_INLINE rmincnt_t<0x0008C404> RMINCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -104,7 +104,7 @@ namespace device {
 			@brief  バイナリカウンタ 1（BCNT1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C404> BCNT1;
+		static IO_SIM_INLINE rw8_t<0x0008C404> BCNT1;
 
 
 		//-----------------------------------------------------------------//
@@ -125,7 +125,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2>  HR10;
 			bit_rw_t <io_, bitpos::B6>     PM;
 		};
-		static rhrcnt_t<0x0008C406> RHRCNT;
+		static IO_SIM_INLINE rhrcnt_t<0x0008C406> RHRCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -133,7 +133,7 @@ namespace device {
 			@brief  バイナリカウンタ 2（BCNT2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C406> BCNT2;
+		static IO_SIM_INLINE rw8_t<0x0008C406> BCNT2;
 
 
 		//-----------------------------------------------------------------//
@@ -152,7 +152,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>  DAYW;
 		};
-		static rwkcnt_t<0x0008C408> RWKCNT;
+		static IO_SIM_INLINE rwkcnt_t<0x0008C408> RWKCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -160,7 +160,7 @@ namespace device {
 			@brief  バイナリカウンタ 3（BCNT3）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C408> BCNT3;
+		static IO_SIM_INLINE rw8_t<0x0008C408> BCNT3;
 
 
 		//-----------------------------------------------------------------//
@@ -180,7 +180,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> DATE1;
 			bits_rw_t<io_, bitpos::B4, 2> DATE10;
 		};
-		static rdaycnt_t<0x0008C40A> RDAYCNT;
+		static IO_SIM_INLINE rdaycnt_t<0x0008C40A> RDAYCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -200,7 +200,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> MON1;
 			bit_rw_t <io_, bitpos::B4>    MON10;
 		};
-		static rmoncnt_t<0x0008C40C> RMONCNT;
+		static IO_SIM_INLINE rmoncnt_t<0x0008C40C> RMONCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -220,7 +220,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> YR1;
 			bits_rw_t<io_, bitpos::B4, 4> YR10;
 		};
-		static ryrcnt_t<0x0008C40E> RYRCNT;
+		static IO_SIM_INLINE ryrcnt_t<0x0008C40E> RYRCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -241,7 +241,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 3> SEC10;
 			bit_rw_t <io_, bitpos::B7>    ENB;
 		};
-		static rsecar_t<0x0008C410> RSECAR;
+		static IO_SIM_INLINE rsecar_t<0x0008C410> RSECAR;
 
 
 		//-----------------------------------------------------------------//
@@ -249,7 +249,7 @@ namespace device {
 			@brief  バイナリカウンタ 0 アラームレジスタ（BCNT0AR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C410> BCNT0AR;
+		static IO_SIM_INLINE rw8_t<0x0008C410> BCNT0AR;
 
 
 		//-----------------------------------------------------------------//
@@ -270,7 +270,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 3> MIN10;
 			bit_rw_t <io_, bitpos::B7>    ENB;
 		};
-		static rminar_t<0x0008C412> RMINAR;
+		static IO_SIM_INLINE rminar_t<0x0008C412> RMINAR;
 
 
 		//-----------------------------------------------------------------//
@@ -278,7 +278,7 @@ namespace device {
 			@brief  バイナリカウンタ 1 アラームレジスタ（BCNT1AR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C412> BCNT1AR;
+		static IO_SIM_INLINE rw8_t<0x0008C412> BCNT1AR;
 
 
 		//-----------------------------------------------------------------//
@@ -300,7 +300,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>    PM;
 			bit_rw_t <io_, bitpos::B7>    ENB;
 		};
-		static rhrar_t<0x0008C414> RHRAR;
+		static IO_SIM_INLINE rhrar_t<0x0008C414> RHRAR;
 
 
 		//-----------------------------------------------------------------//
@@ -308,7 +308,7 @@ namespace device {
 			@brief  バイナリカウンタ 2 アラームレジスタ（BCNT2AR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C414> BCNT2AR;
+		static IO_SIM_INLINE rw8_t<0x0008C414> BCNT2AR;
 
 
 		//-----------------------------------------------------------------//
@@ -329,7 +329,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B7>    ENB;
 		};
-		static rwkar_t<0x0008C416> RWKAR;
+		static IO_SIM_INLINE rwkar_t<0x0008C416> RWKAR;
 
 
 		//-----------------------------------------------------------------//
@@ -337,7 +337,7 @@ namespace device {
 			@brief  バイナリカウンタ 3 アラームレジスタ（BCNT3AR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C416> BCNT3AR;
+		static IO_SIM_INLINE rw8_t<0x0008C416> BCNT3AR;
 
 
 		//-----------------------------------------------------------------//
@@ -358,7 +358,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2> DATE10;
 			bit_rw_t <io_, bitpos::B7>    ENB;
 		};
-		static rdayar_t<0x0008C418> RDAYAR;
+		static IO_SIM_INLINE rdayar_t<0x0008C418> RDAYAR;
 
 
 		//-----------------------------------------------------------------//
@@ -366,7 +366,7 @@ namespace device {
 			@brief  バイナリカウンタ 0 アラーム許可レジスタ（BCNT0AER）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C418> BCNT0AER;
+		static IO_SIM_INLINE rw8_t<0x0008C418> BCNT0AER;
 
 
 		//-----------------------------------------------------------------//
@@ -387,7 +387,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B4>    MON10;
 			bit_rw_t <io_, bitpos::B7>    ENB;
 		};
-		static rmonar_t<0x0008C41A> RMONAR;
+		static IO_SIM_INLINE rmonar_t<0x0008C41A> RMONAR;
 
 
 		//-----------------------------------------------------------------//
@@ -395,7 +395,7 @@ namespace device {
 			@brief  バイナリカウンタ 1 アラーム許可レジスタ（BCNT1AER）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C41A> BCNT1AER;
+		static IO_SIM_INLINE rw8_t<0x0008C41A> BCNT1AER;
 
 
 		//-----------------------------------------------------------------//
@@ -415,7 +415,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> YR1;
 			bits_rw_t<io_, bitpos::B4, 4> YR10;
 		};
-		static ryrar_t<0x0008C41C> RYRAR;
+		static IO_SIM_INLINE ryrar_t<0x0008C41C> RYRAR;
 
 
 		//-----------------------------------------------------------------//
@@ -423,7 +423,7 @@ namespace device {
 			@brief  バイナリカウンタ 2 アラーム許可レジスタ（BCNT2AER）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C41C> BCNT2AER;
+		static IO_SIM_INLINE rw8_t<0x0008C41C> BCNT2AER;
 
 
 		//-----------------------------------------------------------------//
@@ -442,7 +442,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  ENB;
 		};
-		static ryraren_t<0x0008C41E> RYRAREN;
+		static IO_SIM_INLINE ryraren_t<0x0008C41E> RYRAREN;
 
 
 		//-----------------------------------------------------------------//
@@ -450,7 +450,7 @@ namespace device {
 			@brief  バイナリカウンタ 3 アラーム許可レジスタ（BCNT3AER）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C41E> BCNT3AER;
+		static IO_SIM_INLINE rw8_t<0x0008C41E> BCNT3AER;
 
 
 		//-----------------------------------------------------------------//
@@ -473,7 +473,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B3>	  RTCOS;
 			bits_rw_t<io_, bitpos::B4, 4> PES;
 		};
-		static rcr1_t<0x0008C422> RCR1;
+		static IO_SIM_INLINE rcr1_t<0x0008C422> RCR1;
 
 
 		//-----------------------------------------------------------------//
@@ -499,7 +499,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  HR24;
 			bit_rw_t<io_, bitpos::B7>  CNTMD;
 		};
-		static rcr2_t<0x0008C424> RCR2;
+		static IO_SIM_INLINE rcr2_t<0x0008C424> RCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -519,7 +519,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>	  RTCEN;
 			bits_rw_t<io_, bitpos::B1, 3> RTCDV;
 		};
-		static rcr3_t<0x0008C426> RCR3;
+		static IO_SIM_INLINE rcr3_t<0x0008C426> RCR3;
 
 
 		//-----------------------------------------------------------------//
@@ -538,7 +538,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>	  RCKSEL;
 		};
-		static rcr4_t<0x0008C428> RCR4;
+		static IO_SIM_INLINE rcr4_t<0x0008C428> RCR4;
 
 
 		//-----------------------------------------------------------------//
@@ -546,7 +546,7 @@ namespace device {
 			@brief  周波数レジスタ H（RFRH）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x0008C42A> RFRH;
+		static IO_SIM_INLINE rw16_t<0x0008C42A> RFRH;
 
 
 		//-----------------------------------------------------------------//
@@ -554,7 +554,7 @@ namespace device {
 			@brief  周波数レジスタ L（RFRL）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<0x0008C42C> RFRL;
+		static IO_SIM_INLINE rw16_t<0x0008C42C> RFRL;
 
 
 		//-----------------------------------------------------------------//
@@ -574,7 +574,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 5> ADJ;
 			bits_rw_t<io_, bitpos::B6, 2> PMADJ;
 		};
-		static radj_t<0x0008C42E> RADJ;
+		static IO_SIM_INLINE radj_t<0x0008C42E> RADJ;
 
 
 		//-----------------------------------------------------------------//
@@ -596,9 +596,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2> TCNF;
 			bit_rw_t <io_, bitpos::B7>    TCEN;
 		};
-		static rtccr_t<0x0008C440> RTCCR0;
-		static rtccr_t<0x0008C442> RTCCR1;
-		static rtccr_t<0x0008C444> RTCCR2;
+		static IO_SIM_INLINE rtccr_t<0x0008C440> RTCCR0;
+		static IO_SIM_INLINE rtccr_t<0x0008C442> RTCCR1;
+		static IO_SIM_INLINE rtccr_t<0x0008C444> RTCCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -618,9 +618,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> SEC1;
 			bits_rw_t<io_, bitpos::B4, 3> SEC10;
 		};
-		static rseccpy_t<0x0008C452> RSECCPY0;
-		static rseccpy_t<0x0008C462> RSECCPY1;
-		static rseccpy_t<0x0008C472> RSECCPY2;
+		static IO_SIM_INLINE rseccpy_t<0x0008C452> RSECCPY0;
+		static IO_SIM_INLINE rseccpy_t<0x0008C462> RSECCPY1;
+		static IO_SIM_INLINE rseccpy_t<0x0008C472> RSECCPY2;
 
 
 		//-----------------------------------------------------------------//
@@ -628,7 +628,7 @@ namespace device {
 			@brief  BCNT0 キャプチャレジスタ 0（BCNT0CP0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C452> BCNT0CP0;
+		static IO_SIM_INLINE rw8_t<0x0008C452> BCNT0CP0;
 
 
 		//-----------------------------------------------------------------//
@@ -636,7 +636,7 @@ namespace device {
 			@brief  BCNT0 キャプチャレジスタ 1（BCNT0CP1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C462> BCNT0CP1;
+		static IO_SIM_INLINE rw8_t<0x0008C462> BCNT0CP1;
 
 
 		//-----------------------------------------------------------------//
@@ -644,7 +644,7 @@ namespace device {
 			@brief  BCNT0 キャプチャレジスタ 2（BCNT0CP2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C472> BCNT0CP2;
+		static IO_SIM_INLINE rw8_t<0x0008C472> BCNT0CP2;
 
 
 		//-----------------------------------------------------------------//
@@ -664,9 +664,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> MIN1;
 			bits_rw_t<io_, bitpos::B4, 3> MIN10;
 		};
-		static rmincpy_t<0x0008C454> RMINCP0;
-		static rmincpy_t<0x0008C464> RMINCP1;
-		static rmincpy_t<0x0008C474> RMINCP2;
+		static IO_SIM_INLINE rmincpy_t<0x0008C454> RMINCP0;
+		static IO_SIM_INLINE rmincpy_t<0x0008C464> RMINCP1;
+		static IO_SIM_INLINE rmincpy_t<0x0008C474> RMINCP2;
 
 
 		//-----------------------------------------------------------------//
@@ -674,7 +674,7 @@ namespace device {
 			@brief  BCNT1 キャプチャレジスタ 0（BCNT1CP0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C454> BCNT1CP0;
+		static IO_SIM_INLINE rw8_t<0x0008C454> BCNT1CP0;
 
 
 		//-----------------------------------------------------------------//
@@ -682,7 +682,7 @@ namespace device {
 			@brief  BCNT1 キャプチャレジスタ 1（BCNT1CP1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C464> BCNT1CP1;
+		static IO_SIM_INLINE rw8_t<0x0008C464> BCNT1CP1;
 
 
 		//-----------------------------------------------------------------//
@@ -690,7 +690,7 @@ namespace device {
 			@brief  BCNT1 キャプチャレジスタ 2（BCNT1CP2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C474> BCNT1CP2;
+		static IO_SIM_INLINE rw8_t<0x0008C474> BCNT1CP2;
 
 
 		//-----------------------------------------------------------------//
@@ -711,9 +711,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2> HR10;
 			bit_rw_t <io_, bitpos::B6>    PM;
 		};
-		static rhrcpy_t<0x0008C456> RHRCP0;
-		static rhrcpy_t<0x0008C466> RHRCP1;
-		static rhrcpy_t<0x0008C476> RHRCP2;
+		static IO_SIM_INLINE rhrcpy_t<0x0008C456> RHRCP0;
+		static IO_SIM_INLINE rhrcpy_t<0x0008C466> RHRCP1;
+		static IO_SIM_INLINE rhrcpy_t<0x0008C476> RHRCP2;
 
 
 		//-----------------------------------------------------------------//
@@ -721,7 +721,7 @@ namespace device {
 			@brief  BCNT2 キャプチャレジスタ 0（BCNT2CP0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C456> BCNT2CP0;
+		static IO_SIM_INLINE rw8_t<0x0008C456> BCNT2CP0;
 
 
 		//-----------------------------------------------------------------//
@@ -729,7 +729,7 @@ namespace device {
 			@brief  BCNT2 キャプチャレジスタ 1（BCNT2CP1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C466> BCNT2CP1;
+		static IO_SIM_INLINE rw8_t<0x0008C466> BCNT2CP1;
 
 
 		//-----------------------------------------------------------------//
@@ -737,7 +737,7 @@ namespace device {
 			@brief  BCNT2 キャプチャレジスタ 2（BCNT2CP2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C476> BCNT2CP2;
+		static IO_SIM_INLINE rw8_t<0x0008C476> BCNT2CP2;
 
 
 		//-----------------------------------------------------------------//
@@ -757,9 +757,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> DATE1;
 			bits_rw_t<io_, bitpos::B4, 2> DATE10;
 		};
-		static rdaycpy_t<0x0008C45A> RDAYCP0;
-		static rdaycpy_t<0x0008C46A> RDAYCP1;
-		static rdaycpy_t<0x0008C47A> RDAYCP2;
+		static IO_SIM_INLINE rdaycpy_t<0x0008C45A> RDAYCP0;
+		static IO_SIM_INLINE rdaycpy_t<0x0008C46A> RDAYCP1;
+		static IO_SIM_INLINE rdaycpy_t<0x0008C47A> RDAYCP2;
 
 
 		//-----------------------------------------------------------------//
@@ -767,7 +767,7 @@ namespace device {
 			@brief  BCNT3 キャプチャレジスタ 0（BCNT3CP0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C45A> BCNT3CP0;
+		static IO_SIM_INLINE rw8_t<0x0008C45A> BCNT3CP0;
 
 
 		//-----------------------------------------------------------------//
@@ -775,7 +775,7 @@ namespace device {
 			@brief  BCNT3 キャプチャレジスタ 1（BCNT3CP1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C46A> BCNT3CP1;
+		static IO_SIM_INLINE rw8_t<0x0008C46A> BCNT3CP1;
 
 
 		//-----------------------------------------------------------------//
@@ -783,7 +783,7 @@ namespace device {
 			@brief  BCNT3 キャプチャレジスタ 2（BCNT3CP2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<0x0008C47A> BCNT3CP2;
+		static IO_SIM_INLINE rw8_t<0x0008C47A> BCNT3CP2;
 
 
 		//-----------------------------------------------------------------//
@@ -803,9 +803,9 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> MON1;
 			bit_rw_t <io_, bitpos::B4>    MON10;
 		};
-		static rmoncpy_t<0x0008C45C> RMONCP0;
-		static rmoncpy_t<0x0008C46C> RMONCP1;
-		static rmoncpy_t<0x0008C47C> RMONCP2;
+		static IO_SIM_INLINE rmoncpy_t<0x0008C45C> RMONCP0;
+		static IO_SIM_INLINE rmoncpy_t<0x0008C46C> RMONCP1;
+		static IO_SIM_INLINE rmoncpy_t<0x0008C47C> RMONCP2;
 
 
 		//-----------------------------------------------------------------//
@@ -29,7 +29,7 @@ namespace device {
 			@brief  A/D データレジスタ 0（ADDR0）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x20> ADDR0;
+		static IO_SIM_INLINE ro16_t<base + 0x20> ADDR0;
 
 
 		//-----------------------------------------------------------------//
@@ -37,7 +37,7 @@ namespace device {
 			@brief  A/D データレジスタ 1（ADDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x22> ADDR1;
+		static IO_SIM_INLINE ro16_t<base + 0x22> ADDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -45,7 +45,7 @@ namespace device {
 			@brief  A/D データレジスタ 2（ADDR2）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x24> ADDR2;
+		static IO_SIM_INLINE ro16_t<base + 0x24> ADDR2;
 
 
 		//-----------------------------------------------------------------//
@@ -53,7 +53,7 @@ namespace device {
 			@brief  A/D データレジスタ 3（ADDR3）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x26> ADDR3;
+		static IO_SIM_INLINE ro16_t<base + 0x26> ADDR3;
 
 
 		//-----------------------------------------------------------------//
@@ -61,7 +61,7 @@ namespace device {
 			@brief  A/D データレジスタ 4（ADDR4）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x28> ADDR4;
+		static IO_SIM_INLINE ro16_t<base + 0x28> ADDR4;
 
 
 		//-----------------------------------------------------------------//
@@ -69,7 +69,7 @@ namespace device {
 			@brief  A/D データレジスタ 5（ADDR5）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2A> ADDR5;
+		static IO_SIM_INLINE ro16_t<base + 0x2A> ADDR5;
 
 
 		//-----------------------------------------------------------------//
@@ -77,7 +77,7 @@ namespace device {
 			@brief  A/D データレジスタ 6（ADDR6）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2C> ADDR6;
+		static IO_SIM_INLINE ro16_t<base + 0x2C> ADDR6;
 
 
 		//-----------------------------------------------------------------//
@@ -85,7 +85,7 @@ namespace device {
 			@brief  A/D データレジスタ 7（ADDR7）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2E> ADDR7;
+		static IO_SIM_INLINE ro16_t<base + 0x2E> ADDR7;
 
 
 		//-----------------------------------------------------------------//
@@ -93,7 +93,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ（ADDBLDR）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x18> ADDBLDR;
+		static IO_SIM_INLINE ro16_t<base + 0x18> ADDBLDR;
 
 
 		//-----------------------------------------------------------------//
@@ -101,7 +101,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ A（ADDBLDRA）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x84> ADDBLDRA;
+		static IO_SIM_INLINE ro16_t<base + 0x84> ADDBLDRA;
 
 
 		//-----------------------------------------------------------------//
@@ -109,7 +109,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ B（ADDBLDRB）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x86> ADDBLDRB;
+		static IO_SIM_INLINE ro16_t<base + 0x86> ADDBLDRB;
 
 
 		//-----------------------------------------------------------------//
@@ -129,7 +129,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 12>  AD;
 			bits_rw_t<io_, bitpos::B14, 2>  DIAGST;
 		};
-		static adrd_t<base + 0x1E>  ADRD;
+		static IO_SIM_INLINE adrd_t<base + 0x1E>  ADRD;
 
 
 		//-----------------------------------------------------------------//
@@ -156,7 +156,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B13, 2> ADCS;
 			bit_rw_t <io_, bitpos::B15>    ADST;
 		};
-		static adcsr_t<base + 0x00>  ADCSR;
+		static IO_SIM_INLINE adcsr_t<base + 0x00>  ADCSR;
 
 
 		//-----------------------------------------------------------------//
@@ -176,7 +176,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2>  ADC;
 			bit_rw_t <io_, bitpos::B7>     AVEE;
 		};
-		static adadc_t<base + 0x0C>  ADADC;
+		static IO_SIM_INLINE adadc_t<base + 0x0C>  ADADC;
 
 
 		//-----------------------------------------------------------------//
@@ -200,7 +200,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B11>    DIAGM;
 			bit_rw_t <io_, bitpos::B15>    ADRFMT;
 		};
-		static adcer_t<base + 0x0E>  ADCER;
+		static IO_SIM_INLINE adcer_t<base + 0x0E>  ADCER;
 
 
 		//-----------------------------------------------------------------//
@@ -220,7 +220,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 6>  TRSB;
 			bits_rw_t<io_, bitpos::B8, 6>  TRSA;
 		};
-		static adstrgr_t<base + 0x10>  ADSTRGR;
+		static IO_SIM_INLINE adstrgr_t<base + 0x10>  ADSTRGR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -246,7 +246,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 0（ADSSTR0）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x60> ADSSTR0;
+		static IO_SIM_INLINE adsstrx_t<base + 0x60> ADSSTR0;
 
 
 		//-----------------------------------------------------------------//
@@ -254,7 +254,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 1（ADSSTR1）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x73> ADSSTR1;
+		static IO_SIM_INLINE adsstrx_t<base + 0x73> ADSSTR1;
 
 
 		//-----------------------------------------------------------------//
@@ -262,7 +262,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 2（ADSSTR2）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x74> ADSSTR2;
+		static IO_SIM_INLINE adsstrx_t<base + 0x74> ADSSTR2;
 
 
 		//-----------------------------------------------------------------//
@@ -270,7 +270,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 3（ADSSTR3）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x75> ADSSTR3;
+		static IO_SIM_INLINE adsstrx_t<base + 0x75> ADSSTR3;
 
 
 		//-----------------------------------------------------------------//
@@ -278,7 +278,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 4（ADSSTR4）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x76> ADSSTR4;
+		static IO_SIM_INLINE adsstrx_t<base + 0x76> ADSSTR4;
 
 
 		//-----------------------------------------------------------------//
@@ -286,7 +286,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 5（ADSSTR5）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x77> ADSSTR5;
+		static IO_SIM_INLINE adsstrx_t<base + 0x77> ADSSTR5;
 
 
 		//-----------------------------------------------------------------//
@@ -294,7 +294,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 6（ADSSTR6）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x78> ADSSTR6;
+		static IO_SIM_INLINE adsstrx_t<base + 0x78> ADSSTR6;
 
 
 		//-----------------------------------------------------------------//
@@ -302,7 +302,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 7（ADSSTR7）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x79> ADSSTR7;
+		static IO_SIM_INLINE adsstrx_t<base + 0x79> ADSSTR7;
 
 
 		//-----------------------------------------------------------------//
@@ -321,7 +321,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5>  ADNDIS;
 		};
-		static addiscr_t<base + 0x7A>  ADDISCR;
+		static IO_SIM_INLINE addiscr_t<base + 0x7A>  ADDISCR;
 
 
 		//-----------------------------------------------------------------//
@@ -342,7 +342,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1>   GBRSCN;
 			bit_rw_t<io_, bitpos::B15>  GBRP;
 		};
-		static adgspcr_t<base + 0x80>  ADGSPCR;
+		static IO_SIM_INLINE adgspcr_t<base + 0x80>  ADGSPCR;
 
 
 		//-----------------------------------------------------------------//
@@ -362,7 +362,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>   WCMPE;
 			bit_rw_t <io_, bitpos::B7>   CMPIE;
 		};
-		static adcmpcr_t<base + 0x90>  ADCMPCR;
+		static IO_SIM_INLINE adcmpcr_t<base + 0x90>  ADCMPCR;
 
 
 		//-----------------------------------------------------------------//
@@ -370,7 +370,7 @@ namespace device {
 			@brief  A/D コンペアデータレジスタ 0 （ ADCMPDR0 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x9C> ADCMPDR0;
+		static IO_SIM_INLINE rw16_t<base + 0x9C> ADCMPDR0;
 
 
 		//-----------------------------------------------------------------//
@@ -378,7 +378,7 @@ namespace device {
 			@brief  A/D コンペアデータレジスタ 1 （ ADCMPDR1 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x9E> ADCMPDR1;
+		static IO_SIM_INLINE rw16_t<base + 0x9E> ADCMPDR1;
 	};
 
 
@@ -488,7 +488,7 @@ namespace device {
 			}
 
 		};
-		static addr_t ADDR;
+		static IO_SIM_INLINE addr_t ADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -514,7 +514,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  ANSA006;
 			bit_rw_t<io_, bitpos::B7>  ANSA007;
 		};
-		static adansa0_t<base + 0x04>   ADANSA0;
+		static IO_SIM_INLINE adansa0_t<base + 0x04>   ADANSA0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -546,7 +546,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 A
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x04>   ADANSA;
+		static IO_SIM_INLINE adans_t<base + 0x04>   ADANSA;
 
 
 		//-----------------------------------------------------------------//
@@ -554,7 +554,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 B
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x14> ADANSB;
+		static IO_SIM_INLINE adans_t<base + 0x14> ADANSB;
 
 
 		//-----------------------------------------------------------------//
@@ -580,7 +580,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  ANSB006;
 			bit_rw_t<io_, bitpos::B7>  ANSB007;
 		};
-		static adansb0_t<base + 0x14>   ADANSB0;
+		static IO_SIM_INLINE adansb0_t<base + 0x14>   ADANSB0;
 
 
 		//-----------------------------------------------------------------//
@@ -606,7 +606,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  ADS006;
 			bit_rw_t<io_, bitpos::B7>  ADS007;
 		};
-		static adads0_t<base + 0x08>   ADADS0;
+		static IO_SIM_INLINE adads0_t<base + 0x08>   ADADS0;
 
 
 		//-----------------------------------------------------------------//
@@ -619,7 +619,7 @@ namespace device {
 				wr8_(base + 0xE0 + static_cast<uint32_t>(an), v);
 			}
 		};
-		static adsstr_t ADSSTR;
+		static IO_SIM_INLINE adsstr_t ADSSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -639,7 +639,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 8>  SSTSH;
 			bits_rw_t<io_, bitpos::B8, 3>  SHANS;
 		};
-		static adshcr_t<base + 0x66>   ADSHCR;
+		static IO_SIM_INLINE adshcr_t<base + 0x66>   ADSHCR;
 
 
 		//-----------------------------------------------------------------//
@@ -658,7 +658,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  SHMD;
 		};
-		static adshmsr_t<base + 0x7C>  ADSHMSR;
+		static IO_SIM_INLINE adshmsr_t<base + 0x7C>  ADSHMSR;
 
 
 		//-----------------------------------------------------------------//
@@ -677,7 +677,7 @@ namespace device {
 
 			bits_rw_t <io_, bitpos::B0, 8>  CMPS0;
 		};
-		static adcmpansr0_t<base + 0x94>  ADCMPANSR0;
+		static IO_SIM_INLINE adcmpansr0_t<base + 0x94>  ADCMPANSR0;
 
 
 		//-----------------------------------------------------------------//
@@ -696,7 +696,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 8>  CMPL0;
 		};
-		static adcmplr0_t<base + 0x98>  ADCMPLR0;
+		static IO_SIM_INLINE adcmplr0_t<base + 0x98>  ADCMPLR0;
 
 
 		//-----------------------------------------------------------------//
@@ -715,7 +715,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 8>  CMPF0;
 		};
-		static adcmpsr0_t<base + 0xA0>  ADCMPSR0;
+		static IO_SIM_INLINE adcmpsr0_t<base + 0xA0>  ADCMPSR0;
 
 
 		//-----------------------------------------------------------------//
@@ -899,7 +899,7 @@ namespace device {
 			@brief  A/D データレジスタ 8（ADDR8）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x30> ADDR8;
+		static IO_SIM_INLINE ro16_t<base + 0x30> ADDR8;
 
 
 		//-----------------------------------------------------------------//
@@ -907,7 +907,7 @@ namespace device {
 			@brief  A/D データレジスタ 9（ADDR9）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x32> ADDR9;
+		static IO_SIM_INLINE ro16_t<base + 0x32> ADDR9;
 
 
 		//-----------------------------------------------------------------//
@@ -915,7 +915,7 @@ namespace device {
 			@brief  A/D データレジスタ 10（ADDR10）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x34> ADDR10;
+		static IO_SIM_INLINE ro16_t<base + 0x34> ADDR10;
 
 
 		//-----------------------------------------------------------------//
@@ -923,7 +923,7 @@ namespace device {
 			@brief  A/D データレジスタ 11（ADDR11）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x36> ADDR11;
+		static IO_SIM_INLINE ro16_t<base + 0x36> ADDR11;
 
 
 		//-----------------------------------------------------------------//
@@ -931,7 +931,7 @@ namespace device {
 			@brief  A/D データレジスタ 12（ADDR12）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x38> ADDR12;
+		static IO_SIM_INLINE ro16_t<base + 0x38> ADDR12;
 
 
 		//-----------------------------------------------------------------//
@@ -939,7 +939,7 @@ namespace device {
 			@brief  A/D データレジスタ 13（ADDR13）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x3A> ADDR13;
+		static IO_SIM_INLINE ro16_t<base + 0x3A> ADDR13;
 
 
 		//-----------------------------------------------------------------//
@@ -947,7 +947,7 @@ namespace device {
 			@brief  A/D データレジスタ 14（ADDR14）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x3C> ADDR14;
+		static IO_SIM_INLINE ro16_t<base + 0x3C> ADDR14;
 
 
 		//-----------------------------------------------------------------//
@@ -955,7 +955,7 @@ namespace device {
 			@brief  A/D データレジスタ 15（ADDR15）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x3E> ADDR15;
+		static IO_SIM_INLINE ro16_t<base + 0x3E> ADDR15;
 
 
 		//-----------------------------------------------------------------//
@@ -963,7 +963,7 @@ namespace device {
 			@brief  A/D データレジスタ 16（ADDR16）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x40> ADDR16;
+		static IO_SIM_INLINE ro16_t<base + 0x40> ADDR16;
 
 
 		//-----------------------------------------------------------------//
@@ -971,7 +971,7 @@ namespace device {
 			@brief  A/D データレジスタ 17（ADDR17）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x42> ADDR17;
+		static IO_SIM_INLINE ro16_t<base + 0x42> ADDR17;
 
 
 		//-----------------------------------------------------------------//
@@ -979,7 +979,7 @@ namespace device {
 			@brief  A/D データレジスタ 18（ADDR18）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x44> ADDR18;
+		static IO_SIM_INLINE ro16_t<base + 0x44> ADDR18;
 
 
 		//-----------------------------------------------------------------//
@@ -987,7 +987,7 @@ namespace device {
 			@brief  A/D データレジスタ 19（ADDR19）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x46> ADDR19;
+		static IO_SIM_INLINE ro16_t<base + 0x46> ADDR19;
 
 
 		//-----------------------------------------------------------------//
@@ -995,7 +995,7 @@ namespace device {
 			@brief  A/D データレジスタ 20（ADDR20）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x48> ADDR20;
+		static IO_SIM_INLINE ro16_t<base + 0x48> ADDR20;
 
 
 		//-----------------------------------------------------------------//
@@ -1003,7 +1003,7 @@ namespace device {
 			@brief  A/D 温度センサデータレジスタ（ ADTSDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x1A> ADTSDR;
+		static IO_SIM_INLINE ro16_t<base + 0x1A> ADTSDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1011,7 +1011,7 @@ namespace device {
 			@brief   A/D 内部基準電圧データレジスタ（ ADOCDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x01C> ADOCDR;
+		static IO_SIM_INLINE ro16_t<base + 0x01C> ADOCDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1026,7 +1026,7 @@ namespace device {
 				return rd16_(base + 0x20 + static_cast<uint32_t>(an) * 2);
 			}
 		};
-		static addr_t ADDR;
+		static IO_SIM_INLINE addr_t ADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1060,7 +1060,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14> ANSA114;
 			bit_rw_t<io_, bitpos::B15> ANSA115;
 		};
-		static adansa0_t<base + 0x04>   ADANSA0;
+		static IO_SIM_INLINE adansa0_t<base + 0x04>   ADANSA0;
 
 
 		//-----------------------------------------------------------------//
@@ -1083,7 +1083,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>  ANSA119;
 			bit_rw_t<io_, bitpos::B4>  ANSA120;
 		};
-		static adansa1_t<base + 0x06>   ADANSA1;
+		static IO_SIM_INLINE adansa1_t<base + 0x06>   ADANSA1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1125,7 +1125,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ（ADANSA）
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x04> ADANSA;
+		static IO_SIM_INLINE adans_t<base + 0x04> ADANSA;
 
 
 		//-----------------------------------------------------------------//
@@ -1159,7 +1159,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14> ANSB114;
 			bit_rw_t<io_, bitpos::B15> ANSB115;
 		};
-		static adansb0_t<base + 0x14>   ADANSB0;
+		static IO_SIM_INLINE adansb0_t<base + 0x14>   ADANSB0;
 
 
 		//-----------------------------------------------------------------//
@@ -1167,7 +1167,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 B
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x14> ADANSB;
+		static IO_SIM_INLINE adans_t<base + 0x14> ADANSB;
 
 
 		//-----------------------------------------------------------------//
@@ -1190,7 +1190,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>  ANSB119;
 			bit_rw_t<io_, bitpos::B4>  ANSB120;
 		};
-		static adansb1_t<base + 0x16>   ADANSB1;
+		static IO_SIM_INLINE adansb1_t<base + 0x16>   ADANSB1;
 
 
 		//-----------------------------------------------------------------//
@@ -1224,7 +1224,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  ADS114;
 			bit_rw_t<io_, bitpos::B15>  ADS115;
 		};
-		static adads0_t<base + 0x08>   ADADS0;
+		static IO_SIM_INLINE adads0_t<base + 0x08>   ADADS0;
 
 
 		//-----------------------------------------------------------------//
@@ -1247,7 +1247,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>   ADS119;
 			bit_rw_t<io_, bitpos::B4>   ADS120;
 		};
-		static adads1_t<base + 0x10>   ADADS1;
+		static IO_SIM_INLINE adads1_t<base + 0x10>   ADADS1;
 
 
 		//-----------------------------------------------------------------//
@@ -1275,7 +1275,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B13, 2> EXSEL;
 			bit_rw_t<io_, bitpos::B15>     EXOEN;
 		};
-		static adexicr_t<base + 0x12>   ADEXICR;
+		static IO_SIM_INLINE adexicr_t<base + 0x12>   ADEXICR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1301,7 +1301,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ L（ADSSTRL）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x61> ADSSTRL;
+		static IO_SIM_INLINE adsstrx_t<base + 0x61> ADSSTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1309,7 +1309,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ T（ADSSTRT）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x70> ADSSTRT;
+		static IO_SIM_INLINE adsstrx_t<base + 0x70> ADSSTRT;
 
 
 		//-----------------------------------------------------------------//
@@ -1317,7 +1317,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ O（ADSSTRO）
 		*/
 		//-----------------------------------------------------------------//
-		static adsstrx_t<base + 0x71> ADSSTRO;
+		static IO_SIM_INLINE adsstrx_t<base + 0x71> ADSSTRO;
 
 
 		//-----------------------------------------------------------------//
@@ -1330,7 +1330,7 @@ namespace device {
 				wr8_(base + 0xE0 + static_cast<uint32_t>(an), v);
 			}
 		};
-		static adsstr_t ADSSTR;
+		static IO_SIM_INLINE adsstr_t ADSSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -1349,7 +1349,7 @@ namespace device {
 
 			bits_rw_t <io_, bitpos::B0, 16>  CMPS0;
 		};
-		static adcmpansr0_t<base + 0x94>  ADCMPANSR0;
+		static IO_SIM_INLINE adcmpansr0_t<base + 0x94>  ADCMPANSR0;
 
 
 		//-----------------------------------------------------------------//
@@ -1368,7 +1368,7 @@ namespace device {
 
 			bits_rw_t <io_, bitpos::B0, 5>  CMPS1;
 		};
-		static adcmpansr1_t<base + 0x96>  ADCMPANSR1;
+		static IO_SIM_INLINE adcmpansr1_t<base + 0x96>  ADCMPANSR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1388,7 +1388,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>  CMPSTS;
 			bit_rw_t <io_, bitpos::B1>  CMPSOC;
 		};
-		static adcmpanser_t<base + 0x92>  ADCMPANSER;
+		static IO_SIM_INLINE adcmpanser_t<base + 0x92>  ADCMPANSER;
 
 
 		//-----------------------------------------------------------------//
@@ -1407,7 +1407,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>  CMPL0;
 		};
-		static adcmplr0_t<base + 0x98>  ADCMPLR0;
+		static IO_SIM_INLINE adcmplr0_t<base + 0x98>  ADCMPLR0;
 
 
 		//-----------------------------------------------------------------//
@@ -1426,7 +1426,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5>  CMPL1;
 		};
-		static adcmplr1_t<base + 0x9A>  ADCMPLR1;
+		static IO_SIM_INLINE adcmplr1_t<base + 0x9A>  ADCMPLR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1446,7 +1446,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  CMPLTS;
 			bit_rw_t<io_, bitpos::B0>  CMPLOC;
 		};
-		static adcmpler_t<base + 0x93>  ADCMPLER;
+		static IO_SIM_INLINE adcmpler_t<base + 0x93>  ADCMPLER;
 
 
 		//-----------------------------------------------------------------//
@@ -1465,7 +1465,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>  CMPF0;
 		};
-		static adcmpsr0_t<base + 0xA0>  ADCMPSR0;
+		static IO_SIM_INLINE adcmpsr0_t<base + 0xA0>  ADCMPSR0;
 
 
 		//-----------------------------------------------------------------//
@@ -1484,7 +1484,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5>  CMPF1;
 		};
-		static adcmpsr1_t<base + 0xA2>  ADCMPSR1;
+		static IO_SIM_INLINE adcmpsr1_t<base + 0xA2>  ADCMPSR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1504,7 +1504,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  CMPFTS;
 			bit_rw_t<io_, bitpos::B1>  CMPFOC;
 		};
-		static adcmpser_t<base + 0xA4>  ADCMPSER;
+		static IO_SIM_INLINE adcmpser_t<base + 0xA4>  ADCMPSER;
 
 
 		//-----------------------------------------------------------------//
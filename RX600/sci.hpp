@@ -31,7 +31,7 @@ namespace device {
 			@brief  レシーブデータレジスタ (RDR)
 		*/
 		//-----------------------------------------------------------------//
-		static ro8_t<base + 0x05> RDR;
+		static IO_SIM_INLINE ro8_t<base + 0x05> RDR;
 
 
 		//-----------------------------------------------------------------//
@@ -39,9 +39,9 @@ namespace device {
 			@brief  レシーブデータレジスタ H 、 L 、 HL (RDRH 、 RDRL 、 RDRHL)
 		*/
 		//-----------------------------------------------------------------//
-		static ro8_t<base + 0x10> RDRH;
-		static ro8_t<base + 0x11> RDRL;
-		static ro16_t<base + 0x10> RDRHL;
+		static IO_SIM_INLINE ro8_t<base + 0x10> RDRH;
+		static IO_SIM_INLINE ro8_t<base + 0x11> RDRL;
+		static IO_SIM_INLINE ro16_t<base + 0x10> RDRHL;
 
 
 		//-----------------------------------------------------------------//
@@ -68,7 +68,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>	  BLK;
 			bit_rw_t <io_, bitpos::B7>	  GM;
 		};
-		static smr_t SMR;
+		static IO_SIM_INLINE smr_t SMR;
 
 
 		//-----------------------------------------------------------------//
@@ -76,7 +76,7 @@ namespace device {
 			@brief  ビットレートレジスタ (BRR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x01> BRR;
+		static IO_SIM_INLINE rw8_t<base + 0x01> BRR;
 
 
 		//-----------------------------------------------------------------//
@@ -84,7 +84,7 @@ namespace device {
 			@brief	モジュレーションデューティレジスタ（MDDR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x12> MDDR;
+		static IO_SIM_INLINE rw8_t<base + 0x12> MDDR;
 
 
 		//-----------------------------------------------------------------//
@@ -107,7 +107,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>	  RIE;
 			bit_rw_t <io_, bitpos::B7>	  TIE;
 		};
-		static scr_t SCR;
+		static IO_SIM_INLINE scr_t SCR;
 
 
 		//-----------------------------------------------------------------//
@@ -115,7 +115,7 @@ namespace device {
 			@brief  トランスミットデータレジスタ (TDR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x03> TDR;
+		static IO_SIM_INLINE rw8_t<base + 0x03> TDR;
 
 
 		//-----------------------------------------------------------------//
@@ -139,7 +139,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> RDRF;
 			bit_rw_t<io_, bitpos::B7> TDRE;
 		};
-		static ssr_t SSR;
+		static IO_SIM_INLINE ssr_t SSR;
 
 
  		//-----------------------------------------------------------------//
@@ -160,7 +160,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4> CHR1;
 			bit_rw_t<io_, bitpos::B7> BCP2;
 		};
-		static scmr_t SCMR;
+		static IO_SIM_INLINE scmr_t SCMR;
 
 
 		//-----------------------------------------------------------------//
@@ -182,7 +182,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> BGDM;
 			bit_rw_t<io_, bitpos::B7> RXDESEL;
 		};
-		static semr_t SEMR;
+		static IO_SIM_INLINE semr_t SEMR;
 
 
 		//-----------------------------------------------------------------//
@@ -199,7 +199,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3> NFCS;
 		};
-		static snfr_t SNFR;
+		static IO_SIM_INLINE snfr_t SNFR;
 
 
 		//-----------------------------------------------------------------//
@@ -217,7 +217,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>    IICM;
 			bits_rw_t<io_, bitpos::B3, 5> IICDL;
 		};
-		static simr1_t SIMR1;
+		static IO_SIM_INLINE simr1_t SIMR1;
 
 
 		//-----------------------------------------------------------------//
@@ -236,7 +236,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B1> IICCSC;
 			bit_rw_t<io_, bitpos::B5> IICACKT;
 		};
-		static simr2_t SIMR2;
+		static IO_SIM_INLINE simr2_t SIMR2;
 
 
 		//-----------------------------------------------------------------//
@@ -258,7 +258,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2> IICSDAS;
 			bits_rw_t<io_, bitpos::B6, 2> IICSCLS;
 		};
-		static simr3_t SIMR3;
+		static IO_SIM_INLINE simr3_t SIMR3;
 
 
 		//-----------------------------------------------------------------//
@@ -275,7 +275,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> IICACKR;
 		};
-		static sisr_t SISR;
+		static IO_SIM_INLINE sisr_t SISR;
 
 
 		//-----------------------------------------------------------------//
@@ -297,7 +297,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> CKPOL;
 			bit_rw_t<io_, bitpos::B7> CKPH;
 		};
-		static spmr_t SPMR;
+		static IO_SIM_INLINE spmr_t SPMR;
 
 
 		//-----------------------------------------------------------------//
@@ -365,7 +365,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> ESME;
 		};
-		static esmer_t ESMER;
+		static IO_SIM_INLINE esmer_t ESMER;
 
 
 		//-----------------------------------------------------------------//
@@ -385,7 +385,7 @@ namespace device {
 			bit_ro_t<io_, bitpos::B2> RXDSF;
 			bit_rw_t<io_, bitpos::B3> BRME;
 		};
-		static cr0_t CR0;
+		static IO_SIM_INLINE cr0_t CR0;
 	};
 
 
@@ -29,7 +29,7 @@ namespace device {
 			@brief  レシーブ FIFO データレジスタ (FRDR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x0A> FRDR;
+		static IO_SIM_INLINE rw8_t<base + 0x0A> FRDR;
 
 
 		//-----------------------------------------------------------------//
@@ -37,7 +37,7 @@ namespace device {
 			@brief  トランスミット FIFO データレジスタ (FTDR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x06> FTDR;
+		static IO_SIM_INLINE rw8_t<base + 0x06> FTDR;
 
 
 		//-----------------------------------------------------------------//
@@ -59,7 +59,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>	  CHR;
 			bit_rw_t <io_, bitpos::B7>	  CM;
 		};
-		static smr_t SMR;
+		static IO_SIM_INLINE smr_t SMR;
 
 
 		//-----------------------------------------------------------------//
@@ -82,7 +82,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>	  RIE;
 			bit_rw_t <io_, bitpos::B7>	  TIE;
 		};
-		static scr_t SCR;
+		static IO_SIM_INLINE scr_t SCR;
 
 
 		//-----------------------------------------------------------------//
@@ -106,7 +106,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> TEND;
 			bit_rw_t<io_, bitpos::B7> ER;
 		};
-		static fsr_t FSR;
+		static IO_SIM_INLINE fsr_t FSR;
 
 
 		//-----------------------------------------------------------------//
@@ -114,7 +114,7 @@ namespace device {
 			@brief  ビットレートレジスタ (BRR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x02> BRR;
+		static IO_SIM_INLINE rw8_t<base + 0x02> BRR;
 
 
 		//-----------------------------------------------------------------//
@@ -124,7 +124,7 @@ namespace device {
 					※SEMR.MDDRS = 1 の場合に有効
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x02> MDDR;
+		static IO_SIM_INLINE rw8_t<base + 0x02> MDDR;
 
 
 		//-----------------------------------------------------------------//
@@ -147,7 +147,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B6, 2>  RTRG;
 			bits_rw_t<io_, bitpos::B8, 3>  RSTRG;
 		};
-		static fcr_t FCR;
+		static IO_SIM_INLINE fcr_t FCR;
 
 
 		//-----------------------------------------------------------------//
@@ -162,7 +162,7 @@ namespace device {
 			bits_ro_t<io_, bitpos::B0, 5>  R;
 			bits_ro_t<io_, bitpos::B8, 5>  T;
 		};
-		static fdr_t FDR;
+		static IO_SIM_INLINE fdr_t FDR;
 
 
 		//-----------------------------------------------------------------//
@@ -186,7 +186,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  RTS2DT;
 			bit_rw_t<io_, bitpos::B7>  RTS2IO;
 		};
-		static sptr_t SPTR;
+		static IO_SIM_INLINE sptr_t SPTR;
 
 
 		//-----------------------------------------------------------------//
@@ -205,7 +205,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B2, 4>  FER;
 			bits_rw_t<io_, bitpos::B8, 4>  PER;
 		};
-		static lsr_t LSR;
+		static IO_SIM_INLINE lsr_t LSR;
 
 
 		//-----------------------------------------------------------------//
@@ -225,7 +225,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  5>  RFTC;
 			bit_rw_t <io_, bitpos::B15>     RTRGS;
 		};
-		static ftcr_t FTCR;
+		static IO_SIM_INLINE ftcr_t FTCR;
 
 
 		//-----------------------------------------------------------------//
@@ -247,7 +247,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B5>  BRME;
 			bit_rw_t <io_, bitpos::B7>  BGDM;
 		};
-		static semr_t SEMR;
+		static IO_SIM_INLINE semr_t SEMR;
 
 
 		//-----------------------------------------------------------------//
@@ -46,7 +46,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B13>    TRSTP;
 			bits_rw_t<io_, bitpos::B14, 2> CMD12AT;
 		};
-		static sdcmd_t SDCMD;
+		static IO_SIM_INLINE sdcmd_t SDCMD;
 
 
 		//-----------------------------------------------------------------//
@@ -54,7 +54,7 @@ namespace device {
 			@brief  アーギュメントレジスタ（ SDARG ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x08> SDARG;
+		static IO_SIM_INLINE rw32_t<base + 0x08> SDARG;
 
 
 		//-----------------------------------------------------------------//
@@ -72,7 +72,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  STP;
 			bit_rw_t<io_, bitpos::B8>  SDBLKCNTEN;
 		};
-		static sdstop_t SDSTOP;
+		static IO_SIM_INLINE sdstop_t SDSTOP;
 
 
 		//-----------------------------------------------------------------//
@@ -80,7 +80,7 @@ namespace device {
 			@brief  ブロックカウントレジスタ（ SDBLKCNT ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x14> SDBLKCNT;
+		static IO_SIM_INLINE rw32_t<base + 0x14> SDBLKCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -88,7 +88,7 @@ namespace device {
 			@brief  レスポンスレジスタ 10 （ SDRSP10 ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro32_t<base + 0x18> SDRSP10;
+		static IO_SIM_INLINE ro32_t<base + 0x18> SDRSP10;
 
 
 		//-----------------------------------------------------------------//
@@ -96,7 +96,7 @@ namespace device {
 			@brief  レスポンスレジスタ 32 （ SDRSP32 ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro32_t<base + 0x20> SDRSP32;
+		static IO_SIM_INLINE ro32_t<base + 0x20> SDRSP32;
 
 
 		//-----------------------------------------------------------------//
@@ -104,7 +104,7 @@ namespace device {
 			@brief  レスポンスレジスタ 54 （ SDRSP54 ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro32_t<base + 0x28> SDRSP54;
+		static IO_SIM_INLINE ro32_t<base + 0x28> SDRSP54;
 
 
 		//-----------------------------------------------------------------//
@@ -112,7 +112,7 @@ namespace device {
 			@brief  レスポンスレジスタ 76 （ SDRSP76 ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro32_t<base + 0x30> SDRSP76;
+		static IO_SIM_INLINE ro32_t<base + 0x30> SDRSP76;
 
 
 		//-----------------------------------------------------------------//
@@ -139,7 +139,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B9>  SDD3IN;
 			bit_ro_t<io_, bitpos::B10> SDD3MON;
 		};
-		static sdsts1_t SDSTS1;
+		static IO_SIM_INLINE sdsts1_t SDSTS1;
 
 
 		//-----------------------------------------------------------------//
@@ -169,7 +169,7 @@ namespace device {
 			bit_ro_t<io_, bitpos::B14> CBSY;
 			bit_rw_t<io_, bitpos::B15> ILA;
 		};
-		static sdsts2_t SDSTS2;
+		static IO_SIM_INLINE sdsts2_t SDSTS2;
 
 
 		//-----------------------------------------------------------------//
@@ -193,7 +193,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B8>  SDD3RMM;
 			bit_rw_t<io_, bitpos::B9>  SDD3INM;
 		};
-		static sdimsk1_t SDIMSK1;
+		static IO_SIM_INLINE sdimsk1_t SDIMSK1;
 
 
 		//-----------------------------------------------------------------//
@@ -221,7 +221,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B15> ILAM;
 		};
-		static sdimsk2_t SDIMSK2;
+		static IO_SIM_INLINE sdimsk2_t SDIMSK2;
 
 
 		//-----------------------------------------------------------------//
@@ -240,7 +240,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>     CLKEN;
 			bit_rw_t <io_, bitpos::B9>     CLKCTRLEN;
 		};
-		static sdclkcr_t SDCLKCR;
+		static IO_SIM_INLINE sdclkcr_t SDCLKCR;
 
 
 		//-----------------------------------------------------------------//
@@ -257,7 +257,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>  LEN;
 		};
-		static sdsize_t SDSIZE;
+		static IO_SIM_INLINE sdsize_t SDSIZE;
 
 
 		//-----------------------------------------------------------------//
@@ -277,7 +277,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B15>    WIDTH;
 		};
-		static sdopt_t SDOPT;
+		static IO_SIM_INLINE sdopt_t SDOPT;
 
 
 		//-----------------------------------------------------------------//
@@ -302,7 +302,7 @@ namespace device {
 			bit_ro_t <io_, bitpos::B11>     CRCTKE;
 			bits_ro_t<io_, bitpos::B12, 3>  CRCTK;
 		};
-		static sdersts1_t SDERSTS1;
+		static IO_SIM_INLINE sdersts1_t SDERSTS1;
 
 
 		//-----------------------------------------------------------------//
@@ -322,7 +322,7 @@ namespace device {
 			bit_ro_t<io_, bitpos::B5>  CRCTO;
 			bit_ro_t<io_, bitpos::B6>  CRCBSYTO;
 		};
-		static sdersts2_t SDERSTS2;
+		static IO_SIM_INLINE sdersts2_t SDERSTS2;
 
 
 		//-----------------------------------------------------------------//
@@ -330,7 +330,7 @@ namespace device {
 			@brief  SD バッファレジスタ（ SDBUFR ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x60> SDBUFR;
+		static IO_SIM_INLINE rw32_t<base + 0x60> SDBUFR;
 
 
 		//-----------------------------------------------------------------//
@@ -352,7 +352,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B8>  IOABT;
 			bit_rw_t<io_, bitpos::B9>  C52PUB;
 		};
-		static sdiomd_t SDIOMD;
+		static IO_SIM_INLINE sdiomd_t SDIOMD;
 
 
 		//-----------------------------------------------------------------//
@@ -372,7 +372,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14> EXPUB52;
 			bit_rw_t<io_, bitpos::B15> EXWT;
 		};
-		static sdiosts_t SDIOSTS;
+		static IO_SIM_INLINE sdiosts_t SDIOSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -392,7 +392,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14> EXPUB52M;
 			bit_rw_t<io_, bitpos::B15> EXWTM;
 		};
-		static sdioimsk_t SDIOIMSK;
+		static IO_SIM_INLINE sdioimsk_t SDIOIMSK;
 
 
 		//-----------------------------------------------------------------//
@@ -409,7 +409,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B1>  DMAEN;
 		};
-		static sddmaen_t SDDMAEN;
+		static IO_SIM_INLINE sddmaen_t SDDMAEN;
 
 
 		//-----------------------------------------------------------------//
@@ -426,7 +426,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  SDRST;
 		};
-		static sdrst_t SDRST;
+		static IO_SIM_INLINE sdrst_t SDRST;
 
 
 		//-----------------------------------------------------------------//
@@ -444,7 +444,7 @@ namespace device {
 			bit_ro_t <io_, bitpos::B14>    CLKRAT;
 			bit_ro_t <io_, bitpos::B15>    CPRM;
 		};
-		static sdver_t SDVER;
+		static IO_SIM_INLINE sdver_t SDVER;
 
 
 		//-----------------------------------------------------------------//
@@ -462,7 +462,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  BWSWP;
 			bit_rw_t<io_, bitpos::B7>  BRSWP;
 		};
-		static sdswap_t SDSWAP;
+		static IO_SIM_INLINE sdswap_t SDSWAP;
 
 
 		//-----------------------------------------------------------------//
@@ -42,7 +42,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B11>  FN1ACC;
 		};
-		static fn1accr_t<0x0000> FN1ACCR;
+		static IO_SIM_INLINE fn1accr_t<0x0000> FN1ACCR;
 
 
 		//-----------------------------------------------------------------//
@@ -107,7 +107,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>  SDBMODE;
 			bit_rw_t<io_, bitpos::B4>  SDOPCODE;
 		};
-		static sdcmdcr_t<0x0006> SDCMDCR;
+		static IO_SIM_INLINE sdcmdcr_t<0x0006> SDCMDCR;
 
 
 		//-----------------------------------------------------------------//
@@ -123,7 +123,7 @@ namespace device {
 
 			bits_ro_t<io_, bitpos::B0, 8>  SDCMDACCADD;
 		};
-		static sdcadd0r_t<0x0007> SDCADD0R;
+		static IO_SIM_INLINE sdcadd0r_t<0x0007> SDCADD0R;
 
 
 		//-----------------------------------------------------------------//
@@ -139,7 +139,7 @@ namespace device {
 
 			bits_ro_t<io_, bitpos::B0, 8>  SDCMDACCADD;
 		};
-		static sdcadd1r_t<0x0008> SDCADD1R;
+		static IO_SIM_INLINE sdcadd1r_t<0x0008> SDCADD1R;
 
 
 		//-----------------------------------------------------------------//
@@ -155,7 +155,7 @@ namespace device {
 
 			bits_ro_t<io_, bitpos::B0, 8>  SDCMDACCADD;
 		};
-		static sdcadd2r_t<0x0009> SDCADD2R;
+		static IO_SIM_INLINE sdcadd2r_t<0x0009> SDCADD2R;
 
 
 		//-----------------------------------------------------------------//
@@ -176,7 +176,7 @@ namespace device {
 			bit_ro_t<io_, bitpos::B1>  EPS;
 			bit_ro_t<io_, bitpos::B2>  EMPC;
 		};
-		static sdsicr1_t<0x000A> SDSICR1;
+		static IO_SIM_INLINE sdsicr1_t<0x000A> SDSICR1;
 
 
 		//-----------------------------------------------------------------//
@@ -196,7 +196,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  DMAEN;
 			bit_rw_t<io_, bitpos::B1>  DMALOCKEN;
 		};
-		static dmacr1_t<0x000B> DMACR1;
+		static IO_SIM_INLINE dmacr1_t<0x000B> DMACR1;
 
 
 		//-----------------------------------------------------------------//
@@ -215,7 +215,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 9>  CMD53BLK;
 		};
-		static blkcnt_t<0x000C> BLKCNT;
+		static IO_SIM_INLINE blkcnt_t<0x000C> BLKCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -234,7 +234,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 12>  CMD53BYT;
 		};
-		static bytcnt_t<0x000E> BYTCNT;
+		static IO_SIM_INLINE bytcnt_t<0x000E> BYTCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -253,7 +253,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 32>  DMAADD;
 		};
-		static dmatraddr_t<0x0010> DMATRADDR;
+		static IO_SIM_INLINE dmatraddr_t<0x0010> DMATRADDR;
 
 
 
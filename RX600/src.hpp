@@ -27,7 +27,7 @@ namespace device {
 			@brief  入力データレジスタ（ SRCID ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x0009DFF0> SRCID;
+		static IO_SIM_INLINE rw32_t<0x0009DFF0> SRCID;
 
 
 		//-----------------------------------------------------------------//
@@ -35,7 +35,7 @@ namespace device {
 			@brief  出力データレジスタ（ SRCOD ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<0x0009DFF4> SRCOD;
+		static IO_SIM_INLINE rw32_t<0x0009DFF4> SRCOD;
 
 
 		//-----------------------------------------------------------------//
@@ -56,7 +56,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B8>     IEN;
 			bit_rw_t< io_, bitpos::B9>     IED;
 		};
-		static srcidctrl_t<0x0009DFF8> SRCIDCTRL;
+		static IO_SIM_INLINE srcidctrl_t<0x0009DFF8> SRCIDCTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -78,7 +78,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B9>     OED;
 			bit_rw_t< io_, bitpos::B10>    OCH;
 		};
-		static srcodctrl_t<0x0009DFFA> SRCODCTRL;
+		static IO_SIM_INLINE srcodctrl_t<0x0009DFFA> SRCODCTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -106,7 +106,7 @@ namespace device {
 
 			bit_rw_t< io_, bitpos::B15>    FICRAE;
 		};
-		static srcctrl_t<0x0009DFFC> SRCCTRL;
+		static IO_SIM_INLINE srcctrl_t<0x0009DFFC> SRCCTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -135,7 +135,7 @@ namespace device {
 			bits_rw_t<ro_, bitpos::B11, 5> OFDN;
 
 		};
-		static srcstat_t<0x0009DFFE> SRCSTAT;
+		static IO_SIM_INLINE srcstat_t<0x0009DFFE> SRCSTAT;
 
 
 		//-----------------------------------------------------------------//
@@ -154,7 +154,7 @@ namespace device {
 
 //			void operator[] (uint16_t idx) { put(idx, val); }
 		};
-		static srcfctr_t<0x00098000> SRCFCTR;
+		static IO_SIM_INLINE srcfctr_t<0x00098000> SRCFCTR;
 
 
 		//-----------------------------------------------------------------//
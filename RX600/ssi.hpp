@@ -65,7 +65,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B29>    TUIEN;
 			bit_rw_t< io_, bitpos::B30>    CKS;
 		};
-		static ssicr_t<base + 0x00> SSICR;
+		static IO_SIM_INLINE ssicr_t<base + 0x00> SSICR;
 
 
 		//-----------------------------------------------------------------//
@@ -95,7 +95,7 @@ namespace device {
 			bit_rw_t< rw_, bitpos::B28>    TOIRQ;
 			bit_rw_t< rw_, bitpos::B29>    TUIRQ;
 		};
-		static ssisr_t<base + 0x04> SSISR;
+		static IO_SIM_INLINE ssisr_t<base + 0x04> SSISR;
 
 
 		//-----------------------------------------------------------------//
@@ -123,7 +123,7 @@ namespace device {
 
 			bit_rw_t< io_, bitpos::B31>    AUCKE;
 		};
-		static ssifcr_t<base + 0x10> SSIFCR;
+		static IO_SIM_INLINE ssifcr_t<base + 0x10> SSIFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -146,7 +146,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B16>    TDE;
 			bits_ro_t<ro_, bitpos::B24, 4> TDC;
 		};
-		static ssifsr_t<base + 0x14> SSIFSR;
+		static IO_SIM_INLINE ssifsr_t<base + 0x14> SSIFSR;
 
 
 		//-----------------------------------------------------------------//
@@ -154,7 +154,7 @@ namespace device {
 			@brief  送信 FIFO データレジスタ（ SSIFTDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x18> SSIFTDR;
+		static IO_SIM_INLINE rw32_t<base + 0x18> SSIFTDR;
 
 
 		//-----------------------------------------------------------------//
@@ -162,7 +162,7 @@ namespace device {
 			@brief  受信 FIFO データレジスタ（ SSIFRDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro32_t<base + 0x1C> SSIFRDR;
+		static IO_SIM_INLINE ro32_t<base + 0x1C> SSIFRDR;
 
 
 		//-----------------------------------------------------------------//
@@ -181,7 +181,7 @@ namespace device {
 
 			bit_rw_t< io_, bitpos::B8>     CONT;
 		};
-		static ssitdmr_t<base + 0x20> SSITDMR;
+		static IO_SIM_INLINE ssitdmr_t<base + 0x20> SSITDMR;
 
 
 		//-----------------------------------------------------------------//
@@ -64,7 +64,7 @@ namespace device {
 			bit_rw_t< io_, bitpos::B28>    TOIEN;
 			bit_rw_t< io_, bitpos::B29>    TUIEN;
 		};
-		static ssicr_t<base + 0x00> SSICR;
+		static IO_SIM_INLINE ssicr_t<base + 0x00> SSICR;
 
 
 		//-----------------------------------------------------------------//
@@ -88,7 +88,7 @@ namespace device {
 			bit_rw_t< rw_, bitpos::B28>    TOIRQ;
 			bit_rw_t< rw_, bitpos::B29>    TUIRQ;
 		};
-		static ssisr_t<base + 0x04> SSISR;
+		static IO_SIM_INLINE ssisr_t<base + 0x04> SSISR;
 
 
 		//-----------------------------------------------------------------//
@@ -116,7 +116,7 @@ namespace device {
 
 			bit_rw_t< io_, bitpos::B31>    AUCKE;
 		};
-		static ssifcr_t<base + 0x10> SSIFCR;
+		static IO_SIM_INLINE ssifcr_t<base + 0x10> SSIFCR;
 
 
 		//-----------------------------------------------------------------//
@@ -142,7 +142,7 @@ namespace device {
 
 			bits_ro_t<ro_, bitpos::B24, 4> TDC;
 		};
-		static ssifsr_t<base + 0x14> SSIFSR;
+		static IO_SIM_INLINE ssifsr_t<base + 0x14> SSIFSR;
 
 
 		//-----------------------------------------------------------------//
@@ -150,9 +150,9 @@ namespace device {
 			@brief  送信 FIFO データレジスタ（ SSIFTDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static wo32_t<base + 0x18> SSIFTDR32;
-		static wo16_t<base + 0x18> SSIFTDR16;
-		static wo8_t<base + 0x18> SSIFTDR8;
+		static IO_SIM_INLINE wo32_t<base + 0x18> SSIFTDR32;
+		static IO_SIM_INLINE wo16_t<base + 0x18> SSIFTDR16;
+		static IO_SIM_INLINE wo8_t<base + 0x18> SSIFTDR8;
 
 
 		//-----------------------------------------------------------------//
@@ -160,9 +160,9 @@ namespace device {
 			@brief  受信 FIFO データレジスタ（ SSIFRDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro32_t<base + 0x1C> SSIFRDR32;
-		static ro16_t<base + 0x1C> SSIFRDR16;
-		static ro8_t<base + 0x1C> SSIFRDR8;
+		static IO_SIM_INLINE ro32_t<base + 0x1C> SSIFRDR32;
+		static IO_SIM_INLINE ro16_t<base + 0x1C> SSIFRDR16;
+		static IO_SIM_INLINE ro8_t<base + 0x1C> SSIFRDR8;
 
 
 		//-----------------------------------------------------------------//
@@ -184,7 +184,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>      LRCONT;
 			bit_rw_t <io_, bitpos::B9>      BCKASTP;
 		};
-		static ssiofr_t<base + 0x20> SSIOFR;
+		static IO_SIM_INLINE ssiofr_t<base + 0x20> SSIOFR;
 
 
 		//-----------------------------------------------------------------//
@@ -205,7 +205,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B8, 5>   TDES;
 		};
-		static ssiscr_t<base + 0x24> SSISCR;
+		static IO_SIM_INLINE ssiscr_t<base + 0x24> SSISCR;
 
 
 		//-----------------------------------------------------------------//
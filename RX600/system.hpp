@@ -98,15 +98,15 @@ namespace device {
 			bits_ro_t<io_, bitpos::B0, 3> MDE;
 		};
 #if defined(SIG_RX65N)
-		static spcc_t<0xFE7F5D40> SPCC;
-		static ofs0_t<0xFE7F5D04> OFS0;
-		static ofs1_t<0xFE7F5D08> OFS1;
-		static mde_t <0xFE7F5D00> MDE;
+		static IO_SIM_INLINE spcc_t<0xFE7F5D40> SPCC;
+		static IO_SIM_INLINE ofs0_t<0xFE7F5D04> OFS0;
+		static IO_SIM_INLINE ofs1_t<0xFE7F5D08> OFS1;
+		static IO_SIM_INLINE mde_t <0xFE7F5D00> MDE;
 #else
-		static spcc_t<0x00120040> SPCC;
-		static ofs0_t<0x00120068> OFS0;
-		static ofs1_t<0x0012006C> OFS1;
-		static mde_t <0x00120064> MDE;
+		static IO_SIM_INLINE spcc_t<0x00120040> SPCC;
+		static IO_SIM_INLINE ofs0_t<0x00120068> OFS0;
+		static IO_SIM_INLINE ofs1_t<0x0012006C> OFS1;
+		static IO_SIM_INLINE mde_t <0x00120064> MDE;
 #endif
 
 
@@ -126,7 +126,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>  MD;
 		};
-		static mdmonr_t<0x00080000> MDMONR;
+		static IO_SIM_INLINE mdmonr_t<0x00080000> MDMONR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -145,7 +145,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B5>  UBTS;
 		};
-		static mdsr_t<0x00080002> MDSR;
+		static IO_SIM_INLINE mdsr_t<0x00080002> MDSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -166,7 +166,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B1>     EXBE;
 			bits_rw_t<io_, bitpos::B8, 8>  KEY;
 		};
-		static syscr0_t<0x00080006> SYSCR0;
+		static IO_SIM_INLINE syscr0_t<0x00080006> SYSCR0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -190,7 +190,7 @@ namespace device {
 #endif
 
 		};
-		static syscr1_t<0x00080008> SYSCR1;
+		static IO_SIM_INLINE syscr1_t<0x00080008> SYSCR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -219,7 +219,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B24, 4> ICK;
 			bits_rw_t<io_, bitpos::B28, 4> FCK;
 		};
-		static sckcr_t<0x00080020> SCKCR;
+		static IO_SIM_INLINE sckcr_t<0x00080020> SCKCR;
 
 
 #if defined(SIG_RX71M)
@@ -239,7 +239,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> MEMWAIT;
 		};
-		static memwait_t<0x00086610> MEMWAIT;
+		static IO_SIM_INLINE memwait_t<0x00086610> MEMWAIT;
 
 #elif defined(SIG_RX72M) || defined(SIG_RX66T) || defined(SIG_RX72T) || defined(SIG_RX72N)
 		template<uint32_t base>
@@ -252,7 +252,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> MEMWAIT;
 		};
-		static memwait_t<0x0008101C> MEMWAIT;
+		static IO_SIM_INLINE memwait_t<0x0008101C> MEMWAIT;
 #endif
 
 
@@ -273,7 +273,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2> ROMWT;
 		};
-		static romwt_t<0x0008101C> ROMWT;
+		static IO_SIM_INLINE romwt_t<0x0008101C> ROMWT;
 #endif
 
 
@@ -293,7 +293,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B4, 4> UCK;
 		};
-		static sckcr2_t<0x00080024> SCKCR2;
+		static IO_SIM_INLINE sckcr2_t<0x00080024> SCKCR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -312,7 +312,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B8, 3> CKSEL;
 		};
-		static sckcr3_t<0x00080026> SCKCR3;
+		static IO_SIM_INLINE sckcr3_t<0x00080026> SCKCR3;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -333,7 +333,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B4>    PLLSRCSEL;
 			bits_rw_t<io_, bitpos::B8, 6> STC;
 		};
-		static pllcr_t<0x00080028> PLLCR;
+		static IO_SIM_INLINE pllcr_t<0x00080028> PLLCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -352,7 +352,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> PLLEN;
 		};
-		static pllcr2_t<0x0008002A> PLLCR2;
+		static IO_SIM_INLINE pllcr2_t<0x0008002A> PLLCR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -371,7 +371,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> BCLKDIV;
 		};
-		static bckcr_t<0x00080030> BCKCR;
+		static IO_SIM_INLINE bckcr_t<0x00080030> BCKCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -390,7 +390,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> MOSTP;
 		};
-		static mosccr_t<0x00080032> MOSCCR;
+		static IO_SIM_INLINE mosccr_t<0x00080032> MOSCCR;
 
 
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX72M) || defined(SIG_RX65N) || defined(SIG_RX72N)
@@ -410,7 +410,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> SOSTP;
 		};
-		static sosccr_t<0x00080033> SOSCCR;
+		static IO_SIM_INLINE sosccr_t<0x00080033> SOSCCR;
 #endif
 
 
@@ -430,7 +430,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> LCSTP;
 		};
-		static lococr_t<0x00080034> LOCOCR;
+		static IO_SIM_INLINE lococr_t<0x00080034> LOCOCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -449,7 +449,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> ILCSTP;
 		};
-		static ilococr_t<0x00080035> ILOCOCR;
+		static IO_SIM_INLINE ilococr_t<0x00080035> ILOCOCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -468,7 +468,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> HCSTP;
 		};
-		static hococr_t<0x00080036> HOCOCR;
+		static IO_SIM_INLINE hococr_t<0x00080036> HOCOCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -487,7 +487,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2> HCFRQ;
 		};
-		static hococr2_t<0x00080037> HOCOCR2;
+		static IO_SIM_INLINE hococr2_t<0x00080037> HOCOCR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -515,7 +515,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B5> PPLOVF;
 #endif
 		};
-		static oscovfsr_t<0x0008003C> OSCOVFSR;
+		static IO_SIM_INLINE oscovfsr_t<0x0008003C> OSCOVFSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -536,7 +536,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7> OSTDE;
 		};
-		static ostdcr_t<0x00080040> OSTDCR;
+		static IO_SIM_INLINE ostdcr_t<0x00080040> OSTDCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -555,7 +555,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0> OSTDF;
 		};
-		static ostdsr_t<0x00080041> OSTDSR;
+		static IO_SIM_INLINE ostdsr_t<0x00080041> OSTDSR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -563,7 +563,7 @@ namespace device {
 			@brief  メインクロック発振器ウェイトコントロールレジスタ（MOSCWTCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw8_t<0x000800A2> MOSCWTCR;
+		static IO_SIM_INLINE rw8_t<0x000800A2> MOSCWTCR;
 
 
 #if defined(SIG_RX64M) || defined(SIG_RX71M) || defined(SIG_RX72M) || defined(SIG_RX65N) || defined(SIG_RX72N)
@@ -572,7 +572,7 @@ namespace device {
 			@brief  サブクロック発振器ウェイトコントロールレジスタ（SOSCWTCR）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw8_t<0x000800A3> SOSCWTCR;
+		static IO_SIM_INLINE rw8_t<0x000800A3> SOSCWTCR;
 #endif
 
 
@@ -596,7 +596,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 2>  MODRV2;
 			bit_rw_t <io_, bitpos::B6>     MOSEL;
 		};
-		static mofcr_t<0x0008C293> MOFCR;
+		static IO_SIM_INLINE mofcr_t<0x0008C293> MOFCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -615,7 +615,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>	HOCOPCNT;
 		};
-		static hocopcr_t<0x0008C294> HOCOPCR;
+		static IO_SIM_INLINE hocopcr_t<0x0008C294> HOCOPCR;
 
 
 #if defined(SIG_RX72M) || defined(SIG_RX72N)
@@ -638,7 +638,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 3>  CKODIV;
 			bit_rw_t <io_, bitpos::B15>     CKOSTP;
 		};
-		static ckocr_t<0x0008003E> CKOCR;
+		static IO_SIM_INLINE ckocr_t<0x0008003E> CKOCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -661,7 +661,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B12>  UPLLSEL;
 		};
-		static packcr_t<0x00080044> PACKCR;
+		static IO_SIM_INLINE packcr_t<0x00080044> PACKCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -682,7 +682,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B8, 6>  PPLSTC;
 		};
-		static ppllcr_t<0x00080048> PPLLCR;
+		static IO_SIM_INLINE ppllcr_t<0x00080048> PPLLCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -701,7 +701,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  PPLLEN;
 		};
-		static ppllcr2_t<0x0008004A> PPLLCR2;
+		static IO_SIM_INLINE ppllcr2_t<0x0008004A> PPLLCR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -720,7 +720,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>  PPLCK;
 		};
-		static ppllcr3_t<0x0008004B> PPLLCR3;
+		static IO_SIM_INLINE ppllcr3_t<0x0008004B> PPLLCR3;
 #endif
 
 //-----------------------------------------------------------------------------//
@@ -742,7 +742,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>	OPE;
 			bit_rw_t<io_, bitpos::B15>	SSBY;
 		};
-		static sbycr_t<0x0008000C> SBYCR;
+		static IO_SIM_INLINE sbycr_t<0x0008000C> SBYCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -789,7 +789,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B31>	ACSE;
 		};
-		static mstpcra_t<0x00080010> MSTPCRA;
+		static IO_SIM_INLINE mstpcra_t<0x00080010> MSTPCRA;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -843,7 +843,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B30>	MSTPB30;
 			bit_rw_t<io_, bitpos::B31>	MSTPB31;
 		};
-		static mstpcrb_t<0x00080014> MSTPCRB;
+		static IO_SIM_INLINE mstpcrb_t<0x00080014> MSTPCRB;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -883,7 +883,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B29>	MSTPC29;	///< GLCDC
 #endif
 		};
-		static mstpcrc_t<0x00080018> MSTPCRC;
+		static IO_SIM_INLINE mstpcrc_t<0x00080018> MSTPCRC;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -924,7 +924,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B23>	MSTPD23;
 		};
-		static mstpcrd_t<0x0008001C> MSTPCRD;
+		static IO_SIM_INLINE mstpcrd_t<0x0008001C> MSTPCRD;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -944,7 +944,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>	OPCM;
 			bit_rw_t <io_, bitpos::B4>		OPCMTSF;
 		};
-		static opccr_t<0x000800A0> OPCCR;
+		static IO_SIM_INLINE opccr_t<0x000800A0> OPCCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -964,7 +964,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>	RSTCKSEL;
 			bit_rw_t <io_, bitpos::B4>		RSTCKEN;
 		};
-		static rstckcr_t<0x000800A1> RSTCKCR;
+		static IO_SIM_INLINE rstckcr_t<0x000800A1> RSTCKCR;
 
 
 //-----------------------------------------------------------------------------//
@@ -987,7 +987,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>	   IOKEEP;
 			bit_rw_t <io_, bitpos::B7>	   DPSBY;
 		};
-		static dpsbycr_t<0x0008C280> DPSBYCR;
+		static IO_SIM_INLINE dpsbycr_t<0x0008C280> DPSBYCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1009,7 +1009,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B3>     PRC3;
 			bits_rw_t<io_, bitpos::B8, 8>  PRKEY;
 		};
-		static prcr_t<0x000803FE> PRCR;
+		static IO_SIM_INLINE prcr_t<0x000803FE> PRCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1029,7 +1029,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>	TSOE;
 			bit_rw_t<io_, bitpos::B7>	TSEN;
 		};
-		static tscr_t<0x0008C500> TSCR;
+		static IO_SIM_INLINE tscr_t<0x0008C500> TSCR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1053,7 +1053,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B7>  DPSRSTF;
 		};
-		static rstsr0_t<0x0008C290> RSTSR0;
+		static IO_SIM_INLINE rstsr0_t<0x0008C290> RSTSR0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1072,7 +1072,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>  CWSF;
 		};
-		static rstsr1_t<0x0008C291> RSTSR1;
+		static IO_SIM_INLINE rstsr1_t<0x0008C291> RSTSR1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1093,7 +1093,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B1>  WDTRF;
 			bit_rw_t <io_, bitpos::B2>  SWRF;
 		};
-		static rstsr2_t<0x000800C0> RSTSR2;
+		static IO_SIM_INLINE rstsr2_t<0x000800C0> RSTSR2;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1102,7 +1102,7 @@ namespace device {
 					0xA501 を書き込むとリセットされます。
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw16_t<0x000800C2> SWRR;
+		static IO_SIM_INLINE rw16_t<0x000800C2> SWRR;
 
 
 #if defined(SIG_RX65N) || defined(SIG_RX66T) || defined(SIG_RX72T) || defined(SIG_RX72M) || defined(SIG_RX72N)
@@ -1122,7 +1122,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>  ROMCEN;
 		};
-		static romce_t<0x00081000> ROMCE;
+		static IO_SIM_INLINE romce_t<0x00081000> ROMCE;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1141,7 +1141,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>  ROMCIV;
 		};
-		static romciv_t<0x00081004> ROMCIV;
+		static IO_SIM_INLINE romciv_t<0x00081004> ROMCIV;
 #endif
 
 
@@ -1152,8 +1152,8 @@ namespace device {
 			@param[in]	base	ベースアドレス
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw32_t<0x00081040> NCRG0;
-		static rw32_t<0x00081048> NCRG1;
+		static IO_SIM_INLINE rw32_t<0x00081040> NCRG0;
+		static IO_SIM_INLINE rw32_t<0x00081048> NCRG1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1175,8 +1175,8 @@ namespace device {
 			bit_rw_t <io_, bitpos::B3>      NC3E;
 			bits_rw_t<io_, bitpos::B4, 17>  NCSZ;
 		};
-		static ncrcn_t<0x00081044> NCRC0;
-		static ncrcn_t<0x0008104C> NCRC1;
+		static IO_SIM_INLINE ncrcn_t<0x00081044> NCRC0;
+		static IO_SIM_INLINE ncrcn_t<0x0008104C> NCRC1;
 #endif
 	};
 	typedef system_t SYSTEM;
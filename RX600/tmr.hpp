@@ -26,7 +26,7 @@ namespace device {
 			@brie	タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x08> TCNT;
+		static IO_SIM_INLINE rw8_t<base + 0x08> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -34,7 +34,7 @@ namespace device {
 			@brie	タイムコンスタントレジスタ A（TCORA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x04> TCORA;
+		static IO_SIM_INLINE rw8_t<base + 0x04> TCORA;
 
 
 		//-----------------------------------------------------------------//
@@ -42,7 +42,7 @@ namespace device {
 			@brie	タイムコンスタントレジスタ B（TCORB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x06> TCORB;
+		static IO_SIM_INLINE rw8_t<base + 0x06> TCORB;
 
 
 		//-----------------------------------------------------------------//
@@ -64,7 +64,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>     CMIEA;
 			bit_rw_t <io_, bitpos::B7>     CMIEB;
 		};
-		static tcr_t<base + 0x00> TCR;
+		static IO_SIM_INLINE tcr_t<base + 0x00> TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -85,7 +85,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B3, 2>  CSS;
 			bit_rw_t <io_, bitpos::B7>     TMRIS;
 		};
-		static tccr_t<base + 0x0A> TCCR;
+		static IO_SIM_INLINE tccr_t<base + 0x0A> TCCR;
 
 	};
 
@@ -104,7 +104,7 @@ namespace device {
 			@brie	タイマカウンタ（TCNTW）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x08> TCNT16;
+		static IO_SIM_INLINE rw16_t<base + 0x08> TCNT16;
 
 
 		//-----------------------------------------------------------------//
@@ -112,7 +112,7 @@ namespace device {
 			@brie	タイムコンスタントレジスタ A（TCORA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x04> TCORA16;
+		static IO_SIM_INLINE rw16_t<base + 0x04> TCORA16;
 
 
 		//-----------------------------------------------------------------//
@@ -120,7 +120,7 @@ namespace device {
 			@brie	タイムコンスタントレジスタ B（TCORB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x06> TCORB16;
+		static IO_SIM_INLINE rw16_t<base + 0x06> TCORB16;
 
 
 		//-----------------------------------------------------------------//
@@ -141,7 +141,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B2, 2>  OSB;
 			bit_rw_t <io_, bitpos::B4>     ADTE;
 		};
-		static tcsr_t<base + 0x02> TCSR;
+		static IO_SIM_INLINE tcsr_t<base + 0x02> TCSR;
 
 	};
 
@@ -172,7 +172,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 2>  OSA;
 			bits_rw_t<io_, bitpos::B2, 2>  OSB;
 		};
-		static tcsr_t<base + 0x02> TCSR;
+		static IO_SIM_INLINE tcsr_t<base + 0x02> TCSR;
 
 	};
 
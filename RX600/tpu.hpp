@@ -45,7 +45,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B3, 2> CKEG;
 			bits_rw_t<io_, bitpos::B5, 3> CCLR;
 		};
-		static tcr_t TCR;
+		static IO_SIM_INLINE tcr_t TCR;
 
 
 		//-----------------------------------------------------------------//
@@ -66,7 +66,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>     ICSELB;
 			bit_rw_t <io_, bitpos::B7>     ICSELD;
 		};
-		static tmdr_t TMDR;
+		static IO_SIM_INLINE tmdr_t TMDR;
 
 
 		//-----------------------------------------------------------------//
@@ -84,7 +84,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> IOA;
 			bits_rw_t<io_, bitpos::B4, 4> IOB;
 		};
-		static tiorh_t TIORH;
+		static IO_SIM_INLINE tiorh_t TIORH;
 
 
 		//-----------------------------------------------------------------//
@@ -102,7 +102,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 4> IOC;
 			bits_rw_t<io_, bitpos::B4, 4> IOD;
 		};
-		static tiorl_t TIORL;
+		static IO_SIM_INLINE tiorl_t TIORL;
 
 
 		//-----------------------------------------------------------------//
@@ -126,7 +126,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  TTGE;
 		};
-		static tier_t TIER;
+		static IO_SIM_INLINE tier_t TIER;
 
 
 		//-----------------------------------------------------------------//
@@ -150,7 +150,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>  TCFD;
 		};
-		static tsr_t TSR;
+		static IO_SIM_INLINE tsr_t TSR;
 
 
 		//-----------------------------------------------------------------//
@@ -158,7 +158,7 @@ namespace device {
 			@brief  タイマカウンタ（TCNT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x06> TCNT;
+		static IO_SIM_INLINE rw16_t<base + 0x06> TCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -166,7 +166,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ A（TGRA）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x08> TGRA;
+		static IO_SIM_INLINE rw16_t<base + 0x08> TGRA;
 
 
 		//-----------------------------------------------------------------//
@@ -174,7 +174,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ B（TGRB）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x0A> TGRB;
+		static IO_SIM_INLINE rw16_t<base + 0x0A> TGRB;
 
 
 		//-----------------------------------------------------------------//
@@ -182,7 +182,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ C（TGRC）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x0C> TGRC;
+		static IO_SIM_INLINE rw16_t<base + 0x0C> TGRC;
 
 
 		//-----------------------------------------------------------------//
@@ -190,7 +190,7 @@ namespace device {
 			@brief  タイマジェネラルレジスタ D（TGRD）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x0E> TGRD;
+		static IO_SIM_INLINE rw16_t<base + 0x0E> TGRD;
 
 
 		//-----------------------------------------------------------------//
@@ -212,7 +212,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B4>  CST4;
 			bit_rw_t <io_, bitpos::B5>  CST5;
 		};
-		static tstr_t TSTR;
+		static IO_SIM_INLINE tstr_t TSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -234,7 +234,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B4>  SYNC4;
 			bit_rw_t <io_, bitpos::B5>  SYNC5;
 		};
-		static tsyr_t TSYR;
+		static IO_SIM_INLINE tsyr_t TSYR;
 
 
 		//-----------------------------------------------------------------//
@@ -256,7 +256,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B4, 2>  NFCS;
 		};
-		static nfcr_t NFCR;
+		static IO_SIM_INLINE nfcr_t NFCR;
 
 
 		//-----------------------------------------------------------------//
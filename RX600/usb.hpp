@@ -49,7 +49,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B10>	  SCKE;
 		};
-		static syscfg_t SYSCFG;
+		static IO_SIM_INLINE syscfg_t SYSCFG;
 
 
 		//-----------------------------------------------------------------//
@@ -69,7 +69,7 @@ namespace device {
 
 			bits_ro_t<in_, bitpos::B14, 2>  OVCMON;
 		};
-		static syssts0_t SYSSTS0;
+		static IO_SIM_INLINE syssts0_t SYSSTS0;
 
 
 		//-----------------------------------------------------------------//
@@ -95,7 +95,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B10>	    EXICEN;
 			bit_rw_t <io_, bitpos::B11>	    HNPBTOA;
 		};
-		static dvstctr0_t DVSTCTR0;
+		static IO_SIM_INLINE dvstctr0_t DVSTCTR0;
 
 
 		//-----------------------------------------------------------------//
@@ -103,8 +103,8 @@ namespace device {
 			@brief  CFIFO ポートレジスタ（CFIFO）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x14> CFIFO;
-		static rw8_t <base + 0x14> CFIFOL;
+		static IO_SIM_INLINE rw16_t<base + 0x14> CFIFO;
+		static IO_SIM_INLINE rw8_t <base + 0x14> CFIFOL;
 
 
 		//-----------------------------------------------------------------//
@@ -112,8 +112,8 @@ namespace device {
 			@brief  D0FIFO ポートレジスタ（D0FIFO）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x18> D0FIFO;
-		static rw8_t <base + 0x18> D0FIFOL;
+		static IO_SIM_INLINE rw16_t<base + 0x18> D0FIFO;
+		static IO_SIM_INLINE rw8_t <base + 0x18> D0FIFOL;
 
 
 		//-----------------------------------------------------------------//
@@ -121,8 +121,8 @@ namespace device {
 			@brief  D1FIFO ポートレジスタ（D1FIFO）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x1C> D1FIFO;
-		static rw8_t <base + 0x1C> D1FIFOL;
+		static IO_SIM_INLINE rw16_t<base + 0x1C> D1FIFO;
+		static IO_SIM_INLINE rw8_t <base + 0x1C> D1FIFOL;
 
 
 		//-----------------------------------------------------------------//
@@ -147,7 +147,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>	    REW;
 			bit_rw_t <io_, bitpos::B15>	    RCNT;
 		};
-		static cfifosel_t CFIFOSEL;
+		static IO_SIM_INLINE cfifosel_t CFIFOSEL;
 
 
 		//-----------------------------------------------------------------//
@@ -175,8 +175,8 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>	    REW;
 			bit_rw_t <io_, bitpos::B15>	    RCNT;
 		};
-		static dxfifosel_t<0x28> D0FIFOSEL;
-		static dxfifosel_t<0x2C> D1FIFOSEL;
+		static IO_SIM_INLINE dxfifosel_t<0x28> D0FIFOSEL;
+		static IO_SIM_INLINE dxfifosel_t<0x2C> D1FIFOSEL;
 
 
 		//-----------------------------------------------------------------//
@@ -199,9 +199,9 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>	    BCLR;
 			bit_rw_t <io_, bitpos::B15>	    BVAL;
 		};
-		static xfifoctr_t<0x22> CFIFOCTR;
-		static xfifoctr_t<0x2A> D0FIFOCTR;
-		static xfifoctr_t<0x2E> D1FIFOCTR;
+		static IO_SIM_INLINE xfifoctr_t<0x22> CFIFOCTR;
+		static IO_SIM_INLINE xfifoctr_t<0x2A> D0FIFOCTR;
+		static IO_SIM_INLINE xfifoctr_t<0x2E> D1FIFOCTR;
 
 
 		//-----------------------------------------------------------------//
@@ -278,7 +278,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>	PIPEBRDYE;
 		};
-		static brdyenb_t BRDYENB;
+		static IO_SIM_INLINE brdyenb_t BRDYENB;
 
 
 		//-----------------------------------------------------------------//
@@ -306,7 +306,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>	PIPEBNRDYE;
 		};
-		static nrdyenb_t NRDYENB;
+		static IO_SIM_INLINE nrdyenb_t NRDYENB;
 
 
 		//-----------------------------------------------------------------//
@@ -334,7 +334,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>	PIPEBEMPE;
 		};
-		static bempenb_t BEMPENB;
+		static IO_SIM_INLINE bempenb_t BEMPENB;
 
 
 		//-----------------------------------------------------------------//
@@ -355,7 +355,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B8>    TRNENSEL;
 		};
-		static sofcfg_t SOFCFG;
+		static IO_SIM_INLINE sofcfg_t SOFCFG;
 
 
 		//-----------------------------------------------------------------//
@@ -436,7 +436,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>   PIPEBRDY;
 		};
-		static brdysts_t BRDYSTS;
+		static IO_SIM_INLINE brdysts_t BRDYSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -464,7 +464,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>   PIPENRDY;
 		};
-		static nrdysts_t NRDYSTS;
+		static IO_SIM_INLINE nrdysts_t NRDYSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -492,7 +492,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>   PIPEBEMP;
 		};
-		static bempsts_t BEMPSTS;
+		static IO_SIM_INLINE bempsts_t BEMPSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -512,7 +512,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>      CRCE;
 			bit_rw_t <io_, bitpos::B15>      OVRN;
 		};
-		static frmnum_t FRMNUM;
+		static IO_SIM_INLINE frmnum_t FRMNUM;
 
 
 		//-----------------------------------------------------------------//
@@ -529,7 +529,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B15>   DVCHG;
 		};
-		static dvchgr_t DVCHGR;
+		static IO_SIM_INLINE dvchgr_t DVCHGR;
 
 
 		//-----------------------------------------------------------------//
@@ -547,7 +547,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 7>   USBADDR;
 			bits_rw_t<io_, bitpos::B8, 4>   STSRECOV;
 		};
-		static usbaddr_t USBADDR;
+		static IO_SIM_INLINE usbaddr_t USBADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -565,7 +565,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 8>   BMREQUESTTYPE;
 			bits_rw_t<io_, bitpos::B8, 8>   BREQUEST;
 		};
-		static usbreq_t USBREQ;
+		static IO_SIM_INLINE usbreq_t USBREQ;
 
 
 		//-----------------------------------------------------------------//
@@ -582,7 +582,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   WVALUE;
 		};
-		static usbval_t USBVAL;
+		static IO_SIM_INLINE usbval_t USBVAL;
 
 
 		//-----------------------------------------------------------------//
@@ -599,7 +599,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   WINDEX;
 		};
-		static usbindx_t USBINDX;
+		static IO_SIM_INLINE usbindx_t USBINDX;
 
 
 		//-----------------------------------------------------------------//
@@ -616,7 +616,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   WLENGTH;
 		};
-		static usbleng_t USBLENG;
+		static IO_SIM_INLINE usbleng_t USBLENG;
 
 
 		//-----------------------------------------------------------------//
@@ -634,7 +634,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>   DIR;
 			bit_rw_t<io_, bitpos::B7>   SHTNAK;
 		};
-		static dcpcfg_t DCPCFG;
+		static IO_SIM_INLINE dcpcfg_t DCPCFG;
 
 
 		//-----------------------------------------------------------------//
@@ -652,7 +652,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  7>   MXPS;
 			bits_rw_t<io_, bitpos::B12, 4>   DEVSEL;
 		};
-		static dcpmaxp_t DCPMAXP;
+		static IO_SIM_INLINE dcpmaxp_t DCPMAXP;
 
 
 		//-----------------------------------------------------------------//
@@ -680,7 +680,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>     SUREQ;
 			bit_rw_t <io_, bitpos::B15>     BSTS;
 		};
-		static dcpctr_t DCPCTR;
+		static IO_SIM_INLINE dcpctr_t DCPCTR;
 
 
 		//-----------------------------------------------------------------//
@@ -697,7 +697,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>   PIPESEL;
 		};
-		static pipesel_t PIPESEL;
+		static IO_SIM_INLINE pipesel_t PIPESEL;
 
 
 		//-----------------------------------------------------------------//
@@ -722,7 +722,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B14, 2>  TYPE;
 		};
-		static pipecfg_t PIPECFG;
+		static IO_SIM_INLINE pipecfg_t PIPECFG;
 
 
 		//-----------------------------------------------------------------//
@@ -741,7 +741,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B12, 4>  DEVSEL;
 		};
-		static pipemaxp_t PIPEMAXP;
+		static IO_SIM_INLINE pipemaxp_t PIPEMAXP;
 
 
 		//-----------------------------------------------------------------//
@@ -760,7 +760,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B12>     IFIS;
 		};
-		static pipeperi_t PIPEPERI;
+		static IO_SIM_INLINE pipeperi_t PIPEPERI;
 
 
 		//-----------------------------------------------------------------//
@@ -789,11 +789,11 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>     INBUFM;
 			bit_rw_t <io_, bitpos::B15>     BSTS;
 		};
-		static pipexctr_t<0x70>  PIPE1CTR;
-		static pipexctr_t<0x72>  PIPE2CTR;
-		static pipexctr_t<0x74>  PIPE3CTR;
-		static pipexctr_t<0x76>  PIPE4CTR;
-		static pipexctr_t<0x78>  PIPE5CTR;
+		static IO_SIM_INLINE pipexctr_t<0x70>  PIPE1CTR;
+		static IO_SIM_INLINE pipexctr_t<0x72>  PIPE2CTR;
+		static IO_SIM_INLINE pipexctr_t<0x74>  PIPE3CTR;
+		static IO_SIM_INLINE pipexctr_t<0x76>  PIPE4CTR;
+		static IO_SIM_INLINE pipexctr_t<0x78>  PIPE5CTR;
 
 
 		//-----------------------------------------------------------------//
@@ -820,10 +820,10 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B15>     BSTS;
 		};
-		static pipeyctr_t<0x7A>  PIPE6CTR;
-		static pipeyctr_t<0x7C>  PIPE7CTR;
-		static pipeyctr_t<0x7E>  PIPE8CTR;
-		static pipeyctr_t<0x80>  PIPE9CTR;
+		static IO_SIM_INLINE pipeyctr_t<0x7A>  PIPE6CTR;
+		static IO_SIM_INLINE pipeyctr_t<0x7C>  PIPE7CTR;
+		static IO_SIM_INLINE pipeyctr_t<0x7E>  PIPE8CTR;
+		static IO_SIM_INLINE pipeyctr_t<0x80>  PIPE9CTR;
 
 
 		//-----------------------------------------------------------------//
@@ -843,11 +843,11 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>      TRCLR;
 			bit_rw_t <io_, bitpos::B9>      TRENB;
 		};
-		static pipentre_t<0x90>  PIPE1TRE;
-		static pipentre_t<0x94>  PIPE2TRE;
-		static pipentre_t<0x98>  PIPE3TRE;
-		static pipentre_t<0x9C>  PIPE4TRE;
-		static pipentre_t<0xA0>  PIPE5TRE;
+		static IO_SIM_INLINE pipentre_t<0x90>  PIPE1TRE;
+		static IO_SIM_INLINE pipentre_t<0x94>  PIPE2TRE;
+		static IO_SIM_INLINE pipentre_t<0x98>  PIPE3TRE;
+		static IO_SIM_INLINE pipentre_t<0x9C>  PIPE4TRE;
+		static IO_SIM_INLINE pipentre_t<0xA0>  PIPE5TRE;
 
 
 		//-----------------------------------------------------------------//
@@ -866,11 +866,11 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>  TRNCNT;
 		};
-		static pipentrn_t<0x92>  PIPE1TRN;
-		static pipentrn_t<0x96>  PIPE2TRN;
-		static pipentrn_t<0x9A>  PIPE3TRN;
-		static pipentrn_t<0x9E>  PIPE4TRN;
-		static pipentrn_t<0xA2>  PIPE5TRN;
+		static IO_SIM_INLINE pipentrn_t<0x92>  PIPE1TRN;
+		static IO_SIM_INLINE pipentrn_t<0x96>  PIPE2TRN;
+		static IO_SIM_INLINE pipentrn_t<0x9A>  PIPE3TRN;
+		static IO_SIM_INLINE pipentrn_t<0x9E>  PIPE4TRN;
+		static IO_SIM_INLINE pipentrn_t<0xA2>  PIPE5TRN;
 
 
 		//-----------------------------------------------------------------//
@@ -889,12 +889,12 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B6, 2>  USBSPD;
 		};
-		static devaddn_t<0xD0>  DEVADD0;
-		static devaddn_t<0xD2>  DEVADD1;
-		static devaddn_t<0xD4>  DEVADD2;
-		static devaddn_t<0xD6>  DEVADD3;
-		static devaddn_t<0xD8>  DEVADD4;
-		static devaddn_t<0xDA>  DEVADD5;
+		static IO_SIM_INLINE devaddn_t<0xD0>  DEVADD0;
+		static IO_SIM_INLINE devaddn_t<0xD2>  DEVADD1;
+		static IO_SIM_INLINE devaddn_t<0xD4>  DEVADD2;
+		static IO_SIM_INLINE devaddn_t<0xD6>  DEVADD3;
+		static IO_SIM_INLINE devaddn_t<0xD8>  DEVADD4;
+		static IO_SIM_INLINE devaddn_t<0xDA>  DEVADD5;
 
 
 		//-----------------------------------------------------------------//
@@ -914,7 +914,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B2>  SLEWF00;
 			bit_rw_t<io_, bitpos::B3>  SLEWF01;
 		};
-		static physlew_t  PHYSLEW;
+		static IO_SIM_INLINE physlew_t  PHYSLEW;
 
 
 		//-----------------------------------------------------------------//
@@ -943,7 +943,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B23>  DVBSTS0;
 		};
-		static dpusr0r_t  DPUSR0R;
+		static IO_SIM_INLINE dpusr0r_t  DPUSR0R;
 
 
 		//-----------------------------------------------------------------//
@@ -974,7 +974,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B23>  DVBINT0;
 		};
-		static dpusr1r_t  DPUSR1R;
+		static IO_SIM_INLINE dpusr1r_t  DPUSR1R;
 
 
 		//-----------------------------------------------------------------//
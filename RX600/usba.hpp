@@ -46,7 +46,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B7>	  HSE;
 			bit_rw_t <io_, bitpos::B8>	  CNEN;
 		};
-		static syscfg_t SYSCFG;
+		static IO_SIM_INLINE syscfg_t SYSCFG;
 
 
 		//-----------------------------------------------------------------//
@@ -63,7 +63,7 @@ namespace device {
 
 			bits_rw_t <io_, bitpos::B0, 4>  BWAIT;
 		};
-		static buswait_t BUSWAIT;
+		static IO_SIM_INLINE buswait_t BUSWAIT;
 
 
 		//-----------------------------------------------------------------//
@@ -83,7 +83,7 @@ namespace device {
 
 			bits_ro_t<in_, bitpos::B14, 2>  OVCMON;
 		};
-		static syssts0_t SYSSTS0;
+		static IO_SIM_INLINE syssts0_t SYSSTS0;
 
 
 		//-----------------------------------------------------------------//
@@ -97,7 +97,7 @@ namespace device {
 
 			bit_ro_t<io_, bitpos::B0>  PLLLOCK;
 		};
-		static pllsta_t PLLSTA;
+		static IO_SIM_INLINE pllsta_t PLLSTA;
 
 
 		//-----------------------------------------------------------------//
@@ -123,7 +123,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B10>	    EXICEN;
 			bit_rw_t <io_, bitpos::B11>	    HNPBTOA;
 		};
-		static dvstctr0_t DVSTCTR0;
+		static IO_SIM_INLINE dvstctr0_t DVSTCTR0;
 
 
 		//-----------------------------------------------------------------//
@@ -140,7 +140,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>   UTST;
 		};
-		static testmode_t TESTMODE;
+		static IO_SIM_INLINE testmode_t TESTMODE;
 
 
 		//-----------------------------------------------------------------//
@@ -148,9 +148,9 @@ namespace device {
 			@brief  CFIFO ポートレジスタ（CFIFO）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x14> CFIFO;
-		static rw16_t<base + 0x16> CFIFOH;
-		static rw8_t <base + 0x17> CFIFOHH;
+		static IO_SIM_INLINE rw32_t<base + 0x14> CFIFO;
+		static IO_SIM_INLINE rw16_t<base + 0x16> CFIFOH;
+		static IO_SIM_INLINE rw8_t <base + 0x17> CFIFOHH;
 
 
 		//-----------------------------------------------------------------//
@@ -158,9 +158,9 @@ namespace device {
 			@brief  D0FIFO ポートレジスタ（D0FIFO）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x18> D0FIFO;
-		static rw16_t<base + 0x1A> D0FIFOH;
-		static rw8_t <base + 0x1B> D0FIFOHH;
+		static IO_SIM_INLINE rw32_t<base + 0x18> D0FIFO;
+		static IO_SIM_INLINE rw16_t<base + 0x1A> D0FIFOH;
+		static IO_SIM_INLINE rw8_t <base + 0x1B> D0FIFOHH;
 
 
 		//-----------------------------------------------------------------//
@@ -168,9 +168,9 @@ namespace device {
 			@brief  D1FIFO ポートレジスタ（D1FIFO）
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x1C> D1FIFO;
-		static rw16_t<base + 0x1E> D1FIFOH;
-		static rw8_t <base + 0x1F> D1FIFOHH;
+		static IO_SIM_INLINE rw32_t<base + 0x1C> D1FIFO;
+		static IO_SIM_INLINE rw16_t<base + 0x1E> D1FIFOH;
+		static IO_SIM_INLINE rw8_t <base + 0x1F> D1FIFOHH;
 
 
 		//-----------------------------------------------------------------//
@@ -195,7 +195,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>	    REW;
 			bit_rw_t <io_, bitpos::B15>	    RCNT;
 		};
-		static cfifosel_t CFIFOSEL;
+		static IO_SIM_INLINE cfifosel_t CFIFOSEL;
 
 
 		//-----------------------------------------------------------------//
@@ -223,8 +223,8 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>	    REW;
 			bit_rw_t <io_, bitpos::B15>	    RCNT;
 		};
-		static dxfifosel_t<0x28> D0FIFOSEL;
-		static dxfifosel_t<0x2C> D1FIFOSEL;
+		static IO_SIM_INLINE dxfifosel_t<0x28> D0FIFOSEL;
+		static IO_SIM_INLINE dxfifosel_t<0x2C> D1FIFOSEL;
 
 
 		//-----------------------------------------------------------------//
@@ -247,9 +247,9 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>	    BCLR;
 			bit_rw_t <io_, bitpos::B15>	    BVAL;
 		};
-		static xfifoctr_t<0x22> CFIFOCTR;
-		static xfifoctr_t<0x2A> D0FIFOCTR;
-		static xfifoctr_t<0x2E> D1FIFOCTR;
+		static IO_SIM_INLINE xfifoctr_t<0x22> CFIFOCTR;
+		static IO_SIM_INLINE xfifoctr_t<0x2A> D0FIFOCTR;
+		static IO_SIM_INLINE xfifoctr_t<0x2E> D1FIFOCTR;
 
 
 		//-----------------------------------------------------------------//
@@ -320,7 +320,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>	 PIPEBRDYE;
 		};
-		static brdyenb_t BRDYENB;
+		static IO_SIM_INLINE brdyenb_t BRDYENB;
 
 
 		//-----------------------------------------------------------------//
@@ -337,7 +337,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>	 PIPENRDYE;
 		};
-		static nrdyenb_t NRDYENB;
+		static IO_SIM_INLINE nrdyenb_t NRDYENB;
 
 
 		//-----------------------------------------------------------------//
@@ -354,7 +354,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>	 PIPEBEMPE;;
 		};
-		static bempenb_t BEMPENB;
+		static IO_SIM_INLINE bempenb_t BEMPENB;
 
 
 		//-----------------------------------------------------------------//
@@ -375,7 +375,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B8>	TRNENSEL;
 		};
-		static sofcfg_t SOFCFG;
+		static IO_SIM_INLINE sofcfg_t SOFCFG;
 
 
 		//-----------------------------------------------------------------//
@@ -400,7 +400,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B15>    HSEB;
 		};
-		static physet_t  PHYSET;
+		static IO_SIM_INLINE physet_t  PHYSET;
 
 
 		//-----------------------------------------------------------------//
@@ -475,7 +475,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>   PIPEBRDY;
 		};
-		static brdysts_t BRDYSTS;
+		static IO_SIM_INLINE brdysts_t BRDYSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -492,7 +492,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>   PIPENRDY;
 		};
-		static nrdysts_t NRDYSTS;
+		static IO_SIM_INLINE nrdysts_t NRDYSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -509,7 +509,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 10>   PIPEBEMP;
 		};
-		static bempsts_t BEMPSTS;
+		static IO_SIM_INLINE bempsts_t BEMPSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -529,7 +529,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>       CRCE;
 			bit_rw_t <io_, bitpos::B15>       OVRN;
 		};
-		static frmnum_t FRMNUM;
+		static IO_SIM_INLINE frmnum_t FRMNUM;
 
 
 		//-----------------------------------------------------------------//
@@ -546,7 +546,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 3>   UFRNM;
 		};
-		static ufrmnum_t UFRMNUM;
+		static IO_SIM_INLINE ufrmnum_t UFRMNUM;
 
 
 		//-----------------------------------------------------------------//
@@ -563,7 +563,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 7>   USBADDR;
 		};
-		static usbaddr_t USBADDR;
+		static IO_SIM_INLINE usbaddr_t USBADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -581,7 +581,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 8>   BMREQUESTTYPE;
 			bits_rw_t<io_, bitpos::B8, 8>   BREQUEST;
 		};
-		static usbreq_t USBREQ;
+		static IO_SIM_INLINE usbreq_t USBREQ;
 
 
 		//-----------------------------------------------------------------//
@@ -598,7 +598,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   WVALUE;
 		};
-		static usbval_t USBVAL;
+		static IO_SIM_INLINE usbval_t USBVAL;
 
 
 		//-----------------------------------------------------------------//
@@ -615,7 +615,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   WINDEX;
 		};
-		static usbindx_t USBINDX;
+		static IO_SIM_INLINE usbindx_t USBINDX;
 
 
 		//-----------------------------------------------------------------//
@@ -632,7 +632,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>   WLENGTH;
 		};
-		static usbleng_t USBLENG;
+		static IO_SIM_INLINE usbleng_t USBLENG;
 
 
 		//-----------------------------------------------------------------//
@@ -652,7 +652,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B7>   SHTNAK;
 			bit_rw_t<io_, bitpos::B8>   CNTMD;
 		};
-		static dcpcfg_t DCPCFG;
+		static IO_SIM_INLINE dcpcfg_t DCPCFG;
 
 
 		//-----------------------------------------------------------------//
@@ -670,7 +670,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  7>   MXPS;
 			bits_rw_t<io_, bitpos::B12, 4>   DEVSEL;
 		};
-		static dcpmaxp_t DCPMAXP;
+		static IO_SIM_INLINE dcpmaxp_t DCPMAXP;
 
 
 		//-----------------------------------------------------------------//
@@ -700,7 +700,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>     SUREQ;
 			bit_rw_t <io_, bitpos::B15>     BSTS;
 		};
-		static dcpctr_t DCPCTR;
+		static IO_SIM_INLINE dcpctr_t DCPCTR;
 
 
 		//-----------------------------------------------------------------//
@@ -717,7 +717,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>   PIPESEL;
 		};
-		static pipesel_t PIPESEL;
+		static IO_SIM_INLINE pipesel_t PIPESEL;
 
 
 		//-----------------------------------------------------------------//
@@ -742,7 +742,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B14, 2>  TYPE;
 		};
-		static pipecfg_t PIPECFG;
+		static IO_SIM_INLINE pipecfg_t PIPECFG;
 
 
 		//-----------------------------------------------------------------//
@@ -760,7 +760,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0,  8>  BUFNMB;
 			bits_rw_t<io_, bitpos::B10, 5>  BUFSIZE;
 		};
-		static pipebuf_t PIPEBUF;
+		static IO_SIM_INLINE pipebuf_t PIPEBUF;
 
 
 		//-----------------------------------------------------------------//
@@ -779,7 +779,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B12, 4>  DEVSEL;
 		};
-		static pipemaxp_t PIPEMAXP;
+		static IO_SIM_INLINE pipemaxp_t PIPEMAXP;
 
 
 		//-----------------------------------------------------------------//
@@ -798,7 +798,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B12>     IFIS;
 		};
-		static pipeperi_t PIPEPERI;
+		static IO_SIM_INLINE pipeperi_t PIPEPERI;
 
 
 		//-----------------------------------------------------------------//
@@ -829,15 +829,15 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>     INBUFM;
 			bit_rw_t <io_, bitpos::B15>     BSTS;
 		};
-		static pipexctr_t<0x70>  PIPE1CTR;
-		static pipexctr_t<0x72>  PIPE2CTR;
-		static pipexctr_t<0x74>  PIPE3CTR;
-		static pipexctr_t<0x76>  PIPE4CTR;
-		static pipexctr_t<0x78>  PIPE5CTR;
-		static pipexctr_t<0x7A>  PIPE6CTR;
-		static pipexctr_t<0x7C>  PIPE7CTR;
-		static pipexctr_t<0x7E>  PIPE8CTR;
-		static pipexctr_t<0x80>  PIPE9CTR;
+		static IO_SIM_INLINE pipexctr_t<0x70>  PIPE1CTR;
+		static IO_SIM_INLINE pipexctr_t<0x72>  PIPE2CTR;
+		static IO_SIM_INLINE pipexctr_t<0x74>  PIPE3CTR;
+		static IO_SIM_INLINE pipexctr_t<0x76>  PIPE4CTR;
+		static IO_SIM_INLINE pipexctr_t<0x78>  PIPE5CTR;
+		static IO_SIM_INLINE pipexctr_t<0x7A>  PIPE6CTR;
+		static IO_SIM_INLINE pipexctr_t<0x7C>  PIPE7CTR;
+		static IO_SIM_INLINE pipexctr_t<0x7E>  PIPE8CTR;
+		static IO_SIM_INLINE pipexctr_t<0x80>  PIPE9CTR;
 
 
 		//-----------------------------------------------------------------//
@@ -857,11 +857,11 @@ namespace device {
 			bit_rw_t<io_, bitpos::B8>   TRCLR;
 			bit_rw_t<io_, bitpos::B9>   TRENB;
 		};
-		static pipentre_t<0x90>  PIPE1TRE;
-		static pipentre_t<0x94>  PIPE2TRE;
-		static pipentre_t<0x98>  PIPE3TRE;
-		static pipentre_t<0x9C>  PIPE4TRE;
-		static pipentre_t<0xA0>  PIPE5TRE;
+		static IO_SIM_INLINE pipentre_t<0x90>  PIPE1TRE;
+		static IO_SIM_INLINE pipentre_t<0x94>  PIPE2TRE;
+		static IO_SIM_INLINE pipentre_t<0x98>  PIPE3TRE;
+		static IO_SIM_INLINE pipentre_t<0x9C>  PIPE4TRE;
+		static IO_SIM_INLINE pipentre_t<0xA0>  PIPE5TRE;
 
 
 		//-----------------------------------------------------------------//
@@ -880,11 +880,11 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 16>  TRNCNT;
 		};
-		static pipentrn_t<0x92>  PIPE1TRN;
-		static pipentrn_t<0x96>  PIPE2TRN;
-		static pipentrn_t<0x9A>  PIPE3TRN;
-		static pipentrn_t<0x9E>  PIPE4TRN;
-		static pipentrn_t<0xA2>  PIPE5TRN;
+		static IO_SIM_INLINE pipentrn_t<0x92>  PIPE1TRN;
+		static IO_SIM_INLINE pipentrn_t<0x96>  PIPE2TRN;
+		static IO_SIM_INLINE pipentrn_t<0x9A>  PIPE3TRN;
+		static IO_SIM_INLINE pipentrn_t<0x9E>  PIPE4TRN;
+		static IO_SIM_INLINE pipentrn_t<0xA2>  PIPE5TRN;
 
 
 		//-----------------------------------------------------------------//
@@ -905,17 +905,17 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8,  3>  HUBPORT;
 			bits_rw_t<io_, bitpos::B11, 4>  UPPHUB;
 		};
-		static devaddm_t<0xD0>  DEVADD0;
-		static devaddm_t<0xD2>  DEVADD1;
-		static devaddm_t<0xD4>  DEVADD2;
-		static devaddm_t<0xD6>  DEVADD3;
-		static devaddm_t<0xD8>  DEVADD4;
-		static devaddm_t<0xDA>  DEVADD5;
-		static devaddm_t<0xDC>  DEVADD6;
-		static devaddm_t<0xDE>  DEVADD7;
-		static devaddm_t<0xE0>  DEVADD8;
-		static devaddm_t<0xE2>  DEVADD9;
-		static devaddm_t<0xE4>  DEVADDA;
+		static IO_SIM_INLINE devaddm_t<0xD0>  DEVADD0;
+		static IO_SIM_INLINE devaddm_t<0xD2>  DEVADD1;
+		static IO_SIM_INLINE devaddm_t<0xD4>  DEVADD2;
+		static IO_SIM_INLINE devaddm_t<0xD6>  DEVADD3;
+		static IO_SIM_INLINE devaddm_t<0xD8>  DEVADD4;
+		static IO_SIM_INLINE devaddm_t<0xDA>  DEVADD5;
+		static IO_SIM_INLINE devaddm_t<0xDC>  DEVADD6;
+		static IO_SIM_INLINE devaddm_t<0xDE>  DEVADD7;
+		static IO_SIM_INLINE devaddm_t<0xE0>  DEVADD8;
+		static IO_SIM_INLINE devaddm_t<0xE2>  DEVADD9;
+		static IO_SIM_INLINE devaddm_t<0xE4>  DEVADDA;
 
 
 		//-----------------------------------------------------------------//
@@ -932,7 +932,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B7>   HWUPM;
 		};
-		static lpctrl_t LPCTRL;
+		static IO_SIM_INLINE lpctrl_t LPCTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -949,7 +949,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B14>   SUSPENDM;
 		};
-		static lpsts_t LPSTS;
+		static IO_SIM_INLINE lpsts_t LPSTS;
 
 
 		//-----------------------------------------------------------------//
@@ -973,7 +973,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B8>   CHGDETSTS;
 			bit_rw_t<io_, bitpos::B9>   PDDETSTS;
 		};
-		static bcctrl_t BCCTRL;
+		static IO_SIM_INLINE bcctrl_t BCCTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -996,7 +996,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8, 4>  HIRDTHR;
 			bit_rw_t <io_, bitpos::B14>    L1EXTMD;
 		};
-		static pl1ctrl1_t PL1CTRL1;
+		static IO_SIM_INLINE pl1ctrl1_t PL1CTRL1;
 
 
 		//-----------------------------------------------------------------//
@@ -1014,7 +1014,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B8, 4>  HIRDMON;
 			bit_rw_t <io_, bitpos::B12>    RWEMON;
 		};
-		static pl1ctrl2_t PL1CTRL2;
+		static IO_SIM_INLINE pl1ctrl2_t PL1CTRL2;
 
 
 		//-----------------------------------------------------------------//
@@ -1032,7 +1032,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>     L1REQ;
 			bits_rw_t<io_, bitpos::B1, 2>  L1STATUS;
 		};
-		static hl1ctrl1_t HL1CTRL1;
+		static IO_SIM_INLINE hl1ctrl1_t HL1CTRL1;
 
 
 		//-----------------------------------------------------------------//
@@ -1054,7 +1054,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B15>    BESL;
 		};
-		static hl1ctrl2_t HL1CTRL2;
+		static IO_SIM_INLINE hl1ctrl2_t HL1CTRL2;
 
 
 		//-----------------------------------------------------------------//
@@ -1074,7 +1074,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B23>  DVBSTSHM;
 		};
-		static dpusr0r_t  DPUSR0R;
+		static IO_SIM_INLINE dpusr0r_t  DPUSR0R;
 
 
 		//-----------------------------------------------------------------//
@@ -1099,7 +1099,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B23>  DVBSTSH;
 		};
-		static dpusr1r_t  DPUSR1R;
+		static IO_SIM_INLINE dpusr1r_t  DPUSR1R;
 
 
 		//-----------------------------------------------------------------//
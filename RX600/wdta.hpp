@@ -26,7 +26,7 @@ namespace device {
 			@brief  WDT リフレッシュレジスタ（WDTRR）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0x00> WDTRR;
+		static IO_SIM_INLINE rw8_t<base + 0x00> WDTRR;
 
 
 		//-----------------------------------------------------------------//
@@ -48,7 +48,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B12, 2> RPSS;
 		};
-		static wdtcr_t WDTCR;
+		static IO_SIM_INLINE wdtcr_t WDTCR;
 
 
 		//-----------------------------------------------------------------//
@@ -68,7 +68,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>    UNDFF;
 			bit_rw_t <io_, bitpos::B15>    REFEF;
 		};
-		static wdtsr_t WDTSR;
+		static IO_SIM_INLINE wdtsr_t WDTSR;
 
 
 		//-----------------------------------------------------------------//
@@ -85,7 +85,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B7>  RSTIRQS;
 		};
-		static wdtrcr_t WDTRCR;
+		static IO_SIM_INLINE wdtrcr_t WDTRCR;
 
 	};
 	typedef wdta_t<0x00088020> WDT;
@@ -26,7 +26,7 @@ namespace device {
 			@brief  A/D データレジスタ 0（ADDR0）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x20> ADDR0;
+		static IO_SIM_INLINE ro16_t<base + 0x20> ADDR0;
 
 
 		//-----------------------------------------------------------------//
@@ -34,7 +34,7 @@ namespace device {
 			@brief  A/D データレジスタ 1（ADDR1）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x22> ADDR1;
+		static IO_SIM_INLINE ro16_t<base + 0x22> ADDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -42,7 +42,7 @@ namespace device {
 			@brief  A/D データレジスタ 2（ADDR2）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x24> ADDR2;
+		static IO_SIM_INLINE ro16_t<base + 0x24> ADDR2;
 
 
 		//-----------------------------------------------------------------//
@@ -50,7 +50,7 @@ namespace device {
 			@brief  A/D データレジスタ 3（ADDR3）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x26> ADDR3;
+		static IO_SIM_INLINE ro16_t<base + 0x26> ADDR3;
 
 
 		//-----------------------------------------------------------------//
@@ -58,7 +58,7 @@ namespace device {
 			@brief  A/D データレジスタ 4（ADDR4）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x28> ADDR4;
+		static IO_SIM_INLINE ro16_t<base + 0x28> ADDR4;
 
 
 		//-----------------------------------------------------------------//
@@ -66,7 +66,7 @@ namespace device {
 			@brief  A/D データレジスタ 5（ADDR5）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2A> ADDR5;
+		static IO_SIM_INLINE ro16_t<base + 0x2A> ADDR5;
 
 
 		//-----------------------------------------------------------------//
@@ -74,7 +74,7 @@ namespace device {
 			@brief  A/D データレジスタ 6（ADDR6）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2C> ADDR6;
+		static IO_SIM_INLINE ro16_t<base + 0x2C> ADDR6;
 
 
 		//-----------------------------------------------------------------//
@@ -82,7 +82,7 @@ namespace device {
 			@brief  A/D データレジスタ 7（ADDR7）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x2E> ADDR7;
+		static IO_SIM_INLINE ro16_t<base + 0x2E> ADDR7;
 
 
 		//-----------------------------------------------------------------//
@@ -90,7 +90,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ（ADDBLDR）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x18> ADDBLDR;
+		static IO_SIM_INLINE ro16_t<base + 0x18> ADDBLDR;
 
 
 		//-----------------------------------------------------------------//
@@ -98,7 +98,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ A（ADDBLDRA）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x84> ADDBLDRA;
+		static IO_SIM_INLINE ro16_t<base + 0x84> ADDBLDRA;
 
 
 		//-----------------------------------------------------------------//
@@ -106,7 +106,7 @@ namespace device {
 			@brief  A/D データ 2 重化レジスタ B（ADDBLDRB）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x86> ADDBLDRB;
+		static IO_SIM_INLINE ro16_t<base + 0x86> ADDBLDRB;
 
 
 		//-----------------------------------------------------------------//
@@ -126,7 +126,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 12>  AD;
 			bits_rw_t<io_, bitpos::B14, 2>  DIAGST;
 		};
-		static adrd_t<base + 0x1E>  ADRD;
+		static IO_SIM_INLINE adrd_t<base + 0x1E>  ADRD;
 
 
 		//-----------------------------------------------------------------//
@@ -154,7 +154,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B13, 2> ADCS;
 			bit_rw_t <io_, bitpos::B15>    ADST;
 		};
-		static adcsr_t<base + 0x00>  ADCSR;
+		static IO_SIM_INLINE adcsr_t<base + 0x00>  ADCSR;
 
 
 		//-----------------------------------------------------------------//
@@ -174,7 +174,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 3>  ADC;
 			bit_rw_t <io_, bitpos::B7>     AVEE;
 		};
-		static adadc_t<base + 0x0C>  ADADC;
+		static IO_SIM_INLINE adadc_t<base + 0x0C>  ADADC;
 
 
 		//-----------------------------------------------------------------//
@@ -198,7 +198,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B11>    DIAGM;
 			bit_rw_t <io_, bitpos::B15>    ADRFMT;
 		};
-		static adcer_t<base + 0x0E>  ADCER;
+		static IO_SIM_INLINE adcer_t<base + 0x0E>  ADCER;
 
 
 		//-----------------------------------------------------------------//
@@ -218,7 +218,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 6>  TRSB;
 			bits_rw_t<io_, bitpos::B8, 6>  TRSA;
 		};
-		static adstrgr_t<base + 0x10>  ADSTRGR;
+		static IO_SIM_INLINE adstrgr_t<base + 0x10>  ADSTRGR;
 
 
 		//-----------------------------------------------------------------//
@@ -239,7 +239,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B6>     GCADIE;
 			bit_rw_t <io_, bitpos::B7>     GRCE;
 		};
-		static adgctrgr_t<base + 0xD9>  ADGCTRGR;
+		static IO_SIM_INLINE adgctrgr_t<base + 0xD9>  ADGCTRGR;
 
 
 		//-----------------------------------------------------------------//
@@ -247,7 +247,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 0（ADSSTR0）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE0> ADSSTR0;
+		static IO_SIM_INLINE rw8_t<base + 0xE0> ADSSTR0;
 
 
 		//-----------------------------------------------------------------//
@@ -255,7 +255,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 1（ADSSTR1）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE1> ADSSTR1;
+		static IO_SIM_INLINE rw8_t<base + 0xE1> ADSSTR1;
 
 
 		//-----------------------------------------------------------------//
@@ -263,7 +263,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 2（ADSSTR2）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE2> ADSSTR2;
+		static IO_SIM_INLINE rw8_t<base + 0xE2> ADSSTR2;
 
 
 		//-----------------------------------------------------------------//
@@ -271,7 +271,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 3（ADSSTR3）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE3> ADSSTR3;
+		static IO_SIM_INLINE rw8_t<base + 0xE3> ADSSTR3;
 
 
 		//-----------------------------------------------------------------//
@@ -279,7 +279,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 4（ADSSTR4）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE4> ADSSTR4;
+		static IO_SIM_INLINE rw8_t<base + 0xE4> ADSSTR4;
 
 
 		//-----------------------------------------------------------------//
@@ -287,7 +287,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 5（ADSSTR5）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE5> ADSSTR5;
+		static IO_SIM_INLINE rw8_t<base + 0xE5> ADSSTR5;
 
 
 		//-----------------------------------------------------------------//
@@ -295,7 +295,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 6（ADSSTR6）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE6> ADSSTR6;
+		static IO_SIM_INLINE rw8_t<base + 0xE6> ADSSTR6;
 
 
 		//-----------------------------------------------------------------//
@@ -303,7 +303,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 7（ADSSTR7）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE7> ADSSTR7;
+		static IO_SIM_INLINE rw8_t<base + 0xE7> ADSSTR7;
 
 
 		//-----------------------------------------------------------------//
@@ -322,7 +322,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 5>  ADNDIS;
 		};
-		static addiscr_t<base + 0x7A>  ADDISCR;
+		static IO_SIM_INLINE addiscr_t<base + 0x7A>  ADDISCR;
 
 
 		//-----------------------------------------------------------------//
@@ -345,7 +345,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  LGRRS;
 			bit_rw_t<io_, bitpos::B15>  GBRP;
 		};
-		static adgspcr_t<base + 0x80>  ADGSPCR;
+		static IO_SIM_INLINE adgspcr_t<base + 0x80>  ADGSPCR;
 
 
 		//-----------------------------------------------------------------//
@@ -372,7 +372,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B14>    WCMPBE;
 			bit_rw_t <io_, bitpos::B15>    CMPAIE;
 		};
-		static adcmpcr_t<base + 0x90>  ADCMPCR;
+		static IO_SIM_INLINE adcmpcr_t<base + 0x90>  ADCMPCR;
 
 
 		//-----------------------------------------------------------------//
@@ -380,7 +380,7 @@ namespace device {
 			@brief  A/D コンペアデータレジスタ 0 （ ADCMPDR0 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x9C> ADCMPDR0;
+		static IO_SIM_INLINE rw16_t<base + 0x9C> ADCMPDR0;
 
 
 		//-----------------------------------------------------------------//
@@ -388,7 +388,7 @@ namespace device {
 			@brief  A/D コンペアデータレジスタ 1 （ ADCMPDR1 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0x9E> ADCMPDR1;
+		static IO_SIM_INLINE rw16_t<base + 0x9E> ADCMPDR1;
 
 
 		//-----------------------------------------------------------------//
@@ -410,7 +410,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B4>   MONCMPA;
 			bit_rw_t<io_, bitpos::B5>   MONCMPB;
 		};
-		static adwinmon_t<base + 0x8C>  ADWINMON;
+		static IO_SIM_INLINE adwinmon_t<base + 0x8C>  ADWINMON;
 
 
 		//-----------------------------------------------------------------//
@@ -418,7 +418,7 @@ namespace device {
 			@brief	A/D コンペア機能ウィンドウ B 下位側レベル設定レジスタ（ ADWINLLB ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0xA8> ADWINLLB;
+		static IO_SIM_INLINE rw16_t<base + 0xA8> ADWINLLB;
 
 
 		//-----------------------------------------------------------------//
@@ -426,7 +426,7 @@ namespace device {
 			@brief	A/D コンペア機能ウィンドウ B 上位側レベル設定レジスタ（ ADWINULB ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw16_t<base + 0xAA> ADWINULB;
+		static IO_SIM_INLINE rw16_t<base + 0xAA> ADWINULB;
 
 
 		//-----------------------------------------------------------------//
@@ -445,7 +445,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B5>   SAM;
 		};
-		static adsam_t<base + 0x6E>  ADSAM;
+		static IO_SIM_INLINE adsam_t<base + 0x6E>  ADSAM;
 
 
 		//-----------------------------------------------------------------//
@@ -464,7 +464,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>   PRO;
 		};
-		static adsampr_t<base + 0x63>  ADSAMPR;
+		static IO_SIM_INLINE adsampr_t<base + 0x63>  ADSAMPR;
 	};
 
 
@@ -578,7 +578,7 @@ namespace device {
 			}
 
 		};
-		static addr_t ADDR;
+		static IO_SIM_INLINE addr_t ADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -604,7 +604,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  ANSA006;
 			bit_rw_t<io_, bitpos::B7>  ANSA007;
 		};
-		static adansa0_t<base + 0x04>   ADANSA0;
+		static IO_SIM_INLINE adansa0_t<base + 0x04>   ADANSA0;
 
 
 		//-----------------------------------------------------------------//
@@ -630,7 +630,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  ANSB006;
 			bit_rw_t<io_, bitpos::B7>  ANSB007;
 		};
-		static adansb0_t<base + 0x14>   ADANSB0;
+		static IO_SIM_INLINE adansb0_t<base + 0x14>   ADANSB0;
 
 
 		//-----------------------------------------------------------------//
@@ -656,7 +656,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  ANSC006;
 			bit_rw_t<io_, bitpos::B7>  ANSC007;
 		};
-		static adansc0_t<base + 0xD4>   ADANSC0;
+		static IO_SIM_INLINE adansc0_t<base + 0xD4>   ADANSC0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -689,7 +689,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ A0
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x04>   ADANSA;
+		static IO_SIM_INLINE adans_t<base + 0x04>   ADANSA;
 
 
 		//-----------------------------------------------------------------//
@@ -697,7 +697,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ B0
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x14>   ADANSB;
+		static IO_SIM_INLINE adans_t<base + 0x14>   ADANSB;
 
 
 		//-----------------------------------------------------------------//
@@ -705,7 +705,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ C0
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0xD4>   ADANSC;
+		static IO_SIM_INLINE adans_t<base + 0xD4>   ADANSC;
 
 
 		//-----------------------------------------------------------------//
@@ -731,7 +731,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  ADS006;
 			bit_rw_t<io_, bitpos::B7>  ADS007;
 		};
-		static adads0_t<base + 0x08>   ADADS0;
+		static IO_SIM_INLINE adads0_t<base + 0x08>   ADADS0;
 
 
 		//-----------------------------------------------------------------//
@@ -744,7 +744,7 @@ namespace device {
 				wr8_(base + 0xE0 + static_cast<uint32_t>(an), v);
 			}
 		};
-		static adsstr_t ADSSTR;
+		static IO_SIM_INLINE adsstr_t ADSSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -764,7 +764,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 8>  SSTSH;
 			bits_rw_t<io_, bitpos::B8, 3>  SHANS;
 		};
-		static adshcr_t<base + 0x66>   ADSHCR;
+		static IO_SIM_INLINE adshcr_t<base + 0x66>   ADSHCR;
 
 
 		//-----------------------------------------------------------------//
@@ -783,7 +783,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>  SHMD;
 		};
-		static adshmsr_t<base + 0x7C>  ADSHMSR;
+		static IO_SIM_INLINE adshmsr_t<base + 0x7C>  ADSHMSR;
 
 
 		//-----------------------------------------------------------------//
@@ -809,7 +809,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  CMPCHA006;
 			bit_rw_t<io_, bitpos::B7>  CMPCHA007;
 		};
-		static adcmpansr0_t<base + 0x94>  ADCMPANSR0;
+		static IO_SIM_INLINE adcmpansr0_t<base + 0x94>  ADCMPANSR0;
 
 
 		//-----------------------------------------------------------------//
@@ -835,7 +835,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  CMPLCHA006;
 			bit_rw_t<io_, bitpos::B7>  CMPLCHA007;
 		};
-		static adcmplr0_t<base + 0x98>  ADCMPLR0;
+		static IO_SIM_INLINE adcmplr0_t<base + 0x98>  ADCMPLR0;
 
 
 		//-----------------------------------------------------------------//
@@ -861,7 +861,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6>  CMPSTCHA006;
 			bit_rw_t<io_, bitpos::B7>  CMPSTCHA007;
 		};
-		static adcmpsr0_t<base + 0xA0>  ADCMPSR0;
+		static IO_SIM_INLINE adcmpsr0_t<base + 0xA0>  ADCMPSR0;
 
 
 		//-----------------------------------------------------------------//
@@ -881,7 +881,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 6>  CMPCHB;
 			bit_rw_t <io_, bitpos::B7>     CMPLB;
 		};
-		static adcmpbnsr_t<base + 0xA6>  ADCMPBNSR;
+		static IO_SIM_INLINE adcmpbnsr_t<base + 0xA6>  ADCMPBNSR;
 
 
 		//-----------------------------------------------------------------//
@@ -900,7 +900,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B0>     CMPSTB;
 		};
-		static adcmpbsr_t<base + 0xAC>  ADCMPBSR;
+		static IO_SIM_INLINE adcmpbsr_t<base + 0xAC>  ADCMPBSR;
 
 
 		//-----------------------------------------------------------------//
@@ -1093,7 +1093,7 @@ namespace device {
 			@brief  A/D データレジスタ 8（ADDR8）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x30> ADDR8;
+		static IO_SIM_INLINE ro16_t<base + 0x30> ADDR8;
 
 
 		//-----------------------------------------------------------------//
@@ -1101,7 +1101,7 @@ namespace device {
 			@brief  A/D データレジスタ 9（ADDR9）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x32> ADDR9;
+		static IO_SIM_INLINE ro16_t<base + 0x32> ADDR9;
 
 
 		//-----------------------------------------------------------------//
@@ -1109,7 +1109,7 @@ namespace device {
 			@brief  A/D データレジスタ 10（ADDR10）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x34> ADDR10;
+		static IO_SIM_INLINE ro16_t<base + 0x34> ADDR10;
 
 
 		//-----------------------------------------------------------------//
@@ -1117,7 +1117,7 @@ namespace device {
 			@brief  A/D データレジスタ 11（ADDR11）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x36> ADDR11;
+		static IO_SIM_INLINE ro16_t<base + 0x36> ADDR11;
 
 
 		//-----------------------------------------------------------------//
@@ -1125,7 +1125,7 @@ namespace device {
 			@brief  A/D データレジスタ 12（ADDR12）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x38> ADDR12;
+		static IO_SIM_INLINE ro16_t<base + 0x38> ADDR12;
 
 
 		//-----------------------------------------------------------------//
@@ -1133,7 +1133,7 @@ namespace device {
 			@brief  A/D データレジスタ 13（ADDR13）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x3A> ADDR13;
+		static IO_SIM_INLINE ro16_t<base + 0x3A> ADDR13;
 
 
 		//-----------------------------------------------------------------//
@@ -1141,7 +1141,7 @@ namespace device {
 			@brief  A/D データレジスタ 14（ADDR14）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x3C> ADDR14;
+		static IO_SIM_INLINE ro16_t<base + 0x3C> ADDR14;
 
 
 		//-----------------------------------------------------------------//
@@ -1149,7 +1149,7 @@ namespace device {
 			@brief  A/D データレジスタ 15（ADDR15）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x3E> ADDR15;
+		static IO_SIM_INLINE ro16_t<base + 0x3E> ADDR15;
 
 
 		//-----------------------------------------------------------------//
@@ -1157,7 +1157,7 @@ namespace device {
 			@brief  A/D データレジスタ 16（ADDR16）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x40> ADDR16;
+		static IO_SIM_INLINE ro16_t<base + 0x40> ADDR16;
 
 
 		//-----------------------------------------------------------------//
@@ -1165,7 +1165,7 @@ namespace device {
 			@brief  A/D データレジスタ 17（ADDR17）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x42> ADDR17;
+		static IO_SIM_INLINE ro16_t<base + 0x42> ADDR17;
 
 
 		//-----------------------------------------------------------------//
@@ -1173,7 +1173,7 @@ namespace device {
 			@brief  A/D データレジスタ 18（ADDR18）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x44> ADDR18;
+		static IO_SIM_INLINE ro16_t<base + 0x44> ADDR18;
 
 
 		//-----------------------------------------------------------------//
@@ -1181,7 +1181,7 @@ namespace device {
 			@brief  A/D データレジスタ 19（ADDR19）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x46> ADDR19;
+		static IO_SIM_INLINE ro16_t<base + 0x46> ADDR19;
 
 
 		//-----------------------------------------------------------------//
@@ -1189,7 +1189,7 @@ namespace device {
 			@brief  A/D データレジスタ 20（ADDR20）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x48> ADDR20;
+		static IO_SIM_INLINE ro16_t<base + 0x48> ADDR20;
 
 
 		//-----------------------------------------------------------------//
@@ -1197,7 +1197,7 @@ namespace device {
 			@brief  A/D 温度センサデータレジスタ（ ADTSDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x1A> ADTSDR;
+		static IO_SIM_INLINE ro16_t<base + 0x1A> ADTSDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1205,7 +1205,7 @@ namespace device {
 			@brief   A/D 内部基準電圧データレジスタ（ ADOCDR ）
 		*/
 		//-----------------------------------------------------------------//
-		static ro16_t<base + 0x1C> ADOCDR;
+		static IO_SIM_INLINE ro16_t<base + 0x1C> ADOCDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1225,7 +1225,7 @@ namespace device {
 				}
 			}
 		};
-		static addr_t ADDR;
+		static IO_SIM_INLINE addr_t ADDR;
 
 
 		//-----------------------------------------------------------------//
@@ -1259,7 +1259,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  ANSA014;  ///< AN114
 			bit_rw_t<io_, bitpos::B15>  ANSA015;  ///< AN115
 		};
-		static adansa0_t<base + 0x04>   ADANSA0;
+		static IO_SIM_INLINE adansa0_t<base + 0x04>   ADANSA0;
 
 
 		//-----------------------------------------------------------------//
@@ -1282,7 +1282,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>  ANSA103;  ///< AN119
 			bit_rw_t<io_, bitpos::B4>  ANSA104;  ///< AN120
 		};
-		static adansa1_t<base + 0x06>   ADANSA1;
+		static IO_SIM_INLINE adansa1_t<base + 0x06>   ADANSA1;
 
 
 		//-----------------------------------------------------------------//
@@ -1316,7 +1316,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  ANSB014;  ///< AN114
 			bit_rw_t<io_, bitpos::B15>  ANSB015;  ///< AN115
 		};
-		static adansb0_t<base + 0x14>   ADANSB0;
+		static IO_SIM_INLINE adansb0_t<base + 0x14>   ADANSB0;
 
 
 		//-----------------------------------------------------------------//
@@ -1339,7 +1339,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>  ANSA103;  ///< AN119
 			bit_rw_t<io_, bitpos::B4>  ANSA104;  ///< AN120
 		};
-		static adansb1_t<base + 0x16>   ADANSB1;
+		static IO_SIM_INLINE adansb1_t<base + 0x16>   ADANSB1;
 
 
 		//-----------------------------------------------------------------//
@@ -1373,7 +1373,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  ANSC014;  ///< AN114
 			bit_rw_t<io_, bitpos::B15>  ANSC015;  ///< AN115
 		};
-		static adansc0_t<base + 0xD4>   ADANSC0;
+		static IO_SIM_INLINE adansc0_t<base + 0xD4>   ADANSC0;
 
 
 		//-----------------------------------------------------------------//
@@ -1396,7 +1396,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>  ANSC103;  ///< AN119
 			bit_rw_t<io_, bitpos::B4>  ANSC104;  ///< AN120
 		};
-		static adansc1_t<base + 0xD6>   ADANSC1;
+		static IO_SIM_INLINE adansc1_t<base + 0xD6>   ADANSC1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1438,7 +1438,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ（ADANSA）
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x04> ADANSA;
+		static IO_SIM_INLINE adans_t<base + 0x04> ADANSA;
 
 
 		//-----------------------------------------------------------------//
@@ -1446,7 +1446,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 B
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0x14> ADANSB;
+		static IO_SIM_INLINE adans_t<base + 0x14> ADANSB;
 
 
 		//-----------------------------------------------------------------//
@@ -1454,7 +1454,7 @@ namespace device {
 			@brief  A/D チャネル選択レジスタ設定 C
 		*/
 		//-----------------------------------------------------------------//
-		static adans_t<base + 0xD4> ADANSC;
+		static IO_SIM_INLINE adans_t<base + 0xD4> ADANSC;
 
 
 		//-----------------------------------------------------------------//
@@ -1488,7 +1488,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  ADS014;  ///< AN114
 			bit_rw_t<io_, bitpos::B15>  ADS015;  ///< AN115
 		};
-		static adads0_t<base + 0x08>   ADADS0;
+		static IO_SIM_INLINE adads0_t<base + 0x08>   ADADS0;
 
 
 		//-----------------------------------------------------------------//
@@ -1511,7 +1511,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>   ADS103;  ///< AN119
 			bit_rw_t<io_, bitpos::B4>   ADS104;  ///< AN120
 		};
-		static adads1_t<base + 0x0A>   ADADS1;
+		static IO_SIM_INLINE adads1_t<base + 0x0A>   ADADS1;
 
 
 		//-----------------------------------------------------------------//
@@ -1539,7 +1539,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B13, 2>  EXSEL;
 			bit_rw_t <io_, bitpos::B15>     EXOEN;
 		};
-		static adexicr_t<base + 0x12>   ADEXICR;
+		static IO_SIM_INLINE adexicr_t<base + 0x12>   ADEXICR;
 
 
 		//-----------------------------------------------------------------//
@@ -1559,7 +1559,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>      TSSC;
 			bit_rw_t <io_, bitpos::B1>      OCSC;
 		};
-		static adgcexcr_t<base + 0xD8>   ADGCEXCR;
+		static IO_SIM_INLINE adgcexcr_t<base + 0xD8>   ADGCEXCR;
 
 
 		//-----------------------------------------------------------------//
@@ -1567,7 +1567,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ L（ADSSTRL）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xDD> ADSSTRL;
+		static IO_SIM_INLINE rw8_t<base + 0xDD> ADSSTRL;
 
 
 		//-----------------------------------------------------------------//
@@ -1575,7 +1575,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ T（ADSSTRT）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xDE> ADSSTRT;
+		static IO_SIM_INLINE rw8_t<base + 0xDE> ADSSTRT;
 
 
 		//-----------------------------------------------------------------//
@@ -1583,7 +1583,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ O（ADSSTRO）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xDF> ADSSTRO;
+		static IO_SIM_INLINE rw8_t<base + 0xDF> ADSSTRO;
 
 
 		//-----------------------------------------------------------------//
@@ -1591,7 +1591,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 8 （ ADSSTR8 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE8> ADSSTR8;
+		static IO_SIM_INLINE rw8_t<base + 0xE8> ADSSTR8;
 
 
 		//-----------------------------------------------------------------//
@@ -1599,7 +1599,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 9 （ ADSSTR9 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xE9> ADSSTR9;
+		static IO_SIM_INLINE rw8_t<base + 0xE9> ADSSTR9;
 
 
 		//-----------------------------------------------------------------//
@@ -1607,7 +1607,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 10 （ ADSSTR10 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xEA> ADSSTR10;
+		static IO_SIM_INLINE rw8_t<base + 0xEA> ADSSTR10;
 
 
 		//-----------------------------------------------------------------//
@@ -1615,7 +1615,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 11 （ ADSSTR11 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xEB> ADSSTR11;
+		static IO_SIM_INLINE rw8_t<base + 0xEB> ADSSTR11;
 
 
 		//-----------------------------------------------------------------//
@@ -1623,7 +1623,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 12 （ ADSSTR12 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xEC> ADSSTR12;
+		static IO_SIM_INLINE rw8_t<base + 0xEC> ADSSTR12;
 
 
 		//-----------------------------------------------------------------//
@@ -1631,7 +1631,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 13 （ ADSSTR13 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xED> ADSSTR13;
+		static IO_SIM_INLINE rw8_t<base + 0xED> ADSSTR13;
 
 
 		//-----------------------------------------------------------------//
@@ -1639,7 +1639,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 14 （ ADSSTR14 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xEE> ADSSTR14;
+		static IO_SIM_INLINE rw8_t<base + 0xEE> ADSSTR14;
 
 
 		//-----------------------------------------------------------------//
@@ -1647,7 +1647,7 @@ namespace device {
 			@brief  A/D サンプリングステートレジスタ 15 （ ADSSTR15 ）
 		*/
 		//-----------------------------------------------------------------//
-		static rw8_t<base + 0xEF> ADSSTR15;
+		static IO_SIM_INLINE rw8_t<base + 0xEF> ADSSTR15;
 
 
 		//-----------------------------------------------------------------//
@@ -1660,7 +1660,7 @@ namespace device {
 				wr8_(base + 0xE0 + static_cast<uint32_t>(an), v);
 			}
 		};
-		static adsstr_t ADSSTR;
+		static IO_SIM_INLINE adsstr_t ADSSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -1694,7 +1694,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  CMPCHA014;
 			bit_rw_t<io_, bitpos::B15>  CMPCHA015;
 		};
-		static adcmpansr0_t<base + 0x94>  ADCMPANSR0;
+		static IO_SIM_INLINE adcmpansr0_t<base + 0x94>  ADCMPANSR0;
 
 
 		//-----------------------------------------------------------------//
@@ -1717,7 +1717,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>   CMPCHA103;
 			bit_rw_t<io_, bitpos::B4>   CMPCHA104;
 		};
-		static adcmpansr1_t<base + 0x96>  ADCMPANSR1;
+		static IO_SIM_INLINE adcmpansr1_t<base + 0x96>  ADCMPANSR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1737,7 +1737,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B0>  CMPSTS;
 			bit_rw_t <io_, bitpos::B1>  CMPSOC;
 		};
-		static adcmpanser_t<base + 0x92>  ADCMPANSER;
+		static IO_SIM_INLINE adcmpanser_t<base + 0x92>  ADCMPANSER;
 
 
 		//-----------------------------------------------------------------//
@@ -1771,7 +1771,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  CMPLCHA014;
 			bit_rw_t<io_, bitpos::B15>  CMPLCHA015;
 		};
-		static adcmplr0_t<base + 0x98>  ADCMPLR0;
+		static IO_SIM_INLINE adcmplr0_t<base + 0x98>  ADCMPLR0;
 
 
 		//-----------------------------------------------------------------//
@@ -1794,7 +1794,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>   CMPLCHA103;
 			bit_rw_t<io_, bitpos::B4>   CMPLCHA104;
 		};
-		static adcmplr1_t<base + 0x9A>  ADCMPLR1;
+		static IO_SIM_INLINE adcmplr1_t<base + 0x9A>  ADCMPLR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1814,7 +1814,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  CMPLTS;
 			bit_rw_t<io_, bitpos::B0>  CMPLOC;
 		};
-		static adcmpler_t<base + 0x93>  ADCMPLER;
+		static IO_SIM_INLINE adcmpler_t<base + 0x93>  ADCMPLER;
 
 
 		//-----------------------------------------------------------------//
@@ -1848,7 +1848,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B14>  CMPSTCHA014;
 			bit_rw_t<io_, bitpos::B15>  CMPSTCHA015;
 		};
-		static adcmpsr0_t<base + 0xA0>  ADCMPSR0;
+		static IO_SIM_INLINE adcmpsr0_t<base + 0xA0>  ADCMPSR0;
 
 
 		//-----------------------------------------------------------------//
@@ -1871,7 +1871,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B3>   CMPSTCHA103;
 			bit_rw_t<io_, bitpos::B4>   CMPSTCHA104;
 		};
-		static adcmpsr1_t<base + 0xA2>  ADCMPSR1;
+		static IO_SIM_INLINE adcmpsr1_t<base + 0xA2>  ADCMPSR1;
 
 
 		//-----------------------------------------------------------------//
@@ -1891,7 +1891,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  CMPFTS;
 			bit_rw_t<io_, bitpos::B1>  CMPFOC;
 		};
-		static adcmpser_t<base + 0xA4>  ADCMPSER;
+		static IO_SIM_INLINE adcmpser_t<base + 0xA4>  ADCMPSER;
 
 
 		//-----------------------------------------------------------------//
@@ -1911,7 +1911,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B0, 6>  CMPCHB;
 			bit_rw_t <io_, bitpos::B7>     CMPLB;
 		};
-		static adcmpbnsr_t<base + 0xA6>  ADCMPBNSR;
+		static IO_SIM_INLINE adcmpbnsr_t<base + 0xA6>  ADCMPBNSR;
 
 
 		//-----------------------------------------------------------------//
@@ -1930,7 +1930,7 @@ namespace device {
 
 			bit_rw_t<io_, bitpos::B0>    CMPSTB;
 		};
-		static adcmpbsr_t<base + 0xAC>  ADCMPBSR;
+		static IO_SIM_INLINE adcmpbsr_t<base + 0xAC>  ADCMPBSR;
 
 
 		//-----------------------------------------------------------------//
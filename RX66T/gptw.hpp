@@ -55,7 +55,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B4>     CMNWP;
 			bits_rw_t<io_, bitpos::B8, 8>  KEY;
 		};
-		static gtwp_t<base + 0x00> GTWP;
+		static IO_SIM_INLINE gtwp_t<base + 0x00> GTWP;
 
 
 		//-----------------------------------------------------------------//
@@ -83,7 +83,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>  CSTRT8;
 			bit_rw_t <io_, bitpos::B9>  CSTRT9;
 		};
-		static gtstr_t<base + 0x04> GTSTR;
+		static IO_SIM_INLINE gtstr_t<base + 0x04> GTSTR;
 
 
 		//-----------------------------------------------------------------//
@@ -111,7 +111,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>  CSTOP8;
 			bit_rw_t <io_, bitpos::B9>  CSTOP9;
 		};
-		static gtstp_t<base + 0x08> GTSTP;
+		static IO_SIM_INLINE gtstp_t<base + 0x08> GTSTP;
 
 
 		//-----------------------------------------------------------------//
@@ -139,7 +139,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>  CCLR8;
 			bit_rw_t <io_, bitpos::B9>  CCLR9;
 		};
-		static gtclr_t<base + 0x0C> GTCLR;
+		static IO_SIM_INLINE gtclr_t<base + 0x0C> GTCLR;
 
 
 		//-----------------------------------------------------------------//
@@ -183,7 +183,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B31> CSTRT;
 		};
-		static gtssr_t<base + 0x10> GTSSR;
+		static IO_SIM_INLINE gtssr_t<base + 0x10> GTSSR;
 
 
 		//-----------------------------------------------------------------//
@@ -227,7 +227,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B31> CSTOP;
 		};
-		static gtpsr_t<base + 0x14> GTPSR;
+		static IO_SIM_INLINE gtpsr_t<base + 0x14> GTPSR;
 
 
 		//-----------------------------------------------------------------//
@@ -271,7 +271,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B31> CCLR;
 		};
-		static gtcsr_t<base + 0x18> GTCSR;
+		static IO_SIM_INLINE gtcsr_t<base + 0x18> GTCSR;
 
 
 		//-----------------------------------------------------------------//
@@ -313,7 +313,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B22> USELCG;
 			bit_rw_t <io_, bitpos::B23> USELCH;
 		};
-		static gtupsr_t<base + 0x1C> GTUPSR;
+		static IO_SIM_INLINE gtupsr_t<base + 0x1C> GTUPSR;
 
 
 		//-----------------------------------------------------------------//
@@ -355,7 +355,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B22> DSELCG;
 			bit_rw_t <io_, bitpos::B23> DSELCH;
 		};
-		static gtdnsr_t<base + 0x20> GTDNSR;
+		static IO_SIM_INLINE gtdnsr_t<base + 0x20> GTDNSR;
 
 
 		//-----------------------------------------------------------------//
@@ -397,7 +397,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B22> ASELCG;
 			bit_rw_t <io_, bitpos::B23> ASELCH;
 		};
-		static gticasr_t<base + 0x24> GTICASR;
+		static IO_SIM_INLINE gticasr_t<base + 0x24> GTICASR;
 
 
 		//-----------------------------------------------------------------//
@@ -439,7 +439,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B22> BSELCG;
 			bit_rw_t <io_, bitpos::B23> BSELCH;
 		};
-		static gticbsr_t<base + 0x28> GTICBSR;
+		static IO_SIM_INLINE gticbsr_t<base + 0x28> GTICBSR;
 
 
 		//-----------------------------------------------------------------//
@@ -461,7 +461,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B16, 3>  MD;
 			bits_rw_t<io_, bitpos::B23, 4>  TPCS;
 		};
-		static gtcr_t<base + 0x2C> GTCR;
+		static IO_SIM_INLINE gtcr_t<base + 0x2C> GTCR;
 
 
 		//-----------------------------------------------------------------//
@@ -489,7 +489,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B26>     OBDTYF;
 			bit_rw_t <io_, bitpos::B27>     OBDTYR;
 		};
-		static gtuddtyc_t<base + 0x30> GTUDDTYC;
+		static IO_SIM_INLINE gtuddtyc_t<base + 0x30> GTUDDTYC;
 
 
 		//-----------------------------------------------------------------//
@@ -526,7 +526,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B29>     NFBEN;
 			bits_rw_t<io_, bitpos::B30, 2>  NFCSB;
 		};
-		static gtior_t<base + 0x34> GTIOR;
+		static IO_SIM_INLINE gtior_t<base + 0x34> GTIOR;
 
 
 		//-----------------------------------------------------------------//
@@ -562,7 +562,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B29>     GRPABH;
 			bit_rw_t <io_, bitpos::B30>     GRPABL;
 		};
-		static gtintad_t<base + 0x38> GTINTAD;
+		static IO_SIM_INLINE gtintad_t<base + 0x38> GTINTAD;
 
 
 		//-----------------------------------------------------------------//
@@ -594,7 +594,7 @@ namespace device {
 			bit_ro_t <io_, bitpos::B29>     OABHF;
 			bit_ro_t <io_, bitpos::B30>     OABLF;
 		};
-		static gtst_t<base + 0x3C> GTST;
+		static IO_SIM_INLINE gtst_t<base + 0x3C> GTST;
 
 
 		//-----------------------------------------------------------------//
@@ -631,7 +631,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B28, 2>  ADTTB;
 			bit_rw_t <io_, bitpos::B30>     ADTDB;
 		};
-		static gtber_t<base + 0x40> GTBER;
+		static IO_SIM_INLINE gtber_t<base + 0x40> GTBER;
 
 
 		//-----------------------------------------------------------------//
@@ -661,7 +661,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B14>     ADTBL;
 		};
-		static gtitc_t<base + 0x44> GTITC;
+		static IO_SIM_INLINE gtitc_t<base + 0x44> GTITC;
 
 
 		//-----------------------------------------------------------------//
@@ -669,7 +669,7 @@ namespace device {
 			@brief	汎用 PWM タイマカウンタ (GTCNT)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x48>  GTCNT;
+		static IO_SIM_INLINE rw32_t<base + 0x48>  GTCNT;
 
 
 		//-----------------------------------------------------------------//
@@ -677,12 +677,12 @@ namespace device {
 			@brief	汎用 PWM タイマコンペアキャプチャレジスタ m (GTCCRm) (m = A ～ F)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x4C>  GTCCRA;
-		static rw32_t<base + 0x50>  GTCCRB;
-		static rw32_t<base + 0x54>  GTCCRC;
-		static rw32_t<base + 0x58>  GTCCRD;
-		static rw32_t<base + 0x5C>  GTCCRE;
-		static rw32_t<base + 0x60>  GTCCRF;
+		static IO_SIM_INLINE rw32_t<base + 0x4C>  GTCCRA;
+		static IO_SIM_INLINE rw32_t<base + 0x50>  GTCCRB;
+		static IO_SIM_INLINE rw32_t<base + 0x54>  GTCCRC;
+		static IO_SIM_INLINE rw32_t<base + 0x58>  GTCCRD;
+		static IO_SIM_INLINE rw32_t<base + 0x5C>  GTCCRE;
+		static IO_SIM_INLINE rw32_t<base + 0x60>  GTCCRF;
 
 
 		//-----------------------------------------------------------------//
@@ -690,7 +690,7 @@ namespace device {
 			@brief	汎用 PWM タイマ周期設定レジスタ (GTPR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x64>  GTPR;
+		static IO_SIM_INLINE rw32_t<base + 0x64>  GTPR;
 
 
 		//-----------------------------------------------------------------//
@@ -698,7 +698,7 @@ namespace device {
 			@brief	汎用 PWM タイマ周期設定バッファレジスタ (GTPBR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x68>  GTPBR;
+		static IO_SIM_INLINE rw32_t<base + 0x68>  GTPBR;
 
 
 		//-----------------------------------------------------------------//
@@ -706,7 +706,7 @@ namespace device {
 			@brief	汎用 PWM タイマ周期設定ダブルバッファレジスタ (GTPDBR)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x6C>  GTPDBR;
+		static IO_SIM_INLINE rw32_t<base + 0x6C>  GTPDBR;
 
 
 		//-----------------------------------------------------------------//
@@ -714,8 +714,8 @@ namespace device {
 			@brief	A/D 変換開始要求タイミングレジスタ m (GTADTRm) (m = A, B)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x70>  GTADTRA;
-		static rw32_t<base + 0x7C>  GTADTRB;
+		static IO_SIM_INLINE rw32_t<base + 0x70>  GTADTRA;
+		static IO_SIM_INLINE rw32_t<base + 0x7C>  GTADTRB;
 
 
 		//-----------------------------------------------------------------//
@@ -723,8 +723,8 @@ namespace device {
 			@brief	A/D 変換開始要求タイミングバッファレジスタ m (GTADTBRm) (m = A, B)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x74>  GTADTBRA;
-		static rw32_t<base + 0x80>  GTADTBRB;
+		static IO_SIM_INLINE rw32_t<base + 0x74>  GTADTBRA;
+		static IO_SIM_INLINE rw32_t<base + 0x80>  GTADTBRB;
 
 
 		//-----------------------------------------------------------------//
@@ -732,8 +732,8 @@ namespace device {
 			@brief	A/D 変換開始要求タイミングダブルバッファレジスタ m (GTADTDBRm)(m = A, B)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x78>  GTADTDBRA;
-		static rw32_t<base + 0x84>  GTADTDBRB;
+		static IO_SIM_INLINE rw32_t<base + 0x78>  GTADTDBRA;
+		static IO_SIM_INLINE rw32_t<base + 0x84>  GTADTDBRB;
 
 
 		//-----------------------------------------------------------------//
@@ -757,7 +757,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B8>      TDFER;
 		};
-		static gtdtcr_t<base + 0x88> GTDTCR;
+		static IO_SIM_INLINE gtdtcr_t<base + 0x88> GTDTCR;
 
 
 		//-----------------------------------------------------------------//
@@ -765,8 +765,8 @@ namespace device {
 			@brief	汎用 PWM タイマデッドタイム値レジスタ m (GTDVm) (m = U, D)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x8C>  GTDVU;
-		static rw32_t<base + 0x90>  GTDVD;
+		static IO_SIM_INLINE rw32_t<base + 0x8C>  GTDVU;
+		static IO_SIM_INLINE rw32_t<base + 0x90>  GTDVD;
 
 
 		//-----------------------------------------------------------------//
@@ -774,8 +774,8 @@ namespace device {
 			@brief	汎用 PWM タイマデッドタイムバッファレジスタ m (GTDBm) (m = U, D)
 		*/
 		//-----------------------------------------------------------------//
-		static rw32_t<base + 0x94>  GTDBU;
-		static rw32_t<base + 0x98>  GTDBD;
+		static IO_SIM_INLINE rw32_t<base + 0x94>  GTDBU;
+		static IO_SIM_INLINE rw32_t<base + 0x98>  GTDBD;
 
 
 		//-----------------------------------------------------------------//
@@ -794,7 +794,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>   SOS;
 		};
-		static gtsos_t<base + 0x9C> GTSOS;
+		static IO_SIM_INLINE gtsos_t<base + 0x9C> GTSOS;
 
 
 		//-----------------------------------------------------------------//
@@ -813,7 +813,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 2>   SOTR;
 		};
-		static gtsotr_t<base + 0xA0> GTSOTR;
+		static IO_SIM_INLINE gtsotr_t<base + 0xA0> GTSOTR;
 
 
 		//-----------------------------------------------------------------//
@@ -838,7 +838,7 @@ namespace device {
 
 			bit_rw_t <io_, bitpos::B24>     ADSMEN1;
 		};
-		static gtadsmr_t<base + 0xA4> GTADSMR;
+		static IO_SIM_INLINE gtadsmr_t<base + 0xA4> GTADSMR;
 
 
 		//-----------------------------------------------------------------//
@@ -867,7 +867,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B24, 4>  EITCNT2IV;
 			bits_rw_t<io_, bitpos::B28, 4>  EITCNT2;
 		};
-		static gteitc_t<base + 0xA8> GTEITC;
+		static IO_SIM_INLINE gteitc_t<base + 0xA8> GTEITC;
 
 
 		//-----------------------------------------------------------------//
@@ -900,7 +900,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B28, 3>  EITLU;
 		};
-		static gteitli1_t<base + 0xAC> GTEITLI1;
+		static IO_SIM_INLINE gteitli1_t<base + 0xAC> GTEITLI1;
 
 
 		//-----------------------------------------------------------------//
@@ -921,7 +921,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B4, 3>   EADTBL;
 		};
-		static gteitli2_t<base + 0xB0> GTEITLI2;
+		static IO_SIM_INLINE gteitli2_t<base + 0xB0> GTEITLI2;
 
 
 		//-----------------------------------------------------------------//
@@ -952,7 +952,7 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B28, 3>  EBTLDVD;
 		};
-		static gteitlb_t<base + 0xB4> GTEITLB;
+		static IO_SIM_INLINE gteitlb_t<base + 0xB4> GTEITLB;
 
 
 		//-----------------------------------------------------------------//
@@ -980,7 +980,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B8>      SECSEL8;
 			bit_rw_t <io_, bitpos::B9>      SECSEL9;
 		};
-		static gtsecsr_t<base + 0xD0> GTSECSR;
+		static IO_SIM_INLINE gtsecsr_t<base + 0xD0> GTSECSR;
 
 
 		//-----------------------------------------------------------------//
@@ -1007,7 +1007,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B10>     SBDAD;
 			bit_rw_t <io_, bitpos::B11>     SBDDD;
 		};
-		static gtsecr_t<base + 0xD4> GTSECR;
+		static IO_SIM_INLINE gtsecr_t<base + 0xD4> GTSECR;
 
 
 		//-----------------------------------------------------------------//
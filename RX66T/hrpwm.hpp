@@ -38,7 +38,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B0>  DLLEN;
 			bit_rw_t<io_, bitpos::B1>  HRRST;
 		};
-		static hrocr_t<0x000C2A00> HROCR;
+		static IO_SIM_INLINE hrocr_t<0x000C2A00> HROCR;
 
 
 		//-----------------------------------------------------------------//
@@ -65,7 +65,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B10>  HRDIS2;
 			bit_rw_t<io_, bitpos::B11>  HRDIS3;
 		};
-		static hrocr2_t<0x000C2A02> HROCR2;
+		static IO_SIM_INLINE hrocr2_t<0x000C2A02> HROCR2;
 
 
 		//-----------------------------------------------------------------//
@@ -84,10 +84,10 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>  DLY;
 		};
-		static hrrearna_t<0x000C2A18> HRREAR0A;
-		static hrrearna_t<0x000C2A1C> HRREAR1A;
-		static hrrearna_t<0x000C2A20> HRREAR2A;
-		static hrrearna_t<0x000C2A24> HRREAR3A;
+		static IO_SIM_INLINE hrrearna_t<0x000C2A18> HRREAR0A;
+		static IO_SIM_INLINE hrrearna_t<0x000C2A1C> HRREAR1A;
+		static IO_SIM_INLINE hrrearna_t<0x000C2A20> HRREAR2A;
+		static IO_SIM_INLINE hrrearna_t<0x000C2A24> HRREAR3A;
 
 
 		//-----------------------------------------------------------------//
@@ -106,10 +106,10 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>  DLY;
 		};
-		static hrfearna_t<0x000C2A28> HRFEAR0A;
-		static hrfearna_t<0x000C2A2C> HRFEAR1A;
-		static hrfearna_t<0x000C2A30> HRFEAR2A;
-		static hrfearna_t<0x000C2A34> HRFEAR3A;
+		static IO_SIM_INLINE hrfearna_t<0x000C2A28> HRFEAR0A;
+		static IO_SIM_INLINE hrfearna_t<0x000C2A2C> HRFEAR1A;
+		static IO_SIM_INLINE hrfearna_t<0x000C2A30> HRFEAR2A;
+		static IO_SIM_INLINE hrfearna_t<0x000C2A34> HRFEAR3A;
 
 
 		//-----------------------------------------------------------------//
@@ -128,10 +128,10 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>  DLY;
 		};
-		static hrrearnb_t<0x000C2A1A> HRREAR0B;
-		static hrrearnb_t<0x000C2A1E> HRREAR1B;
-		static hrrearnb_t<0x000C2A22> HRREAR2B;
-		static hrrearnb_t<0x000C2A26> HRREAR3B;
+		static IO_SIM_INLINE hrrearnb_t<0x000C2A1A> HRREAR0B;
+		static IO_SIM_INLINE hrrearnb_t<0x000C2A1E> HRREAR1B;
+		static IO_SIM_INLINE hrrearnb_t<0x000C2A22> HRREAR2B;
+		static IO_SIM_INLINE hrrearnb_t<0x000C2A26> HRREAR3B;
 
 
 		//-----------------------------------------------------------------//
@@ -150,10 +150,10 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B0, 4>  DLY;
 		};
-		static hrfearnb_t<0x000C2A1A> HRFEAR0B;
-		static hrfearnb_t<0x000C2A1E> HRFEAR1B;
-		static hrfearnb_t<0x000C2A22> HRFEAR2B;
-		static hrfearnb_t<0x000C2A26> HRFEAR3B;
+		static IO_SIM_INLINE hrfearnb_t<0x000C2A1A> HRFEAR0B;
+		static IO_SIM_INLINE hrfearnb_t<0x000C2A1E> HRFEAR1B;
+		static IO_SIM_INLINE hrfearnb_t<0x000C2A22> HRFEAR2B;
+		static IO_SIM_INLINE hrfearnb_t<0x000C2A26> HRFEAR3B;
 
 
 		//-----------------------------------------------------------------//
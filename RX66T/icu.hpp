@@ -699,11 +699,11 @@ namespace device {
 				@return IR レジスターの参照
 			*/
 			//-------------------------------------------------------------//
-			volatile uint8_t& operator [] (uint8_t idx) {
-				return *reinterpret_cast<volatile uint8_t*>(base + idx);
+			ref8_type operator [] (uint8_t idx) {
+				return ref8_(base + idx);
 			}
 		};
-		static ir_t<0x00087010> IR;
+		static IO_SIM_INLINE ir_t<0x00087010> IR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -954,7 +954,7 @@ namespace device {
 				return tmp & (1 << (idx & 7));
 			}
 		};
-		static ier_t<0x00087200> IER;
+		static IO_SIM_INLINE ier_t<0x00087200> IER;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1161,11 +1161,11 @@ namespace device {
 				@return IR レジスターの参照
 			*/
 			//-------------------------------------------------------------//
-			volatile uint8_t& operator [] (uint8_t idx) {
-				return *reinterpret_cast<volatile uint8_t*>(base + idx);
+			ref8_type operator [] (uint8_t idx) {
+				return ref8_(base + idx);
 			}
 		};
-		static ipr_t<0x00087300> IPR;
+		static IO_SIM_INLINE ipr_t<0x00087300> IPR;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1173,14 +1173,14 @@ namespace device {
 			@brief  DMAC 起動要因選択レジスタ m（DMRSRm）（m = DMAC チャネル番号）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw8_t<0x00087400> DMRSR0;
-		static rw8_t<0x00087404> DMRSR1;
-		static rw8_t<0x00087408> DMRSR2;
-		static rw8_t<0x0008740C> DMRSR3;
-		static rw8_t<0x00087410> DMRSR4;
-		static rw8_t<0x00087414> DMRSR5;
-		static rw8_t<0x00087418> DMRSR6;
-		static rw8_t<0x0008741C> DMRSR7;
+		static IO_SIM_INLINE rw8_t<0x00087400> DMRSR0;
+		static IO_SIM_INLINE rw8_t<0x00087404> DMRSR1;
+		static IO_SIM_INLINE rw8_t<0x00087408> DMRSR2;
+		static IO_SIM_INLINE rw8_t<0x0008740C> DMRSR3;
+		static IO_SIM_INLINE rw8_t<0x00087410> DMRSR4;
+		static IO_SIM_INLINE rw8_t<0x00087414> DMRSR5;
+		static IO_SIM_INLINE rw8_t<0x00087418> DMRSR6;
+		static IO_SIM_INLINE rw8_t<0x0008741C> DMRSR7;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1199,22 +1199,22 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B2, 2>  IRQMD;
 		};
-		static irqcr_t<0x00087500>  IRQCR0;
-		static irqcr_t<0x00087501>  IRQCR1;
-		static irqcr_t<0x00087502>  IRQCR2;
-		static irqcr_t<0x00087503>  IRQCR3;
-		static irqcr_t<0x00087504>  IRQCR4;
-		static irqcr_t<0x00087505>  IRQCR5;
-		static irqcr_t<0x00087506>  IRQCR6;
-		static irqcr_t<0x00087507>  IRQCR7;
-		static irqcr_t<0x00087508>  IRQCR8;
-		static irqcr_t<0x00087509>  IRQCR9;
-		static irqcr_t<0x0008750A>  IRQCR10;
-		static irqcr_t<0x0008750B>  IRQCR11;
-		static irqcr_t<0x0008750C>  IRQCR12;
-		static irqcr_t<0x0008750D>  IRQCR13;
-		static irqcr_t<0x0008750E>  IRQCR14;
-		static irqcr_t<0x0008750F>  IRQCR15;
+		static IO_SIM_INLINE irqcr_t<0x00087500>  IRQCR0;
+		static IO_SIM_INLINE irqcr_t<0x00087501>  IRQCR1;
+		static IO_SIM_INLINE irqcr_t<0x00087502>  IRQCR2;
+		static IO_SIM_INLINE irqcr_t<0x00087503>  IRQCR3;
+		static IO_SIM_INLINE irqcr_t<0x00087504>  IRQCR4;
+		static IO_SIM_INLINE irqcr_t<0x00087505>  IRQCR5;
+		static IO_SIM_INLINE irqcr_t<0x00087506>  IRQCR6;
+		static IO_SIM_INLINE irqcr_t<0x00087507>  IRQCR7;
+		static IO_SIM_INLINE irqcr_t<0x00087508>  IRQCR8;
+		static IO_SIM_INLINE irqcr_t<0x00087509>  IRQCR9;
+		static IO_SIM_INLINE irqcr_t<0x0008750A>  IRQCR10;
+		static IO_SIM_INLINE irqcr_t<0x0008750B>  IRQCR11;
+		static IO_SIM_INLINE irqcr_t<0x0008750C>  IRQCR12;
+		static IO_SIM_INLINE irqcr_t<0x0008750D>  IRQCR13;
+		static IO_SIM_INLINE irqcr_t<0x0008750E>  IRQCR14;
+		static IO_SIM_INLINE irqcr_t<0x0008750F>  IRQCR15;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1240,7 +1240,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> FLTEN6;
 			bit_rw_t<io_, bitpos::B7> FLTEN7;
 		};
-		static irqflte0_t<0x00087520> IRQFLTE0;
+		static IO_SIM_INLINE irqflte0_t<0x00087520> IRQFLTE0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1266,7 +1266,7 @@ namespace device {
 			bit_rw_t<io_, bitpos::B6> FLTEN14;
 			bit_rw_t<io_, bitpos::B7> FLTEN15;
 		};
-		static irqflte1_t<0x00087521> IRQFLTE1;
+		static IO_SIM_INLINE irqflte1_t<0x00087521> IRQFLTE1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1292,7 +1292,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 2> FCLKSEL6;
 			bits_rw_t<io_, bitpos::B14, 2> FCLKSEL7;
 		};
-		static irqfltc0_t<0x00087528> IRQFLTC0;
+		static IO_SIM_INLINE irqfltc0_t<0x00087528> IRQFLTC0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1318,7 +1318,7 @@ namespace device {
 			bits_rw_t<io_, bitpos::B12, 2> FCLKSEL14;
 			bits_rw_t<io_, bitpos::B14, 2> FCLKSEL15;
 		};
-		static irqfltc1_t<0x0008752A> IRQFLTC1;
+		static IO_SIM_INLINE irqfltc1_t<0x0008752A> IRQFLTC1;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1377,10 +1377,10 @@ namespace device {
 					グループ AL0/1 割り込み要求レジスタ（GRPAL0/GRPAL1）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static grp_t<0x00087600> GRPBE0;
-		static grp_t<0x00087630> GRPBL0;
-		static grp_t<0x00087634> GRPBL1;
-		static grp_t<0x00087830> GRPAL0;
+		static IO_SIM_INLINE grp_t<0x00087600> GRPBE0;
+		static IO_SIM_INLINE grp_t<0x00087630> GRPBL0;
+		static IO_SIM_INLINE grp_t<0x00087634> GRPBL1;
+		static IO_SIM_INLINE grp_t<0x00087830> GRPAL0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1442,10 +1442,10 @@ namespace device {
 					グループ AL0/1 割り込み要求許可レジスタ（GENAL0/GENAL1）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static gen_t<0x00087640> GENBE0;
-		static gen_t<0x00087670> GENBL0;
-		static gen_t<0x00087674> GENBL1;
-		static gen_t<0x00087870> GENAL0;
+		static IO_SIM_INLINE gen_t<0x00087640> GENBE0;
+		static IO_SIM_INLINE gen_t<0x00087670> GENBL0;
+		static IO_SIM_INLINE gen_t<0x00087674> GENBL1;
+		static IO_SIM_INLINE gen_t<0x00087870> GENAL0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1498,7 +1498,7 @@ namespace device {
 			bit_rw_t <io_, bitpos::B30> CLR30;
 			bit_rw_t <io_, bitpos::B31> CLR31;
 		};
-		static gcrbe0_t<0x00087680> GCRBE0;
+		static IO_SIM_INLINE gcrbe0_t<0x00087680> GCRBE0;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1531,18 +1531,18 @@ namespace device {
 			@brief  選択型割り込み A 要求レジスタ k（PIARk）（k = 0h ～ Bh）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static pixr_t<0x00087900> PIAR0;
-		static pixr_t<0x00087901> PIAR1;
-		static pixr_t<0x00087902> PIAR2;
-		static pixr_t<0x00087903> PIAR3;
-		static pixr_t<0x00087904> PIAR4;
-		static pixr_t<0x00087905> PIAR5;
-		static pixr_t<0x00087906> PIAR6;
-		static pixr_t<0x00087907> PIAR7;
-		static pixr_t<0x00087908> PIAR8;
-		static pixr_t<0x00087909> PIAR9;
-		static pixr_t<0x0008790A> PIARA;
-		static pixr_t<0x0008790B> PIARB;
+		static IO_SIM_INLINE pixr_t<0x00087900> PIAR0;
+		static IO_SIM_INLINE pixr_t<0x00087901> PIAR1;
+		static IO_SIM_INLINE pixr_t<0x00087902> PIAR2;
+		static IO_SIM_INLINE pixr_t<0x00087903> PIAR3;
+		static IO_SIM_INLINE pixr_t<0x00087904> PIAR4;
+		static IO_SIM_INLINE pixr_t<0x00087905> PIAR5;
+		static IO_SIM_INLINE pixr_t<0x00087906> PIAR6;
+		static IO_SIM_INLINE pixr_t<0x00087907> PIAR7;
+		static IO_SIM_INLINE pixr_t<0x00087908> PIAR8;
+		static IO_SIM_INLINE pixr_t<0x00087909> PIAR9;
+		static IO_SIM_INLINE pixr_t<0x0008790A> PIARA;
+		static IO_SIM_INLINE pixr_t<0x0008790B> PIARB;
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -1550,59 +1550,59 @@ namespace device {
 			@brief  選択型割り込み A 要因選択レジスタ n（SLIARn）（n = 208 ～ 255）
 		*/
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		static rw8_t<0x000879D0> SLIAR208;
-		static rw8_t<0x000879D1> SLIAR209;
-		static rw8_t<0x000879D2> SLIAR210;
-		static rw8_t<0x000879D3> SLIAR211;
-		static rw8_t<0x000879D4> SLIAR212;
-		static rw8_t<0x000879D5> SLIAR213;
-		static rw8_t<0x000879D6> SLIAR214;
-		static rw8_t<0x000879D7> SLIAR215;
-		static rw8_t<0x000879D8> SLIAR216;
-		static rw8_t<0x000879D9> SLIAR217;
-		static rw8_t<0x000879DA> SLIAR218;
-		static rw8_t<0x000879DB> SLIAR219;
-		static rw8_t<0x000879DC> SLIAR220;
-		static rw8_t<0x000879DD> SLIAR221;
-		static rw8_t<0x000879DE> SLIAR222;
-		static rw8_t<0x000879DF> SLIAR223;
-
-		static rw8_t<0x000879E0> SLIAR224;
-		static rw8_t<0x000879E1> SLIAR225;
-		static rw8_t<0x000879E2> SLIAR226;
-		static rw8_t<0x000879E3> SLIAR227;
-		static rw8_t<0x000879E4> SLIAR228;
-		static rw8_t<0x000879E5> SLIAR229;
-		static rw8_t<0x000879E6> SLIAR230;
-		static rw8_t<0x000879E7> SLIAR231;
-		static rw8_t<0x000879E8> SLIAR232;
-		static rw8_t<0x000879E9> SLIAR233;
-		static rw8_t<0x000879EA> SLIAR234;
-		static rw8_t<0x000879EB> SLIAR235;
-		static rw8_t<0x000879EC> SLIAR236;
-		static rw8_t<0x000879ED> SLIAR237;
-		static rw8_t<0x000879EE> SLIAR238;
-		static rw8_t<0x000879EF> SLIAR239;
-
-		static rw8_t<0x000879F0> SLIAR240;
-		static rw8_t<0x000879F1> SLIAR241;
-		static rw8_t<0x000879F2> SLIAR242;
-		static rw8_t<0x000879F3> SLIAR243;
-		static rw8_t<0x000879F4> SLIAR244;
-		static rw8_t<0x000879F5> SLIAR245;
-		static rw8_t<0x000879F6> SLIAR246;
-		static rw8_t<0x000879F7> SLIAR247;
-		static rw8_t<0x000879F8> SLIAR248;
-		static rw8_t<0x000879F9> SLIAR249;
-		static rw8_t<0x000879FA> SLIAR250;
-		static rw8_t<0x000879FB> SLIAR251;
-		static rw8_t<0x000879FC> SLIAR252;
-		static rw8_t<0x000879FD> SLIAR253;
-		static rw8_t<0x000879FE> SLIAR254;
-		static rw8_t<0x000879FF> SLIAR255;
-
-
-		static icu_utils::slixr_t<0x00087700> SLIXR;
+		static IO_SIM_INLINE rw8_t<0x000879D0> SLIAR208;
+		static IO_SIM_INLINE rw8_t<0x000879D1> SLIAR209;
+		static IO_SIM_INLINE rw8_t<0x000879D2> SLIAR210;
+		static IO_SIM_INLINE rw8_t<0x000879D3> SLIAR211;
+		static IO_SIM_INLINE rw8_t<0x000879D4> SLIAR212;
+		static IO_SIM_INLINE rw8_t<0x000879D5> SLIAR213;
+		static IO_SIM_INLINE rw8_t<0x000879D6> SLIAR214;
+		static IO_SIM_INLINE rw8_t<0x000879D7> SLIAR215;
+		static IO_SIM_INLINE rw8_t<0x000879D8> SLIAR216;
+		static IO_SIM_INLINE rw8_t<0x000879D9> SLIAR217;
+		static IO_SIM_INLINE rw8_t<0x000879DA> SLIAR218;
+		static IO_SIM_INLINE rw8_t<0x000879DB> SLIAR219;
+		static IO_SIM_INLINE rw8_t<0x000879DC> SLIAR220;
+		static IO_SIM_INLINE rw8_t<0x000879DD> SLIAR221;
+		static IO_SIM_INLINE rw8_t<0x000879DE> SLIAR222;
+		static IO_SIM_INLINE rw8_t<0x000879DF> SLIAR223;
+
+		static IO_SIM_INLINE rw8_t<0x000879E0> SLIAR224;
+		static IO_SIM_INLINE rw8_t<0x000879E1> SLIAR225;
+		static IO_SIM_INLINE rw8_t<0x000879E2> SLIAR226;
+		static IO_SIM_INLINE rw8_t<0x000879E3> SLIAR227;
+		static IO_SIM_INLINE rw8_t<0x000879E4> SLIAR228;
+		static IO_SIM_INLINE rw8_t<0x000879E5> SLIAR229;
+		static IO_SIM_INLINE rw8_t<0x000879E6> SLIAR230;
+		static IO_SIM_INLINE rw8_t<0x000879E7> SLIAR231;
+		static IO_SIM_INLINE rw8_t<0x000879E8> SLIAR232;
+		static IO_SIM_INLINE rw8_t<0x000879E9> SLIAR233;
+		static IO_SIM_INLINE rw8_t<0x000879EA> SLIAR234;
+		static IO_SIM_INLINE rw8_t<0x000879EB> SLIAR235;
+		static IO_SIM_INLINE rw8_t<0x000879EC> SLIAR236;
+		static IO_SIM_INLINE rw8_t<0x000879ED> SLIAR237;
+		static IO_SIM_INLINE rw8_t<0x000879EE> SLIAR238;
+		static IO_SIM_INLINE rw8_t<0x000879EF> SLIAR239;
+
+		static IO_SIM_INLINE rw8_t<0x000879F0> SLIAR240;
+		static IO_SIM_INLINE rw8_t<0x000879F1> SLIAR241;
+		static IO_SIM_INLINE rw8_t<0x000879F2> SLIAR242;
+		static IO_SIM_INLINE rw8_t<0x000879F3> SLIAR243;
+		static IO_SIM_INLINE rw8_t<0x000879F4> SLIAR244;
+		static IO_SIM_INLINE rw8_t<0x000879F5> SLIAR245;
+		static IO_SIM_INLINE rw8_t<0x000879F6> SLIAR246;
+		static IO_SIM_INLINE rw8_t<0x000879F7> SLIAR247;
+		static IO_SIM_INLINE rw8_t<0x000879F8> SLIAR248;
+		static IO_SIM_INLINE rw8_t<0x000879F9> SLIAR249;
+		static IO_SIM_INLINE rw8_t<0x000879FA> SLIAR250;
+		static IO_SIM_INLINE rw8_t<0x000879FB> SLIAR251;
+		static IO_SIM_INLINE rw8_t<0x000879FC> SLIAR252;
+		static IO_SIM_INLINE rw8_t<0x000879FD> SLIAR253;
+		static IO_SIM_INLINE rw8_t<0x000879FE> SLIAR254;
+		static IO_SIM_INLINE rw8_t<0x000879FF> SLIAR255;
+
+
+		static IO_SIM_INLINE icu_utils::slixr_t<0x00087700> SLIXR;
 	};
 	typedef icu_t ICU;
 }
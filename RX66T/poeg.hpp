@@ -57,10 +57,10 @@ namespace device {
 			bit_rw_t <io_, bitpos::B29>     NFEN;
 			bits_rw_t<io_, bitpos::B30, 2>  NFCS;
 		};
-		static poegg_t<base + 0x0000> POEGGA;
-		static poegg_t<base + 0x0100> POEGGB;
-		static poegg_t<base + 0x0200> POEGGC;
-		static poegg_t<base + 0x0300> POEGGD;
+		static IO_SIM_INLINE poegg_t<base + 0x0000> POEGGA;
+		static IO_SIM_INLINE poegg_t<base + 0x0100> POEGGB;
+		static IO_SIM_INLINE poegg_t<base + 0x0200> POEGGC;
+		static IO_SIM_INLINE poegg_t<base + 0x0300> POEGGD;
 
 
 		//-----------------------------------------------------------------//
@@ -81,10 +81,10 @@ namespace device {
 
 			bits_rw_t<io_, bitpos::B8, 8>   KEY;
 		};
-		static gtoncwpn_t<base + 0x0040> GTONCWPA;
-		static gtoncwpn_t<base + 0x0140> GTONCWPB;
-		static gtoncwpn_t<base + 0x0240> GTONCWPC;
-		static gtoncwpn_t<base + 0x0340> GTONCWPD;
+		static IO_SIM_INLINE gtoncwpn_t<base + 0x0040> GTONCWPA;
+		static IO_SIM_INLINE gtoncwpn_t<base + 0x0140> GTONCWPB;
+		static IO_SIM_INLINE gtoncwpn_t<base + 0x0240> GTONCWPC;
+		static IO_SIM_INLINE gtoncwpn_t<base + 0x0340> GTONCWPD;
 
 
 		//-----------------------------------------------------------------//
@@ -106,10 +106,10 @@ namespace device {
 			bits_rw_t<io_, bitpos::B4, 4>   NFS;
 			bit_rw_t <io_, bitpos::B8>      NFV;
 		};
-		static gtonccrn_t<base + 0x0044> GTONCCRA;
-		static gtonccrn_t<base + 0x0144> GTONCCRB;
-		static gtonccrn_t<base + 0x0244> GTONCCRC;
-		static gtonccrn_t<base + 0x0344> GTONCCRD;
+		static IO_SIM_INLINE gtonccrn_t<base + 0x0044> GTONCCRA;
+		static IO_SIM_INLINE gtonccrn_t<base + 0x0144> GTONCCRB;
+		static IO_SIM_INLINE gtonccrn_t<base + 0x0244> GTONCCRC;
+		static IO_SIM_INLINE gtonccrn_t<base + 0x0344> GTONCCRD;
 
 
 		//-----------------------------------------------------------------//
@@ -1,13 +1,24 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	RX グループ・CAN I/O 制御
+	@brief	RX グループ・CAN I/O 制御 @n
+			・メールボックスは FIFO モードで使う（MB24～27：送信 FIFO、@n
+			  MB28～31：受信 FIFO）@n
+			・受信 FIFO のアクセプタンス・フィルタ（FIDCR0/MKR6、@n
+			  FIDCR1/MKR7）で、必要な ID だけを受け取る。@n
+			・受信割り込みでは、受信 FIFO を空になるまで読み出し、@n
+			  受信バッファ（RBF）に移す。@n
+			・送信は、優先度別に二つの送信バッファ（SBF）に積み、@n
+			  送信 FIFO に空きが出来る度に、優先度の高い方から詰める。@n
+			・割り込みレベルが０の場合は、ポーリングで動作する。
     @author 平松邦仁 (hira@rvf-rc45.net)
-	@copyright	Copyright (C) 2019 Kunihito Hiramatsu @n
+	@copyright	Copyright (C) 2019, 2020 Kunihito Hiramatsu @n
 				Released under the MIT license @n
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
 //=====================================================================//
+#include <utility>
+#include <type_traits>
 #include "common/renesas.hpp"
 #include "common/vect.h"
 
@@ -17,31 +28,287 @@
 
 namespace device {
 
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  CAN フレーム
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct can_frame {
+		uint32_t	id_;		///< ID（標準：11 ビット、拡張：29 ビット）
+		uint8_t		len_;		///< データ長（０～８）
+		bool		ext_;		///< 拡張 ID の場合「true」
+		bool		rtr_;		///< リモート・フレームの場合「true」
+		uint8_t		data_[8];	///< データ
+		uint16_t	ts_;		///< タイムスタンプ（受信時）
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+			@param[in]	id		ID
+			@param[in]	len		データ長
+			@param[in]	ext		拡張 ID の場合「true」
+			@param[in]	rtr		リモート・フレームの場合「true」
+		*/
+		//-----------------------------------------------------------------//
+		can_frame(uint32_t id = 0, uint8_t len = 0, bool ext = false, bool rtr = false) noexcept :
+			id_(id), len_(len), ext_(ext), rtr_(rtr), data_{ 0 }, ts_(0) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  フレームのビット数（スタッフ・ビットを除き、フレーム間 @n
+					スペースを含む）
+			@return ビット数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_bits() const noexcept
+		{
+			return (ext_ ? 67 : 47) + (rtr_ ? 0 : (len_ * 8));
+		}
+	};
+
+
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
 		@brief  CAN 制御クラス
 		@param[in]	CAN		CAN 定義クラス
+		@param[in]	RBF		受信バッファ（can_frame の FIFO）
+		@param[in]	SBF		送信バッファ（can_frame の FIFO、優先度毎に二つ持つ）
 		@param[in]	PSEL	ポート候補
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class CAN, port_map::option PSEL = port_map::option::FIRST>
+	template <class CAN, class RBF, class SBF, port_map::option PSEL = port_map::option::FIRST>
 	class can_io {
 	public:
 
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  動作モード
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		enum class mode : uint8_t {
+			NORMAL,		///< 通常
+			LISTEN,		///< リッスン・オンリー
+			LOOP_EXT,	///< セルフテスト０（外部ループバック）
+			LOOP_INT,	///< セルフテスト１（内部ループバック）
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  送信優先度
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		enum class priority : uint8_t {
+			HIGH,		///< 高い（先に送信 FIFO に入れる）
+			NORMAL,		///< 通常
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  カウンター
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct counter_t {
+			uint32_t	send_;		///< 送信 FIFO に渡したフレーム数
+			uint32_t	recv_;		///< 受信バッファに移したフレーム数
+			uint32_t	recv_lost_;	///< 受信バッファが一杯で捨てたフレーム数
+			uint32_t	fifo_lost_;	///< 受信 FIFO のメッセージ・ロスト回数
+			uint32_t	bus_error_;	///< バス・エラー
+			uint32_t	warning_;	///< エラー・ワーニング
+			uint32_t	passive_;	///< エラー・パッシブ
+			uint32_t	bus_off_;	///< バス・オフ
+			uint32_t	recovery_;	///< バス・オフ復帰
+			uint32_t	overrun_;	///< 受信オーバーラン
+			uint32_t	overload_;	///< オーバーロード・フレーム
+			uint32_t	bus_lock_;	///< バス・ロック
+		};
+
 	private:
 
+		static const uint32_t TX_FIFO = 24;	///< 送信 FIFO の窓（MB24）
+		static const uint32_t RX_FIFO = 28;	///< 受信 FIFO の窓（MB28）
+
+		static RBF	recv_;
+		static SBF	send_[2];
+
+		static counter_t			counter_;
+		// 送信側（fill_）、受信側（drain_）で、別々に積算する（書き込みは各々一か所）
+		static volatile uint32_t	send_bits_;
+		static volatile uint32_t	recv_bits_;
+		static bool					loop_;
+
 		uint8_t		level_;
+		uint32_t	speed_;
+		uint32_t	send_last_;
+		uint32_t	recv_last_;
 
 		// 便宜上のスリープ
-		void sleep_() { asm("nop"); }
+		void sleep_() noexcept { asm("nop"); }
 
-		static void recv_task_() {
+		template <class T>
+		static auto test_(int) -> decltype(T::get_ers_vec(), std::true_type());
+
+		template <class T>
+		static std::false_type test_(...);
+
+		typedef decltype(test_<CAN>(0)) has_ers_t;
+
+		static uint32_t make_id_(uint32_t id, bool ext) noexcept
+		{
+			if(ext) return (id & 0x1FFFFFFF) | CAN::MB.IDE;
+			else return (id & 0x7FF) << 18;
 		}
 
-		static void send_task_() {
+		static void read_fifo_(can_frame& f) noexcept
+		{
+			auto id = CAN::MB.get_id(RX_FIFO);
+			f.ext_ = (id & CAN::MB.IDE) != 0;
+			f.rtr_ = (id & CAN::MB.RTR) != 0;
+			f.id_ = f.ext_ ? (id & 0x1FFFFFFF) : ((id >> 18) & 0x7FF);
+			f.len_ = CAN::MB.get_dlc(RX_FIFO);
+			if(f.len_ > 8) f.len_ = 8;
+			for(uint8_t i = 0; i < f.len_; ++i) {
+				f.data_[i] = CAN::MB.get_data(RX_FIFO, i);
+			}
+			f.ts_ = CAN::MB.get_ts(RX_FIFO);
+		}
+
+		static void write_fifo_(const can_frame& f) noexcept
+		{
+			uint32_t id = make_id_(f.id_, f.ext_);
+			if(f.rtr_) id |= CAN::MB.RTR;
+			CAN::MB.set_id(TX_FIFO, id);
+			uint8_t len = f.len_ > 8 ? 8 : f.len_;
+			CAN::MB.set_dlc(TX_FIFO, len);
+			for(uint8_t i = 0; i < len; ++i) {
+				CAN::MB.set_data(TX_FIFO, i, f.data_[i]);
+			}
+			CAN::TFPCR = 0xFF;
+		}
+
+		// 受信 FIFO を空になるまで、受信バッファに移す
+		static void drain_() noexcept
+		{
+			while(CAN::RFCR.RFEST() == 0) {
+				if(recv_.length() < (recv_.size() - 1)) {
+					auto& f = recv_.put_at();
+					read_fifo_(f);
+					// セルフテストでは、自分の送信を受信するので数えない
+					if(!loop_) recv_bits_ += f.get_bits();
+					recv_.put_go();
+					++counter_.recv_;
+				} else {
+					++counter_.recv_lost_;
+				}
+				CAN::RFPCR = 0xFF;
+			}
+			if(CAN::RFCR.RFMLF()) {
+				CAN::RFCR.RFMLF = 0;
+				++counter_.fifo_lost_;
+			}
+		}
+
+		// 送信 FIFO に空きがある限り、優先度の高い方から詰める
+		static void fill_() noexcept
+		{
+			while(CAN::TFCR.TFFST() == 0) {
+				SBF* q = nullptr;
+				if(send_[0].length() > 0) q = &send_[0];
+				else if(send_[1].length() > 0) q = &send_[1];
+				else break;
+				const auto& f = q->get_at();
+				write_fifo_(f);
+				send_bits_ += f.get_bits();
+				q->get_go();
+				++counter_.send_;
+			}
+		}
+
+		static INTERRUPT_FUNC void recv_task_() noexcept
+		{
+			drain_();
+		}
+
+		static INTERRUPT_FUNC void send_task_() noexcept
+		{
+			fill_();
+		}
+
+		// グループ割り込みから呼ばれる（割り込みアトリビュート無し）
+		static void err_task_() noexcept
+		{
+			uint8_t f = CAN::EIFR();
+			if(f == 0) return;
+			if(f & CAN::EIFR.BEIF.b())  ++counter_.bus_error_;
+			if(f & CAN::EIFR.EWIF.b())  ++counter_.warning_;
+			if(f & CAN::EIFR.EPIF.b())  ++counter_.passive_;
+			if(f & CAN::EIFR.BOEIF.b()) ++counter_.bus_off_;
+			if(f & CAN::EIFR.BORIF.b()) ++counter_.recovery_;
+			if(f & CAN::EIFR.ORIF.b())  ++counter_.overrun_;
+			if(f & CAN::EIFR.OLIF.b())  ++counter_.overload_;
+			if(f & CAN::EIFR.BLIF.b())  ++counter_.bus_lock_;
+			CAN::EIFR = static_cast<uint8_t>(~f);  // ０を書いたビットだけクリアされる
+			CAN::ECSR = 0x00;
 		}
 
-		static void err_task_() {
+		void set_ers_(std::true_type, bool ena) noexcept
+		{
+			if(ena) {
+				icu_mgr::set_level(ICU::VECTOR::GROUPBE0, level_);
+				icu_mgr::install_group_task(CAN::get_ers_vec(), err_task_);
+				// バス・エラーは頻発するので、割り込みにはしない（他の要因と一緒に数える）
+				CAN::EIER = CAN::EIER.EWIE.b() | CAN::EIER.EPIE.b() | CAN::EIER.BOEIE.b()
+					| CAN::EIER.BORIE.b() | CAN::EIER.ORIE.b() | CAN::EIER.OLIE.b()
+					| CAN::EIER.BLIE.b();
+			} else {
+				CAN::EIER = 0x00;
+				icu_mgr::install_group_task(CAN::get_ers_vec(), nullptr);
+			}
+		}
+
+		void set_ers_(std::false_type, bool ena) noexcept { }
+
+		bool has_ers_() const noexcept { return level_ > 0 && has_ers_t::value; }
+
+		// CANM: 0 (オペレーション), 1 (リセット), 2 (ホルト)
+		void change_mode_(uint8_t canm) noexcept
+		{
+			CAN::CTLR.CANM = canm;
+			switch(canm) {
+			case 0:
+				while(CAN::STR.RSTST() != 0 || CAN::STR.HLTST() != 0) sleep_();
+				break;
+			case 1:
+				while(CAN::STR.RSTST() == 0) sleep_();
+				break;
+			default:
+				while(CAN::STR.HLTST() == 0) sleep_();
+				break;
+			}
+		}
+
+		// サンプル点が 75% 付近になるように、ビット・タイミングを決める
+		static bool calc_bcr_(uint32_t speed, uint32_t& bcr) noexcept
+		{
+			if(speed == 0) return false;
+			for(uint32_t tq = 25; tq >= 8; --tq) {
+				if((F_PCLKB % (speed * tq)) != 0) continue;
+				uint32_t brp = F_PCLKB / (speed * tq);
+				if(brp == 0 || brp > 1024) continue;
+				uint32_t tseg1 = (tq * 3 + 2) / 4 - 1;
+				uint32_t tseg2 = tq - 1 - tseg1;
+				if(tseg1 > 16) {
+					tseg1 = 16;
+					tseg2 = tq - 1 - tseg1;
+				}
+				if(tseg2 < 2 || tseg2 > 8 || tseg1 < 4 || tseg1 <= tseg2) continue;
+				uint32_t sjw = tseg2 < 4 ? tseg2 : 4;
+				bcr = ((tseg1 - 1) << 28) | ((brp - 1) << 16) | ((sjw - 1) << 12) | ((tseg2 - 1) << 8);
+				return true;
+			}
+			return false;
 		}
 
 	public:
@@ -50,64 +317,330 @@ namespace device {
 			@brief  コンストラクター
 		*/
 		//-----------------------------------------------------------------//
-		can_io() noexcept : level_(0) { }
+		can_io() noexcept : level_(0), speed_(0), send_last_(0), recv_last_(0) { }
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  通信速度を設定して、CSI を有効にする
-			@param[in]	speed	通信速度
+			@brief  通信速度を設定して、CAN を有効にする @n
+					全ての標準、拡張データ・フレームを受け取る状態で始まる。
+			@param[in]	speed	通信速度（bps）
 			@param[in]	level	割り込みレベル、０の場合はポーリング
+			@param[in]	md		動作モード
 			@return エラー（速度設定範囲外）なら「false」
 		*/
 		//-----------------------------------------------------------------//
-		bool start(uint32_t speed, uint8_t level = 0) noexcept
+		bool start(uint32_t speed, uint8_t level = 0, mode md = mode::NORMAL) noexcept
 		{
+			uint32_t bcr;
+			if(!calc_bcr_(speed, bcr)) return false;
+
 			level_ = level;
+			speed_ = speed;
+			loop_ = md == mode::LOOP_EXT || md == mode::LOOP_INT;
 
 			power_mgr::turn(CAN::get_peripheral());
 			port_map::turn(CAN::get_peripheral(), true, PSEL);
 
+			// スリープ・モードから、リセット・モードへ
+			CAN::CTLR.SLPM = 0;
+			while(CAN::STR.SLPST() != 0) sleep_();
+			change_mode_(1);
+
+			CAN::BCR = bcr;
+			CAN::CTLR.MBM  = 1;  // FIFO メールボックス・モード
+			CAN::CTLR.IDFM = 2;  // 標準 ID、拡張 ID 混在
+			CAN::CTLR.MLM  = 1;  // オーバーラン・モード（古いメッセージを残す）
+			CAN::CTLR.TPM  = 0;  // ID 優先送信
+			CAN::CTLR.BOM  = 0;  // バス・オフ自動復帰
+			for(uint32_t i = 0; i < 32; ++i) {
+				CAN::MCTL.set(i, 0x00);
+			}
+
+			// アクセプタンス・フィルタ（FIDCR0：標準、FIDCR1：拡張、全て受け取る）
+			CAN::MKR6 = 0;
+			CAN::MKR7 = 0;
+			CAN::FIDCR0 = 0;
+			CAN::FIDCR1 = CAN::MB.IDE;
+			CAN::MKIVLR = 0;
+
+			// 送信完了毎、受信毎に割り込み
+			if(level_ > 0) {
+				CAN::MIER = (1 << TX_FIFO) | (1 << RX_FIFO);
+			} else {
+				CAN::MIER = 0;
+			}
+
+			change_mode_(2);
+			switch(md) {
+			case mode::LISTEN:
+				CAN::TCR = CAN::TCR.TSTE.b() | (1 << 1);
+				break;
+			case mode::LOOP_EXT:
+				CAN::TCR = CAN::TCR.TSTE.b() | (2 << 1);
+				break;
+			case mode::LOOP_INT:
+				CAN::TCR = CAN::TCR.TSTE.b() | (3 << 1);
+				break;
+			default:
+				CAN::TCR = 0x00;
+				break;
+			}
+			change_mode_(0);
+
+			CAN::EIFR = 0x00;
+			CAN::ECSR = 0x00;
+
+			recv_.clear();
+			send_[0].clear();
+			send_[1].clear();
+			reset_counter();
+
+			if(level_ > 0) {
+				icu_mgr::set_interrupt(CAN::get_rxf_vec(), recv_task_, level_);
+				icu_mgr::set_interrupt(CAN::get_txf_vec(), send_task_, level_);
+				set_ers_(has_ers_t(), true);
+			}
+
+			CAN::RFCR.RFE = 1;
+			CAN::TFCR.TFE = 1;
+
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信 FIFO のアクセプタンス・フィルタを設定 @n
+					受信フレームの ID と、マスクの「１」のビットが一致した @n
+					フレームだけを受け取る。（データ・フレームのみ）
+			@param[in]	idx		フィルタ番号（０、１）
+			@param[in]	id		ID
+			@param[in]	mask	マスク（０なら全て受け取る）
+			@param[in]	ext		拡張 ID の場合「true」
+			@return フィルタ番号が範囲外なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool set_filter(uint32_t idx, uint32_t id, uint32_t mask, bool ext = false) noexcept
+		{
+			if(idx > 1) return false;
 
+			CAN::RFCR.RFE = 0;
+			change_mode_(2);
+			if(idx == 0) {
+				CAN::FIDCR0 = make_id_(id, ext);
+				CAN::MKR6 = make_id_(mask, ext) & 0x1FFFFFFF;
+			} else {
+				CAN::FIDCR1 = make_id_(id, ext);
+				CAN::MKR7 = make_id_(mask, ext) & 0x1FFFFFFF;
+			}
+			change_mode_(0);
+			CAN::RFCR.RFE = 1;
+			return true;
+		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  フレームの送信（送信バッファに積む）
+			@param[in]	f	フレーム
+			@param[in]	pri	優先度
+			@return 送信バッファが一杯なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool send(const can_frame& f, priority pri = priority::NORMAL) noexcept
+		{
+			auto& q = send_[pri == priority::HIGH ? 0 : 1];
+			if(q.length() >= (q.size() - 1)) return false;
+			q.put(f);
 
+			if(level_ > 0) {
+				CAN::MIER.MB24 = 0;
+				fill_();
+				CAN::MIER.MB24 = 1;
+			} else {
+				fill_();
+			}
 			return true;
 		}
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  シリアル送信
-			@param[in]	src	送信ソース
-			@param[in]	cnt	送信サイズ
+			@brief  送信待ちのフレーム数を取得（送信 FIFO 内は含まない）
+			@return 送信待ちのフレーム数
 		*/
 		//-----------------------------------------------------------------//
-		void send(const void* src, uint32_t size) noexcept
+		uint32_t send_length() const noexcept
 		{
+			return send_[0].length() + send_[1].length();
 		}
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  シリアル受信
-			@param[out]	dst	受信先
-			@param[in]	cnt	受信サイズ
+			@brief  受信したフレーム数を取得
+			@return 受信したフレーム数
 		*/
 		//-----------------------------------------------------------------//
-		void recv(void* dst, uint32_t size) noexcept
+		uint32_t recv_length() noexcept
 		{
+			if(level_ == 0) {
+				drain_();
+				fill_();
+			}
+			return recv_.length();
 		}
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  RSPIを無効にして、パワーダウンする
+			@brief  フレームの受信
+			@param[out]	f	フレーム
+			@return 受信したフレームが無ければ「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool recv(can_frame& f) noexcept
+		{
+			if(recv_length() == 0) return false;
+			f = recv_.get();
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  フレームの受信（まとめて）
+			@param[out]	dst	フレームの格納先
+			@param[in]	num	最大フレーム数
+			@return 受信したフレーム数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t recv(can_frame* dst, uint32_t num) noexcept
+		{
+			uint32_t n = recv_length();
+			if(n > num) n = num;
+			for(uint32_t i = 0; i < n; ++i) {
+				dst[i] = recv_.get_at(i);
+			}
+			for(uint32_t i = 0; i < n; ++i) {
+				recv_.get_go();
+			}
+			return n;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  バス負荷の取得 @n
+					前回の呼び出しから送受信したビット数で計算する。 @n
+					割り込み側のカウンターは書き換えず、前回の値との差を取る。
+			@param[in]	ms	前回の呼び出しからの経過時間（ミリ秒）
+			@return バス負荷（0.1% 単位）
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_load(uint32_t ms) noexcept
+		{
+			uint32_t s = send_bits_;
+			uint32_t r = recv_bits_;
+			uint32_t bits = (s - send_last_) + (r - recv_last_);
+			send_last_ = s;
+			recv_last_ = r;
+			if(ms == 0 || speed_ == 0) return 0;
+			uint64_t cap = static_cast<uint64_t>(speed_) * ms;
+			return static_cast<uint32_t>(static_cast<uint64_t>(bits) * 1000000 / cap);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  カウンターの取得
+			@return カウンター
+		*/
+		//-----------------------------------------------------------------//
+		const counter_t& get_counter() noexcept
+		{
+			if(!has_ers_()) err_task_();
+			return counter_;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  カウンターのリセット
+		*/
+		//-----------------------------------------------------------------//
+		void reset_counter() noexcept
+		{
+			counter_ = counter_t{ 0 };
+			send_last_ = send_bits_;
+			recv_last_ = recv_bits_;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信エラー・カウンターの取得
+			@return 受信エラー・カウンター
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t get_recv_error() const noexcept { return CAN::RECR(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  送信エラー・カウンターの取得
+			@return 送信エラー・カウンター
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t get_send_error() const noexcept { return CAN::TECR(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  バス・オフか？
+			@return バス・オフなら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool is_bus_off() const noexcept { return CAN::STR.BOST(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  CAN を無効にして、パワーダウンする
 			@param[in]	power パワーダウンをしない場合「false」
 		*/
 		//-----------------------------------------------------------------//
 		void destroy(bool power = true) noexcept
 		{
+			if(level_ > 0) {
+				CAN::MIER = 0;
+				icu_mgr::set_interrupt(CAN::get_rxf_vec(), nullptr, 0);
+				icu_mgr::set_interrupt(CAN::get_txf_vec(), nullptr, 0);
+				set_ers_(has_ers_t(), false);
+			}
+			CAN::RFCR.RFE = 0;
+			CAN::TFCR.TFE = 0;
+			change_mode_(1);
+			CAN::CTLR.SLPM = 1;
+			level_ = 0;
+
+			port_map::turn(CAN::get_peripheral(), false, PSEL);
+			if(power) power_mgr::turn(CAN::get_peripheral(), false);
 		}
 	};
+
+	// テンプレート関数、実態の定義
+	template <class CAN, class RBF, class SBF, port_map::option PSEL>
+		RBF can_io<CAN, RBF, SBF, PSEL>::recv_;
+	template <class CAN, class RBF, class SBF, port_map::option PSEL>
+		SBF can_io<CAN, RBF, SBF, PSEL>::send_[2];
+	template <class CAN, class RBF, class SBF, port_map::option PSEL>
+		typename can_io<CAN, RBF, SBF, PSEL>::counter_t can_io<CAN, RBF, SBF, PSEL>::counter_;
+	template <class CAN, class RBF, class SBF, port_map::option PSEL>
+		volatile uint32_t can_io<CAN, RBF, SBF, PSEL>::send_bits_;
+	template <class CAN, class RBF, class SBF, port_map::option PSEL>
+		volatile uint32_t can_io<CAN, RBF, SBF, PSEL>::recv_bits_;
+	template <class CAN, class RBF, class SBF, port_map::option PSEL>
+		bool can_io<CAN, RBF, SBF, PSEL>::loop_;
 }
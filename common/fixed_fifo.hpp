@@ -9,17 +9,24 @@
 */
 //=====================================================================//
 #include <cstdint>
+#include <cstring>
+#include <atomic>
 
 namespace utils {
 
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
     /*!
-        @brief  固定サイズ FIFO クラス
+        @brief  固定サイズ FIFO クラス @n
+				格納可能数は、SIZE が２のべき乗なら SIZE（特殊化）、それ以外は @n
+				SIZE - 1（満杯と空を区別する為、一つ空ける）@n
+				※２のべき乗のサイズで「SIZE - 1」個を前提にしている場合は、@n
+				  capacity() を使う事
 		@param[in]	UNIT	基本形
 		@param[in]	SIZE	バッファサイズ（最低２）
+		@param[in]	POW2	SIZE が２のべき乗か（自動で選択される）
     */
     //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class UNIT, uint32_t SIZE>
+	template <class UNIT, uint32_t SIZE, bool POW2 = ((SIZE & (SIZE - 1)) == 0)>
 	class fixed_fifo {
 
 		volatile uint32_t	get_;
@@ -45,6 +52,15 @@ namespace utils {
 		inline uint32_t size() const noexcept { return SIZE; }
 
 
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納可能数を返す
+			@return	格納可能数（SIZE - 1）
+        */
+        //-----------------------------------------------------------------//
+		inline uint32_t capacity() const noexcept { return SIZE - 1; }
+
+
         //-----------------------------------------------------------------//
         /*!
             @brief  長さを返す
@@ -144,6 +160,134 @@ namespace utils {
 		}
 
 
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納可能な連続領域の先頭を返す @n
+					※DMA などで直接書き込む場合に使う
+			@return	格納領域の先頭
+        */
+        //-----------------------------------------------------------------//
+		inline UNIT* put_ptr() noexcept { return &buff_[put_]; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納可能な連続領域の長さを返す @n
+					※バッファの終端で折り返さない範囲
+			@return	連続領域の長さ
+        */
+        //-----------------------------------------------------------------//
+		uint32_t put_span() const noexcept {
+			uint32_t put = put_;
+			uint32_t get = get_;
+			if(put >= get) {
+				if(get == 0) return SIZE - put - 1;
+				else return SIZE - put;
+			} else {
+				return get - put - 1;
+			}
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納ポイントを複数進める
+			@param[in]	n	進める数（put_span() 以下であること）
+        */
+        //-----------------------------------------------------------------//
+		inline void put_go(uint32_t n) noexcept {
+			uint32_t put = put_ + n;
+			if(put >= SIZE) {
+				put -= SIZE;
+			}
+			put_ = put;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  取得可能な連続領域の先頭を返す @n
+					※DMA などで直接読み出す場合に使う
+			@return	取得領域の先頭
+        */
+        //-----------------------------------------------------------------//
+		inline const UNIT* get_ptr() const noexcept { return &buff_[get_]; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  取得可能な連続領域の長さを返す @n
+					※バッファの終端で折り返さない範囲
+			@return	連続領域の長さ
+        */
+        //-----------------------------------------------------------------//
+		uint32_t get_span() const noexcept {
+			uint32_t put = put_;
+			uint32_t get = get_;
+			if(put >= get) return put - get;
+			else return SIZE - get;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  取得ポイントを複数進める
+			@param[in]	n	進める数（get_span() 以下であること）
+        */
+        //-----------------------------------------------------------------//
+		inline void get_go(uint32_t n) noexcept {
+			uint32_t get = get_ + n;
+			if(get >= SIZE) {
+				get -= SIZE;
+			}
+			get_ = get;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  複数の値の格納
+			@param[in]	src	格納元
+			@param[in]	n	格納数
+			@return	格納できた数
+        */
+        //-----------------------------------------------------------------//
+		uint32_t put(const UNIT* src, uint32_t n) noexcept {
+			uint32_t total = 0;
+			while(total < n) {
+				auto len = put_span();
+				if(len == 0) break;
+				if(len > (n - total)) len = n - total;
+				std::memcpy(put_ptr(), &src[total], len * sizeof(UNIT));
+				put_go(len);
+				total += len;
+			}
+			return total;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  複数の値の取得
+			@param[out]	dst	取得先
+			@param[in]	n	取得数
+			@return	取得できた数
+        */
+        //-----------------------------------------------------------------//
+		uint32_t get(UNIT* dst, uint32_t n) noexcept {
+			uint32_t total = 0;
+			while(total < n) {
+				auto len = get_span();
+				if(len == 0) break;
+				if(len > (n - total)) len = n - total;
+				std::memcpy(&dst[total], get_ptr(), len * sizeof(UNIT));
+				get_go(len);
+				total += len;
+			}
+			return total;
+		}
+
+
         //-----------------------------------------------------------------//
         /*!
             @brief  get 位置を返す
@@ -161,4 +305,303 @@ namespace utils {
         //-----------------------------------------------------------------//
 		inline uint16_t pos_put() const noexcept { return put_; }
 	};
+
+
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+    /*!
+        @brief  固定サイズ FIFO クラス（SIZE が２のべき乗の特殊化） @n
+				・位置は、マスクで求め、剰余、比較を使わない。@n
+				・格納側、取得側が、それぞれ一つ（割り込みとメインループなど）の @n
+				  場合、ロック無しで使える。@n
+				・バッファ全体（SIZE 個）を格納に使える。
+		@param[in]	UNIT	基本形
+		@param[in]	SIZE	バッファサイズ（２のべき乗）
+    */
+    //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class UNIT, uint32_t SIZE>
+	class fixed_fifo<UNIT, SIZE, true> {
+
+		static_assert(SIZE >= 2, "SIZE must be 2 or more.");
+
+		static const uint32_t MASK = SIZE - 1;
+
+		// 位置は、マスクせずに進め、参照時にマスクする
+		volatile uint32_t	get_;
+		volatile uint32_t	put_;
+
+		UNIT	buff_[SIZE];
+
+		// 取得側：put_ を読んでから、データを読む
+		inline uint32_t load_put_() const noexcept {
+			uint32_t put = put_;
+			std::atomic_signal_fence(std::memory_order_acquire);
+			return put;
+		}
+
+		// 格納側：get_ を読んでから、データを書き込む
+		inline uint32_t load_get_() const noexcept {
+			uint32_t get = get_;
+			std::atomic_signal_fence(std::memory_order_acquire);
+			return get;
+		}
+
+	public:
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  コンストラクター
+        */
+        //-----------------------------------------------------------------//
+		fixed_fifo() noexcept : get_(0), put_(0) { }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  バッファのサイズを返す
+			@return	バッファのサイズ
+        */
+        //-----------------------------------------------------------------//
+		inline uint32_t size() const noexcept { return SIZE; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納可能数を返す
+			@return	格納可能数（SIZE）
+        */
+        //-----------------------------------------------------------------//
+		inline uint32_t capacity() const noexcept { return SIZE; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  長さを返す
+			@return	長さ
+        */
+        //-----------------------------------------------------------------//
+		inline uint32_t length() const noexcept { return put_ - get_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  クリア
+        */
+        //-----------------------------------------------------------------//
+		inline void clear() noexcept { get_ = put_ = 0; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  値の格納参照を得る
+			@param[in]	ofs	オフセット（格納領域を超えたオフセットは未定義）
+			@return 値の格納参照
+        */
+        //-----------------------------------------------------------------//
+		inline UNIT& put_at(uint32_t ofs = 0) noexcept {
+			return buff_[(put_ + ofs) & MASK];
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  値の格納ポイントの移動
+        */
+        //-----------------------------------------------------------------//
+		inline void put_go() noexcept {
+			std::atomic_signal_fence(std::memory_order_release);
+			put_ = put_ + 1;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  値の格納
+			@param[in]	v	値
+        */
+        //-----------------------------------------------------------------//
+		void put(const UNIT& v) noexcept {
+			buff_[put_ & MASK] = v;
+			put_go();
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  値の取得参照を得る
+			@param[in]	ofs	オフセット（格納領域を超えたオフセットは未定義）
+			@return	値の取得参照
+        */
+        //-----------------------------------------------------------------//
+		inline const UNIT& get_at(uint32_t ofs = 0) const noexcept {
+			return buff_[(get_ + ofs) & MASK];
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  値の取得
+        */
+        //-----------------------------------------------------------------//
+		inline void get_go() noexcept {
+			std::atomic_signal_fence(std::memory_order_release);
+			get_ = get_ + 1;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  値の取得
+			@return	値
+        */
+        //-----------------------------------------------------------------//
+		UNIT get() noexcept {
+			load_put_();
+			UNIT v = buff_[get_ & MASK];
+			get_go();
+			return v;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納可能な連続領域の先頭を返す @n
+					※DMA などで直接書き込む場合に使う
+			@return	格納領域の先頭
+        */
+        //-----------------------------------------------------------------//
+		inline UNIT* put_ptr() noexcept { return &buff_[put_ & MASK]; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納可能な連続領域の長さを返す @n
+					※バッファの終端で折り返さない範囲
+			@return	連続領域の長さ
+        */
+        //-----------------------------------------------------------------//
+		uint32_t put_span() const noexcept {
+			uint32_t put = put_;
+			uint32_t free = SIZE - (put - load_get_());
+			uint32_t tail = SIZE - (put & MASK);
+			return free < tail ? free : tail;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納ポイントを複数進める
+			@param[in]	n	進める数（put_span() 以下であること）
+        */
+        //-----------------------------------------------------------------//
+		inline void put_go(uint32_t n) noexcept {
+			std::atomic_signal_fence(std::memory_order_release);
+			put_ = put_ + n;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  取得可能な連続領域の先頭を返す @n
+					※DMA などで直接読み出す場合に使う
+			@return	取得領域の先頭
+        */
+        //-----------------------------------------------------------------//
+		inline const UNIT* get_ptr() const noexcept { return &buff_[get_ & MASK]; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  取得可能な連続領域の長さを返す @n
+					※バッファの終端で折り返さない範囲
+			@return	連続領域の長さ
+        */
+        //-----------------------------------------------------------------//
+		uint32_t get_span() const noexcept {
+			uint32_t get = get_;
+			uint32_t len = load_put_() - get;
+			uint32_t tail = SIZE - (get & MASK);
+			return len < tail ? len : tail;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  取得ポイントを複数進める
+			@param[in]	n	進める数（get_span() 以下であること）
+        */
+        //-----------------------------------------------------------------//
+		inline void get_go(uint32_t n) noexcept {
+			std::atomic_signal_fence(std::memory_order_release);
+			get_ = get_ + n;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  複数の値の格納 @n
+					※コピーは、最大２回（折り返しの前後）
+			@param[in]	src	格納元
+			@param[in]	n	格納数
+			@return	格納できた数
+        */
+        //-----------------------------------------------------------------//
+		uint32_t put(const UNIT* src, uint32_t n) noexcept {
+			uint32_t put = put_;
+			uint32_t free = SIZE - (put - load_get_());
+			if(n > free) n = free;
+			if(n == 0) return 0;
+			uint32_t pos = put & MASK;
+			uint32_t first = SIZE - pos;
+			if(first > n) first = n;
+			std::memcpy(&buff_[pos], src, first * sizeof(UNIT));
+			if(n > first) {
+				std::memcpy(&buff_[0], &src[first], (n - first) * sizeof(UNIT));
+			}
+			put_go(n);
+			return n;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  複数の値の取得 @n
+					※コピーは、最大２回（折り返しの前後）
+			@param[out]	dst	取得先
+			@param[in]	n	取得数
+			@return	取得できた数
+        */
+        //-----------------------------------------------------------------//
+		uint32_t get(UNIT* dst, uint32_t n) noexcept {
+			uint32_t get = get_;
+			uint32_t len = load_put_() - get;
+			if(n > len) n = len;
+			if(n == 0) return 0;
+			uint32_t pos = get & MASK;
+			uint32_t first = SIZE - pos;
+			if(first > n) first = n;
+			std::memcpy(dst, &buff_[pos], first * sizeof(UNIT));
+			if(n > first) {
+				std::memcpy(&dst[first], &buff_[0], (n - first) * sizeof(UNIT));
+			}
+			get_go(n);
+			return n;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  get 位置を返す
+			@return	位置
+        */
+        //-----------------------------------------------------------------//
+		inline uint16_t pos_get() const noexcept { return get_ & MASK; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  put 位置を返す
+			@return	位置
+        */
+        //-----------------------------------------------------------------//
+		inline uint16_t pos_put() const noexcept { return put_ & MASK; }
+	};
 }
@@ -1,83 +1,482 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	Flash memory マネージャー
+	@brief	Flash memory マネージャー（ログ構造のキー／バリュー・ストア） @n
+			データ・フラッシュを、SEG バイト毎のセグメントに分け、@n
+			レコードを追記して行く。@n
+			・セグメント：+0: MAGIC(2) +2: CRC(2) +4: SEQ(4)、以降レコード @n
+			・レコード：+0: ID(2) +2: LEN(2) +4: DATA(LEN、４バイト境界まで) @n
+			  最後に、コミット・ワード（CRC(2)、~CRC(2)）を書く。@n
+			・コミット・ワードが無い、又は CRC が合わないレコードは無視する @n
+			  （書き込み中の電源断）@n
+			・起動時（start）に一度だけ全体を走査し、ID からレコード位置 @n
+			  へのインデックス（RAM）を作る。@n
+			・空きセグメントが予備の一つになったら、有効なレコードが一番 @n
+			  少ないセグメントを選び、有効なレコードを移して消去する。@n
+			  長く書き換えの無いセグメントは、優先して移す。@n
+			  （セグメントは循環して使うので、消去回数は平均化される）@n
+			※フラッシュのブランク状態は、読み出し値では無く「erase_check」@n
+			  で判断する。
     @author 平松邦仁 (hira@rvf-rc45.net)
-	@copyright	Copyright (C) 2017 Kunihito Hiramatsu @n
+	@copyright	Copyright (C) 2017, 2020 Kunihito Hiramatsu @n
 				Released under the MIT license @n
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
 //=====================================================================//
-#include "common/renesas.hpp"
+#include <cstdint>
 
 namespace utils {
 
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
-		@brief  flash_man class @n
-				データ列の構造：@n
-				+0: ID (2 bytes) @n
-				+2: TM (2 bytes) タイムスタンプ（数値が一番大きいものが最新）@n
-				+4: SZ (2 bytes) サイズ
+		@brief  flash_man class
 		@param[in]	FIO		フラッシュ I/O
-		@param[in]	OMAX	オープン最大
+		@param[in]	IMAX	ID の最大数（２のべき乗）
+		@param[in]	SEG		セグメントのバイト数（ブロック・サイズの倍数）
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class FIO, uint32_t OMAX = 4>
+	template <class FIO, uint32_t IMAX = 64, uint32_t SEG = 1024>
 	class flash_man {
 
+		static_assert((IMAX & (IMAX - 1)) == 0, "IMAX must be a power of two");
+		static_assert((SEG % FIO::data_flash_block) == 0, "SEG must be a multiple of the block size");
+		static_assert((FIO::data_flash_size % SEG) == 0, "SEG must divide the flash size");
+
+		static const uint32_t SEG_NUM   = FIO::data_flash_size / SEG;
+		static const uint16_t MAGIC     = 0x4D46;	///< 'F', 'M'
+		static const uint32_t SEG_HEAD  = 8;
+		static const uint16_t DELETE    = 0x8000;	///< LEN の削除ビット
+		static const uint16_t POS_EMPTY = 0xFFFF;	///< 未使用のインデックス
+		static const uint16_t POS_NONE  = 0xFFFE;	///< 削除済みの ID
+
+		static_assert(SEG_NUM >= 3, "three or more segments are required");
+		static_assert((FIO::data_flash_size / 4) < POS_NONE, "flash is too large");
+
+	public:
+		static const uint32_t DATA_MAX = (SEG - SEG_HEAD - 8) < DELETE ?
+			(SEG - SEG_HEAD - 8) : (DELETE - 4);	///< レコードの最大バイト数（LEN の削除ビット未満）
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  カウンター
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct counter_t {
+			uint32_t	write_;		///< レコードの書き込み回数
+			uint32_t	gc_;		///< ガベージ・コレクション回数
+			uint32_t	move_;		///< ガベージ・コレクションで移したレコード数
+			uint32_t	erase_;		///< ブロックの消去回数
+		};
+
+	private:
+
 		FIO&	fio_;
 
-		// 制限：　１ファイル、最大３２Ｋバイトまで
-		struct head_t {
-			uint16_t	id;		///< file ID
-			uint16_t	nx_sz;	///< (B15:1)next block, (B15:0)total size
+		struct index_t {
+			uint16_t	id_;
+			uint16_t	pos_;	///< レコード位置（ワード単位）
 		};
+		index_t		index_[IMAX];
+
+		uint32_t	seq_[SEG_NUM];	///< セグメントのシーケンス番号（０は空き）
+		uint32_t	live_[SEG_NUM];	///< セグメント内の有効なレコードのバイト数
+		uint32_t	seq_max_;
+		uint32_t	head_;			///< 追記中のセグメント（SEG_NUM なら無し）
+		uint32_t	wpos_;			///< 追記位置
+		counter_t	counter_;
+
+		static uint16_t crc16_(uint16_t crc, const void* src, uint32_t len) noexcept
+		{
+			static const uint16_t tbl[16] = {
+				0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+				0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+			};
+			const uint8_t* p = static_cast<const uint8_t*>(src);
+			while(len > 0) {
+				crc = (crc << 4) ^ tbl[(crc >> 12) ^ (*p >> 4)];
+				crc = (crc << 4) ^ tbl[(crc >> 12) ^ (*p & 15)];
+				++p;
+				--len;
+			}
+			return crc;
+		}
+
+		static uint32_t align_(uint32_t len) noexcept { return (len + 3) & ~3; }
+
+		static uint32_t rec_size_(uint16_t len) noexcept { return 4 + align_(len & ~DELETE) + 4; }
+
+		static uint32_t seg_org_(uint32_t seg) noexcept { return seg * SEG; }
+
+		static uint32_t seg_end_(uint32_t seg) noexcept { return seg * SEG + SEG; }
 
+		static uint32_t seg_of_(uint16_t pos) noexcept { return (static_cast<uint32_t>(pos) * 4) / SEG; }
 
-		uint32_t free_()
+		static uint32_t hash_(uint16_t id) noexcept
 		{
-			uint32_t pos = 0;
-			while(pos < FIO::data_flash_size) {
-				if(fio_.erase_check(pos)) {
-					return pos;
+			return ((static_cast<uint32_t>(id) * 0x9E3779B1) >> 16) & (IMAX - 1);
+		}
+
+		index_t* find_(uint16_t id) noexcept
+		{
+			auto h = hash_(id);
+			for(uint32_t i = 0; i < IMAX; ++i) {
+				auto& t = index_[(h + i) & (IMAX - 1)];
+				if(t.pos_ == POS_EMPTY) return nullptr;
+				if(t.id_ == id) return &t;
+			}
+			return nullptr;
+		}
+
+		const index_t* find_(uint16_t id) const noexcept
+		{
+			return const_cast<flash_man*>(this)->find_(id);
+		}
+
+		index_t* insert_(uint16_t id) noexcept
+		{
+			auto h = hash_(id);
+			for(uint32_t i = 0; i < IMAX; ++i) {
+				auto& t = index_[(h + i) & (IMAX - 1)];
+				if(t.pos_ == POS_EMPTY) {
+					t.id_ = id;
+					t.pos_ = POS_NONE;
+					return &t;
 				}
-				pos += FIO::data_flash_block;
+				if(t.id_ == id) return &t;
 			}
-			return FIO::data_flash_size;
+			return nullptr;
 		}
 
+		// レコードの CRC を計算（ヘッダーとデータ）
+		uint16_t rec_crc_(uint32_t pos, uint32_t len) noexcept
+		{
+			uint8_t tmp[32];
+			uint16_t crc = 0xFFFF;
+			uint32_t n = 4 + len;
+			while(n > 0) {
+				uint32_t l = n > sizeof(tmp) ? sizeof(tmp) : n;
+				fio_.read(pos, tmp, l);
+				crc = crc16_(crc, tmp, l);
+				pos += l;
+				n -= l;
+			}
+			return crc;
+		}
+
+		// インデックスが指しているレコードを、無効にする
+		void drop_(index_t* t) noexcept
+		{
+			if(t->pos_ >= POS_NONE) return;
+			uint8_t h[4];
+			fio_.read(t->pos_ * 4, h, 4);
+			live_[seg_of_(t->pos_)] -= rec_size_(h[2] | (h[3] << 8));
+			t->pos_ = POS_NONE;
+		}
+
+		// セグメントのヘッダーを検査して、シーケンス番号を返す（０なら空き、又は壊れている）
+		uint32_t read_seg_(uint32_t seg) noexcept
+		{
+			auto org = seg_org_(seg);
+			if(fio_.erase_check(org, SEG_HEAD)) return 0;
+			uint8_t h[SEG_HEAD];
+			fio_.read(org, h, SEG_HEAD);
+			uint16_t magic = h[0] | (h[1] << 8);
+			uint16_t crc = h[2] | (h[3] << 8);
+			if(magic != MAGIC || crc != crc16_(0xFFFF, &h[4], 4)) return 0;
+			return static_cast<uint32_t>(h[4]) | (static_cast<uint32_t>(h[5]) << 8)
+				| (static_cast<uint32_t>(h[6]) << 16) | (static_cast<uint32_t>(h[7]) << 24);
+		}
 
-		uint32_t scan_(uint16_t id) const
+		// セグメント内のレコードを順番に調べる（戻り値は、追記位置）
+		template <class FUNC>
+		uint32_t scan_(uint32_t seg, FUNC func) noexcept
 		{
-			uint32_t pos = 0;
-			uint32_t match = FIO::data_flash_size;
-			while(pos < FIO::data_flash_size) {
-				uint32_t d = FIO::data_flash_block;
-				if(!fio_.erase_check(pos)) {
-					head_t h;
-					fio_.read(pos, &h, sizeof(head_t));
-					if(h.id == id) {
-						match = pos;
-						uint16_t s = h.size;
-						d = s / (FIO::data_flash_block - sizeof(head_t));
-						if(d == 0) ++d;
-						d *= FIO::data_flash_block;
+			uint32_t pos = seg_org_(seg) + SEG_HEAD;
+			uint32_t end = seg_end_(seg);
+			while((pos + 8) <= end) {
+				if(fio_.erase_check(pos, 4)) return pos;
+
+				uint8_t h[4];
+				fio_.read(pos, h, 4);
+				uint16_t id  = h[0] | (h[1] << 8);
+				uint16_t len = h[2] | (h[3] << 8);
+				uint32_t rs = rec_size_(len);
+				if((len & ~DELETE) > DATA_MAX || (pos + rs) > end) return end;  // 壊れたヘッダー
+
+				uint32_t cpos = pos + rs - 4;
+				if(!fio_.erase_check(cpos, 4)) {
+					uint8_t c[4];
+					fio_.read(cpos, c, 4);
+					uint16_t crc = c[0] | (c[1] << 8);
+					uint16_t inv = c[2] | (c[3] << 8);
+					if(crc == static_cast<uint16_t>(~inv) && crc == rec_crc_(pos, len & ~DELETE)) {
+						func(id, len, pos);
 					}
 				}
-				pos += d;
+				pos += rs;
+			}
+			return end;
+		}
+
+		bool erase_seg_(uint32_t seg) noexcept
+		{
+			for(uint32_t org = seg_org_(seg); org < seg_end_(seg); org += FIO::data_flash_block) {
+				if(!fio_.erase_check(org)) {
+					if(!fio_.erase(org)) return false;
+					++counter_.erase_;
+				}
 			}
-			return match;
+			seq_[seg] = 0;
+			live_[seg] = 0;
+			return true;
 		}
 
+		uint32_t free_num_() const noexcept
+		{
+			uint32_t n = 0;
+			for(uint32_t i = 0; i < SEG_NUM; ++i) {
+				if(seq_[i] == 0) ++n;
+			}
+			return n;
+		}
+
+		// 次の空きセグメントを、消去してから開く（循環して選ぶ）
+		bool open_() noexcept
+		{
+			uint32_t seg = head_ < SEG_NUM ? head_ : (SEG_NUM - 1);
+			for(uint32_t i = 0; i < SEG_NUM; ++i) {
+				seg = (seg + 1) % SEG_NUM;
+				if(seq_[seg] != 0) continue;
+
+				if(!erase_seg_(seg)) continue;
+				uint32_t seq = seq_max_ + 1;
+				uint8_t h[SEG_HEAD];
+				h[4] = seq;
+				h[5] = seq >> 8;
+				h[6] = seq >> 16;
+				h[7] = seq >> 24;
+				uint16_t crc = crc16_(0xFFFF, &h[4], 4);
+				h[0] = MAGIC & 0xFF;
+				h[1] = MAGIC >> 8;
+				h[2] = crc & 0xFF;
+				h[3] = crc >> 8;
+				if(!fio_.write(seg_org_(seg), h, SEG_HEAD)) continue;
+
+				seq_[seg] = seq;
+				seq_max_ = seq;
+				head_ = seg;
+				wpos_ = seg_org_(seg) + SEG_HEAD;
+				return true;
+			}
+			return false;
+		}
+
+		// レコードを、そのまま追記位置に写す
+		bool copy_(uint32_t dst, uint32_t src, uint32_t len) noexcept
+		{
+			uint8_t tmp[32];
+			while(len > 0) {
+				uint32_t l = len > sizeof(tmp) ? sizeof(tmp) : len;
+				fio_.read(src, tmp, l);
+				if(!fio_.write(dst, tmp, l)) return false;
+				src += l;
+				dst += l;
+				len -= l;
+			}
+			return true;
+		}
+
+		// 有効なレコードを移して、セグメントを消去する
+		bool gc_() noexcept
+		{
+			uint32_t oldest = SEG_NUM;
+			for(uint32_t i = 0; i < SEG_NUM; ++i) {
+				if(seq_[i] == 0 || i == head_) continue;
+				if(oldest == SEG_NUM || seq_[i] < seq_[oldest]) oldest = i;
+			}
+			if(oldest == SEG_NUM) return false;
+
+			// 空きセグメントが無い場合、今のセグメントに収まる物だけ
+			uint32_t space = head_ < SEG_NUM ? (seg_end_(head_) - wpos_) : 0;
+			bool any = free_num_() > 0;
+			uint32_t victim = SEG_NUM;
+			if((seq_max_ - seq_[oldest]) >= (SEG_NUM * 2) && (any || live_[oldest] <= space)) {
+				victim = oldest;  // 書き換えの無いデータも、循環させる
+			} else {
+				for(uint32_t i = 0; i < SEG_NUM; ++i) {
+					if(seq_[i] == 0 || i == head_) continue;
+					if(!any && live_[i] > space) continue;
+					if(victim == SEG_NUM || live_[i] < live_[victim]
+						|| (live_[i] == live_[victim] && seq_[i] < seq_[victim])) victim = i;
+				}
+				if(victim == SEG_NUM) return false;
+			}
+
+			bool ok = true;
+			scan_(victim, [&](uint16_t id, uint16_t len, uint32_t pos) {
+				if(!ok) return;
+				auto t = find_(id);
+				if(t == nullptr || t->pos_ != (pos / 4)) return;  // 古いレコード
+				if((len & DELETE) && victim == oldest) {  // これより古いレコードは無いので、捨てる
+					t->pos_ = POS_NONE;
+					live_[victim] -= rec_size_(len);
+					return;
+				}
+				uint32_t rs = rec_size_(len);
+				if((wpos_ + rs) > seg_end_(head_)) {
+					if(!open_()) {
+						ok = false;
+						return;
+					}
+				}
+				uint32_t dst = wpos_;
+				wpos_ += rs;
+				if(!copy_(dst, pos, rs)) {
+					ok = false;
+					return;
+				}
+				t->pos_ = dst / 4;
+				live_[victim] -= rs;
+				live_[head_] += rs;
+				++counter_.move_;
+			});
+			if(!ok) return false;
+
+			++counter_.gc_;
+			return erase_seg_(victim);
+		}
+
+		// rs バイトの追記領域を用意する（空きセグメントを、一つ予備に残す）
+		bool reserve_(uint32_t rs) noexcept
+		{
+			for(uint32_t i = 0; i <= SEG_NUM; ++i) {
+				if(head_ < SEG_NUM && (wpos_ + rs) <= seg_end_(head_)) return true;
+				if(free_num_() >= 2) return open_();
+				if(!gc_()) return false;
+			}
+			return false;
+		}
+
+		bool append_(uint16_t id, uint16_t len, const void* src) noexcept
+		{
+			uint32_t size = len & ~DELETE;
+			uint32_t rs = rec_size_(len);
+			if(!reserve_(rs)) return false;
+
+			auto t = insert_(id);
+			if(t == nullptr) return false;
+
+			uint32_t pos = wpos_;
+			// 途中で失敗しても、この領域は再利用しない
+			wpos_ += rs;
+
+			uint8_t h[4];
+			h[0] = id & 0xFF;
+			h[1] = id >> 8;
+			h[2] = len & 0xFF;
+			h[3] = len >> 8;
+			uint16_t crc = crc16_(crc16_(0xFFFF, h, 4), src, size);
+			if(!fio_.write(pos, h, 4)) return false;
+
+			const uint8_t* p = static_cast<const uint8_t*>(src);
+			uint32_t body = size & ~3;
+			if(body > 0 && !fio_.write(pos + 4, p, body)) return false;
+			if(size & 3) {
+				uint8_t tmp[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+				for(uint32_t i = 0; i < (size & 3); ++i) {
+					tmp[i] = p[body + i];
+				}
+				if(!fio_.write(pos + 4 + body, tmp, 4)) return false;
+			}
+
+			// コミット
+			uint8_t c[4];
+			c[0] = crc & 0xFF;
+			c[1] = crc >> 8;
+			c[2] = ~crc & 0xFF;
+			c[3] = (~crc >> 8) & 0xFF;
+			if(!fio_.write(pos + rs - 4, c, 4)) return false;
+
+			drop_(t);
+			t->pos_ = pos / 4;
+			live_[head_] += rs;
+			++counter_.write_;
+			return true;
+		}
 
 	public:
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  コンストラクタ
+			@param[in]	fio		フラッシュ I/O
+		*/
+		//-----------------------------------------------------------------//
+		flash_man(FIO& fio) noexcept : fio_(fio), index_{ }, seq_{ 0 }, live_{ 0 }, seq_max_(0),
+			head_(SEG_NUM), wpos_(0), counter_{ 0 } { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  開始（フラッシュを走査して、インデックスを作る）@n
+					※FIO の start 後に、一度だけ呼ぶ
 		*/
 		//-----------------------------------------------------------------//
-		flash_man(FIO& fio) : fio_(fio) { }
+		void start() noexcept
+		{
+			for(uint32_t i = 0; i < IMAX; ++i) {
+				index_[i].id_ = 0;
+				index_[i].pos_ = POS_EMPTY;
+			}
+			seq_max_ = 0;
+			head_ = SEG_NUM;
+			wpos_ = 0;
+
+			uint32_t order[SEG_NUM];
+			uint32_t num = 0;
+			for(uint32_t i = 0; i < SEG_NUM; ++i) {
+				seq_[i] = read_seg_(i);
+				live_[i] = 0;
+				if(seq_[i] == 0) continue;
+				// シーケンス番号の順に並べる
+				uint32_t j = num;
+				while(j > 0 && seq_[order[j - 1]] > seq_[i]) {
+					order[j] = order[j - 1];
+					--j;
+				}
+				order[j] = i;
+				++num;
+			}
+
+			for(uint32_t i = 0; i < num; ++i) {
+				auto seg = order[i];
+				auto end = scan_(seg, [this](uint16_t id, uint16_t len, uint32_t pos) {
+					auto t = insert_(id);
+					if(t == nullptr) return;
+					drop_(t);
+					t->pos_ = pos / 4;
+					live_[seg_of_(t->pos_)] += rec_size_(len);
+				});
+				head_ = seg;
+				wpos_ = end;
+				seq_max_ = seq_[seg];
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  全て消去して、初期化
+			@return エラーなら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool format() noexcept
+		{
+			for(uint32_t i = 0; i < SEG_NUM; ++i) {
+				if(!erase_seg_(i)) return false;
+			}
+			start();
+			return true;
+		}
 
 
 		//-----------------------------------------------------------------//
@@ -86,22 +485,22 @@ namespace utils {
 			@return FIO
 		*/
 		//-----------------------------------------------------------------//
-		FIO& at_fio() { return fio_; }
+		FIO& at_fio() noexcept { return fio_; }
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  フリー領域の取得
-			@return フリー領域の取得
+			@brief  フリー領域の取得（ガベージ・コレクションで回収出来る @n
+					領域は含まない）
+			@return フリー領域のバイト数
 		*/
 		//-----------------------------------------------------------------//
-		uint32_t get_free() const {
+		uint32_t get_free() const noexcept
+		{
 			uint32_t space = 0;
-			for(uint32_t i = 0; i < FIO::data_flash_bank; ++i) {
-				if(fio_.erase_check(i)) {
-					space += FIO::data_flash_block - sizeof(head_t);
-				}
-			}
+			uint32_t n = free_num_();
+			if(n > 1) space += (n - 1) * (SEG - SEG_HEAD);
+			if(head_ < SEG_NUM) space += seg_end_(head_) - wpos_;
 			return space;
 		}
 
@@ -113,40 +512,44 @@ namespace utils {
 			@return ある場合「true」
 		*/
 		//-----------------------------------------------------------------//
-		bool probe(uint16_t id) const
+		bool probe(uint16_t id) const noexcept
 		{
-			return scan_(id) < FIO::data_flash_size;
+			return get_size(id) >= 0;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  サイズの取得
+			@param[in]	id	ファイルＩＤ
+			@return サイズ（無い場合「-1」）
+		*/
+		//-----------------------------------------------------------------//
+		int32_t get_size(uint16_t id) const noexcept
+		{
+			auto t = find_(id);
+			if(t == nullptr || t->pos_ == POS_NONE) return -1;
+			uint8_t h[4];
+			fio_.read(t->pos_ * 4, h, 4);
+			uint16_t len = h[2] | (h[3] << 8);
+			if(len & DELETE) return -1;
+			return len;
 		}
 
 
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  書き込み
-			@param[in]	id		ＩＤ
+			@param[in]	id		ＩＤ（0xFFFF は不可）
 			@param[in]	src		ソース
-			@param[in]	size	サイズ（バイト）
+			@param[in]	size	サイズ（バイト、DATA_MAX まで）
 			@return エラーなら「false」
 		*/
 		//-----------------------------------------------------------------//
-		bool write(uint16_t id, const void* src, uint32_t size)
+		bool write(uint16_t id, const void* src, uint32_t size) noexcept
 		{
-			uint32_t pos = free_();
-			if(pos >= FIO::data_flash_size) {
-				return false;
-			}
-			uint32_t fsb = (FIO::data_flash_size - pos) / FIO::data_flash_block;
-			uint32_t fs  = fsb * (FIO::data_flash_block - sizeof(head_t));
-			if(fs < size) {
-				return false;
-			}
-
-			head_t t;
-			t.id = id;
-//			t.size = 
-
-
-
-			return false;
+			if(id == 0xFFFF || size > DATA_MAX) return false;
+			return append_(id, size, src);
 		}
 
 
@@ -155,13 +558,40 @@ namespace utils {
 			@brief  読み込み
 			@param[in]	id		ＩＤ
 			@param[in]	dst		転送先
-			@param[in]	size	サイズ（バイト）
-			@return エラーなら「false」
+			@param[in]	size	サイズ（バイト、レコードより大きい場合は、@n
+								レコードのサイズまで）
+			@return 無い場合、エラーなら「false」
 		*/
 		//-----------------------------------------------------------------//
-		bool read(int desc, void* dst, uint32_t size)
+		bool read(uint16_t id, void* dst, uint32_t size) noexcept
 		{
-			return false;
+			auto len = get_size(id);
+			if(len < 0) return false;
+			if(size > static_cast<uint32_t>(len)) size = len;
+			return fio_.read(find_(id)->pos_ * 4 + 4, dst, size);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  削除
+			@param[in]	id		ＩＤ
+			@return 無い場合、エラーなら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool remove(uint16_t id) noexcept
+		{
+			if(get_size(id) < 0) return false;
+			return append_(id, DELETE, nullptr);
 		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  カウンターの取得
+			@return カウンター
+		*/
+		//-----------------------------------------------------------------//
+		const counter_t& get_counter() const noexcept { return counter_; }
 	};
 }
@@ -28,7 +28,13 @@
 			+ 2020/01/02 11:05- ポインター表示機能「%p」追加。 @n
 			+ 2020/02/02 15:43- enum error など共有定義の継承。 @n
 			! 2019/02/02 19:42- 符号文字カウントの不具合修正。@n
-			+ 2020/02/04 05:23- std::string 型追加。
+			+ 2020/02/04 05:23- std::string 型追加。@n
+			+ 2020/03/08 10:12- 整数変換を２桁毎のテーブル変換に変更。@n
+			+ 2020/03/08 10:12- 出力ファンクタが write(const char*, uint32_t) を持つ場合、@n
+			                    まとめて出力する。@n
+			! 2020/03/08 10:12- float 変換を整数演算による正確な変換に変更（%e の正規化、@n
+			                    大きな値、左詰めの符号、%y の符号と丸めの不具合修正）@n
+			+ 2020/03/08 10:12- 精度の指定が無い %g、%G は、元の値に戻る最短の桁で表示。
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2013, 2020 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -98,6 +104,8 @@ namespace utils {
 
 		void operator() (char ch) noexcept { }
 
+		void write(const char* s, uint32_t n) noexcept { }
+
 		void clear() noexcept { };
 
 		uint size() const noexcept { return 0; }
@@ -129,6 +137,10 @@ namespace utils {
 			++size_;
 		}
 
+		void write(const char* s, uint32_t n) noexcept {
+			size_ += n;
+		}
+
 		void clear() noexcept { size_ = 0; };
 
 		uint size() const noexcept { return size_; }
@@ -161,11 +173,23 @@ namespace utils {
 			putchar(ch);
 #else
 			char tmp = ch;
-			write(STDOUT_FILENO, &tmp, 1);
+			::write(STDOUT_FILENO, &tmp, 1);
 #endif
 			++size_;
 		}
 
+		void write(const char* s, uint32_t n) noexcept
+		{
+#ifdef USE_PUTCHAR
+			for(uint32_t i = 0; i < n; ++i) {
+				putchar(s[i]);
+			}
+#else
+			::write(STDOUT_FILENO, s, n);
+#endif
+			size_ += n;
+		}
+
 		void clear() noexcept { size_ = 0; };
 
 		uint size() const noexcept { return size_; }
@@ -205,6 +229,23 @@ namespace utils {
 			++size_;
 		}
 
+		// 改行を含む場合は、まとめて書き込んだ後にフラッシュする
+		void write(const char* s, uint32_t n) noexcept {
+			size_ += n;
+			bool nl = false;
+			while(n > 0) {
+				uint32_t l = BFN - pos_;
+				if(l > n) l = n;
+				std::memcpy(&buff_[pos_], s, l);
+				if(std::memchr(s, '\n', l) != nullptr) nl = true;
+				pos_ += l;
+				s += l;
+				n -= l;
+				if(pos_ >= BFN) flush();
+			}
+			if(nl) flush();
+		}
+
 		void clear() noexcept { size_ = 0; };
 
 		uint32_t size() const noexcept { return size_; }
@@ -218,7 +259,7 @@ namespace utils {
 				putchar(buff_[i]);
 			}
 #else
-			write(STDOUT_FILENO, buff_, pos_);
+			::write(STDOUT_FILENO, buff_, pos_);
 #endif
 			pos_ = 0;
 		}
@@ -353,6 +394,15 @@ namespace utils {
 		}
 
 
+		void write(const char* s, uint32_t n) noexcept {
+			if(pos_ >= limit_) return;
+			if(n > (limit_ - pos_)) n = limit_ - pos_;
+			std::memcpy(&dst_[pos_], s, n);
+			pos_ += n;
+			dst_[pos_] = 0;
+		}
+
+
 		void clear() noexcept { pos_ = 0; }
 
 
@@ -367,7 +417,7 @@ namespace utils {
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	class base_format {
 	public:
-		static const uint16_t VERSION = 89;
+		static const uint16_t VERSION = 90;
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 		/*!
@@ -383,6 +433,505 @@ namespace utils {
 			out_null,		///< 文字出力先が無効
 			out_overflow,	///< 文字出力先がオーバーフローした場合
 		};
+
+	protected:
+		// "00" ～ "99" のテーブル（２桁ずつ変換する）
+		static const char* dec2_() noexcept
+		{
+			static const char tbl[201] =
+				"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+				"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+				"8081828384858687888990919293949596979899";
+			return tbl;
+		}
+
+
+		// １０進変換（end の手前から格納して、先頭を返す）
+		static char* udec_(char* end, uint32_t v) noexcept
+		{
+			auto tbl = dec2_();
+			while(v >= 100) {
+				uint32_t q = v / 100;
+				uint32_t r = (v - q * 100) * 2;
+				v = q;
+				end -= 2;
+				end[0] = tbl[r];
+				end[1] = tbl[r + 1];
+			}
+			if(v >= 10) {
+				end -= 2;
+				end[0] = tbl[v * 2];
+				end[1] = tbl[v * 2 + 1];
+			} else {
+				--end;
+				*end = v + '0';
+			}
+			return end;
+		}
+
+
+		// n 桁の１０進変換（上位桁は '0' で埋める）
+		static char* udec_fill_(char* end, uint32_t v, uint32_t n) noexcept
+		{
+			auto top = end - n;
+			auto p = udec_(end, v);
+			while(p > top) {
+				--p;
+				*p = '0';
+			}
+			return p;
+		}
+
+#ifndef NO_FLOAT_FORM
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  float の正確な１０進展開 @n
+					m × 2^e2 を、整数演算だけで、上位桁から順に取り出す。@n
+					小数部は 160 ビットの固定小数点で持ち、10^9 を掛ける毎に @n
+					９桁を得る。
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		class real_digits {
+			uint32_t	frac_[5];	///< 小数部（2^-160 単位、下位ワードから）
+			char		int_[45];	///< 整数部（最大 39 桁）
+			char		blk_[9];	///< 小数部の９桁ブロック
+			uint8_t		lo_;		///< 小数部の最下位の有効ワード
+			uint8_t		ilen_;
+			uint8_t		ipos_;
+			uint8_t		bpos_;
+
+		public:
+			void set(uint32_t m, int16_t e2) noexcept
+			{
+				uint32_t iw[5] = { 0 };
+				for(uint32_t i = 0; i < 5; ++i) frac_[i] = 0;
+				lo_ = 4;
+				if(e2 >= 0) {
+					uint32_t i = e2 >> 5;
+					uint32_t s = e2 & 31;
+					iw[i] = m << s;
+					if(s > 8) iw[i + 1] = m >> (32 - s);
+				} else {
+					uint32_t fb = -e2;
+					uint32_t f = m;
+					if(fb < 32) {
+						iw[0] = m >> fb;
+						f = m & ((static_cast<uint32_t>(1) << fb) - 1);
+					}
+					uint32_t s = 160 - fb;
+					uint32_t i = s >> 5;
+					s &= 31;
+					frac_[i] = f << s;
+					if(s > 8 && i < 4) frac_[i + 1] = f >> (32 - s);
+					lo_ = i;
+				}
+
+				// 整数部は 10^9 で割りながら、下位の９桁ずつ変換（32 ビットに収まれば直接）
+				char* end = &int_[sizeof(int_)];
+				char* p = end;
+				if((iw[1] | iw[2] | iw[3] | iw[4]) == 0) {
+					if(iw[0] != 0) p = udec_(end, iw[0]);
+				} else while((iw[0] | iw[1] | iw[2] | iw[3] | iw[4]) != 0) {
+					uint64_t r = 0;
+					for(int32_t i = 4; i >= 0; --i) {
+						uint64_t t = (r << 32) | iw[i];
+						iw[i] = t / 1000000000;
+						r = t - static_cast<uint64_t>(iw[i]) * 1000000000;
+					}
+					p = udec_fill_(p, r, 9);
+				}
+				while(p < end && *p == '0') ++p;
+				ilen_ = end - p;
+				std::memmove(int_, p, ilen_);
+				ipos_ = 0;
+				bpos_ = 9;
+			}
+
+			uint8_t int_len() const noexcept { return ilen_; }
+
+			char next() noexcept
+			{
+				if(ipos_ < ilen_) return int_[ipos_++];
+				if(bpos_ >= 9) {
+					uint32_t c = 0;
+					for(uint32_t i = lo_; i < 5; ++i) {
+						uint64_t t = static_cast<uint64_t>(frac_[i]) * 1000000000 + c;
+						frac_[i] = t;
+						c = t >> 32;
+					}
+					udec_fill_(&blk_[9], c, 9);
+					bpos_ = 0;
+				}
+				return blk_[bpos_++];
+			}
+
+			// 残りの桁が全て '0' か
+			bool zero() const noexcept
+			{
+				for(uint32_t i = ipos_; i < ilen_; ++i) {
+					if(int_[i] != '0') return false;
+				}
+				if(bpos_ < 9) {
+					for(uint32_t i = bpos_; i < 9; ++i) {
+						if(blk_[i] != '0') return false;
+					}
+				}
+				for(uint32_t i = lo_; i < 5; ++i) {
+					if(frac_[i] != 0) return false;
+				}
+				return true;
+			}
+		};
+
+
+		// 次の桁で丸める（最近接偶数丸め）、最上位から桁上がりした場合「true」
+		static bool round_(char* top, char* end, real_digits& d) noexcept
+		{
+			auto r = d.next();
+			bool up = r > '5';
+			if(r == '5') {
+				up = !d.zero() || (end > top && ((end[-1] - '0') & 1) != 0);
+			}
+			if(!up) return false;
+			while(end > top) {
+				--end;
+				if(*end != '9') {
+					++*end;
+					return false;
+				}
+				*end = '0';
+			}
+			return true;
+		}
+
+
+		// 小数点以下の桁を移す（dig: 整数部 il 桁、小数部 prec 桁）
+		static char* put_point_(char* out, const char* dig, uint8_t il, uint8_t prec) noexcept
+		{
+			if(il == 0) {
+				*out++ = '0';
+			} else {
+				std::memcpy(out, dig, il);
+				out += il;
+			}
+			if(prec > 0) {
+				*out++ = '.';
+				std::memcpy(out, dig + il, prec);
+				out += prec;
+			}
+			return out;
+		}
+
+
+		// 指数部
+		static char* put_exp_(char* out, int16_t x, char e) noexcept
+		{
+			*out++ = e;
+			if(x < 0) {
+				*out++ = '-';
+				x = -x;
+			} else {
+				*out++ = '+';
+			}
+			char tmp[4];
+			auto p = udec_fill_(&tmp[4], x, 2);
+			while(p < &tmp[4]) *out++ = *p++;
+			return out;
+		}
+
+
+		// %f 形式
+		static char* real_fixed_(char* out, uint32_t m, int16_t e2, uint8_t prec) noexcept
+		{
+			real_digits d;
+			d.set(m, e2);
+			char dig[96];
+			uint8_t il = d.int_len();
+			char* p = &dig[1];
+			for(uint32_t i = 0; i < (il + prec); ++i) *p++ = d.next();
+			char* top = &dig[1];
+			if(round_(top, p, d)) {
+				--top;
+				*top = '1';
+				++il;
+			}
+			return put_point_(out, top, il, prec);
+		}
+
+
+		// %e 形式（x に指数を返す）
+		static char* real_exp_(char* out, uint32_t m, int16_t e2, uint8_t prec, char e, int16_t& x) noexcept
+		{
+			real_digits d;
+			d.set(m, e2);
+			char dig[64];
+			char* p = dig;
+			x = 0;
+			if(m != 0) {
+				if(d.int_len() > 0) {
+					x = d.int_len() - 1;
+				} else {
+					char ch;
+					x = -1;
+					while((ch = d.next()) == '0') --x;
+					*p++ = ch;
+				}
+			}
+			while(p < &dig[prec + 1]) *p++ = d.next();
+			if(round_(dig, p, d)) {
+				dig[0] = '1';
+				++x;
+			}
+			out = put_point_(out, dig, 1, prec);
+			return put_exp_(out, x, e);
+		}
+
+
+		// %g 形式の末尾の '0' と '.' を取り除く
+		static char* strip_zero_(char* top, char* end) noexcept
+		{
+			if(std::memchr(top, '.', end - top) == nullptr) return end;
+			while(end[-1] == '0') --end;
+			if(end[-1] == '.') --end;
+			return end;
+		}
+
+
+		// %g 形式（精度指定あり）
+		static char* real_auto_(char* out, uint32_t m, int16_t e2, uint8_t prec, char e) noexcept
+		{
+			if(prec == 0) prec = 1;
+			int16_t x;
+			char* end = real_exp_(out, m, e2, prec - 1, e, x);
+			if(x >= -4 && x < prec) {
+				end = strip_zero_(out, real_fixed_(out, m, e2, prec - 1 - x));
+			} else {  // 指数部（float では常に４文字）を残して、仮数部を詰める
+				char tmp[4];
+				std::memcpy(tmp, end - 4, 4);
+				end = strip_zero_(out, end - 4);
+				std::memcpy(end, tmp, 4);
+				end += 4;
+			}
+			return end;
+		}
+
+
+		static const uint64_t* pow5_inv_() noexcept
+		{
+			static const uint64_t tbl[31] = {
+				0x0800000000000001, 0x0666666666666667, 0x051EB851EB851EB9,
+				0x04189374BC6A7EFA, 0x068DB8BAC710CB2A, 0x053E2D6238DA3C22,
+				0x0431BDE82D7B634E, 0x06B5FCA6AF2BD216, 0x055E63B88C230E78,
+				0x044B82FA09B5A52D, 0x06DF37F675EF6EAE, 0x057F5FF85E592558,
+				0x0465E6604B7A8447, 0x0709709A125DA071, 0x05A126E1A84AE6C1,
+				0x0480EBE7B9D58567, 0x0734ACA5F6226F0B, 0x05C3BD5191B525A3,
+				0x049C97747490EAE9, 0x0760F253EDB4AB0E, 0x05E72843249088D8,
+				0x04B8ED0283A6D3E0, 0x078E480405D7B966, 0x060B6CD004AC9452,
+				0x04D5F0A66A23A9DB, 0x07BCB43D769F762B, 0x063090312BB2C4EF,
+				0x04F3A68DBC8F03F3, 0x07EC3DAF94180651, 0x065697BFA9ACD1DA,
+				0x051212FFBAF0A7E2
+			};
+			return tbl;
+		}
+
+
+		static const uint64_t* pow5_() noexcept
+		{
+			static const uint64_t tbl[48] = {
+				0x1000000000000000, 0x1400000000000000, 0x1900000000000000,
+				0x1F40000000000000, 0x1388000000000000, 0x186A000000000000,
+				0x1E84800000000000, 0x1312D00000000000, 0x17D7840000000000,
+				0x1DCD650000000000, 0x12A05F2000000000, 0x174876E800000000,
+				0x1D1A94A200000000, 0x12309CE540000000, 0x16BCC41E90000000,
+				0x1C6BF52634000000, 0x11C37937E0800000, 0x16345785D8A00000,
+				0x1BC16D674EC80000, 0x1158E460913D0000, 0x15AF1D78B58C4000,
+				0x1B1AE4D6E2EF5000, 0x10F0CF064DD59200, 0x152D02C7E14AF680,
+				0x1A784379D99DB420, 0x108B2A2C28029094, 0x14ADF4B7320334B9,
+				0x19D971E4FE8401E7, 0x1027E72F1F128130, 0x1431E0FAE6D7217C,
+				0x193E5939A08CE9DB, 0x1F8DEF8808B02452, 0x13B8B5B5056E16B3,
+				0x18A6E32246C99C60, 0x1ED09BEAD87C0378, 0x13426172C74D822B,
+				0x1812F9CF7920E2B6, 0x1E17B84357691B64, 0x12CED32A16A1B11E,
+				0x178287F49C4A1D66, 0x1D6329F1C35CA4BF, 0x125DFA371A19E6F7,
+				0x16F578C4E0A060B5, 0x1CB2D6F618C878E3, 0x11EFC659CF7D4B8D,
+				0x166BB7F0435C9E71, 0x1C06A5EC5433C60D, 0x118427B3B4A05BC8
+			};
+			return tbl;
+		}
+
+
+		static int32_t pow5bits_(int32_t e) noexcept { return ((e * 1217359) >> 19) + 1; }
+
+		static bool pow5_multiple_(uint32_t v, uint32_t p) noexcept
+		{
+			uint32_t n = 0;
+			while(v != 0 && (v % 5) == 0) {
+				v /= 5;
+				++n;
+			}
+			return n >= p;
+		}
+
+		static uint32_t mul_shift_(uint32_t m, uint64_t f, int32_t shift) noexcept
+		{
+			uint64_t lo = static_cast<uint64_t>(m) * static_cast<uint32_t>(f);
+			uint64_t hi = static_cast<uint64_t>(m) * static_cast<uint32_t>(f >> 32);
+			return ((lo >> 32) + hi) >> (shift - 32);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  最短の１０進表現（Ryu アルゴリズム） @n
+					元の float に正確に戻る、最も短い桁を、32 x 32 ビットの @n
+					乗算とテーブルだけで求める。
+			@param[in]	mant	IEEE754 仮数部（23 ビット）
+			@param[in]	ex		IEEE754 指数部（8 ビット）
+			@param[out]	e10		１０進指数
+			@return 仮数（最大９桁）
+		*/
+		//-----------------------------------------------------------------//
+		static uint32_t shortest_(uint32_t mant, uint32_t ex, int32_t& e10) noexcept
+		{
+			int32_t e2;
+			uint32_t m2;
+			if(ex == 0) {
+				e2 = 1 - 127 - 23 - 2;
+				m2 = mant;
+			} else {
+				e2 = static_cast<int32_t>(ex) - 127 - 23 - 2;
+				m2 = (1 << 23) | mant;
+			}
+			bool even = (m2 & 1) == 0;
+
+			uint32_t mv = 4 * m2;
+			uint32_t mp = 4 * m2 + 2;
+			uint32_t mm_shift = (mant != 0 || ex <= 1) ? 1 : 0;
+			uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+			uint32_t vr, vp, vm;
+			bool vm_tz = false;
+			bool vr_tz = false;
+			uint32_t last = 0;
+			if(e2 >= 0) {
+				uint32_t q = (e2 * 78913) >> 18;  // log10(2^e2)
+				e10 = q;
+				int32_t k = 59 + pow5bits_(q) - 1;
+				int32_t i = -e2 + static_cast<int32_t>(q) + k;
+				vr = mul_shift_(mv, pow5_inv_()[q], i);
+				vp = mul_shift_(mp, pow5_inv_()[q], i);
+				vm = mul_shift_(mm, pow5_inv_()[q], i);
+				if(q != 0 && (vp - 1) / 10 <= vm / 10) {
+					int32_t l = 59 + pow5bits_(q - 1) - 1;
+					last = mul_shift_(mv, pow5_inv_()[q - 1], -e2 + static_cast<int32_t>(q) - 1 + l) % 10;
+				}
+				if(q <= 9) {
+					if((mv % 5) == 0) {
+						vr_tz = pow5_multiple_(mv, q);
+					} else if(even) {
+						vm_tz = pow5_multiple_(mm, q);
+					} else {
+						vp -= pow5_multiple_(mp, q) ? 1 : 0;
+					}
+				}
+			} else {
+				uint32_t q = (-e2 * 732923) >> 20;  // log10(5^-e2)
+				e10 = static_cast<int32_t>(q) + e2;
+				int32_t i = -e2 - static_cast<int32_t>(q);
+				int32_t k = pow5bits_(i) - 61;
+				int32_t j = static_cast<int32_t>(q) - k;
+				vr = mul_shift_(mv, pow5_()[i], j);
+				vp = mul_shift_(mp, pow5_()[i], j);
+				vm = mul_shift_(mm, pow5_()[i], j);
+				if(q != 0 && (vp - 1) / 10 <= vm / 10) {
+					j = static_cast<int32_t>(q) - 1 - (pow5bits_(i + 1) - 61);
+					last = mul_shift_(mv, pow5_()[i + 1], j) % 10;
+				}
+				if(q <= 1) {
+					vr_tz = true;
+					if(even) {
+						vm_tz = mm_shift == 1;
+					} else {
+						--vp;
+					}
+				} else if(q < 31) {
+					vr_tz = (mv & ((1 << (q - 1)) - 1)) == 0;
+				}
+			}
+
+			int32_t removed = 0;
+			uint32_t out;
+			if(vm_tz || vr_tz) {
+				while((vp / 10) > (vm / 10)) {
+					vm_tz &= (vm % 10) == 0;
+					vr_tz &= last == 0;
+					last = vr % 10;
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+				if(vm_tz) {
+					while((vm % 10) == 0) {
+						vr_tz &= last == 0;
+						last = vr % 10;
+						vr /= 10;
+						vp /= 10;
+						vm /= 10;
+						++removed;
+					}
+				}
+				if(vr_tz && last == 5 && (vr % 2) == 0) {
+					last = 4;  // 偶数へ丸める
+				}
+				out = vr + (((vr == vm && (!even || !vm_tz)) || last >= 5) ? 1 : 0);
+			} else {
+				while((vp / 10) > (vm / 10)) {
+					last = vr % 10;
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+				out = vr + ((vr == vm || last >= 5) ? 1 : 0);
+			}
+			e10 += removed;
+			return out;
+		}
+
+
+		// %g 形式（精度指定なし、最短表現）
+		static char* real_shortest_(char* out, uint32_t mant, uint32_t ex, char e) noexcept
+		{
+			if(mant == 0 && ex == 0) {
+				*out++ = '0';
+				return out;
+			}
+			int32_t e10;
+			char dig[12];
+			char* end = &dig[sizeof(dig)];
+			char* top = udec_(end, shortest_(mant, ex, e10));
+			int32_t n = end - top;
+			int32_t x = e10 + n - 1;
+			if(x < -4 || x >= 9) {
+				out = put_point_(out, top, 1, n - 1);
+				return put_exp_(out, x, e);
+			}
+			if(x < 0) {
+				*out++ = '0';
+				*out++ = '.';
+				for(int32_t i = -1; i > x; --i) *out++ = '0';
+				std::memcpy(out, top, n);
+				return out + n;
+			}
+			if(x >= (n - 1)) {
+				std::memcpy(out, top, n);
+				out += n;
+				for(int32_t i = n - 1; i < x; ++i) *out++ = '0';
+				return out;
+			}
+			return put_point_(out, top, x + 1, n - x - 1);
+		}
+#endif
 	};
 
 
@@ -429,10 +978,45 @@ namespace utils {
 		bool		zerosupp_;
 		bool		sign_;
 		bool		nega_;
+		bool		prec_;
+
+		// CHAOUT が「write(const char*, uint32_t)」を持つ場合、まとめて出力する
+		template <class T>
+		static auto test_(int) -> decltype(std::declval<T&>().write(static_cast<const char*>(nullptr),
+			uint32_t(0)), std::true_type());
+
+		template <class T>
+		static std::false_type test_(...);
+
+		typedef decltype(test_<CHAOUT>(0)) has_write_t;
+
+		static void out_(std::true_type, const char* str, uint32_t n) noexcept
+		{
+			if(n == 1) chaout_(*str);
+			else chaout_.write(str, n);
+		}
+
+		static void out_(std::false_type, const char* str, uint32_t n) noexcept
+		{
+			for(uint32_t i = 0; i < n; ++i) chaout_(str[i]);
+		}
+
+		static void out_(const char* str, uint32_t n) noexcept { out_(has_write_t(), str, n); }
+
+		static void pad_(char ch, uint32_t n) noexcept
+		{
+			if(n == 0) return;
+			char tmp[16];
+			std::memset(tmp, ch, n > sizeof(tmp) ? sizeof(tmp) : n);
+			while(n > 0) {
+				uint32_t l = n > sizeof(tmp) ? sizeof(tmp) : n;
+				out_(tmp, l);
+				n -= l;
+			}
+		}
 
 		void str_(const char* str) {
-			char ch;
-			while((ch = *str++) != 0) chaout_(ch);
+			out_(str, std::strlen(str));
 		}
 
 		void reset_() {
@@ -443,6 +1027,7 @@ namespace utils {
 			zerosupp_ = false;
 			sign_ = false;
 			nega_ = false;
+			prec_ = false;
 		}
 
 		void next_() {
@@ -459,7 +1044,9 @@ namespace utils {
 			}
 			char ch;
 			apmd md = apmd::none;
-			while((ch = *form_++) != 0) {
+			// 終端では進めない（引数が余っても、終端の先を読まない）
+			while((ch = *form_) != 0) {
+				++form_;
 				if(md != apmd::none) {
 					if(ch == '+') {
 						sign_ = true;
@@ -482,6 +1069,7 @@ namespace utils {
 						}
 					} else if(ch == '.') {
 						md = apmd::point;
+						prec_ = true;
 					} else if(ch == ':') {
 						md = apmd::bitlen;
 					} else if(ch == 's') {
@@ -542,8 +1130,10 @@ namespace utils {
 					}
 				} else if(ch == '%') {
 					md = apmd::num;
-				} else {
-					chaout_(ch);
+				} else {  // 次の「%」までの文字列をまとめて出力
+					const char* top = form_ - 1;
+					while(*form_ != 0 && *form_ != '%') ++form_;
+					out_(top, form_ - top);
 				}
 			}
 		}
@@ -551,31 +1141,23 @@ namespace utils {
 
 		void out_str_(const char* str, char sign, uint16_t n)
 		{
-			if(nega_) { str_(str); }
-
 			auto num = num_;
 			if(sign != 0 && num > 0) { num--; } 
-			if(n > 0 && n < num) {
-				auto spc = num - n;
-				if(zerosupp_) {
-					if(sign != 0) { chaout_(sign); }
-					while(spc) {
-						--spc;
-						chaout_('0');
-					}
-				} else {
-					auto spc = num - n;
-					while(spc) {
-						--spc;
-						chaout_(' ');
-					}
-					if(sign != 0) { chaout_(sign); }
-				}
+			uint16_t spc = 0;
+			if(n > 0 && n < num) spc = num - n;
+			if(nega_) {
+				if(sign != 0) { chaout_(sign); }
+				out_(str, n);
+				pad_(' ', spc);
+			} else if(zerosupp_) {
+				if(sign != 0) { chaout_(sign); }
+				pad_('0', spc);
+				out_(str, n);
 			} else {
+				pad_(' ', spc);
 				if(sign != 0) { chaout_(sign); }
+				out_(str, n);
 			}
-
-			if(!nega_) { str_(str); }
 		}
 
 #ifndef NO_BIN_FORM
@@ -609,24 +1191,19 @@ namespace utils {
 #endif
 
 		void out_udec_(uint32_t v, char sign) {
-			char* p = &buff_[sizeof(buff_) - 1];
-			*p = 0;
-			uint8_t n = 0;
-			do {
-				--p;
-				*p = (v % 10) + '0';
-				v /= 10;
-				++n;
-			} while(v != 0) ;
-			out_str_(p, sign, n);
+			char* end = &buff_[sizeof(buff_) - 1];
+			*end = 0;
+			char* p = udec_(end, v);
+			out_str_(p, sign, end - p);
 		}
 
 
 		void out_dec_(int32_t v) {
 			char sign = 0;
-			if(v < 0) { v = -v; sign = '-'; }
+			uint32_t u = v;
+			if(v < 0) { u = 0 - u; sign = '-'; }
 			else if(sign_) { sign = '+'; }
-			out_udec_(v, sign);
+			out_udec_(u, sign);
 		}
 
 
@@ -673,11 +1250,11 @@ namespace utils {
 				break;
 			case mode::FIXED_REAL:
 				if(num_ == 0) num_ = 6;
-				if(val < 0) {
-					sign = true;
-					val = -val;
+				if(sign && val < 0) {
+					out_fixed_point_(0 - static_cast<uint32_t>(val), bitlen_, true);
+				} else {
+					out_fixed_point_(static_cast<uint32_t>(val), bitlen_, false);
 				}
-				out_fixed_point_<uint64_t>(val, bitlen_, sign);
 				break;
 			default:
 				error_ = error::different;
@@ -686,131 +1263,106 @@ namespace utils {
 		}
 
 
-		uint64_t make_mask_(uint8_t num) {
-			uint64_t m = 0;
-			while(num > 0) {
-				m += m;
-				++m;
-				--num;
-			}
-			return m;
-		}
-
-
-		template <typename VAL>
-		void out_fixed_point_(VAL v, uint8_t fixpoi, bool sign)
+		// 固定小数点（Qm.n）、小数部は整数演算で２桁ずつ求め、最後に四捨五入
+		void out_fixed_point_(uint32_t v, uint8_t fixpoi, bool neg)
 		{
-			// 四捨五入処理用 0.5
-			VAL m = 0;
-			if(fixpoi < (sizeof(VAL) * 8 - 4)) {
-				m = static_cast<VAL>(5) << fixpoi;
-				auto n = point_ + 1;
-				while(n > 0) {
-					m /= 10;
-					--n;
-				}
+			uint64_t f = v;
+			if(fixpoi > 56) {  // 小数部の分解能は 2^-56 まで
+				f >>= fixpoi - 56;
+				fixpoi = 56;
 			}
-
-			char sch = 0;
-			if(sign) sch = '-';
-			else if(sign_) sch = '+';
-			v += m;
-			if(num_ >= point_) num_ -= point_;
-			if(num_ > 0 && sch != 0) --num_;
-			if(num_ > 0 && point_ != 0) {
-				--num_;
-			}
-			if(fixpoi < (sizeof(VAL) * 8 - 4)) {
-				out_udec_(v >> fixpoi, sch);
-			} else {
-				out_udec_(0, sch);
-			}
-
-			if(point_ == 0) return;
-
-			char* out = buff_;
-			*out++ = '.';
-			uint16_t l = 0;
-			if(fixpoi < (sizeof(VAL) * 8 - 4)) {
-				VAL dec = v & make_mask_(fixpoi);
-				while(dec > 0) {
-					dec *= 10;
-					VAL n = dec >> fixpoi;
-					*out++ = n + '0';
-					dec -= n << fixpoi;
-					++l;
-					if(l >= point_) break;
-				}
+			uint32_t ip = f >> fixpoi;
+			uint64_t mask = (static_cast<uint64_t>(1) << fixpoi) - 1;
+			f &= mask;
+
+			uint8_t prec = point_ > 64 ? 64 : point_;
+			char tmp[80];
+			char* dp = &tmp[12];
+			char* top = dp + 1;
+			char* p = top;
+			auto tbl = dec2_();
+			uint32_t l = prec;
+			while(l >= 2) {
+				f *= 100;
+				uint32_t d = static_cast<uint32_t>(f >> fixpoi) * 2;
+				f &= mask;
+				*p++ = tbl[d];
+				*p++ = tbl[d + 1];
+				l -= 2;
 			}
-			while(l < point_) {
-				*out++ = '0';
-				++l;
+			if(l > 0) {
+				f *= 10;
+				*p++ = static_cast<char>(f >> fixpoi) + '0';
+				f &= mask;
 			}
-			if(mode_ == mode::REAL_AUTO || mode_ == mode::REAL_AUTO_CAPS) {
-				while (*(out - 1) == '0') {
-					out--;
+			if(fixpoi > 0 && (f >> (fixpoi - 1)) != 0) {  // 0.5 以上
+				bool carry = true;
+				char* q = p;
+				while(carry && q > top) {
+					--q;
+					if(*q != '9') {
+						++*q;
+						carry = false;
+					} else {
+						*q = '0';
+					}
 				}
-				if(*(out - 1) == '.') out--;		
+				if(carry) ++ip;
 			}
-			*out++ = 0;
-			str_(buff_);			
+			*dp = '.';
+			char* s = udec_(dp, ip);
+			char* end = prec > 0 ? p : dp;
+
+			char sch = 0;
+			if(neg) sch = '-';
+			else if(sign_) sch = '+';
+			out_str_(s, sch, end - s);
 		}
 
 
 #ifndef NO_FLOAT_FORM
-		void out_real_(float v, char e)
+		void out_real_(float v, char fm)
 		{
-			void* p = &v;
-			uint32_t fpv = *(uint32_t*)p;
-			bool sign = fpv >> 31;
-			int16_t exp = (fpv >> 23) & 0xff;
-			if(exp == 0xff) {
-				if(sign) chaout_('-');
-				str_("inf");
+			uint32_t bits;
+			std::memcpy(&bits, &v, sizeof(bits));
+			char sign = 0;
+			if((bits >> 31) != 0) sign = '-';
+			else if(sign_) sign = '+';
+
+			uint32_t ex = (bits >> 23) & 0xff;
+			uint32_t mant = bits & 0x7fffff;
+			bool caps = (fm == 'E' || fm == 'G');
+			if(ex == 0xff) {
+				const char* s;
+				if(mant != 0) s = caps ? "NAN" : "nan";
+				else s = caps ? "INF" : "inf";
+				zerosupp_ = false;
+				out_str_(s, sign, 3);
 				return;
 			}
 
-			exp -= 127;	// bias (-127)
-			int32_t val = fpv & 0x7fffff;	// 23 bits
-			int16_t shift = 23;
-			if(val == 0 && exp == -127) ; // [0.0]
-			else {
-				val |= 0x800000; // add offset 1.0
-			}
-			shift -= exp;
-
-			// 64 ビットに拡張
-			uint64_t v64 = static_cast<uint64_t>(val);
-			if(shift < 28) {
-				shift += 32;
-				v64 <<= 32;
-			}
-
-			// エキスポーネント表記の場合
-			int8_t dexp = 0;
-			if(e != 0) {
-				if(v64 > (static_cast<uint64_t>(2) << shift)) {  // 2.0 以上の場合
-					while(v64 > (static_cast<uint64_t>(2) << shift)) {
-						v64 /= 10;
-						++dexp;
-					}
-				} else if(v64 < (static_cast<uint64_t>(1) << shift)) {  // 1.0 以下
-					while(v64 < (static_cast<uint64_t>(1) << shift)) {
-						v64 *= 10;
-						--dexp;
-					}
-				}
+			uint32_t m = mant;
+			int16_t e2 = -149;
+			if(ex != 0) {
+				m |= 0x800000;
+				e2 = static_cast<int16_t>(ex) - 150;
 			}
-
-			out_fixed_point_<uint64_t>(v64, shift, sign);
-
-			if(e) {
-				chaout_(e);
-				zerosupp_ = true;
-				sign_ = true;
-				num_ = 3;
-				out_dec_(dexp);
+			// 精度の指定が無い場合は６桁（%g は最短表現）
+			uint8_t prec = prec_ ? point_ : 6;
+			if(prec > 32) prec = 32;
+			char tmp[96];
+			char* end;
+			if(fm == 'f') {
+				end = real_fixed_(tmp, m, e2, prec);
+			} else if(fm == 'e' || fm == 'E') {
+				int16_t x;
+				end = real_exp_(tmp, m, e2, prec, fm, x);
+			} else if(prec_) {
+				end = real_auto_(tmp, m, e2, prec, caps ? 'E' : 'e');
+			} else {
+				end = real_shortest_(tmp, mant, ex, caps ? 'E' : 'e');
 			}
+			out_str_(tmp, sign, end - tmp);
 		}
 #endif
 
@@ -857,7 +1409,7 @@ namespace utils {
 			point_(0),
 			bitlen_(0),
 			error_(error::none),
-			mode_(mode::NONE), zerosupp_(false), sign_(false), nega_(false)
+			mode_(mode::NONE), zerosupp_(false), sign_(false), nega_(false), prec_(false)
 		{
 			next_();
 		}
@@ -877,7 +1429,7 @@ namespace utils {
 			num_(0), point_(0),
 			bitlen_(0),
 			error_(error::none),
-			mode_(mode::NONE), zerosupp_(false), sign_(false)
+			mode_(mode::NONE), zerosupp_(false), sign_(false), nega_(false), prec_(false)
 		{
 			if(!chaout_.set(buff, size)) {
 				error_ = error::out_null;
@@ -1089,13 +1641,9 @@ namespace utils {
 				}
 #ifndef NO_FLOAT_FORM
 			} else if(std::is_floating_point<T>::value) {
-				if(num_ == 0 && !zerosupp_ && point_ == 0) {
-					num_ = 6;
-					point_ = 6;
-				}
 				switch(mode_) {
 				case mode::REAL:
-					out_real_(val, 0);
+					out_real_(val, 'f');
 					break;
 				case mode::EXPONENT_CAPS:
 					out_real_(val, 'E');
@@ -1104,8 +1652,10 @@ namespace utils {
 					out_real_(val, 'e');
 					break;
 				case mode::REAL_AUTO_CAPS:
+					out_real_(val, 'G');
+					break;
 				case mode::REAL_AUTO:
-					out_real_(val, 0);
+					out_real_(val, 'g');
 					break;
 				default:
 					error_ = error::different;
@@ -0,0 +1,404 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	I2C トランザクション（非同期キュー、定期実行） @n
+			iica_io、sci_i2c_io で共通に使う、トランザクション記述子と、@n
+			そのキュー。@n
+			・記述子は利用側で確保し、完了するまで保持する事 @n
+			・キューへの登録（push）と定期実行（service）は、同じコンテキスト @n
+			  （メインループ等）から呼ぶ事 @n
+			・記述子のタスクは、割り込み内から呼ばれる（タスクから、キューに @n
+			  登録してはならない）@n
+			・ティックは「service」の呼び出し回数で、レイテンシーの単位となる。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include "common/fixed_fifo.hpp"
+#include "common/vect.h"
+
+namespace device {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  I2C トランザクション記述子 @n
+				・読み出し：START, ADR+W, REG, RESTART, ADR+R, DATA..., STOP @n
+				・書き込み：START, ADR+W, REG, DATA..., STOP @n
+				（レジスターを使わない場合は、REG と RESTART を省く）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct i2c_trans {
+
+		typedef void (*TASK)(i2c_trans& t);
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  トランザクションの状態
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		enum class state : uint8_t {
+			idle,		///< 未登録
+			queue,		///< キュー待ち
+			busy,		///< 転送中
+			done,		///< 正常終了
+			error,		///< エラー終了（NACK、アービトレーション・ロスト）
+		};
+
+		uint8_t			adr_;		///< ７ビット・アドレス
+		uint8_t			reg_;		///< レジスター・アドレス
+		bool			use_reg_;	///< レジスター・アドレスを送る場合「true」
+		bool			read_;		///< 読み出しの場合「true」
+		uint8_t*		dst_;		///< 読み出し先
+		const uint8_t*	src_;		///< 書き込み元
+		uint16_t		len_;		///< データのバイト数
+		TASK			task_;		///< 完了タスク（割り込み内から呼ばれる）
+
+		volatile state	state_;
+		uint32_t		tick_;		///< キューに登録したティック
+		uint32_t		lat_;		///< 登録から完了までのティック
+
+		uint16_t		period_;	///< 定期実行の周期（ティック）
+		uint16_t		count_;		///< 定期実行のカウンター
+		i2c_trans*		link_;		///< 定期実行のリスト
+
+		i2c_trans() noexcept : adr_(0), reg_(0), use_reg_(false), read_(false),
+			dst_(nullptr), src_(nullptr), len_(0), task_(nullptr),
+			state_(state::idle), tick_(0), lat_(0), period_(0), count_(0), link_(nullptr)
+		{ }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レジスター読み出しの設定
+			@param[in]	adr		７ビット・アドレス
+			@param[in]	reg		レジスター・アドレス
+			@param[out]	dst		読み出し先
+			@param[in]	len		バイト数
+			@param[in]	task	完了タスク
+		*/
+		//-----------------------------------------------------------------//
+		void set_read(uint8_t adr, uint8_t reg, void* dst, uint16_t len, TASK task = nullptr) noexcept
+		{
+			adr_ = adr;
+			reg_ = reg;
+			use_reg_ = true;
+			read_ = true;
+			dst_ = static_cast<uint8_t*>(dst);
+			src_ = nullptr;
+			len_ = len;
+			task_ = task;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  レジスター書き込みの設定
+			@param[in]	adr		７ビット・アドレス
+			@param[in]	reg		レジスター・アドレス
+			@param[in]	src		書き込み元
+			@param[in]	len		バイト数（０ならレジスター・アドレスだけ）
+			@param[in]	task	完了タスク
+		*/
+		//-----------------------------------------------------------------//
+		void set_write(uint8_t adr, uint8_t reg, const void* src, uint16_t len, TASK task = nullptr) noexcept
+		{
+			adr_ = adr;
+			reg_ = reg;
+			use_reg_ = true;
+			read_ = false;
+			dst_ = nullptr;
+			src_ = static_cast<const uint8_t*>(src);
+			len_ = len;
+			task_ = task;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  受信の設定（レジスター・アドレス無し）
+			@param[in]	adr		７ビット・アドレス
+			@param[out]	dst		読み出し先
+			@param[in]	len		バイト数
+			@param[in]	task	完了タスク
+		*/
+		//-----------------------------------------------------------------//
+		void set_recv(uint8_t adr, void* dst, uint16_t len, TASK task = nullptr) noexcept
+		{
+			set_read(adr, 0, dst, len, task);
+			use_reg_ = false;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  送信の設定（レジスター・アドレス無し）
+			@param[in]	adr		７ビット・アドレス
+			@param[in]	src		書き込み元
+			@param[in]	len		バイト数
+			@param[in]	task	完了タスク
+		*/
+		//-----------------------------------------------------------------//
+		void set_send(uint8_t adr, const void* src, uint16_t len, TASK task = nullptr) noexcept
+		{
+			set_write(adr, 0, src, len, task);
+			use_reg_ = false;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  転送中か検査
+			@return キュー待ち、又は転送中なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool probe() const noexcept { return state_ == state::queue || state_ == state::busy; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  バス上のビット数（START、STOP は１ビットとして数える）
+			@return ビット数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_bits() const noexcept
+		{
+			uint32_t n = 1 + 9 + len_ * 9 + 1;
+			if(use_reg_) {
+				n += 9;
+				if(read_) n += 1 + 9;
+			}
+			return n;
+		}
+	};
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  I2C トランザクション・キュー @n
+				先頭の記述子は、完了するまでキューに残る。
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class i2c_trans_queue {
+	public:
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  カウンター
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct counter_t {
+			uint32_t	trans_;		///< 正常終了したトランザクション数
+			uint32_t	error_;		///< エラー終了したトランザクション数
+			uint32_t	full_;		///< キューが一杯で、登録出来なかった数
+			uint32_t	skip_;		///< 前回が終わっていないので、飛ばした定期実行の数
+			uint32_t	lat_max_;	///< 最大レイテンシー（ティック）
+			uint32_t	lat_sum_;	///< レイテンシーの合計（ティック）
+		};
+
+	private:
+		// 最大登録数は（１６－１）個
+		typedef utils::fixed_fifo<i2c_trans*, 16> FIFO;
+
+		FIFO				fifo_;
+		i2c_trans*			list_;
+		volatile uint32_t	tick_;
+		volatile uint32_t	bits_;
+		counter_t			counter_;
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+		*/
+		//-----------------------------------------------------------------//
+		i2c_trans_queue() noexcept : fifo_(), list_(nullptr), tick_(0), bits_(0), counter_{ 0 } { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  登録
+			@param[in]	t	記述子
+			@return 転送中、又はキューが一杯なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool push(i2c_trans& t) noexcept
+		{
+			if(t.probe()) return false;
+			if(fifo_.length() >= (fifo_.size() - 1)) {
+				++counter_.full_;
+				return false;
+			}
+			t.state_ = i2c_trans::state::queue;
+			t.tick_ = tick_;
+			fifo_.put(&t);
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  先頭の記述子を取得
+			@return 先頭の記述子（無い場合「nullptr」）
+		*/
+		//-----------------------------------------------------------------//
+		i2c_trans* front() noexcept
+		{
+			if(fifo_.length() == 0) return nullptr;
+			return fifo_.get_at();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  先頭の記述子を完了させ、タスクを呼ぶ（割り込み内）
+			@param[in]	ok	正常終了なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		void finish(bool ok) noexcept
+		{
+			auto t = fifo_.get_at();
+			fifo_.get_go();
+			t->lat_ = tick_ - t->tick_;
+			if(t->lat_ > counter_.lat_max_) counter_.lat_max_ = t->lat_;
+			counter_.lat_sum_ += t->lat_;
+			if(ok) {
+				++counter_.trans_;
+				t->state_ = i2c_trans::state::done;
+			} else {
+				++counter_.error_;
+				t->state_ = i2c_trans::state::error;
+			}
+			if(t->task_ != nullptr) (*t->task_)(*t);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  バス上のビット数を加える（割り込み内）
+			@param[in]	n	ビット数
+		*/
+		//-----------------------------------------------------------------//
+		void add_bits(uint32_t n) noexcept { bits_ += n; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  定期実行の登録
+			@param[in]	t		記述子
+			@param[in]	period	周期（ティック、１以上）
+			@return 登録済みなら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool add(i2c_trans& t, uint16_t period) noexcept
+		{
+			if(period == 0) return false;
+			for(auto p = list_; p != nullptr; p = p->link_) {
+				if(p == &t) return false;
+			}
+			t.period_ = period;
+			t.count_ = period;
+			t.link_ = list_;
+			list_ = &t;
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  定期実行の解除
+			@param[in]	t		記述子
+			@return 登録されていなければ「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool remove(i2c_trans& t) noexcept
+		{
+			for(auto pp = &list_; *pp != nullptr; pp = &(*pp)->link_) {
+				if(*pp == &t) {
+					*pp = t.link_;
+					t.link_ = nullptr;
+					t.period_ = 0;
+					return true;
+				}
+			}
+			return false;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ティックを進め、周期が来た記述子を登録する
+			@return 登録した数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t service() noexcept
+		{
+			++tick_;
+			uint32_t n = 0;
+			for(auto p = list_; p != nullptr; p = p->link_) {
+				if(--p->count_ != 0) continue;
+				p->count_ = p->period_;
+				if(p->probe()) {
+					++counter_.skip_;
+				} else if(push(*p)) {
+					++n;
+				}
+			}
+			return n;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ティックの取得
+			@return ティック
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_tick() const noexcept { return tick_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  バス負荷の取得 @n
+					前回の呼び出しから、バス上に流したビット数で計算する。 @n
+					（ビット数は割り込み内で加えるので、割り込みを禁止して取り出す）
+			@param[in]	ms		前回の呼び出しからの経過時間（ミリ秒）
+			@param[in]	rate	ビット・レート
+			@return バス負荷（0.1% 単位）
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_load(uint32_t ms, uint32_t rate) noexcept
+		{
+			auto psw = lock_interrupt();
+			uint32_t bits = bits_;
+			bits_ = 0;
+			unlock_interrupt(psw);
+			if(ms == 0 || rate == 0) return 0;
+			uint64_t cap = static_cast<uint64_t>(rate) * ms;
+			return static_cast<uint32_t>(static_cast<uint64_t>(bits) * 1000000 / cap);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  カウンターの取得
+			@return カウンター
+		*/
+		//-----------------------------------------------------------------//
+		const counter_t& get_counter() const noexcept { return counter_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  カウンターのリセット
+		*/
+		//-----------------------------------------------------------------//
+		void reset_counter() noexcept
+		{
+			auto psw = lock_interrupt();
+			counter_ = counter_t{ 0 };
+			unlock_interrupt(psw);
+		}
+	};
+}
@@ -1,9 +1,12 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	RX グループ・IICA 制御
+	@brief	RX グループ・IICA 制御 @n
+			※トランザクション（trans）は、記述子をキューに登録して、割り込みで @n
+			連続して転送する。send、recv は、転送中のトランザクションが終わる @n
+			のを待ち、自分の転送が終わるまで、次のトランザクションを始めない。
     @author 平松邦仁 (hira@rvf-rc45.net)
-	@copyright	Copyright (C) 2016, 2018 Kunihito Hiramatsu @n
+	@copyright	Copyright (C) 2016, 2020 Kunihito Hiramatsu @n
 				Released under the MIT license @n
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
@@ -13,6 +16,7 @@
 #include "common/renesas.hpp"
 #include "common/format.hpp"
 #include "common/delay.hpp"
+#include "common/i2c_trans.hpp"
 
 namespace device {
 
@@ -57,6 +61,7 @@ namespace device {
 		uint8_t		sadr_;
 		uint8_t		speed_;
 		error		error_;
+		uint32_t	rate_;
 
 		enum class event : uint8_t {
 			NONE,
@@ -71,6 +76,7 @@ namespace device {
 			volatile event		event_;
 			volatile uint8_t	firstb_;
 			volatile bool		dummy_recv_;
+			volatile bool		nack_;
 			const uint8_t*		src_;
 			uint8_t*			dst_;
 			volatile uint16_t	len_;
@@ -78,27 +84,226 @@ namespace device {
 			volatile uint16_t	send_id_back_;
 			volatile uint16_t	recv_id_;
 			volatile uint16_t	recv_id_back_;
-			intr_t() : event_(event::NONE), firstb_(0), dummy_recv_(false),
+			intr_t() : event_(event::NONE), firstb_(0), dummy_recv_(false), nack_(false),
 				src_(nullptr), dst_(nullptr), len_(0),
 				send_id_(0), send_id_back_(0), recv_id_(0), recv_id_back_(0) { }
 		};
 		static intr_t	intr_;
 
-		static INTERRUPT_FUNC void event_task_()
+		enum class phase : uint8_t {
+			adr,		///< アドレス送信
+			reg,		///< レジスター・アドレス送信
+			send,		///< データ送信
+			restart,	///< リスタート待ち
+			recv,		///< データ受信
+			stop,		///< ストップ待ち
+		};
+
+		struct trans_t {
+			i2c_trans_queue		queue_;
+			i2c_trans* volatile	cur_;
+			const uint8_t*		src_;
+			uint8_t*			dst_;
+			uint16_t			len_;
+			phase				phase_;
+			bool				dummy_;
+			bool				error_;
+			volatile bool		busy_;	///< send、recv の転送中
+			trans_t() : queue_(), cur_(nullptr), src_(nullptr), dst_(nullptr), len_(0),
+				phase_(phase::adr), dummy_(false), error_(false), busy_(false) { }
+		};
+		static trans_t	trans_;
+
+		static void set_ackbt_(bool nack)
+		{
+			IICA::ICMR3.ACKWP = 1;
+			IICA::ICMR3.ACKBT = nack;
+			IICA::ICMR3.ACKWP = 0;
+		}
+
+		static void trans_next_()
+		{
+			if(trans_.busy_ || trans_.cur_ != nullptr) return;
+			auto t = trans_.queue_.front();
+			if(t == nullptr) return;
+
+			t->state_ = i2c_trans::state::busy;
+			trans_.src_ = t->src_;
+			trans_.dst_ = t->dst_;
+			trans_.len_ = t->len_;
+			trans_.phase_ = phase::adr;
+			trans_.dummy_ = false;
+			trans_.error_ = false;
+			trans_.cur_ = t;
+			IICA::ICSR2.AL = 0;
+			IICA::ICSR2.NACKF = 0;
+			IICA::ICSR2.START = 0;
+			IICA::ICSR2.STOP = 0;
+			IICA::ICIER = IICA::ICIER.TIE.b() | IICA::ICIER.NAKIE.b() | IICA::ICIER.ALIE.b();
+			IICA::ICCR2.ST = 1;
+		}
+
+		// send、recv の転送を終えて、止めていたトランザクションを再開する
+		static void trans_unlock_()
+		{
+			if(!trans_.busy_) return;
+			trans_.busy_ = false;
+			trans_next_();
+		}
+
+		static void trans_stop_()
+		{
+			trans_.phase_ = phase::stop;
+			IICA::ICSR2.STOP = 0;
+			IICA::ICCR2.SP = 1;
+			IICA::ICIER.SPIE = 1;
+		}
+
+		static void trans_finish_()
+		{
+			IICA::ICIER = 0x00;
+			IICA::ICSR2.NACKF = 0;
+			IICA::ICSR2.STOP = 0;
+			IICA::ICMR3.WAIT = 0;
+			trans_.queue_.add_bits(trans_.cur_->get_bits());
+			trans_.cur_ = nullptr;
+			trans_.queue_.finish(!trans_.error_);
+			trans_next_();
+		}
+
+		// TXI: アドレス、レジスター、データの送信
+		static void trans_send_()
+		{
+			auto t = trans_.cur_;
+			switch(trans_.phase_) {
+			case phase::adr:
+				if(t->read_ && !t->use_reg_) {
+					IICA::ICIER.TIE = 0;
+					IICA::ICIER.RIE = 1;
+					trans_.dummy_ = true;
+					trans_.phase_ = phase::recv;
+					IICA::ICDRT = (t->adr_ << 1) | 1;
+				} else {
+					trans_.phase_ = t->use_reg_ ? phase::reg : phase::send;
+					IICA::ICDRT = t->adr_ << 1;
+				}
+				break;
+			case phase::reg:
+				trans_.phase_ = phase::send;
+				IICA::ICDRT = t->reg_;
+				if(t->read_ || trans_.len_ == 0) {
+					IICA::ICIER.TIE = 0;
+					IICA::ICIER.TEIE = 1;
+				}
+				break;
+			case phase::send:
+				if(trans_.len_ > 0) {
+					IICA::ICDRT = *trans_.src_++;
+					--trans_.len_;
+				}
+				if(trans_.len_ == 0) {
+					IICA::ICIER.TIE = 0;
+					IICA::ICIER.TEIE = 1;
+				}
+				break;
+			default:
+				IICA::ICIER.TIE = 0;
+				break;
+			}
+		}
+
+		// TEI: 読み出しならリスタート、書き込みならストップ
+		static void trans_tend_()
+		{
+			IICA::ICIER.TEIE = 0;
+			if(trans_.cur_->read_) {
+				trans_.phase_ = phase::restart;
+				IICA::ICSR2.START = 0;
+				IICA::ICIER.STIE = 1;
+				IICA::ICCR2.RS = 1;
+			} else {
+				trans_stop_();
+			}
+		}
+
+		// RXI: 最後の２バイトは、WAIT と ACKBT で止めて受け取る
+		static void trans_recv_()
+		{
+			if(trans_.dummy_) {
+				trans_.dummy_ = false;
+				if(trans_.len_ <= 2) IICA::ICMR3.WAIT = 1;
+				set_ackbt_(trans_.len_ == 1);
+				volatile auto d = IICA::ICDRR();  // dummy read
+				return;
+			}
+			if(trans_.len_ > 2) {
+				if(trans_.len_ == 3) IICA::ICMR3.WAIT = 1;
+				*trans_.dst_++ = IICA::ICDRR();
+			} else if(trans_.len_ == 2) {
+				set_ackbt_(true);
+				*trans_.dst_++ = IICA::ICDRR();
+			} else {
+				IICA::ICIER.RIE = 0;
+				trans_stop_();
+				*trans_.dst_++ = IICA::ICDRR();
+				IICA::ICMR3.WAIT = 0;
+			}
+			--trans_.len_;
+		}
+
+		// EEI: アービトレーション・ロスト、NACK、リスタート、ストップ
+		static void trans_event_()
+		{
+			if(IICA::ICSR2.AL() != 0) {  // マスターでは無くなるので、そのまま終了
+				IICA::ICSR2.AL = 0;
+				trans_.error_ = true;
+				trans_finish_();
+				return;
+			}
+			if(IICA::ICIER.NAKIE() != 0 && IICA::ICSR2.NACKF() != 0) {
+				IICA::ICIER = IICA::ICIER.ALIE.b();
+				trans_.error_ = true;
+				bool recv = trans_.phase_ == phase::recv;
+				trans_stop_();
+				if(recv) {
+					volatile auto d = IICA::ICDRR();  // dummy read
+				}
+				return;
+			}
+			if(trans_.phase_ == phase::restart && IICA::ICSR2.START() != 0) {
+				IICA::ICIER.STIE = 0;
+				IICA::ICSR2.START = 0;
+				trans_.dummy_ = true;
+				trans_.phase_ = phase::recv;
+				IICA::ICIER.RIE = 1;
+				IICA::ICDRT = (trans_.cur_->adr_ << 1) | 1;
+				return;
+			}
+			if(trans_.phase_ == phase::stop && IICA::ICSR2.STOP() != 0) {
+				trans_finish_();
+			}
+		}
+
+		static void event_service_()
 		{
+			if(trans_.cur_ != nullptr) {
+				trans_event_();
+				return;
+			}
 			switch(intr_.event_) {
 			case event::NONE:
 				break;
 			case event::AL:
 				break;
-			case event::NACKF:
-				IICA::ICIER.NAKIE = 0;
+			case event::NACKF:  // ストップを出して、ストップ検出で終える
+				IICA::ICIER = 0x00;
+				intr_.nack_ = true;
+				intr_.event_ = event::STOP;
+				IICA::ICSR2.STOP = 0;
+				IICA::ICCR2.SP = 1;
+				IICA::ICIER.SPIE = 1;
 				if(intr_.dst_ != nullptr) {
-					IICA::ICSR2.STOP = 0;
-					IICA::ICCR2.SP = 1;
 					volatile auto d = IICA::ICDRR();  // dummy read
-				} else {
-					IICA::ICIER.TIE = 0;
 				}
 				break;
 			case event::TOMF:
@@ -106,38 +311,70 @@ namespace device {
 			case event::START:
 				break;
 			case event::STOP:
-				IICA::ICIER.SPIE = 0;
+				IICA::ICIER = 0x00;
 				IICA::ICSR2.NACKF = 0;
 				IICA::ICSR2.STOP = 0;
+				IICA::ICMR3.WAIT = 0;
 				intr_.event_ = event::NONE;
-				++intr_.send_id_;
+				if(intr_.dst_ != nullptr) {
+					intr_.dst_ = nullptr;
+					++intr_.recv_id_;
+				} else {
+					++intr_.send_id_;
+				}
+				trans_unlock_();
 				break;
 			}
 		}
 
+		static INTERRUPT_FUNC void event_task_()
+		{
+			event_service_();
+		}
+
 		static INTERRUPT_FUNC void recv_task_()
 		{
+			if(trans_.cur_ != nullptr) {
+				trans_recv_();
+				return;
+			}
 			if(intr_.dst_ == nullptr || intr_.len_ == 0) {
 				IICA::ICIER.RIE = 0;
-			} else {
-				if(intr_.dummy_recv_) {
-					volatile auto d = IICA::ICDRR();
-					intr_.dummy_recv_ = false;
-				} else {
-					*intr_.dst_ = IICA::ICDRR();
-					++intr_.dst_;
-				   	--intr_.len_;
-					if(intr_.len_ <= 1) {
-						IICA::ICMR3.WAIT = 1;
-					} else if(intr_.len_ == 0) {
-
-					}
-				}
+				return;
+			}
+			// トランザクションと同じく、最後の２バイトは、WAIT と ACKBT で止める
+			if(intr_.dummy_recv_) {
+				intr_.dummy_recv_ = false;
+				if(intr_.len_ <= 2) IICA::ICMR3.WAIT = 1;
+				set_ackbt_(intr_.len_ == 1);
+				volatile auto d = IICA::ICDRR();  // dummy read
+				return;
+			}
+			if(intr_.len_ > 2) {
+				if(intr_.len_ == 3) IICA::ICMR3.WAIT = 1;
+				*intr_.dst_++ = IICA::ICDRR();
+			} else if(intr_.len_ == 2) {
+				set_ackbt_(true);
+				*intr_.dst_++ = IICA::ICDRR();
+			} else {  // 最後のバイト、ストップ検出（event_service_）で終える
+				IICA::ICIER.RIE = 0;
+				IICA::ICIER.NAKIE = 0;
+				intr_.event_ = event::STOP;
+				IICA::ICSR2.STOP = 0;
+				IICA::ICCR2.SP = 1;
+				IICA::ICIER.SPIE = 1;
+				*intr_.dst_++ = IICA::ICDRR();
+				IICA::ICMR3.WAIT = 0;
 			}
+			--intr_.len_;
 		}
 
 		static INTERRUPT_FUNC void send_task_()
 		{
+			if(trans_.cur_ != nullptr) {
+				trans_send_();
+				return;
+			}
 			if(intr_.firstb_) {
 				IICA::ICDRT = intr_.firstb_;
 				intr_.firstb_ = 0;
@@ -160,8 +397,12 @@ namespace device {
 		}
 
 
-		static INTERRUPT_FUNC void tend_task_()
+		static void tend_service_()
 		{
+			if(trans_.cur_ != nullptr) {
+				trans_tend_();
+				return;
+			}
 			IICA::ICSR2.STOP = 0;
 			IICA::ICCR2.SP = 1;
 			IICA::ICIER.TEIE = 0;
@@ -170,6 +411,51 @@ namespace device {
 		}
 
 
+		static INTERRUPT_FUNC void tend_task_()
+		{
+			tend_service_();
+		}
+
+
+		// EEI、TEI は、グループ割り込みの場合がある
+		template <typename VEC>
+		static void set_event_task_(VEC vec, utils::TASK itask, utils::TASK gtask, uint8_t level)
+		{
+			auto grp = ICU::get_group_vector(vec);
+			if(grp == ICU::VECTOR::NONE) {
+				icu_mgr::set_task(static_cast<ICU::VECTOR>(vec), itask);
+			} else {
+				if(level > 0) icu_mgr::set_level(grp, level);
+				icu_mgr::install_group_task(vec, gtask);
+			}
+		}
+
+
+		// 割り込みを使わない場合、キューの記述子をその場で転送する
+		void trans_poll_()
+		{
+			i2c_trans* t;
+			while((t = trans_.queue_.front()) != nullptr) {
+				t->state_ = i2c_trans::state::busy;
+				bool ok;
+				if(t->read_) {
+					// リスタートの代わりに、ストップを挟む
+					ok = true;
+					if(t->use_reg_) ok = send(t->adr_, &t->reg_, 1);
+					if(ok) ok = recv(t->adr_, t->dst_, t->len_);
+				} else if(t->use_reg_ && t->len_ > 0) {
+					ok = send(t->adr_, t->reg_, t->src_, t->len_);
+				} else if(t->use_reg_) {
+					ok = send(t->adr_, &t->reg_, 1);
+				} else {
+					ok = send(t->adr_, t->src_, t->len_);
+				}
+				trans_.queue_.add_bits(t->get_bits());
+				trans_.queue_.finish(ok);
+			}
+		}
+
+
 		static uint32_t intr_vec_(ICU::VECTOR v) { return static_cast<uint32_t>(v); }
 
 		void sleep_() {
@@ -177,6 +463,15 @@ namespace device {
 		}
 
 
+		// send、recv の前に、トランザクションを止める（転送中の物は、終わるまで待つ）
+		void trans_lock_() {
+			if(level_ == 0) return;
+			while(trans_.busy_) sleep_();  // 前の send、recv
+			trans_.busy_ = true;
+			while(probe_trans()) sleep_();
+		}
+
+
 		bool setup_start_() {
 			int loop = 0;
 			while(IICA::ICCR2.BBSY() != 0) {
@@ -210,7 +505,8 @@ namespace device {
 			@param[in]	sadr	スレーブ・アドレス
 		*/
 		//-----------------------------------------------------------------//
-		iica_io(uint8_t sadr = 0x00) : level_(0), sadr_(sadr), speed_(0), error_(error::none) { }
+		iica_io(uint8_t sadr = 0x00) : level_(0), sadr_(sadr), speed_(0), error_(error::none),
+			rate_(0) { }
 
 
 		//-----------------------------------------------------------------//
@@ -242,16 +538,19 @@ namespace device {
 
 			switch(spd_type) {
 			case speed::standard:	///< 100K b.p.s. (Standard mode)
+				rate_ = 100000;
 				IICA::ICMR1 = IICA::ICMR1.CKS.b(0b011) | IICA::ICMR1.BCWP.b();
 				IICA::ICBRH = 0b11100000 | 19;
 				IICA::ICBRL = 0b11100000 | 23;
 				break;
 			case speed::fast:		///< (50 clock) 400K b.p.s. (Fast mode)
+				rate_ = 400000;
 				IICA::ICMR1 = IICA::ICMR1.CKS.b(0b001) | IICA::ICMR1.BCWP.b();
 				IICA::ICBRH = 0b11100000 | 11;
 				IICA::ICBRL = 0b11100000 | 25;
 				break;
 			case speed::fast_plus:	///< (40 clock) 1M b.p.s. (Fast plus mode)
+				rate_ = 1000000;
 				IICA::ICMR1 = IICA::ICMR1.CKS.b(0b000) | IICA::ICMR1.BCWP.b();
 				IICA::ICBRH = 0b11100000 | 10;
 				IICA::ICBRL = 0b11100000 | 21;
@@ -264,15 +563,15 @@ namespace device {
 ///			IICA::ICFER.TMOE = 1;  // TimeOut Enable
 
 			if(level_ > 0) {
-				icu_mgr::set_task(IICA::get_ee_vec(), event_task_);
+				set_event_task_(IICA::get_ee_vec(), event_task_, event_service_, level_);
 				icu_mgr::set_task(IICA::get_rx_vec(), recv_task_);
 				icu_mgr::set_task(IICA::get_tx_vec(), send_task_);
-				icu_mgr::set_task(IICA::get_te_vec(), tend_task_);
+				set_event_task_(IICA::get_te_vec(), tend_task_, tend_service_, level_);
 			} else {
-				icu_mgr::set_task(IICA::get_ee_vec(), nullptr);
+				set_event_task_(IICA::get_ee_vec(), nullptr, nullptr, 0);
 				icu_mgr::set_task(IICA::get_rx_vec(), nullptr);
 				icu_mgr::set_task(IICA::get_tx_vec(), nullptr);
-				icu_mgr::set_task(IICA::get_te_vec(), nullptr);
+				set_event_task_(IICA::get_te_vec(), nullptr, nullptr, 0);
 			}
 			IICA::ICIER = 0x00;
 			icu_mgr::set_level(IICA::get_peripheral(), level_);
@@ -312,7 +611,8 @@ namespace device {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief	送信
+			@brief	送信 @n
+					転送中のトランザクションがあれば、終わるのを待つ。
 			@param[in]	adr	７ビットアドレス
 			@param[in]	src	転送先
 			@param[in]	len	送信バイト数
@@ -326,8 +626,10 @@ namespace device {
 
 			error_ = error::none;
 
+			trans_lock_();
 			if(!setup_start_()) {
 				error_ = error::start;
+				trans_unlock_();
 				return false;
 			}
 
@@ -335,6 +637,8 @@ namespace device {
 			if(level_) {
 				intr_.send_id_back_ = intr_.send_id_;
 				intr_.firstb_ = adr << 1;
+				intr_.nack_ = false;
+				intr_.dst_ = nullptr;
 				intr_.src_ = src;
 				intr_.len_ = len;
 				intr_.event_ = event::NACKF;
@@ -342,7 +646,7 @@ namespace device {
 				IICA::ICCR2.ST = 1;
 				if(sync) {
 					while(intr_.send_id_back_ == intr_.send_id_) sleep_();
-					if(intr_.event_ != event::NONE) {
+					if(intr_.nack_) {
 						error_ = error::send_data;
 						ret = false;
 					}
@@ -389,7 +693,8 @@ namespace device {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief	送信
+			@brief	送信 @n
+					転送中のトランザクションがあれば、終わるのを待つ。
 			@param[in]	adr	７ビットアドレス
 			@param[in]	val	転送値
 			@param[in]	src	転送先
@@ -409,7 +714,8 @@ namespace device {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief	受信
+			@brief	受信 @n
+					転送中のトランザクションがあれば、終わるのを待つ。
 			@param[in]	adr	７ビットアドレス
 			@param[out]	dst	転送先
 			@param[in]	len	受信バイト数
@@ -422,14 +728,17 @@ namespace device {
 
 			error_ = error::none;
 
+			trans_lock_();
 			if(!setup_start_()) {
 				error_ = error::start;
+				trans_unlock_();
 				return false;
 			}
 
 			if(level_) {
 				intr_.recv_id_back_ = intr_.recv_id_;
 				intr_.firstb_ = (adr << 1) | 0x01;
+				intr_.nack_ = false;
 				intr_.dst_ = dst;
 				intr_.len_ = len;
 
@@ -499,7 +808,107 @@ namespace device {
 			}
 			return true;
 		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	トランザクションの登録 @n
+					割り込みを使わない場合は、その場で転送して、タスクを呼ぶ。
+			@param[in]	t	記述子（完了するまで保持する事）
+			@return 転送中、キューが一杯、又は、読み出しが０バイトなら「false」
+		 */
+		//-----------------------------------------------------------------//
+		bool trans(i2c_trans& t)
+		{
+			if(t.read_ && t.len_ == 0) return false;
+			if(!trans_.queue_.push(t)) return false;
+
+			if(level_) trans_next_();
+			else trans_poll_();
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	定期実行の登録
+			@param[in]	t		記述子（登録中は保持する事）
+			@param[in]	period	周期（service の呼び出し回数）
+			@return 登録済みなら「false」
+		 */
+		//-----------------------------------------------------------------//
+		bool add_periodic(i2c_trans& t, uint16_t period)
+		{
+			if(t.read_ && t.len_ == 0) return false;
+			return trans_.queue_.add(t, period);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	定期実行の解除
+			@param[in]	t		記述子
+			@return 登録されていなければ「false」
+		 */
+		//-----------------------------------------------------------------//
+		bool remove_periodic(i2c_trans& t) { return trans_.queue_.remove(t); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	サービス（ティックを進め、周期が来た定期実行を登録する）@n
+					※一定間隔で呼ぶ事（trans と同じコンテキストから）
+			@return 登録した数
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t service()
+		{
+			auto n = trans_.queue_.service();
+			if(level_) trans_next_();
+			else trans_poll_();
+			return n;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	トランザクションが転送中か検査
+			@return 転送中なら「true」
+		 */
+		//-----------------------------------------------------------------//
+		static bool probe_trans() { return trans_.cur_ != nullptr; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	バス負荷の取得（トランザクションのみ）
+			@param[in]	ms	前回の呼び出しからの経過時間（ミリ秒）
+			@return バス負荷（0.1% 単位）
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t get_load(uint32_t ms) { return trans_.queue_.get_load(ms, rate_); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	トランザクション・カウンターの取得
+			@return カウンター
+		 */
+		//-----------------------------------------------------------------//
+		static const i2c_trans_queue::counter_t& get_trans_counter()
+		{
+			return trans_.queue_.get_counter();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	トランザクション・カウンターのリセット
+		 */
+		//-----------------------------------------------------------------//
+		static void reset_trans_counter() { trans_.queue_.reset_counter(); }
 	};
 
 	template<class IICA> typename iica_io<IICA>::intr_t iica_io<IICA>::intr_;
+	template<class IICA> typename iica_io<IICA>::trans_t iica_io<IICA>::trans_;
 }
@@ -0,0 +1,2206 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	I/O シミュレーター（ホスト上での周辺機器レジスター模擬） @n
+			「IO_SIM」を定義してコンパイルすると、io_utils.hpp の @n
+			wr8_/rd8_/wr16_/rd16_/wr32_/rd32_ は、実アドレスでは無く、 @n
+			ここで管理する疎なアドレス空間（4K バイトのページ単位で確保）@n
+			をアクセスする。 @n
+			・周辺機器のモデルは、アドレス範囲毎に「space::attach」で登録し、@n
+			  レジスターの読み書きをフックする。@n
+			・モデルの無いページは、単なるメモリーとして振舞う。@n
+			・割り込みは「intr::raise」で要求し、vect.c のベクターテーブル @n
+			  （set_interrupt_task、icu_mgr::set_task で登録したタスク）@n
+			  を呼び出す。@n
+			・時間の経過は「space::step」で、登録されたモデルに通知する。@n
+			・DMAC の起動要因になる割り込みは、「intr::hook」で登録した @n
+			  モデルが横取りする。@n
+			・ホスト上のバッファは「space::map」（io_utils.hpp の @n
+			  get_address）で、この空間に割り当てて、DMAC から読み書きする。@n
+			※ホスト側では、vect.c も「IO_SIM」を定義してコンパイルする事。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <deque>
+#include <functional>
+
+extern "C" {
+	extern void (*interrupt_vectors[256])(void);
+};
+
+namespace device {
+
+	namespace sim {
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	周辺機器モデル基底クラス
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		class model {
+
+			uint32_t	org_;
+			uint32_t	len_;
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+				@param[in]	org		開始アドレス
+				@param[in]	len		レジスター領域のバイト数
+			*/
+			//-------------------------------------------------------------//
+			model(uint32_t org, uint32_t len) noexcept : org_(org), len_(len) { }
+
+			virtual ~model() { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	開始アドレスの取得
+				@return 開始アドレス
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_org() const noexcept { return org_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	レジスター領域のバイト数の取得
+				@return バイト数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_length() const noexcept { return len_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	読み出しフック（メモリーの値を読んだ後に呼ばれる）
+				@param[in]	ofs		開始アドレスからのオフセット
+				@param[in]	data	読み出した値（変更すると、その値が返る）
+				@param[in]	size	アクセス・サイズ（１、２、４）
+			*/
+			//-------------------------------------------------------------//
+			virtual void read(uint32_t ofs, uint32_t& data, uint32_t size) { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	書き込みフック（メモリーに書いた後に呼ばれる）
+				@param[in]	ofs		開始アドレスからのオフセット
+				@param[in]	data	書き込んだ値
+				@param[in]	size	アクセス・サイズ（１、２、４）
+			*/
+			//-------------------------------------------------------------//
+			virtual void write(uint32_t ofs, uint32_t data, uint32_t size) { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	時間の経過
+				@param[in]	clk		経過したクロック数（PCLK）
+			*/
+			//-------------------------------------------------------------//
+			virtual void step(uint32_t clk) { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	割り込み要求の横取り（DMAC の起動要因など） @n
+						「intr::hook」で登録したモデルは、CPU より先に呼ばれる。
+				@param[in]	vec		ベクター番号
+				@return 要求を受け取る（CPU に渡さない）場合「true」
+			*/
+			//-------------------------------------------------------------//
+			virtual bool request(uint32_t vec) { return false; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	受け取った要求の処理 @n
+						要求を受け取った順に、一つずつ呼ばれる。
+				@param[in]	vec		ベクター番号
+			*/
+			//-------------------------------------------------------------//
+			virtual void service(uint32_t vec) { }
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	割り込み要求クラス @n
+					割り込み処理中に要求された割り込みは、保留して、@n
+					処理が終わってから、ベクター番号の小さい順に呼ぶ。@n
+					「hook」で登録したモデル（DMAC など）が受け取った要求は、@n
+					CPU に渡さず、要求された順に、モデルの「service」を呼ぶ。@n
+					（CPU の割り込み処理中でも、待たずに処理する）
+			@param[in]	_	ダミー（スタティック・メンバーをヘッダーに置く為）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class _>
+		class intr_t {
+
+			struct req_t {
+				model*		model_;
+				uint32_t	vec_;
+			};
+
+			static uint32_t	pend_[256 / 32];
+			static bool		busy_;
+			static uint32_t	count_;
+
+			static std::vector<model*>	hook_;
+			static std::deque<req_t>	req_;
+			static bool					req_busy_;
+
+			static void service_() noexcept
+			{
+				if(req_busy_) return;
+				req_busy_ = true;
+				while(!req_.empty()) {
+					auto r = req_.front();
+					req_.pop_front();
+					r.model_->service(r.vec_);
+				}
+				req_busy_ = false;
+			}
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	割り込みの要求
+				@param[in]	vec		ベクター番号
+			*/
+			//-------------------------------------------------------------//
+			static void raise(uint32_t vec) noexcept
+			{
+				if(vec >= 256) return;
+				for(auto m : hook_) {
+					if(m->request(vec)) {
+						req_.push_back(req_t{ m, vec });
+						service_();
+						return;
+					}
+				}
+				raise_cpu(vec);
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	CPU への割り込みの要求（モデルの横取りをしない）
+				@param[in]	vec		ベクター番号
+			*/
+			//-------------------------------------------------------------//
+			static void raise_cpu(uint32_t vec) noexcept
+			{
+				if(vec >= 256) return;
+				pend_[vec >> 5] |= 1 << (vec & 31);
+				if(!busy_) dispatch();
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	モデルへの要求（保留していた要求の再開などに使う）
+				@param[in]	m		モデル
+				@param[in]	vec		ベクター番号
+			*/
+			//-------------------------------------------------------------//
+			static void post(model& m, uint32_t vec) noexcept
+			{
+				req_.push_back(req_t{ &m, vec });
+				service_();
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	割り込み要求を横取りするモデルの登録
+				@param[in]	m	モデル
+			*/
+			//-------------------------------------------------------------//
+			static void hook(model& m) noexcept { hook_.push_back(&m); }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	割り込み要求を横取りするモデルの登録解除
+				@param[in]	m	モデル
+			*/
+			//-------------------------------------------------------------//
+			static void unhook(model& m) noexcept
+			{
+				for(auto it = hook_.begin(); it != hook_.end(); ++it) {
+					if(*it == &m) {
+						hook_.erase(it);
+						break;
+					}
+				}
+				for(auto it = req_.begin(); it != req_.end(); ) {
+					if(it->model_ == &m) it = req_.erase(it);
+					else ++it;
+				}
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	保留中の割り込みを処理
+			*/
+			//-------------------------------------------------------------//
+			static void dispatch() noexcept
+			{
+				busy_ = true;
+				uint32_t i = 0;
+				while(i < (256 / 32)) {
+					if(pend_[i] == 0) {
+						++i;
+						continue;
+					}
+					uint32_t bit = __builtin_ctz(pend_[i]);
+					pend_[i] &= ~(1 << bit);
+					auto task = interrupt_vectors[(i << 5) + bit];
+					if(task != nullptr) {
+						++count_;
+						(*task)();
+					}
+					i = 0;
+				}
+				busy_ = false;
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	割り込み処理回数の取得
+				@return 割り込み処理回数
+			*/
+			//-------------------------------------------------------------//
+			static uint32_t get_count() noexcept { return count_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	割り込み処理回数のリセット
+			*/
+			//-------------------------------------------------------------//
+			static void reset_count() noexcept { count_ = 0; }
+		};
+		typedef intr_t<void> intr;
+
+		template <class _> uint32_t intr_t<_>::pend_[256 / 32];
+		template <class _> bool intr_t<_>::busy_ = false;
+		template <class _> uint32_t intr_t<_>::count_ = 0;
+		template <class _> std::vector<model*> intr_t<_>::hook_;
+		template <class _> std::deque<typename intr_t<_>::req_t> intr_t<_>::req_;
+		template <class _> bool intr_t<_>::req_busy_ = false;
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	疎なアドレス空間クラス @n
+					上位 10 ビット、中位 10 ビットの２段のテーブルで、@n
+					4K バイトのページを、アクセスされた時に確保する。
+			@param[in]	_	ダミー（スタティック・メンバーをヘッダーに置く為）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class _>
+		class space_t {
+		public:
+			//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+			/*!
+				@brief	アクセス・カウンター
+			*/
+			//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+			struct counter_t {
+				uint32_t	read_;		///< 読み出し回数
+				uint32_t	write_;		///< 書き込み回数
+				uint32_t	hook_;		///< モデルを呼んだ回数
+			};
+
+			static const uint32_t PAGE_BITS = 12;
+			static const uint32_t PAGE_SIZE = 1 << PAGE_BITS;
+
+		private:
+			static const uint32_t L2_BITS = 10;
+			static const uint32_t L2_SIZE = 1 << L2_BITS;
+			static const uint32_t L1_SIZE = 1 << (32 - PAGE_BITS - L2_BITS);
+
+			struct hook_t {
+				uint32_t	org_;
+				uint32_t	end_;
+				model*		model_;
+			};
+
+			struct page_t {
+				uint8_t				mem_[PAGE_SIZE];
+				std::vector<hook_t>	hook_;
+				page_t() : mem_{ 0 }, hook_() { }
+			};
+
+			// ホスト・メモリーの窓（1M バイト単位）
+			static const uint32_t HOST_ORG  = 0x40000000;
+			static const uint32_t HOST_BITS = 20;
+			static const uint32_t HOST_NUM  = 1024;
+			static const uint32_t HOST_GUARD = 0x40000;	///< 窓の終わりから、この範囲は新しい窓にする
+
+			static page_t**				l1_[L1_SIZE];
+			static std::vector<model*>	model_;
+			static counter_t			counter_;
+			static uint8_t*				host_[HOST_NUM];
+			static uint32_t				host_num_;
+
+			static uint8_t* host_ptr_(uint32_t adr) noexcept
+			{
+				if(adr < HOST_ORG) return nullptr;
+				uint32_t i = (adr - HOST_ORG) >> HOST_BITS;
+				if(i >= host_num_) return nullptr;
+				return host_[i] + (adr & ((1 << HOST_BITS) - 1));
+			}
+
+			static page_t& page_(uint32_t adr) noexcept
+			{
+				auto& l2 = l1_[adr >> (PAGE_BITS + L2_BITS)];
+				if(l2 == nullptr) {
+					l2 = new page_t*[L2_SIZE]();
+				}
+				auto& pg = l2[(adr >> PAGE_BITS) & (L2_SIZE - 1)];
+				if(pg == nullptr) {
+					pg = new page_t();
+				}
+				return *pg;
+			}
+
+			static model* find_(const page_t& pg, uint32_t adr) noexcept
+			{
+				for(const auto& h : pg.hook_) {
+					if(h.org_ <= adr && adr < h.end_) return h.model_;
+				}
+				return nullptr;
+			}
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	メモリーへのポインターを取得（ページ内に限る）
+				@param[in]	adr		アドレス
+				@return ポインター
+			*/
+			//-------------------------------------------------------------//
+			static uint8_t* ptr(uint32_t adr) noexcept
+			{
+				auto p = host_ptr_(adr);
+				if(p != nullptr) return p;
+				return &page_(adr).mem_[adr & (PAGE_SIZE - 1)];
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	ホスト・メモリーを、この空間に割り当てる @n
+						DMAC などのモデルが、ホスト上のバッファを、この空間の @n
+						アドレスで読み書き出来る様にする。（同じ窓の中なら、@n
+						連続したアドレスになる）
+				@param[in]	p	ホスト・メモリーのポインター
+				@return この空間のアドレス（割り当てられない場合「０」）
+			*/
+			//-------------------------------------------------------------//
+			static uint32_t map(const volatile void* p) noexcept
+			{
+				auto a = reinterpret_cast<uintptr_t>(p);
+				for(uint32_t i = 0; i < host_num_; ++i) {
+					auto org = reinterpret_cast<uintptr_t>(host_[i]);
+					if(org <= a && a < (org + (1 << HOST_BITS) - HOST_GUARD)) {
+						return HOST_ORG + (i << HOST_BITS) + (a - org);
+					}
+				}
+				if(host_num_ >= HOST_NUM) return 0;
+				auto org = a & ~static_cast<uintptr_t>(PAGE_SIZE - 1);
+				host_[host_num_] = reinterpret_cast<uint8_t*>(org);
+				return HOST_ORG + (host_num_++ << HOST_BITS) + (a - org);
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	メモリーの読み出し（モデルを呼ばない）
+				@param[in]	adr		アドレス
+				@return 値
+			*/
+			//-------------------------------------------------------------//
+			template <typename T>
+			static T peek(uint32_t adr) noexcept
+			{
+				T v;
+				std::memcpy(&v, ptr(adr), sizeof(T));
+				return v;
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	メモリーへの書き込み（モデルを呼ばない）
+				@param[in]	adr		アドレス
+				@param[in]	data	値
+			*/
+			//-------------------------------------------------------------//
+			template <typename T>
+			static void poke(uint32_t adr, T data) noexcept
+			{
+				std::memcpy(ptr(adr), &data, sizeof(T));
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	読み出し（rd8_、rd16_、rd32_ から呼ばれる）
+				@param[in]	adr		アドレス
+				@return 値
+			*/
+			//-------------------------------------------------------------//
+			template <typename T>
+			static T read(uint32_t adr) noexcept
+			{
+				++counter_.read_;
+				auto hp = host_ptr_(adr);
+				if(hp != nullptr) {
+					T v;
+					std::memcpy(&v, hp, sizeof(T));
+					return v;
+				}
+				auto& pg = page_(adr);
+				T v;
+				std::memcpy(&v, &pg.mem_[adr & (PAGE_SIZE - 1)], sizeof(T));
+				if(pg.hook_.empty()) return v;
+
+				auto m = find_(pg, adr);
+				if(m == nullptr) return v;
+				++counter_.hook_;
+				uint32_t t = v;
+				m->read(adr - m->get_org(), t, sizeof(T));
+				return static_cast<T>(t);
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	書き込み（wr8_、wr16_、wr32_ から呼ばれる）
+				@param[in]	adr		アドレス
+				@param[in]	data	値
+			*/
+			//-------------------------------------------------------------//
+			template <typename T>
+			static void write(uint32_t adr, T data) noexcept
+			{
+				++counter_.write_;
+				auto hp = host_ptr_(adr);
+				if(hp != nullptr) {
+					std::memcpy(hp, &data, sizeof(T));
+					return;
+				}
+				auto& pg = page_(adr);
+				std::memcpy(&pg.mem_[adr & (PAGE_SIZE - 1)], &data, sizeof(T));
+				if(pg.hook_.empty()) return;
+
+				auto m = find_(pg, adr);
+				if(m == nullptr) return;
+				++counter_.hook_;
+				m->write(adr - m->get_org(), data, sizeof(T));
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	モデルの登録
+				@param[in]	m	モデル
+			*/
+			//-------------------------------------------------------------//
+			static void attach(model& m) noexcept
+			{
+				hook_t h;
+				h.org_ = m.get_org();
+				h.end_ = m.get_org() + m.get_length();
+				h.model_ = &m;
+				for(uint32_t a = h.org_ & ~(PAGE_SIZE - 1); a < h.end_; a += PAGE_SIZE) {
+					page_(a).hook_.push_back(h);
+				}
+				model_.push_back(&m);
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	モデルの登録解除
+				@param[in]	m	モデル
+			*/
+			//-------------------------------------------------------------//
+			static void detach(model& m) noexcept
+			{
+				uint32_t end = m.get_org() + m.get_length();
+				for(uint32_t a = m.get_org() & ~(PAGE_SIZE - 1); a < end; a += PAGE_SIZE) {
+					auto& hk = page_(a).hook_;
+					for(auto it = hk.begin(); it != hk.end(); ++it) {
+						if(it->model_ == &m) {
+							hk.erase(it);
+							break;
+						}
+					}
+				}
+				for(auto it = model_.begin(); it != model_.end(); ++it) {
+					if(*it == &m) {
+						model_.erase(it);
+						break;
+					}
+				}
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	時間の経過を、全てのモデルに通知
+				@param[in]	clk		経過したクロック数（PCLK）
+			*/
+			//-------------------------------------------------------------//
+			static void step(uint32_t clk) noexcept
+			{
+				for(auto m : model_) {
+					m->step(clk);
+				}
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	アクセス・カウンターの取得
+				@return アクセス・カウンター
+			*/
+			//-------------------------------------------------------------//
+			static const counter_t& get_counter() noexcept { return counter_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	アクセス・カウンターのリセット
+			*/
+			//-------------------------------------------------------------//
+			static void reset_counter() noexcept { counter_ = counter_t{ 0 }; }
+		};
+		typedef space_t<void> space;
+
+		template <class _> typename space_t<_>::page_t** space_t<_>::l1_[space_t<_>::L1_SIZE];
+		template <class _> std::vector<model*> space_t<_>::model_;
+		template <class _> typename space_t<_>::counter_t space_t<_>::counter_;
+		template <class _> uint8_t* space_t<_>::host_[space_t<_>::HOST_NUM];
+		template <class _> uint32_t space_t<_>::host_num_ = 0;
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	SCI モデル @n
+					・TDR に書いた値は、送信バッファに溜まる（送信は即時に完了）@n
+					・TIE が有効なら、TDR に書いた後、TXI を発生する。@n
+					・TIE と TE を同時に有効にしたら、TXI を発生する。@n
+					・「recv」で与えたデータは、RDR を読む度に、順番に入る。@n
+					・RIE が有効なら、RDR にデータが入る度に、RXI を発生する。
+			@param[in]	SCI	SCI 型
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class SCI>
+		class sci_model : public model {
+
+			static const uint32_t SCR_ = 0x02;
+			static const uint32_t TDR_ = 0x03;
+			static const uint32_t SSR_ = 0x04;
+			static const uint32_t RDR_ = 0x05;
+
+			std::vector<uint8_t>	send_;
+			std::vector<uint8_t>	recv_;
+			uint32_t				rpos_;
+			bool					rdrf_;
+			bool					te_;
+
+			uint8_t scr_() const noexcept { return space::peek<uint8_t>(get_org() + SCR_); }
+
+			void load_() noexcept
+			{
+				if(rdrf_ || rpos_ >= recv_.size()) return;
+				space::poke<uint8_t>(get_org() + RDR_, recv_[rpos_]);
+				++rpos_;
+				rdrf_ = true;
+				auto scr = scr_();
+				if((scr & SCI::SCR.RE.b()) != 0 && (scr & SCI::SCR.RIE.b()) != 0) {
+					intr::raise(static_cast<uint32_t>(SCI::get_rx_vec()));
+				}
+			}
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+			*/
+			//-------------------------------------------------------------//
+			sci_model() noexcept : model(SCI::SMR.address(), 0x20),
+				send_(), recv_(), rpos_(0), rdrf_(false), te_(false) { }
+
+
+			void read(uint32_t ofs, uint32_t& data, uint32_t size) override
+			{
+				if(ofs == SSR_) {
+					data |= SCI::SSR.TDRE.b() | SCI::SSR.TEND.b();
+					if(rdrf_) data |= SCI::SSR.RDRF.b();
+				} else if(ofs == RDR_) {
+					rdrf_ = false;
+					load_();
+				}
+			}
+
+
+			void write(uint32_t ofs, uint32_t data, uint32_t size) override
+			{
+				if(ofs == TDR_) {
+					send_.push_back(data);
+					auto scr = scr_();
+					if((scr & SCI::SCR.TE.b()) != 0 && (scr & SCI::SCR.TIE.b()) != 0) {
+						intr::raise(static_cast<uint32_t>(SCI::get_tx_vec()));
+					}
+				} else if(ofs == SCR_) {
+					// TIE が有効な状態で、TE が有効になったら、TXI を発生（TDR は常に空）
+					bool te = (data & SCI::SCR.TE.b()) != 0;
+					bool rise = te && !te_;
+					te_ = te;
+					if(rise && (data & SCI::SCR.TIE.b()) != 0) {
+						intr::raise(static_cast<uint32_t>(SCI::get_tx_vec()));
+					}
+					load_();
+				}
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	受信データを与える
+				@param[in]	src		データ
+				@param[in]	len		バイト数
+			*/
+			//-------------------------------------------------------------//
+			void recv(const void* src, uint32_t len) noexcept
+			{
+				auto p = static_cast<const uint8_t*>(src);
+				recv_.insert(recv_.end(), p, p + len);
+				load_();
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	送信されたデータを取得
+				@return 送信されたデータ
+			*/
+			//-------------------------------------------------------------//
+			const std::vector<uint8_t>& get_send() const noexcept { return send_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	送信されたデータをクリア
+			*/
+			//-------------------------------------------------------------//
+			void clear_send() noexcept { send_.clear(); }
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	CMT モデル @n
+					・CMSTR の STR が有効な間、「step」で CMCNT を進める。@n
+					・CMCOR に一致したら CMCNT を０に戻し、CMIE が有効なら @n
+					  CMI を発生する。
+			@param[in]	CMT	CMT 型
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class CMT>
+		class cmt_model : public model {
+
+			uint32_t	vec_;
+			uint32_t	rem_;
+
+			static uint32_t str_adr_() noexcept { return (CMT::CMCR.address() & 0x10) ? 0x00088010 : 0x00088000; }
+			static uint16_t str_bit_() noexcept { return 1 << ((CMT::CMCR.address() >> 3) & 1); }
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+				@param[in]	vec		ベクター番号（選択型割り込みの場合に指定）
+			*/
+			//-------------------------------------------------------------//
+			cmt_model(uint32_t vec = static_cast<uint32_t>(CMT::get_ivec())) noexcept :
+				model(CMT::CMCR.address(), 6), vec_(vec), rem_(0) { }
+
+
+			void step(uint32_t clk) override
+			{
+				if((space::peek<uint16_t>(str_adr_()) & str_bit_()) == 0) return;
+
+				auto cmcr = space::peek<uint16_t>(CMT::CMCR.address());
+				uint32_t shift = 3 + (cmcr & 3) * 2;  // 1/8, 1/32, 1/128, 1/512
+				rem_ += clk;
+				uint32_t n = rem_ >> shift;
+				rem_ &= (1 << shift) - 1;
+
+				uint32_t cor = space::peek<uint16_t>(CMT::CMCOR.address());
+				uint32_t cnt = space::peek<uint16_t>(CMT::CMCNT.address());
+				while(n > 0) {
+					uint32_t d = cor >= cnt ? cor - cnt + 1 : 0x10000 - cnt + cor + 1;
+					if(n < d) {
+						cnt += n;
+						break;
+					}
+					n -= d;
+					cnt = 0;
+					if(cmcr & CMT::CMCR.CMIE.b()) {
+						intr::raise(vec_);
+					}
+				}
+				space::poke<uint16_t>(CMT::CMCNT.address(), cnt);
+			}
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	DMAC モデル @n
+					・転送元、転送先は、このアドレス空間のアドレスとして扱う。@n
+					  （ホスト上のバッファは「space::map」で割り当てる）@n
+					・ソフトウェア起動（DCTG = 0）では、DMAST.DMST と DTE が有効 @n
+					  な時、DMREQ.SWREQ の書き込みで、ノーマル転送を一度に行う。@n
+					・周辺割り込み起動（DCTG = 1）では、ICU の DMRSRn で選択した @n
+					  割り込み要求を横取りし、１要求毎に１データを転送する。@n
+					  ノーマル転送は DMCRA で終了し、リピート転送は、DMCRAH 毎に @n
+					  リピート領域のアドレスを戻し、DMCRB 回で終了する。@n
+					・DMST、DTE が無効な時の要求は、ICU の IR に保留し、DTE が @n
+					  有効になった時に転送を始める。（IR を０にすると、捨てる）@n
+					・DISEL が有効なら、１データ毎に、要因の割り込みを CPU にも @n
+					  かける。@n
+					・転送が終わったら、DTE を落し、DTIF を立て、DTIE が @n
+					  有効なら、DMACnI を発生する。@n
+					※ブロック転送、拡張リピート・エリア、オフセット加算は模擬しない。
+			@param[in]	DMAC	DMAC 型
+			@param[in]	ICU		ICU 型
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class DMAC, class ICU>
+		class dmac_model : public model {
+
+			static const uint32_t DMAST_ = 0x00082200;
+
+			uint32_t	count_;
+
+			static int32_t step_(uint32_t mode, uint32_t size) noexcept
+			{
+				switch(mode) {
+				case 2: return size;
+				case 3: return -static_cast<int32_t>(size);
+				default: return 0;
+				}
+			}
+
+			static uint32_t dmrsr_() noexcept
+			{
+				uint32_t ch = (DMAC::DMSAR.address() >> 6) & 7;
+				return ICU::DMRSR0.address() + ch * 4;
+			}
+
+			static uint32_t ir_(uint32_t vec) noexcept
+			{
+				return ICU::IR[static_cast<uint8_t>(vec)].adr_;
+			}
+
+			static bool active_() noexcept
+			{
+				if((space::peek<uint8_t>(DMAST_) & 1) == 0) return false;
+				return (space::peek<uint8_t>(DMAC::DMCNT.address()) & DMAC::DMCNT.DTE.b()) != 0;
+			}
+
+			static uint32_t tmd_() noexcept { return space::peek<uint16_t>(DMAC::DMTMD.address()); }
+
+			void end_() noexcept
+			{
+				space::poke<uint8_t>(DMAC::DMCNT.address(), 0);
+				auto sts = space::peek<uint8_t>(DMAC::DMSTS.address());
+				space::poke<uint8_t>(DMAC::DMSTS.address(), sts | DMAC::DMSTS.DTIF.b());
+				if(space::peek<uint8_t>(DMAC::DMINT.address()) & DMAC::DMINT.DTIE.b()) {
+					intr::raise(static_cast<uint32_t>(DMAC::get_vec()));
+				}
+			}
+
+			// １データの転送、終了したら「false」
+			bool unit_() noexcept
+			{
+				auto tmd = tmd_();
+				auto amd = space::peek<uint16_t>(DMAC::DMAMD.address());
+				uint32_t size = 1 << ((tmd >> 8) & 3);
+				int32_t ss = step_((amd >> 14) & 3, size);
+				int32_t ds = step_((amd >> 6) & 3, size);
+				uint32_t src = space::peek<uint32_t>(DMAC::DMSAR.address());
+				uint32_t dst = space::peek<uint32_t>(DMAC::DMDAR.address());
+				uint32_t cra = space::peek<uint32_t>(DMAC::DMCRA.address());
+
+				switch(size) {
+				case 1: space::write<uint8_t>(dst, space::read<uint8_t>(src)); break;
+				case 2: space::write<uint16_t>(dst, space::read<uint16_t>(src)); break;
+				default: space::write<uint32_t>(dst, space::read<uint32_t>(src)); break;
+				}
+				src += ss;
+				dst += ds;
+				++count_;
+
+				bool fin = false;
+				if(((tmd >> 14) & 3) == 1) {  // リピート転送
+					uint32_t rep = (cra >> 16) & 0x3ff;
+					if(rep == 0) rep = 0x400;
+					uint32_t cnt = cra & 0x3ff;
+					if(cnt == 0) cnt = 0x400;
+					--cnt;
+					if(cnt == 0) {
+						cnt = rep;
+						switch((tmd >> 12) & 3) {
+						case 0: dst -= ds * rep; break;
+						case 1: src -= ss * rep; break;
+						default: break;
+						}
+						uint32_t crb = space::peek<uint16_t>(DMAC::DMCRB.address()) & 0x3ff;
+						if(crb == 0) crb = 0x400;
+						--crb;
+						space::poke<uint16_t>(DMAC::DMCRB.address(), crb);
+						fin = crb == 0;
+					}
+					cra = (cra & 0xffff0000) | (cnt & 0x3ff);
+				} else {
+					uint32_t cnt = cra & 0xffff;
+					if(cnt == 0) cnt = 0x10000;
+					--cnt;
+					cra = cnt;
+					fin = cnt == 0;
+				}
+				space::poke<uint32_t>(DMAC::DMSAR.address(), src);
+				space::poke<uint32_t>(DMAC::DMDAR.address(), dst);
+				space::poke<uint32_t>(DMAC::DMCRA.address(), cra);
+				if(fin) end_();
+				return !fin;
+			}
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+			*/
+			//-------------------------------------------------------------//
+			dmac_model() noexcept : model(DMAC::DMSAR.address(), 0x20), count_(0)
+			{
+				intr::hook(*this);
+			}
+
+			~dmac_model() { intr::unhook(*this); }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	転送したデータ数の取得
+				@return 転送したデータ数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_count() const noexcept { return count_; }
+
+
+			void write(uint32_t ofs, uint32_t data, uint32_t size) override
+			{
+				auto adr = get_org() + ofs;
+				if(adr == DMAC::DMCNT.address()) {
+					// 保留していた要求で、転送を始める
+					if((data & DMAC::DMCNT.DTE.b()) == 0 || !active_()) return;
+					if(((tmd_() & 3)) != 1) return;
+					uint32_t vec = space::peek<uint8_t>(dmrsr_());
+					if(vec != 0 && space::peek<uint8_t>(ir_(vec)) != 0) {
+						space::poke<uint8_t>(ir_(vec), 0);
+						intr::post(*this, vec);
+					}
+					return;
+				}
+
+				if(adr != DMAC::DMREQ.address()) return;
+				if((data & DMAC::DMREQ.SWREQ.b()) == 0) return;
+				if(!active_()) return;
+
+				if(!(data & DMAC::DMREQ.CLRS.b())) {
+					space::poke<uint8_t>(DMAC::DMREQ.address(), data & ~DMAC::DMREQ.SWREQ.b());
+				}
+				while(unit_()) ;
+			}
+
+
+			bool request(uint32_t vec) override
+			{
+				return vec != 0 && vec == space::peek<uint8_t>(dmrsr_());
+			}
+
+
+			void service(uint32_t vec) override
+			{
+				// 停止中、又は、要因が変わった場合は、IR に保留
+				if(!active_() || (tmd_() & 3) != 1 || vec != space::peek<uint8_t>(dmrsr_())) {
+					space::poke<uint8_t>(ir_(vec), 1);
+					return;
+				}
+				unit_();
+				if(space::peek<uint8_t>(DMAC::DMCSL.address()) & DMAC::DMCSL.DISEL.b()) {
+					intr::raise_cpu(vec);
+				}
+			}
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	RSPI モデル @n
+					・SPE が有効な時、SPDR に書いた値を、応答ファンクタに渡し、@n
+					  戻り値を受信データとする。（標準はループバック）@n
+					・受信したら SPRF を立て、SPRIE が有効なら SPRI を、@n
+					  SPTIE が有効なら SPTI を発生する。@n
+					・SPTIE が有効な状態で、SPE が有効になったら、SPTI を発生する。@n
+					  （送信バッファは常に空）
+			@param[in]	RSPI	RSPI 型
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class RSPI>
+		class rspi_model : public model {
+		public:
+			typedef std::function<uint32_t (uint32_t)> RESPONSE;
+
+		private:
+			static const uint32_t SPCR_ = 0x00;
+			static const uint32_t SPSR_ = 0x03;
+			static const uint32_t SPDR_ = 0x04;
+
+			RESPONSE	response_;
+			uint32_t	rx_;
+			bool		sprf_;
+			bool		spe_;
+			uint32_t	count_;
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+			*/
+			//-------------------------------------------------------------//
+			rspi_model() noexcept : model(RSPI::SPCR.address(), 0x20),
+				response_(), rx_(0), sprf_(false), spe_(false), count_(0) { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	応答ファンクタの設定
+				@param[in]	res		応答ファンクタ（uint32_t res(uint32_t tx)）
+			*/
+			//-------------------------------------------------------------//
+			void set_response(RESPONSE res) noexcept { response_ = res; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	転送回数の取得
+				@return 転送回数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_count() const noexcept { return count_; }
+
+
+			void read(uint32_t ofs, uint32_t& data, uint32_t size) override
+			{
+				if(ofs == SPSR_) {
+					data |= RSPI::SPSR.SPTEF.b();
+					if(sprf_) data |= RSPI::SPSR.SPRF.b();
+					else data &= ~RSPI::SPSR.SPRF.b();
+				} else if(ofs >= SPDR_ && ofs < (SPDR_ + 4)) {
+					data = rx_ >> ((ofs - SPDR_) * 8);
+					sprf_ = false;
+				}
+			}
+
+
+			void write(uint32_t ofs, uint32_t data, uint32_t size) override
+			{
+				if(ofs == SPCR_) {
+					auto spcr = space::peek<uint8_t>(get_org() + SPCR_);
+					bool spe = (spcr & RSPI::SPCR.SPE.b()) != 0;
+					bool rise = spe && !spe_;
+					spe_ = spe;
+					if(rise && (spcr & RSPI::SPCR.SPTIE.b()) != 0) {
+						intr::raise(static_cast<uint32_t>(RSPI::get_tx_vec()));
+					}
+					return;
+				}
+				if(ofs < SPDR_ || ofs >= (SPDR_ + 4)) return;
+				auto spcr = space::peek<uint8_t>(get_org() + SPCR_);
+				if((spcr & RSPI::SPCR.SPE.b()) == 0) return;
+
+				uint32_t tx = data << ((ofs - SPDR_) * 8);
+				rx_ = response_ ? response_(tx) : tx;
+				sprf_ = true;
+				++count_;
+				if(spcr & RSPI::SPCR.SPRIE.b()) {
+					intr::raise(static_cast<uint32_t>(RSPI::get_rx_vec()));
+				}
+				if(spcr & RSPI::SPCR.SPTIE.b()) {
+					intr::raise(static_cast<uint32_t>(RSPI::get_tx_vec()));
+				}
+			}
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	SD カード（SPI モード）モデル @n
+					・rspi_model の応答ファンクタとして使う。（CS は見ない）@n
+					・SDv2、ブロック・アドレス（SDHC）のカードとして、 @n
+					  CMD0/8/9/12/16/17/18/24/25/55/58、ACMD23/41 に応答する。@n
+					・セクターは RAM イメージに読み書きする。@n
+					・範囲外のセクターは、パラメーター・エラー（R1 = 0x40）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		class sdc_spi_model {
+
+			enum class state : uint8_t {
+				none,		///< コマンド待ち
+				wr_token,	///< データ・トークン待ち
+				wr_data,	///< データ・ブロック受信
+				wr_crc,		///< CRC 受信
+			};
+
+			std::vector<uint8_t>	image_;
+			std::deque<uint8_t>		out_;
+
+			uint8_t		cmd_[6];
+			uint32_t	cmd_pos_;
+			state		state_;
+			bool		idle_;
+			bool		app_;
+			uint32_t	acmd41_;
+			bool		multi_;			///< CMD25 の書き込み
+			bool		stream_;		///< CMD18 の読み出し
+			uint32_t	sector_;
+			uint32_t	pos_;
+			uint32_t	cmd_count_[64];
+			uint32_t	rd_count_;
+			uint32_t	wr_count_;
+
+			uint32_t sectors_() const noexcept { return image_.size() / 512; }
+
+			void r1_(uint8_t r1) noexcept
+			{
+				out_.push_back(0xff);  // NCR
+				out_.push_back(r1);
+			}
+
+			void block_(const uint8_t* src, uint32_t len) noexcept
+			{
+				out_.push_back(0xff);
+				out_.push_back(0xfe);
+				for(uint32_t i = 0; i < len; ++i) out_.push_back(src[i]);
+				out_.push_back(0xff);  // CRC
+				out_.push_back(0xff);
+			}
+
+			void read_block_() noexcept
+			{
+				block_(&image_[sector_ * 512], 512);
+				++sector_;
+				++rd_count_;
+			}
+
+			void command_() noexcept
+			{
+				uint8_t c = cmd_[0] & 0x3f;
+				uint32_t arg = (static_cast<uint32_t>(cmd_[1]) << 24) | (static_cast<uint32_t>(cmd_[2]) << 16)
+					| (static_cast<uint32_t>(cmd_[3]) << 8) | cmd_[4];
+				++cmd_count_[c];
+				bool app = app_;
+				app_ = false;
+				if(c == 12) {  // STOP_TRANSMISSION（スタッフ・バイトの後に応答）
+					// 送り出し途中のブロックは、読み出した数に含めない
+					if(stream_ && !out_.empty()) --rd_count_;
+					out_.clear();
+					stream_ = false;
+					out_.push_back(0xff);
+					r1_(0x00);
+					return;
+				}
+				out_.clear();
+				stream_ = false;
+				uint8_t r1 = idle_ ? 0x01 : 0x00;
+				switch(c) {
+				case 0:
+					idle_ = true;
+					acmd41_ = 0;
+					r1_(0x01);
+					break;
+				case 8:
+					r1_(r1);
+					out_.push_back(0x00);
+					out_.push_back(0x00);
+					out_.push_back((arg >> 8) & 0x0f);
+					out_.push_back(arg & 0xff);
+					break;
+				case 55:
+					app_ = true;
+					r1_(r1);
+					break;
+				case 41:
+					if(!app) { r1_(r1 | 0x04); break; }
+					// ２回目で、アイドル状態を抜ける
+					++acmd41_;
+					if(acmd41_ >= 2) idle_ = false;
+					r1_(idle_ ? 0x01 : 0x00);
+					break;
+				case 58:
+					r1_(r1);
+					out_.push_back(0xc0);  // 電源投入完了、CCS（ブロック・アドレス）
+					out_.push_back(0xff);
+					out_.push_back(0x80);
+					out_.push_back(0x00);
+					break;
+				case 9:
+					{
+						uint8_t csd[16] = { 0 };
+						uint32_t cs = (sectors_() >> 10) - 1;
+						csd[0] = 0x40;  // CSD Ver 2.0
+						csd[7] = (cs >> 16) & 0x3f;
+						csd[8] = cs >> 8;
+						csd[9] = cs;
+						r1_(r1);
+						block_(csd, sizeof(csd));
+					}
+					break;
+				case 16:
+				case 23:
+					r1_(r1);
+					break;
+				case 17:
+				case 18:
+				case 24:
+				case 25:
+					if(idle_ || arg >= sectors_()) {
+						r1_(r1 | 0x40);
+						break;
+					}
+					r1_(0x00);
+					sector_ = arg;
+					if(c == 17) {
+						read_block_();
+					} else if(c == 18) {
+						stream_ = true;
+					} else {
+						multi_ = c == 25;
+						state_ = state::wr_token;
+					}
+					break;
+				default:
+					r1_(r1 | 0x04);  // 不正なコマンド
+					break;
+				}
+			}
+
+			void input_(uint8_t d) noexcept
+			{
+				switch(state_) {
+				case state::wr_token:
+					if(d == 0xfe || d == 0xfc) {
+						if(sector_ >= sectors_()) {  // 終端を越えた
+							out_.push_back(0x0d);  // Write Error
+							state_ = state::none;
+							break;
+						}
+						state_ = state::wr_data;
+						pos_ = 0;
+					} else if(d == 0xfd && multi_) {
+						out_.push_back(0x00);  // ビジー
+						state_ = state::none;
+					}
+					return;
+				case state::wr_data:
+					image_[sector_ * 512 + pos_] = d;
+					++pos_;
+					if(pos_ >= 512) {
+						state_ = state::wr_crc;
+						pos_ = 0;
+					}
+					return;
+				case state::wr_crc:
+					++pos_;
+					if(pos_ >= 2) {
+						out_.push_back(0x05);  // Data accepted
+						out_.push_back(0x00);  // ビジー
+						++sector_;
+						++wr_count_;
+						state_ = multi_ ? state::wr_token : state::none;
+					}
+					return;
+				default:
+					break;
+				}
+
+				if(cmd_pos_ == 0 && (d & 0xc0) != 0x40) return;
+				cmd_[cmd_pos_] = d;
+				++cmd_pos_;
+				if(cmd_pos_ >= sizeof(cmd_)) {
+					cmd_pos_ = 0;
+					command_();
+				}
+			}
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+				@param[in]	sectors	セクター数（1024 の倍数）
+			*/
+			//-------------------------------------------------------------//
+			sdc_spi_model(uint32_t sectors) noexcept : image_(sectors * 512, 0), out_(),
+				cmd_{ 0 }, cmd_pos_(0), state_(state::none), idle_(false), app_(false),
+				acmd41_(0), multi_(false), stream_(false), sector_(0), pos_(0),
+				cmd_count_{ 0 }, rd_count_(0), wr_count_(0) { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	RAM イメージの参照
+				@return RAM イメージ
+			*/
+			//-------------------------------------------------------------//
+			std::vector<uint8_t>& at_image() noexcept { return image_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コマンドを受けた回数の取得
+				@param[in]	cmd	コマンド番号（ACMD は、番号のみ）
+				@return 回数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_command_count(uint32_t cmd) const noexcept { return cmd_count_[cmd & 63]; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	読み出したセクター数の取得
+				@return セクター数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_read_count() const noexcept { return rd_count_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	書き込んだセクター数の取得
+				@return セクター数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_write_count() const noexcept { return wr_count_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	１バイト交換（rspi_model の応答）
+				@param[in]	tx	MOSI
+				@return MISO
+			*/
+			//-------------------------------------------------------------//
+			uint32_t operator () (uint32_t tx) noexcept
+			{
+				// MISO は、MOSI を受ける前に決まっている
+				if(out_.empty() && stream_) {
+					if(sector_ < sectors_()) {
+						read_block_();
+					} else {
+						stream_ = false;
+						out_.push_back(0x08);  // Data Error Token（範囲外）
+					}
+				}
+				uint8_t rx = 0xff;
+				if(!out_.empty()) {
+					rx = out_.front();
+					out_.pop_front();
+				}
+				input_(tx);
+				return rx;
+			}
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	CAN モデル（FIFO メールボックス・モード） @n
+					・TFPCR の書き込みで、MB24 の内容を送信 FIFO（４段）に積む。@n
+					・オペレーション・モードの間、「step」で BCR のビット・ @n
+					  レートに従って送信する。（スタッフ・ビットを除き、 @n
+					  フレーム間スペースを含むビット数）@n
+					・送信が終わる度に、MIER.MB24 が有効なら TXF を発生する。@n
+					・セルフテスト（TCR.TSTM が２、３）では、送信したフレーム @n
+					  を受信する。「recv」で、バスからの受信を与える。@n
+					・FIDCR0/MKR6、FIDCR1/MKR7 に合うフレームだけを、受信 @n
+					  FIFO（４段、オーバーラン・モード）に入れ、先頭を MB28 @n
+					  に置く。RFPCR の書き込みで、次に進む。@n
+					・受信する度に、MIER.MB28 が有効なら RXF を発生する。@n
+					※選択型割り込みのベクターは、SLIXR から探す。
+			@param[in]	CAN	CAN 型
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class CAN>
+		class can_model : public model {
+
+			static const uint32_t TX_MB_ = 24;
+			static const uint32_t RX_MB_ = 28;
+			static const uint32_t FIDCR_ = 0x220;
+			static const uint32_t MKR_   = 0x218;
+			static const uint32_t MIER_  = 0x22C;
+			static const uint32_t CTLR_  = 0x640;
+			static const uint32_t STR_   = 0x642;
+			static const uint32_t BCR_   = 0x644;
+			static const uint32_t RFCR_  = 0x648;
+			static const uint32_t RFPCR_ = 0x649;
+			static const uint32_t TFCR_  = 0x64A;
+			static const uint32_t TFPCR_ = 0x64B;
+			static const uint32_t TCR_   = 0x658;
+			static const uint32_t SLIXR_ = 0x00087700;
+			static const uint32_t FIFO_NUM_ = 4;
+
+			struct mb_t {
+				uint8_t	m[16];
+				uint32_t get_id() const noexcept { uint32_t id; std::memcpy(&id, m, 4); return id; }
+			};
+
+			std::deque<mb_t>	tx_;
+			std::deque<mb_t>	rx_;
+			uint32_t			clk_;
+			uint32_t			send_;
+			uint32_t			reject_;
+
+			template <typename T>
+			T reg_(uint32_t ofs) const noexcept { return space::peek<T>(get_org() + ofs); }
+
+			static uint32_t vec_(uint32_t sel) noexcept
+			{
+				for(uint32_t i = 128; i <= 207; ++i) {
+					if(space::peek<uint8_t>(SLIXR_ + i) == sel) return i;
+				}
+				return sel;
+			}
+
+			bool operation_() const noexcept { return ((reg_<uint16_t>(CTLR_) >> 8) & 3) == 0; }
+
+			// 標準 ID、拡張 ID、RTR の各ビットと、マスクの１のビットを比べる
+			bool accept_(uint32_t id) const noexcept
+			{
+				for(uint32_t i = 0; i < 2; ++i) {
+					uint32_t fid = reg_<uint32_t>(FIDCR_ + i * 4);
+					uint32_t mk = reg_<uint32_t>(MKR_ + i * 4) & 0x1FFFFFFF;
+					if(((fid ^ id) & (mk | 0xC0000000)) == 0) return true;
+				}
+				return false;
+			}
+
+			void load_() noexcept
+			{
+				if(rx_.empty()) return;
+				std::memcpy(space::ptr(get_org() + RX_MB_ * 16), rx_.front().m, 16);
+			}
+
+			void receive_(const mb_t& mb) noexcept
+			{
+				if((reg_<uint8_t>(RFCR_) & 1) == 0) return;
+				if(!accept_(mb.get_id())) {
+					++reject_;
+					return;
+				}
+				if(rx_.size() >= FIFO_NUM_) {
+					space::poke<uint8_t>(get_org() + RFCR_, reg_<uint8_t>(RFCR_) | 0x10);  // RFMLF
+					return;
+				}
+				rx_.push_back(mb);
+				if(rx_.size() == 1) load_();
+				if(reg_<uint32_t>(MIER_) & (1 << RX_MB_)) {
+					intr::raise(vec_(static_cast<uint32_t>(CAN::get_rxf_vec())));
+				}
+			}
+
+			uint32_t bit_clk_() const noexcept
+			{
+				uint32_t bcr = reg_<uint32_t>(BCR_);
+				uint32_t tseg1 = ((bcr >> 28) & 15) + 1;
+				uint32_t brp = ((bcr >> 16) & 0x3FF) + 1;
+				uint32_t tseg2 = ((bcr >> 8) & 7) + 1;
+				return brp * (1 + tseg1 + tseg2);
+			}
+
+			static uint32_t frame_bits_(const mb_t& mb) noexcept
+			{
+				uint32_t id = mb.get_id();
+				uint32_t bits = (id & 0x80000000) ? 67 : 47;
+				if((id & 0x40000000) == 0) bits += (mb.m[4] & 15) * 8;
+				return bits;
+			}
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+			*/
+			//-------------------------------------------------------------//
+			can_model() noexcept : model(CAN::MB.address(0), 0x660),
+				tx_(), rx_(), clk_(0), send_(0), reject_(0) { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	送信したフレーム数の取得
+				@return 送信したフレーム数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_send() const noexcept { return send_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	フィルタで捨てたフレーム数の取得
+				@return フィルタで捨てたフレーム数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_reject() const noexcept { return reject_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	バスからの受信を与える
+				@param[in]	id		ID（MB の ID 領域の形式、IDE、RTR を含む）
+				@param[in]	src		データ
+				@param[in]	len		データ長
+			*/
+			//-------------------------------------------------------------//
+			void recv(uint32_t id, const void* src, uint8_t len) noexcept
+			{
+				if(!operation_()) return;
+				mb_t mb;
+				std::memset(mb.m, 0, sizeof(mb.m));
+				std::memcpy(mb.m, &id, 4);
+				mb.m[4] = len & 15;
+				std::memcpy(&mb.m[6], src, len > 8 ? 8 : len);
+				receive_(mb);
+			}
+
+
+			void read(uint32_t ofs, uint32_t& data, uint32_t size) override
+			{
+				if(ofs == STR_) {
+					uint32_t ctlr = reg_<uint16_t>(CTLR_);
+					uint32_t canm = (ctlr >> 8) & 3;
+					data = 0;
+					if(!rx_.empty()) data |= 1 << 2;  // RFST
+					if(!tx_.empty()) data |= 1 << 3;  // TFST
+					if(canm & 1) data |= 1 << 8;  // RSTST
+					if(canm == 2) data |= 1 << 9;  // HLTST
+					if(ctlr & (1 << 10)) data |= 1 << 10;  // SLPST
+				} else if(ofs == RFCR_) {
+					uint32_t n = rx_.size();
+					data = (data & 0x11) | (n << 1);
+					if(n == FIFO_NUM_) data |= 1 << 5;  // RFFST
+					if(n >= (FIFO_NUM_ - 1)) data |= 1 << 6;  // RFWST
+					if(n == 0) data |= 1 << 7;  // RFEST
+				} else if(ofs == TFCR_) {
+					uint32_t n = tx_.size();
+					data = (data & 0x01) | (n << 1);
+					if(n == FIFO_NUM_) data |= 1 << 6;  // TFFST
+					if(n == 0) data |= 1 << 7;  // TFEST
+				}
+			}
+
+
+			void write(uint32_t ofs, uint32_t data, uint32_t size) override
+			{
+				if(ofs == TFPCR_) {
+					if((reg_<uint8_t>(TFCR_) & 1) == 0 || tx_.size() >= FIFO_NUM_) return;
+					mb_t mb;
+					std::memcpy(mb.m, space::ptr(get_org() + TX_MB_ * 16), 16);
+					tx_.push_back(mb);
+				} else if(ofs == RFPCR_) {
+					if(rx_.empty()) return;
+					rx_.pop_front();
+					load_();
+				} else if(ofs == RFCR_) {
+					if((data & 1) == 0) rx_.clear();
+				} else if(ofs == TFCR_) {
+					if((data & 1) == 0) tx_.clear();
+				} else if(ofs == CTLR_) {
+					if(data & (1 << 8)) {  // リセット・モード
+						tx_.clear();
+						rx_.clear();
+						clk_ = 0;
+					}
+				}
+			}
+
+
+			void step(uint32_t clk) override
+			{
+				if(!operation_() || tx_.empty()) {
+					clk_ = 0;
+					return;
+				}
+				clk_ += clk;
+				uint32_t bclk = bit_clk_();
+				while(!tx_.empty()) {
+					uint32_t need = frame_bits_(tx_.front()) * bclk;
+					if(clk_ < need) break;
+					clk_ -= need;
+					mb_t mb = tx_.front();
+					tx_.pop_front();
+					++send_;
+					auto tcr = reg_<uint8_t>(TCR_);
+					if((tcr & 1) != 0 && ((tcr >> 1) & 3) >= 2) {
+						receive_(mb);
+					}
+					if(reg_<uint32_t>(MIER_) & (1 << TX_MB_)) {
+						intr::raise(vec_(static_cast<uint32_t>(CAN::get_txf_vec())));
+					}
+				}
+				if(tx_.empty()) clk_ = 0;
+			}
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	RIIC モデル（マスター送受信） @n
+					・ICBRH、ICBRL、ICMR1.CKS から１ビットの時間を決め、@n
+					  「step」で、コンディションとバイト（９ビット）を進める。@n
+					・ST は、バスが空いてから、スタート・コンディションを出す。@n
+					・スレーブは、「add_slave」で登録した２５６バイトの @n
+					  レジスター（最初に書いたバイトが、レジスター・アドレス） @n
+					  で、登録の無いアドレスには、NACK を返す。@n
+					・受信は、ICDRR を読むと、次のバイトを受け取る。最後の @n
+					  ACK ビットは ICMR3.ACKBT に従う。（WAIT は模擬しない）@n
+					※グループ割り込み（EEI、TEI）は、GRPBLn のビットを立てて @n
+					  要求するので、「step」の中からだけ要求する。
+			@param[in]	RIIC	RIIC 型
+			@param[in]	ICU		ICU 型（グループ割り込みの要求に使う）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class RIIC, class ICU>
+		class riic_model : public model {
+
+			static const uint32_t ICCR2_ = 0x01;
+			static const uint32_t ICSR2_ = 0x09;
+			static const uint32_t ICDRT_ = 0x12;
+			static const uint32_t ICDRR_ = 0x13;
+
+			enum : uint8_t {
+				AL = 0x02, START = 0x04, STOP = 0x08, NACKF = 0x10,
+				RDRF = 0x20, TEND = 0x40, TDRE = 0x80
+			};
+
+			enum class op : uint8_t { none, start, restart, send, recv, stop };
+
+			struct slave_t {
+				uint8_t	reg_[256];
+				uint8_t	ptr_;
+				bool	first_;
+			};
+
+			std::vector<std::pair<uint8_t, slave_t*>>	slaves_;
+			slave_t*	slave_;
+			uint32_t	rem_;
+			uint32_t	timer_;
+			op			op_;
+			uint8_t		flags_;
+			uint8_t		shift_;
+			uint8_t		hold_data_;
+			bool		bbsy_;
+			bool		trs_;
+			bool		st_;
+			bool		rs_;
+			bool		sp_;
+			bool		hold_;
+			bool		addr_;
+			bool		nack_;
+			bool		halt_;
+			bool		recv_req_;
+			uint32_t	bits_;
+			uint32_t	starts_;
+
+			uint8_t icier_() const noexcept { return space::peek<uint8_t>(RIIC::ICIER.address()); }
+
+			void sync_() noexcept { space::poke<uint8_t>(get_org() + ICSR2_, flags_); }
+
+			static void raise_(typename ICU::VECTOR v) noexcept
+			{
+				intr::raise(static_cast<uint32_t>(v));
+			}
+
+			template <typename V>
+			static void raise_(V v) noexcept
+			{
+				auto g = ICU::get_group_vector(v);
+				uint32_t adr = ICU::GRPBL1.address();
+				if(g == ICU::VECTOR::GROUPBL0) adr = ICU::GRPBL0.address();
+				else if(g == ICU::VECTOR::GROUPBL2) adr = ICU::GRPBL2.address();
+				space::poke<uint32_t>(adr, 1 << static_cast<uint32_t>(v));
+				intr::raise(static_cast<uint32_t>(g));
+				space::poke<uint32_t>(adr, 0);
+			}
+
+			void txi_() noexcept
+			{
+				if(icier_() & RIIC::ICIER.TIE.b()) raise_(RIIC::get_tx_vec());
+			}
+
+			void tei_() noexcept
+			{
+				if(icier_() & RIIC::ICIER.TEIE.b()) raise_(RIIC::get_te_vec());
+			}
+
+			void rxi_() noexcept
+			{
+				if(icier_() & RIIC::ICIER.RIE.b()) raise_(RIIC::get_rx_vec());
+			}
+
+			void eei_(uint8_t ena) noexcept
+			{
+				if(icier_() & ena) raise_(RIIC::get_ee_vec());
+			}
+
+			slave_t* find_(uint8_t adr) const noexcept
+			{
+				for(const auto& s : slaves_) {
+					if(s.first == adr) return s.second;
+				}
+				return nullptr;
+			}
+
+			uint32_t bit_clk_() const noexcept
+			{
+				uint32_t cks = (space::peek<uint8_t>(RIIC::ICMR1.address()) >> 4) & 7;
+				uint32_t h = (space::peek<uint8_t>(RIIC::ICBRH.address()) & 0x1F) + 1;
+				uint32_t l = (space::peek<uint8_t>(RIIC::ICBRL.address()) & 0x1F) + 1;
+				return (h + l) << cks;
+			}
+
+			void start_() noexcept
+			{
+				++starts_;
+				bbsy_ = true;
+				trs_ = true;
+				addr_ = true;
+				nack_ = false;
+				halt_ = false;
+				flags_ |= START | TDRE;
+				sync_();
+				txi_();
+				eei_(RIIC::ICIER.STIE.b());
+			}
+
+			void send_() noexcept
+			{
+				if(addr_) {
+					addr_ = false;
+					slave_ = find_(shift_ >> 1);
+					if(slave_ == nullptr) {
+						halt_ = true;
+						hold_ = false;
+						flags_ |= NACKF;
+						sync_();
+						eei_(RIIC::ICIER.NAKIE.b());
+						return;
+					}
+					if(shift_ & 1) {  // 受信へ（アドレスを ICDRR に置く）
+						trs_ = false;
+						hold_ = false;
+						space::poke<uint8_t>(get_org() + ICDRR_, shift_);
+						flags_ |= RDRF;
+						sync_();
+						rxi_();
+						return;
+					}
+					slave_->first_ = true;
+				} else if(slave_->first_) {
+					slave_->ptr_ = shift_;
+					slave_->first_ = false;
+				} else {
+					slave_->reg_[slave_->ptr_++] = shift_;
+				}
+				if(!hold_) {
+					flags_ |= TEND;
+					sync_();
+					tei_();
+				}
+			}
+
+			void recv_() noexcept
+			{
+				space::poke<uint8_t>(get_org() + ICDRR_, slave_->reg_[slave_->ptr_++]);
+				if(space::peek<uint8_t>(RIIC::ICMR3.address()) & RIIC::ICMR3.ACKBT.b()) nack_ = true;
+				flags_ |= RDRF;
+				sync_();
+				rxi_();
+			}
+
+			void stop_() noexcept
+			{
+				bbsy_ = false;
+				trs_ = false;
+				sp_ = false;
+				hold_ = false;
+				recv_req_ = false;
+				flags_ |= STOP | TDRE | TEND;
+				sync_();
+				eei_(RIIC::ICIER.SPIE.b());
+			}
+
+			// 次の動作を決める
+			void next_() noexcept
+			{
+				if(sp_ && bbsy_) {
+					op_ = op::stop;
+					timer_ = 1;
+				} else if(rs_ && bbsy_) {
+					rs_ = false;
+					op_ = op::restart;
+					timer_ = 1;
+				} else if(st_ && !bbsy_) {
+					st_ = false;
+					op_ = op::start;
+					timer_ = 2;
+				} else if(trs_ && bbsy_ && hold_ && !halt_) {
+					hold_ = false;
+					shift_ = hold_data_;
+					op_ = op::send;
+					timer_ = 9;
+					flags_ |= TDRE;
+					sync_();
+					txi_();
+				} else if(recv_req_) {
+					recv_req_ = false;
+					op_ = op::recv;
+					timer_ = 9;
+				} else if(sp_ && !bbsy_) {
+					sp_ = false;
+				}
+			}
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+			*/
+			//-------------------------------------------------------------//
+			riic_model() noexcept : model(RIIC::ICCR1.address(), 0x14),
+				slaves_(), slave_(nullptr), rem_(0), timer_(0), op_(op::none),
+				flags_(TDRE | TEND), shift_(0), hold_data_(0),
+				bbsy_(false), trs_(false), st_(false), rs_(false), sp_(false),
+				hold_(false), addr_(false), nack_(false), halt_(false), recv_req_(false),
+				bits_(0), starts_(0) { }
+
+
+			~riic_model()
+			{
+				for(auto& s : slaves_) delete s.second;
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	スレーブの登録
+				@param[in]	adr		７ビット・アドレス
+				@return レジスター（２５６バイト）
+			*/
+			//-------------------------------------------------------------//
+			uint8_t* add_slave(uint8_t adr) noexcept
+			{
+				auto s = find_(adr);
+				if(s == nullptr) {
+					s = new slave_t;
+					std::memset(s->reg_, 0, sizeof(s->reg_));
+					s->ptr_ = 0;
+					s->first_ = true;
+					slaves_.emplace_back(adr, s);
+				}
+				return s->reg_;
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	バスが使われたビット数の取得
+				@return ビット数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_bits() const noexcept { return bits_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	スタート（リスタート）コンディションの回数を取得
+				@return 回数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_starts() const noexcept { return starts_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	バス・ビジーか検査
+				@return バス・ビジーなら「true」
+			*/
+			//-------------------------------------------------------------//
+			bool probe_busy() const noexcept { return bbsy_; }
+
+
+			void read(uint32_t ofs, uint32_t& data, uint32_t size) override
+			{
+				if(ofs == ICCR2_) {
+					data &= 0x1F;
+					if(bbsy_) data |= 0x80 | 0x40;  // BBSY、MST
+					if(trs_) data |= 0x20;
+				} else if(ofs == ICSR2_) {
+					data = flags_;
+				} else if(ofs == ICDRR_) {
+					flags_ &= ~RDRF;
+					sync_();
+					if(!trs_ && bbsy_ && !nack_ && !sp_ && !halt_) recv_req_ = true;
+				}
+			}
+
+
+			void write(uint32_t ofs, uint32_t data, uint32_t size) override
+			{
+				if(ofs == ICCR2_) {
+					if(data & 0x02) st_ = true;
+					if(data & 0x04) rs_ = true;
+					if(data & 0x08) sp_ = true;
+					space::poke<uint8_t>(get_org() + ICCR2_, data & ~0x0E);
+				} else if(ofs == ICSR2_) {  // ０を書いたフラグだけ落す
+					flags_ &= data | TDRE | TEND | RDRF;
+					sync_();
+				} else if(ofs == ICDRT_) {
+					hold_ = true;
+					hold_data_ = data;
+					flags_ &= ~(TDRE | TEND);
+					sync_();
+				}
+			}
+
+
+			void step(uint32_t clk) override
+			{
+				uint32_t bclk = bit_clk_();
+				rem_ += clk;
+				while(rem_ >= bclk) {
+					rem_ -= bclk;
+					if(bbsy_ || op_ != op::none) ++bits_;
+					if(op_ == op::none) {
+						next_();
+						continue;
+					}
+					if(--timer_ > 0) continue;
+					auto o = op_;
+					op_ = op::none;
+					switch(o) {
+					case op::start:
+					case op::restart: start_(); break;
+					case op::send:    send_(); break;
+					case op::recv:    recv_(); break;
+					case op::stop:    stop_(); break;
+					default: break;
+					}
+				}
+			}
+		};
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	EDMAC（イーサーネット DMA）モデル @n
+					・ディスクリプター（TDLAR、RDLAR）は、ホスト上の配列を @n
+					  「space::map」で割り当てたアドレスとして扱う。@n
+					  （buf_p、next は、ホストのポインター）@n
+					・EDTRR が有効な間、「step」で、ワイヤー速度（プリアンブル、@n
+					  CRC、IPG を含む）に合わせて、TACT のフレームを順番に送信し、@n
+					  TACT を落す。全て送信したら EDTRR を０にする。@n
+					・送信完了毎に EESR.TC を立て、TRIMD.TIS が有効なら、TWBI を @n
+					  付けたディスクリプターでは EESR.TWB も立てる。@n
+					・「recv」で与えたフレームは、RACT のディスクリプターに書いて @n
+					  RACT を落し、EESR.FR を立てる。空きが無ければ捨てる。@n
+					・EDMR.SWR で、EDTRR、EDRRR、EESR、EESIPR、TRIMD を０にする。@n
+					・EESR は、１を書いたビットを落す。EESIPR で許可したビットが @n
+					  立ったら、割り込みを発生する。@n
+					・「hold」の間は、割り込みを保留する。（CPU が他の割り込みを @n
+					  処理している間に、フレームが届いた状態）
+			@param[in]	EDMAC	EDMAC 型
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		template <class EDMAC>
+		class edmac_model : public model {
+		public:
+			typedef std::function<void (const uint8_t*, uint32_t)> OUTPUT;
+
+		private:
+			struct desc_t {
+				uint32_t	status;
+				uint16_t	size;
+				uint16_t	bufsize;
+				volatile void*		buf_p;
+				volatile desc_t*	next;
+			} __attribute__((__packed__));
+
+			static const uint32_t ACT  = 0x80000000;
+			static const uint32_t FP1  = 0x20000000;
+			static const uint32_t FP0  = 0x10000000;
+			static const uint32_t TWBI = 0x04000000;
+
+			static const uint32_t EDMR_   = 0x00;
+			static const uint32_t EDTRR_  = 0x08;
+			static const uint32_t EDRRR_  = 0x10;
+			static const uint32_t TDLAR_  = 0x18;
+			static const uint32_t RDLAR_  = 0x20;
+			static const uint32_t EESR_   = 0x28;
+			static const uint32_t EESIPR_ = 0x30;
+			static const uint32_t TRIMD_  = 0x7C;
+
+			static const uint32_t FR_  = 1 << 18;
+			static const uint32_t TC_  = 1 << 21;
+			static const uint32_t TWB_ = 1 << 30;
+
+			uint32_t	vec_;
+			uint32_t	pclk_;
+			uint32_t	bps_;
+			OUTPUT		output_;
+
+			volatile desc_t*	tx_;
+			volatile desc_t*	rx_;
+			uint32_t	eesr_;
+			uint64_t	rem_;
+			bool		hold_;
+			bool		pend_;
+
+			uint32_t	send_num_;
+			uint32_t	recv_num_;
+			uint32_t	lost_;
+			uint32_t	intr_;
+
+			uint32_t reg_(uint32_t ofs) const noexcept { return space::peek<uint32_t>(get_org() + ofs); }
+
+			static volatile desc_t* desc_(uint32_t adr) noexcept
+			{
+				if(adr == 0) return nullptr;
+				return reinterpret_cast<volatile desc_t*>(space::ptr(adr));
+			}
+
+			void raise_() noexcept
+			{
+				if(hold_) {
+					pend_ = true;
+					return;
+				}
+				++intr_;
+				intr::raise(vec_);
+			}
+
+			void set_(uint32_t bits) noexcept
+			{
+				eesr_ |= bits;
+				space::poke<uint32_t>(get_org() + EESR_, eesr_);
+				if(reg_(EESIPR_) & bits) raise_();
+			}
+
+		public:
+			//-------------------------------------------------------------//
+			/*!
+				@brief	コンストラクター
+				@param[in]	vec		ベクター番号（グループ割り込み）
+				@param[in]	pclk	「step」のクロック周波数
+				@param[in]	bps		ワイヤー速度（標準 100Mbps）
+			*/
+			//-------------------------------------------------------------//
+			edmac_model(uint32_t vec, uint32_t pclk, uint32_t bps = 100000000) noexcept :
+				model(EDMAC::EDMR.address(), 0x80), vec_(vec), pclk_(pclk), bps_(bps),
+				output_(), tx_(nullptr), rx_(nullptr), eesr_(0), rem_(0), hold_(false), pend_(false),
+				send_num_(0), recv_num_(0), lost_(0), intr_(0) { }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	送信フレームの出力先の設定
+				@param[in]	out		出力ファンクタ（void out(const uint8_t* frame, uint32_t len)）
+			*/
+			//-------------------------------------------------------------//
+			void set_output(OUTPUT out) noexcept { output_ = out; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	割り込みの保留
+				@param[in]	hold	「false」なら、保留していた割り込みを発生
+			*/
+			//-------------------------------------------------------------//
+			void hold(bool hold) noexcept
+			{
+				hold_ = hold;
+				if(!hold_ && pend_) {
+					pend_ = false;
+					raise_();
+				}
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	フレームを受信
+				@param[in]	src		フレーム
+				@param[in]	len		バイト数
+				@return 空きが無く、捨てた場合「false」
+			*/
+			//-------------------------------------------------------------//
+			bool recv(const void* src, uint32_t len) noexcept
+			{
+				if((reg_(EDRRR_) & 1) == 0 || rx_ == nullptr || (rx_->status & ACT) == 0) {
+					++lost_;
+					return false;
+				}
+				std::memcpy(const_cast<void*>(rx_->buf_p), src, len);
+				rx_->size = len;
+				rx_->status = (rx_->status & ~ACT) | FP1 | FP0;
+				rx_ = rx_->next;
+				++recv_num_;
+				set_(FR_);
+				return true;
+			}
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	送信したフレーム数の取得
+				@return 送信したフレーム数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_send_num() const noexcept { return send_num_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	受信したフレーム数の取得
+				@return 受信したフレーム数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_recv_num() const noexcept { return recv_num_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	空きが無く、捨てたフレーム数の取得
+				@return 捨てたフレーム数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_lost() const noexcept { return lost_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	発生した割り込みの回数の取得
+				@return 割り込みの回数
+			*/
+			//-------------------------------------------------------------//
+			uint32_t get_intr() const noexcept { return intr_; }
+
+
+			//-------------------------------------------------------------//
+			/*!
+				@brief	カウンターのリセット
+			*/
+			//-------------------------------------------------------------//
+			void reset_count() noexcept
+			{
+				send_num_ = 0;
+				recv_num_ = 0;
+				lost_ = 0;
+				intr_ = 0;
+			}
+
+
+			void write(uint32_t ofs, uint32_t data, uint32_t size) override
+			{
+				switch(ofs) {
+				case EDMR_:
+					if(data & 1) {  // SWR
+						space::poke<uint32_t>(get_org() + EDMR_, data & ~1);
+						space::poke<uint32_t>(get_org() + EDTRR_, 0);
+						space::poke<uint32_t>(get_org() + EDRRR_, 0);
+						space::poke<uint32_t>(get_org() + TRIMD_, 0);
+						space::poke<uint32_t>(get_org() + EESIPR_, 0);
+						eesr_ = 0;
+						space::poke<uint32_t>(get_org() + EESR_, 0);
+						tx_ = nullptr;
+						rx_ = nullptr;
+						rem_ = 0;
+					}
+					break;
+				case TDLAR_:
+					tx_ = desc_(data);
+					break;
+				case RDLAR_:
+					rx_ = desc_(data);
+					break;
+				case EESR_:
+					eesr_ &= ~data;
+					space::poke<uint32_t>(get_org() + EESR_, eesr_);
+					break;
+				default:
+					break;
+				}
+			}
+
+
+			void step(uint32_t clk) override
+			{
+				if((reg_(EDTRR_) & 1) == 0) return;
+				rem_ += static_cast<uint64_t>(clk) * bps_;
+				while(1) {
+					if(tx_ == nullptr || (tx_->status & ACT) == 0) {
+						space::poke<uint32_t>(get_org() + EDTRR_, 0);
+						rem_ = 0;
+						break;
+					}
+					uint32_t len = tx_->bufsize;
+					// プリアンブル（８）、CRC（４）、IPG（１２）、最小フレーム長
+					uint64_t need = static_cast<uint64_t>((len < 60 ? 60 : len) + 8 + 4 + 12) * 8 * pclk_;
+					if(rem_ < need) break;
+					rem_ -= need;
+					if(output_) {
+						output_(static_cast<const uint8_t*>(const_cast<const void*>(tx_->buf_p)), len);
+					}
+					auto st = tx_->status;
+					tx_->status = st & ~ACT;
+					tx_ = tx_->next;
+					++send_num_;
+					uint32_t bits = TC_;
+					if((reg_(TRIMD_) & 1) != 0 && (st & TWBI) != 0) bits |= TWB_;  // TIS
+					set_(bits);
+				}
+			}
+		};
+	}
+}
@@ -1,7 +1,9 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	I/O ユーティリティー
+	@brief	I/O ユーティリティー @n
+			「IO_SIM」を定義すると、レジスターのアクセスは、io_sim.hpp の @n
+			シミュレーターに送られる。（ホスト上での評価用）
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2013, 2017 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -9,6 +11,14 @@
 */
 //=====================================================================//
 #include <cstdint>
+#ifdef IO_SIM
+#include "common/io_sim.hpp"
+// ホスト上では、-O0 でもリンク出来るよう、レジスター定義の静的メンバーを @n
+// インライン変数（C++17）として実体化する
+#define IO_SIM_INLINE inline
+#else
+#define IO_SIM_INLINE
+#endif
 
 namespace device {
 
@@ -22,7 +32,11 @@ namespace device {
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	inline void wr8_(address_type adr, uint8_t data) {
+#ifdef IO_SIM
+		sim::space::write<uint8_t>(adr, data);
+#else
 		*reinterpret_cast<volatile uint8_t*>(adr) = data;
+#endif
 	}
 
 
@@ -34,7 +48,11 @@ namespace device {
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	inline uint8_t rd8_(address_type adr) {
+#ifdef IO_SIM
+		return sim::space::read<uint8_t>(adr);
+#else
 		return *reinterpret_cast<volatile uint8_t*>(adr);
+#endif
 	}
 
 
@@ -46,7 +64,11 @@ namespace device {
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	inline void wr16_(address_type adr, uint16_t data) {
+#ifdef IO_SIM
+		sim::space::write<uint16_t>(adr, data);
+#else
 		*reinterpret_cast<volatile uint16_t*>(adr) = data;
+#endif
 	}
 
 
@@ -58,7 +80,11 @@ namespace device {
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	inline uint16_t rd16_(address_type adr) {
+#ifdef IO_SIM
+		return sim::space::read<uint16_t>(adr);
+#else
 		return *reinterpret_cast<volatile uint16_t*>(adr);
+#endif
 	}
 
 
@@ -70,7 +96,11 @@ namespace device {
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	inline void wr32_(address_type adr, uint32_t data) {
+#ifdef IO_SIM
+		sim::space::write<uint32_t>(adr, data);
+#else
 		*reinterpret_cast<volatile uint32_t*>(adr) = data;
+#endif
 	}
 
 
@@ -82,7 +112,67 @@ namespace device {
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	inline uint32_t rd32_(address_type adr) {
+#ifdef IO_SIM
+		return sim::space::read<uint32_t>(adr);
+#else
 		return *reinterpret_cast<volatile uint32_t*>(adr);
+#endif
+	}
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ポインターから、DMAC 等に設定するアドレスを得る @n
+				IO_SIM では、ホストのメモリーをシミュレーターの空間に割り当てる
+		@param[in]	ptr		ポインター
+		@return アドレス
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	inline address_type get_address(const volatile void* ptr) {
+#ifdef IO_SIM
+		return sim::space::map(ptr);
+#else
+		return reinterpret_cast<address_type>(ptr);
+#endif
+	}
+
+
+#ifdef IO_SIM
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ８ビット・レジスターの参照（シミュレーター用） @n
+				読み書きを rd8_/wr8_ に通して、モデルのフックを呼ぶ
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct ref8_t {
+		address_type	adr_;
+
+		operator uint8_t () const noexcept { return rd8_(adr_); }
+
+		ref8_t& operator = (uint8_t data) noexcept { wr8_(adr_, data); return *this; }
+		ref8_t& operator = (const ref8_t& t) noexcept { wr8_(adr_, t); return *this; }
+		ref8_t& operator |= (uint8_t data) noexcept { wr8_(adr_, rd8_(adr_) | data); return *this; }
+		ref8_t& operator &= (uint8_t data) noexcept { wr8_(adr_, rd8_(adr_) & data); return *this; }
+	};
+	typedef ref8_t ref8_type;
+#else
+	typedef volatile uint8_t& ref8_type;
+#endif
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  ８ビット・レジスターの参照
+		@param[in]	adr		アドレス
+		@return 参照
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	inline ref8_type ref8_(address_type adr) {
+#ifdef IO_SIM
+		return ref8_t{ adr };
+#else
+		return *reinterpret_cast<volatile uint8_t*>(adr);
+#endif
 	}
 
 
@@ -775,14 +865,14 @@ namespace device {
 		using T::operator |=;
 		using T::operator &=;
 
-		static bit_rw_t<T, bitpos::B7> B7;	///< B7 アクセス
-		static bit_rw_t<T, bitpos::B6> B6;	///< B6 アクセス
-		static bit_rw_t<T, bitpos::B5> B5;	///< B5 アクセス
-		static bit_rw_t<T, bitpos::B4> B4;	///< B4 アクセス
-		static bit_rw_t<T, bitpos::B3> B3;	///< B3 アクセス
-		static bit_rw_t<T, bitpos::B2> B2;	///< B2 アクセス
-		static bit_rw_t<T, bitpos::B1> B1;	///< B1 アクセス
-		static bit_rw_t<T, bitpos::B0> B0;	///< B0 アクセス
+		static IO_SIM_INLINE bit_rw_t<T, bitpos::B7> B7;	///< B7 アクセス
+		static IO_SIM_INLINE bit_rw_t<T, bitpos::B6> B6;	///< B6 アクセス
+		static IO_SIM_INLINE bit_rw_t<T, bitpos::B5> B5;	///< B5 アクセス
+		static IO_SIM_INLINE bit_rw_t<T, bitpos::B4> B4;	///< B4 アクセス
+		static IO_SIM_INLINE bit_rw_t<T, bitpos::B3> B3;	///< B3 アクセス
+		static IO_SIM_INLINE bit_rw_t<T, bitpos::B2> B2;	///< B2 アクセス
+		static IO_SIM_INLINE bit_rw_t<T, bitpos::B1> B1;	///< B1 アクセス
+		static IO_SIM_INLINE bit_rw_t<T, bitpos::B0> B0;	///< B0 アクセス
 	};
 
 
@@ -797,13 +887,13 @@ namespace device {
 
 		using T::operator ();
 
-		static bit_ro_t<T, bitpos::B7> B7;	///< B7 アクセス
-		static bit_ro_t<T, bitpos::B6> B6;	///< B6 アクセス
-		static bit_ro_t<T, bitpos::B5> B5;	///< B5 アクセス
-		static bit_ro_t<T, bitpos::B4> B4;	///< B4 アクセス
-		static bit_ro_t<T, bitpos::B3> B3;	///< B3 アクセス
-		static bit_ro_t<T, bitpos::B2> B2;	///< B2 アクセス
-		static bit_ro_t<T, bitpos::B1> B1;	///< B1 アクセス
-		static bit_ro_t<T, bitpos::B0> B0;	///< B0 アクセス
+		static IO_SIM_INLINE bit_ro_t<T, bitpos::B7> B7;	///< B7 アクセス
+		static IO_SIM_INLINE bit_ro_t<T, bitpos::B6> B6;	///< B6 アクセス
+		static IO_SIM_INLINE bit_ro_t<T, bitpos::B5> B5;	///< B5 アクセス
+		static IO_SIM_INLINE bit_ro_t<T, bitpos::B4> B4;	///< B4 アクセス
+		static IO_SIM_INLINE bit_ro_t<T, bitpos::B3> B3;	///< B3 アクセス
+		static IO_SIM_INLINE bit_ro_t<T, bitpos::B2> B2;	///< B2 アクセス
+		static IO_SIM_INLINE bit_ro_t<T, bitpos::B1> B1;	///< B1 アクセス
+		static IO_SIM_INLINE bit_ro_t<T, bitpos::B0> B0;	///< B0 アクセス
 	};
 }
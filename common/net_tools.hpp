@@ -13,6 +13,7 @@
 #include <random>
 #include "common/byte_order.h"
 #include "common/time.h"
+#include "common/format.hpp"
 
 #if defined(BIG_ENDIAN)
 #elif defined(LITTLE_ENDIAN)
@@ -33,6 +34,36 @@ namespace net {
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	struct tools {
 
+		typedef uint16_t __attribute__((__may_alias__)) alias16_t;
+		typedef uint32_t __attribute__((__may_alias__)) alias32_t;
+
+		// ネイティブの１６ビット値で、ビッグエンディアンの上位バイト位置に置く
+		static inline uint16_t native_high_(uint8_t v)
+		{
+#ifdef LITTLE_ENDIAN
+			return v;
+#else
+			return static_cast<uint16_t>(v) << 8;
+#endif
+		}
+
+		// ネイティブのサムをネットワーク順の値にする
+		static inline uint16_t to_net_(uint16_t v)
+		{
+#ifdef LITTLE_ENDIAN
+			return swap16(v);
+#else
+			return v;
+#endif
+		}
+
+		static inline uint16_t fold64_(uint64_t acc)
+		{
+			acc = (acc & 0xffffffff) + (acc >> 32);
+			acc = (acc & 0xffffffff) + (acc >> 32);
+			return fold_sum(static_cast<uint32_t>(acc));
+		}
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  16 ビット列変換
@@ -75,6 +106,196 @@ namespace net {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  １６ビット値のバイト入れ替え
+			@param[in]	v	値
+			@return 入れ替え後
+		*/
+		//-----------------------------------------------------------------//
+		static inline uint16_t swap16(uint16_t v)
+		{
+			return (v << 8) | (v >> 8);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  サムの折り返し（１の補数和を１６ビットにする）
+			@param[in]	sum	サム
+			@return 折り返したサム
+		*/
+		//-----------------------------------------------------------------//
+		static inline uint16_t fold_sum(uint32_t sum)
+		{
+			sum = (sum & 0xffff) + (sum >> 16);
+			sum = (sum & 0xffff) + (sum >> 16);
+			return sum;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  イーサーネット・サム（１の補数和）の計算 @n
+					・３２ビット単位で加算し、桁上がりの折り返しは最後に行う。@n
+					・結果は、ビッグエンディアンの１６ビット列としての値。@n
+					・奇数アドレスから始まるソースにも対応。
+			@param[in]	src	ソース
+			@param[in]	len	バイト数
+			@param[in]	sum	サム初期値（通常「０」）
+			@return サム（反転していない）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t partial_sum(const void* src, uint32_t len, uint32_t sum = 0)
+		{
+			const uint8_t* p = static_cast<const uint8_t*>(src);
+			bool odd = false;
+			uint16_t first = 0;
+			if((reinterpret_cast<uintptr_t>(p) & 1) != 0 && len > 0) {
+				odd = true;
+				first = *p++;
+				--len;
+			}
+			uint64_t acc = 0;
+			if((reinterpret_cast<uintptr_t>(p) & 2) != 0 && len >= 2) {
+				acc += *reinterpret_cast<const alias16_t*>(p);
+				p += 2;
+				len -= 2;
+			}
+			const alias32_t* w = reinterpret_cast<const alias32_t*>(p);
+			while(len >= 16) {
+				acc += w[0];
+				acc += w[1];
+				acc += w[2];
+				acc += w[3];
+				w += 4;
+				len -= 16;
+			}
+			while(len >= 4) {
+				acc += *w++;
+				len -= 4;
+			}
+			p = reinterpret_cast<const uint8_t*>(w);
+			if(len >= 2) {
+				acc += *reinterpret_cast<const alias16_t*>(p);
+				p += 2;
+				len -= 2;
+			}
+			if(len > 0) {
+				acc += native_high_(*p);
+			}
+			uint16_t n = fold64_(acc);
+			if(odd) {  // ずれた位置で加算したので、入れ替えて先頭バイトを加える
+				n = fold_sum(static_cast<uint32_t>(swap16(n)) + native_high_(first));
+			}
+			return fold_sum(static_cast<uint32_t>(to_net_(n)) + sum);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コピーしながら、イーサーネット・サム（１の補数和）を計算 @n
+					※ペイロードを送信フレームに転送する場合などに使う
+			@param[out]	dst	コピー先
+			@param[in]	src	ソース
+			@param[in]	len	バイト数
+			@param[in]	sum	サム初期値（通常「０」）
+			@return サム（反転していない）
+		*/
+		//-----------------------------------------------------------------//
+		static uint16_t copy_sum(void* dst, const void* src, uint32_t len, uint32_t sum = 0)
+		{
+			uint8_t* d = static_cast<uint8_t*>(dst);
+			const uint8_t* s = static_cast<const uint8_t*>(src);
+			// コピー先が３２ビット境界になるまでは、バイト単位
+			uint32_t head = (4 - (reinterpret_cast<uintptr_t>(d) & 3)) & 3;
+			if(head > len) head = len;
+			for(uint32_t i = 0; i < head; ++i) {
+				d[i] = s[i];
+			}
+			sum = partial_sum(d, head, sum);
+			d += head;
+			s += head;
+			len -= head;
+
+			uint64_t acc = 0;
+			uint32_t words = len >> 2;
+			alias32_t* dw = reinterpret_cast<alias32_t*>(d);
+			if((reinterpret_cast<uintptr_t>(s) & 3) == 0) {
+				const alias32_t* sw = reinterpret_cast<const alias32_t*>(s);
+				for(uint32_t i = 0; i < words; ++i) {
+					uint32_t v = sw[i];
+					dw[i] = v;
+					acc += v;
+				}
+			} else {
+				for(uint32_t i = 0; i < words; ++i) {
+					uint32_t v;
+					std::memcpy(&v, &s[i * 4], 4);
+					dw[i] = v;
+					acc += v;
+				}
+			}
+			uint16_t n = to_net_(fold64_(acc));
+			if(head & 1) n = swap16(n);  // 奇数オフセットから始まった場合
+			sum = fold_sum(sum + n);
+
+			d += words * 4;
+			s += words * 4;
+			len &= 3;
+			for(uint32_t i = 0; i < len; ++i) {
+				d[i] = s[i];
+			}
+			if(len > 0) {
+				n = partial_sum(d, len);
+				if(head & 1) n = swap16(n);
+				sum = fold_sum(sum + n);
+			}
+			return sum;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  チェック・サムの差分更新（RFC 1624） @n
+					１６ビットのフィールドが変化した場合に、全体を再計算せずに更新する。
+			@param[in]	csum	元のチェック・サム
+			@param[in]	org		元のフィールド値
+			@param[in]	val		新しいフィールド値
+			@return 新しいチェック・サム
+		*/
+		//-----------------------------------------------------------------//
+		static inline uint16_t update_sum(uint16_t csum, uint16_t org, uint16_t val)
+		{
+			// HC' = ~(~HC + ~m + m')
+			uint32_t sum = static_cast<uint16_t>(~csum);
+			sum += static_cast<uint16_t>(~org);
+			sum += val;
+			return ~fold_sum(sum);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  チェック・サムの差分更新（RFC 1624、３２ビットフィールド）@n
+					※IP アドレス、シーケンス番号などに使う
+			@param[in]	csum	元のチェック・サム
+			@param[in]	org		元のフィールド値
+			@param[in]	val		新しいフィールド値
+			@return 新しいチェック・サム
+		*/
+		//-----------------------------------------------------------------//
+		static inline uint16_t update_sum32(uint16_t csum, uint32_t org, uint32_t val)
+		{
+			uint32_t sum = static_cast<uint16_t>(~csum);
+			sum += static_cast<uint16_t>(~(org >> 16));
+			sum += static_cast<uint16_t>(~org);
+			sum += val >> 16;
+			sum += val & 0xffff;
+			return ~fold_sum(sum);
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  イーサーネット・チェック・サムの計算
@@ -86,21 +307,7 @@ namespace net {
 		//-----------------------------------------------------------------//
 		static uint16_t calc_sum(const void* src, uint16_t len, uint16_t sumorg = 0)
 		{
-			const uint8_t* d = static_cast<const uint8_t*>(src);
-			uint32_t sum = sumorg;
-			bool mod = false;
-			if(len & 1) {
-				len &= 0xfffe;
-				mod = true;
-			}
-			for(uint16_t i = 0; i < len; i += 2) {
-				sum += (d[0] << 8) | d[1];
-				d += 2;
-			}
-			if(mod) {
-				sum += d[0] << 8;
-			}
-			return ~((sum & 0xffff) + (sum >> 16));
+			return ~partial_sum(src, len, sumorg);
 		}
 
 
@@ -1,691 +1,1135 @@
-#pragma once
-//=====================================================================//
-/*!	@file
-	@brief	NMEA デコード・クラス（GPS 測位コードパース）@n
-			for GTPA013 @n
-			初期ボーレートは９６００で行う。
-    @author 平松邦仁 (hira@rvf-rc45.net)
-	@copyright	Copyright (C) 2016, 2019 Kunihito Hiramatsu @n
-				Released under the MIT license @n
-				https://github.com/hirakuni45/RX/blob/master/LICENSE
-*/
-//=====================================================================//
-#include <cstdint>
-#include <cstring>
-#include "common/time.h"
-#include "common/format.hpp"
-#include "common/input.hpp"
-
-namespace utils {
-
-	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	/*!
-		@brief  NMEA デコード・クラス
-		@param[in]	SCI_IO	シリアルＩ／Ｏ
-	*/
-	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class SCI_IO>
-	class nmea_dec {
-
-		static const uint32_t FAST_BAUDRATE = 57600;
-		static const uint32_t UPDATE_FAST_RATE = 10;	///< 10Hz
-
-	public:
-		static const uint32_t SINFO_MAX = 14;		///< 衛星情報の最大数
-
-		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		/*!
-			@brief  衛星パラメーター
-		*/
-		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-		struct sat_info {
-			char	no_[4] ;  		///< 衛星番号
-			char	elv_[4];	///< 衛星仰角(Elevation)、０～９０度
-			char	azi_[4];	///< 衛星方位角(Azimuth)、０～３５９度
-			char	cn_[4];		///< キャリア／ノイズ比、０～９９dB
-
-			sat_info() {
-				no_[0] = 0;
-				elv_[0] = 0;
-				azi_[0] = 0;
-				cn_[0] = 0;
-			}
-		};
-
-	private:
-		SCI_IO&		sci_;
-
-		uint16_t	sci_errc_;
-
-		uint16_t	pos_;
-		char		line_[256];
-
-		char		time_[12];  // 時間
-		char		lat_[12];   // 緯度(latitude)
-		char		ns_[2];     // 北緯、南緯
-		char		lon_[12];   // 経度(longitude)
-		char		ew_[2];     // 東経、西経
-		char		q_[2];      // 品質
-		char		satellite_[4];  // 衛星数
-		char		hq_[4];		// 水平精度低下率
-		char		alt_[6];	// 海抜高度(Altitude above sea level)
-		char		alt_unit_[2];	// 海抜高度単位
-
-		char		date_[8];   // 日付
-
-		uint16_t	sidx_;
-		sat_info	sinfo_[SINFO_MAX];	// 衛星情報
-
-		uint32_t	id_;
-		uint32_t	iid_;
-
-		uint16_t	intr_;
-		uint16_t	update_real_rate_;
-		uint16_t	update_fast_rate_;
-		uint16_t	no_recv_cnt_;
-		uint32_t	baud_real_rate_;
-		uint32_t	baud_fast_rate_;
-
-		static uint16_t word_(const char* src)
-		{
-			const char* top = src;
-			char ch;
-			while((ch = *src++) != 0) {
-				if(ch == ',' || ch == '*') return src - top;
-			}
-			return 0;
-		}
-
-		static void copy_word_(char* dst, const char* src, uint16_t len)
-		{
-			std::strncpy(dst, src, len);
-			dst[len] = 0;
-		}
-
-
-		static int32_t get_dec_(const char* t, uint16_t n = 0)
-		{
-			int32_t val = 0;
-			char ch;
-			while((ch = *t++) != 0) {
-				if('0' <= ch && ch <= '9') {
-					val *= 10;
-					val += ch - '0';
-				} else {
-					break;
-				}
-				if(n > 0) {
-					--n;
-					if(n == 0) break;
-				}
-			}
-			return val;
-		}
-
-
-		bool parse_()
-		{
-			if(line_[0] != '$') return false;
-
-			if(std::strncmp(&line_[1], "GPGGA,", 6) == 0) {
-				const char* p = &line_[7];
-				uint16_t n = 0;
-				uint16_t l;
-				while((l = word_(p)) != 0) {
-					if(n == 0) copy_word_(time_, p, l - 1);
-					else if(n == 1) copy_word_(lat_, p, l - 1);
-					else if(n == 2) copy_word_(ns_, p, l - 1);
-					else if(n == 3) copy_word_(lon_, p, l - 1);
-					else if(n == 4) copy_word_(ew_, p, l - 1);
-					else if(n == 5) copy_word_(q_, p, l - 1);
-					else if(n == 6) copy_word_(satellite_, p, l - 1);
-					else if(n == 7) copy_word_(hq_, p, l - 1);
-					else if(n == 8) copy_word_(alt_, p, l - 1);
-					else if(n == 9) copy_word_(alt_unit_, p, l - 1);
-					else {
-						break;
-					}
-					p += l;
-					++n;
-				}
-			} else if(std::strncmp(&line_[1], "GPRMC,", 6) == 0) {
-				const char* p = &line_[7];
-				uint16_t n = 0;
-				uint16_t l;
-				while((l = word_(p)) != 0) {
-					if(n == 8) copy_word_(date_, p, l - 1);
-					p += l;
-					++n;
-				}
-			} else if(std::strncmp(&line_[1], "GPGSV,", 6) == 0) {  // 衛星情報
-				const char* p = &line_[7];
-				uint16_t sidx = 0;
-				uint16_t n = 0;
-				uint16_t l;
-				while((l = word_(p)) != 0) {
-					if(n == 1) {
-						char tmp[4];
-						copy_word_(tmp, p, l - 1);
-						sidx = get_dec_(tmp);
-						sidx *= 4;
-					} else if(n >= 3) {
-						if(*(p - 1) == '*') break;
-						auto& t = sinfo_[sidx % SINFO_MAX];
-						auto mod = (n - 3) % 4;
-						if(mod == 0) {
-							copy_word_(t.no_, p, l - 1);
-						} else if(mod == 1) copy_word_(t.elv_, p, l - 1);
-						else if(mod == 2) copy_word_(t.azi_, p, l - 1);
-						else if(mod == 3) {
-							copy_word_(t.cn_, p, l - 1);
-							++sidx;
-						}
-					}
-					p += l;
-					++n;
-				}
-				++iid_;
-			} else if(std::strncmp(&line_[1], "GPVTG,", 6) == 0) {
-				++id_;
-				return true;
-			} else {
-//				utils::format("ND: '%s'\n") % line_;
-			}
-			return false;
-		}
-
-
-		static uint8_t sum_(const char* str)
-		{
-			if(*str == '$') ++str;
-			char ch;
-			uint8_t sum = 0;
-			while((ch = *str) != 0) {
-				if(ch == '*') break;
-				sum ^= static_cast<uint8_t>(ch);
-				++str;
-			}
-			return sum;
-		}
-
-
-		void init_()
-		{
-			no_recv_cnt_ = 0;
-			sci_.auto_crlf(false);
-			line_[0] = 0;
-			pos_ = 0;
-		}
-
-	public:
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  コンストラクター
-        */
-        //-----------------------------------------------------------------//
-		nmea_dec(SCI_IO& sci) noexcept : sci_(sci), sci_errc_(0), pos_(0), line_{ 0 },
-			time_{ 0 }, lat_{ 0 }, ns_{ 0 }, lon_{ 0 },
-			ew_{ 0 }, q_{ 0 }, satellite_{ 0 }, hq_{ 0 },
-			alt_{ 0 }, alt_unit_{ 0 }, date_{ 0 },
-			sidx_(0), id_(0), iid_(0), intr_(0),
-			update_real_rate_(0), update_fast_rate_(0),
-			no_recv_cnt_(0),
-			baud_real_rate_(0), baud_fast_rate_(0)
-		{ }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  処理ＩＤを取得
-			@return 処理ＩＤ
-        */
-        //-----------------------------------------------------------------//
-		uint32_t get_id() const noexcept { return id_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  情報処理ＩＤを取得
-			@return 情報処理ＩＤ
-        */
-        //-----------------------------------------------------------------//
-		uint32_t get_iid() const noexcept { return iid_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  時間を取得 (hhmmss.ss) 000000.00 to 235959.99
-			@return 時間
-        */
-        //-----------------------------------------------------------------//
-		const char* get_time() const noexcept { return time_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  日付を取得 (ddmmyy)
-			@return 日付
-        */
-        //-----------------------------------------------------------------//
-		const char* get_date() const noexcept { return date_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  GMT 時間「time_t」を取得（グリニッチ標準時間）
-			@return 時間「time_t」
-        */
-        //-----------------------------------------------------------------//
-		time_t get_gmtime() const noexcept {
-			if(time_[0] == 0) {
-				return 0;
-			}
-			tm ts;
-			ts.tm_sec  = get_dec_(&time_[4], 2);
-			ts.tm_min  = get_dec_(&time_[2], 2);
-			ts.tm_hour = get_dec_(&time_[0], 2);
-			ts.tm_mday = get_dec_(&date_[0], 2);
-			ts.tm_mon  = get_dec_(&date_[2], 2) - 1;
-			ts.tm_year = get_dec_(&date_[4], 2);
-			ts.tm_year += 100;  // 起点１９００年
-			return mktime_gmt(&ts);
-		}
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  緯度を取得 (dddmm.mmmm)
-			@return 緯度
-        */
-        //-----------------------------------------------------------------//
-		const char* get_lat() const noexcept { return lat_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  経度を取得 (dddmm.mmmm)
-			@return 経度
-        */
-        //-----------------------------------------------------------------//
-		const char* get_lon() const noexcept { return lon_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  軽度、緯度情報を、google などで使える形式に変換
-			@param[in]	src	ddmm.mmmm 度形式
-			@param[out]	up	ddd 度表記
-			@param[out]	dn	.dddd 度表記
-			@return 成功なら「true」
-        */
-        //-----------------------------------------------------------------//
-		static bool conv_latlon(const char* src, int32_t& up, int32_t& dn) noexcept
-		{
-			const char* p = strchr(src, '.');
-			if(p == nullptr) return false;
-			if((p - src) < 3) return false;
-			p -= 2;
-			char tmp[8];
-			strncpy(tmp, src, p - src);
-			tmp[p - src] = 0;
-			if(!(utils::input("%d", tmp) % up).status()) {
-				return false;
-			}
-
-			tmp[0] = p[0];
-			tmp[1] = p[1];
-			tmp[2] = p[3];
-			tmp[3] = p[4];
-			tmp[4] = p[5];
-			tmp[5] = p[6];
-			tmp[6] = 0;
-			if(!(utils::input("%d", tmp) % dn).status()) {
-				return false;
-			}
-			dn /= 60;
-			return true;
-		}
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  軽度、緯度情報を、google などで使える形式に変換
-			@param[in]	src	ddmm.mmmm 度形式
-			@param[out]	dst	ddd.dddd 度表記
-			@param[in]	len	dst のサイズ
-			@return 成功なら「true」
-        */
-        //-----------------------------------------------------------------//
-		static bool conv_latlon(const char* src, char* dst, uint32_t len) noexcept
-		{
-			if(src == nullptr || dst == nullptr || len < 8) return false;
-
-			int32_t up = 0;
-			int32_t dn = 0;
-			auto ret = conv_latlon(src, up, dn);
-			utils::sformat("%d.%d", dst, len) % up % dn;
-			return ret;
-		}
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  品質を取得
-			@return 品質
-        */
-        //-----------------------------------------------------------------//
-		const char* get_quality() const noexcept { return q_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  衛星数を取得
-			@return 衛星数
-        */
-        //-----------------------------------------------------------------//
-		int get_satellite_num() const noexcept
-		{
-			int n = 0;
-			utils::input("%d", satellite_) % n;
-			return n;
-		}
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  水平品質を取得
-			@return 水平品質
-        */
-        //-----------------------------------------------------------------//
-		const char* get_holizontal_quality() const noexcept { return hq_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  海抜高度を取得
-			@return 海抜高度
-        */
-        //-----------------------------------------------------------------//
-		const char* get_altitude() const noexcept { return alt_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  海抜高度単位を取得
-			@return 海抜高度単位
-        */
-        //-----------------------------------------------------------------//
-		const char* get_altitude_unit() const noexcept { return alt_unit_; }
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  衛星情報の取得
-			@param[in]	idx	衛星インデックス
-			@return 衛星情報
-        */
-        //-----------------------------------------------------------------//
-		const sat_info& get_satellite_info(uint16_t idx) const noexcept
-		{
-			if(idx < SINFO_MAX) {
-				return sinfo_[idx];
-			} else {
-				static sat_info si;
-				return si;
-			}
-		}
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  GPS 情報の表示
-        */
-        //-----------------------------------------------------------------//
-		void list_all() const noexcept
-		{
-			utils::format("ID: %d, IID: %d %s %s\n")
-				% get_id() % get_iid() % get_date() % get_time();
-			char lat[10];
-			if(!conv_latlon(get_lat(), lat, sizeof(lat))) {
-				return;
-			}
-			char lon[10];
-			if(!conv_latlon(get_lon(), lon, sizeof(lon))) {
-				return;
-			}
-			utils::format("(%d)LatLon: %s,%s (%s m)\n")
-				% get_satellite_num() % lat % lon % get_altitude();
-		}
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  スタート @n
-					・開始時はボーレートは「９６００ＢＰＳ」になっている。@n
-					・GPS モジュールがバッテリーバックアップされている場合、@n
-					最後に設定したボーレートになっている可能性がある。
-			@param[in]	intr	シリアルの割り込みレベル
-			@param[in]	fast	高速ボーレート
-			@param[in]	rate	更新レート（最大１０Ｈｚ）
-        */
-        //-----------------------------------------------------------------//
-		void start(uint16_t intr = 1, uint32_t fast = FAST_BAUDRATE, uint16_t rate = 10) noexcept
-		{
-			intr_ = intr;
-			baud_real_rate_ = 9600;
-			baud_fast_rate_ = fast;
-			update_real_rate_ = 1;
-			update_fast_rate_ = rate;
-			init_();
-			sci_.start(baud_real_rate_, intr);
-		}
-
-
-        //-----------------------------------------------------------------//
-        /*!
-            @brief  サービス @n
-					情報量に応じて呼ぶ（通常毎フレーム呼ぶ）
-			@return 更新されたら「true」
-        */
-        //-----------------------------------------------------------------//
-		bool service() noexcept
-		{
-			auto len = sci_.recv_length();
-			auto errc = sci_.get_error_count();
-			if(len == 0 || errc != sci_errc_) {
-				sci_errc_ = errc;
-				sci_.flush_recv();
-				++no_recv_cnt_;
-				if(no_recv_cnt_ >= (60 * 5)) {  // ５秒間受信が無い場合、ボーレートを変更
-					if(baud_real_rate_ == 9600) {  // 9600 で通信出来てないので、高速になってるかも
-///						sci_.start(fast_baud_, intr_);
-///						init_();
-///						baud_real_rate_ = baud_fast_rate_;
-					}
-					no_recv_cnt_ = 0;
-				}
-				return false;
-			}
-
-			bool ret = false;
-			if(len > 0) {
-				if(baud_real_rate_ == 9600) {  // 9600 で通信出来てる場合、高速にキック
-///					set_baudrate(fast_baud_);
-				}
-			}
-			no_recv_cnt_ = 0;
-			while(len > 0) {
-				auto ch = sci_.getch();
-				if(ch == 0x0d) {
-					line_[pos_] = 0;
-					ret = parse_();
-					pos_ = 0;
-				} else {
-					if(ch >= ' ' && ch <= 0x7f) {  // CTRL コードは無視する。
-						if(pos_ < (sizeof(line_) - 1)) {
-							line_[pos_] = ch;
-							++pos_;
-						} else {
-							pos_ = 0;
-						}
-					}
-				}
-				--len;
-			}
-			if(ret && baud_real_rate_ == baud_fast_rate_) {  // fast rate なら、10Hz にする。
-				if(update_real_rate_ == 1) {
-///					set_update_rate(UPDATE_FAST_RATE);
-				}
-			}
-			return ret;
-		}
-
-
-		//-----------------------------------------------------------------//
-		/*!
-			@breif	G.P.S. のボーレートを設定
-			@param[in]	baud	ボーレート
-		 */
-		//-----------------------------------------------------------------//
-		void set_baudrate(uint32_t baud) noexcept
-		{
-//			"PMTK251,9600",
-//			"PMTK251,14400",
-//			"PMTK251,19200",
-//			"PMTK251,38400",
-//			"PMTK251,57600",
-//			"PMTK251,115200",
-
-			if(baud_real_rate_ == baud) return;
-			baud_real_rate_ = baud;
-
-			char tmp[24];
-			utils::sformat("PMTK251,%u", tmp, sizeof(tmp)) % baud_real_rate_;
-			uint32_t sum = sum_(tmp);
-			char tmp2[24];
-			utils::sformat("$%s*%02X\r\n", tmp2, sizeof(tmp2)) % tmp % sum;
-			sci_.puts(tmp2);
-			sci_.start(baud_real_rate_, intr_);
-			init_();
-		}
-
-
-		//-----------------------------------------------------------------//
-		/*!
-			@breif	通信中のボーレートを取得
-			@return	通信中のボーレート
-		 */
-		//-----------------------------------------------------------------//
-		uint32_t get_baudrate() const noexcept { return baud_real_rate_; }
-
-
-		//-----------------------------------------------------------------//
-		/*!
-			@breif	位置更新レートの設定 @n
-					※高いレートを使う場合、事前にボーレートを高く設定する必要がある。
-			@param[in]	rate	更新レート
-			@return 成功なら「true」
-		 */
-		//-----------------------------------------------------------------//
-		bool set_update_rate(uint32_t rate) noexcept
-		{
-			if(rate < 1 || rate > 10) return false;
-
-			// "$PMTK220,1000*1F"	// 1Hz [ms]
-			// "$PMTK220,500*2B"	// 2Hz [ms]
-			// "$PMTK220,200*2C"	// 5Hz [ms]
-			// "$PMTK220,100*2F"	// 10Hz [ms]
-			char tmp[16];
-			uint32_t r = 1000 / rate;
-			utils::sformat("PMTK220,%u", tmp, sizeof(tmp)) % r;
-			uint32_t sum = sum_(tmp);
-			char tmp2[24];
-			utils::sformat("$%s*%02X\r\n", tmp2, sizeof(tmp2)) % tmp % sum;
-			sci_.puts(tmp2);
-			update_real_rate_ = rate;
-			return true;
-		}
-
-
-		//-----------------------------------------------------------------//
-		/*!
-			@breif	位置更新レートの取得
-			@return 位置更新レート
-		 */
-		//-----------------------------------------------------------------//
-		uint32_t get_update_rate() const noexcept { return update_real_rate_; }
-
-
-#if 0
-// Position fix update rate commands.
-#define PMTK_API_SET_FIX_CTL_100_MILLIHERTZ  "$PMTK300,10000,0,0,0,0*2C" // Once every 10 seconds, 100 millihertz.
-#define PMTK_API_SET_FIX_CTL_200_MILLIHERTZ  "$PMTK300,5000,0,0,0,0*18"  // Once every 5 seconds, 200 millihertz.
-#define PMTK_API_SET_FIX_CTL_1HZ  "$PMTK300,1000,0,0,0,0*1C"
-#define PMTK_API_SET_FIX_CTL_5HZ  "$PMTK300,200,0,0,0,0*2F"
-// Can't fix position faster than 5 times a second!
-#endif
-
-
-#if 0
-// turn on only the second sentence (GPRMC)
-#define PMTK_SET_NMEA_OUTPUT_RMCONLY "$PMTK314,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*29"
-// turn on GPRMC and GGA
-#define PMTK_SET_NMEA_OUTPUT_RMCGGA "$PMTK314,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*28"
-// turn on ALL THE DATA
-#define PMTK_SET_NMEA_OUTPUT_ALLDATA "$PMTK314,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0*28"
-// turn off output
-#define PMTK_SET_NMEA_OUTPUT_OFF "$PMTK314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*28"
-
-// to generate your own sentences, check out the MTK command datasheet and use a checksum calculator
-// such as the awesome http://www.hhhh.org/wiml/proj/nmeaxor.html
-
-#define PMTK_LOCUS_STARTLOG  "$PMTK185,0*22"
-#define PMTK_LOCUS_STOPLOG "$PMTK185,1*23"
-#define PMTK_LOCUS_STARTSTOPACK "$PMTK001,185,3*3C"
-#define PMTK_LOCUS_QUERY_STATUS "$PMTK183*38"
-#define PMTK_LOCUS_ERASE_FLASH "$PMTK184,1*22"
-#define LOCUS_OVERLAP 0
-#define LOCUS_FULLSTOP 1
-
-#define PMTK_ENABLE_SBAS "$PMTK313,1*2E"
-#define PMTK_ENABLE_WAAS "$PMTK301,2*2E"
-
-// standby command & boot successful message
-#define PMTK_STANDBY "$PMTK161,0*28"
-// Not needed currently
-#define PMTK_STANDBY_SUCCESS "$PMTK001,161,3*36"
-#define PMTK_AWAKE "$PMTK010,002*2D"
-
-// ask for the release and version
-#define PMTK_Q_RELEASE "$PMTK605*31"
-
-// request for updates on antenna status 
-#define PGCMD_ANTENNA "$PGCMD,33,1*6C" 
-#define PGCMD_NOANTENNA "$PGCMD,33,0*6D" 
-
-// センテンス例：
-$GPGSV,3,1,12,26,72,352,28,05,65,066,37,15,50,268,35,27,33,189,37*7F
- 単語例 	説明 	意味
-3 	総GSVセンテンス数 	総GSVセンテンス数：3個
-1 	このセンテンスの番号 	3個中の１個目のセンテンス
-12 	ビュー内の総衛星数 	ビュー内の総衛星数：12個
-26 	衛星番号 	衛星番号：26
-72 	衛星仰角。00～90度 	衛星仰角：72度
-352 	衛星方位角。000～359度 	衛星方位角：352度
-28 	C/No（キャリア／ノイズ比）。00～99dB 	C/No：28dB
-05 	衛星番号 	衛星番号：05
-65 	衛星仰角。00～90度 	衛星仰角：65度
-066 	衛星方位角。000～359度 	衛星方位角：66度
-37 	C/No（キャリア／ノイズ比）。00～99dB 	C/No：37dB
-15 	衛星番号 	衛星番号：15
-50 	衛星仰角。00～90度 	衛星仰角：50度
-268 	衛星方位角。000～359度 	衛星方位角：268度
-35 	C/No（キャリア／ノイズ比）。00～99dB 	C/No：35dB
-27 	衛星番号 	衛星番号：27
-33 	衛星仰角。00～90度 	衛星仰角：33度
-189 	衛星方位角。000～359度 	衛星方位角：189度
-37 	C/No（キャリア／ノイズ比）。00～99dB 	C/No：37dB
-*7F 	チェックサム 	チェックサム値：7F
-#endif
-	};
-}
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	NMEA デコード・クラス（GPS 測位コードパース）@n
+			for GTPA013 @n
+			初期ボーレートは９６００で行う。@n
+			・受信しながら、フィールドの区切りを「０」に置き換え、その位置を @n
+			  記録する。（フィールドのコピーは行わない）@n
+			・「*hh」チェックサムが一致したセンテンスだけを受理する。@n
+			・GGA、RMC、VTG、GSA、GSV をトーカー（GP、GL、GA、GB、GQ、GN） @n
+			  に関係なく扱う。@n
+			・緯度、経度は、1e-7 度単位の整数に直接変換する。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2016, 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <cstring>
+#include "common/time.h"
+#include "common/format.hpp"
+
+namespace utils {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  NMEA デコード・クラス
+		@param[in]	SCI_IO	シリアルＩ／Ｏ
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class SCI_IO>
+	class nmea_dec {
+
+		static const uint32_t FAST_BAUDRATE = 57600;
+		static const uint32_t UPDATE_FAST_RATE = 10;	///< 10Hz
+
+	public:
+		static const uint32_t SINFO_MAX = 32;		///< 衛星情報の最大数
+		static const uint32_t LINE_MAX = 128;		///< センテンスの最大長
+		static const uint32_t FIELD_MAX = 24;		///< フィールドの最大数
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  トーカー（衛星システム）
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		enum class talker : uint8_t {
+			GP,		///< GPS
+			GL,		///< GLONASS
+			GA,		///< Galileo
+			GB,		///< BeiDou（BD）
+			GQ,		///< QZSS（QZ）
+			GN,		///< 複数システム
+			OTHER,	///< その他
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  衛星パラメーター
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct sat_info {
+			uint16_t	no_;	///< 衛星番号
+			uint16_t	azi_;	///< 衛星方位角(Azimuth)、０～３５９度
+			int8_t		elv_;	///< 衛星仰角(Elevation)、０～９０度
+			uint8_t		cn_;	///< キャリア／ノイズ比、０～９９dB（追尾していない場合０）
+			talker		tk_;	///< 衛星システム
+
+			sat_info() noexcept : no_(0), azi_(0), elv_(0), cn_(0), tk_(talker::OTHER) { }
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  受信カウンター
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct counter_t {
+			uint32_t	sentence_;		///< 受理したセンテンス
+			uint32_t	sum_error_;		///< チェックサム・エラー
+			uint32_t	format_error_;	///< 形式エラー（チェックサム無し、長すぎる、途中で途切れた）
+			uint32_t	ignore_;		///< 対応していないセンテンス
+
+			counter_t() noexcept : sentence_(0), sum_error_(0), format_error_(0), ignore_(0) { }
+		};
+
+	private:
+		// センテンス（フィールドの区切りは「０」に置き換えてある）
+		struct sentence_t {
+			char		line_[LINE_MAX];
+			uint8_t		ofs_[FIELD_MAX];
+			uint8_t		num_;
+
+			sentence_t() noexcept : line_{ 0 }, ofs_{ 0 }, num_(0) { }
+
+			const char* at(uint32_t n) const noexcept {
+				if(n >= num_) return "";
+				return &line_[ofs_[n]];
+			}
+		};
+
+		enum class state : uint8_t {
+			IDLE,	///< 「$」待ち
+			BODY,	///< 本体
+			SUM_H,	///< チェックサム上位
+			SUM_L,	///< チェックサム下位
+			END,	///< CR/LF 待ち
+		};
+
+		// 受理したセンテンスを保持する種類
+		enum class keep : uint8_t { GGA, RMC, VTG, GSA, NUM };
+		static const uint8_t TALKER_NUM = static_cast<uint8_t>(talker::OTHER) + 1;
+
+		SCI_IO&		sci_;
+
+		uint16_t	sci_errc_;
+
+		// 受信中のセンテンスと、受理したセンテンスは、インデックスを交換するだけ
+		sentence_t	sent_[static_cast<uint8_t>(keep::NUM) + 1];
+		uint8_t		recv_;
+		uint8_t		keep_[static_cast<uint8_t>(keep::NUM)];
+		uint8_t		pos_;
+		uint8_t		csum_;
+		uint8_t		rsum_;
+		state		state_;
+		bool		vtg_;
+
+		uint32_t	time_;		// UTC 時間（hhmmss）
+		uint32_t	date_;		// 日付（ddmmyy）
+		int32_t		lat_;		// 緯度（1e-7 度）
+		int32_t		lon_;		// 経度（1e-7 度）
+		int32_t		alt_;		// 海抜高度（cm）
+		uint16_t	hdop_;		// 水平精度低下率（x100）
+		uint16_t	pdop_;		// 位置精度低下率（x100）
+		uint16_t	vdop_;		// 垂直精度低下率（x100）
+		int32_t		speed_;		// 速度（km/h x100）
+		int32_t		course_;	// 進行方向（度 x100）
+		uint8_t		quality_;	// 品質
+		uint8_t		sat_num_;	// 使用衛星数
+		uint8_t		fix_mode_;	// 測位モード（1:なし、2:2D、3:3D）
+		bool		pos_ok_;
+
+		uint16_t	sidx_;
+		sat_info	sinfo_[SINFO_MAX];	// 衛星情報
+		uint8_t		view_[TALKER_NUM];	// 可視衛星数
+		uint8_t		use_[TALKER_NUM];	// 使用衛星数（GSA）
+
+		uint32_t	id_;
+		uint32_t	iid_;
+
+		counter_t	counter_;
+
+		uint16_t	intr_;
+		uint16_t	update_real_rate_;
+		uint16_t	update_fast_rate_;
+		uint16_t	no_recv_cnt_;
+		uint32_t	baud_real_rate_;
+		uint32_t	baud_fast_rate_;
+
+
+		static int32_t get_dec_(const char* t, uint16_t n = 0)
+		{
+			uint32_t val = 0;
+			char ch;
+			while((ch = *t++) != 0) {
+				if('0' <= ch && ch <= '9') {
+					val *= 10;
+					val += ch - '0';
+				} else {
+					break;
+				}
+				if(n > 0) {
+					--n;
+					if(n == 0) break;
+				}
+			}
+			return val;
+		}
+
+
+		// 小数部 frac 桁の固定小数点（切り捨て）
+		static int32_t get_fixed_(const char* t, uint8_t frac)
+		{
+			bool neg = false;
+			if(*t == '-') {
+				neg = true;
+				++t;
+			}
+			uint32_t val = 0;  // 桁あふれは折り返す
+			while(*t >= '0' && *t <= '9') {
+				val = val * 10 + (*t - '0');
+				++t;
+			}
+			uint8_t n = 0;
+			if(*t == '.') {
+				++t;
+				while(n < frac && *t >= '0' && *t <= '9') {
+					val = val * 10 + (*t - '0');
+					++t;
+					++n;
+				}
+			}
+			while(n < frac) {
+				val *= 10;
+				++n;
+			}
+			return neg ? -static_cast<int32_t>(val) : static_cast<int32_t>(val);
+		}
+
+
+		// ddmm.mmmm（dddmm.mmmm）を 1e-7 度単位に変換
+		static bool get_latlon_(const char* t, char hemi, int32_t& out)
+		{
+			if(*t < '0' || *t > '9') return false;
+
+			uint32_t dm = 0;
+			while(*t >= '0' && *t <= '9') {
+				dm = dm * 10 + (*t - '0');
+				++t;
+				if(dm >= 18100) return false;  // 180 度を超える
+			}
+			uint32_t mf = 0;  // 分の小数部（1e-7 分）
+			if(*t == '.') {
+				++t;
+				uint32_t n = 0;
+				while(n < 7 && *t >= '0' && *t <= '9') {
+					mf = mf * 10 + (*t - '0');
+					++t;
+					++n;
+				}
+				while(n < 7) {
+					mf *= 10;
+					++n;
+				}
+			}
+			uint32_t min = (dm % 100) * 10000000 + mf;
+			int32_t val = (dm / 100) * 10000000 + (min + 30) / 60;
+			if(hemi == 'S' || hemi == 'W') val = -val;
+			out = val;
+			return true;
+		}
+
+
+		// hhmmss.ss
+		static uint32_t get_time_(const char* t)
+		{
+			return get_dec_(t, 6);
+		}
+
+
+		static int8_t hex_(char ch)
+		{
+			if(ch >= '0' && ch <= '9') return ch - '0';
+			if(ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+			if(ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+			return -1;
+		}
+
+
+		static talker get_talker_(const char* t)
+		{
+			if(t[0] == 'G') {
+				switch(t[1]) {
+				case 'P': return talker::GP;
+				case 'L': return talker::GL;
+				case 'A': return talker::GA;
+				case 'B': return talker::GB;
+				case 'Q': return talker::GQ;
+				case 'N': return talker::GN;
+				default: break;
+				}
+			} else if(t[0] == 'B' && t[1] == 'D') {
+				return talker::GB;
+			} else if(t[0] == 'Q' && t[1] == 'Z') {
+				return talker::GQ;
+			}
+			return talker::OTHER;
+		}
+
+
+		const sentence_t& at_keep_(keep k) const noexcept
+		{
+			return sent_[keep_[static_cast<uint8_t>(k)]];
+		}
+
+
+		// 受信バッファと保持バッファを交換
+		void keep_recv_(keep k) noexcept
+		{
+			auto& idx = keep_[static_cast<uint8_t>(k)];
+			auto t = idx;
+			idx = recv_;
+			recv_ = t;
+		}
+
+
+		void parse_gga_(const sentence_t& s) noexcept
+		{
+			if(*s.at(1) != 0) time_ = get_time_(s.at(1));
+			quality_ = get_dec_(s.at(6));
+			sat_num_ = get_dec_(s.at(7));
+			if(*s.at(8) != 0) hdop_ = get_fixed_(s.at(8), 2);
+			alt_ = get_fixed_(s.at(9), 2);
+			int32_t lat;
+			int32_t lon;
+			pos_ok_ = quality_ != 0 && get_latlon_(s.at(2), *s.at(3), lat)
+				&& get_latlon_(s.at(4), *s.at(5), lon);
+			if(pos_ok_) {
+				lat_ = lat;
+				lon_ = lon;
+			}
+		}
+
+
+		void parse_rmc_(const sentence_t& s) noexcept
+		{
+			if(*s.at(1) != 0) time_ = get_time_(s.at(1));
+			if(*s.at(9) != 0) date_ = get_dec_(s.at(9), 6);
+			if(*s.at(2) == 'A') {
+				int32_t lat;
+				int32_t lon;
+				if(get_latlon_(s.at(3), *s.at(4), lat) && get_latlon_(s.at(5), *s.at(6), lon)) {
+					lat_ = lat;
+					lon_ = lon;
+				}
+				speed_ = static_cast<int64_t>(get_fixed_(s.at(7), 3)) * 1852 / 10000;  // knot -> km/h
+				course_ = get_fixed_(s.at(8), 2);
+			}
+		}
+
+
+		void parse_vtg_(const sentence_t& s) noexcept
+		{
+			course_ = get_fixed_(s.at(1), 2);
+			speed_ = get_fixed_(s.at(7), 2);
+		}
+
+
+		// GSA のシステムＩＤ（NMEA 4.10 以降、GN の場合に、どのシステムか）
+		static talker get_system_(const sentence_t& s, talker tk) noexcept
+		{
+			if(tk != talker::GN) return tk;
+			switch(get_dec_(s.at(18))) {
+			case 1: return talker::GP;
+			case 2: return talker::GL;
+			case 3: return talker::GA;
+			case 4: return talker::GB;
+			case 5: return talker::GQ;
+			default: return tk;
+			}
+		}
+
+
+		void parse_gsa_(const sentence_t& s, talker tk) noexcept
+		{
+			fix_mode_ = get_dec_(s.at(2));
+			uint8_t n = 0;
+			for(uint32_t i = 3; i < 15; ++i) {
+				if(*s.at(i) != 0) ++n;
+			}
+			use_[static_cast<uint8_t>(get_system_(s, tk))] = n;
+			pdop_ = get_fixed_(s.at(15), 2);
+			hdop_ = get_fixed_(s.at(16), 2);
+			vdop_ = get_fixed_(s.at(17), 2);
+		}
+
+
+		void parse_gsv_(const sentence_t& s, talker tk) noexcept
+		{
+			// 最初のメッセージで、同じシステムの衛星を取り除く
+			if(get_dec_(s.at(2)) == 1) {
+				uint16_t n = 0;
+				for(uint16_t i = 0; i < sidx_; ++i) {
+					if(sinfo_[i].tk_ != tk) {
+						sinfo_[n] = sinfo_[i];
+						++n;
+					}
+				}
+				sidx_ = n;
+			}
+			view_[static_cast<uint8_t>(tk)] = get_dec_(s.at(3));
+
+			// 衛星情報は４フィールド毎（NMEA 4.10 では、最後にシグナルＩＤが付く）
+			for(uint32_t i = 4; (i + 3) < s.num_; i += 4) {
+				if(*s.at(i) == 0) continue;
+				if(sidx_ >= SINFO_MAX) break;
+				auto& t = sinfo_[sidx_];
+				t.no_  = get_dec_(s.at(i));
+				t.elv_ = get_dec_(s.at(i + 1));
+				t.azi_ = get_dec_(s.at(i + 2));
+				t.cn_  = get_dec_(s.at(i + 3));
+				t.tk_  = tk;
+				++sidx_;
+			}
+			++iid_;
+		}
+
+
+		// センテンスの受理、１エポック分そろったら「true」
+		bool accept_() noexcept
+		{
+			++counter_.sentence_;
+
+			const auto& s = sent_[recv_];
+			const char* a = s.at(0);
+			if(std::strlen(a) != 5) {  // 独自センテンス（$PMTK... など）
+				++counter_.ignore_;
+				return false;
+			}
+			auto tk = get_talker_(a);
+			a += 2;
+			if(std::strcmp(a, "GGA") == 0) {
+				parse_gga_(s);
+				keep_recv_(keep::GGA);
+			} else if(std::strcmp(a, "RMC") == 0) {
+				parse_rmc_(s);
+				keep_recv_(keep::RMC);
+				if(!vtg_) {
+					++id_;
+					return true;
+				}
+			} else if(std::strcmp(a, "VTG") == 0) {
+				parse_vtg_(s);
+				keep_recv_(keep::VTG);
+				vtg_ = true;
+				++id_;
+				return true;
+			} else if(std::strcmp(a, "GSA") == 0) {
+				parse_gsa_(s, tk);
+				keep_recv_(keep::GSA);
+			} else if(std::strcmp(a, "GSV") == 0) {
+				parse_gsv_(s, tk);
+			} else {
+				++counter_.ignore_;
+			}
+			return false;
+		}
+
+
+		// 受信中の状態はローカルに置いて、１文字毎のメンバーの読み書きを避ける
+		template <class SRC>
+		bool scan_(SRC src, uint32_t len) noexcept
+		{
+			bool ret = false;
+			auto* s = &sent_[recv_];
+			auto st = state_;
+			auto pos = pos_;
+			auto num = s->num_;
+			auto sum = csum_;
+			auto rsum = rsum_;
+			while(len > 0) {
+				--len;
+				char ch = src();
+				if(st == state::BODY && ch != '$') {
+					if(ch == ',') {
+						sum ^= static_cast<uint8_t>(ch);
+						s->line_[pos] = 0;
+						++pos;
+						if(num < FIELD_MAX) {
+							s->ofs_[num] = pos;
+							++num;
+						}
+					} else if(ch >= ' ' && ch <= 0x7e && ch != '*') {
+						sum ^= static_cast<uint8_t>(ch);
+						s->line_[pos] = ch;
+						++pos;
+					} else if(ch == '*') {
+						s->line_[pos] = 0;
+						++pos;
+						s->num_ = num;
+						st = state::SUM_H;
+					} else {
+						++counter_.format_error_;  // 途中で途切れた
+						st = state::IDLE;
+					}
+					if(pos >= LINE_MAX) {  // 長すぎる
+						++counter_.format_error_;
+						st = state::IDLE;
+					}
+					continue;
+				}
+
+				if(ch == '$') {
+					if(st != state::IDLE) ++counter_.format_error_;
+					st = state::BODY;
+					pos = 0;
+					sum = 0;
+					s->ofs_[0] = 0;
+					num = 1;
+					continue;
+				}
+
+				if(st == state::SUM_H || st == state::SUM_L) {
+					auto h = hex_(ch);
+					if(h < 0) {
+						++counter_.format_error_;
+						st = state::IDLE;
+					} else if(st == state::SUM_H) {
+						rsum = h << 4;
+						st = state::SUM_L;
+					} else {
+						rsum |= h;
+						st = state::END;
+					}
+				} else if(st == state::END) {
+					st = state::IDLE;
+					if(ch != 0x0d && ch != 0x0a) {
+						++counter_.format_error_;
+					} else if(sum != rsum) {
+						++counter_.sum_error_;
+					} else {
+						if(accept_()) ret = true;
+						s = &sent_[recv_];
+					}
+				}
+			}
+			state_ = st;
+			pos_ = pos;
+			s->num_ = num;
+			csum_ = sum;
+			rsum_ = rsum;
+			return ret;
+		}
+
+
+		static uint8_t sum_(const char* str)
+		{
+			if(*str == '$') ++str;
+			char ch;
+			uint8_t sum = 0;
+			while((ch = *str) != 0) {
+				if(ch == '*') break;
+				sum ^= static_cast<uint8_t>(ch);
+				++str;
+			}
+			return sum;
+		}
+
+
+		void init_()
+		{
+			no_recv_cnt_ = 0;
+			sci_.auto_crlf(false);
+			state_ = state::IDLE;
+			pos_ = 0;
+		}
+
+	public:
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  コンストラクター
+        */
+        //-----------------------------------------------------------------//
+		nmea_dec(SCI_IO& sci) noexcept : sci_(sci), sci_errc_(0),
+			sent_(), recv_(static_cast<uint8_t>(keep::NUM)), keep_{ 0, 1, 2, 3 },
+			pos_(0), csum_(0), rsum_(0), state_(state::IDLE), vtg_(false),
+			time_(0), date_(0), lat_(0), lon_(0), alt_(0),
+			hdop_(0), pdop_(0), vdop_(0), speed_(0), course_(0),
+			quality_(0), sat_num_(0), fix_mode_(0), pos_ok_(false),
+			sidx_(0), sinfo_(), view_{ 0 }, use_{ 0 }, id_(0), iid_(0), counter_(), intr_(0),
+			update_real_rate_(0), update_fast_rate_(0),
+			no_recv_cnt_(0),
+			baud_real_rate_(0), baud_fast_rate_(0)
+		{ }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  １文字入力 @n
+					※通常は「service」から呼ばれる
+			@param[in]	ch	文字
+			@return １エポック分の情報がそろったら「true」
+        */
+        //-----------------------------------------------------------------//
+		bool input(char ch) noexcept
+		{
+			return scan_([ch]() { return ch; }, 1);
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  カウンターの取得
+			@return カウンター
+        */
+        //-----------------------------------------------------------------//
+		const counter_t& get_counter() const noexcept { return counter_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  カウンターのリセット
+        */
+        //-----------------------------------------------------------------//
+		void reset_counter() noexcept { counter_ = counter_t(); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  処理ＩＤを取得
+			@return 処理ＩＤ
+        */
+        //-----------------------------------------------------------------//
+		uint32_t get_id() const noexcept { return id_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  情報処理ＩＤを取得
+			@return 情報処理ＩＤ
+        */
+        //-----------------------------------------------------------------//
+		uint32_t get_iid() const noexcept { return iid_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  時間を取得 (hhmmss.ss) 000000.00 to 235959.99
+			@return 時間
+        */
+        //-----------------------------------------------------------------//
+		const char* get_time() const noexcept { return at_keep_(keep::GGA).at(1); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  日付を取得 (ddmmyy)
+			@return 日付
+        */
+        //-----------------------------------------------------------------//
+		const char* get_date() const noexcept { return at_keep_(keep::RMC).at(9); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  GMT 時間「time_t」を取得（グリニッチ標準時間）
+			@return 時間「time_t」
+        */
+        //-----------------------------------------------------------------//
+		time_t get_gmtime() const noexcept {
+			if(date_ == 0) {
+				return 0;
+			}
+			tm ts;
+			ts.tm_sec  = time_ % 100;
+			ts.tm_min  = (time_ / 100) % 100;
+			ts.tm_hour = time_ / 10000;
+			ts.tm_mday = date_ / 10000;
+			ts.tm_mon  = (date_ / 100) % 100 - 1;
+			ts.tm_year = date_ % 100;
+			ts.tm_year += 100;  // 起点１９００年
+			return mktime_gmt(&ts);
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  緯度を取得 (dddmm.mmmm)
+			@return 緯度
+        */
+        //-----------------------------------------------------------------//
+		const char* get_lat() const noexcept { return at_keep_(keep::GGA).at(2); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  経度を取得 (dddmm.mmmm)
+			@return 経度
+        */
+        //-----------------------------------------------------------------//
+		const char* get_lon() const noexcept { return at_keep_(keep::GGA).at(4); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  緯度を取得（南緯は負）
+			@return 緯度（1e-7 度）
+        */
+        //-----------------------------------------------------------------//
+		int32_t get_lat_e7() const noexcept { return lat_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  経度を取得（西経は負）
+			@return 経度（1e-7 度）
+        */
+        //-----------------------------------------------------------------//
+		int32_t get_lon_e7() const noexcept { return lon_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  位置が有効か（GGA の品質が０以外）
+			@return 有効なら「true」
+        */
+        //-----------------------------------------------------------------//
+		bool is_position() const noexcept { return pos_ok_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  軽度、緯度情報を、google などで使える形式に変換
+			@param[in]	src	ddmm.mmmm 度形式
+			@param[out]	up	ddd 度表記
+			@param[out]	dn	.dddd 度表記
+			@return 成功なら「true」
+        */
+        //-----------------------------------------------------------------//
+		static bool conv_latlon(const char* src, int32_t& up, int32_t& dn) noexcept
+		{
+			if(std::strchr(src, '.') == nullptr) return false;
+			int32_t val;
+			if(!get_latlon_(src, 'N', val)) return false;
+			up = val / 10000000;
+			dn = (val % 10000000) / 1000;
+			return true;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  軽度、緯度情報を、google などで使える形式に変換
+			@param[in]	src	ddmm.mmmm 度形式
+			@param[out]	dst	ddd.dddd 度表記
+			@param[in]	len	dst のサイズ
+			@return 成功なら「true」
+        */
+        //-----------------------------------------------------------------//
+		static bool conv_latlon(const char* src, char* dst, uint32_t len) noexcept
+		{
+			if(src == nullptr || dst == nullptr || len < 8) return false;
+
+			int32_t up = 0;
+			int32_t dn = 0;
+			auto ret = conv_latlon(src, up, dn);
+			utils::sformat("%d.%04d", dst, len) % up % dn;
+			return ret;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  品質を取得
+			@return 品質
+        */
+        //-----------------------------------------------------------------//
+		const char* get_quality() const noexcept { return at_keep_(keep::GGA).at(6); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  衛星数を取得
+			@return 衛星数
+        */
+        //-----------------------------------------------------------------//
+		int get_satellite_num() const noexcept { return sat_num_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  水平品質を取得
+			@return 水平品質
+        */
+        //-----------------------------------------------------------------//
+		const char* get_holizontal_quality() const noexcept { return at_keep_(keep::GGA).at(8); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  海抜高度を取得
+			@return 海抜高度
+        */
+        //-----------------------------------------------------------------//
+		const char* get_altitude() const noexcept { return at_keep_(keep::GGA).at(9); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  海抜高度単位を取得
+			@return 海抜高度単位
+        */
+        //-----------------------------------------------------------------//
+		const char* get_altitude_unit() const noexcept { return at_keep_(keep::GGA).at(10); }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  海抜高度を取得
+			@return 海抜高度（cm）
+        */
+        //-----------------------------------------------------------------//
+		int32_t get_altitude_cm() const noexcept { return alt_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  精度低下率を取得
+			@param[out]	pdop	位置（x100）
+			@param[out]	hdop	水平（x100）
+			@param[out]	vdop	垂直（x100）
+        */
+        //-----------------------------------------------------------------//
+		void get_dop(uint16_t& pdop, uint16_t& hdop, uint16_t& vdop) const noexcept
+		{
+			pdop = pdop_;
+			hdop = hdop_;
+			vdop = vdop_;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  測位モードを取得（GSA）
+			@return 測位モード（1:なし、2:2D、3:3D）
+        */
+        //-----------------------------------------------------------------//
+		uint8_t get_fix_mode() const noexcept { return fix_mode_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  速度を取得（VTG、RMC）
+			@return 速度（km/h x100）
+        */
+        //-----------------------------------------------------------------//
+		int32_t get_speed() const noexcept { return speed_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  進行方向を取得（VTG、RMC）
+			@return 進行方向（真北からの角度 x100）
+        */
+        //-----------------------------------------------------------------//
+		int32_t get_course() const noexcept { return course_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  可視衛星数を取得（GSV）
+			@param[in]	tk	トーカー
+			@return 可視衛星数
+        */
+        //-----------------------------------------------------------------//
+		uint8_t get_satellite_view(talker tk) const noexcept
+		{
+			return view_[static_cast<uint8_t>(tk)];
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  使用衛星数を取得（GSA） @n
+					GN の GSA は、システムＩＤ（NMEA 4.10 以降）があれば、その @n
+					システムに数え、無ければ GN に数える。
+			@param[in]	tk	トーカー
+			@return 使用衛星数
+        */
+        //-----------------------------------------------------------------//
+		uint8_t get_satellite_use(talker tk) const noexcept
+		{
+			return use_[static_cast<uint8_t>(tk)];
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  衛星情報の数を取得
+			@return 衛星情報の数
+        */
+        //-----------------------------------------------------------------//
+		uint16_t get_satellite_info_num() const noexcept { return sidx_; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  衛星情報の取得
+			@param[in]	idx	衛星インデックス
+			@return 衛星情報
+        */
+        //-----------------------------------------------------------------//
+		const sat_info& get_satellite_info(uint16_t idx) const noexcept
+		{
+			if(idx < SINFO_MAX) {
+				return sinfo_[idx];
+			} else {
+				static sat_info si;
+				return si;
+			}
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  GPS 情報の表示
+        */
+        //-----------------------------------------------------------------//
+		void list_all() const noexcept
+		{
+			utils::format("ID: %d, IID: %d %s %s\n")
+				% get_id() % get_iid() % get_date() % get_time();
+			if(!pos_ok_) {
+				return;
+			}
+			char lat[16];
+			utils::sformat("%d.%07d", lat, sizeof(lat))
+				% (lat_ / 10000000) % ((lat_ < 0 ? -lat_ : lat_) % 10000000);
+			char lon[16];
+			utils::sformat("%d.%07d", lon, sizeof(lon))
+				% (lon_ / 10000000) % ((lon_ < 0 ? -lon_ : lon_) % 10000000);
+			utils::format("(%d)LatLon: %s,%s (%s m)\n")
+				% get_satellite_num() % lat % lon % get_altitude();
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  スタート @n
+					・開始時はボーレートは「９６００ＢＰＳ」になっている。@n
+					・GPS モジュールがバッテリーバックアップされている場合、@n
+					最後に設定したボーレートになっている可能性がある。
+			@param[in]	intr	シリアルの割り込みレベル
+			@param[in]	fast	高速ボーレート
+			@param[in]	rate	更新レート（最大１０Ｈｚ）
+        */
+        //-----------------------------------------------------------------//
+		void start(uint16_t intr = 1, uint32_t fast = FAST_BAUDRATE, uint16_t rate = 10) noexcept
+		{
+			intr_ = intr;
+			baud_real_rate_ = 9600;
+			baud_fast_rate_ = fast;
+			update_real_rate_ = 1;
+			update_fast_rate_ = rate;
+			init_();
+			sci_.start(baud_real_rate_, intr);
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  サービス @n
+					情報量に応じて呼ぶ（通常毎フレーム呼ぶ）
+			@return 更新されたら「true」
+        */
+        //-----------------------------------------------------------------//
+		bool service() noexcept
+		{
+			auto len = sci_.recv_length();
+			auto errc = sci_.get_error_count();
+			if(len == 0 || errc != sci_errc_) {
+				sci_errc_ = errc;
+				sci_.flush_recv();
+				++no_recv_cnt_;
+				if(no_recv_cnt_ >= (60 * 5)) {  // ５秒間受信が無い場合、ボーレートを変更
+					if(baud_real_rate_ == 9600) {  // 9600 で通信出来てないので、高速になってるかも
+///						sci_.start(fast_baud_, intr_);
+///						init_();
+///						baud_real_rate_ = baud_fast_rate_;
+					}
+					no_recv_cnt_ = 0;
+				}
+				return false;
+			}
+
+			bool ret = false;
+			if(len > 0) {
+				if(baud_real_rate_ == 9600) {  // 9600 で通信出来てる場合、高速にキック
+///					set_baudrate(fast_baud_);
+				}
+			}
+			no_recv_cnt_ = 0;
+			ret = scan_([this]() { return sci_.getch(); }, len);
+			if(ret && baud_real_rate_ == baud_fast_rate_) {  // fast rate なら、10Hz にする。
+				if(update_real_rate_ == 1) {
+///					set_update_rate(UPDATE_FAST_RATE);
+				}
+			}
+			return ret;
+		}
+
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@breif	G.P.S. のボーレートを設定
+			@param[in]	baud	ボーレート
+		 */
+		//-----------------------------------------------------------------//
+		void set_baudrate(uint32_t baud) noexcept
+		{
+//			"PMTK251,9600",
+//			"PMTK251,14400",
+//			"PMTK251,19200",
+//			"PMTK251,38400",
+//			"PMTK251,57600",
+//			"PMTK251,115200",
+
+			if(baud_real_rate_ == baud) return;
+			baud_real_rate_ = baud;
+
+			char tmp[24];
+			utils::sformat("PMTK251,%u", tmp, sizeof(tmp)) % baud_real_rate_;
+			uint32_t sum = sum_(tmp);
+			char tmp2[24];
+			utils::sformat("$%s*%02X\r\n", tmp2, sizeof(tmp2)) % tmp % sum;
+			sci_.puts(tmp2);
+			sci_.start(baud_real_rate_, intr_);
+			init_();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@breif	通信中のボーレートを取得
+			@return	通信中のボーレート
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t get_baudrate() const noexcept { return baud_real_rate_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@breif	位置更新レートの設定 @n
+					※高いレートを使う場合、事前にボーレートを高く設定する必要がある。
+			@param[in]	rate	更新レート
+			@return 成功なら「true」
+		 */
+		//-----------------------------------------------------------------//
+		bool set_update_rate(uint32_t rate) noexcept
+		{
+			if(rate < 1 || rate > 10) return false;
+
+			// "$PMTK220,1000*1F"	// 1Hz [ms]
+			// "$PMTK220,500*2B"	// 2Hz [ms]
+			// "$PMTK220,200*2C"	// 5Hz [ms]
+			// "$PMTK220,100*2F"	// 10Hz [ms]
+			char tmp[16];
+			uint32_t r = 1000 / rate;
+			utils::sformat("PMTK220,%u", tmp, sizeof(tmp)) % r;
+			uint32_t sum = sum_(tmp);
+			char tmp2[24];
+			utils::sformat("$%s*%02X\r\n", tmp2, sizeof(tmp2)) % tmp % sum;
+			sci_.puts(tmp2);
+			update_real_rate_ = rate;
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@breif	位置更新レートの取得
+			@return 位置更新レート
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t get_update_rate() const noexcept { return update_real_rate_; }
+
+
+#if 0
+// Position fix update rate commands.
+#define PMTK_API_SET_FIX_CTL_100_MILLIHERTZ  "$PMTK300,10000,0,0,0,0*2C" // Once every 10 seconds, 100 millihertz.
+#define PMTK_API_SET_FIX_CTL_200_MILLIHERTZ  "$PMTK300,5000,0,0,0,0*18"  // Once every 5 seconds, 200 millihertz.
+#define PMTK_API_SET_FIX_CTL_1HZ  "$PMTK300,1000,0,0,0,0*1C"
+#define PMTK_API_SET_FIX_CTL_5HZ  "$PMTK300,200,0,0,0,0*2F"
+// Can't fix position faster than 5 times a second!
+#endif
+
+
+#if 0
+// turn on only the second sentence (GPRMC)
+#define PMTK_SET_NMEA_OUTPUT_RMCONLY "$PMTK314,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*29"
+// turn on GPRMC and GGA
+#define PMTK_SET_NMEA_OUTPUT_RMCGGA "$PMTK314,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*28"
+// turn on ALL THE DATA
+#define PMTK_SET_NMEA_OUTPUT_ALLDATA "$PMTK314,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0*28"
+// turn off output
+#define PMTK_SET_NMEA_OUTPUT_OFF "$PMTK314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*28"
+
+// to generate your own sentences, check out the MTK command datasheet and use a checksum calculator
+// such as the awesome http://www.hhhh.org/wiml/proj/nmeaxor.html
+
+#define PMTK_LOCUS_STARTLOG  "$PMTK185,0*22"
+#define PMTK_LOCUS_STOPLOG "$PMTK185,1*23"
+#define PMTK_LOCUS_STARTSTOPACK "$PMTK001,185,3*3C"
+#define PMTK_LOCUS_QUERY_STATUS "$PMTK183*38"
+#define PMTK_LOCUS_ERASE_FLASH "$PMTK184,1*22"
+#define LOCUS_OVERLAP 0
+#define LOCUS_FULLSTOP 1
+
+#define PMTK_ENABLE_SBAS "$PMTK313,1*2E"
+#define PMTK_ENABLE_WAAS "$PMTK301,2*2E"
+
+// standby command & boot successful message
+#define PMTK_STANDBY "$PMTK161,0*28"
+// Not needed currently
+#define PMTK_STANDBY_SUCCESS "$PMTK001,161,3*36"
+#define PMTK_AWAKE "$PMTK010,002*2D"
+
+// ask for the release and version
+#define PMTK_Q_RELEASE "$PMTK605*31"
+
+// request for updates on antenna status 
+#define PGCMD_ANTENNA "$PGCMD,33,1*6C" 
+#define PGCMD_NOANTENNA "$PGCMD,33,0*6D" 
+
+// センテンス例：
+/*
+$GPGSV,3,1,12,26,72,352,28,05,65,066,37,15,50,268,35,27,33,189,37*7F
+ 単語例 	説明 	意味
+3 	総GSVセンテンス数 	総GSVセンテンス数：3個
+1 	このセンテンスの番号 	3個中の１個目のセンテンス
+12 	ビュー内の総衛星数 	ビュー内の総衛星数：12個
+26 	衛星番号 	衛星番号：26
+72 	衛星仰角。00～90度 	衛星仰角：72度
+352 	衛星方位角。000～359度 	衛星方位角：352度
+28 	C/No（キャリア／ノイズ比）。00～99dB 	C/No：28dB
+05 	衛星番号 	衛星番号：05
+65 	衛星仰角。00～90度 	衛星仰角：65度
+066 	衛星方位角。000～359度 	衛星方位角：66度
+37 	C/No（キャリア／ノイズ比）。00～99dB 	C/No：37dB
+15 	衛星番号 	衛星番号：15
+50 	衛星仰角。00～90度 	衛星仰角：50度
+268 	衛星方位角。000～359度 	衛星方位角：268度
+35 	C/No（キャリア／ノイズ比）。00～99dB 	C/No：35dB
+27 	衛星番号 	衛星番号：27
+33 	衛星仰角。00～90度 	衛星仰角：33度
+189 	衛星方位角。000～359度 	衛星方位角：189度
+37 	C/No（キャリア／ノイズ比）。00～99dB 	C/No：37dB
+*7F 	チェックサム 	チェックサム値：7F
+*/
+#endif
+	};
+}
@@ -147,7 +147,9 @@
 #include "RX600/glcdc.hpp"
 #include "RX600/glcdc_mgr.hpp"
 #include "RX600/drw2d.hpp"
+#ifndef IO_SIM  // DRW2D ライブラリ（dave）はホストに無い
 #include "RX600/drw2d_mgr.hpp"
+#endif
 #include "RX600/dmac_mgr.hpp"
 
 #elif defined(SIG_RX66T)
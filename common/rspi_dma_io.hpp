@@ -0,0 +1,199 @@
+#pragma once
+//=========================================================================//
+/*!	@file
+	@brief	RX グループ・RSPI I/O 制御（DMAC 転送版） @n
+			・rspi_io を継承し、ブロック単位の「send」、「recv」を DMAC で行う。@n
+			・送信用 DMAC は SPTI、受信用 DMAC は SPRI で起動し、CPU は１バイト @n
+			  毎の処理を行わない。（転送中は終了待ちのみ）@n
+			・受信時のダミー送信（0xFF）、送信時の受信データ破棄も DMAC で行う。@n
+			・短い転送（DMA_MIN 未満）は、CPU で行う。@n
+			・転送の終了待ちは、ビット・レートから求めた時間で打ち切り、 @n
+			  エラー（false）を返す。（SPI が止まっても、戻ってくる）@n
+			・SD カード（mmc_io）の SPI として、そのまま置き換えられる。@n
+			Ex: 定義例 @n
+			  typedef device::rspi_dma_io<device::RSPI, device::DMAC1, device::DMAC2> SPI; @n
+			  typedef fatfs::mmc_io<SPI, SDC_SELECT, SDC_POWER, SDC_DETECT, SDC_WPRT> MMC;
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=========================================================================//
+#include "common/rspi_io.hpp"
+
+namespace device {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  RSPI 制御クラス（DMAC 転送版）
+		@param[in]	RSPI	RSPI 定義クラス
+		@param[in]	TDMAC	送信用 DMAC 型
+		@param[in]	RDMAC	受信用 DMAC 型
+		@param[in]	PSEL	ポート候補
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class RSPI, class TDMAC, class RDMAC, port_map::option PSEL = port_map::option::FIRST>
+	class rspi_dma_io : public rspi_io<RSPI, PSEL> {
+	public:
+
+		static const uint32_t DMA_MIN = 16;		///< DMAC で転送する最小バイト数
+
+	private:
+
+		typedef rspi_io<RSPI, PSEL> BASE;
+
+		typedef dmac_mgr<TDMAC> SEND_DMAC;
+		typedef dmac_mgr<RDMAC> RECV_DMAC;
+
+		SEND_DMAC	send_dmac_;
+		RECV_DMAC	recv_dmac_;
+
+		uint8_t		dummy_send_;	///< 受信時に送る値（0xFF）
+		uint8_t		dummy_recv_;	///< 送信時の受信データ捨て場
+
+		uint32_t	timeout_;		///< 終了待ちを打ち切った回数
+
+		// len バイトの転送時間（マイクロ秒）
+		static uint32_t trans_time_(uint32_t len) noexcept
+		{
+			uint32_t div = (2 * (static_cast<uint32_t>(RSPI::SPBR()) + 1))
+				<< RSPI::SPCMD0.BRDV();
+			return len * 8 * div / (static_cast<uint32_t>(PCLK) / 1000000) + 1;
+		}
+
+		// DMAC 転送、src/dst の一方は固定（ダミー）
+		bool trans_(typename SEND_DMAC::trans_type stt, uint32_t src,
+			typename RECV_DMAC::trans_type rtt, uint32_t dst, uint32_t len) noexcept
+		{
+			// 転送時間の２倍と１ミリ秒を待つ（ビット・レートは、SPE を止める前に取る）
+			uint32_t limit = trans_time_(len) * 2 + 1000;
+
+			// バイト・アクセスに切り替え（SPDR を DMAC から８ビットで読み書きする）
+			RSPI::SPCR.SPE = 0;
+			uint8_t spdcr = RSPI::SPDCR();
+			RSPI::SPDCR = RSPI::SPDCR.SPBYT.b();
+
+			auto rxv = RSPI::get_rx_vec();
+			auto txv = RSPI::get_tx_vec();
+			ICU::IR[static_cast<uint8_t>(rxv)] = 0;
+			ICU::IR[static_cast<uint8_t>(txv)] = 0;
+			ICU::IER.enable(static_cast<uint8_t>(rxv), true);
+			ICU::IER.enable(static_cast<uint8_t>(txv), true);
+
+			recv_dmac_.trans(rxv, rtt, RSPI::SPDR.address(), dst, len);
+			send_dmac_.trans(txv, stt, src, RSPI::SPDR.address(), len);
+
+			// SPE と SPTIE を同時に許可する事で、最初の SPTI 要求を発生させる
+			RSPI::SPCR |= RSPI::SPCR.SPTIE.b() | RSPI::SPCR.SPRIE.b() | RSPI::SPCR.SPE.b();
+
+			// 最後のデータを受信すると、受信側 DMAC が停止する
+			bool ok = true;
+			while(RDMAC::DMCNT.DTE() != 0) {
+				if(limit == 0) {
+					ok = false;
+					++timeout_;
+					break;
+				}
+				--limit;
+				utils::delay::micro_second(1);
+			}
+
+			RSPI::SPCR.SPE = 0;
+			RSPI::SPCR.SPTIE = 0;
+			RSPI::SPCR.SPRIE = 0;
+			ICU::IER.enable(static_cast<uint8_t>(rxv), false);
+			ICU::IER.enable(static_cast<uint8_t>(txv), false);
+			send_dmac_.stop();
+			recv_dmac_.stop();
+
+			RSPI::SPDCR = spdcr;
+			RSPI::SPCR.SPE = 1;
+			return ok;
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+		*/
+		//-----------------------------------------------------------------//
+		rspi_dma_io() noexcept : BASE(), dummy_send_(0xff), dummy_recv_(0), timeout_(0) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ＳＤカード用設定を有効にする
+			@param[in]	speed	通信速度
+			@return エラー（速度設定範囲外）なら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool start_sdc(uint32_t speed) noexcept
+		{
+			// DMAC は、終了割り込みを使わない（ポーリングで終了を待つ）
+			send_dmac_.start();
+			recv_dmac_.start();
+			return BASE::start_sdc(speed);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  シリアル送信
+			@param[in]	src	送信ソース
+			@param[in]	size	送信サイズ
+			@return 転送が終わらなかった（タイム・アウト）場合「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool send(const void* src, uint32_t size) noexcept
+		{
+			if(size < DMA_MIN || size > 65535) {
+				BASE::send(src, size);
+				return true;
+			}
+			return trans_(SEND_DMAC::trans_type::SP_DN_8, get_address(src),
+				RECV_DMAC::trans_type::SN_DN_8, get_address(&dummy_recv_), size);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  シリアル受信
+			@param[out]	dst	受信先
+			@param[in]	size	受信サイズ
+			@return 転送が終わらなかった（タイム・アウト）場合「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool recv(void* dst, uint32_t size) noexcept
+		{
+			if(size < DMA_MIN || size > 65535) {
+				BASE::recv(dst, size);
+				return true;
+			}
+			return trans_(SEND_DMAC::trans_type::SN_DN_8, get_address(&dummy_send_),
+				RECV_DMAC::trans_type::SN_DP_8, get_address(dst), size);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  終了待ちを打ち切った回数を取得
+			@return 打ち切った回数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_timeout_count() const noexcept { return timeout_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  RSPIを無効にして、パワーダウンする
+			@param[in]	power パワーダウンをしない場合「false」
+		*/
+		//-----------------------------------------------------------------//
+		void destroy(bool power = true) noexcept
+		{
+			send_dmac_.stop(power);
+			recv_dmac_.stop(power);
+			BASE::destroy(power);
+		}
+	};
+}
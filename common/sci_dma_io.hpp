@@ -0,0 +1,560 @@
+#pragma once
+//=========================================================================//
+/*!	@file
+	@brief	RX グループ・SCI I/O 制御（DMAC 転送版） @n
+			・送信、受信とも、DMAC でバッファ（fixed_fifo）と直接やり取りする。@n
+			・送信は、FIFO の連続領域単位で DMAC 転送を行い、１バイト毎の割り込みは無い。@n
+			・受信は、DMAC のリピート転送で FIFO をリングとして書き込み、転送先アドレス @n
+			  から格納位置を求める。（受信バッファは最大 1024 バイト）@n
+			・受信の区切り（アイドル）検出は、「service()」を一定間隔で呼ぶ事で行う。@n
+			・未読データを DMAC が上書きした場合（受信オーバーフロー）、古い方から溢れた @n
+			  分を捨て、「get_overflow_count()」で回数を得られる。@n
+			・DMAC を持たないデバイス（RX24T など）では使えない。@n
+			・RS-485 半二重制御が必要な場合は、sci_io を使う。@n
+			Ex: 定義例 @n
+			  typedef utils::fixed_fifo<char, 1024> RECV_BUFF;  // 受信バッファ定義 @n
+			  typedef utils::fixed_fifo<char, 2048> SEND_BUFF;  // 送信バッファ定義 @n
+			  typedef device::sci_dma_io<device::SCI9, RECV_BUFF, SEND_BUFF, @n
+				device::DMAC1, device::DMAC2> SCI;  // SCI9 の場合 @n
+			  SCI	sci_; // 実態の宣言 @n
+			Ex: 開始例 @n
+			  uint8_t intr_level = 2;          // 割り込みレベル(2) @n
+			  sci_.start(3000000, intr_level); // ボーレート設定(3M) @n
+			Ex: スループットの計測 @n
+			  auto n = sci_.get_send_count();  // 送信済みバイト数（累積）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=========================================================================//
+#include "common/renesas.hpp"
+#include "common/vect.h"
+
+namespace device {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  SCI I/O 制御クラス（DMAC 転送版）
+		@param[in]	SCI		SCI 型
+		@param[in]	RBF		受信バッファクラス
+		@param[in]	SBF		送信バッファクラス
+		@param[in]	TDMAC	送信用 DMAC 型
+		@param[in]	RDMAC	受信用 DMAC 型
+		@param[in]	PSEL	シリアルポート選択
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class SCI, class RBF, class SBF, class TDMAC, class RDMAC,
+		port_map::option PSEL = port_map::option::FIRST>
+	class sci_dma_io {
+	public:
+		typedef SCI sci_type;
+		typedef RBF rbf_type;
+		typedef SBF sbf_type;
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	SCI 通信プロトコル型
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		enum class PROTOCOL {
+			B8_N_1S,	///< 8 ビット、No-Parity、 1 Stop Bit
+			B8_E_1S,	///< 8 ビット、Even(偶数)、1 Stop Bit
+			B8_O_1S,	///< 8 ビット、Odd (奇数)、1 Stop Bit
+			B8_N_2S,	///< 8 ビット、No-Parity、 2 Stop Bits
+			B8_E_2S,	///< 8 ビット、Even(偶数)、2 Stop Bits
+			B8_O_2S,	///< 8 ビット、Odd (奇数)、2 Stop Bits
+		};
+
+	private:
+
+		/// 送信 DMAC 終了割り込み
+		class send_task {
+		public:
+			void operator() () {
+				send_end_();
+			}
+		};
+
+		/// 受信 DMAC 終了割り込み（リピート転送の再開）
+		class recv_task {
+		public:
+			void operator() () {
+				++recv_wrap_;
+				// DMCRB は０（1024 回）になっているので、１周毎に終了する様に戻す
+				RDMAC::DMCRB = 1;
+				RDMAC::DMCNT.DTE = 1;
+			}
+		};
+
+		typedef dmac_mgr<TDMAC, send_task> SEND_DMAC;
+		typedef dmac_mgr<RDMAC, recv_task> RECV_DMAC;
+
+		static RBF	recv_;
+		static SBF	send_;
+
+		static SEND_DMAC	send_dmac_;
+		static RECV_DMAC	recv_dmac_;
+
+		static volatile uint32_t	send_len_;
+		static volatile uint32_t	send_count_;
+		static volatile uint32_t	recv_wrap_;
+
+		uint8_t		level_;
+		bool		auto_crlf_;
+
+		uint32_t	recv_org_;
+		uint32_t	recv_count_;
+		uint32_t	recv_pos_;
+		uint32_t	recv_total_;
+		uint16_t	idle_count_;
+		uint16_t	errc_;
+		uint16_t	ovfc_;
+
+		// ※マルチタスクの場合適切な実装をする
+		void sleep_() noexcept { asm("nop"); }
+
+
+		static void send_start_() noexcept
+		{
+			uint32_t len = send_.get_span();
+			if(len == 0) {
+				send_len_ = 0;
+				return;
+			}
+			if(len > 65535) len = 65535;
+			send_len_ = len;
+			send_dmac_.trans(SCI::get_tx_vec(), SEND_DMAC::trans_type::SP_DN_8,
+				get_address(send_.get_ptr()), SCI::TDR.address(), len, true);
+		}
+
+
+		static void send_end_() noexcept
+		{
+			auto len = send_len_;
+			send_.get_go(len);
+			send_count_ += len;
+			send_start_();
+		}
+
+
+		// 受信 FIFO に格納出来る数（２のべき乗のサイズなら全体、それ以外は一つ少ない）
+		static uint32_t recv_cap_() noexcept
+		{
+			uint32_t n = recv_.size();
+			return (n & (n - 1)) == 0 ? n : n - 1;
+		}
+
+
+		// DMAC の転送先アドレスから、受信 FIFO の格納位置を更新
+		void sync_recv_() noexcept
+		{
+			if(SCI::SSR.ORER()) {	///< 受信オーバランエラー状態確認
+				SCI::SSR.ORER = 0;	///< 受信オーバランエラークリア
+				++errc_;
+			}
+			// 周回数と転送先アドレスから、DMAC が書き込んだ累積数を求める
+			uint32_t wrap;
+			uint32_t pos;
+			do {
+				wrap = recv_wrap_;
+				pos = recv_dmac_.get_dst_adr() - recv_org_;
+			} while(wrap != recv_wrap_) ;
+			if(pos >= recv_.size()) pos = 0;
+			uint32_t total = wrap * recv_.size() + pos;
+			// アドレスは先頭に戻ったが、終了割り込みが未処理の場合
+			if(total < recv_total_) total += recv_.size();
+			uint32_t len = total - recv_total_;
+			recv_total_ = total;
+			if(len == 0) return;
+
+			recv_count_ += len;
+			uint32_t cap = recv_cap_();
+			uint32_t unread = recv_.length();
+			if((unread + len) <= cap) {
+				recv_.put_go(len);
+				return;
+			}
+			// 未読データが上書きされたので、古い方から、溢れた分だけ捨てる
+			++ovfc_;
+			uint32_t drop = unread + len - cap;
+			if(drop <= unread) {
+				recv_.get_go(drop);
+				recv_.put_go(len);
+			} else {
+				// 一周以上書き込まれたので、未読分は全て捨て、DMAC の位置から @n
+				// 遡って、格納出来る数だけ残す
+				recv_.get_go(unread);
+				uint32_t skip = (len - cap) % recv_.size();
+				recv_.put_go(skip);
+				recv_.get_go(skip);
+				recv_.put_go(cap);
+			}
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  コンストラクター
+			@param[in]	autocrlf	LF 時、自動で CR の送出をしない場合「false」
+		*/
+		//-----------------------------------------------------------------//
+		sci_dma_io(bool autocrlf = true) noexcept : level_(0), auto_crlf_(autocrlf),
+			recv_org_(0), recv_count_(0), recv_pos_(0), recv_total_(0), idle_count_(0),
+			errc_(0), ovfc_(0) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	エラー数の取得
+			@return エラー数
+		 */
+		//-----------------------------------------------------------------//
+		uint16_t get_error_count() const noexcept { return errc_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	受信オーバーフロー数の取得 @n
+					未読データが DMAC に上書きされ、捨てた回数
+			@return 受信オーバーフロー数
+		 */
+		//-----------------------------------------------------------------//
+		uint16_t get_overflow_count() noexcept
+		{
+			sync_recv_();
+			return ovfc_;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	LF 時、CR 自動送出
+			@param[in]	f	「false」なら無効
+		 */
+		//-----------------------------------------------------------------//
+		void auto_crlf(bool f = true) noexcept { auto_crlf_ = f; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ボーレートを設定して、SCI を有効にする
+			@param[in]	baud	ボーレート
+			@param[in]	level	割り込みレベル（DMAC 転送の為、１以上）
+			@param[in]	prot	通信プロトコル（標準は、８ビット、パリティ無し、１ストップ）
+			@return エラーなら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool start(uint32_t baud, uint8_t level, PROTOCOL prot = PROTOCOL::B8_N_1S) noexcept
+		{
+			if(level == 0) return false;
+			if(recv_.size() > RECV_DMAC::BLOCK_SIZE_MAX) return false;
+
+			level_ = level;
+			recv_.clear();
+			send_.clear();
+			recv_org_ = get_address(recv_.put_ptr());
+			send_len_ = 0;
+			send_count_ = 0;
+			recv_count_ = 0;
+			recv_pos_ = 0;
+			recv_total_ = 0;
+			recv_wrap_ = 0;
+			idle_count_ = 0;
+			errc_ = 0;
+			ovfc_ = 0;
+
+			power_mgr::turn(SCI::get_peripheral());
+
+			icu_mgr::set_level(SCI::get_peripheral(), 0);
+			SCI::SCR = 0x00;			// TE, RE disable.
+			{
+				auto tmp = SCI::SSR();
+				if(tmp & (SCI::SSR.ORER.b() | SCI::SSR.FER.b() | SCI::SSR.PER.b())) {
+					SCI::SSR = 0x00;
+				}
+			}
+
+			port_map::turn(SCI::get_peripheral(), true, PSEL);
+
+			uint32_t brr = get_sci_master_clock(SCI::get_peripheral()) / baud * 16;
+			uint8_t cks = 0;
+			while(brr > (512 << 8)) {
+				brr >>= 2;
+				++cks;
+			}
+			if(cks > 3) return false;
+			bool abcs = true;
+			if(brr > (256 << 8)) { brr /= 2; abcs = false; }
+			uint32_t mddr = ((brr & 0xff00) << 8) / brr;
+			brr >>= 8;
+
+			bool stop = 0;
+			bool pm = 0;
+			bool pe = 0;
+			switch(prot) {
+			case PROTOCOL::B8_N_1S:
+				break;
+			case PROTOCOL::B8_E_1S:
+				pe = 1;
+				break;
+			case PROTOCOL::B8_O_1S:
+				pm = 1;
+				pe = 1;
+				break;
+			case PROTOCOL::B8_N_2S:
+				stop = 1;
+				break;
+			case PROTOCOL::B8_E_2S:
+				stop = 1;
+				pe = 1;
+				break;
+			case PROTOCOL::B8_O_2S:
+				stop = 1;
+				pm = 1;
+				pe = 1;
+				break;
+			default:
+				return false;
+			}
+			SCI::SMR = SCI::SMR.CKS.b(cks) | SCI::SMR.STOP.b(stop)
+					 | SCI::SMR.PM.b(pm) | SCI::SMR.PE.b(pe);
+			bool brme = false;
+			if(mddr >= 128) brme = true;
+			SCI::SEMR = SCI::SEMR.ABCS.b(abcs) | SCI::SEMR.BRME.b(brme);
+			if(brr) --brr;
+			SCI::BRR = brr;
+			SCI::MDDR = mddr;
+
+			// 送信：DMAC 終了割り込みのみ使う
+			send_dmac_.start(level);
+			// 送信 DMAC の起動要因（TXI）を先に設定しておく事で、TIE、TE 許可時の @n
+			// 最初の TXI 要求は CPU に渡らず、最初の「trans()」（DTE = 1）まで保持される。
+			icu_mgr::set_dmac(TDMAC::get_peripheral(), SCI::get_tx_vec());
+			// 受信：RDR -> 受信バッファ（リピート転送）
+			recv_dmac_.start(SCI::get_rx_vec(), RECV_DMAC::trans_type::SN_DP_8,
+				SCI::RDR.address(), recv_org_, recv_.size(), level, false);
+
+			// TXI、RXI は DMAC の起動要因として使う
+			icu_mgr::set_level(SCI::get_peripheral(), level);
+			// TIE と TE を同時に許可する事で、最初の TXI 要求を発生させておく
+			SCI::SCR = SCI::SCR.RIE.b() | SCI::SCR.TIE.b() | SCI::SCR.TE.b() | SCI::SCR.RE.b();
+
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	BRR レジスタ値を取得
+			@return BRR レジスタ値
+		 */
+		//-----------------------------------------------------------------//
+		uint8_t get_brr() const noexcept { return SCI::BRR(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	サービス（受信アイドル検出）@n
+					一定間隔（数キャラクター時間程度）で呼び出す。
+		 */
+		//-----------------------------------------------------------------//
+		void service() noexcept
+		{
+			sync_recv_();
+			if(recv_pos_ == recv_count_) {
+				if(idle_count_ < 0xffff) ++idle_count_;
+			} else {
+				recv_pos_ = recv_count_;
+				idle_count_ = 0;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	受信アイドル・カウントの取得 @n
+					「service()」の呼び出しで、受信が無かった連続回数
+			@return 受信アイドル・カウント
+		 */
+		//-----------------------------------------------------------------//
+		uint16_t get_idle_count() const noexcept { return idle_count_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	送信済みバイト数の取得（累積）
+			@return 送信済みバイト数
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t get_send_count() const noexcept { return send_count_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	受信済みバイト数の取得（累積）
+			@return 受信済みバイト数
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t get_recv_count() noexcept
+		{
+			sync_recv_();
+			return recv_count_;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	SCI 出力バッファのサイズを返す
+			@return　バッファのサイズ
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t send_length() const noexcept { return send_.length(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ブロック出力
+			@param[in]	src	出力元
+			@param[in]	len	出力長
+		 */
+		//-----------------------------------------------------------------//
+		void write(const void* src, uint32_t len) noexcept
+		{
+			const char* p = static_cast<const char*>(src);
+			while(len > 0) {
+				uint32_t n = send_.put_span();
+				if(n == 0) {
+					if(send_len_ == 0) send_start_();
+					sleep_();
+					continue;
+				}
+				if(n > len) n = len;
+				auto dst = send_.put_ptr();
+				for(uint32_t i = 0; i < n; ++i) {
+					dst[i] = p[i];
+				}
+				send_.put_go(n);
+				p += n;
+				len -= n;
+			}
+			if(send_len_ == 0) send_start_();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	SCI 文字出力
+			@param[in]	ch	文字コード
+		 */
+		//-----------------------------------------------------------------//
+		void putch(char ch) noexcept
+		{
+			if(auto_crlf_ && ch == '\n') {
+				putch('\r');
+			}
+			write(&ch, 1);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	入力文字数を取得
+			@return	入力文字数
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t recv_length() noexcept
+		{
+			sync_recv_();
+			return recv_.length();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	入力文字を捨てる
+		 */
+		//-----------------------------------------------------------------//
+		void flush_recv() noexcept
+		{
+			sync_recv_();
+			recv_.get_go(recv_.length());
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	文字入力（ブロック関数）
+			@return 文字コード
+		 */
+		//-----------------------------------------------------------------//
+		char getch() noexcept
+		{
+			while(recv_length() == 0) sleep_();
+			return recv_.get();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ブロック入力（受信済みの分だけ）
+			@param[out]	dst	格納先
+			@param[in]	len	最大長
+			@return 取得した長さ
+		 */
+		//-----------------------------------------------------------------//
+		uint32_t read(void* dst, uint32_t len) noexcept
+		{
+			sync_recv_();
+			char* p = static_cast<char*>(dst);
+			uint32_t total = 0;
+			while(total < len) {
+				uint32_t n = recv_.get_span();
+				if(n == 0) break;
+				if(n > (len - total)) n = len - total;
+				auto src = recv_.get_ptr();
+				for(uint32_t i = 0; i < n; ++i) {
+					p[i] = src[i];
+				}
+				recv_.get_go(n);
+				p += n;
+				total += n;
+			}
+			return total;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	文字列出力
+			@param[in]	s	出力文字列
+		 */
+		//-----------------------------------------------------------------//
+		void puts(const char* s) noexcept
+		{
+			if(s == nullptr) return;
+			char ch;
+			while((ch = *s++) != 0) {
+				putch(ch);
+			}
+		}
+	};
+
+	// テンプレート関数、実態の定義
+	template<class SCI, class RBF, class SBF, class TDMAC, class RDMAC, port_map::option PSEL>
+		RBF sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::recv_;
+	template<class SCI, class RBF, class SBF, class TDMAC, class RDMAC, port_map::option PSEL>
+		SBF sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::send_;
+	template<class SCI, class RBF, class SBF, class TDMAC, class RDMAC, port_map::option PSEL>
+		typename sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::SEND_DMAC
+			sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::send_dmac_;
+	template<class SCI, class RBF, class SBF, class TDMAC, class RDMAC, port_map::option PSEL>
+		typename sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::RECV_DMAC
+			sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::recv_dmac_;
+	template<class SCI, class RBF, class SBF, class TDMAC, class RDMAC, port_map::option PSEL>
+		volatile uint32_t sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::send_len_;
+	template<class SCI, class RBF, class SBF, class TDMAC, class RDMAC, port_map::option PSEL>
+		volatile uint32_t sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::send_count_;
+	template<class SCI, class RBF, class SBF, class TDMAC, class RDMAC, port_map::option PSEL>
+		volatile uint32_t sci_dma_io<SCI, RBF, SBF, TDMAC, RDMAC, PSEL>::recv_wrap_;
+}
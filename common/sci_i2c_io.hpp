@@ -4,9 +4,11 @@
 	@brief	RX グループ SCI 簡易 I2C 制御 @n
 			※RX600 シリーズでは、グループ割り込みとして TEIx を共有する @n
 			ので、割り込みレベルには注意する事（上書きされる）@n
-			※現在、マスターモードのみ実装
+			※現在、マスターモードのみ実装 @n
+			※トランザクション（trans）は、記述子をキューに登録して、割り込みで @n
+			連続して転送する（非同期の send、recv とは、順番に処理される）
     @author 平松邦仁 (hira@rvf-rc45.net)
-	@copyright	Copyright (C) 2018 Kunihito Hiramatsu @n
+	@copyright	Copyright (C) 2018, 2020 Kunihito Hiramatsu @n
 				Released under the MIT license @n
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
@@ -14,6 +16,7 @@
 #include "common/renesas.hpp"
 #include "common/fixed_fifo.hpp"
 #include "common/vect.h"
+#include "common/i2c_trans.hpp"
 
 /// F_PCLKB はボーレートパラメーター計算に必要で、設定が無いとエラーにします。
 #ifndef F_PCLKB
@@ -49,6 +52,13 @@ namespace device {
 
 			stop_recv,		// stop for recv
 			stop,			// stop condition
+
+			trans_start,	// (trans) start condition
+			trans_send,		// (trans) send address, register, data
+			trans_restart,	// (trans) restart condition
+			trans_recv_pre,	// (trans) read address
+			trans_recv,		// (trans) recv data
+			trans_stop,		// (trans) stop condition
 		};
 
 		uint8_t		adr_;
@@ -118,6 +128,20 @@ namespace device {
 		static uint16_t	trans_len_;
 		static I2C_BUFF	i2c_buff_;
 
+		struct trans_t {
+			i2c_trans_queue		queue_;
+			i2c_trans* volatile	cur_;
+			const uint8_t*		src_;
+			uint8_t*			dst_;
+			uint16_t			len_;
+			bool				reg_;
+			bool				error_;
+			trans_t() noexcept : queue_(), cur_(nullptr), src_(nullptr), dst_(nullptr), len_(0),
+				reg_(false), error_(false) { }
+		};
+		static trans_t	trans_;
+		uint32_t	rate_;
+
 		// ※マルチタスクの場合適切な実装をする
 		void sleep_() noexcept { asm("nop"); }
 
@@ -211,15 +235,173 @@ namespace device {
 				} else {
 					SCI::SCR.TEIE = 0;
 					task_ = sci_i2c_t::task::idle;
+					trans_next_();
 				}
 				break;
 
+			case sci_i2c_t::task::trans_start:
+			case sci_i2c_t::task::trans_restart:
+				trans_address_();
+				break;
+			case sci_i2c_t::task::trans_send:
+				trans_send_();
+				break;
+			case sci_i2c_t::task::trans_recv_pre:
+				if(SCI::SISR.IICACKR() != 0) {
+					trans_.error_ = true;
+					trans_stop_();
+					break;
+				}
+				SCI::SCR.TIE = 0;
+				SCI::SIMR2.IICACKT = (trans_.len_ > 1) ? 0 : 1;
+				SCI::SCR.RIE = 1;
+				SCI::TDR = 0xff;  // dummy data
+				task_ = sci_i2c_t::task::trans_recv;
+				break;
+			case sci_i2c_t::task::trans_recv:
+				*trans_.dst_++ = SCI::RDR();
+				--trans_.len_;
+				if(trans_.len_ > 0) {
+					if(trans_.len_ == 1) {
+						SCI::SIMR2.IICACKT = 1;
+					}
+					SCI::TDR = 0xff;  // dummy data
+				} else {
+					SCI::SCR.RIE = 0;
+					trans_stop_();
+				}
+				break;
+			case sci_i2c_t::task::trans_stop:
+				SCI::SIMR3 = SCI::SIMR3.IICSCLS.b(0b11) | SCI::SIMR3.IICSDAS.b(0b11);
+				trans_finish_();
+				break;
+
 			default:
 				break;
 			}
 		}
 
 
+		// キューの先頭のトランザクションを開始（スタート・コンディション）
+		static void trans_next_() noexcept
+		{
+			if(task_ != sci_i2c_t::task::idle || trans_.cur_ != nullptr) return;
+			auto t = trans_.queue_.front();
+			if(t == nullptr) return;
+
+			t->state_ = i2c_trans::state::busy;
+			trans_.src_ = t->src_;
+			trans_.dst_ = t->dst_;
+			trans_.len_ = t->len_;
+			trans_.reg_ = t->use_reg_;
+			trans_.error_ = false;
+			trans_.cur_ = t;
+			task_ = sci_i2c_t::task::trans_start;
+			SCI::SCR.TEIE = 1;
+			SCI::SIMR3 = SCI::SIMR3.IICSTAREQ.b() |
+						 SCI::SIMR3.IICSCLS.b(0b01) | SCI::SIMR3.IICSDAS.b(0b01);
+		}
+
+
+		// スタート、リスタートの後、アドレスを送る
+		static void trans_address_() noexcept
+		{
+			SCI::SIMR3 = SCI::SIMR3.IICSCLS.b(0b00) | SCI::SIMR3.IICSDAS.b(0b00);
+			auto t = trans_.cur_;
+			SCI::SCR.TIE = 1;
+			if(t->read_ && !trans_.reg_) {
+				task_ = sci_i2c_t::task::trans_recv_pre;
+				SCI::TDR = (t->adr_ << 1) | 1;  // R/W = 1 (read)
+			} else {
+				task_ = sci_i2c_t::task::trans_send;
+				SCI::TDR = t->adr_ << 1;  // R/W = 0 (write)
+			}
+		}
+
+
+		// 送信が終わったら、読み出しならリスタート、書き込みならストップ
+		static void trans_send_() noexcept
+		{
+			if(SCI::SISR.IICACKR() != 0) {
+				trans_.error_ = true;
+				trans_stop_();
+				return;
+			}
+			auto t = trans_.cur_;
+			if(trans_.reg_) {
+				trans_.reg_ = false;
+				SCI::TDR = t->reg_;
+			} else if(!t->read_ && trans_.len_ > 0) {
+				SCI::TDR = *trans_.src_++;
+				--trans_.len_;
+			} else if(t->read_) {
+				SCI::SCR.TIE = 0;
+				task_ = sci_i2c_t::task::trans_restart;
+				SCI::SIMR3 = SCI::SIMR3.IICRSTAREQ.b() |
+							 SCI::SIMR3.IICSCLS.b(0b01) | SCI::SIMR3.IICSDAS.b(0b01);
+			} else {
+				trans_stop_();
+			}
+		}
+
+
+		static void trans_stop_() noexcept
+		{
+			SCI::SCR.TIE = 0;
+			SCI::SCR.RIE = 0;
+			SCI::SIMR2.IICACKT = 1;
+			task_ = sci_i2c_t::task::trans_stop;
+			SCI::SIMR3 = SCI::SIMR3.IICSTPREQ.b() |
+						 SCI::SIMR3.IICSCLS.b(0b01) | SCI::SIMR3.IICSDAS.b(0b01);
+		}
+
+
+		static void trans_finish_() noexcept
+		{
+			trans_.queue_.add_bits(trans_.cur_->get_bits());
+			trans_.cur_ = nullptr;
+			SCI::SCR.TEIE = 0;
+			task_ = sci_i2c_t::task::idle;
+			trans_.queue_.finish(!trans_.error_);
+			if(i2c_buff_.length() > 0) {  // send、recv を優先
+				if(i2c_buff_.get_at().dst_ == nullptr) task_ = sci_i2c_t::task::start_send;
+				else task_ = sci_i2c_t::task::start_recv;
+				state_ = 0;
+				SCI::SCR.TEIE = 1;
+				SCI::SIMR3 = SCI::SIMR3.IICSTAREQ.b() |
+							 SCI::SIMR3.IICSCLS.b(0b01) | SCI::SIMR3.IICSDAS.b(0b01);
+			} else {
+				trans_next_();
+			}
+		}
+
+
+		// 割り込みを使わない場合、キューの記述子をその場で転送する
+		void trans_poll_() noexcept
+		{
+			i2c_trans* t;
+			while((t = trans_.queue_.front()) != nullptr) {
+				t->state_ = i2c_trans::state::busy;
+				bool ok;
+				if(t->read_) {
+					// リスタートの代わりに、ストップを挟む
+					ok = true;
+					if(t->use_reg_) ok = send(t->adr_, &t->reg_, 1);
+					if(ok) ok = recv(t->adr_, t->dst_, t->len_);
+				} else if(t->use_reg_) {
+					uint8_t tmp[t->len_ + 1];
+					tmp[0] = t->reg_;
+					for(uint16_t i = 0; i < t->len_; ++i) tmp[i + 1] = t->src_[i];
+					ok = send(t->adr_, tmp, t->len_ + 1);
+				} else {
+					ok = send(t->adr_, t->src_, t->len_);
+				}
+				trans_.queue_.add_bits(t->get_bits());
+				trans_.queue_.finish(ok);
+			}
+		}
+
+
 		static INTERRUPT_FUNC void recv_task_()
 		{
 			i2c_service_();
@@ -289,7 +471,7 @@ namespace device {
 			@brief  コンストラクター
 		*/
 		//-----------------------------------------------------------------//
-		sci_i2c_io() noexcept : level_(0), error_(ERROR::NONE), i2c_loop_(0) { }
+		sci_i2c_io() noexcept : level_(0), error_(ERROR::NONE), i2c_loop_(0), rate_(0) { }
 
 
 		//-----------------------------------------------------------------//
@@ -318,6 +500,7 @@ namespace device {
 			}
 
 			uint32_t clk = static_cast<uint32_t>(spd);
+			rate_ = clk;
 			uint32_t brr = F_PCLKB * 8 / clk;
 			uint32_t mddr = ((brr & 0xff00) << 8) / brr;
 			brr >>= 8;
@@ -550,6 +733,105 @@ namespace device {
 			}
 			return true;
 		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  トランザクションの登録 @n
+					割り込みを使わない場合は、その場で転送して、タスクを呼ぶ。
+			@param[in]	t	記述子（完了するまで保持する事）
+			@return 転送中、キューが一杯、又は、読み出しが０バイトなら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool trans(i2c_trans& t) noexcept
+		{
+			if(t.read_ && t.len_ == 0) return false;
+			if(!trans_.queue_.push(t)) return false;
+
+			if(level_) trans_next_();
+			else trans_poll_();
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  定期実行の登録
+			@param[in]	t		記述子（登録中は保持する事）
+			@param[in]	period	周期（service の呼び出し回数）
+			@return 登録済みなら「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool add_periodic(i2c_trans& t, uint16_t period) noexcept
+		{
+			if(t.read_ && t.len_ == 0) return false;
+			return trans_.queue_.add(t, period);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  定期実行の解除
+			@param[in]	t		記述子
+			@return 登録されていなければ「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool remove_periodic(i2c_trans& t) noexcept { return trans_.queue_.remove(t); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  サービス（ティックを進め、周期が来た定期実行を登録する）@n
+					※一定間隔で呼ぶ事（trans と同じコンテキストから）
+			@return 登録した数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t service() noexcept
+		{
+			auto n = trans_.queue_.service();
+			if(level_) trans_next_();
+			else trans_poll_();
+			return n;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  トランザクションが転送中か検査
+			@return 転送中なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		static bool probe_trans() noexcept { return trans_.cur_ != nullptr; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  バス負荷の取得（トランザクションのみ）
+			@param[in]	ms	前回の呼び出しからの経過時間（ミリ秒）
+			@return バス負荷（0.1% 単位）
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_load(uint32_t ms) noexcept { return trans_.queue_.get_load(ms, rate_); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  トランザクション・カウンターの取得
+			@return カウンター
+		*/
+		//-----------------------------------------------------------------//
+		static const i2c_trans_queue::counter_t& get_trans_counter() noexcept
+		{
+			return trans_.queue_.get_counter();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  トランザクション・カウンターのリセット
+		*/
+		//-----------------------------------------------------------------//
+		static void reset_trans_counter() noexcept { trans_.queue_.reset_counter(); }
 	};
 
 	// テンプレート関数、実態の定義
@@ -565,4 +847,6 @@ namespace device {
 		uint16_t sci_i2c_io<SCI, RBF, SBF, PSEL>::trans_len_;
 	template<class SCI, class RBF, class SBF, port_map::option PSEL>
 		I2C_BUFF sci_i2c_io<SCI, RBF, SBF, PSEL>::i2c_buff_;
+	template<class SCI, class RBF, class SBF, port_map::option PSEL>
+		typename sci_i2c_io<SCI, RBF, SBF, PSEL>::trans_t sci_i2c_io<SCI, RBF, SBF, PSEL>::trans_;
 }
@@ -2,8 +2,7 @@
 //=========================================================================//
 /*!	@file
 	@brief	RX グループ・SCI I/O 制御 @n
-			・DMAC による転送をサポートしていませんが、必要性を感じていません。@n
-			・同期通信で、ブロック転送を行うような場合は、必要かもしれません。@n
+			・DMAC による転送が必要な場合（高速なボーレートなど）は、sci_dma_io を使う。@n
 			・RS-485 半二重通信用ポート制御を追加。@n
 			Ex: 定義例 @n
 			・受信バッファ、送信バッファの大きさは、最低１６バイトは必要でしょう。@n
@@ -13,6 +13,7 @@
 #include "common/format.hpp"
 #include "common/string_utils.hpp"
 #include "ff13c/mmc_io.hpp"
+#include "ff13c/sector_cache.hpp"
 
 namespace utils {
 
@@ -24,15 +25,22 @@ namespace utils {
 		@param[in]	POWER	SD カード電源 I/O ポートクラス
 		@param[in]	DETECT	SD カード検出 I/O ポートクラス
 		@param[in]	WP		SD カード書き込み禁止 I/O ポートクラス
+		@param[in]	RAN		先読みセクター数（０の場合、先読みしない）
+		@param[in]	MCN		メタデータ（FAT、ディレクトリー）キャッシュのセクター数
+		@param[in]	DCN		データ・キャッシュのセクター数
+		@param[in]	WBN		ライトバック・バッファのセクター数（０の場合ライトスルー）
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class SPI, class SELECT, class POWER, class DETECT, class WP = device::NULL_PORT>
+	template <class SPI, class SELECT, class POWER, class DETECT, class WP = device::NULL_PORT,
+		uint32_t RAN = 0, uint32_t MCN = 0, uint32_t DCN = 0, uint32_t WBN = 0>
 	class sdc_io {
 	public:
 
 		typedef SPI spi_type;	///< ＳＰＩ型
 
-		typedef fatfs::mmc_io<SPI, SELECT, POWER, DETECT, WP> mmc_type;	///< ＭＭＣ型
+		typedef fatfs::sector_cache<fatfs::mmc_io<SPI, SELECT, POWER, DETECT, WP, RAN>,
+			MCN, DCN, WBN> mmc_type;	///< ＭＭＣ型（セクター・キャッシュ付き）
+		typedef typename mmc_type::counter_t cache_counter_type;	///< キャッシュ・カウンター型
 
 
 		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
@@ -338,7 +346,9 @@ namespace utils {
 			dir_list_limit_(10),
 			dir_func_(nullptr), dir_todir_(false), dir_option_(nullptr),
 			mount_retry_(MOUNT_RETRY_LIMIT)
-			{ }
+		{
+			mmc_.set_meta_buff(fatfs_.win);
+		}
 
 
 		//-----------------------------------------------------------------//
@@ -762,6 +772,7 @@ namespace utils {
 				SELECT::P = 1;
 			} else if(cd_ && select_wait_ == 0) {  // unmount
 				f_mount(&fatfs_, "", 0);
+				mmc_.card_removed();  // 書き込み待ちは、取り外しが確定した時だけ捨てる
 				spi_.destroy();
 				if(POWER::BIT_POS < 32) {  // 電源制御を行なう場合
 					POWER::P = 1;
@@ -893,5 +904,22 @@ namespace utils {
 		 */
 		//-----------------------------------------------------------------//
 		mmc_type& at_mmc() { return mmc_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	セクター・キャッシュのカウンターを取得
+			@return カウンター
+		 */
+		//-----------------------------------------------------------------//
+		const cache_counter_type& get_cache_counter() const { return mmc_.get_counter(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	セクター・キャッシュのカウンターをリセット
+		 */
+		//-----------------------------------------------------------------//
+		void reset_cache_counter() { mmc_.reset_counter(); }
 	};
 }
@@ -127,7 +127,7 @@ time_t get_timezone_offset(void)
 	@return		グローバル tm 構造体のポインター
 */
 //-----------------------------------------------------------------//
-struct tm *gmtime(const time_t *tp)
+struct tm *RX_TIME_NAME(gmtime)(const time_t *tp)
 {
 	uint32_t t;
 	short	i, j, k;
@@ -173,7 +173,7 @@ struct tm *gmtime(const time_t *tp)
 	@return		tm 構造体のポインター
 */
 //-----------------------------------------------------------------//
-struct tm *localtime(const time_t *timer)
+struct tm *RX_TIME_NAME(localtime)(const time_t *timer)
 {
 	time_t t;
 
@@ -184,7 +184,7 @@ struct tm *localtime(const time_t *timer)
 // GMT から ローカル時間へ
 	t += (time_t)(timezone_offset_) * 3600;
 
-	gmtime(&t);
+	RX_TIME_NAME(gmtime)(&t);
 
 	return &time_st_;
 }
@@ -229,7 +229,7 @@ time_t mktime_gmt(const struct tm *tmp)
 	@return		GMT:1970年1月1日0時0分0秒(4:THU)からの経過時間（秒）
 */
 //-----------------------------------------------------------------//
-time_t mktime(const struct tm *tmp)
+time_t RX_TIME_NAME(mktime)(const struct tm *tmp)
 {
 	time_t	t = mktime_gmt(tmp);
 
@@ -16,6 +16,14 @@
 
 // SUN:0 MON:1 THU:2 WED:3 THU:4 FRI:5 SAT:6
 
+#ifdef IO_SIM
+// ホスト（IO_SIM）では、システムの time.h と衝突するので、struct tm は
+// システムの物を使い、gmtime、localtime、mktime は「rx_」付きの名前で実装する。
+// （システムの関数は、そのまま使える）C++ からは、名前空間「rx_time」で呼ぶ。
+#include <time.h>
+#define RX_TIME_NAME(name)	rx_##name
+#else
+#define RX_TIME_NAME(name)	name
 struct tm {
 	uint8_t		tm_sec;     /* seconds after the minute - [0,59] */
 	uint8_t		tm_min;     /* minutes after the hour - [0,59] */
@@ -27,6 +35,7 @@ struct tm {
 	uint16_t	tm_yday;    /* days since January 1 - [0,365] */
 	char		tm_isdst;   /* daylight savings time flag */
 };
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,7 +101,7 @@ time_t get_timezone_offset(void);
 	@return		グローバル tm 構造体のポインター
 */
 //-----------------------------------------------------------------//
-struct tm *gmtime(const time_t *);
+struct tm *RX_TIME_NAME(gmtime)(const time_t *);
 
 
 //-----------------------------------------------------------------//
@@ -120,7 +129,7 @@ time_t mktime_gmt(const struct tm *tmp);
 	@return		GMT:1970年1月1日0時0分0秒(4:THU)からの経過時間（秒）
 */
 //-----------------------------------------------------------------//
-time_t mktime(const struct tm *);
+time_t RX_TIME_NAME(mktime)(const struct tm *);
 
 
 //-----------------------------------------------------------------//
@@ -139,7 +148,7 @@ struct tm *get_tm(void);
 	@return		tm 構造体のポインター
 */
 //-----------------------------------------------------------------//
-struct tm *localtime(const time_t *timer);
+struct tm *RX_TIME_NAME(localtime)(const time_t *timer);
 
 
 //-----------------------------------------------------------------//
@@ -173,6 +182,18 @@ const char* get_mon(uint8_t idx);
 
 #ifdef __cplusplus
 }
+
+//-----------------------------------------------------------------//
+/*!
+	@brief	このモジュールの gmtime、localtime、mktime @n
+			ホスト（IO_SIM）でも、システムの関数では無く、こちらを呼ぶ。
+*/
+//-----------------------------------------------------------------//
+namespace rx_time {
+	inline struct tm* gmtime(const time_t* tp) { return RX_TIME_NAME(gmtime)(tp); }
+	inline struct tm* localtime(const time_t* tp) { return RX_TIME_NAME(localtime)(tp); }
+	inline time_t mktime(const struct tm* tmp) { return RX_TIME_NAME(mktime)(tmp); }
+}
 #endif
 
 #endif	// _TIME_H_
@@ -10,7 +10,11 @@
 //=====================================================================//
 #include <stdint.h>
 
+#ifdef IO_SIM
+#define INTERRUPT_FUNC
+#else
 #define INTERRUPT_FUNC __attribute__ ((interrupt))
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +45,7 @@ extern "C" {
 	//-----------------------------------------------------------------//
 	inline void turn_usermode(void)
 	{
+#ifndef IO_SIM
 		asm("mvfc psw,r1");
 		asm("or #0x00100000,r1");
 		asm("push.l r1");
@@ -54,6 +59,40 @@ extern "C" {
 		asm("nop");
 		asm("nop");
 		asm("nop");
+#endif
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	割り込みを禁止する（PSW.I を０にする）
+		@return 禁止する前の PSW（unlock_interrupt に渡す）
+	 */
+	//-----------------------------------------------------------------//
+	inline uint32_t lock_interrupt(void)
+	{
+		uint32_t psw = 0;
+#ifndef IO_SIM
+		asm volatile ("mvfc psw,%0" : "=r"(psw));
+		asm volatile ("clrpsw i" ::: "memory");
+#endif
+		return psw;
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	割り込みの状態を戻す（禁止する前に許可されていた場合だけ許可）
+		@param[in]	psw		lock_interrupt の戻り値
+	 */
+	//-----------------------------------------------------------------//
+	inline void unlock_interrupt(uint32_t psw)
+	{
+#ifndef IO_SIM
+		if(psw & 0x00010000) {
+			asm volatile ("setpsw i" ::: "memory");
+		}
+#endif
 	}
 
 #ifdef __cplusplus
@@ -3,13 +3,17 @@
 /*!	@file
 	@brief	MMC/FatFS ドライバー @n
 			SD カード、SPI/MMC モードでアクセス @n
-			FreeRTOS 対応（「RTOS」を define）
+			FreeRTOS 対応（「RTOS」を define）@n
+			・SPI に rspi_dma_io を使うと、データ・ブロックは DMAC で転送する。@n
+			・RAN に先読みセクター数を設定すると、小さな読み出しの時、連続する @n
+			  セクターをまとめて読み込み（CMD18）、次の読み出しに備える。
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2016, 2019 Kunihito Hiramatsu @n
 				Released under the MIT license @n
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
 //=====================================================================//
+#include <cstring>
 #include "ff13c/source/ff.h"
 #include "ff13c/source/diskio.h"
 #include "common/delay.hpp"
@@ -27,9 +31,10 @@ namespace fatfs {
 		@param[in]	POW		電源制御ポート・クラス
 		@param[in]	CDT		カード検出ポート・クラス
 		@param[in]	WPR		書き込み禁止ポート・クラス
+		@param[in]	RAN		先読みセクター数（０の場合、先読みしない）
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class SPI, class SEL, class POW, class CDT, class WPR>
+	template <class SPI, class SEL, class POW, class CDT, class WPR, uint32_t RAN = 0>
 	class mmc_io {
 
 		inline void lock_() {
@@ -66,6 +71,12 @@ namespace fatfs {
 		bool		mount_;
 		bool		init_port_;
 
+		BYTE		ra_buff_[RAN > 0 ? RAN * 512 : 4];	// Read-ahead buffer
+		DWORD		ra_sector_;	// Read-ahead start sector (LBA)
+		UINT		ra_count_;	// Read-ahead sector count (0: invalid)
+		DWORD		last_sector_;	// Last read start sector (LBA)
+		UINT		last_count_;	// Last read sector count (0: invalid)
+
 		// MMC/SD command (SPI mode)
 		enum class command : uint8_t {
 			CMD0 = 0,			/* GO_IDLE_STATE */
@@ -226,6 +237,27 @@ namespace fatfs {
 			return d;			/* Return with the response value */
 		}
 
+		/* 1:OK, 0:Failed */
+		/* sector: LBA */
+		int read_blocks_(BYTE* buff, DWORD sector, UINT count)
+		{
+			if (!(CardType_ & CT_BLOCK)) sector *= 512;	/* Convert LBA to byte address if needed */
+
+			/*  READ_MULTIPLE_BLOCK : READ_SINGLE_BLOCK */
+			command cmd = count > 1 ? command::CMD18 : command::CMD17;
+			if (send_cmd_(cmd, sector) == 0) {
+				do {
+					if (!rcvr_datablock_(buff, 512)) break;
+					buff += 512;
+				} while (--count) ;
+				if (cmd == command::CMD18) send_cmd_(command::CMD12, 0);	/* STOP_TRANSMISSION */
+			}
+			deselect_();
+
+			return count ? 0 : 1;
+		}
+
+
 		void start_spi_(bool fast)
 		{
 			uint32_t speed;
@@ -251,7 +283,8 @@ namespace fatfs {
 		mmc_io(SPI& spi, uint32_t limitc) noexcept :
 			spi_(spi), limitc_(limitc), Stat_(STA_NOINIT), CardType_(0),
 			select_wait_(0), mount_delay_(0), cd_(false), mount_(false),
-			init_port_(false) { }
+			init_port_(false), ra_sector_(0), ra_count_(0),
+			last_sector_(0), last_count_(0) { }
 
 
 		//-----------------------------------------------------------------//
@@ -375,6 +408,8 @@ namespace fatfs {
 #endif
 			}
 			CardType_ = ty;
+			ra_count_ = 0;
+			last_count_ = 0;
 			DSTATUS s = ty ? 0 : STA_NOINIT;
 			Stat_ = s;
 
@@ -402,20 +437,31 @@ namespace fatfs {
 		DRESULT disk_read(BYTE drv, BYTE* buff, DWORD sector, UINT count) noexcept
 		{
 			if (disk_status(drv) & STA_NOINIT) return RES_NOTRDY;
-			if (!(CardType_ & CT_BLOCK)) sector *= 512;	/* Convert LBA to byte address if needed */
 
-			/*  READ_MULTIPLE_BLOCK : READ_SINGLE_BLOCK */
-			command cmd = count > 1 ? command::CMD18 : command::CMD17;
-			if (send_cmd_(cmd, sector) == 0) {
-				do {
-					if (!rcvr_datablock_(buff, 512)) break;
-					buff += 512;
-				} while (--count) ;
-				if (cmd == command::CMD18) send_cmd_(command::CMD12, 0);	/* STOP_TRANSMISSION */
+			// 直前の読み出しに続くセクターか（シーケンシャル・アクセス）
+			bool seq = last_count_ > 0 && sector == (last_sector_ + last_count_);
+			last_sector_ = sector;
+			last_count_ = count;
+
+			if (RAN > 0 && count < RAN) {
+				// 先読みバッファにある場合
+				if (ra_count_ > 0 && sector >= ra_sector_ && (sector + count) <= (ra_sector_ + ra_count_)) {
+					std::memcpy(buff, &ra_buff_[(sector - ra_sector_) * 512], count * 512);
+					return RES_OK;
+				}
+				// シーケンシャル・アクセスの場合だけ、連続するセクターをまとめて読み込む
+				// （ランダム・アクセスで、不要なセクターを読まない）
+				ra_count_ = 0;
+				if (seq && read_blocks_(ra_buff_, sector, RAN)) {
+					ra_sector_ = sector;
+					ra_count_ = RAN;
+					std::memcpy(buff, ra_buff_, count * 512);
+					return RES_OK;
+				}
+				// ランダム・アクセス、終端を越える場合などは、要求分だけ読む
 			}
-			deselect_();
 
-			return count ? RES_ERROR : RES_OK;
+			return read_blocks_(buff, sector, count) ? RES_OK : RES_ERROR;
 		}
 
 
@@ -432,6 +478,12 @@ namespace fatfs {
 		DRESULT disk_write(BYTE drv, const BYTE* buff, DWORD sector, UINT count) noexcept
 		{
 			if (disk_status(drv) & STA_NOINIT) return RES_NOTRDY;
+
+			// 書き込み範囲と重なる先読みは無効にする
+			if (ra_count_ > 0 && sector < (ra_sector_ + ra_count_) && ra_sector_ < (sector + count)) {
+				ra_count_ = 0;
+			}
+
 			if (!(CardType_ & CT_BLOCK)) sector *= 512;	/* Convert LBA to byte address if needed */
 
 			if (count == 1) {	/* Single block write */
@@ -544,6 +596,8 @@ namespace fatfs {
 //				utils::format("Card ditect\n");
 			} else if(cd_ && select_wait_ == 0) {
 				f_mount(nullptr, "", 0);
+				ra_count_ = 0;
+				last_count_ = 0;
 				spi_.destroy();
 				if(POW::BIT_POS < 32) {
 					lock_();
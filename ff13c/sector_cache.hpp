@@ -0,0 +1,365 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	FatFS セクター・キャッシュ @n
+			ディスク・デバイス（mmc_io など）を継承し、disk_read/disk_write @n
+			の間にキャッシュを入れる。@n
+			・メタデータ（FAT、ディレクトリー）と、データで、別々の LRU プール @n
+			  を持つ。（FATFS::win への読み込みをメタデータとする）@n
+			・書き込みは、連続するセクターをバッファにまとめ、マルチブロック @n
+			  書き込みで書き出す。（f_sync、f_close の CTRL_SYNC で書き出し）@n
+			・複数セクターの読み込みは、キャッシュを通さない。（ストリーミング）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstring>
+#include <utility>
+#include "ff13c/source/ff.h"
+#include "ff13c/source/diskio.h"
+
+namespace fatfs {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  セクター・キャッシュ・テンプレートクラス
+		@param[in]	DEV		ディスク・デバイス・クラス（mmc_io など）
+		@param[in]	MCN		メタデータ・キャッシュのセクター数（０の場合無効）
+		@param[in]	DCN		データ・キャッシュのセクター数（０の場合無効）
+		@param[in]	WBN		ライトバック・バッファのセクター数（０の場合ライトスルー）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class DEV, uint32_t MCN = 0, uint32_t DCN = 0, uint32_t WBN = 0>
+	class sector_cache : public DEV {
+	public:
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief  キャッシュ・カウンター
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct counter_t {
+			uint32_t	meta_hit_;		///< メタデータ・ヒット
+			uint32_t	meta_miss_;		///< メタデータ・ミス
+			uint32_t	data_hit_;		///< データ・ヒット
+			uint32_t	data_miss_;		///< データ・ミス
+			uint32_t	write_sector_;	///< 書き込み要求セクター数
+			uint32_t	write_cmd_;		///< デバイスへの書き込み回数
+
+			counter_t() noexcept : meta_hit_(0), meta_miss_(0), data_hit_(0), data_miss_(0),
+				write_sector_(0), write_cmd_(0) { }
+		};
+
+	private:
+
+		static const UINT SS = 512;
+
+		struct line_t {
+			DWORD		sector_;
+			uint32_t	time_;
+			bool		valid_;
+		};
+
+		template <uint32_t N>
+		struct pool_t {
+			line_t	line_[N > 0 ? N : 1];
+			BYTE	buff_[N > 0 ? N * SS : 1];
+
+			void clear() noexcept {
+				for(uint32_t i = 0; i < N; ++i) line_[i].valid_ = false;
+			}
+
+			int find(DWORD sector) const noexcept {
+				for(uint32_t i = 0; i < N; ++i) {
+					if(line_[i].valid_ && line_[i].sector_ == sector) return i;
+				}
+				return -1;
+			}
+
+			// 無効、又は、最も古いライン
+			uint32_t victim() const noexcept {
+				uint32_t idx = 0;
+				for(uint32_t i = 0; i < N; ++i) {
+					if(!line_[i].valid_) return i;
+					if(line_[i].time_ < line_[idx].time_) idx = i;
+				}
+				return idx;
+			}
+
+			BYTE* at(uint32_t idx) noexcept { return &buff_[idx * SS]; }
+		};
+
+		pool_t<MCN>	meta_;
+		pool_t<DCN>	data_;
+
+		BYTE		wb_buff_[WBN > 0 ? WBN * SS : 1];
+		DWORD		wb_sector_;
+		UINT		wb_count_;
+
+		const BYTE*	meta_buff_;
+		uint32_t	time_;
+
+		counter_t	counter_;
+
+
+		// キャッシュ済みのセクターを書き込みデータで更新
+		template <uint32_t N>
+		void update_(pool_t<N>& pool, const BYTE* buff, DWORD sector, UINT count) noexcept
+		{
+			for(uint32_t i = 0; i < N; ++i) {
+				const line_t& l = pool.line_[i];
+				if(l.valid_ && l.sector_ >= sector && l.sector_ < (sector + count)) {
+					std::memcpy(pool.at(i), &buff[(l.sector_ - sector) * SS], SS);
+				}
+			}
+		}
+
+
+		DRESULT flush_() noexcept
+		{
+			if(wb_count_ == 0) return RES_OK;
+
+			auto ret = DEV::disk_write(0, wb_buff_, wb_sector_, wb_count_);
+			++counter_.write_cmd_;
+			// 書き込めなかった場合は、保持する（カードの取り外しで破棄）
+			if(ret == RES_OK) wb_count_ = 0;
+			return ret;
+		}
+
+
+		// ライトバック・バッファにあるセクターで上書き
+		void patch_(BYTE* buff, DWORD sector, UINT count) const noexcept
+		{
+			if(wb_count_ == 0) return;
+			for(UINT i = 0; i < count; ++i) {
+				DWORD s = sector + i;
+				if(s >= wb_sector_ && s < (wb_sector_ + wb_count_)) {
+					std::memcpy(&buff[i * SS], &wb_buff_[(s - wb_sector_) * SS], SS);
+				}
+			}
+		}
+
+
+		template <uint32_t N>
+		DRESULT read_pool_(pool_t<N>& pool, BYTE* buff, DWORD sector, uint32_t& hit, uint32_t& miss) noexcept
+		{
+			++time_;
+			int idx = pool.find(sector);
+			if(idx >= 0) {
+				++hit;
+			} else {
+				++miss;
+				idx = pool.victim();
+				pool.line_[idx].valid_ = false;
+				auto ret = DEV::disk_read(0, pool.at(idx), sector, 1);
+				if(ret != RES_OK) return ret;
+				pool.line_[idx].sector_ = sector;
+				pool.line_[idx].valid_ = true;
+			}
+			pool.line_[idx].time_ = time_;
+			std::memcpy(buff, pool.at(idx), SS);
+			return RES_OK;
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター（引数は、デバイスにそのまま渡す）
+		 */
+		//-----------------------------------------------------------------//
+		template <typename... ARGS>
+		sector_cache(ARGS&&... args) noexcept : DEV(std::forward<ARGS>(args)...),
+			meta_(), data_(), wb_sector_(0), wb_count_(0),
+			meta_buff_(nullptr), time_(0), counter_()
+		{
+			meta_.clear();
+			data_.clear();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	メタデータ用バッファの設定 @n
+					※通常、マウントする FATFS の「win」を設定する
+			@param[in]	buff	メタデータ用バッファ
+		 */
+		//-----------------------------------------------------------------//
+		void set_meta_buff(const void* buff) noexcept
+		{
+			meta_buff_ = static_cast<const BYTE*>(buff);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	読み込みキャッシュを無効にする @n
+					※書き込み待ちのセクターは破棄しない（カードの取り外し時だけ破棄）
+		 */
+		//-----------------------------------------------------------------//
+		void invalidate() noexcept
+		{
+			meta_.clear();
+			data_.clear();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	カードの取り外し（書き込み待ちと、キャッシュを破棄する）@n
+					※カード検出（CDT）で、取り外しが確定した場合に呼ぶ
+		 */
+		//-----------------------------------------------------------------//
+		void card_removed() noexcept
+		{
+			wb_count_ = 0;
+			invalidate();
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	書き込み待ちのセクターを書き出す
+			@return リザルト
+		 */
+		//-----------------------------------------------------------------//
+		DRESULT flush() noexcept { return flush_(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	カウンターの取得
+			@return カウンター
+		 */
+		//-----------------------------------------------------------------//
+		const counter_t& get_counter() const noexcept { return counter_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	カウンターのリセット
+		 */
+		//-----------------------------------------------------------------//
+		void reset_counter() noexcept { counter_ = counter_t(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	初期化
+			@param[in]	drv		Physical drive nmuber (0)
+			@return ステータス
+		 */
+		//-----------------------------------------------------------------//
+		DSTATUS disk_initialize(BYTE drv) noexcept
+		{
+			// 書き込み待ちを先に書き出す（失敗した場合は、カードが取り外されるまで保持）
+			flush_();
+			invalidate();
+			auto st = DEV::disk_initialize(drv);
+			if((st & STA_NOINIT) == 0) {
+				flush_();  // 初期化前に書き出せなかった分
+			}
+			return st;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	リード・セクター
+			@param[in]	drv		Physical drive nmuber (0)
+			@param[out]	buff	Pointer to the data buffer to store read data
+			@param[in]	sector	Start sector number (LBA)
+			@param[in]	count	Sector count (1..128)
+			@return リザルト
+		 */
+		//-----------------------------------------------------------------//
+		DRESULT disk_read(BYTE drv, BYTE* buff, DWORD sector, UINT count) noexcept
+		{
+			if(drv) return RES_PARERR;
+
+			if(count == 1) {
+				if(wb_count_ > 0 && sector >= wb_sector_ && sector < (wb_sector_ + wb_count_)) {
+					patch_(buff, sector, 1);
+					return RES_OK;
+				}
+				if(MCN > 0 && buff == meta_buff_) {
+					return read_pool_(meta_, buff, sector, counter_.meta_hit_, counter_.meta_miss_);
+				} else if(DCN > 0) {
+					return read_pool_(data_, buff, sector, counter_.data_hit_, counter_.data_miss_);
+				}
+			}
+
+			auto ret = DEV::disk_read(drv, buff, sector, count);
+			if(ret == RES_OK) patch_(buff, sector, count);
+			return ret;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ライト・セクター
+			@param[in]	drv		Physical drive nmuber (0)
+			@param[in]	buff	Pointer to the data to be written
+			@param[in]	sector	Start sector number (LBA)
+			@param[in]	count	Sector count (1..128)
+			@return リザルト
+		 */
+		//-----------------------------------------------------------------//
+		DRESULT disk_write(BYTE drv, const BYTE* buff, DWORD sector, UINT count) noexcept
+		{
+			if(drv) return RES_PARERR;
+
+			counter_.write_sector_ += count;
+			update_(meta_, buff, sector, count);
+			update_(data_, buff, sector, count);
+
+			if(WBN > 0 && count < WBN) {
+				// バッファ内の上書き、又は、連続するセクターの追加
+				if(wb_count_ > 0 && sector >= wb_sector_ && sector <= (wb_sector_ + wb_count_)
+					&& (sector + count) <= (wb_sector_ + WBN)) {
+					std::memcpy(&wb_buff_[(sector - wb_sector_) * SS], buff, count * SS);
+					if((sector + count) > (wb_sector_ + wb_count_)) {
+						wb_count_ = sector + count - wb_sector_;
+					}
+					return RES_OK;
+				}
+				auto ret = flush_();
+				if(ret != RES_OK) return ret;
+				std::memcpy(wb_buff_, buff, count * SS);
+				wb_sector_ = sector;
+				wb_count_ = count;
+				return RES_OK;
+			}
+
+			// 大きな書き込みは、重なるバッファを捨てて、直接書く
+			if(wb_count_ > 0 && sector <= wb_sector_ && (wb_sector_ + wb_count_) <= (sector + count)) {
+				wb_count_ = 0;
+			} else {
+				auto ret = flush_();
+				if(ret != RES_OK) return ret;
+			}
+			++counter_.write_cmd_;
+			return DEV::disk_write(drv, buff, sector, count);
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	I/O コントロール
+			@param[in]	drv		Physical drive nmuber (0)
+			@param[in]	ctrl	Control code
+			@param[in]	buff	Buffer to send/receive control data
+			@return リザルト
+		 */
+		//-----------------------------------------------------------------//
+		DRESULT disk_ioctl(BYTE drv, BYTE ctrl, void* buff) noexcept
+		{
+			if(ctrl == CTRL_SYNC) {
+				auto ret = flush_();
+				if(ret != RES_OK) return ret;
+			}
+			return DEV::disk_ioctl(drv, ctrl, buff);
+		}
+	};
+}
@@ -12,6 +12,7 @@
 #include "common/file_io.hpp"
 #include "common/vtx.hpp"
 #include "graphics/img.hpp"
+#include "graphics/row_sink.hpp"
 
 namespace img {
 
@@ -25,6 +26,7 @@ namespace img {
 	class bmp_in {
 
 		PLOT&		plot_;
+		row_sink<PLOT>	sink_;
 
 		static const uint16_t BMP_SIGNATURE		 = 0x4D42;
 		static const uint16_t BMP_SIG_BYTES		 = 2;
@@ -360,13 +362,11 @@ namespace img {
 				if(fin.read(buf, 1, stride) != stride) {
 					return false;
 				}
-				char* src = buf;
-				for(pos.x = 0; pos.x < bmp.width; ++pos.x) {
-					auto r = src[2];
-					auto g = src[1];
-					auto b = src[0];
-					plot_(pos.x, pos.y, r, g, b);
-					src += pads;
+				auto src = reinterpret_cast<const uint8_t*>(buf);
+				if(pads == 4) {
+					sink_.template put_rgb<2, 1, 0, 4>(0, pos.y, src, bmp.width);
+				} else {
+					sink_.template put_rgb<2, 1, 0, 3>(0, pos.y, src, bmp.width);
 				}
 				pos.y += d;
 				++prgl_pos_;
@@ -462,14 +462,8 @@ namespace img {
 					break;
 
 				case 32:
-					for(pos.x = 0; pos.x < bmp.width; ++pos.x) {
-						auto r = src[2];
-						auto g = src[1];
-						auto b = src[0];
-						auto a = src[3];
-						src += 4;
-						plot_(pos.x, pos.y, r, g, b);
-					}
+					sink_.template put_rgb<2, 1, 0, 4>(0, pos.y,
+						reinterpret_cast<const uint8_t*>(src), bmp.width);
 					break;
 				}
 				pos.y += d;
@@ -603,7 +597,7 @@ namespace img {
 			@param[in]	plot	描画ファンクタ
 		*/
 		//-----------------------------------------------------------------//
-		bmp_in(PLOT& plot) noexcept : plot_(plot), prgl_ref_(0), prgl_pos_(0),
+		bmp_in(PLOT& plot) noexcept : plot_(plot), sink_(plot), prgl_ref_(0), prgl_pos_(0),
 			rgbq_{ 0 } { }
 
 
@@ -726,6 +720,7 @@ namespace img {
 
 			prgl_pos_ = 0;
 			prgl_ref_ = bmp.height;
+			sink_.start();
 
 			uint32_t clutnum = 0;
 			if(bmp.depth <= 8) {
@@ -0,0 +1,55 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	フレームバッファへの１行転送（クリッピング付き） @n
+			render、drw2d_mgr の「copy_row」で共通に使う。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <cstring>
+#include "common/vtx.hpp"
+
+namespace graphics {
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	１行のピクセルを転送する @n
+				クリッピング領域（org、size）と、フレームの範囲の @n
+				両方に入る部分だけを転送する。
+		@param[in]	WIDTH		フレームの幅
+		@param[in]	HEIGHT		フレームの高さ
+		@param[in]	fb			フレームバッファ
+		@param[in]	line_offset	ライン・オフセット（ピクセル数）
+		@param[in]	clip		クリッピング領域
+		@param[in]	pos			開始点
+		@param[in]	src			ソース
+		@param[in]	len			ピクセル数
+	*/
+	//-----------------------------------------------------------------//
+	template <int16_t WIDTH, int16_t HEIGHT, typename T>
+	void copy_row(T* fb, int16_t line_offset, const vtx::srect& clip,
+		const vtx::spos& pos, const T* src, int16_t len) noexcept
+	{
+		int16_t y0 = clip.org.y < 0 ? 0 : clip.org.y;
+		int16_t y1 = clip.org.y + clip.size.y;
+		if(y1 > HEIGHT) y1 = HEIGHT;
+		if(pos.y < y0 || pos.y >= y1) return;
+
+		int16_t x0 = clip.org.x < 0 ? 0 : clip.org.x;
+		int16_t x1 = clip.org.x + clip.size.x;
+		if(x1 > WIDTH) x1 = WIDTH;
+		int16_t x = pos.x;
+		if(x < x0) {
+			src += x0 - x;
+			len -= x0 - x;
+			x = x0;
+		}
+		if((x + len) > x1) len = x1 - x;
+		if(len <= 0) return;
+		std::memcpy(&fb[pos.y * line_offset + x], src, len * sizeof(T));
+	}
+}
@@ -8,7 +8,9 @@
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
 //=====================================================================//
+#include <cstring>
 #include "graphics/pixel.hpp"
+#include "graphics/copy_row.hpp"
 #include "graphics/color.hpp"
 #include "graphics/font.hpp"
 #include "common/intmath.hpp"
@@ -57,6 +59,113 @@ namespace graphics {
 
 		vtx::spos	ofs_;
 
+		// ビットマップ展開テーブル（４ビット → ４ピクセル、前景／背景）
+		T			lut_[16][4];
+		uint32_t	lut_key_;
+		bool		lut_ok_;
+
+		// 範囲 [a, a + n) をクリッピング領域 [o, o + s) に制限（空なら「false」）
+		static bool clip_span_(int16_t& a, int16_t& n, int16_t o, int16_t s) noexcept
+		{
+			if(a < o) {
+				n -= o - a;
+				a = o;
+			}
+			if((a + n) > (o + s)) n = o + s - a;
+			return n > 0;
+		}
+
+		// ３２ビット単位（２ピクセル）で水平に塗る
+		static void fill_span_(T* out, int16_t w, T c) noexcept
+		{
+			if(w <= 0) return;
+			if((reinterpret_cast<uintptr_t>(out) & 2) != 0) {
+				*out++ = c;
+				--w;
+			}
+			uint32_t c32 = (static_cast<uint32_t>(c) << 16) | c;
+			uint32_t* o32 = reinterpret_cast<uint32_t*>(out);
+			int16_t n = w >> 1;
+			while(n >= 4) {
+				o32[0] = c32;
+				o32[1] = c32;
+				o32[2] = c32;
+				o32[3] = c32;
+				o32 += 4;
+				n -= 4;
+			}
+			while(n > 0) {
+				*o32++ = c32;
+				--n;
+			}
+			if(w & 1) {
+				*reinterpret_cast<T*>(o32) = c;
+			}
+		}
+
+
+		void make_lut_() noexcept
+		{
+			uint32_t key = (static_cast<uint32_t>(fore_color_.rgb565) << 16) | back_color_.rgb565;
+			if(lut_ok_ && lut_key_ == key) return;
+			for(uint8_t i = 0; i < 16; ++i) {
+				for(uint8_t j = 0; j < 4; ++j) {
+					lut_[i][j] = (i & (1 << j)) ? fore_color_.rgb565 : back_color_.rgb565;
+				}
+			}
+			lut_key_ = key;
+			lut_ok_ = true;
+		}
+
+
+		// ビット列の取り出し（LSB から、最大３２ビット）
+		static uint32_t get_bits_(const uint8_t* p, uint32_t ofs, uint8_t n) noexcept
+		{
+			p += ofs >> 3;
+			uint8_t sft = ofs & 7;
+			uint8_t bytes = (sft + n + 7) >> 3;
+			uint64_t v = 0;
+			for(uint8_t i = 0; i < bytes; ++i) {
+				v |= static_cast<uint64_t>(p[i]) << (i * 8);
+			}
+			v >>= sft;
+			if(n < 32) v &= (static_cast<uint32_t>(1) << n) - 1;
+			return static_cast<uint32_t>(v);
+		}
+
+
+		// １ビット・イメージの１行を、８ピクセル単位で展開
+		void expand_row_(T* out, uint32_t bits, uint8_t n, bool back) noexcept
+		{
+			T fc = fore_color_.rgb565;
+			while(n >= 8) {
+				uint8_t b = bits & 0xff;
+				if(back) {
+					const T* l = lut_[b & 15];
+					out[0] = l[0]; out[1] = l[1]; out[2] = l[2]; out[3] = l[3];
+					l = lut_[b >> 4];
+					out[4] = l[0]; out[5] = l[1]; out[6] = l[2]; out[7] = l[3];
+				} else if(b == 0xff) {
+					out[0] = fc; out[1] = fc; out[2] = fc; out[3] = fc;
+					out[4] = fc; out[5] = fc; out[6] = fc; out[7] = fc;
+				} else {
+					while(b != 0) {
+						out[__builtin_ctz(b)] = fc;
+						b &= b - 1;
+					}
+				}
+				bits >>= 8;
+				out += 8;
+				n -= 8;
+			}
+			for(uint8_t i = 0; i < n; ++i) {
+				if(bits & 1) out[i] = fc;
+				else if(back) out[i] = back_color_.rgb565;
+				bits >>= 1;
+			}
+		}
+
+
 		// 1/8 円を拡張して、全周に点を打つ
 		void circle_pset_(const vtx::spos& cen, const vtx::spos& pos) noexcept
 		{
@@ -94,7 +203,7 @@ namespace graphics {
 		render(GLC& glc, FONT& font) noexcept : glc_(glc), font_(font),
 			fore_color_(255, 255, 255), back_color_(0, 0, 0),
 			clip_(0, 0, GLC::width, GLC::height),
-			stipple_(-1), stipple_mask_(1), ofs_(0)
+			stipple_(-1), stipple_mask_(1), ofs_(0), lut_key_(0), lut_ok_(false)
 		{ fb_ = static_cast<T*>(glc_.get_fbp()); }
 
 
@@ -205,13 +314,24 @@ namespace graphics {
 
         //-----------------------------------------------------------------//
         /*!
-            @brief  クリッピング領域の設定
+            @brief  クリッピング領域の設定 @n
+					描画は、領域（org から org + size）の内側だけに行う。@n
+					フレームからはみ出す部分は、フレームの範囲に制限する。
             @param[in]  clip    クリッピング領域
         */
         //-----------------------------------------------------------------//
         void set_clip(const vtx::srect& clip) noexcept
         {
-            clip_ = clip;
+			int16_t x = clip.org.x;
+			int16_t w = clip.size.x;
+			int16_t y = clip.org.y;
+			int16_t h = clip.size.y;
+			if(!clip_span_(x, w, 0, GLC::width) || !clip_span_(y, h, 0, GLC::height)) {
+				w = 0;
+				h = 0;
+			}
+			clip_.org.set(x, y);
+			clip_.size.set(w, h);
         }
 
 
@@ -253,8 +373,8 @@ namespace graphics {
 			if((stipple_ & m) == 0) {
 				return false;
 			}
-			if(static_cast<uint16_t>(pos.x) >= static_cast<uint16_t>(clip_.size.x)) return false;
-			if(static_cast<uint16_t>(pos.y) >= static_cast<uint16_t>(clip_.size.y)) return false;
+			if(static_cast<uint16_t>(pos.x - clip_.org.x) >= static_cast<uint16_t>(clip_.size.x)) return false;
+			if(static_cast<uint16_t>(pos.y - clip_.org.y) >= static_cast<uint16_t>(clip_.size.y)) return false;
 			fb_[pos.y * line_offset + pos.x] = c;
 			return true;
 		}
@@ -270,8 +390,8 @@ namespace graphics {
 		//-----------------------------------------------------------------//
 		bool fast_plot(const vtx::spos& pos, T c) noexcept
 		{
-			if(static_cast<uint16_t>(pos.x) >= static_cast<uint16_t>(clip_.size.x)) return false;
-			if(static_cast<uint16_t>(pos.y) >= static_cast<uint16_t>(clip_.size.y)) return false;
+			if(static_cast<uint16_t>(pos.x - clip_.org.x) >= static_cast<uint16_t>(clip_.size.x)) return false;
+			if(static_cast<uint16_t>(pos.y - clip_.org.y) >= static_cast<uint16_t>(clip_.size.y)) return false;
 			fb_[pos.y * line_offset + pos.x] = c;
 			return true;
 		}
@@ -292,6 +412,25 @@ namespace graphics {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	１行のピクセルを転送する（画像デコーダーの行出力用） @n
+					クリッピング領域の外は転送しない。@n
+					破線パターンが設定されている場合は転送しない（plot を使う）
+			@param[in]	pos	開始点を指定
+			@param[in]	src	ソース（RGB565）
+			@param[in]	len	ピクセル数
+			@return 破線パターンが設定されている場合「false」
+		*/
+		//-----------------------------------------------------------------//
+		bool copy_row(const vtx::spos& pos, const T* src, int16_t len) noexcept
+		{
+			if(~stipple_ != 0) return false;
+			graphics::copy_row<GLC::width, GLC::height>(fb_, line_offset, clip_, pos, src, len);
+			return true;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	水平ラインを描画
@@ -302,21 +441,9 @@ namespace graphics {
 		//-----------------------------------------------------------------//
 		void line_h(int16_t y, int16_t x, int16_t w) noexcept
 		{
-			if(w <= 0) return;
-			if(static_cast<uint16_t>(y) >= static_cast<uint16_t>(GLC::height)) return;
-			if(x < 0) {
-				w += x;
-				x = 0;
-			} else if(static_cast<uint16_t>(x) >= static_cast<uint16_t>(GLC::width)) {
-				return;
-			}
-			if(static_cast<uint16_t>(x + w) >= static_cast<uint16_t>(GLC::width)) {
-				w = GLC::width - x;
-			}
-			uint16_t* out = &fb_[y * line_offset + x];
-			for(int16_t i = 0; i < w; ++i) {
-				*out++ = fore_color_.rgb565;
-			}
+			if(static_cast<uint16_t>(y - clip_.org.y) >= static_cast<uint16_t>(clip_.size.y)) return;
+			if(!clip_span_(x, w, clip_.org.x, clip_.size.x)) return;
+			fill_span_(&fb_[y * line_offset + x], w, fore_color_.rgb565);
 		}
 
 
@@ -330,17 +457,8 @@ namespace graphics {
 		//-----------------------------------------------------------------//
 		void line_v(int16_t x, int16_t y, int16_t h) noexcept
 		{
-			if(h <= 0) return;
-			if(static_cast<uint16_t>(x) >= static_cast<uint16_t>(GLC::width)) return;
-			if(y < 0) {
-				h += y;
-				y = 0;
-			} else if(static_cast<uint16_t>(y) >= static_cast<uint16_t>(GLC::height)) {
-				return;
-			}
-			if(static_cast<uint16_t>(y + h) >= static_cast<uint16_t>(GLC::height)) {
-				h = GLC::height - y;
-			}
+			if(static_cast<uint16_t>(x - clip_.org.x) >= static_cast<uint16_t>(clip_.size.x)) return;
+			if(!clip_span_(y, h, clip_.org.y, clip_.size.y)) return;
 			uint16_t* out = &fb_[y * line_offset + x];
 			for(int16_t i = 0; i < h; ++i) {
 				*out = fore_color_.rgb565;
@@ -359,8 +477,18 @@ namespace graphics {
 		{
 			if(rect.size.x <= 0 || rect.size.y <= 0) return;
 
-			for(int16_t yy = rect.org.y; yy < (rect.org.y + rect.size.y); ++yy) {
-				line_h(yy, rect.org.x, rect.size.x);
+			// クリップは最初に一度だけ行い、行毎にスパンで塗る
+			int16_t x0 = rect.org.x;
+			int16_t y0 = rect.org.y;
+			int16_t w = rect.size.x;
+			int16_t h = rect.size.y;
+			if(!clip_span_(x0, w, clip_.org.x, clip_.size.x)) return;
+			if(!clip_span_(y0, h, clip_.org.y, clip_.size.y)) return;
+
+			T* out = &fb_[y0 * line_offset + x0];
+			for(int16_t yy = 0; yy < h; ++yy) {
+				fill_span_(out, w, fore_color_.rgb565);
+				out += line_offset;
 			}
 		}
 
@@ -643,15 +771,13 @@ namespace graphics {
 		void scroll(int16_t h) noexcept
 		{
 			if(h > 0) {
-				for(int32_t i = 0; i < (line_offset * (GLC::height - h)); ++i) {
-					fb_[i] = fb_[i + (line_offset * h)];
-				}
+				std::memmove(&fb_[0], &fb_[line_offset * h],
+					line_offset * (GLC::height - h) * sizeof(T));
 			} else if(h < 0) {
 				h = -h;
-				for(int32_t i = (line_offset * (GLC::height - h)) - 1; i >= 0; --i) {
-					fb_[i + (line_offset * h)] = fb_[i];
-				}
-			}			
+				std::memmove(&fb_[line_offset * h], &fb_[0],
+					line_offset * (GLC::height - h) * sizeof(T));
+			}
 		}
 
 
@@ -667,24 +793,37 @@ namespace graphics {
 		void draw_bitmap(const vtx::spos& pos, const void* img, const vtx::spos& ssz, bool back = false)
 		noexcept {
 			if(img == nullptr) return;
+			if(ssz.x <= 0 || ssz.y <= 0) return;
+
+			// クリップは最初に一度だけ行う
+			int16_t x0 = pos.x;
+			int16_t y0 = pos.y;
+			int16_t w = ssz.x;
+			int16_t h = ssz.y;
+			if(!clip_span_(x0, w, clip_.org.x, clip_.size.x)) return;
+			if(!clip_span_(y0, h, clip_.org.y, clip_.size.y)) return;
+			int16_t x1 = x0 + w;
+			int16_t y1 = y0 + h;
 
+			if(back) make_lut_();
+
+			// ビット列は、行の境界で区切られない（LSB から連続）
 			const uint8_t* p = static_cast<const uint8_t*>(img);
-			uint8_t k = 1;
-			uint8_t c = *p++;
-			vtx::spos loc = pos;
-			for(uint8_t i = 0; i < ssz.y; ++i) {
-				loc.x = pos.x;
-				for(uint8_t j = 0; j < ssz.x; ++j) {
-					if(c & k) fast_plot(loc, fore_color_.rgb565);
-					else if(back) fast_plot(loc, back_color_.rgb565);
-					k <<= 1;
-					if(k == 0) {
-						k = 1;
-						c = *p++;
-					}
-					++loc.x;
+			uint32_t ofs = static_cast<uint32_t>(y0 - pos.y) * ssz.x + (x0 - pos.x);
+			T* out = &fb_[y0 * line_offset + x0];
+			for(int16_t y = y0; y < y1; ++y) {
+				int16_t w = x1 - x0;
+				uint32_t o = ofs;
+				T* dst = out;
+				while(w > 0) {
+					uint8_t n = w > 32 ? 32 : w;
+					expand_row_(dst, get_bits_(p, o, n), n, back);
+					dst += n;
+					o += n;
+					w -= n;
 				}
-				++loc.y;
+				ofs += ssz.x;
+				out += line_offset;
 			}
 		}
 
@@ -1,7 +1,12 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	JPEG 画像クラス
+	@brief	JPEG 画像クラス @n
+			※以前は、グローバルな「gr_plot」関数で描画していたが、他の @n
+			  デコーダー（bmp_in、png_in、picojpeg_in）と同じく、描画 @n
+			  ファンクタ（PLOT）をテンプレートで渡す様に変更した。@n
+			  利用側は、「gr_plot」の代わりに、ファンクタ（img::scaling など）@n
+			  を渡して「img::jpeg_in<PLOT> jpeg(plot);」とする。
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2018 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -16,18 +21,22 @@ extern "C" {
 };
 #include "common/file_io.hpp"
 #include "common/format.hpp"
-
-extern "C" { void gr_plot(int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b); };
+#include "graphics/row_sink.hpp"
 
 namespace img {
 
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
 		@brief	JPEG 画像クラス
+		@param[in]	PLOT	描画ファンクタ
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class PLOT>
 	class jpeg_in {
 
+		PLOT&			plot_;
+		row_sink<PLOT>	sink_;
+
 		int		error_code_;
 
 		static const uint32_t INPUT_BUF_SIZE = 4096;
@@ -149,9 +158,10 @@ namespace img {
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	コンストラクター
+			@param[in]	plot	描画ファンクタ
 		*/
 		//-----------------------------------------------------------------//
-		jpeg_in() { }
+		jpeg_in(PLOT& plot) noexcept : plot_(plot), sink_(plot), error_code_(0) { }
 
 
 		//-----------------------------------------------------------------//
@@ -263,24 +273,16 @@ namespace img {
 			uint8_t line[cinfo.output_components * cinfo.image_width];
 			uint8_t* lines[1];
 			lines[0] = &line[0];
+			sink_.start();
 			for(int y = 0; y < cinfo.output_scan_number; ++y) {
 				jpeg_read_scanlines(&cinfo, (JSAMPLE**)lines, 1);
-				uint8_t* p = &line[0];
+				const uint8_t* p = &line[0];
 				if(cinfo.output_components == 4) {
-					for(uint32_t x = 0; x < cinfo.image_width; ++x) {
-						gr_plot(x, y, p[0], p[1], p[2]);
-						p += 4;
-					}
+					sink_.template put_rgb<0, 1, 2, 4>(0, y, p, cinfo.image_width);
 				} else if(cinfo.output_components == 3) {
-					for(uint32_t x = 0; x < cinfo.image_width; ++x) {
-						gr_plot(x, y, p[0], p[1], p[2]);
-						p += 3;
-					}
+					sink_.template put_rgb<0, 1, 2, 3>(0, y, p, cinfo.image_width);
 				} else if(cinfo.output_components == 1) {
-					for(uint32_t x = 0; x < cinfo.image_width; ++x) {
-						gr_plot(x, y, p[0], p[0], p[0]);
-						++p;
-					}
+					sink_.template put_gray<1>(0, y, p, cinfo.image_width);
 				}
 			}
 
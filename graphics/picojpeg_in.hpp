@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include "graphics/img.hpp"
 #include "graphics/picojpeg.h"
+#include "graphics/row_sink.hpp"
 #include "common/file_io.hpp"
 #include "common/format.hpp"
 
@@ -29,6 +30,7 @@ namespace img {
 	class picojpeg_in {
 
 		PLOT&		plot_;
+		row_sink<PLOT>	sink_;
 
 		pjpeg_image_info_t	image_info_;
 
@@ -61,6 +63,10 @@ namespace img {
 		{
 			int16_t xt = 0;
 			int16_t yt = 0;
+			uint8_t r[16];
+			uint8_t g[16];
+			uint8_t b[16];
+			sink_.start();
 			while((status_ = pjpeg_decode_mcu()) == 0) {
 
 #if 0
@@ -86,41 +92,27 @@ namespace img {
 					}
 				} else {
 #endif
-					auto xx = xt * image_info_.m_MCUWidth;
-					auto yy = yt * image_info_.m_MCUHeight;
-					for(int16_t y = 0; y < image_info_.m_MCUHeight; y += 8) {
-						auto by_limit = std::min(8,
-							image_info_.m_height - (yt * image_info_.m_MCUHeight + y));
-						for(int16_t x = 0; x < image_info_.m_MCUWidth; x += 8) {
-							auto bx_limit = std::min(8,
-								image_info_.m_width - (xt * image_info_.m_MCUWidth + x));
-							auto ofs = (x * 8) + (y * 16);
-							if(image_info_.m_scanType == PJPG_GRAYSCALE) {
-								const uint8_t* pGS = image_info_.m_pMCUBufR + ofs;
-								for(int16_t by = 0; by < by_limit; ++by) {
-									for(int16_t bx = 0; bx < bx_limit; ++bx) {
-										auto gs = *pGS++;
-										plot_(x + xx + bx, y + yy + by, gs, gs, gs);
-									}
-									pGS += (8 - bx_limit);
-								}
-							} else {
-								const uint8_t* pR = image_info_.m_pMCUBufR + ofs;
-								const uint8_t* pG = image_info_.m_pMCUBufG + ofs;
-								const uint8_t* pB = image_info_.m_pMCUBufB + ofs;
-								for(int16_t by = 0; by < by_limit; ++by) {
-									for(int16_t bx = 0; bx < bx_limit; ++bx) {
-										auto r = *pR++; 
-										auto g = *pG++; 
-										auto b = *pB++;
-										plot_(x + xx + bx, y + yy + by, r, g, b);
-									}
-									pR += (8 - bx_limit);
-									pG += (8 - bx_limit);
-									pB += (8 - bx_limit);
-								}
+					// MCU の１行を、ブロックを跨いでまとめて出力する
+					int16_t xx = xt * image_info_.m_MCUWidth;
+					int16_t yy = yt * image_info_.m_MCUHeight;
+					int16_t w = std::min(static_cast<int>(image_info_.m_MCUWidth), image_info_.m_width - xx);
+					int16_t h = std::min(static_cast<int>(image_info_.m_MCUHeight), image_info_.m_height - yy);
+					bool gray = image_info_.m_scanType == PJPG_GRAYSCALE;
+					for(int16_t y = 0; y < h; ++y) {
+						auto ofs = ((y & 8) * 16) + ((y & 7) * 8);
+						for(int16_t x = 0; x < w; ++x) {
+							auto o = ofs + ((x & 8) * 8) + (x & 7);
+							r[x] = image_info_.m_pMCUBufR[o];
+							if(!gray) {
+								g[x] = image_info_.m_pMCUBufG[o];
+								b[x] = image_info_.m_pMCUBufB[o];
 							}
 						}
+						if(gray) {
+							sink_.template put_gray<1>(xx, yy + y, r, w);
+						} else {
+							sink_.put_plane(xx, yy + y, r, g, b, w);
+						}
 					}
 //				}  // reduce_
 				++xt;
@@ -146,7 +138,7 @@ namespace img {
 			@param[in]	plot	描画ファンクタ
 		*/
 		//-----------------------------------------------------------------//
-		picojpeg_in(PLOT& plot) noexcept : plot_(plot),
+		picojpeg_in(PLOT& plot) noexcept : plot_(plot), sink_(plot),
 			image_info_(),
 			status_(0),
 			width_(0), height_(0)
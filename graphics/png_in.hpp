@@ -10,6 +10,7 @@
 //=====================================================================//
 #include "graphics/img.hpp"
 #include "graphics/color.hpp"
+#include "graphics/row_sink.hpp"
 #include "common/file_io.hpp"
 #include "common/format.hpp"
 
@@ -28,6 +29,7 @@ namespace img {
 	class png_in {
 
 		PLOT&		plot_;
+		row_sink<PLOT>	sink_;
 
         bool        color_key_enable_;
 
@@ -53,7 +55,7 @@ namespace img {
 			@param[in]	plot	描画ファンクタ
 		*/
 		//-----------------------------------------------------------------//
-		png_in(PLOT& plot) noexcept : plot_(plot),
+		png_in(PLOT& plot) noexcept : plot_(plot), sink_(plot),
 			color_key_enable_(false), prgl_ref_(0), prgl_pos_(0)
 		{ }
 
@@ -267,11 +269,24 @@ namespace img {
 //				}
 			}
 
+			// アルファ、カラーキーが無い８ビット形式は、行単位で出力
+			bool row = !indexed && !alpha && !color_key_enable_ && bit_depth == 8;
+			sink_.start();
+
 			png_byte* iml = new png_byte[width * ch * skip];
 			vtx::spos pos;
 			for(pos.y = 0; pos.y < static_cast<int16_t>(height); ++pos.y) {
 				png_read_row(png_ptr, iml, nullptr);
 				png_byte* p = iml;
+				if(row) {
+					if(gray) {
+						sink_.template put_gray<1>(0, pos.y, p, width);
+					} else {
+						sink_.template put_rgb<0, 1, 2, 3>(0, pos.y, p, width);
+					}
+					prgl_pos_ = pos.y;
+					continue;
+				}
 				for(pos.x = 0; pos.x < static_cast<int16_t>(width); ++pos.x) {
 					graphics::rgba8_t c;
 					if(indexed) {
@@ -0,0 +1,175 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	画像デコーダー用、行単位ピクセル出力 @n
+			・PLOT ファンクタが「put_row」を持つ場合、RGB565 に変換した行を @n
+			  まとめて渡す。@n
+			  bool put_row(int16_t x, int16_t y, const uint16_t* src, int16_t len); @n
+			・「put_row」が無い、又は「false」を返した場合、従来の１ピクセル @n
+			  毎の PLOT 呼び出しで出力する。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include "graphics/color.hpp"
+
+namespace img {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	行単位ピクセル出力クラス
+		@param[in]	PLOT	描画ファンクタ
+		@param[in]	N		行バッファのピクセル数
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class PLOT, int16_t N = 64>
+	class row_sink {
+
+		PLOT&		plot_;
+
+		uint16_t	buff_[N];
+		bool		row_;
+
+		template <class P>
+		static auto test_(int) -> decltype(std::declval<P&>().put_row(int16_t(0), int16_t(0),
+			static_cast<const uint16_t*>(nullptr), int16_t(0)), std::true_type());
+
+		template <class P>
+		static std::false_type test_(...);
+
+		typedef decltype(test_<PLOT>(0)) has_row_t;
+
+		bool put_row_(std::true_type, int16_t x, int16_t y, int16_t len) noexcept
+		{
+			return plot_.put_row(x, y, buff_, len);
+		}
+
+		bool put_row_(std::false_type, int16_t x, int16_t y, int16_t len) noexcept
+		{
+			return false;
+		}
+
+		// 行バッファを出力（受け付けない場合、以降は１ピクセル毎）
+		bool flush_(int16_t x, int16_t y, int16_t len) noexcept
+		{
+			if(put_row_(has_row_t(), x, y, len)) return true;
+			row_ = false;
+			return false;
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター
+			@param[in]	plot	描画ファンクタ
+		*/
+		//-----------------------------------------------------------------//
+		row_sink(PLOT& plot) noexcept : plot_(plot), row_(has_row_t::value) { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	行出力の再開（画像のロード毎に呼ぶ）
+		*/
+		//-----------------------------------------------------------------//
+		void start() noexcept { row_ = has_row_t::value; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	行出力が有効か
+			@return 有効なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool is_row() const noexcept { return row_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	パックされた RGB 行の出力
+			@param[in]	RI		R のオフセット
+			@param[in]	GI		G のオフセット
+			@param[in]	BI		B のオフセット
+			@param[in]	STEP	１ピクセルのバイト数
+			@param[in]	x		開始位置 X
+			@param[in]	y		位置 Y
+			@param[in]	src		ソース
+			@param[in]	len		ピクセル数
+		*/
+		//-----------------------------------------------------------------//
+		template <uint8_t RI, uint8_t GI, uint8_t BI, uint8_t STEP>
+		void put_rgb(int16_t x, int16_t y, const uint8_t* src, int16_t len) noexcept
+		{
+			while(row_ && len > 0) {
+				int16_t n = len > N ? N : len;
+				const uint8_t* p = src;
+				for(int16_t i = 0; i < n; ++i) {
+					buff_[i] = graphics::share_color::to_565(p[RI], p[GI], p[BI]);
+					p += STEP;
+				}
+				if(!flush_(x, y, n)) break;
+				src = p;
+				x += n;
+				len -= n;
+			}
+			for(int16_t i = 0; i < len; ++i) {
+				plot_(x + i, y, src[RI], src[GI], src[BI]);
+				src += STEP;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	プレーンに分かれた RGB 行の出力
+			@param[in]	x		開始位置 X
+			@param[in]	y		位置 Y
+			@param[in]	r		R ソース
+			@param[in]	g		G ソース
+			@param[in]	b		B ソース
+			@param[in]	len		ピクセル数
+		*/
+		//-----------------------------------------------------------------//
+		void put_plane(int16_t x, int16_t y, const uint8_t* r, const uint8_t* g, const uint8_t* b,
+			int16_t len) noexcept
+		{
+			while(row_ && len > 0) {
+				int16_t n = len > N ? N : len;
+				for(int16_t i = 0; i < n; ++i) {
+					buff_[i] = graphics::share_color::to_565(r[i], g[i], b[i]);
+				}
+				if(!flush_(x, y, n)) break;
+				r += n;
+				g += n;
+				b += n;
+				x += n;
+				len -= n;
+			}
+			for(int16_t i = 0; i < len; ++i) {
+				plot_(x + i, y, r[i], g[i], b[i]);
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	グレースケール行の出力
+			@param[in]	STEP	１ピクセルのバイト数
+			@param[in]	x		開始位置 X
+			@param[in]	y		位置 Y
+			@param[in]	src		ソース
+			@param[in]	len		ピクセル数
+		*/
+		//-----------------------------------------------------------------//
+		template <uint8_t STEP>
+		void put_gray(int16_t x, int16_t y, const uint8_t* src, int16_t len) noexcept
+		{
+			put_rgb<0, 0, 0, STEP>(x, y, src, len);
+		}
+	};
+}
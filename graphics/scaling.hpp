@@ -280,6 +280,24 @@ namespace img {
 		void set_scale(uint32_t up = 1, uint32_t dn = 1) noexcept { scale_ = step_t(up, dn); }
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	行出力（等倍の場合のみ、フレームバッファへ直接転送）
+			@param[in]	x	X 座標
+			@param[in]	y	Y 座標
+			@param[in]	src	ソース（RGB565）
+			@param[in]	len	ピクセル数
+			@return 等倍以外、又は破線パターンが有効なら「false」（１ピクセル毎の描画になる）
+		*/
+		//-----------------------------------------------------------------//
+		bool put_row(int16_t x, int16_t y, const uint16_t* src, int16_t len) noexcept
+		{
+			if(scale_.up != scale_.dn) return false;
+
+			return render_.copy_row(vtx::spos(x + ofs_.x, y + ofs_.y), src, len);
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	描画ファンクタ
@@ -9,6 +9,7 @@
 */
 //=====================================================================//
 #include <array>
+#include <algorithm>
 #include "graphics/widget.hpp"
 #include "graphics/group.hpp"
 #include "graphics/frame.hpp"
@@ -23,13 +24,19 @@ namespace gui {
 
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	/*!
-		@brief	Widget ディレクター
+		@brief	Widget ディレクター @n
+				・描画が必要な widget の領域を、ダーティー矩形として記録する。@n
+				・重なる矩形はマージし、ダーティー矩形毎に、その矩形で @n
+				  クリッピングして、交差する widget を描画順に再描画する。@n
+				  （部分更新、ダーティー矩形の外のピクセルは書き換えない）@n
+				・描画する物がある場合のみ、垂直同期を取る事が出来る。
 		@param[in]	RDR		レンダークラス
 		@param[in]	TOUCH	タッチクラス
 		@param[in]	WNUM	widget の最大管理数
+		@param[in]	DNUM	ダーティー矩形の最大数
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <class RDR, class TOUCH, uint32_t WNUM>
+	template <class RDR, class TOUCH, uint32_t WNUM, uint32_t DNUM = 8>
 	struct widget_director {
 
 		struct widget_t {
@@ -44,6 +51,25 @@ namespace gui {
 
 		typedef std::array<widget_t, WNUM> WIDGETS; 
 
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	描画カウンター
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct counter_t {
+			uint32_t	frame_;		///< 描画を行ったフレーム数
+			uint32_t	widget_;	///< 描画した widget 数
+			uint32_t	pixel_;		///< 描画した面積（クリッピング後のピクセル数）
+			uint32_t	dirty_;		///< マージ後のダーティー矩形数
+			uint32_t	time_;		///< 最後のフレームの描画時間
+			uint32_t	time_max_;	///< 最大描画時間
+			counter_t() noexcept : frame_(0), widget_(0), pixel_(0), dirty_(0),
+				time_(0), time_max_(0) { }
+		};
+
+		typedef uint32_t (*time_func)();	///< 描画時間計測用タイマー関数
+
 	private:
 		using GLC = typename RDR::glc_type;
 
@@ -52,6 +78,120 @@ namespace gui {
 
 		WIDGETS		widgets_;
 
+		vtx::srect	dirty_[DNUM];
+		uint32_t	dirty_num_;
+
+		bool		vsync_;
+		time_func	time_func_;
+		counter_t	counter_;
+
+		static bool overlap_(const vtx::srect& a, const vtx::srect& b) noexcept
+		{
+			return a.org.x < b.end_x() && b.org.x < a.end_x()
+				&& a.org.y < b.end_y() && b.org.y < a.end_y();
+		}
+
+		static vtx::srect union_(const vtx::srect& a, const vtx::srect& b) noexcept
+		{
+			auto x0 = std::min(a.org.x, b.org.x);
+			auto y0 = std::min(a.org.y, b.org.y);
+			auto x1 = std::max(a.end_x(), b.end_x());
+			auto y1 = std::max(a.end_y(), b.end_y());
+			return vtx::srect(x0, y0, x1 - x0, y1 - y0);
+		}
+
+		// ダーティー矩形の追加（重なる矩形はマージ、溢れた場合は最後の矩形にマージ）
+		void add_dirty_(vtx::srect r) noexcept
+		{
+			if(r.size.x <= 0 || r.size.y <= 0) return;
+			uint32_t i = 0;
+			while(i < dirty_num_) {
+				if(overlap_(dirty_[i], r)) {
+					r = union_(dirty_[i], r);
+					--dirty_num_;
+					dirty_[i] = dirty_[dirty_num_];
+					i = 0;
+				} else {
+					++i;
+				}
+			}
+			if(dirty_num_ < DNUM) {
+				dirty_[dirty_num_] = r;
+				++dirty_num_;
+			} else {
+				dirty_[DNUM - 1] = union_(dirty_[DNUM - 1], r);
+			}
+		}
+
+		static uint32_t area_(const vtx::srect& a, const vtx::srect& b) noexcept
+		{
+			uint32_t w = std::min(a.end_x(), b.end_x()) - std::max(a.org.x, b.org.x);
+			uint32_t h = std::min(a.end_y(), b.end_y()) - std::max(a.org.y, b.org.y);
+			return w * h;
+		}
+
+		static vtx::srect get_rect_(const widget* w) noexcept
+		{
+			return vtx::srect(w->get_final_position(), w->get_location().size);
+		}
+
+		void draw_(widget* w) noexcept
+		{
+			switch(w->get_id()) {
+			case widget::ID::GROUP:
+				break;
+			case widget::ID::FRAME:
+				{
+					auto* ww = dynamic_cast<frame*>(w);
+					if(ww == nullptr) break;
+					ww->draw(rdr_);
+				}
+				break;
+			case widget::ID::BUTTON:
+				{
+					auto* ww = dynamic_cast<button*>(w);
+					if(ww == nullptr) break;
+					ww->draw(rdr_);
+				}
+				break;
+			case widget::ID::CHECK:
+				{
+					auto* ww = dynamic_cast<check*>(w);
+					if(ww == nullptr) break;
+					ww->draw(rdr_);
+				}
+				break;
+			case widget::ID::RADIO:
+				{
+					auto* ww = dynamic_cast<radio*>(w);
+					if(ww == nullptr) break;
+					ww->draw(rdr_);
+				}
+				break;
+			case widget::ID::SLIDER:
+				{
+					auto* ww = dynamic_cast<slider*>(w);
+					if(ww == nullptr) break;
+					ww->draw(rdr_);
+				}
+				break;
+			case widget::ID::MENU:
+				{
+					auto* ww = dynamic_cast<menu*>(w);
+					if(ww == nullptr) break;
+					ww->draw(rdr_);
+				}
+				break;
+			case widget::ID::SPINBOX:
+				{
+					auto* ww = dynamic_cast<spinbox*>(w);
+					if(ww == nullptr) break;
+					ww->draw(rdr_);
+				}
+				break;
+			}
+		}
+
 		// ipass 自分を含めない場合「false」
 		uint32_t create_childs_(widget* w, widget_t** list, uint32_t max, bool ipass)
 		{
@@ -81,10 +221,47 @@ namespace gui {
 		*/
 		//-----------------------------------------------------------------//
 		widget_director(RDR& rdr, TOUCH& touch) noexcept :
-			rdr_(rdr), touch_(touch), widgets_()
+			rdr_(rdr), touch_(touch), widgets_(), dirty_num_(0),
+			vsync_(false), time_func_(nullptr), counter_()
 		{ }
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	垂直同期の設定 @n
+					描画する widget がある場合のみ、描画前に垂直同期を取る。
+			@param[in]	ena		垂直同期を行う場合「true」
+		*/
+		//-----------------------------------------------------------------//
+		void set_vsync(bool ena = true) noexcept { vsync_ = ena; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	描画時間計測用タイマー関数の設定
+			@param[in]	func	タイマー関数（カウント値を返す）
+		*/
+		//-----------------------------------------------------------------//
+		void set_time_func(time_func func) noexcept { time_func_ = func; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	描画カウンターの取得
+			@return 描画カウンター
+		*/
+		//-----------------------------------------------------------------//
+		const counter_t& get_counter() const noexcept { return counter_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	描画カウンターのリセット
+		*/
+		//-----------------------------------------------------------------//
+		void reset_counter() noexcept { counter_ = counter_t(); }
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	widget の登録
@@ -239,66 +416,55 @@ namespace gui {
 				}
 			}
 
+			bool req = false;
+			for(const auto& t : widgets_) {
+				if(t.w_ == nullptr) continue;
+				if(t.w_->get_state() == widget::STATE::DISABLE) continue;
+				if(t.draw_) {
+					req = true;
+					break;
+				}
+			}
+			if(!req) return;
+
+			if(vsync_) rdr_.sync_frame();
+			uint32_t org = 0;
+			if(time_func_ != nullptr) org = (*time_func_)();
+
+			// 描画が必要な widget の領域を、ダーティー矩形にする
+			dirty_num_ = 0;
 			for(auto& t : widgets_) {
 				if(t.w_ == nullptr) continue;
 				if(t.w_->get_state() == widget::STATE::DISABLE) continue;
-				if(!t.draw_) continue; 
+				if(!t.draw_) continue;
 				t.draw_ = false;
+				add_dirty_(get_rect_(t.w_));
+			}
 
-				switch(t.w_->get_id()) {
-				case widget::ID::GROUP:
-					break;
-				case widget::ID::FRAME:
-					{
-						auto* w = dynamic_cast<frame*>(t.w_);
-						if(w == nullptr) break;
-						w->draw(rdr_);
-					}
-					break;
-				case widget::ID::BUTTON:
-					{
-						auto* w = dynamic_cast<button*>(t.w_);
-						if(w == nullptr) break;
-						w->draw(rdr_);
-					}
-					break;
-				case widget::ID::CHECK:
-					{
-						auto* w = dynamic_cast<check*>(t.w_);
-						if(w == nullptr) break;
-						w->draw(rdr_);
-					}
-					break;
-				case widget::ID::RADIO:
-					{
-						auto* w = dynamic_cast<radio*>(t.w_);
-						if(w == nullptr) break;
-						w->draw(rdr_);
-					}
-					break;
-				case widget::ID::SLIDER:
-					{
-						auto* w = dynamic_cast<slider*>(t.w_);
-						if(w == nullptr) break;
-						w->draw(rdr_);
-					}
-					break;
-				case widget::ID::MENU:
-					{
-						auto* w = dynamic_cast<menu*>(t.w_);
-						if(w == nullptr) break;
-						w->draw(rdr_);
-					}
-					break;
-				case widget::ID::SPINBOX:
-					{
-						auto* w = dynamic_cast<spinbox*>(t.w_);
-						if(w == nullptr) break;
-						w->draw(rdr_);
-					}
-					break;
+			// ダーティー矩形でクリッピングして、交差する widget を描画順に再描画する
+			auto clip = rdr_.get_clip();
+			for(uint32_t i = 0; i < dirty_num_; ++i) {
+				const auto& d = dirty_[i];
+				rdr_.set_clip(d);
+				for(auto& t : widgets_) {
+					if(t.w_ == nullptr) continue;
+					if(t.w_->get_state() == widget::STATE::DISABLE) continue;
+					auto r = get_rect_(t.w_);
+					if(!overlap_(d, r)) continue;
+
+					draw_(t.w_);
+					++counter_.widget_;
+					counter_.pixel_ += area_(d, r);
 				}
 			}
+			rdr_.set_clip(clip);
+
+			++counter_.frame_;
+			counter_.dirty_ += dirty_num_;
+			if(time_func_ != nullptr) {
+				counter_.time_ = (*time_func_)() - org;
+				if(counter_.time_max_ < counter_.time_) counter_.time_max_ = counter_.time_;
+			}
 		}
 
 
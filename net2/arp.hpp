@@ -85,7 +85,7 @@ namespace net {
 			uint32_t all = sizeof(arp_frame);
 			std::memcpy(dst, &t, all);
 
-			uint8_t* p = reinterpret_cast<uint8_t*>(&dst);
+			uint8_t* p = static_cast<uint8_t*>(dst);
 			p += all;
 
 			// ６０バイトに満たない場合は、ダミー・データ（０）を追加する。
@@ -45,6 +45,41 @@ namespace net {
 
 		uint32_t	info_update_count_;
 
+		bool process_frame_()
+		{
+			void* org;
+			int32_t len = ethd_.recv_buff(&org);
+			if(len <= 0) {  // error state, or no frame
+				return false;
+			} else if((len > 1514) || (len < 60)) {  // サイズ範囲外は捨てる
+				ethd_.recv_buff_release();
+				return true;
+			} else {  // recv data
+
+				const eth_h& h = *static_cast<const eth_h*>(org);
+
+				const void* top = static_cast<const uint8_t*>(org) + sizeof(eth_h);
+
+				switch(h.get_type()) {
+				case eth_type::IPV4:
+					ipv4_.process(h, top, len - sizeof(eth_h));
+					break;
+
+				case eth_type::ARP:
+					arp_.process(h, top, len - sizeof(eth_h));
+					break;
+
+				case eth_type::IPX:
+					break;
+				default:
+					break;
+				}
+
+				ethd_.recv_buff_release();
+				return true;
+			}
+		}
+
 	public:
 		//-----------------------------------------------------------------//
 		/*!
@@ -96,44 +131,15 @@ namespace net {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  データ、受信、送信、プロセス
+			@brief  データ、受信、送信、プロセス @n
+					受信フレームはディスクリプター・バッファ上でそのまま処理し、@n
+					１回の呼び出しで、溜まっているフレームをまとめて処理する
 		*/
 		//-----------------------------------------------------------------//
 		void process()
 		{
-			// recv
-			void* org;
-			int32_t len = ethd_.recv_buff(&org);
-			if(len < 0) {  // error state
-
-				return;
-			} else if((len > 1514) || (len < 60)) {  // サイズ範囲外は捨てる
-				if(len != 0) {
-					ethd_.recv_buff_release();
-				}
-				return;
-			} else {  // recv data
-
-				const eth_h& h = *static_cast<const eth_h*>(org);
-
-				const void* top = static_cast<const uint8_t*>(org) + sizeof(eth_h);
-
-				switch(h.get_type()) {
-				case eth_type::IPV4:
-					ipv4_.process(h, top, len - sizeof(eth_h));
-					break;
-
-				case eth_type::ARP:
-					arp_.process(h, top, len - sizeof(eth_h));
-					break;
-
-				case eth_type::IPX:
-					break;
-				default:
-					break;
-				}
-
-				ethd_.recv_buff_release();
+			for(uint32_t i = 0; i < ETHD::RXD_NUM; ++i) {
+				if(!process_frame_()) break;
 			}
 		}
 
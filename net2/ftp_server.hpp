@@ -26,6 +26,7 @@
 #include "common/time.h"
 #include "common/string_utils.hpp"
 #include "net2/tcp.hpp"
+#include "net2/tcp_file.hpp"
 
 #define FTP_DEBUG
 
@@ -180,6 +181,8 @@ namespace net {
 		uint32_t	data_connect_loop_;
 
 		FILE*		file_fp_;
+		FIL			file_fil_;		///< 送信ファイル（FatFs から直接送信）
+		uint32_t	file_size_;
 		uint32_t	file_total_;
 		uint32_t	file_frame_;
 		uint32_t	file_wait_;
@@ -573,16 +576,15 @@ int n = 0;
 						task_ = task::close_port;
 						break;
 					}
-					uint32_t fsz = sdc_.size(path);
-					file_fp_ = fopen(path, "rb");
-					if(file_fp_ == nullptr) {
+					if(!sdc_.open(&file_fil_, path, FA_READ)) {
 						ctrl_format("450 Can't open %s \n") % path;
 						ctrl_flush();
 						task_ = task::close_port;
 						break;
 					}
+					file_size_ = f_size(&file_fil_);
 					ctrl_format("150-Connected to port %d\n") % data_;
-					ctrl_format("150 %u bytes to download\n") % fsz;
+					ctrl_format("150 %u bytes to download\n") % file_size_;
 					ctrl_flush();
 					file_total_ = 0;
 					file_frame_ = 0;
@@ -902,7 +904,7 @@ utils::format("Reconnection CTRL\n");
 			user_{ 0 }, pass_{ 0 }, time_out_(0), delay_loop_(0),
 			param_(nullptr), data_ip_(), data_port_(0),
 			data_connect_loop_(0),
-			file_fp_(nullptr), file_total_(0), file_frame_(0), file_wait_(0),
+			file_fp_(nullptr), file_fil_(), file_size_(0), file_total_(0), file_frame_(0), file_wait_(0),
 			pasv_enable_(false)
 			{ }
 
@@ -1134,21 +1136,29 @@ utils::format("Reconnection CTRL\n");
 			//--------------------------//
 			case task::send_file:
 				{
-					uint32_t sz = fread(rw_buf_, 1, sizeof(rw_buf_), file_fp_);
+					// 送信バッファの空きに、FatFs から直接読み込む
+					int sz = tcp_send_file(tcp, data_, &file_fil_, file_total_, file_size_ - file_total_);
+					if(sz < 0) {
+						ctrl_format("426 Connection closed; transfer aborted\n");
+						ctrl_flush();
+						sdc_.close(&file_fil_);
+						tcp.close(data_);
+						debug_format("Data send abort\n");
+						task_ = task::command;
+						break;
+					}
 					if(sz > 0) {
-						tcp.send(data_, rw_buf_, sz);
 						file_total_ += sz;
 						file_wait_ = 0;
 					} else {
 						++file_wait_;
 					}
 					++file_frame_;
-					if(sz < sizeof(rw_buf_)) {
+					if(file_total_ >= file_size_) {
 						uint32_t krate = file_total_ * 100 / file_frame_ / 1024;
 						ctrl_format("226 File successfully transferred (%u KBytes/Sec)\n") % krate;
 						ctrl_flush();
-						fclose(file_fp_);
-						file_fp_ = nullptr;
+						sdc_.close(&file_fil_);
 						tcp.close(data_);
 						task_ = task::command;
 						debug_format("Data send %u Bytes, %u Kbytes/Sec\n") % file_total_ % krate;
@@ -1157,8 +1167,7 @@ utils::format("Reconnection CTRL\n");
 					if(file_wait_ >= transfer_timeout_) {
 						ctrl_format("421 Data timeout. Reconnect. Sorry\n");
 						ctrl_flush();
-						fclose(file_fp_);
-						file_fp_ = nullptr;
+						sdc_.close(&file_fil_);
 						tcp.close(data_);
 						debug_format("Data send timeout\n");
 						task_ = task::command;
@@ -16,6 +16,7 @@
 #include "graphics/color.hpp"
 #include "common/format.hpp"
 #include "net2/tcp.hpp"
+#include "net2/tcp_file.hpp"
 
 #define HTTP_DEBUG
 
@@ -110,10 +111,16 @@ namespace net {
 			main_loop,
 			disconnect_delay,
 			delay_begin,
+			send_file,
 			disconnect,
 		};
 		task		task_;
 
+		FIL				file_;
+		uint32_t		file_pos_;
+		uint32_t		file_size_;
+		bool			file_open_;
+
 		color			back_color_;
 		color			fore_color_;
 
@@ -182,6 +189,7 @@ namespace net {
 			count_(0), disconnect_loop_(0), delay_loop_(0),
 			link_num_(0), link_{ },
 			task_(task::none),
+			file_(), file_pos_(0), file_size_(0), file_open_(false),
 			back_color_(255, 255, 255), fore_color_(0, 0, 0),
 			favicon_(false), other_link_(false)
 		{ }
@@ -505,18 +513,25 @@ namespace net {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  ファイル送信
+			@brief  ファイル送信 @n
+					ヘッダーを送り、ファイル本体は「サービス」で送信バッファの空きに @n
+					応じて、FatFs から直接送る
 			@param[in]	path	ファイル・パス
 			@return 成功なら「true」
 		*/
 		//-----------------------------------------------------------------//
 		bool send_file(const char* path)
 		{
-			FILE* fp = fopen(path, "rb");
-			if(fp == nullptr) {
+			if(file_open_) {
+				sdc_.close(&file_);
+				file_open_ = false;
+			}
+			if(!sdc_.open(&file_, path, FA_READ)) {
 				return false;
 			}
-			uint32_t fsz = sdc_.size(path);
+			file_open_ = true;
+			file_pos_ = 0;
+			file_size_ = f_size(&file_);
 
 			http_format::chaout().clear();
 			http_format("HTTP/1.1 200 OK\n");
@@ -532,21 +547,10 @@ namespace net {
 			} else {
 				http_format("text/plain\n");
 			}
-			http_format("Content-Length: %u\n") % fsz;
+			http_format("Content-Length: %u\n") % file_size_;
 			http_format("Connection: close\n\n");
-			http_format::chaout().flush();				
-			uint8_t tmp[512];
-			uint32_t total = 0;
-			uint32_t len;
-			while((len = fread(tmp, 1, sizeof(tmp), fp)) == sizeof(tmp)) {
-				eth_.at_tcp().send(desc_, tmp, sizeof(tmp));
-				total += len;
-			}
-			if(len > 0) {
-				eth_.at_tcp().send(desc_, tmp, len);
-				total += len;
-			}
-			fclose(fp);
+			http_format::chaout().flush();
+			return true;
 		}
 
 
@@ -643,7 +647,11 @@ namespace net {
 								debug_format("HTTP Server: request fail command '%s'\n") % t;
 							}
 							line_man_.clear();
-							task_ = task::disconnect_delay;
+							if(file_open_) {
+								task_ = task::send_file;
+							} else {
+								task_ = task::disconnect_delay;
+							}
 						} else {
 							debug_format("HTTP Server: request fail section.\n");
 						}
@@ -654,6 +662,34 @@ namespace net {
 				}
 				break;
 
+			case task::send_file:
+				{
+					bool end = false;
+					if(tcp.connected(desc_)) {
+						int n = tcp_send_file(tcp, desc_, &file_, file_pos_, file_size_ - file_pos_);
+						if(n < 0) {
+							end = true;
+						} else {
+							file_pos_ += n;
+							// 送り終えたか、ファイルが途中で終わった場合
+							if(file_pos_ >= file_size_ || (n == 0 && tcp.get_send_length(desc_) == 0)) {
+								end = true;
+							}
+						}
+					} else {
+						debug_format("HTTP Server: connection un-link (send file).\n");
+						end = true;
+					}
+					if(end) {
+						debug_format("HTTP Server: send file %u/%u bytes\n") % file_pos_ % file_size_;
+						sdc_.close(&file_);
+						file_open_ = false;
+						disconnect_loop_ = DISCONNECT_LOOP;
+						task_ = task::disconnect_delay;
+					}
+				}
+				break;
+
 			case task::disconnect_delay:
 				{
 					auto len = tcp.get_recv_length(desc_);
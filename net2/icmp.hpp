@@ -91,11 +91,12 @@ namespace net {
 				uint8_t* d_msg = static_cast<uint8_t*>(dst);
 				d_msg += sizeof(eth_h) + sizeof(ipv4_h);
 				std::memcpy(d_msg, msg, len);
-				d_msg[0] = 0x00;
-				d_msg[2] = 0x00;
-				d_msg[3] = 0x00;
-				{
-					uint16_t sum = tools::calc_sum(d_msg, len);
+				{  // タイプ、コード（１６ビット・ワード）の変更分だけ、サムを差分更新
+					uint16_t org = (static_cast<uint16_t>(d_msg[0]) << 8) | d_msg[1];
+					d_msg[0] = 0x00;  // Echo Reply（コードはそのまま）
+					uint16_t val = (static_cast<uint16_t>(d_msg[0]) << 8) | d_msg[1];
+					uint16_t sum = (static_cast<uint16_t>(d_msg[2]) << 8) | d_msg[3];
+					sum = tools::update_sum(sum, org, val);
 					d_msg[2] = sum >> 8;
 					d_msg[3] = sum;
 				}
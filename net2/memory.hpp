@@ -98,6 +98,36 @@ namespace net {
 		}
 
 
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納位置のポインターを返す @n
+					※put_span() と組で使い、書き込み後 put_go() で確定する
+			@return	格納位置のポインター
+        */
+        //-----------------------------------------------------------------//
+		uint8_t* put_ptr() noexcept { return &buff_[put_]; }
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  格納位置から連続して書き込める長さを返す @n
+					※バッファ終端で折り返さない範囲（満杯判定の為、１バイトは残す）
+			@return	連続して書き込める長さ
+        */
+        //-----------------------------------------------------------------//
+		uint32_t put_span() const noexcept {
+			uint16_t get = get_;
+			uint16_t put = put_;
+			if(put >= get) {
+				uint32_t n = size_ - put;
+				if(get == 0) --n;
+				return n;
+			} else {
+				return get - put - 1;
+			}
+		}
+
+
         //-----------------------------------------------------------------//
         /*!
             @brief  値の格納
@@ -168,6 +198,55 @@ namespace net {
 		}
 
 
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  オフセット位置の値の取得と、イーサーネット・サムの計算 @n
+					※コピーとサム計算を同時に行い、ポインターは更新しない
+			@param[out]	dst	コピー先
+			@param[in]	ofs	get 位置からのオフセット
+			@param[in]	len	長さ
+			@return サム（反転していない）
+        */
+        //-----------------------------------------------------------------//
+		uint16_t peek_sum(void* dst, uint16_t ofs, uint16_t len) const noexcept {
+			uint32_t pos = static_cast<uint32_t>(get_) + ofs;
+			if(pos >= size_) pos -= size_;
+			uint16_t fsz = size_ - pos;
+			uint16_t sum = 0;
+			bool odd = false;
+			if(fsz <= len) {
+				sum = tools::copy_sum(dst, &buff_[pos], fsz);
+				odd = (fsz & 1) != 0;
+				len -= fsz;
+				pos = 0;
+				dst = static_cast<void*>(static_cast<uint8_t*>(dst) + fsz);
+			}
+			if(len > 0) {
+				uint16_t n = tools::copy_sum(dst, &buff_[pos], len);
+				if(odd) n = tools::swap16(n);
+				sum = tools::fold_sum(static_cast<uint32_t>(sum) + n);
+			}
+			return sum;
+		}
+
+
+        //-----------------------------------------------------------------//
+        /*!
+            @brief  値の取得と、イーサーネット・サムの計算 @n
+					※コピーとサム計算を同時に行う
+			@param[out]	dst	コピー先
+			@param[in]	len	長さ
+			@param[in]	go	ポインターを更新しない場合「false」
+			@return サム（反転していない）
+        */
+        //-----------------------------------------------------------------//
+		uint16_t get_sum(void* dst, uint16_t len, bool go = true) noexcept {
+			uint16_t sum = peek_sum(dst, 0, len);
+			if(go) get_go(len);
+			return sum;
+		}
+
+
         //-----------------------------------------------------------------//
         /*!
             @brief  get 位置を返す
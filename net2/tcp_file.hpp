@@ -0,0 +1,50 @@
+#pragma once
+//=========================================================================//
+/*! @file
+    @brief  TCP ファイル送信（FatFs） @n
+			FatFs から、TCP 送信バッファの空き領域へ直接読み込む。@n
+			HTTP、FTP サーバーで共通に使う。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=========================================================================//
+#include "ff13c/source/ff.h"
+
+namespace net {
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief  ファイル・データ送信 @n
+				FatFs から送信バッファの空き領域へ直接読み込む（中間バッファを使わない）@n
+				※送信バッファの空きが無い場合は「０」を返すので、残りは後で再度呼ぶ
+		@param[in]	tcp		TCP クラス
+		@param[in]	desc	ディスクリプタ
+		@param[in]	fp		ファイル構造体ポインター（読み込みモードでオープン済み）
+		@param[in]	ofs		ファイル・オフセット
+		@param[in]	len		送信バイト数
+		@return 送信バッファに積んだバイト（負の値はエラー）
+	*/
+	//-----------------------------------------------------------------//
+	template <class TCP>
+	int tcp_send_file(TCP& tcp, uint32_t desc, FIL* fp, uint32_t ofs, uint32_t len) noexcept
+	{
+		if(fp == nullptr) return -1;
+
+		if(f_tell(fp) != ofs) {
+			if(f_lseek(fp, ofs) != FR_OK) return -1;
+		}
+
+		return tcp.send_direct(desc, len, [fp, &ofs](void* dst, uint32_t n) -> int {
+			// セクター境界で終わる様に調整し、FatFs のセクター直接転送を使う
+			if(n > FF_MIN_SS) {
+				n -= (ofs + n) & (FF_MIN_SS - 1);
+			}
+			UINT rl;
+			if(f_read(fp, dst, n, &rl) != FR_OK) return -1;
+			ofs += rl;
+			return rl;
+		} );
+	}
+}
@@ -175,10 +175,11 @@ namespace net {
 			p->udp_.set_dst_port(ctx.port_);
 			p->udp_.set_length(sizeof(udp_h) + len);
 			p->udp_.set_csum(0x0000);
-			ctx.send_.get(static_cast<uint8_t*>(dst) + sizeof(frame_t), len);
+			// 送信フレームへのコピーと同時にサムを計算
+			uint16_t sum = ctx.send_.get_sum(static_cast<uint8_t*>(dst) + sizeof(frame_t), len);
 
-			uint16_t sum = tools::calc_sum(&smh, sizeof(csum_h));
-			sum = tools::calc_sum(&p->udp_, sizeof(udp_h) + len, ~sum);
+			sum = tools::partial_sum(&smh, sizeof(csum_h), sum);
+			sum = tools::calc_sum(&p->udp_, sizeof(udp_h), sum);
 			p->udp_.set_csum(sum);
 
 // dump(p->ipv4_);
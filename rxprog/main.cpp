@@ -8,6 +8,11 @@
 */
 //=====================================================================//
 #include <iostream>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <streambuf>
 #include "rx_prog.hpp"
 #include "conf_in.hpp"
 #include "motsx_io.hpp"
@@ -20,9 +25,12 @@ namespace {
 	const std::string conf_file_ = "rx_prog.conf";
 	const uint32_t progress_num_ = 50;
 	const char progress_cha_ = '#';
+	const uint32_t write_run_ = 64;		///< パイプライン書き込みで、まとめる最大ページ数
+	const uint32_t verify_run_ = 32;	///< パイプライン照合で、まとめる最大ページ数
 
 	utils::conf_in conf_in_;
 	utils::motsx_io motsx_;
+	uint32_t pageall_ = 0;
 
 	void memory_dump_()
 	{
@@ -74,22 +82,124 @@ namespace {
 	}
 
 
-	struct page_t {
-		uint32_t	n = 0;
-		uint32_t	c = 0;
+	enum class phase : uint32_t {
+		CONNECT,
+		ERASE,
+		WRITE,
+		VERIFY,
+		DONE,
+		FAIL,
 	};
 
+	const char* phase_str_[] = { "Connect", "Erase", "Write", "Verify", "Done", "Fail" };
 
-	void progress_(uint32_t pageall, page_t& page)
+
+	// ポート毎の状態（マルチ・ターゲットでは、表示スレッドから参照する）
+	struct state_t {
+		std::string				path;
+		bool					out = false;	///< 進行状況を直接表示
+		std::atomic<phase>		ph;
+		std::atomic<phase>		fail;
+		std::atomic<uint32_t>	n;
+		std::atomic<uint32_t>	num;
+		uint32_t				c = 0;
+
+		state_t() : ph(phase::CONNECT), fail(phase::CONNECT), n(0), num(1) { }
+	};
+
+
+	void begin_(state_t& st, phase ph, uint32_t num, const char* title)
 	{
-		uint32_t pos = progress_num_ * page.n / pageall;
-		for(uint32_t i = 0; i < (pos - page.c); ++i) {
+		st.n = 0;
+		st.num = num > 0 ? num : 1;
+		st.c = 0;
+		st.ph = ph;
+		if(st.out) {
+			std::cout << title << std::flush;
+		}
+	}
+
+
+	void progress_(state_t& st, uint32_t n)
+	{
+		st.n = n;
+		if(!st.out) return;
+		uint32_t pos = progress_num_ * n / st.num;
+		for(uint32_t i = 0; i < (pos - st.c); ++i) {
 			std::cout << progress_cha_ << std::flush;
 		}
-		page.c = pos;
+		st.c = pos;
+	}
+
+
+	void end_(state_t& st)
+	{
+		if(st.out) {
+			std::cout << std::endl << std::flush;
+		}
+	}
+
+
+	// 連続したページを最大 num ページまとめて、func(org, src, len) を呼ぶ
+	template <class FUNC>
+	bool scan_pages_(const utils::motsx_io::pages& ps, uint32_t num, FUNC func)
+	{
+		std::vector<uint8_t> tmp;
+		uint32_t i = 0;
+		while(i < ps.size()) {
+			auto org = ps[i];
+			tmp.clear();
+			uint32_t n = 0;
+			while((i + n) < ps.size() && n < num && ps[i + n] == (org + n * 256)) {
+				const auto& mem = motsx_.get_memory(ps[i + n]);
+				tmp.insert(tmp.end(), mem.begin(), mem.end());
+				++n;
+			}
+			if(!func(org, &tmp[0], n * 256)) {
+				return false;
+			}
+			i += n;
+		}
+		return true;
 	}
 
 
+	// パイプライン・モード用、ページ・イメージ（全ポートで共有、読み出しのみ）
+	struct run_t {
+		uint32_t				org;
+		std::vector<uint8_t>	data;
+	};
+	typedef std::vector<run_t> runs;
+
+	struct image_t {
+		utils::motsx_io::pages	all;	///< 全ページ
+		runs	write;	///< 書き込み（ブランク・ページを除く）
+		runs	verify;	///< 照合
+
+		void build() {
+			all = motsx_.create_page_list();
+			auto ps = motsx_.create_page_list(false);
+			write.clear();
+			scan_pages_(ps, write_run_, [&](uint32_t org, const uint8_t* src, uint32_t len) {
+				write.push_back(run_t { org, std::vector<uint8_t>(src, src + len) });
+				return true;
+			});
+			verify.clear();
+			scan_pages_(all, verify_run_, [&](uint32_t org, const uint8_t* src, uint32_t len) {
+				verify.push_back(run_t { org, std::vector<uint8_t>(src, src + len) });
+				return true;
+			});
+		}
+
+		static uint32_t pages(const runs& rs) {
+			uint32_t n = 0;
+			for(const auto& r : rs) n += r.data.size() / 256;
+			return n;
+		}
+	};
+	image_t image_;
+
+
 	struct options {
 		bool verbose = false;
 
@@ -105,6 +215,7 @@ namespace {
 
 		std::string com_path;
 		std::string com_name;
+		utils::strings com_list;
 		bool	dp = false;
 
 		std::string id_val;
@@ -119,6 +230,10 @@ namespace {
 		bool	verify = false;
 		bool	device_list = false;
 		bool	progress = false;
+		bool	pipeline = false;
+
+		std::string	cache_dir;
+		uint32_t	bin_org = 0;
 		bool	erase_data = false;
 		bool	erase_rom = false;
 		bool	help = false;
@@ -158,6 +273,7 @@ namespace {
 				dv = false;
 			} else if(dp) {
 				com_path = t;
+				com_list.push_back(t);
 				dp = false;
 			} else if(id) {
 				id_val = t;
@@ -184,10 +300,10 @@ namespace {
 		cout << "Renesas RX Series Programmer Version " << version_ << endl;
 		cout << "Copyright (C) 2016,2020 Hiramatsu Kunihito (hira@rvf-rc45.net)" << endl;
 		cout << "usage:" << endl;
-		cout << c << " [options] [mot file] ..." << endl;
+		cout << c << " [options] [mot/hex/bin file] ..." << endl;
 		cout << endl;
 		cout << "Options :" << endl;
-		cout << "    -P PORT,   --port=PORT     Specify serial port" << endl;
+		cout << "    -P PORT,   --port=PORT     Specify serial port (Multiple ports write concurrently)" << endl;
 		cout << "    -s SPEED,  --speed=SPEED   Specify serial speed" << endl;
 		cout << "    -d DEVICE, --device=DEVICE Specify device name" << endl;
 		cout << "    -e, --erase                Perform a device erase to a minimum" << endl;
@@ -200,10 +316,330 @@ namespace {
 		cout << "    -v, --verify               Perform data verify" << endl;
 		cout << "    -w, --write                Perform data write" << endl;
 		cout << "    --progress                 display Progress output" << endl;
+		cout << "    --org=ADDR                 Binary file load address (default: end at 0xFFFFFFFF)" << endl;
+		cout << "    --cache=DIR                Cache parsed images in DIR" << endl;
+		cout << "    --pipeline                 Erase/Write/Verify only used blocks, pages (RX64M/RX65x/RX66T/RX72x)" << endl;
 		cout << "    --device-list              Display device list" << endl;
 		cout << "    --verbose                  Verbose output" << endl;
 		cout << "    -h, --help                 Display this" << endl;
 	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	１ポートの書き込みシーケンス（接続、消去、書き込み、照合）
+		@param[in]	opts	オプション
+		@param[in]	rx		CPU 設定
+		@param[in]	speed	シリアル速度
+		@param[in]	st		ポートの状態
+		@return 成功なら「true」
+	*/
+	//-----------------------------------------------------------------//
+	bool program_(const options& opts, const rx::protocol::rx_t& rx, int speed, state_t& st)
+	{
+		//============================ 接続
+		st.ph = phase::CONNECT;
+		rx::prog prog_(opts.verbose);
+		if(!prog_.start(st.path, speed, rx)) {
+			prog_.end();
+			return false;
+		}
+
+		//============================ パイプライン・モード
+		bool pipeline = opts.pipeline;
+		if(pipeline && !prog_.is_pipeline()) {
+			std::cerr << "Pipeline mode not support: '" << rx.cpu_type_ << "'" << std::endl;
+			pipeline = false;
+		}
+
+		//============================ 消去（使うブロックだけ、ブランクなら消去しない）
+		if(pipeline && opts.erase) {
+			std::vector<uint32_t> blocks;
+			for(auto adr : image_.all) {
+				auto org = adr & ~(prog_.get_block_size(adr) - 1);
+				if(blocks.empty() || blocks.back() != org) {
+					blocks.push_back(org);
+				}
+			}
+
+			begin_(st, phase::ERASE, blocks.size(), "Erase:  ");
+			uint32_t n = 0;
+			uint32_t erase_num = 0;
+			for(auto org : blocks) {
+				bool erase = false;
+				if(!prog_.erase_block(org, erase)) {
+					prog_.end();
+					return false;
+				}
+				if(erase) ++erase_num;
+				progress_(st, ++n);
+			}
+			end_(st);
+			if(opts.verbose) {
+				std::cout << boost::format("# Erase blocks: %d/%d") % erase_num % blocks.size() << std::endl;
+			}
+		}
+
+		//============================ 書き込み（ブランク・ページを除く）
+		if(pipeline && opts.write) {
+			// 書くページが無い場合、書き込みの開始、終了を送らない
+			bool start = !image_.write.empty();
+			if(start) {
+				if(!prog_.start_write(true)) {
+					prog_.end();
+					return false;
+				}
+			}
+
+			uint32_t num = image_t::pages(image_.write);
+			begin_(st, phase::WRITE, num, "Write:  ");
+			uint32_t n = 0;
+			for(const auto& r : image_.write) {
+				if(!prog_.write_area(r.org, &r.data[0], r.data.size())) {
+					prog_.end();
+					return false;
+				}
+				n += r.data.size() / 256;
+				progress_(st, n);
+			}
+			end_(st);
+			if(opts.verbose) {
+				std::cout << boost::format("# Write pages: %d/%d") % num % pageall_ << std::endl;
+			}
+			if(start && !prog_.final_write()) {
+				prog_.end();
+				return false;
+			}
+		}
+
+		//============================ 照合（デバイス側 CRC、使えない場合はリード・バック）
+		if(pipeline && opts.verify) {
+			begin_(st, phase::VERIFY, image_t::pages(image_.verify), "Verify: ");
+			uint32_t n = 0;
+			for(const auto& r : image_.verify) {
+				if(!prog_.verify_area(r.org, &r.data[0], r.data.size())) {
+					prog_.end();
+					return false;
+				}
+				n += r.data.size() / 256;
+				progress_(st, n);
+			}
+			end_(st);
+		}
+
+		//============================ 消去
+		if(!pipeline && opts.erase) {  // erase
+			auto areas = motsx_.create_area_map();
+
+			begin_(st, phase::ERASE, pageall_, "Erase:  ");
+			uint32_t n = 0;
+			for(const auto& a : areas) {
+				uint32_t adr = a.min_ & 0xffffff00;
+				uint32_t len = 0;
+				while(len < (a.max_ - a.min_ + 1)) {
+					progress_(st, n);
+					if(!prog_.erase_page(adr)) {  // 256 バイト単位で消去要求を送る
+						prog_.end();
+						return false;
+					}
+					adr += 256;
+					len += 256;
+					++n;
+				}
+			}
+			end_(st);
+		}
+
+		//=====================================
+		if(!pipeline && opts.write) {  // write
+			auto areas = motsx_.create_area_map();
+			bool start = !areas.empty();
+			if(start) {
+				if(!prog_.start_write(true)) {
+					prog_.end();
+					return false;
+				}
+			}
+
+			begin_(st, phase::WRITE, pageall_, "Write:  ");
+			uint32_t n = 0;
+			for(const auto& a : areas) {
+				uint32_t adr = a.min_ & 0xffffff00;
+				uint32_t len = 0;
+				while(len < (a.max_ - a.min_ + 1)) {
+					progress_(st, n);
+					/// std::cout << boost::format("%08X to %08X") % adr % (adr + 255) << std::endl;
+					const auto& mem = motsx_.get_memory(adr);
+					if(!prog_.write(adr, &mem[0])) {
+						prog_.end();
+						return false;
+					}
+					adr += 256;
+					len += 256;
+					++n;
+				}
+			}
+			end_(st);
+			if(start && !prog_.final_write()) {
+				prog_.end();
+				return false;
+			}
+		}
+
+		//=====================================
+		if(!pipeline && opts.verify) {  // verify
+			auto areas = motsx_.create_area_map();
+			begin_(st, phase::VERIFY, pageall_, "Verify: ");
+			uint32_t n = 0;
+			for(const auto& a : areas) {
+				uint32_t adr = a.min_ & 0xffffff00;
+				uint32_t len = 0;
+				while(len < (a.max_ - a.min_ + 1)) {
+					progress_(st, n);
+					/// std::cout << boost::format("%08X to %08X") % adr % (adr + 255) << std::endl;
+					const auto& mem = motsx_.get_memory(adr);
+					if(!prog_.verify_page(adr, &mem[0])) {
+						prog_.end();
+						return false;
+					}
+					adr += 256;
+					len += 256;
+					++n;
+				}
+			}
+			end_(st);
+		}
+
+		prog_.end();
+		return true;
+	}
+
+
+	// マルチ・ターゲットのエラー出力（行単位で、スレッド毎のポート名を付ける）
+	thread_local std::string err_prefix_;
+	thread_local std::string err_line_;
+
+	class prefix_buf : public std::streambuf {
+		std::streambuf*	org_;
+		std::mutex		mtx_;
+
+		void out_() {
+			std::lock_guard<std::mutex> lock(mtx_);
+			org_->sputn(err_line_.data(), err_line_.size());
+			org_->pubsync();
+			err_line_.clear();
+		}
+
+	protected:
+		int overflow(int c) override {
+			if(c == EOF) return 0;
+			// 空行以外の行頭に付ける
+			if(c != '\n' && (err_line_.empty() || err_line_.back() == '\n')) {
+				err_line_ += err_prefix_;
+			}
+			err_line_ += static_cast<char>(c);
+			if(c == '\n') out_();
+			return c;
+		}
+
+	public:
+		prefix_buf(std::streambuf* org) : org_(org) { }
+
+		void begin(const std::string& prefix) {
+			err_prefix_ = prefix;
+			err_line_.clear();
+		}
+
+		void end() {
+			if(!err_line_.empty()) {
+				err_line_ += '\n';
+				out_();
+			}
+		}
+	};
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	複数ポートへの同時書き込み（ポート毎にスレッド）
+		@param[in]	opts	オプション
+		@param[in]	rx		CPU 設定
+		@param[in]	speed	シリアル速度
+		@return 全て成功なら「true」
+	*/
+	//-----------------------------------------------------------------//
+	bool program_multi_(const options& opts, const rx::protocol::rx_t& rx, int speed)
+	{
+		std::vector<std::unique_ptr<state_t>> sts;
+		for(const auto& path : opts.com_list) {
+			sts.emplace_back(new state_t);
+			sts.back()->path = path;
+		}
+
+		// ワーカーのエラーは、どのポートか判るように「#n 'path': 」を付ける
+		prefix_buf pb(std::cerr.rdbuf());
+		auto cerr_org = std::cerr.rdbuf(&pb);
+
+		std::atomic<uint32_t> done(0);
+		std::vector<std::thread> ths;
+		for(uint32_t i = 0; i < sts.size(); ++i) {
+			state_t* p = sts[i].get();
+			ths.emplace_back([&opts, &rx, speed, p, &done, &pb, i]() {
+				pb.begin((boost::format("#%d '%s': ") % i % p->path).str());
+				phase ph = phase::DONE;
+				if(!program_(opts, rx, speed, *p)) {
+					p->fail = p->ph.load();
+					ph = phase::FAIL;
+				}
+				pb.end();
+				p->ph = ph;
+				++done;
+			});
+		}
+
+		// 進行状況（ポート毎の工程と進み具合）
+		while(1) {
+			bool fin = done == sts.size();
+			if(opts.progress) {
+				std::string s;
+				for(uint32_t i = 0; i < sts.size(); ++i) {
+					const auto& st = *sts[i];
+					auto ph = st.ph.load();
+					if(ph == phase::DONE || ph == phase::FAIL || ph == phase::CONNECT) {
+						s += (boost::format("#%d:%-7s ") % i % phase_str_[static_cast<uint32_t>(ph)]).str();
+					} else {
+						s += (boost::format("#%d:%c%3d%%  ") % i % phase_str_[static_cast<uint32_t>(ph)][0]
+							% (st.n * 100 / st.num)).str();
+					}
+				}
+				std::cout << '\r' << s << std::flush;
+			}
+			if(fin) break;
+			std::this_thread::sleep_for(std::chrono::milliseconds(200));
+		}
+		if(opts.progress) {
+			std::cout << std::endl;
+		}
+
+		for(auto& th : ths) {
+			th.join();
+		}
+		std::cerr.rdbuf(cerr_org);
+
+		uint32_t ok = 0;
+		for(const auto& st : sts) {
+			if(st->ph == phase::DONE) ++ok;
+		}
+		std::cout << boost::format("Summary: %d/%d OK") % ok % sts.size() << std::endl;
+		for(uint32_t i = 0; i < sts.size(); ++i) {
+			const auto& st = *sts[i];
+			if(st.ph != phase::DONE) {
+				std::cout << boost::format("  #%d: '%s' fail (%s)") % i % st.path
+					% phase_str_[static_cast<uint32_t>(st.fail.load())] << std::endl;
+			}
+		}
+		return ok == sts.size();
+	}
 }
 
 int main(int argc, char* argv[])
@@ -267,6 +703,7 @@ int main(int argc, char* argv[])
 			} else if(p == "-P") opts.dp = true;
 			else if(p.find("--port=") == 0) {
 				opts.com_path = &p[std::strlen("--port=")];
+				opts.com_list.push_back(opts.com_path);
 ///			} else if(p == "-a") {
 ///				opts.area = true;
 ///			} else if(p.find("--area=") == 0) {
@@ -285,6 +722,14 @@ int main(int argc, char* argv[])
 				opts.verify = true;
 			} else if(p == "--progress") {
 				opts.progress = true;
+			} else if(p == "--pipeline") {
+				opts.pipeline = true;
+			} else if(p.find("--cache=") == 0) {
+				opts.cache_dir = &p[std::strlen("--cache=")];
+			} else if(p.find("--org=") == 0) {
+				if(!utils::string_to_hex(&p[std::strlen("--org=")], opts.bin_org)) {
+					opterr = true;
+				}
 			} else if(p == "--device-list") {
 				opts.device_list = true;
 			} else if(p == "-e" || p == "--erase") {
@@ -338,45 +783,57 @@ int main(int argc, char* argv[])
 	}
 
 	// 入力ファイルの読み込み
-	uint32_t pageall = 0;
 	if(!opts.inp_file.empty()) {
 		if(opts.verbose) {
 			std::cout << "# Input file path: '" << opts.inp_file << '\'' << std::endl;
 		}
-		if(!motsx_.load(opts.inp_file)) {
+		motsx_.set_cache_dir(opts.cache_dir);
+		if(!motsx_.load(opts.inp_file, opts.bin_org)) {
 			std::cerr << "Can't open input file: '" << opts.inp_file << "'" << std::endl;
 			return -1;
 		}
-		pageall = motsx_.get_total_page();
+		pageall_ = motsx_.get_total_page();
 		if(opts.verbose) {
 			motsx_.list_area_map("# ");
 		}
+		if(opts.pipeline) {
+			image_.build();
+		}
 	}
 
-    // Windwos系シリアル・ポート（COMx）の変換
-    if(!opts.com_path.empty() && opts.com_path[0] != '/') {
-		std::string s = utils::to_lower_text(opts.com_path);
-        if(s.size() > 3 && s[0] == 'c' && s[1] == 'o' && s[2] == 'm') {
-            int val;
-            if(utils::string_to_int(&s[3], val)) {
-                if(val >= 1 ) {
-                    --val;
-                    opts.com_name = opts.com_path;
-                    opts.com_path = "/dev/ttyS" + (boost::format("%d") % val).str();
-                }
-            }
-        }
+	if(opts.com_list.empty() && !opts.com_path.empty()) {
+		opts.com_list.push_back(opts.com_path);
+	}
+	for(auto& path : opts.com_list) {
+	    // Windwos系シリアル・ポート（COMx）の変換
+	    if(!path.empty() && path[0] != '/') {
+			std::string s = utils::to_lower_text(path);
+	        if(s.size() > 3 && s[0] == 'c' && s[1] == 'o' && s[2] == 'm') {
+	            int val;
+	            if(utils::string_to_int(&s[3], val)) {
+	                if(val >= 1 ) {
+	                    --val;
+	                    opts.com_name = path;
+	                    path = "/dev/ttyS" + (boost::format("%d") % val).str();
+	                }
+	            }
+	        }
+			if(opts.verbose) {
+				std::cout << "# Serial port alias: " << opts.com_name << " ---> " << path << std::endl;
+			}
+	    }
+		if(path.empty()) {
+			std::cerr << "Serial port path not found." << std::endl;
+			return -1;
+		}
 		if(opts.verbose) {
-			std::cout << "# Serial port alias: " << opts.com_name << " ---> " << opts.com_path << std::endl;
+			std::cout << "# Serial port path: '" << path << '\'' << std::endl;
 		}
-    }
-	if(opts.com_path.empty()) {
+	}
+	if(opts.com_list.empty()) {
 		std::cerr << "Serial port path not found." << std::endl;
 		return -1;
 	}
-	if(opts.verbose) {
-		std::cout << "# Serial port path: '" << opts.com_path << '\'' << std::endl;
-	}
 	int com_speed = 0;
 	if(!utils::string_to_int(opts.com_speed, com_speed)) {
 		std::cerr << "Serial speed conversion error: '" << opts.com_speed << '\'' << std::endl;
@@ -412,113 +869,18 @@ int main(int argc, char* argv[])
 		rx.ext_div_ = val;
 	}
 
-	//============================ 接続
-	rx::prog prog_(opts.verbose);
-	if(!prog_.start(opts.com_path, com_speed, rx)) {
-		prog_.end();
-		return -1;
-	}
-
-	//============================ 消去
-	if(opts.erase) {  // erase
-		auto areas = motsx_.create_area_map();
-
-		if(opts.progress) {
-			std::cout << "Erase:  " << std::flush;
-		}
 
-		page_t page;
-		for(const auto& a : areas) {
-			uint32_t adr = a.min_ & 0xffffff00;
-			uint32_t len = 0;
-			while(len < (a.max_ - a.min_ + 1)) {
-				if(opts.progress) {
-					progress_(pageall, page);
-				}
-				if(!prog_.erase_page(adr)) {  // 256 バイト単位で消去要求を送る
-					prog_.end();
-					return -1;
-				}
-				adr += 256;
-				len += 256;
-				++page.n;
-			}
-		}
-		if(opts.progress) {
-			std::cout << std::endl << std::flush;
-		}
-	}
-
-	//=====================================
-	if(opts.write) {  // write
-		auto areas = motsx_.create_area_map();
-		if(!areas.empty()) {
-			if(!prog_.start_write(true)) {
-				prog_.end();
-				return -1;
-			}
-		}
-		
-		if(opts.progress) {
-			std::cout << "Write:  " << std::flush;
-		}
-		page_t page;
-		for(const auto& a : areas) {
-			uint32_t adr = a.min_ & 0xffffff00;
-			uint32_t len = 0;
-			while(len < (a.max_ - a.min_ + 1)) {
-				if(opts.progress) {
-					progress_(pageall, page);
-				}
-				/// std::cout << boost::format("%08X to %08X") % adr % (adr + 255) << std::endl;
-				auto mem = motsx_.get_memory(adr);
-				if(!prog_.write(adr, &mem[0])) {
-					prog_.end();
-					return -1;
-				}
-				adr += 256;
-				len += 256;
-				++page.n;
-			}
-		}
-		if(opts.progress) {
-			std::cout << std::endl << std::flush;
-		}
-		if(!prog_.final_write()) {
-			prog_.end();
+	//============================ 書き込み
+	if(opts.com_list.size() > 1) {
+		if(!program_multi_(opts, rx, com_speed)) {
 			return -1;
 		}
-	}
-
-	//=====================================
-	if(opts.verify) {  // verify
-		auto areas = motsx_.create_area_map();
-		if(opts.progress) {
-			std::cout << "Verify: " << std::flush;
-		}
-		page_t page;
-		for(const auto& a : areas) {
-			uint32_t adr = a.min_ & 0xffffff00;
-			uint32_t len = 0;
-			while(len < (a.max_ - a.min_ + 1)) {
-				if(opts.progress) {
-					progress_(pageall, page);
-				}
-				/// std::cout << boost::format("%08X to %08X") % adr % (adr + 255) << std::endl;
-				auto mem = motsx_.get_memory(adr);
-				if(!prog_.verify_page(adr, &mem[0])) {
-					prog_.end();
-					return -1;
-				}
-				adr += 256;
-				len += 256;
-				++page.n;
-			}
-		}
-		if(opts.progress) {
-			std::cout << std::endl << std::flush;
+	} else {
+		state_t st;
+		st.path = opts.com_list[0];
+		st.out = opts.progress;
+		if(!program_(opts, rx, com_speed, st)) {
+			return -1;
 		}
 	}
-
-	prog_.end();
 }
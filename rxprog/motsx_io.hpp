@@ -1,20 +1,35 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	モトローラーＳフォーマット入出力
+	@brief	モトローラーＳフォーマット入出力 @n
+			・入力ファイルは、メモリーにマップして、テーブルでデコードする。@n
+			・モトローラーＳフォーマット、インテル HEX、バイナリーに対応。@n
+			・ページ（２５６バイト）の配列を、アドレス順に持つ。@n
+			・キャッシュ・ディレクトリーを設定すると、ファイルのハッシュを @n
+			  キーとして、解析済みのイメージを保存し、次回はそれを読む。
     @author 平松邦仁 (hira@rvf-rc45.net)
-	@copyright	Copyright (C) 2016, 2017 Kunihito Hiramatsu @n
+	@copyright	Copyright (C) 2016, 2020 Kunihito Hiramatsu @n
 				Released under the MIT license @n
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
 //=====================================================================//
 #include <vector>
-#include <map>
+#include <unordered_map>
+#include <algorithm>
 #include <string>
 #include <array>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
 #include "file_io.hpp"
 #include <iomanip>
 #include <boost/format.hpp>
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace utils {
 
@@ -30,10 +45,12 @@ namespace utils {
 		struct area_t {
 			uint32_t	min_;
 			uint32_t	max_;
-			area_t(uint32_t min = 0xffffffff, uint32_t max = 0) : min_(min), max_(max) { } 			
+			area_t(uint32_t min = 0xffffffff, uint32_t max = 0) : min_(min), max_(max) { }
 		};
 		typedef std::vector<area_t> areas;
 
+		typedef std::vector<uint32_t> pages;
+
 		struct array_t {
 			area_t	area_;
 			array	array_;
@@ -45,177 +62,509 @@ namespace utils {
 				if(area_.max_ < adr) area_.max_ = adr;
 				array_[adr & 0xff] = data;
 			}
+
+			void set(uint32_t adr, const uint8_t* src, uint32_t len) {
+				if(area_.min_ > adr) area_.min_ = adr;
+				if(area_.max_ < (adr + len - 1)) area_.max_ = adr + len - 1;
+				std::memcpy(&array_[adr & 0xff], src, len);
+			}
+		};
+
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	入力フォーマット
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		enum class format {
+			NONE,		///< 不明
+			MOTOROLA,	///< モトローラーＳフォーマット
+			INTEL_HEX,	///< インテル HEX
+			BINARY,		///< バイナリー
 		};
 
 	private:
 		area_t		area_;
 		uint32_t	exec_;
 
-		typedef std::map<uint32_t, array_t>	memory_map;
+		// ページ配列（アドレス順）と、ページ・アドレスからの索引
+		struct page_t {
+			uint32_t	adr_;
+			array_t		body_;
+		};
+		typedef std::vector<page_t> page_array;
+		page_array	pages_;
+
+		typedef std::unordered_map<uint32_t, uint32_t> page_index;
+		page_index	index_;
 
-		memory_map	memory_map_;
+		uint32_t	last_adr_;
+		uint32_t	last_idx_;
+		bool		sorted_;
 
 		array		fill_array_;
 
-		void write_byte_(uint32_t address, uint8_t val) {
-			uint32_t base = address & 0xffff00;
-			memory_map::iterator it = memory_map_.find(base);
-			if(it == memory_map_.end()) {
-				array_t t;
-				t.set(address, val);
-				memory_map_.emplace(base, t);
-			} else {
-				array_t& t = it->second;
-				t.set(address, val);
+		std::string	cache_dir_;
+
+		// 16 進テーブル（無効な文字は -1）
+		struct hex_table {
+			int8_t	tbl_[256];
+			hex_table() {
+				for(int i = 0; i < 256; ++i) tbl_[i] = -1;
+				for(int i = 0; i < 10; ++i) tbl_['0' + i] = i;
+				for(int i = 0; i < 6; ++i) {
+					tbl_['A' + i] = 10 + i;
+					tbl_['a' + i] = 10 + i;
+				}
 			}
+		};
+
+		static const int8_t* hex_() {
+			static const hex_table t;
+			return t.tbl_;
 		}
 
+		// 入力ファイル（メモリー・マップ）
+		class map_file {
+			const uint8_t*	ptr_;
+			size_t			size_;
+#ifdef WIN32
+			std::vector<uint8_t>	buff_;
+#endif
+		public:
+			map_file() : ptr_(nullptr), size_(0) { }
+
+			~map_file() { close(); }
+
+			bool open(const std::string& path) {
+#ifdef WIN32
+				utils::file_io fio;
+				if(!fio.open(path, "rb")) {
+					return false;
+				}
+				buff_.resize(fio.get_file_size());
+				if(!buff_.empty()) {
+					fio.read(&buff_[0], 1, buff_.size());
+				}
+				fio.close();
+				ptr_ = buff_.empty() ? nullptr : &buff_[0];
+				size_ = buff_.size();
+				return true;
+#else
+				int fd = ::open(path.c_str(), O_RDONLY);
+				if(fd < 0) {
+					return false;
+				}
+				struct stat st;
+				if(fstat(fd, &st) != 0) {
+					::close(fd);
+					return false;
+				}
+				size_ = st.st_size;
+				if(size_ > 0) {
+					void* p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+					if(p == MAP_FAILED) {
+						::close(fd);
+						size_ = 0;
+						return false;
+					}
+					madvise(p, size_, MADV_SEQUENTIAL);
+					ptr_ = static_cast<const uint8_t*>(p);
+				}
+				::close(fd);
+				return true;
+#endif
+			}
+
+			void close() {
+#ifndef WIN32
+				if(ptr_ != nullptr) {
+					munmap(const_cast<uint8_t*>(ptr_), size_);
+				}
+#endif
+				ptr_ = nullptr;
+				size_ = 0;
+			}
+
+			const uint8_t* get() const { return ptr_; }
+			size_t size() const { return size_; }
+		};
 
-		bool load_(utils::file_io& fio) {
+
+		void clear_() {
 			area_.min_ = 0xffffffff;
 			area_.max_ = 0x00000000;
+			exec_ = 0;
+			pages_.clear();
+			index_.clear();
+			last_adr_ = 1;
+			last_idx_ = 0;
+			sorted_ = true;
+		}
+
+
+		array_t& page_(uint32_t base) {
+			if(base == last_adr_) {
+				return pages_[last_idx_].body_;
+			}
+			auto it = index_.find(base);
+			uint32_t idx;
+			if(it == index_.end()) {
+				idx = pages_.size();
+				if(!pages_.empty() && pages_.back().adr_ > base) sorted_ = false;
+				pages_.push_back(page_t { base, array_t() });
+				index_.emplace(base, idx);
+			} else {
+				idx = it->second;
+			}
+			last_adr_ = base;
+			last_idx_ = idx;
+			return pages_[idx].body_;
+		}
+
+
+		void write_byte_(uint32_t address, uint8_t val) {
+			page_(address & 0xffffff00).set(address, val);
+		}
+
+
+		void write_block_(uint32_t address, const uint8_t* src, uint32_t len) {
+			while(len > 0) {
+				uint32_t n = 256 - (address & 0xff);
+				if(n > len) n = len;
+				page_(address & 0xffffff00).set(address, src, n);
+				address += n;
+				src += n;
+				len -= n;
+			}
+		}
+
+
+		// アドレス順に並べて、索引を作り直す
+		void sort_() {
+			if(!sorted_) {
+				std::sort(pages_.begin(), pages_.end(),
+					[](const page_t& a, const page_t& b) { return a.adr_ < b.adr_; });
+				index_.clear();
+				for(uint32_t i = 0; i < pages_.size(); ++i) {
+					index_.emplace(pages_[i].adr_, i);
+				}
+				sorted_ = true;
+			}
+			last_adr_ = 1;
+		}
+
 
-			uint32_t value = 0;
-			uint32_t type = 0;
-			uint32_t length = 0;
-			uint32_t address = 0;
-			uint32_t sum = 0;
-			int vcnt = 0;
+		static void illegual_char_(const char* fmt, uint8_t ch) {
+			std::cerr << fmt << " illegual character: '";
+			if(ch >= 0x20 && ch <= 0x7f) {
+				std::cerr << static_cast<char>(ch);
+			} else {
+				std::cerr << boost::format("0x%02X") % static_cast<int>(ch);
+			}
+			std::cerr << "'" << std::endl;
+		}
+
+
+		// 16 進２文字を、len バイト分デコード（エラーなら、不正な文字の位置）
+		static const uint8_t* decode_(const uint8_t* p, const uint8_t* end, uint8_t* dst, uint32_t len) {
+			const int8_t* hex = hex_();
+			if(static_cast<size_t>(end - p) < (len * 2)) {
+				return p;
+			}
+			for(uint32_t i = 0; i < len; ++i) {
+				int8_t h = hex[p[0]];
+				int8_t l = hex[p[1]];
+				if((h | l) < 0) {
+					return h < 0 ? p : &p[1];
+				}
+				dst[i] = (h << 4) | l;
+				p += 2;
+			}
+			return nullptr;
+		}
+
+
+		static bool is_space_(uint8_t ch) {
+			return ch == ' ' || ch == '\t' || ch == 0x0d || ch == 0x0a;
+		}
+
+
+		bool load_motorola_(const uint8_t* p, const uint8_t* end) {
+			// タイプ毎のアドレス長（０は無効なタイプ）
+			static const uint8_t alen_[10] = { 2, 2, 3, 4, 0, 2, 3, 4, 3, 2 };
+
+			uint8_t rec[256];
+			while(p < end) {
+				if(is_space_(*p)) {
+					++p;
+					continue;
+				}
+				if(*p != 'S' || (end - p) < 4) {
+					illegual_char_("S format", *p);
+					return false;
+				}
+				uint32_t type = p[1] - '0';
+				if(type > 9 || alen_[type] == 0) {
+					return false;
+				}
+				p += 2;
+				auto err = decode_(p, end, rec, 1);
+				if(err != nullptr) {
+					illegual_char_("S format", err < end ? *err : ' ');
+					return false;
+				}
+				uint32_t length = rec[0];
+				uint32_t alen = alen_[type];
+				if(length < (alen + 1)) {
+					return false;
+				}
+				err = decode_(&p[2], end, &rec[1], length);
+				if(err != nullptr) {
+					illegual_char_("S format", err < end ? *err : ' ');
+					return false;
+				}
+				p += 2 + length * 2;
+
+				uint32_t sum = 0;
+				for(uint32_t i = 0; i < length; ++i) {
+					sum += rec[i];
+				}
+				sum ^= 0xff;
+				sum &= 0xff;
+				if(sum != rec[length]) {	// SUM エラー
+					std::cerr << "S format SUM error: ";
+					std::cerr << boost::format("0x%02X -> %02X")
+						% static_cast<int>(rec[length])
+						% static_cast<int>(sum)
+						<< std::endl;
+					return false;
+				}
+
+				uint32_t address = 0;
+				for(uint32_t i = 0; i < alen; ++i) {
+					address <<= 8;
+					address |= rec[1 + i];
+				}
+				uint32_t len = length - alen - 1;
+				if(type >= 1 && type <= 3) {
+					if(area_.min_ > address) area_.min_ = address;
+					if(len > 0) {
+						write_block_(address, &rec[1 + alen], len);
+						if(area_.max_ < (address + len - 1)) area_.max_ = address + len - 1;
+					}
+				} else if(type >= 7 && type <= 9) {
+					exec_ = address;
+					break;
+				}
+			}
+			return true;
+		}
+
+
+		bool load_intel_(const uint8_t* p, const uint8_t* end) {
+			uint8_t rec[256 + 5];
+			uint32_t base = 0;
+			while(p < end) {
+				if(is_space_(*p)) {
+					++p;
+					continue;
+				}
+				if(*p != ':') {
+					illegual_char_("Intel HEX", *p);
+					return false;
+				}
+				++p;
+				auto err = decode_(p, end, rec, 1);
+				if(err != nullptr) {
+					illegual_char_("Intel HEX", err < end ? *err : ' ');
+					return false;
+				}
+				uint32_t len = rec[0];
+				err = decode_(&p[2], end, &rec[1], len + 4);
+				if(err != nullptr) {
+					illegual_char_("Intel HEX", err < end ? *err : ' ');
+					return false;
+				}
+				p += 2 + (len + 4) * 2;
 
-			bool toend = false;
-			int mode = 0;
+				uint8_t sum = 0;
+				for(uint32_t i = 0; i < (len + 5); ++i) {
+					sum += rec[i];
+				}
+				if(sum != 0) {
+					std::cerr << "Intel HEX SUM error: ";
+					std::cerr << boost::format("0x%02X") % static_cast<int>(rec[len + 4]) << std::endl;
+					return false;
+				}
 
-			while(1) {
-				char ch;
-				if(!fio.get_char(ch)) {
+				uint32_t ofs = (static_cast<uint32_t>(rec[1]) << 8) | rec[2];
+				const uint8_t* dat = &rec[4];
+				switch(rec[3]) {
+				case 0x00:  // データ
+					if(len > 0) {
+						uint32_t address = base + ofs;
+						write_block_(address, dat, len);
+						if(area_.min_ > address) area_.min_ = address;
+						if(area_.max_ < (address + len - 1)) area_.max_ = address + len - 1;
+					}
 					break;
+				case 0x01:  // 終了
+					return true;
+				case 0x02:  // 拡張セグメント・アドレス
+					base = ((static_cast<uint32_t>(dat[0]) << 8) | dat[1]) << 4;
+					break;
+				case 0x03:  // スタート・セグメント・アドレス
+					exec_ = (((static_cast<uint32_t>(dat[0]) << 8) | dat[1]) << 4)
+						+ ((static_cast<uint32_t>(dat[2]) << 8) | dat[3]);
+					break;
+				case 0x04:  // 拡張リニア・アドレス
+					base = ((static_cast<uint32_t>(dat[0]) << 8) | dat[1]) << 16;
+					break;
+				case 0x05:  // スタート・リニア・アドレス
+					exec_ = (static_cast<uint32_t>(dat[0]) << 24) | (static_cast<uint32_t>(dat[1]) << 16)
+						| (static_cast<uint32_t>(dat[2]) << 8) | dat[3];
+					break;
+				default:
+					return false;
 				}
+			}
+			return true;
+		}
+
+
+		bool load_binary_(const uint8_t* p, size_t size, uint32_t org) {
+			if(size == 0 || size > 0x100000000ULL) return false;
+			if(org == 0) {  // 終端を 0xFFFFFFFF に合わせる（RX のコード・フラッシュ）
+				org = static_cast<uint32_t>(0x100000000ULL - size);
+			}
+			if((static_cast<uint64_t>(org) + size) > 0x100000000ULL) return false;
+			write_block_(org, p, size);
+			area_.min_ = org;
+			area_.max_ = org + size - 1;
+			return true;
+		}
+
+
+		// FNV-1a (64 bits)、８バイト単位で混ぜる
+		static uint64_t hash_(const uint8_t* p, size_t size, uint64_t h = 0xcbf29ce484222325ULL) {
+			size_t i = 0;
+			for(; (i + 8) <= size; i += 8) {
+				uint64_t w;
+				std::memcpy(&w, &p[i], 8);
+				h ^= w;
+				h *= 0x100000001b3ULL;
+				h ^= h >> 29;
+			}
+			for(; i < size; ++i) {
+				h ^= p[i];
+				h *= 0x100000001b3ULL;
+			}
+			return h;
+		}
+
+
+		struct cache_head {
+			char		magic_[8];
+			uint64_t	hash_;
+			uint32_t	exec_;
+			uint32_t	min_;
+			uint32_t	max_;
+			uint32_t	num_;
+		};
+
+		struct cache_page {
+			uint32_t	adr_;
+			uint32_t	min_;
+			uint32_t	max_;
+			uint8_t		data_[256];
+		};
+
+		static const char* cache_magic_() { return "RXIMG01"; }
+
+		std::string cache_path_(uint64_t hash) const {
+			return cache_dir_ + '/' + (boost::format("%016X.rxi") % hash).str();
+		}
+
+
+		bool load_cache_(uint64_t hash) {
+			auto path = cache_path_(hash);
+			std::FILE* fp = std::fopen(path.c_str(), "rb");
+			if(fp == nullptr) {
+				return false;
+			}
+			cache_head h;
+			bool ok = std::fread(&h, sizeof(h), 1, fp) == 1;
+			if(ok) {
+				ok = std::strncmp(h.magic_, cache_magic_(), sizeof(h.magic_)) == 0 && h.hash_ == hash;
+			}
+			if(ok) {
+				pages_.resize(h.num_);
+				for(uint32_t i = 0; i < h.num_; ++i) {
+					cache_page cp;
+					if(std::fread(&cp, sizeof(cp), 1, fp) != 1) {
+						ok = false;
+						break;
+					}
+					auto& pg = pages_[i];
+					pg.adr_ = cp.adr_;
+					pg.body_.area_.min_ = cp.min_;
+					pg.body_.area_.max_ = cp.max_;
+					std::memcpy(&pg.body_.array_[0], cp.data_, 256);
+					index_.emplace(cp.adr_, i);
+				}
+			}
+			std::fclose(fp);
+			if(!ok) {
+				clear_();
+				return false;
+			}
+			exec_ = h.exec_;
+			area_.min_ = h.min_;
+			area_.max_ = h.max_;
+			return true;
+		}
 
-			   	if(ch == ' ') {
-			   	} else if(ch == 0x0d || ch == 0x0a) {
-				   	if(toend) break;
-			   	} else if(mode == 0 && ch == 'S') {
-			   		mode = 1;
-			   		value = vcnt = 0;
-			   	} else if(ch >= '0' && ch <= '9') {
-			   		value <<= 4;
-			   		value |= ch - '0';
-			   		++vcnt;
-			   	} else if(ch >= 'A' && ch <= 'F') {
-			   		value <<= 4;
-			   		value |= ch - 'A' + 10;
-			   		++vcnt;
-			   	} else {
-					std::cerr << "S format illegual character: '";
-			   		if(ch >= 0x20 && ch <= 0x7f) {
-						std::cerr << ch;
-			   		} else {
-						std::cerr << boost::format("0x%02X") % static_cast<int>(ch);
-			   		}
-					std::cerr << "'" << std::endl;
-			   		return false;
-			   	}
-
-			   	if(mode == 1) {		// タイプ取得
-			   		if(vcnt == 1) {
-			   			type = value;
-			   			mode = 2;
-			   			value = vcnt = 0;
-			   		}
-			   	} else if(mode == 2) {	// レングス取得
-			   		if(vcnt == 2) {
-			   			length = value;
-			   			sum = value;
-			   			mode = 3;
-			   			value = vcnt = 0;
-			   		}
-			   	} else if(mode == 3) {	// アドレス取得
-			   		int alen = 0;
-			   		if(type == 0) {
-			   			alen = 4;
-			   		} else if(type == 1) {
-			   			alen = 4;
-			   		} else if(type == 2) {
-			   			alen = 6;
-			   		} else if(type == 3) {
-			   			alen = 8;
-			   		} else if(type == 5) {
-			   			alen = 4;
-			   		} else if(type == 7) {
-			   			alen = 8;
-			   		} else if(type == 8) {
-			   			alen = 6;
-			   		} else if(type == 9) {
-			   			alen = 4;
-			   		} else {
-			   			return false;
-			   		}
-
-			   		if(vcnt == alen) {
-			   			address = value;
-			   			if(type >= 1 && type <= 3) {
-			   				if(area_.min_ > address) area_.min_ = address;
-			   			}
-			   			alen >>= 1;
-			   			length -= alen;
-			   			length -= 1;	// SUM の分サイズを引く
-			   			while(alen > 0) {
-			   				sum += value;
-			   				value >>= 8;
-			   				--alen;
-			   			}
-				   		if(type >= 1 && type <= 3) {
-				   			mode = 4;
-				   		} else if(type >= 7 && type <= 9) {
-							exec_ = value;
-				   			mode = 5;
-				   		} else {
-				   			mode = 4;
-				   		}
-				   		value = vcnt = 0;
-				   	}
-			   	} else if(mode == 4) {	// データ・レコード
-			   		if(vcnt >= 2) {
-			   			if(type >= 1 && type <= 3) {
-			   				write_byte_(address, value);
-			   				if(area_.max_ < address) area_.max_ = address;
-			   				++address;
-			   			}
-			   			sum += value;
-			   			value = vcnt = 0;
-			   			--length;
-			   			if(length == 0) {
-			   				mode = 5;
-			   			}
-			   		}
-			   	} else if(mode == 5) {	// SUM
-			   		if(vcnt >= 2) {
-			   			value &= 0xff;
-			   			sum ^= 0xff;
-			   			sum &= 0xff;
-			   			if(sum != value) {	// SUM エラー
-							std::cerr << "S format SUM error: ";
-							std::cerr << boost::format("0x%02X -> %02X")
-							    % static_cast<int>(value)
-								% static_cast<int>(sum)
-								<< std::endl;
-			   				return false;
-			   			} else {
-			   				if(type >= 7 && type <= 9) {
-			   					toend = true;
-			   				}
-			   				mode = 0;
-			   				value = vcnt = 0;
-			   			}
-			   		}
-			   	}
-		   	}
-		   	return true;
+
+		void save_cache_(uint64_t hash) const {
+			if(!utils::probe_file(cache_dir_, true)) {
+				utils::create_directory(cache_dir_);
+			}
+			auto path = cache_path_(hash);
+			auto tmp = path + ".tmp";
+			std::FILE* fp = std::fopen(tmp.c_str(), "wb");
+			if(fp == nullptr) {
+				return;
+			}
+			cache_head h;
+			std::memset(&h, 0, sizeof(h));
+			std::strncpy(h.magic_, cache_magic_(), sizeof(h.magic_));
+			h.hash_ = hash;
+			h.exec_ = exec_;
+			h.min_ = area_.min_;
+			h.max_ = area_.max_;
+			h.num_ = pages_.size();
+			bool ok = std::fwrite(&h, sizeof(h), 1, fp) == 1;
+			for(const auto& pg : pages_) {
+				if(!ok) break;
+				cache_page cp;
+				cp.adr_ = pg.adr_;
+				cp.min_ = pg.body_.area_.min_;
+				cp.max_ = pg.body_.area_.max_;
+				std::memcpy(cp.data_, &pg.body_.array_[0], 256);
+				ok = std::fwrite(&cp, sizeof(cp), 1, fp) == 1;
+			}
+			std::fclose(fp);
+			if(ok) {
+				std::rename(tmp.c_str(), path.c_str());
+			} else {
+				std::remove(tmp.c_str());
+			}
 		}
 
 
-		bool save_(utils::file_io& fio, const memory_map::value_type& m) {
-			const array_t& a = m.second;
+		bool save_(utils::file_io& fio, const page_t& m) {
+			const array_t& a = m.body_;
 			fio.put_char('S');
 
 			uint8_t sum = 0;
@@ -254,33 +603,102 @@ namespace utils {
 			@brief	コンストラクター
 		*/
 		//-----------------------------------------------------------------//
-		motsx_io() : area_(), exec_(0x000000) {
+		motsx_io() : area_(), exec_(0x000000), pages_(), index_(),
+			last_adr_(1), last_idx_(0), sorted_(true) {
 			fill_array_.fill(0xff);
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	キャッシュ・ディレクトリーの設定
+			@param[in]	dir	ディレクトリー（空ならキャッシュしない）
+		*/
+		//-----------------------------------------------------------------//
+		void set_cache_dir(const std::string& dir) { cache_dir_ = dir; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ファイルのフォーマットを判定 @n
+					拡張子が「bin」ならバイナリー、それ以外は先頭の文字で判定
+			@param[in]	path	ファイルパス
+			@param[in]	top		ファイルの先頭
+			@param[in]	size	ファイルのサイズ
+			@return フォーマット
+		*/
+		//-----------------------------------------------------------------//
+		static format probe_format(const std::string& path, const uint8_t* top, size_t size) {
+			auto pos = path.rfind('.');
+			if(pos != std::string::npos) {
+				auto ext = path.substr(pos + 1);
+				if(ext == "bin" || ext == "BIN") return format::BINARY;
+			}
+			for(size_t i = 0; i < size; ++i) {
+				if(is_space_(top[i])) continue;
+				if(top[i] == 'S') return format::MOTOROLA;
+				else if(top[i] == ':') return format::INTEL_HEX;
+				break;
+			}
+			return format::NONE;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	ロード
 			@param[in]	path	ファイルパス
+			@param[in]	org		バイナリーの開始アドレス @n
+								０の場合、終端を 0xFFFFFFFF に合わせる
 			@return エラー無しなら「true」
 		*/
 		//-----------------------------------------------------------------//
-		bool load(const std::string& path) {
-			utils::file_io fio;
-			if(!fio.open(path, "rb")) {
+		bool load(const std::string& path, uint32_t org = 0) {
+			map_file mf;
+			if(!mf.open(path)) {
 				return false;
 			}
 
-			memory_map_.clear();
+			clear_();
 
-			if(!load_(fio)) {
+			auto fmt = probe_format(path, mf.get(), mf.size());
+			if(fmt == format::NONE) {
 				return false;
 			}
 
-			fio.close();
+			uint64_t hash = 0;
+			if(!cache_dir_.empty()) {
+				uint8_t key[5];
+				key[0] = static_cast<uint8_t>(fmt);
+				for(int i = 0; i < 4; ++i) key[1 + i] = org >> (i * 8);
+				hash = hash_(mf.get(), mf.size(), hash_(key, sizeof(key)));
+				if(load_cache_(hash)) {
+					return true;
+				}
+			}
 
-			return true;
+			const uint8_t* top = mf.get();
+			const uint8_t* end = top + mf.size();
+			bool ret = false;
+			switch(fmt) {
+			case format::MOTOROLA:
+				ret = load_motorola_(top, end);
+				break;
+			case format::INTEL_HEX:
+				ret = load_intel_(top, end);
+				break;
+			case format::BINARY:
+				ret = load_binary_(top, mf.size(), org);
+				break;
+			default:
+				break;
+			}
+			sort_();
+
+			if(ret && !cache_dir_.empty()) {
+				save_cache_(hash);
+			}
+			return ret;
 		}
 
 
@@ -292,14 +710,14 @@ namespace utils {
 		*/
 		//-----------------------------------------------------------------//
 		bool save(const std::string& path) {
-			if(memory_map_.empty()) return false;
+			if(pages_.empty()) return false;
 
 			utils::file_io fio;
 			if(!fio.open(path, "wb")) {
 				return false;
 			}
 
-			for(const auto& m : memory_map_) {
+			for(const auto& m : pages_) {
 				if(!save_(fio, m)) {
 					return false;
 				}
@@ -320,9 +738,8 @@ namespace utils {
 		*/
 		//-----------------------------------------------------------------//
 		void write(uint32_t address, const uint8_t* data, uint32_t len) {
-			for(uint32_t i = 0; i < len; ++i) {
-				write_byte_(address + i, data[i]);
-			}
+			write_block_(address, data, len);
+			sort_();
 		}
 
 
@@ -333,7 +750,7 @@ namespace utils {
 		*/
 		//-----------------------------------------------------------------//
 		uint32_t get_total_page() const {
-			return memory_map_.size();
+			return pages_.size();
 		}
 
 
@@ -345,14 +762,14 @@ namespace utils {
 		//-----------------------------------------------------------------//
 		areas create_area_map() const {
 			areas as;
-			for(const auto& m : memory_map_) {
+			for(const auto& m : pages_) {
 				if(as.empty()) {
-					as.emplace_back(m.second.area_);
+					as.emplace_back(m.body_.area_);
 				} else {
-					if((as.back().max_ + 1) == m.second.area_.min_) {
-						as.back().max_ = m.second.area_.max_;
+					if((as.back().max_ + 1) == m.body_.area_.min_) {
+						as.back().max_ = m.body_.area_.max_;
 					} else {
-						as.emplace_back(m.second.area_);
+						as.emplace_back(m.body_.area_);
 					}
 				}
 			}
@@ -360,6 +777,39 @@ namespace utils {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ページ・リストの作成（アドレス順）
+			@param[in]	blank	全て 0xFF のページを含めない場合「false」
+			@return ページ（先頭アドレス）のリスト
+		*/
+		//-----------------------------------------------------------------//
+		pages create_page_list(bool blank = true) const {
+			pages ps;
+			ps.reserve(pages_.size());
+			for(const auto& m : pages_) {
+				if(!blank && is_blank(m.body_.array_)) continue;
+				ps.push_back(m.adr_);
+			}
+			return ps;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ブランク（全て 0xFF）か検査
+			@param[in]	a	ページメモリー
+			@return ブランクなら「true」
+		*/
+		//-----------------------------------------------------------------//
+		static bool is_blank(const array& a) {
+			for(auto v : a) {
+				if(v != 0xff) return false;
+			}
+			return true;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	エリア・マップの表示
@@ -408,7 +858,7 @@ namespace utils {
 		*/
 		//-----------------------------------------------------------------//
 		bool find_page(uint32_t address) const {
-			return memory_map_.find(address & 0xffff00) != memory_map_.end();
+			return index_.find(address & 0xffffff00) != index_.end();
 		}
 
 
@@ -421,11 +871,11 @@ namespace utils {
 		*/
 		//-----------------------------------------------------------------//
 		const array& get_memory(uint32_t address) const {
-			memory_map::const_iterator cit = memory_map_.find(address & 0xffff00);
-			if(cit == memory_map_.end()) {
+			auto cit = index_.find(address & 0xffffff00);
+			if(cit == index_.end()) {
 				return fill_array_;
 			}
-			return cit->second.array_;
+			return pages_[cit->second].body_.array_;
 		}
 	};
 }
@@ -15,6 +15,7 @@
 #include <unistd.h>
 #include <limits.h>
 #include <sys/ioctl.h>
+#include <errno.h>
 
 #include <string>
 #include <iostream>
@@ -175,7 +176,7 @@ namespace utils {
 			}
 
 			int status;
-			if(ioctl(fd_, TIOCMGET, &status) == -1) {
+			if(ioctl(fd_, TIOCMGET, &status) == -1 && errno != ENOTTY) {  // PTY にはモデム信号が無い
 				close_();
 				return false;
 			}
@@ -218,8 +219,9 @@ namespace utils {
 
 			int status;
 			if(ioctl(fd_, TIOCMGET, &status) == -1) {
+				bool pty = errno == ENOTTY;
 				close_();
-				return false;
+				return pty;
 			}
 
 			status &= ~TIOCM_DTR;    /* turn off DTR */
@@ -447,7 +449,7 @@ namespace utils {
 
 			int status;
 			if(ioctl(fd_, TIOCMGET, &status) == -1) {
-				return false;
+				return errno == ENOTTY;
 			}
 
 			if(ena) status |= TIOCM_DTR;
@@ -473,7 +475,7 @@ namespace utils {
 
 			int status;
 			if(ioctl(fd_, TIOCMGET, &status) == -1) {
-				return false;
+				return errno == ENOTTY;
 			}
 
 			if(ena) status |= TIOCM_RTS;
@@ -46,6 +46,8 @@ namespace rx72t {
 		typedef std::set<uint32_t> erase_map;
 		erase_map erase_map_;
 
+		bool				crc_enable_ = true;
+
 //		uint8_t				last_error_ = 0;
 
 
@@ -131,6 +133,28 @@ namespace rx72t {
 		}
 
 
+		static uint32_t frame_(uint8_t* dst, uint8_t soh, uint8_t cmd, uint8_t ext, const uint8_t* src, uint32_t len) {
+			dst[0] = soh;
+			put16_big_(&dst[1], 1 + len);
+			dst[3] = cmd;
+			std::memcpy(&dst[4], src, len);
+			dst[4 + len] = sum_(&dst[1], 3 + len);
+			dst[4 + len + 1] = ext;
+			return 4 + len + 2;
+		}
+
+
+		// 応答が崩れた場合、受信を捨てて同期コマンドで復帰
+		bool resync_() {
+			usleep(10000);	// 10[ms]
+			rs232c_.flush();
+			if(!command_(0x00)) {
+				return false;
+			}
+			return status_(0x00);
+		}
+
+
 		bool status_sub_(uint8_t* dst) {
 			if(!read_(dst, 4)) {
 				return false;
@@ -359,6 +383,7 @@ namespace rx72t {
 
 			pe_turn_on_ = true;			
 			erase_map_.clear();
+			crc_enable_ = true;
 
 			return true;
 		}
@@ -786,6 +811,167 @@ namespace rx72t {
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	消去ブロックのサイズを取得
+			@param[in]	address	アドレス
+			@return 消去ブロックのサイズ
+		*/
+		//-----------------------------------------------------------------//
+		static uint32_t get_block_size(uint32_t address) {
+			if(address >= 0xFFFF0000) {  // 8K block
+				return 8192;
+			} else if(address >= 0xFFC00000) {  // 32K block
+				return 32768;
+			}
+			return 256;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	イレース・ブロック（ブロック全体のブランク・チェック後、必要なら消去）
+			@param[in]	address	アドレス
+			@param[out]	erase	消去した場合「true」
+			@return エラー無ければ「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool erase_block(uint32_t address, bool& erase) {
+			if(!connection_) return false;
+			if(!pe_turn_on_) return false;
+
+			erase = false;
+			auto size = get_block_size(address);
+			auto org = address & ~(size - 1);
+			uint8_t tmp[8];
+			put32_big_(&tmp[0], org);
+			put32_big_(&tmp[4], org + size - 1);
+			if(!command_(0x10, tmp, sizeof(tmp))) {
+				return false;
+			}
+			uint8_t res;
+			uint8_t err;
+			if(!response_(res, err)) {
+				return false;
+			}
+			if(res == 0x10) return true;  // blank
+			else if(res != 0x90 || err != 0xe0) {
+				return false;
+			}
+
+			if(!command_(0x12, tmp, 4)) {  // erase command
+				return false;
+			}
+			if(!response_(res, err)) {
+				return false;
+			}
+			if(res == 0x92) {
+				std::cout << boost::format("Erase response: %02X") % static_cast<uint32_t>(err)
+					<< std::endl;
+				return false;
+			} else if(res != 0x12) {
+				return false;
+			}
+			erase = true;
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ライト・エリア（連続したページを、一つの書き込みコマンドで送る）@n
+					送信中に次のデータ・フレームを作る（ダブル・バッファ）
+			@param[in]	address	アドレス（２５６バイト境界）
+			@param[in]	src	ライト・データ
+			@param[in]	len	長さ（２５６の倍数）
+			@return エラー無ければ「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool write_area(uint32_t address, const uint8_t* src, uint32_t len) {
+			if(!connection_) return false;
+			if(!pe_turn_on_) return false;
+			if(!select_write_area_) return false;
+			if(len == 0 || (address & 255) != 0 || (len & 255) != 0) return false;
+
+			static const uint32_t FRAME_MAX = 1024;
+
+			uint8_t tmp[8];
+			put32_big_(&tmp[0], address);
+			put32_big_(&tmp[4], address + len - 1);
+			if(!command_(0x13, tmp, sizeof(tmp))) {
+				return false;
+			}
+
+			if(!status_(0x13)) {
+				return false;
+			}
+
+			uint8_t frame[2][4 + FRAME_MAX + 2];
+			uint32_t idx = 0;
+			uint32_t pos = 0;
+			uint32_t n = std::min(len, FRAME_MAX);
+			uint32_t fl = frame_(frame[idx], 0x81, 0x13, 0x03, src, n);
+			while(pos < len) {
+				if(rs232c_.send(frame[idx], fl) != fl) {
+					return false;
+				}
+				auto adr = address + pos;
+				pos += n;
+				// 応答待ちの前に、次のフレームを作る
+				if(pos < len) {
+					n = std::min(len - pos, FRAME_MAX);
+					fl = frame_(frame[idx ^ 1], 0x81, 0x13, 0x03, &src[pos], n);
+				}
+				uint8_t res;
+				uint8_t err;
+				if(!response_(res, err)) {
+					return false;
+				}
+				if(res == 0x93) { // write error
+					std::cerr << std::endl;
+					std::cerr << boost::format("Write error (%08X), status: %02X")
+						% adr % static_cast<uint32_t>(err) << std::endl;
+					return false;
+				} else if(res != 0x13) {
+					return false;
+				}
+				idx ^= 1;
+			}
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	デバイス側の CRC-32 を取得 @n
+					応答が無い、又は、エラーの場合、同期をやり直し、以降は使わない
+			@param[in]	address	アドレス
+			@param[in]	len	長さ
+			@param[out]	crc	CRC-32
+			@return エラー無ければ「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool crc_area(uint32_t address, uint32_t len, uint32_t& crc) {
+			if(!connection_) return false;
+			if(!pe_turn_on_) return false;
+			if(!crc_enable_) return false;
+
+			uint8_t tmp[8];
+			put32_big_(&tmp[0], address);
+			put32_big_(&tmp[4], address + len - 1);
+			if(!command_(0x18, tmp, sizeof(tmp))) {
+				return false;
+			}
+			if(!status_data_(0x18, tmp, 4)) {
+				crc_enable_ = false;
+				resync_();
+				return false;
+			}
+			crc = get32_big_(&tmp[0]);
+			return true;
+		}
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	終了
@@ -26,6 +26,7 @@ namespace rx {
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
 	class prog {
 		bool		verbose_;
+		bool		crc_;
 
 		typedef utils::rs232c_io RS232C;
 		RS232C		rs232c_;
@@ -108,6 +109,76 @@ namespace rx {
 		};
 
 
+		// パイプライン・モード（RX63T、RX24T は未対応）
+		struct pipeline_visitor {
+			using result_type = bool;
+
+    		template <class T>
+    		bool operator()(T& x) { return true; }
+    		bool operator()(rx63t::protocol& x) { return false; }
+    		bool operator()(rx24t::protocol& x) { return false; }
+		};
+
+
+		struct block_size_visitor {
+			using result_type = uint32_t;
+
+			uint32_t adr_;
+			block_size_visitor(uint32_t adr) : adr_(adr) { }
+
+    		template <class T>
+    		uint32_t operator()(T& x) { return x.get_block_size(adr_); }
+    		uint32_t operator()(rx63t::protocol& x) { return 256; }
+    		uint32_t operator()(rx24t::protocol& x) { return 256; }
+		};
+
+
+		struct erase_block_visitor {
+			using result_type = bool;
+
+			uint32_t adr_;
+			bool& erase_;
+			erase_block_visitor(uint32_t adr, bool& erase) : adr_(adr), erase_(erase) { }
+
+    		template <class T>
+    		bool operator()(T& x) { return x.erase_block(adr_, erase_); }
+    		bool operator()(rx63t::protocol& x) { return false; }
+    		bool operator()(rx24t::protocol& x) { return false; }
+		};
+
+
+		struct write_area_visitor {
+			using result_type = bool;
+
+			uint32_t adr_;
+			const uint8_t* src_;
+			uint32_t len_;
+			write_area_visitor(uint32_t adr, const uint8_t* src, uint32_t len) :
+				adr_(adr), src_(src), len_(len) { }
+
+    		template <class T>
+    		bool operator()(T& x) { return x.write_area(adr_, src_, len_); }
+    		bool operator()(rx63t::protocol& x) { return false; }
+    		bool operator()(rx24t::protocol& x) { return false; }
+		};
+
+
+		struct crc_area_visitor {
+			using result_type = bool;
+
+			uint32_t adr_;
+			uint32_t len_;
+			uint32_t& crc_;
+			crc_area_visitor(uint32_t adr, uint32_t len, uint32_t& crc) :
+				adr_(adr), len_(len), crc_(crc) { }
+
+    		template <class T>
+    		bool operator()(T& x) { return x.crc_area(adr_, len_, crc_); }
+    		bool operator()(rx63t::protocol& x) { return false; }
+    		bool operator()(rx24t::protocol& x) { return false; }
+		};
+
+
 		struct end_visitor {
 			using result_type = void;
 
@@ -123,7 +194,7 @@ namespace rx {
 			@brief	コンストラクター
 		*/
 		//-------------------------------------------------------------//
-		prog(bool verbose = false) : verbose_(verbose) { }
+		prog(bool verbose = false) : verbose_(verbose), crc_(true) { }
 
 
 		//-------------------------------------------------------------//
@@ -290,6 +361,114 @@ namespace rx {
 		}
 
 
+		//-------------------------------------------------------------//
+		/*!
+			@brief	パイプライン・モードが使えるか
+			@return 使える場合「true」
+		*/
+		//-------------------------------------------------------------//
+		bool is_pipeline() {
+			pipeline_visitor vis;
+           	return boost::apply_visitor(vis, protocol_);
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	消去ブロックのサイズを取得
+			@param[in]	adr	アドレス
+			@return 消去ブロックのサイズ
+		*/
+		//-------------------------------------------------------------//
+		uint32_t get_block_size(uint32_t adr) {
+			block_size_visitor vis(adr);
+           	return boost::apply_visitor(vis, protocol_);
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	ブロック消去（ブランクなら消去しない）
+			@param[in]	adr		ブロック内のアドレス
+			@param[out]	erase	消去した場合「true」
+			@return 成功なら「true」
+		*/
+		//-------------------------------------------------------------//
+		bool erase_block(uint32_t adr, bool& erase) {
+			erase_block_visitor vis(adr, erase);
+           	if(!boost::apply_visitor(vis, protocol_)) {
+				end();
+				std::cerr << std::endl << boost::format("Erase block error: %08X") % adr << std::endl;
+				return false;
+			}
+			return true;
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	連続したページのライト（start_write 後に呼ぶ）
+			@param[in]	adr	開始アドレス
+			@param[in]	src	書き込みデータ
+			@param[in]	len	長さ（２５６の倍数）
+			@return 成功なら「true」
+		*/
+		//-------------------------------------------------------------//
+		bool write_area(uint32_t adr, const uint8_t* src, uint32_t len) {
+			write_area_visitor vis(adr, src, len);
+           	if(!boost::apply_visitor(vis, protocol_)) {
+				end();
+				std::cerr << "Write area error." << std::endl;
+				return false;
+			}
+			return true;
+		}
+
+
+		//-------------------------------------------------------------//
+		/*!
+			@brief	連続したページのベリファイ @n
+					デバイス側の CRC-32 で照合し、使えない場合はリード・バックで照合する。@n
+					CRC が一致せず、リード・バックが一致した場合、以降はリード・バックのみ。
+			@param[in]	adr	開始アドレス
+			@param[in]	src	照合データ
+			@param[in]	len	長さ（２５６の倍数）
+			@return 成功なら「true」
+		*/
+		//-------------------------------------------------------------//
+		bool verify_area(uint32_t adr, const uint8_t* src, uint32_t len) {
+			bool crc_ng = false;
+			if(crc_) {
+				uint32_t crc = 0;
+				crc_area_visitor vis(adr, len, crc);
+				if(boost::apply_visitor(vis, protocol_)) {
+					if(crc == rx::protocol::crc32(src, len)) {
+						return true;
+					}
+					crc_ng = true;
+				} else {
+					crc_ = false;
+					if(verbose_) {
+						std::cout << std::endl << "# Device CRC not available, use read back." << std::endl;
+					}
+				}
+			}
+
+			for(uint32_t i = 0; i < len; i += 256) {
+				if(!verify_page(adr + i, &src[i])) {
+					return false;
+				}
+			}
+			if(crc_ng) {
+				crc_ = false;
+				if(verbose_) {
+					std::cout << std::endl << "# Device CRC mismatch method, use read back." << std::endl;
+				}
+			}
+			return true;
+		}
+
+
 		//-------------------------------------------------------------//
 		/*!
 			@brief	終了
@@ -175,5 +175,27 @@ namespace rx {
 			uint32_t	sys_div_ = 8;	///< システム・ディバイダー設定
 			uint32_t	ext_div_ = 4;	///< 周辺ディバイダー設定
 		};
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	CRC-32 の計算（デバイス側チェックサムとの照合用）
+			@param[in]	src	ソース
+			@param[in]	len	長さ
+			@param[in]	crc	継続する場合、前回の値
+			@return CRC-32
+		*/
+		//-----------------------------------------------------------------//
+		static uint32_t crc32(const uint8_t* src, uint32_t len, uint32_t crc = 0)
+		{
+			crc = ~crc;
+			for(uint32_t i = 0; i < len; ++i) {
+				crc ^= *src++;
+				for(int j = 0; j < 8; ++j) {
+					crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+				}
+			}
+			return ~crc;
+		}
 	};
 }
@@ -0,0 +1,386 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	RX64M ブート・モード（シリアル・プログラミング）シミュレーター @n
+			・疑似端末（PTY）のマスター側で、ブート・プロトコルに応答する。@n
+			  rx_prog には、スレーブ側のパス（get_path）をポートとして渡す。@n
+			・ROM（0xFFE00000 ～ 0xFFFFFFFF、２M バイト）をメモリーに持つ。@n
+			  消去ブロックは、0xFFFF0000 以降が 8K、それ以外は 32K バイト。@n
+			・ブランク・チェック（0x10）、ブロック消去（0x12）、書き込み @n
+			  （0x13）、読み出し（0x15）、CRC-32（0x18）に応答する。@n
+			・オプションで、消去されていない ROM、CRC コマンド無し、書き込み @n
+			  エラー、固着ビット（照合エラー）を模擬する。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <poll.h>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <array>
+#include <thread>
+#include <atomic>
+
+namespace rx {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	ブート・モード・シミュレーター・クラス
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class boot_sim {
+	public:
+		static const uint32_t ROM_ORG  = 0xFFE00000;
+		static const uint32_t ROM_SIZE = 0x200000;
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	模擬する不具合
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct option {
+			bool		dirty;		///< ROM が消去されていない（乱数）
+			bool		no_crc;		///< CRC-32（0x18）をエラーで返す
+			uint32_t	fail_write;	///< この量を書いたら、書き込みエラー（０なら無し）
+			uint32_t	stuck;		///< このアドレスのビット０が「１」に固着（０なら無し）
+
+			option() : dirty(false), no_crc(false), fail_write(0), stuck(0) { }
+		};
+
+	private:
+		option		opt_;
+		int			master_;
+		int			slave_;
+		std::string	path_;
+
+		std::vector<uint8_t>		rom_;
+		std::array<uint32_t, 256>	count_;
+		uint32_t	written_;
+
+		std::thread			thread_;
+		std::atomic<bool>	stop_;
+
+		static uint32_t get32_(const uint8_t* p) noexcept
+		{
+			return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16)
+				| (static_cast<uint32_t>(p[2]) << 8) | p[3];
+		}
+
+		static uint8_t sum_(const uint8_t* p, uint32_t len) noexcept
+		{
+			uint32_t sum = 0;
+			for(uint32_t i = 0; i < len; ++i) sum += p[i];
+			return (0 - sum) & 0xff;
+		}
+
+		static uint32_t crc32_(const uint8_t* p, uint32_t len) noexcept
+		{
+			uint32_t crc = 0xffffffff;
+			for(uint32_t i = 0; i < len; ++i) {
+				crc ^= p[i];
+				for(int j = 0; j < 8; ++j) {
+					crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+				}
+			}
+			return ~crc;
+		}
+
+		// 停止要求か、ホストが閉じたら「false」
+		bool read_(void* dst, uint32_t len) noexcept
+		{
+			auto p = static_cast<uint8_t*>(dst);
+			while(len > 0) {
+				pollfd fd = { master_, POLLIN, 0 };
+				int n = poll(&fd, 1, 50);
+				if(stop_) return false;
+				if(n <= 0) continue;
+				auto l = ::read(master_, p, len);
+				if(l <= 0) return false;
+				p += l;
+				len -= l;
+			}
+			return true;
+		}
+
+		void write_(const void* src, uint32_t len) noexcept
+		{
+			auto p = static_cast<const uint8_t*>(src);
+			while(len > 0) {
+				auto l = ::write(master_, p, len);
+				if(l <= 0) return;
+				p += l;
+				len -= l;
+			}
+		}
+
+		void frame_(uint8_t res, const uint8_t* src = nullptr, uint32_t len = 0) noexcept
+		{
+			std::vector<uint8_t> tmp(4 + len + 2);
+			tmp[0] = 0x81;
+			tmp[1] = (len + 1) >> 8;
+			tmp[2] = (len + 1) & 0xff;
+			tmp[3] = res;
+			if(len > 0) std::memcpy(&tmp[4], src, len);
+			tmp[4 + len] = sum_(&tmp[1], 3 + len);
+			tmp[4 + len + 1] = 0x03;
+			write_(&tmp[0], tmp.size());
+		}
+
+		void status_(uint8_t res) noexcept { frame_(res); }
+
+		void error_(uint8_t res, uint8_t err) noexcept { frame_(res, &err, 1); }
+
+		// コマンド、データ・フレームの受信
+		bool recv_(uint8_t& cmd, std::vector<uint8_t>& data) noexcept
+		{
+			uint8_t head[4];
+			if(!read_(head, 4)) return false;
+			uint32_t l = (static_cast<uint32_t>(head[1]) << 8) | head[2];
+			std::vector<uint8_t> tmp(l + 1);
+			if(!read_(&tmp[0], tmp.size())) return false;
+			cmd = head[3];
+			data.assign(tmp.begin(), tmp.begin() + (l - 1));
+			return true;
+		}
+
+		// ステータスのエコー・バック
+		bool echo_() noexcept
+		{
+			uint8_t tmp[7];
+			return read_(tmp, sizeof(tmp));
+		}
+
+		uint32_t index_(uint32_t adr) const noexcept { return adr - ROM_ORG; }
+
+		bool in_rom_(uint32_t org, uint32_t end) const noexcept
+		{
+			return org >= ROM_ORG && end >= org;
+		}
+
+		void connect_() noexcept
+		{
+			while(1) {
+				uint8_t ch;
+				if(!read_(&ch, 1)) return;
+				if(ch == 0x00) {
+					write_(&ch, 1);
+				} else if(ch == 0x55) {
+					ch = 0xC1;
+					write_(&ch, 1);
+					break;
+				}
+			}
+
+			uint8_t cmd;
+			std::vector<uint8_t> d;
+			while(recv_(cmd, d)) {
+				++count_[cmd];
+				if(!command_(cmd, d)) break;
+			}
+		}
+
+		bool command_(uint8_t cmd, const std::vector<uint8_t>& d) noexcept
+		{
+			switch(cmd) {
+			case 0x00:  // 同期
+			case 0x34:  // ボーレート
+			case 0x36:  // エンディアン
+				status_(cmd);
+				break;
+			case 0x38:  // デバイス・タイプ
+				{
+					status_(cmd);
+					if(!echo_()) return false;
+					uint8_t tmp[24] = { 'R', 'X', '6', '4', 'M', 'S', 'I', 'M' };
+					frame_(cmd, tmp, sizeof(tmp));
+				}
+				break;
+			case 0x32:  // 周波数
+				status_(cmd);
+				if(!echo_()) return false;
+				frame_(cmd, &d[0], d.size());
+				break;
+			case 0x2C:  // ID 認証状態
+				{
+					status_(cmd);
+					if(!echo_()) return false;
+					uint8_t tmp = 0xff;
+					frame_(cmd, &tmp, 1);
+				}
+				break;
+			case 0x10:  // ブランク・チェック
+				{
+					auto org = get32_(&d[0]);
+					auto end = get32_(&d[4]);
+					bool blank = in_rom_(org, end);
+					for(uint32_t i = 0; blank && i < (end - org + 1); ++i) {
+						if(rom_[index_(org + i)] != 0xff) blank = false;
+					}
+					if(blank) status_(0x10);
+					else error_(0x90, 0xE0);
+				}
+				break;
+			case 0x12:  // ブロック消去
+				{
+					auto org = get32_(&d[0]);
+					uint32_t sz = org >= 0xFFFF0000 ? 8192 : 32768;
+					org &= ~(sz - 1);
+					std::memset(&rom_[index_(org)], 0xff, sz);
+					status_(0x12);
+				}
+				break;
+			case 0x13:  // 書き込み
+				{
+					auto org = get32_(&d[0]);
+					auto end = get32_(&d[4]);
+					status_(0x13);
+					// 終端が 0xFFFFFFFF の場合があるので、長さで数える
+					uint32_t len = end - org + 1;
+					uint32_t pos = 0;
+					while(pos < len) {
+						uint8_t c;
+						std::vector<uint8_t> dd;
+						if(!recv_(c, dd) || c != 0x13) return false;
+						if(opt_.fail_write > 0 && written_ >= opt_.fail_write) {
+							error_(0x93, 0x10);
+							break;
+						}
+						uint32_t p = org + pos;
+						for(uint32_t i = 0; i < dd.size(); ++i) {
+							auto& m = rom_[index_(p + i)];
+							m &= dd[i];  // 消去せずに書いた場合は、壊れる
+							if(opt_.stuck != 0 && (p + i) == opt_.stuck) m |= 1;
+						}
+						pos += dd.size();
+						written_ += dd.size();
+						status_(0x13);
+					}
+				}
+				break;
+			case 0x15:  // 読み出し
+				{
+					auto org = get32_(&d[0]);
+					auto end = get32_(&d[4]);
+					status_(0x15);
+					uint8_t c;
+					std::vector<uint8_t> dd;
+					if(!recv_(c, dd)) return false;
+					frame_(0x15, &rom_[index_(org)], end - org + 1);
+				}
+				break;
+			case 0x18:  // CRC-32
+				{
+					if(opt_.no_crc) {
+						error_(0x98, 0x01);
+						break;
+					}
+					auto org = get32_(&d[0]);
+					auto end = get32_(&d[4]);
+					auto crc = crc32_(&rom_[index_(org)], end - org + 1);
+					uint8_t tmp[4] = { static_cast<uint8_t>(crc >> 24), static_cast<uint8_t>(crc >> 16),
+						static_cast<uint8_t>(crc >> 8), static_cast<uint8_t>(crc) };
+					frame_(0x18, tmp, sizeof(tmp));
+				}
+				break;
+			default:
+				return false;
+			}
+			return true;
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター
+			@param[in]	opt		模擬する不具合
+		*/
+		//-----------------------------------------------------------------//
+		boot_sim(const option& opt = option()) : opt_(opt), master_(-1), slave_(-1), path_(),
+			rom_(ROM_SIZE, 0xff), count_(), written_(0), thread_(), stop_(false)
+		{
+			count_.fill(0);
+			if(opt_.dirty) {
+				for(auto& v : rom_) v = rand();
+			}
+		}
+
+
+		~boot_sim() { stop(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	開始（PTY を開き、応答スレッドを起動）
+			@return 成功なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool start()
+		{
+			master_ = posix_openpt(O_RDWR | O_NOCTTY);
+			if(master_ < 0) return false;
+			if(grantpt(master_) != 0 || unlockpt(master_) != 0) return false;
+			path_ = ptsname(master_);
+			// スレーブを開いたままにして、ホストが閉じても EIO にしない
+			slave_ = open(path_.c_str(), O_RDWR | O_NOCTTY);
+			if(slave_ < 0) return false;
+			termios t;
+			tcgetattr(slave_, &t);
+			cfmakeraw(&t);
+			tcsetattr(slave_, TCSANOW, &t);
+
+			thread_ = std::thread([this]() { connect_(); });
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	停止
+		*/
+		//-----------------------------------------------------------------//
+		void stop()
+		{
+			stop_ = true;
+			if(thread_.joinable()) thread_.join();
+			if(slave_ >= 0) { close(slave_); slave_ = -1; }
+			if(master_ >= 0) { close(master_); master_ = -1; }
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	スレーブ側のパスを取得
+			@return パス
+		*/
+		//-----------------------------------------------------------------//
+		const std::string& get_path() const noexcept { return path_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	ROM の参照
+			@param[in]	adr	アドレス
+			@return ROM の値
+		*/
+		//-----------------------------------------------------------------//
+		uint8_t get_rom(uint32_t adr) const noexcept { return rom_[index_(adr)]; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コマンドを受けた回数を取得
+			@param[in]	cmd	コマンド
+			@return 回数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_count(uint8_t cmd) const noexcept { return count_[cmd]; }
+	};
+}
@@ -0,0 +1,272 @@
+//=====================================================================//
+/*!	@file
+	@brief	motsx_io（S フォーマット、インテル HEX、バイナリーのロード）の @n
+			ホスト・テスト、ベンチマーク @n
+			rxprog ディレクトリーで実行する。@n
+			・４M バイト（途中に空き）の合成イメージを、３つの形式で書き、@n
+			  ロードした内容が一致する事 @n
+			・実行アドレス、エリア、ページ数 @n
+			・キャッシュから読んだイメージが一致する事 @n
+			・それぞれのロード速度（表示）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include "rxprog/motsx_io.hpp"
+#include "sim_test/check.hpp"
+
+namespace {
+
+	static const uint32_t ORG  = 0xFFC00000;
+	static const uint32_t SIZE = 4 * 1024 * 1024;
+	static const uint32_t GAP_ORG = 0xFFD00000;	///< 書かない領域
+	static const uint32_t GAP_END = 0xFFD10000;
+	static const uint32_t EXEC = 0xFFFFFFFC;
+
+	const char* mot_path_ = "test/release/bench.mot";
+	const char* hex_path_ = "test/release/bench.hex";
+	const char* bin_path_ = "test/release/bench.bin";
+	const char* cache_dir_ = "test/release/cache";
+
+	std::vector<uint8_t>	image_(SIZE);
+
+	void make_image_() noexcept
+	{
+		uint32_t x = 2463534242;
+		for(uint32_t i = 0; i < SIZE; ++i) {
+			uint32_t a = ORG + i;
+			if(a >= GAP_ORG && a < GAP_END) {
+				image_[i] = 0xff;
+				continue;
+			}
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			image_[i] = x;
+		}
+	}
+
+
+	bool in_gap_(uint32_t a) noexcept { return a >= GAP_ORG && a < GAP_END; }
+
+
+	// 16 進２桁を追加
+	void put_hex_(std::string& s, uint32_t v) noexcept
+	{
+		static const char hex[] = "0123456789ABCDEF";
+		s += hex[(v >> 4) & 15];
+		s += hex[v & 15];
+	}
+
+
+	bool save_(const char* path, const std::string& s) noexcept
+	{
+		FILE* fp = fopen(path, "wb");
+		if(fp == nullptr) return false;
+		bool ok = fwrite(s.data(), 1, s.size(), fp) == s.size();
+		fclose(fp);
+		return ok;
+	}
+
+
+	// S3 レコード（３２バイト）、S7 で終わる
+	bool save_mot_() noexcept
+	{
+		std::string s;
+		s.reserve(SIZE * 2 + SIZE / 2);
+		for(uint32_t i = 0; i < SIZE; i += 32) {
+			uint32_t a = ORG + i;
+			if(in_gap_(a)) continue;
+			s += "S3";
+			uint32_t sum = 32 + 5;
+			put_hex_(s, 32 + 5);
+			for(int j = 3; j >= 0; --j) {
+				put_hex_(s, a >> (j * 8));
+				sum += (a >> (j * 8)) & 0xff;
+			}
+			for(uint32_t j = 0; j < 32; ++j) {
+				put_hex_(s, image_[i + j]);
+				sum += image_[i + j];
+			}
+			put_hex_(s, ~sum);
+			s += "\r\n";
+		}
+		s += "S705";
+		uint32_t sum = 5;
+		for(int j = 3; j >= 0; --j) {
+			put_hex_(s, EXEC >> (j * 8));
+			sum += (EXEC >> (j * 8)) & 0xff;
+		}
+		put_hex_(s, ~sum);
+		s += "\r\n";
+		return save_(mot_path_, s);
+	}
+
+
+	void put_ihex_(std::string& s, uint32_t type, uint32_t ofs, const uint8_t* src, uint32_t len) noexcept
+	{
+		s += ':';
+		uint32_t sum = len + (ofs >> 8) + (ofs & 0xff) + type;
+		put_hex_(s, len);
+		put_hex_(s, ofs >> 8);
+		put_hex_(s, ofs);
+		put_hex_(s, type);
+		for(uint32_t i = 0; i < len; ++i) {
+			put_hex_(s, src[i]);
+			sum += src[i];
+		}
+		put_hex_(s, -sum);
+		s += "\r\n";
+	}
+
+
+	// データ（３２バイト）、拡張リニア・アドレス、開始リニア・アドレス、終了
+	bool save_hex_() noexcept
+	{
+		std::string s;
+		s.reserve(SIZE * 2 + SIZE / 2);
+		uint32_t upper = 1;
+		for(uint32_t i = 0; i < SIZE; i += 32) {
+			uint32_t a = ORG + i;
+			if(in_gap_(a)) continue;
+			if((a >> 16) != upper) {
+				upper = a >> 16;
+				uint8_t t[2] = { static_cast<uint8_t>(upper >> 8), static_cast<uint8_t>(upper) };
+				put_ihex_(s, 4, 0, t, 2);
+			}
+			put_ihex_(s, 0, a & 0xffff, &image_[i], 32);
+		}
+		uint8_t t[4] = { static_cast<uint8_t>(EXEC >> 24), static_cast<uint8_t>(EXEC >> 16),
+			static_cast<uint8_t>(EXEC >> 8), static_cast<uint8_t>(EXEC) };
+		put_ihex_(s, 5, 0, t, 4);
+		put_ihex_(s, 1, 0, nullptr, 0);
+		return save_(hex_path_, s);
+	}
+
+
+	bool save_bin_() noexcept
+	{
+		return save_(bin_path_, std::string(image_.begin(), image_.end()));
+	}
+
+
+	// 全ページの内容が、イメージと一致する事
+	bool match_(const utils::motsx_io& mot) noexcept
+	{
+		for(uint32_t i = 0; i < SIZE; i += 256) {
+			const auto& m = mot.get_memory(ORG + i);
+			if(std::memcmp(&m[0], &image_[i], 256) != 0) return false;
+		}
+		return true;
+	}
+
+
+	uint32_t file_size_(const char* path) noexcept
+	{
+		FILE* fp = fopen(path, "rb");
+		if(fp == nullptr) return 0;
+		fseek(fp, 0, SEEK_END);
+		auto n = ftell(fp);
+		fclose(fp);
+		return n;
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	ロードして、時間を計る（３回ロードして、一番速い時間）
+		@param[in]	mot		motsx_io
+		@param[in]	path	ファイル
+		@param[out]	ms		時間（ミリ秒）
+		@return 全てロード出来たら「true」
+	*/
+	//-----------------------------------------------------------------//
+	bool load_(utils::motsx_io& mot, const char* path, double& ms) noexcept
+	{
+		bool ok = true;
+		for(int i = 0; i < 3; ++i) {
+			auto t0 = std::chrono::steady_clock::now();
+			if(!mot.load(path)) ok = false;
+			auto t1 = std::chrono::steady_clock::now();
+			auto t = std::chrono::duration<double, std::milli>(t1 - t0).count();
+			if(i == 0 || t < ms) ms = t;
+		}
+		return ok;
+	}
+
+
+	void report_(const char* name, const char* path, double ms) noexcept
+	{
+		double mb = 1024.0 * 1024.0;
+		printf("motsx_test: %-9s %5.1f ms, %6.1f MB/s file, %6.1f MB/s image\n", name, ms,
+			file_size_(path) / mb / (ms / 1000.0), SIZE / mb / (ms / 1000.0));
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	make_image_();
+	if(!save_mot_() || !save_hex_() || !save_bin_()) {
+		printf("Can't write: 'test/release/bench.*'\n");
+		return 1;
+	}
+	if(system((std::string("rm -rf ") + cache_dir_).c_str()) != 0) return 1;
+
+	static const uint32_t GAP_PAGES = (GAP_END - GAP_ORG) / 256;
+
+	double mot_ms;
+	{  // S フォーマット
+		utils::motsx_io mot;
+		CHECK(load_(mot, mot_path_, mot_ms));
+		CHECK(match_(mot));
+		CHECK(mot.get_exec() == EXEC);
+		CHECK(mot.get_area().min_ == ORG && mot.get_area().max_ == 0xFFFFFFFF);
+		CHECK(mot.get_total_page() == (SIZE / 256 - GAP_PAGES));
+		CHECK(!mot.find_page(GAP_ORG) && mot.find_page(GAP_END));
+		CHECK(mot.create_area_map().size() == 2);
+	}
+
+	double hex_ms;
+	{  // インテル HEX
+		utils::motsx_io mot;
+		CHECK(load_(mot, hex_path_, hex_ms));
+		CHECK(match_(mot));
+		CHECK(mot.get_exec() == EXEC);
+		CHECK(mot.get_total_page() == (SIZE / 256 - GAP_PAGES));
+	}
+
+	double bin_ms;
+	{  // バイナリー（終端を 0xFFFFFFFF に合わせる）
+		utils::motsx_io mot;
+		CHECK(load_(mot, bin_path_, bin_ms));
+		CHECK(match_(mot));
+		CHECK(mot.get_total_page() == (SIZE / 256));
+	}
+
+	double hit_ms;
+	{  // キャッシュ（最初は解析して保存、次はキャッシュを読む）
+		utils::motsx_io mot;
+		mot.set_cache_dir(cache_dir_);
+		CHECK(mot.load(mot_path_));
+		CHECK(match_(mot));
+		utils::motsx_io hit;
+		hit.set_cache_dir(cache_dir_);
+		CHECK(load_(hit, mot_path_, hit_ms));
+		CHECK(match_(hit));
+		CHECK(hit.get_exec() == EXEC);
+		CHECK(hit.get_total_page() == mot.get_total_page());
+	}
+
+	report_("S-record", mot_path_, mot_ms);
+	report_("Intel HEX", hex_path_, hex_ms);
+	report_("binary", bin_path_, bin_ms);
+	report_("cache", mot_path_, hit_ms);
+
+	return sim_test::result::report("motsx_test");
+}
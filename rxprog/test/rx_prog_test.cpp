@@ -0,0 +1,245 @@
+//=====================================================================//
+/*!	@file
+	@brief	rx_prog のホスト・テスト（PTY のブート・モード・シミュレーター使用）@n
+			rxprog ディレクトリーで実行する。（rx_prog、rx_prog.conf を使う）@n
+			・パイプライン・モード：消去済み、未消去の ROM、CRC 無しの照合 @n
+			・書くページが無いイメージ（書き込みの開始、終了を送らない）@n
+			・逐次モード @n
+			・照合エラーの検出 @n
+			・複数ポートへの同時書き込み（一つが失敗しても、他は書ける事、@n
+			  エラー出力の行頭にポートが付く事）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <sys/wait.h>
+#include <map>
+#include <fstream>
+#include <iterator>
+#include "boot_sim.hpp"
+#include "sim_test/check.hpp"
+
+namespace {
+
+	typedef std::map<uint32_t, uint8_t> image;
+
+	const char* mot_path_ = "test/release/test.mot";
+	const char* log_path_ = "test/release/test.log";
+
+	// 128K（途中にブランク・ページ）と、ベクター
+	image make_image_() noexcept
+	{
+		image img;
+		for(uint32_t a = 0xFFFC0000; a < 0xFFFE0000; ++a) {
+			bool blank = a >= 0xFFFC1000 && a < 0xFFFC1100;
+			img[a] = blank ? 0xff : ((a * 7) ^ (a >> 9)) & 0xfe;
+		}
+		for(uint32_t a = 0xFFFFFF80; a != 0; ++a) img[a] = a & 0xff;
+		return img;
+	}
+
+	bool save_mot_(const image& img) noexcept
+	{
+		FILE* fp = fopen(mot_path_, "wb");
+		if(fp == nullptr) return false;
+		auto it = img.begin();
+		while(it != img.end()) {
+			uint32_t org = it->first;
+			uint8_t tmp[32];
+			uint32_t n = 0;
+			while(it != img.end() && n < sizeof(tmp) && it->first == (org + n)) {
+				tmp[n] = it->second;
+				++n;
+				++it;
+			}
+			uint32_t sum = n + 5;
+			for(int i = 0; i < 4; ++i) sum += (org >> (i * 8)) & 0xff;
+			fprintf(fp, "S3%02X%08X", n + 5, org);
+			for(uint32_t i = 0; i < n; ++i) {
+				fprintf(fp, "%02X", tmp[i]);
+				sum += tmp[i];
+			}
+			fprintf(fp, "%02X\r\n", ~sum & 0xff);
+		}
+		fprintf(fp, "S70500000000FA\r\n");
+		fclose(fp);
+		return true;
+	}
+
+	// rx_prog を実行（出力はログへ）
+	bool run_(std::vector<rx::boot_sim*> sims, const std::vector<std::string>& opts) noexcept
+	{
+		std::vector<std::string> args = { "./rx_prog", "--verbose", "-d", "RX64M", "-s", "115200" };
+		for(auto s : sims) args.push_back("--port=" + s->get_path());
+		args.insert(args.end(), opts.begin(), opts.end());
+		args.push_back(mot_path_);
+
+		fflush(stdout);
+		auto pid = fork();
+		if(pid == 0) {
+			FILE* fp = freopen(log_path_, "wb", stdout);
+			if(fp == nullptr) _exit(127);
+			dup2(fileno(stdout), 2);
+			std::vector<char*> av;
+			for(auto& s : args) av.push_back(&s[0]);
+			av.push_back(nullptr);
+			execv(av[0], &av[0]);
+			_exit(127);
+		}
+		int st = 0;
+		waitpid(pid, &st, 0);
+		for(auto s : sims) s->stop();
+		return WIFEXITED(st) && WEXITSTATUS(st) == 0;
+	}
+
+	bool match_(const rx::boot_sim& sim, const image& img) noexcept
+	{
+		for(const auto& m : img) {
+			if(sim.get_rom(m.first) != m.second) return false;
+		}
+		return true;
+	}
+
+	std::string log_() noexcept
+	{
+		std::ifstream ifs(log_path_);
+		return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	}
+
+	// エラーの行は、全て prefix で始まる事
+	bool error_lines_(const std::string& prefix) noexcept
+	{
+		std::ifstream ifs(log_path_);
+		std::string line;
+		uint32_t n = 0;
+		while(std::getline(ifs, line)) {
+			auto pos = line.find_last_of('\r');  // 進行状況の行
+			if(pos != std::string::npos) line = line.substr(pos + 1);
+			if(line.find("error") == std::string::npos) continue;
+			if(line.find(prefix) != 0) return false;
+			++n;
+		}
+		return n > 0;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	auto img = make_image_();
+	if(!save_mot_(img)) {
+		printf("Can't write: '%s'\n", mot_path_);
+		return 1;
+	}
+
+	const std::vector<std::string> ewv = { "--erase", "--write", "--verify" };
+	std::vector<std::string> pewv = ewv;
+	pewv.push_back("--pipeline");
+
+	{  // パイプライン、消去済み ROM（使うブロックのブランク・チェックだけ）
+		rx::boot_sim sim;
+		CHECK(sim.start());
+		CHECK(run_({ &sim }, pewv));
+		CHECK(match_(sim, img));
+		CHECK(sim.get_count(0x10) == 5);
+		CHECK(sim.get_count(0x12) == 0);
+		CHECK(sim.get_count(0x13) <= 10);
+		CHECK(sim.get_count(0x15) == 0);
+	}
+
+	{  // パイプライン、未消去の ROM
+		rx::boot_sim::option opt;
+		opt.dirty = true;
+		rx::boot_sim sim(opt);
+		CHECK(sim.start());
+		CHECK(run_({ &sim }, pewv));
+		CHECK(match_(sim, img));
+		CHECK(sim.get_count(0x12) == 5);
+	}
+
+	{  // パイプライン、CRC が使えない場合は、リード・バックで照合
+		rx::boot_sim::option opt;
+		opt.no_crc = true;
+		rx::boot_sim sim(opt);
+		CHECK(sim.start());
+		CHECK(run_({ &sim }, pewv));
+		CHECK(match_(sim, img));
+		CHECK(sim.get_count(0x15) > 0);
+		CHECK(log_().find("Device CRC not available") != std::string::npos);
+	}
+
+	{  // 照合エラー
+		rx::boot_sim::option opt;
+		opt.stuck = 0xFFFC0010;
+		rx::boot_sim sim(opt);
+		CHECK(sim.start());
+		CHECK(!run_({ &sim }, pewv));
+		CHECK(log_().find("Verify") != std::string::npos);
+	}
+
+	{  // 逐次モード
+		rx::boot_sim::option opt;
+		opt.dirty = true;
+		rx::boot_sim sim(opt);
+		CHECK(sim.start());
+		CHECK(run_({ &sim }, ewv));
+		CHECK(match_(sim, img));
+	}
+
+	{  // 書くページが無い（全てブランク）
+		image blank;
+		for(uint32_t a = 0xFFFC0000; a < 0xFFFC0200; ++a) blank[a] = 0xff;
+		CHECK(save_mot_(blank));
+		rx::boot_sim sim;
+		CHECK(sim.start());
+		CHECK(run_({ &sim }, pewv));
+		CHECK(sim.get_count(0x13) == 0);
+		CHECK(match_(sim, blank));
+		CHECK(save_mot_(img));
+	}
+
+	{  // 複数ポート、一つは途中で書き込みエラー
+		rx::boot_sim::option opt;
+		opt.dirty = true;
+		rx::boot_sim s0(opt);
+		rx::boot_sim s1(opt);
+		opt.fail_write = 0x2000;
+		rx::boot_sim s2(opt);
+		CHECK(s0.start() && s1.start() && s2.start());
+		std::vector<std::string> o = pewv;
+		o.push_back("--progress");
+		CHECK(!run_({ &s0, &s1, &s2 }, o));
+		CHECK(match_(s0, img));
+		CHECK(match_(s1, img));
+		CHECK(!match_(s2, img));
+		auto log = log_();
+		CHECK(log.find("Summary: 2/3 OK") != std::string::npos);
+		CHECK(log.find("#2: '" + s2.get_path() + "' fail (Write)") != std::string::npos);
+		CHECK(error_lines_("#2 '" + s2.get_path() + "': "));
+	}
+
+	{  // 複数ポート、逐次モード
+		rx::boot_sim s0;
+		rx::boot_sim s1;
+		CHECK(s0.start() && s1.start());
+		CHECK(run_({ &s0, &s1 }, ewv));
+		CHECK(match_(s0, img));
+		CHECK(match_(s1, img));
+	}
+
+	{  // 複数ポート、書くページが無い
+		image blank;
+		for(uint32_t a = 0xFFFC0000; a < 0xFFFC0200; ++a) blank[a] = 0xff;
+		CHECK(save_mot_(blank));
+		rx::boot_sim s0;
+		rx::boot_sim s1;
+		CHECK(s0.start() && s1.start());
+		CHECK(run_({ &s0, &s1 }, pewv));
+		CHECK(log_().find("Summary: 2/2 OK") != std::string::npos);
+		CHECK(s0.get_count(0x13) == 0 && s1.get_count(0x13) == 0);
+		CHECK(save_mot_(img));
+	}
+
+	return sim_test::result::report("rx_prog_test");
+}
@@ -0,0 +1,77 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ホスト・テスト用、ベンチマーク（１回当たりの時間、サイクル数）@n
+			サイクル数は、x86 ではタイム・スタンプ・カウンター（TSC）、@n
+			それ以外はナノ秒と同じ値になる。@n
+			結果は表示だけに使う（実行環境で変わるので、検査には使わない）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace sim_test {
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	サイクル・カウンターの取得
+		@return サイクル・カウンター
+	*/
+	//-----------------------------------------------------------------//
+	inline uint64_t get_cycle() noexcept
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		return __rdtsc();
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	ベンチマークの結果（１回当たり）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct bench_t {
+		double	ns_;		///< 時間（ナノ秒）
+		double	cycle_;		///< サイクル数
+		bench_t() noexcept : ns_(0.0), cycle_(0.0) { }
+	};
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	関数を繰り返し呼んで、１回当たりの時間とサイクル数を計る @n
+				（３回計って、一番速い結果を使う）
+		@param[in]	loop	１回の計測で呼ぶ回数
+		@param[in]	func	関数
+		@return 結果
+	*/
+	//-----------------------------------------------------------------//
+	template <class FUNC>
+	bench_t bench(uint32_t loop, FUNC func) noexcept
+	{
+		bench_t best;
+		for(int n = 0; n < 3; ++n) {
+			auto t0 = std::chrono::steady_clock::now();
+			auto c0 = get_cycle();
+			for(uint32_t i = 0; i < loop; ++i) func(i);
+			auto c1 = get_cycle();
+			auto t1 = std::chrono::steady_clock::now();
+			bench_t t;
+			t.ns_ = std::chrono::duration<double, std::nano>(t1 - t0).count() / loop;
+			t.cycle_ = static_cast<double>(c1 - c0) / loop;
+			if(n == 0 || t.ns_ < best.ns_) best = t;
+		}
+		return best;
+	}
+}
@@ -0,0 +1,198 @@
+//=====================================================================//
+/*!	@file
+	@brief	画像デコーダーの行出力（img::row_sink → scaling::put_row → @n
+			render::copy_row）のホスト・テスト、ベンチマーク @n
+			・行出力と、１ピクセル毎の描画（従来）で、フレームバッファが @n
+			  一致する事（画面外、クリッピング領域、縮小、破線パターン）@n
+			・RGB888 の１フレーム（480 x 272）の転送時間を比較して表示する。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <chrono>
+#include <vector>
+#include "common/format.hpp"
+#include "graphics/graphics.hpp"
+#include "graphics/scaling.hpp"
+#include "graphics/row_sink.hpp"
+#include "check.hpp"
+
+namespace {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	GLCDC の代わり（フレームバッファだけを持つ）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct glc_t {
+		static const int16_t width  = 480;
+		static const int16_t height = 272;
+
+		uint16_t	fb_[512 * height];
+
+		void* get_fbp() const noexcept { return const_cast<uint16_t*>(fb_); }
+	};
+
+	typedef graphics::font_null FONT;
+	typedef graphics::render<glc_t, FONT> RENDER;
+	typedef img::scaling<RENDER> SCALING;
+
+	// put_row を持たない描画ファンクタ（従来の１ピクセル毎の描画）
+	struct pixel_plot {
+		SCALING&	scaling_;
+
+		pixel_plot(SCALING& scaling) noexcept : scaling_(scaling) { }
+
+		void operator() (int16_t x, int16_t y, uint8_t r, uint8_t g, uint8_t b) noexcept
+		{
+			scaling_(x, y, r, g, b);
+		}
+	};
+
+	graphics::afont_null	afont_;
+	graphics::kfont_null	kfont_;
+	FONT	font_(afont_, kfont_);
+
+	glc_t	glc_row_;
+	RENDER	render_row_(glc_row_, font_);
+	SCALING	scaling_row_(render_row_);
+	img::row_sink<SCALING>	sink_row_(scaling_row_);
+
+	glc_t	glc_pix_;
+	RENDER	render_pix_(glc_pix_, font_);
+	SCALING	scaling_pix_(render_pix_);
+	pixel_plot	plot_pix_(scaling_pix_);
+	img::row_sink<pixel_plot>	sink_pix_(plot_pix_);
+
+	static const int16_t IMG_W = 480;
+	static const int16_t IMG_H = 272;
+	std::vector<uint8_t>	image_(IMG_W * IMG_H * 3);
+
+
+	void make_image_() noexcept
+	{
+		uint32_t x = 2463534242;
+		for(auto& v : image_) {
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			v = x;
+		}
+	}
+
+
+	// デコーダーと同じく、１行ずつ出力
+	template <class SINK>
+	void draw_(SINK& sink, int16_t w, int16_t h) noexcept
+	{
+		sink.start();
+		for(int16_t y = 0; y < h; ++y) {
+			sink.template put_rgb<0, 1, 2, 3>(0, y, &image_[y * IMG_W * 3], w);
+		}
+	}
+
+
+	void clear_() noexcept
+	{
+		std::memset(glc_row_.fb_, 0x55, sizeof(glc_row_.fb_));
+		std::memset(glc_pix_.fb_, 0x55, sizeof(glc_pix_.fb_));
+	}
+
+
+	bool same_() noexcept
+	{
+		return std::memcmp(glc_row_.fb_, glc_pix_.fb_, sizeof(glc_row_.fb_)) == 0;
+	}
+
+
+	// 同じ設定で、行出力と１ピクセル毎の描画をして、比較する
+	template <class SETUP>
+	bool compare_(int16_t w, int16_t h, SETUP setup) noexcept
+	{
+		clear_();
+		setup(render_row_, scaling_row_);
+		setup(render_pix_, scaling_pix_);
+		draw_(sink_row_, w, h);
+		draw_(sink_pix_, w, h);
+		return same_();
+	}
+
+
+	void reset_(RENDER& r, SCALING& s) noexcept
+	{
+		r.set_clip(vtx::srect(0, 0, glc_t::width, glc_t::height));
+		r.set_stipple();
+		s.set_offset();
+		s.set_scale();
+	}
+
+
+	template <class SINK>
+	double bench_(SINK& sink, uint32_t loop) noexcept
+	{
+		auto t0 = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < loop; ++i) draw_(sink, IMG_W, IMG_H);
+		auto t1 = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::micro>(t1 - t0).count() / loop;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	make_image_();
+
+	// 全画面、等倍（行出力）
+	CHECK(compare_(IMG_W, IMG_H, [](RENDER& r, SCALING& s) { reset_(r, s); }));
+	CHECK(sink_row_.is_row());
+	CHECK(!sink_pix_.is_row());
+	CHECK(glc_row_.fb_[0] == graphics::share_color::to_565(image_[0], image_[1], image_[2]));
+
+	// 画面からはみ出す（左上、右下）
+	CHECK(compare_(IMG_W, IMG_H, [](RENDER& r, SCALING& s) {
+		reset_(r, s);
+		s.set_offset(vtx::spos(-37, -5));
+	}));
+	CHECK(compare_(IMG_W, IMG_H, [](RENDER& r, SCALING& s) {
+		reset_(r, s);
+		s.set_offset(vtx::spos(200, 150));
+	}));
+
+	// クリッピング領域（org から org + size まで）
+	CHECK(compare_(IMG_W, IMG_H, [](RENDER& r, SCALING& s) {
+		reset_(r, s);
+		r.set_clip(vtx::srect(0, 0, 301, 97));
+		s.set_offset(vtx::spos(-3, 10));
+	}));
+	CHECK(compare_(IMG_W, IMG_H, [](RENDER& r, SCALING& s) {
+		reset_(r, s);
+		r.set_clip(vtx::srect(20, 30, 200, 100));
+	}));
+	CHECK(sink_row_.is_row());
+
+	// 破線パターン、縮小は、１ピクセル毎の描画になる
+	CHECK(compare_(IMG_W, 64, [](RENDER& r, SCALING& s) {
+		reset_(r, s);
+		r.set_stipple(0xf0f0f0f0);
+	}));
+	CHECK(!sink_row_.is_row());
+	CHECK(compare_(IMG_W, IMG_H, [](RENDER& r, SCALING& s) {
+		reset_(r, s);
+		s.set_scale(1, 2);
+	}));
+	CHECK(!sink_row_.is_row());
+
+	{  // ベンチマーク（１フレーム、結果は表示のみ）
+		reset_(render_row_, scaling_row_);
+		reset_(render_pix_, scaling_pix_);
+		auto row = bench_(sink_row_, 200);
+		auto pix = bench_(sink_pix_, 200);
+		double n = static_cast<double>(IMG_W) * IMG_H;
+		printf("blit_test: RGB888 %ux%u: row %.1f us (%.2f ns/pixel), per-pixel %.1f us (%.2f ns/pixel), x%.1f\n",
+			IMG_W, IMG_H, row, row * 1000.0 / n, pix, pix * 1000.0 / n, pix / row);
+	}
+
+	return sim_test::result::report("blit_test");
+}
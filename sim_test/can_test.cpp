@@ -0,0 +1,151 @@
+//=====================================================================//
+/*!	@file
+	@brief	can_io のホスト・テスト（IO_SIM の CAN モデル使用） @n
+			・1 Mbps で、１秒間送信し続けた時（内部ループバック）、@n
+			  ビット・レートで決まるフレーム数が、落さず、順番に届く事 @n
+			・バス負荷（get_load）が、ほぼ 100% になる事 @n
+			・通常モードで、送信と、バスからの受信の両方を数える事 @n
+			・アクセプタンス・フィルタ、拡張 ID
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/renesas.hpp"
+#include "common/fixed_fifo.hpp"
+#include "common/can_io.hpp"
+#include "check.hpp"
+
+namespace {
+
+	typedef utils::fixed_fifo<device::can_frame, 64> RBF;
+	typedef utils::fixed_fifo<device::can_frame, 32> SBF;
+	typedef device::can_io<device::CAN0, RBF, SBF> CAN;
+	CAN		can_;
+
+	static const uint32_t SPEED = 1000000;
+	static const uint32_t SLICE = F_PCLKB / 10000;  // 100us
+
+	device::can_frame make_(uint32_t n) noexcept
+	{
+		device::can_frame f(n & 0x7FF, 8);
+		for(uint32_t i = 0; i < 8; ++i) f.data_[i] = n >> ((i & 3) * 8);
+		return f;
+	}
+
+	uint32_t seq_(const device::can_frame& f) noexcept
+	{
+		return f.data_[0] | (f.data_[1] << 8) | (f.data_[2] << 16) | (f.data_[3] << 24);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+
+	sim::can_model<CAN0> model;
+	sim::space::attach(model);
+
+	{  // 1 Mbps、１秒間の飽和送信（内部ループバック、割り込み）
+		CHECK(can_.start(SPEED, 2, CAN::mode::LOOP_INT));
+		uint32_t sent = 0;
+		uint32_t rcvd = 0;
+		uint32_t err = 0;
+		for(uint32_t t = 0; t < F_PCLKB; t += SLICE) {
+			while(can_.send_length() < 16) {
+				if(!can_.send(make_(sent))) break;
+				++sent;
+			}
+			sim::space::step(SLICE);
+			can_frame f;
+			while(can_.recv(f)) {
+				if(f.len_ != 8 || seq_(f) != rcvd || f.id_ != (rcvd & 0x7FF)) ++err;
+				++rcvd;
+			}
+		}
+		// 8 バイトの標準フレームは 111 ビット
+		uint32_t max = SPEED / 111;
+		CHECK(model.get_send() <= max);
+		CHECK(model.get_send() >= (max - 1));
+		CHECK(rcvd == model.get_send());
+		CHECK(err == 0);
+		const auto& cnt = can_.get_counter();
+		CHECK(cnt.recv_lost_ == 0);
+		CHECK(cnt.fifo_lost_ == 0);
+		CHECK(cnt.recv_ == rcvd);
+		// 送信 FIFO に渡した分（最大４フレームは、まだ送信中）
+		auto load = can_.get_load(1000);
+		CHECK(load >= 995 && load <= 1003);
+		CHECK(can_.get_load(1000) == 0);
+
+		// 残りを送り切る
+		for(uint32_t i = 0; i < 100; ++i) {
+			sim::space::step(SLICE);
+			can_frame f;
+			while(can_.recv(f)) {
+				if(seq_(f) != rcvd) ++err;
+				++rcvd;
+			}
+		}
+		CHECK(rcvd == sent);
+		CHECK(err == 0);
+	}
+
+	{  // アクセプタンス・フィルタ（0x100～0x10F、拡張 ID は全て）
+		can_.set_filter(0, 0x100, 0x7F0);
+		uint32_t rej = model.get_reject();
+		uint32_t rcvd = 0;
+		uint32_t err = 0;
+		for(uint32_t id = 0; id < 0x200; ++id) {
+			while(!can_.send(can_frame(id, 1))) sim::space::step(SLICE);
+		}
+		for(uint32_t i = 0; i < 400; ++i) {
+			sim::space::step(SLICE);
+			can_frame f;
+			while(can_.recv(f)) {
+				if((f.id_ & 0x7F0) != 0x100 || f.ext_) ++err;
+				++rcvd;
+			}
+		}
+		CHECK(rcvd == 16);
+		CHECK(err == 0);
+		CHECK((model.get_reject() - rej) == (0x200 - 16));
+
+		can_frame f(0x1ABCDEF, 2, true);
+		f.data_[0] = 0xAB;
+		f.data_[1] = 0xCD;
+		CHECK(can_.send(f));
+		sim::space::step(SLICE * 2);
+		can_frame g;
+		CHECK(can_.recv(g));
+		CHECK(g.ext_ && g.id_ == f.id_ && g.len_ == 2);
+		CHECK(g.data_[0] == 0xAB && g.data_[1] == 0xCD);
+		can_.destroy();
+	}
+
+	{  // 通常モード：送信（50%）と、バスからの受信（25%）を数える
+		CHECK(can_.start(SPEED, 2, CAN::mode::NORMAL));
+		can_.get_load(1000);
+		uint32_t send = model.get_send();
+		uint32_t rcvd = 0;
+		uint8_t data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		for(uint32_t t = 0; t < 10000; ++t) {  // 100us x 10000
+			// 200us 毎に 111 ビットを送信、400us 毎に 111 ビットを受信
+			if((t & 1) == 0) can_.send(make_(t));
+			if((t & 3) == 0) model.recv(0x123 << 18, data, 8);
+			sim::space::step(SLICE);
+			can_frame f;
+			while(can_.recv(f)) ++rcvd;
+		}
+		CHECK((model.get_send() - send) == 5000);
+		CHECK(rcvd == 2500);
+		auto load = can_.get_load(1000);
+		CHECK(load == (5000 + 2500) * 111 / 1000);
+		can_.destroy();
+	}
+
+	return sim_test::result::report("can_test");
+}
@@ -0,0 +1,57 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ホスト・テスト用、検査マクロ
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdint>
+
+namespace sim_test {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	検査結果の集計
+		@param[in]	_	ダミー（スタティック・メンバーをヘッダーに置く為）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class _>
+	struct result_t {
+		static uint32_t	pass_;
+		static uint32_t	fail_;
+
+		static bool check(bool ok, const char* expr, const char* file, int line) noexcept
+		{
+			if(ok) {
+				++pass_;
+			} else {
+				++fail_;
+				printf("%s(%d): NG: %s\n", file, line, expr);
+			}
+			return ok;
+		}
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	結果の表示
+			@param[in]	name	テスト名
+			@return 全て通過なら「０」（main の戻り値）
+		*/
+		//-----------------------------------------------------------------//
+		static int report(const char* name) noexcept
+		{
+			printf("%s: %u passed, %u failed\n", name, pass_, fail_);
+			return fail_ == 0 ? 0 : 1;
+		}
+	};
+	typedef result_t<void> result;
+
+	template <class _> uint32_t result_t<_>::pass_ = 0;
+	template <class _> uint32_t result_t<_>::fail_ = 0;
+}
+
+#define CHECK(expr) sim_test::result::check((expr), #expr, __FILE__, __LINE__)
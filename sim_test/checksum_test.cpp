@@ -0,0 +1,259 @@
+//=====================================================================//
+/*!	@file
+	@brief	net::tools チェック・サムのホスト・テスト @n
+			・RFC 1071、IPv4 ヘッダーの既知のベクター @n
+			・バイト単位の参照実装と、長さ、開始アドレスを変えて比較 @n
+			・copy_sum のコピー結果とサム @n
+			・update_sum、update_sum32（RFC 1624）と再計算の比較 @n
+			・ICMP エコー応答（タイプ、コードのワードの差分更新） @n
+			・１回当たりの時間、サイクル数（表示）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#include "common/format.hpp"
+#include "common/net_tools.hpp"
+#include "net2/icmp.hpp"
+#include "loop_ethd.hpp"
+#include "check.hpp"
+#include "bench.hpp"
+
+extern "C" {
+	time_t get_time() { return 0; }
+}
+
+namespace {
+
+	uint32_t	rand_ = 88172645;
+
+	uint32_t xorshift_() noexcept
+	{
+		rand_ ^= rand_ << 13;
+		rand_ ^= rand_ >> 17;
+		rand_ ^= rand_ << 5;
+		return rand_;
+	}
+
+
+	// 参照実装：ビッグエンディアンの１６ビット列として、バイト単位で加算
+	uint16_t ref_sum_(const uint8_t* p, uint32_t len, uint32_t sum = 0) noexcept
+	{
+		for(uint32_t i = 0; i < len; ++i) {
+			if(i & 1) sum += p[i];
+			else sum += static_cast<uint32_t>(p[i]) << 8;
+		}
+		while(sum >> 16) sum = (sum & 0xffff) + (sum >> 16);
+		return sum;
+	}
+
+	alignas(8) uint8_t	src_[1600 + 8];
+	alignas(8) uint8_t	dst_[1600 + 8];
+
+	volatile uint32_t	sink_;	///< ベンチマークの結果を捨てる
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	ICMP エコー要求を送り、応答を検査
+		@param[in]	code	要求のコード
+		@param[in]	len		メッセージ長（ヘッダーを含む）
+		@return 応答のサムが正しく、タイプ以外が要求と同じなら「true」@n
+				（コードが０以外の場合、応答しなければ「true」）
+	*/
+	//-----------------------------------------------------------------//
+	bool icmp_echo_(uint8_t code, uint32_t len) noexcept
+	{
+		using net::tools;
+		sim_test::loop_ethd ethd;
+		sim_test::loop_ethd peer;
+		ethd.connect(peer);
+		net::icmp<sim_test::loop_ethd> icmp;
+
+		net::eth_h eh;
+		std::memset(&eh, 0, sizeof(eh));
+		net::ipv4_h ih;
+		std::memset(&ih, 0, sizeof(ih));
+		uint8_t msg[1500];
+		msg[0] = 0x08;
+		msg[1] = code;
+		msg[2] = 0;
+		msg[3] = 0;
+		for(uint32_t i = 4; i < len; ++i) msg[i] = xorshift_();
+		auto cs = tools::calc_sum(msg, len);
+		msg[2] = cs >> 8;
+		msg[3] = cs;
+
+		void* rep;
+		bool ok = icmp.process(ethd, eh, ih, msg, len);
+		if(code != 0x00) return peer.empty();
+		int32_t n = peer.recv_buff(&rep);
+		if(n != static_cast<int32_t>(sizeof(net::eth_h) + sizeof(net::ipv4_h) + len)) return false;
+		const uint8_t* r = static_cast<const uint8_t*>(rep) + sizeof(net::eth_h) + sizeof(net::ipv4_h);
+		return ok && r[0] == 0x00 && r[1] == code && std::memcmp(&r[4], &msg[4], len - 4) == 0
+			&& tools::calc_sum(r, len) == 0x0000;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using net::tools;
+
+	{  // RFC 1071 4.1 の例
+		static const uint8_t v[] = { 0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7 };
+		CHECK(tools::partial_sum(v, sizeof(v)) == 0xddf2);
+		CHECK(tools::calc_sum(v, sizeof(v)) == static_cast<uint16_t>(~0xddf2));
+	}
+
+	{  // IPv4 ヘッダー（チェック・サム 0xb861）
+		uint8_t h[] = {
+			0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00, 0x40, 0x11,
+			0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01, 0xc0, 0xa8, 0x00, 0xc7 };
+		auto cs = tools::calc_sum(h, sizeof(h));
+		CHECK(cs == 0xb861);
+		h[10] = cs >> 8;
+		h[11] = cs & 0xff;
+		CHECK(tools::calc_sum(h, sizeof(h)) == 0x0000);
+		// 奇数アドレスに置いても同じ
+		std::memcpy(&src_[1], h, sizeof(h));
+		CHECK(tools::calc_sum(&src_[1], sizeof(h)) == 0x0000);
+	}
+
+	{  // 全て 0xff（１の補数の「-0」）
+		std::memset(src_, 0xff, 64);
+		CHECK(tools::partial_sum(src_, 64) == 0xffff);
+		CHECK(tools::partial_sum(src_, 0) == 0x0000);
+	}
+
+	for(uint32_t i = 0; i < sizeof(src_); ++i) src_[i] = xorshift_();
+
+	{  // 開始アドレス（０～７）、長さ（０～３００、１５００）、初期値
+		uint32_t err = 0;
+		for(uint32_t ofs = 0; ofs < 8; ++ofs) {
+			for(uint32_t len = 0; len <= 300; ++len) {
+				if(tools::partial_sum(&src_[ofs], len) != ref_sum_(&src_[ofs], len)) ++err;
+			}
+			if(tools::partial_sum(&src_[ofs], 1500) != ref_sum_(&src_[ofs], 1500)) ++err;
+			uint32_t init = xorshift_() & 0xffff;
+			if(tools::partial_sum(&src_[ofs], 77, init) != ref_sum_(&src_[ofs], 77, init)) ++err;
+		}
+		CHECK(err == 0);
+	}
+
+	{  // 分割して計算（偶数長の区切り）しても同じ
+		uint32_t err = 0;
+		for(uint32_t n = 0; n <= 200; n += 2) {
+			auto a = tools::partial_sum(src_, n);
+			auto b = tools::partial_sum(&src_[n], 200 - n, a);
+			if(b != tools::partial_sum(src_, 200)) ++err;
+		}
+		CHECK(err == 0);
+	}
+
+	{  // copy_sum（コピー先、コピー元の境界）
+		uint32_t err = 0;
+		for(uint32_t dofs = 0; dofs < 4; ++dofs) {
+			for(uint32_t sofs = 0; sofs < 4; ++sofs) {
+				for(uint32_t len = 0; len <= 70; ++len) {
+					std::memset(dst_, 0, 80);
+					auto s = tools::copy_sum(&dst_[dofs], &src_[sofs], len);
+					if(s != ref_sum_(&src_[sofs], len)) ++err;
+					if(std::memcmp(&dst_[dofs], &src_[sofs], len) != 0) ++err;
+				}
+				std::memset(dst_, 0, sizeof(dst_));
+				auto s = tools::copy_sum(&dst_[dofs], &src_[sofs], 1500, 0x1234);
+				if(s != ref_sum_(&src_[sofs], 1500, 0x1234)) ++err;
+				if(std::memcmp(&dst_[dofs], &src_[sofs], 1500) != 0) ++err;
+			}
+		}
+		CHECK(err == 0);
+	}
+
+	{  // update_sum、update_sum32（フィールドを書き換えて、再計算と比較）
+		uint32_t err = 0;
+		uint8_t h[40];
+		for(uint32_t loop = 0; loop < 1000; ++loop) {
+			for(uint32_t i = 0; i < sizeof(h); ++i) h[i] = xorshift_();
+			auto cs = tools::calc_sum(h, sizeof(h));
+
+			uint32_t pos = (xorshift_() % 20) * 2;
+			uint16_t org = (h[pos] << 8) | h[pos + 1];
+			uint16_t val = xorshift_();
+			if(loop == 0) val = org;
+			h[pos] = val >> 8;
+			h[pos + 1] = val;
+			auto up = tools::update_sum(cs, org, val);
+			auto re = tools::calc_sum(h, sizeof(h));
+			// 「0x0000」と「0xffff」は、１の補数では同じ値
+			if(up != re && !((up == 0xffff && re == 0) || (up == 0 && re == 0xffff))) ++err;
+
+			cs = re;
+			pos = (xorshift_() % 10) * 4;
+			uint32_t org32 = (h[pos] << 24) | (h[pos + 1] << 16) | (h[pos + 2] << 8) | h[pos + 3];
+			uint32_t val32 = xorshift_();
+			h[pos] = val32 >> 24;
+			h[pos + 1] = val32 >> 16;
+			h[pos + 2] = val32 >> 8;
+			h[pos + 3] = val32;
+			up = tools::update_sum32(cs, org32, val32);
+			re = tools::calc_sum(h, sizeof(h));
+			if(up != re && !((up == 0xffff && re == 0) || (up == 0 && re == 0xffff))) ++err;
+		}
+		CHECK(err == 0);
+	}
+
+	{  // タイプ、コードのワード（上位、下位の両方）を書き換える
+		uint32_t err = 0;
+		for(uint32_t code = 0; code < 256; ++code) {
+			uint8_t m[8] = { 0x08, static_cast<uint8_t>(code), 0, 0, 0x12, 0x34, 0x00, 0x01 };
+			auto cs = tools::calc_sum(m, sizeof(m));
+			uint16_t org = (m[0] << 8) | m[1];
+			m[0] = 0x00;
+			m[1] = ~code;
+			uint16_t val = (m[0] << 8) | m[1];
+			auto up = tools::update_sum(cs, org, val);
+			auto re = tools::calc_sum(m, sizeof(m));
+			if(up != re && !((up == 0xffff && re == 0) || (up == 0 && re == 0xffff))) ++err;
+		}
+		CHECK(err == 0);
+	}
+
+	{  // ICMP エコー応答（net2::icmp）
+		uint32_t err = 0;
+		for(uint32_t len = 8; len <= 1472; len += 31) {
+			if(!icmp_echo_(0x00, len)) ++err;
+		}
+		CHECK(err == 0);
+		// エコー要求以外のコードには、応答しない
+		CHECK(icmp_echo_(0x05, 64));
+	}
+
+	{  // ベンチマーク（１５００バイト、結果は表示のみ）
+		auto rep = [](const char* name, const sim_test::bench_t& t, const sim_test::bench_t& r) {
+			printf("checksum_test: %-22s %7.1f ns (%6.0f cycles, %5.2f bytes/cycle), byte-wise %7.1f ns (%6.0f cycles), x%.1f\n",
+				name, t.ns_, t.cycle_, 1500.0 / t.cycle_, r.ns_, r.cycle_, r.ns_ / t.ns_);
+		};
+		auto ps = sim_test::bench(100000, [](uint32_t i) { sink_ = tools::partial_sum(&src_[i & 1], 1500); });
+		auto ref = sim_test::bench(100000, [](uint32_t i) { sink_ = ref_sum_(&src_[i & 1], 1500); });
+		rep("partial_sum", ps, ref);
+		auto cp = sim_test::bench(100000, [](uint32_t i) { sink_ = tools::copy_sum(&dst_[2], &src_[i & 1], 1500); });
+		auto cpr = sim_test::bench(100000, [](uint32_t i) {
+			std::memcpy(&dst_[2], &src_[i & 1], 1500);
+			sink_ = ref_sum_(&dst_[2], 1500);
+		});
+		rep("copy_sum", cp, cpr);
+		auto up = sim_test::bench(1000000, [](uint32_t i) { sink_ = tools::update_sum(sink_, i, ~i); });
+		auto upr = sim_test::bench(1000000, [](uint32_t i) {
+			src_[0] = i >> 8;
+			src_[1] = i;
+			sink_ = tools::calc_sum(src_, 64);
+		});
+		printf("checksum_test: update_sum %.1f ns (%.0f cycles), calc_sum 64 bytes %.1f ns (%.0f cycles)\n",
+			up.ns_, up.cycle_, upr.ns_, upr.cycle_);
+	}
+
+	return sim_test::result::report("checksum_test");
+}
@@ -0,0 +1,107 @@
+//=====================================================================//
+/*!	@file
+	@brief	cmt_io のホスト・テスト（IO_SIM の CMT モデル使用） @n
+			・設定した周波数で、CMI 割り込みが発生する事 @n
+			・割り込みタスクが呼ばれる事 @n
+			・ICU の IR/IPR アクセスが、モデルのフックを通る事
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include "common/renesas.hpp"
+#include "common/cmt_io.hpp"
+#include "check.hpp"
+
+namespace {
+
+	class count_task {
+	public:
+		static uint32_t	count_;
+
+		void operator() () { ++count_; }
+	};
+	uint32_t count_task::count_ = 0;
+
+	typedef device::cmt_io<device::CMT0, count_task> CMT;
+	CMT		cmt_;
+
+	typedef device::cmt_io<device::CMT1> CMTP;
+	CMTP	cmtp_;
+
+	/// ICU の IPR 領域への書き込みを記録するモデル
+	class ipr_model : public device::sim::model {
+	public:
+		uint32_t	write_;
+		uint32_t	vec_;
+		uint32_t	data_;
+
+		ipr_model() : model(device::ICU::IPR.BUSERR.address(), 256), write_(0), vec_(0), data_(0) { }
+
+		void write(uint32_t ofs, uint32_t data, uint32_t size) override
+		{
+			++write_;
+			vec_ = ofs;
+			data_ = data;
+		}
+	};
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+
+	ipr_model ipr;
+	sim::space::attach(ipr);
+
+	{
+		sim::cmt_model<CMT0> cm;
+		sim::space::attach(cm);
+
+		CHECK(cmt_.start(1000, 4));
+		CHECK(ipr.write_ > 0);
+		CHECK(ipr.vec_ == (ICU::IPR.CMI0.address() - ICU::IPR.BUSERR.address()) && ipr.data_ == 4);
+
+		// 1000Hz で 10ms 分
+		for(int i = 0; i < 10; ++i) {
+			sim::space::step(F_PCLKB / 1000);
+		}
+		CHECK(cmt_.get_counter() == 10);
+		CHECK(count_task::count_ == 10);
+
+		// 端数のクロックは持ち越される事
+		for(int i = 0; i < 1000; ++i) {
+			sim::space::step(F_PCLKB / 100000);
+		}
+		CHECK(cmt_.get_counter() == 20);
+
+		cmt_.destroy();
+		sim::space::step(F_PCLKB / 100);
+		CHECK(cmt_.get_counter() == 20);
+		sim::space::detach(cm);
+	}
+
+	{  // IR/IPR の [] オペレータ（ref8_）もフックを通る事
+		uint32_t n = ipr.write_;
+		ICU::IPR[200] = 3;
+		CHECK(ipr.write_ == (n + 1) && ipr.vec_ == 200 && ipr.data_ == 3);
+		ICU::IPR[200] |= 8;
+		CHECK(ipr.write_ == (n + 2) && ipr.data_ == 11);
+		CHECK(ICU::IPR[200] == 11);
+	}
+
+	{  // ポーリング
+		sim::cmt_model<CMT1> cm;
+		sim::space::attach(cm);
+		CHECK(cmtp_.start(100, 0));
+		uint32_t cor = cmtp_.get_cmp_count();
+		sim::space::step(F_PCLKB / 200);  // 半周期
+		CHECK(cmtp_.get_cmt_count() == (cor + 1) / 2);
+		sim::space::detach(cm);
+	}
+
+	return sim_test::result::report("cmt_test");
+}
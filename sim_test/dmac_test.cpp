@@ -0,0 +1,117 @@
+//=====================================================================//
+/*!	@file
+	@brief	dmac_mgr、rspi_dma_io のホスト・テスト（IO_SIM の DMAC、RSPI モデル使用） @n
+			・ソフトウェア起動のメモリー・コピー @n
+			・SPTI、SPRI 起動の DMAC 転送で、全てのデータを送受信する事 @n
+			・受信時のダミー送信（0xFF）、送信時の受信データ破棄 @n
+			・短い転送は CPU で行う事
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstring>
+#include <vector>
+#include "common/renesas.hpp"
+#include "common/rspi_dma_io.hpp"
+#include "check.hpp"
+
+namespace {
+
+	typedef device::rspi_dma_io<device::RSPI0, device::DMAC3, device::DMAC4> SPI;
+	SPI		spi_;
+
+	typedef device::dmac_mgr<device::DMAC0> DMAC;
+	DMAC	dmac_;
+
+	struct copy_t {
+		uint8_t	src_[1000];
+		uint8_t	dst_[1000];
+	};
+	copy_t	copy_;
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+
+	sim::dmac_model<DMAC0, ICU> dm0;
+	sim::dmac_model<DMAC3, ICU> dm3;
+	sim::dmac_model<DMAC4, ICU> dm4;
+	sim::space::attach(dm0);
+	sim::space::attach(dm3);
+	sim::space::attach(dm4);
+
+	{  // メモリー・コピー（ソフトウェア起動）
+		for(uint32_t i = 0; i < sizeof(copy_.src_); ++i) copy_.src_[i] = i * 13 + 1;
+		dmac_.start();
+		CHECK(dmac_.copy(copy_.src_, copy_.dst_, 1000));
+		CHECK(memcmp(copy_.src_, copy_.dst_, 1000) == 0);
+		CHECK(dm0.get_count() == 250);  // 32 ビット転送
+		CHECK(DMAC0::DMCNT.DTE() == 0);
+		CHECK(DMAC0::DMSTS.DTIF() == 1);
+
+		memset(copy_.dst_, 0, sizeof(copy_.dst_));
+		CHECK(dmac_.copy(&copy_.src_[1], &copy_.dst_[1], 7));  // ８ビット転送
+		CHECK(memcmp(&copy_.src_[1], &copy_.dst_[1], 7) == 0);
+		CHECK(copy_.dst_[0] == 0 && copy_.dst_[8] == 0);
+	}
+
+	sim::rspi_model<RSPI0> sm;
+	sim::space::attach(sm);
+	std::vector<uint8_t> mosi;
+	uint8_t miso = 0;
+	sm.set_response([&](uint32_t tx) {
+		mosi.push_back(tx);
+		return miso++;
+	});
+
+	CHECK(spi_.start_sdc(10000000));
+
+	{  // DMAC による送信（受信データは捨てる）
+		uint8_t src[600];
+		for(uint32_t i = 0; i < sizeof(src); ++i) src[i] = i ^ 0x5a;
+		spi_.send(src, sizeof(src));
+		CHECK(mosi.size() == sizeof(src));
+		CHECK(memcmp(mosi.data(), src, sizeof(src)) == 0);
+		CHECK(dm3.get_count() == sizeof(src));
+		CHECK(dm4.get_count() == sizeof(src));
+		CHECK(DMAC3::DMCNT.DTE() == 0);
+		CHECK(RSPI0::SPCR.SPTIE() == 0);
+	}
+
+	{  // DMAC による受信（0xFF を送る）
+		mosi.clear();
+		miso = 0x10;
+		uint8_t dst[513];
+		spi_.recv(dst, sizeof(dst));
+		CHECK(mosi.size() == sizeof(dst));
+		bool ff = true;
+		for(auto v : mosi) if(v != 0xff) ff = false;
+		CHECK(ff);
+		bool ok = true;
+		for(uint32_t i = 0; i < sizeof(dst); ++i) {
+			if(dst[i] != static_cast<uint8_t>(0x10 + i)) ok = false;
+		}
+		CHECK(ok);
+	}
+
+	{  // 短い転送は CPU（DMAC は動かない）
+		auto n3 = dm3.get_count();
+		mosi.clear();
+		miso = 0x80;
+		uint8_t dst[SPI::DMA_MIN - 1];
+		spi_.recv(dst, sizeof(dst));
+		CHECK(dm3.get_count() == n3);
+		CHECK(mosi.size() == sizeof(dst));
+		CHECK(dst[0] == 0x80 && dst[sizeof(dst) - 1] == 0x80 + sizeof(dst) - 1);
+		// 32 ビット・アクセスに戻っている事
+		CHECK(spi_.xchg(0x33) == 0x80 + sizeof(dst));
+		CHECK(mosi.back() == 0x33);
+	}
+
+	return sim_test::result::report("dmac_test");
+}
@@ -0,0 +1,272 @@
+//=====================================================================//
+/*!	@file
+	@brief	RTK5_DSOS の解析部のホスト・テスト @n
+			・spectrum：合成した正弦波のピーク・ビン、浮動小数点の DFT との誤差 @n
+			  平均化、ピーク・ホールド、デシベル変換 @n
+			・decimate：全レベルの最小、最大が、総当たりと一致する事 @n
+			・capture：TPU 割り込み（INTB128）で２面のバッファが切り替わる事、@n
+			  固定中に完了したブロックは捨てる事、解除すれば切り替わる事 @n
+			・FFT、テーブル作成、描画（１画面分の参照）の時間
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cmath>
+#include <chrono>
+#include "common/renesas.hpp"
+#include "common/format.hpp"
+#include "common/tpu_io.hpp"
+#include "RTK5_DSOS/spectrum.hpp"
+#include "RTK5_DSOS/decimate.hpp"
+#include "RTK5_DSOS/capture.hpp"
+#include "check.hpp"
+
+namespace {
+
+	static const uint32_t FFT_N = 1024;
+	typedef utils::spectrum<FFT_N> SPECTRUM;
+	SPECTRUM	spec_;
+
+	static const uint32_t CAP_N = 2048;
+	static const uint32_t LVL = 6;
+	typedef utils::decimate<CAP_N, LVL> DECIMATE;
+	DECIMATE	deci_;
+
+	typedef utils::capture<CAP_N> CAPTURE;
+	CAPTURE		cap_;
+
+	int16_t		wave_[CAP_N];
+
+	// 正弦波（bin は周波数ビン、小数も可）
+	void sine_(int16_t* dst, uint32_t n, float bin, float amp) noexcept
+	{
+		for(uint32_t i = 0; i < n; ++i) {
+			dst[i] += static_cast<int16_t>(amp * std::sin(2.0f * 3.14159265f * bin * i / n));
+		}
+	}
+
+	void load_(const int16_t* src) noexcept
+	{
+		for(uint32_t i = 0; i < FFT_N; ++i) spec_.set(i, src[i]);
+	}
+
+	uint32_t peak_bin_(uint32_t org, uint32_t end) noexcept
+	{
+		uint32_t bin = org;
+		for(uint32_t i = org; i < end; ++i) {
+			if(spec_.get_power(i) > spec_.get_power(bin)) bin = i;
+		}
+		return bin;
+	}
+
+	// 窓を掛けた入力の DFT（各段 1/2 のスケーリングと同じく、1/N）
+	double dft_power_(const int16_t* src, uint32_t bin) noexcept
+	{
+		double re = 0.0;
+		double im = 0.0;
+		for(uint32_t i = 0; i < FFT_N; ++i) {
+			double w = 0.5 - 0.5 * std::cos(2.0 * M_PI * i / (FFT_N - 1));
+			double v = src[i] * w;
+			double a = 2.0 * M_PI * bin * i / FFT_N;
+			re += v * std::cos(a);
+			im -= v * std::sin(a);
+		}
+		re /= FFT_N;
+		im /= FFT_N;
+		return re * re + im * im;
+	}
+
+	template <class FUNC>
+	double time_us_(uint32_t loop, FUNC func) noexcept
+	{
+		auto st = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < loop; ++i) func();
+		auto d = std::chrono::steady_clock::now() - st;
+		return std::chrono::duration<double, std::micro>(d).count() / loop;
+	}
+
+	// ADC の変換結果を置いて、TPU の割り込みを１回
+	void sample_(uint16_t ch0, uint16_t ch1) noexcept
+	{
+		using namespace device;
+		sim::space::poke<uint16_t>(S12AD::ADDR.get_address(S12AD::analog::AIN000), ch0);
+		// S12AD1 の ADDR は、AIN100 から（ADCSR + 0x20）
+		sim::space::poke<uint16_t>(S12AD1::ADCSR.address() + 0x20
+			+ static_cast<uint32_t>(S12AD1::analog::AIN114) * 2, ch1);
+		sim::intr::raise(static_cast<uint32_t>(ICU::VECTOR::INTB128));
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+
+	{  // 単一の正弦波（ビンの中心）
+		for(auto& v : wave_) v = 0;
+		sine_(wave_, FFT_N, 37.0f, 16384.0f);
+		load_(wave_);
+		spec_.update();
+		CHECK(peak_bin_(1, SPECTRUM::BIN_NUM) == 37);
+		// ハン窓なので、隣のビンは -6dB（1/4）、その外は十分小さい
+		auto p = spec_.get_power(37);
+		CHECK(spec_.get_power(36) < p / 3 && spec_.get_power(38) < p / 3);
+		CHECK(spec_.get_power(40) < p / 1000);
+
+		// 浮動小数点の DFT との比較（主要なビン）
+		bool ok = true;
+		for(uint32_t b = 35; b <= 39; ++b) {
+			double ref = dft_power_(wave_, b);
+			double err = std::fabs(spec_.get_power(b) - ref);
+			if(err > (ref * 0.02 + 64.0)) ok = false;
+		}
+		CHECK(ok);
+	}
+
+	{  // ２つの正弦波（ビンの間を含む）
+		for(auto& v : wave_) v = 0;
+		sine_(wave_, FFT_N, 50.0f, 8000.0f);
+		sine_(wave_, FFT_N, 200.5f, 4000.0f);
+		load_(wave_);
+		spec_.update();
+		CHECK(peak_bin_(1, 120) == 50);
+		auto b = peak_bin_(150, 250);
+		CHECK(b == 200 || b == 201);
+		CHECK(spec_.get_power(50) > spec_.get_power(b));
+	}
+
+	{  // 平均化とピーク・ホールド
+		// 半分の振幅のパワー（平均しない）
+		spec_.clear();
+		spec_.set_average(0);
+		for(auto& v : wave_) v = 0;
+		sine_(wave_, FFT_N, 64.0f, 8192.0f);
+		load_(wave_);
+		spec_.update();
+		auto half = spec_.get_power(64);
+
+		spec_.clear();
+		spec_.set_average(2);
+		for(auto& v : wave_) v = 0;
+		sine_(wave_, FFT_N, 64.0f, 16384.0f);
+		load_(wave_);
+		spec_.update();
+		auto full = spec_.get_power(64);
+		CHECK(half > (full / 5) && half < (full / 3));
+		for(auto& v : wave_) v = 0;
+		sine_(wave_, FFT_N, 64.0f, 8192.0f);
+		load_(wave_);
+		spec_.update();
+		// 差の 1/4 だけ近づく
+		CHECK(spec_.get_power(64) == (full - ((full - half) >> 2)));
+		CHECK(spec_.get_peak(64) == full);
+		spec_.set_average(0);
+	}
+
+	{  // デシベル変換（整数に切り捨てるので、誤差 1.5dB 以内、単調増加）
+		bool ok = true;
+		int16_t last = 0;
+		for(uint32_t p = 1; p < 0x80000000; p += (p >> 3) + 1) {
+			auto db = SPECTRUM::to_db(p);
+			if(std::fabs(db - 10.0 * std::log10(static_cast<double>(p))) > 1.5) ok = false;
+			if(db < last) ok = false;
+			last = db;
+		}
+		CHECK(ok);
+		CHECK(SPECTRUM::to_db(0) == 0);
+	}
+
+	{  // デシメーション（総当たりとの比較）
+		uint32_t x = 12345;
+		for(auto& v : wave_) {
+			x = x * 1103515245 + 12345;
+			v = static_cast<int16_t>(x >> 16);
+		}
+		deci_.build([](uint32_t pos) { return wave_[pos]; });
+		bool ok = true;
+		for(uint32_t lvl = 1; lvl <= LVL; ++lvl) {
+			CHECK(DECIMATE::size(lvl) == (CAP_N >> lvl));
+			for(uint32_t i = 0; i < DECIMATE::size(lvl); ++i) {
+				int16_t mn = 32767;
+				int16_t mx = -32768;
+				for(uint32_t j = 0; j < (1u << lvl); ++j) {
+					auto v = wave_[(i << lvl) + j];
+					if(v < mn) mn = v;
+					if(v > mx) mx = v;
+				}
+				const auto& t = deci_.get(lvl, i);
+				if(t.min_ != mn || t.max_ != mx) ok = false;
+			}
+		}
+		CHECK(ok);
+	}
+
+	{  // キャプチャー（２面のバッファ）
+		CHECK(cap_.start(1000000));
+		cap_.set_trigger(utils::capture_trigger::STREAM);
+		for(uint32_t i = 0; i < CAP_N; ++i) sample_(i, i + 1);
+		CHECK(cap_.get_count() == 1);
+		auto bank = cap_.acquire();
+		CHECK(cap_.get(0).ch0_ == 0 && cap_.get(CAP_N - 1).ch0_ == (CAP_N - 1));
+		CHECK(cap_.get(5).ch1_ == 6);
+
+		// 固定中に完了したブロックは捨てる（もう片方を書き直す）
+		for(uint32_t i = 0; i < CAP_N; ++i) sample_(0x1000 + i, 0);
+		CHECK(cap_.get_count() == 1);
+		CHECK(cap_.get_overrun() == 1);
+		for(uint32_t i = 0; i < CAP_N; ++i) sample_(0x2000 + i, 0);
+		CHECK(cap_.get_count() == 1);
+		CHECK(cap_.get_overrun() == 2);
+		CHECK(cap_.get(0).ch0_ == 0 && cap_.get(10).ch0_ == 10);  // 固定中のバッファは変わらない
+		cap_.release();
+
+		// 解除すれば、切り替わる
+		for(uint32_t i = 0; i < CAP_N; ++i) sample_(0x3000 + i, 0);
+		CHECK(cap_.get_count() == 2);
+		auto b2 = cap_.acquire();
+		CHECK(b2 != bank);
+		CHECK(cap_.get(10).ch0_ == (0x3000 + 10));
+		cap_.release();
+		cap_.set_trigger(utils::capture_trigger::NONE);
+	}
+
+	{  // 時間（ホスト上での目安、参考値）
+		for(auto& v : wave_) v = 0;
+		sine_(wave_, FFT_N, 37.0f, 16384.0f);
+		auto fft = time_us_(200, []() {
+			load_(wave_);
+			spec_.update();
+		});
+		auto build = time_us_(200, []() {
+			deci_.build([](uint32_t pos) { return wave_[pos]; });
+		});
+		// 描画１画面分（480 列、レベル２）：テーブル参照と、毎回の走査
+		volatile int32_t sum = 0;
+		auto table = time_us_(2000, [&]() {
+			for(uint32_t i = 0; i < 480; ++i) {
+				const auto& t = deci_.get(2, i);
+				sum += t.max_ - t.min_;
+			}
+		});
+		auto scan = time_us_(2000, [&]() {
+			for(uint32_t i = 0; i < 480; ++i) {
+				int16_t mn = 32767;
+				int16_t mx = -32768;
+				for(uint32_t j = 0; j < 4; ++j) {
+					auto v = wave_[i * 4 + j];
+					if(v < mn) mn = v;
+					if(v > mx) mx = v;
+				}
+				sum += mx - mn;
+			}
+		});
+		printf("dsos_test: FFT(%u) %.1f us, decimate build(%u) %.1f us, draw table %.2f us, scan %.2f us\n",
+			FFT_N, fft, CAP_N, build, table, scan);
+		CHECK(fft > 0.0 && build > 0.0);
+	}
+
+	return sim_test::result::report("dsos_test");
+}
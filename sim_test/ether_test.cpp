@@ -0,0 +1,375 @@
+//=====================================================================//
+/*!	@file
+	@brief	ether_io（RX600）と net2 ethernet のホスト・テスト @n
+			（IO_SIM の EDMAC モデル使用） @n
+			・送信割り込みの間引き（TRIMD、TWBI）：間隔毎と、送信リングが @n
+			  満杯になる時だけ、割り込みが発生する事 @n
+			・割り込みが遅れて、複数のフレームが溜まっても、１回の割り込み @n
+			  で全て処理する事（受信リングが空く事） @n
+			・ping（エコー要求）をワイヤー速度で与えた時の、割り込み回数、@n
+			  捨てたフレーム数、処理時間（表示）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <chrono>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include "common/renesas.hpp"
+#include "RX600/ether_io.hpp"
+#include "net2/ethernet.hpp"
+#include "check.hpp"
+
+namespace {
+
+	volatile uint32_t	counter_ = 0;
+}
+
+extern "C" {
+	uint32_t get_counter() { return counter_; }
+	time_t get_time() { return 0; }
+}
+
+namespace {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	PHY の代わり（リンクは link_ で切り替える、100Mbps / Full）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct phy_t {
+		bool	link_;
+
+		phy_t() noexcept : link_(false) { }
+
+		bool init() noexcept { return true; }
+
+		void start_autonegotiate(bool pause_frame) noexcept { }
+
+		chip::phy_link_state get_autonegotiate(uint16_t& local_pause, uint16_t& partner_pause) noexcept
+		{
+			return chip::phy_link_state::LINK_100F;
+		}
+
+		bool get_link_status() noexcept { return link_; }
+	};
+
+	static const uint32_t TXDN = 8;
+	static const uint32_t RXDN = 8;
+	static const uint32_t PCLK = F_PCLKA;
+
+	typedef device::ether_io<device::ETHERC0, device::EDMAC0, phy_t, TXDN, RXDN> ETHD;
+	typedef net::ethernet<ETHD, 1, 1> ETHERNET;
+	typedef device::sim::edmac_model<device::EDMAC0> EDMAC_MODEL;
+
+	ETHD		ethd_;
+	ETHERNET	eth_(ethd_);
+	EDMAC_MODEL	edmac_(static_cast<uint32_t>(device::ICU::VECTOR::GROUPAL1), PCLK);
+
+	static const uint8_t MAC[6]  = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x0A };
+	static const uint8_t PEER[6] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x02 };
+
+	typedef std::vector<uint8_t> FRAME;
+	std::vector<FRAME>	sent_;
+
+	void ethd_process_()
+	{
+		eth_.process();
+	}
+
+
+	// リンクを切ってから、間引き数を設定して、リンク・アップ @n
+	// （ether_io のデバッグ出力は捨てる）
+	void link_up_(uint8_t coalesce)
+	{
+		fflush(stdout);
+		int out = dup(1);
+		int null = open("/dev/null", O_WRONLY);
+		dup2(null, 1);
+		ethd_.at_phy().link_ = false;
+		ethd_.polling_link_status();
+		ethd_.service_link();
+		ethd_.set_tx_coalesce(coalesce);
+		ethd_.at_phy().link_ = true;
+		ethd_.polling_link_status();
+		ethd_.service_link();
+		fflush(stdout);
+		dup2(out, 1);
+		close(out);
+		close(null);
+		edmac_.reset_count();
+		sent_.clear();
+	}
+
+
+	// フレームのワイヤー上の時間（PCLK）
+	uint32_t wire_clk_(uint32_t len) noexcept
+	{
+		if(len < 60) len = 60;
+		return (static_cast<uint64_t>(len + 8 + 4 + 12) * 8 * PCLK + 99999999) / 100000000;
+	}
+
+
+	// 全て送信するまで、時間を進める
+	void flush_() noexcept
+	{
+		for(int i = 0; i < 1000; ++i) {
+			device::sim::space::step(wire_clk_(1514));
+			if(device::EDMAC0::EDTRR() == 0) break;
+		}
+	}
+
+
+	// 生のフレーム（６０バイト）を送信
+	int32_t send_raw_(uint8_t id) noexcept
+	{
+		void* dst;
+		uint16_t len;
+		auto ret = ethd_.send_buff(&dst, len);
+		if(ret != 0) return ret;
+		auto p = static_cast<uint8_t*>(dst);
+		std::memset(p, 0, 60);
+		std::memcpy(p, PEER, 6);
+		std::memcpy(p + 6, MAC, 6);
+		p[12] = 0x88;
+		p[13] = 0xB5;  // 実験用
+		p[14] = id;
+		return ethd_.send(60);
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	ping（エコー要求）のフレームを作る
+		@param[in]	seq		シーケンス番号
+		@param[in]	len		ICMP メッセージ長（ヘッダーを含む）
+		@return フレーム
+	*/
+	//-----------------------------------------------------------------//
+	FRAME ping_(uint16_t seq, uint32_t len)
+	{
+		using net::tools;
+		FRAME f(14 + 20 + len);
+		std::memcpy(&f[0], MAC, 6);
+		std::memcpy(&f[6], PEER, 6);
+		f[12] = 0x08;
+		f[13] = 0x00;
+		uint8_t* ip = &f[14];
+		static const uint8_t ih[20] = {
+			0x45, 0x00, 0x00, 0x00, 0x12, 0x34, 0x40, 0x00, 0x40, 0x01,
+			0x00, 0x00, 192, 168, 0, 2, 192, 168, 0, 10 };
+		std::memcpy(ip, ih, 20);
+		ip[2] = (20 + len) >> 8;
+		ip[3] = 20 + len;
+		auto cs = tools::calc_sum(ip, 20);
+		ip[10] = cs >> 8;
+		ip[11] = cs;
+		uint8_t* m = ip + 20;
+		m[0] = 0x08;
+		m[1] = 0x00;
+		m[4] = 0xAB;
+		m[5] = 0xCD;
+		m[6] = seq >> 8;
+		m[7] = seq;
+		for(uint32_t i = 8; i < len; ++i) m[i] = i + seq;
+		cs = tools::calc_sum(m, len);
+		m[2] = cs >> 8;
+		m[3] = cs;
+		return f;
+	}
+
+
+	// エコー応答で、シーケンス番号が一致する事
+	bool is_reply_(const FRAME& f, uint16_t seq) noexcept
+	{
+		if(f.size() < (14 + 20 + 8)) return false;
+		if(std::memcmp(&f[0], PEER, 6) != 0 || std::memcmp(&f[6], MAC, 6) != 0) return false;
+		const uint8_t* m = &f[14 + 20];
+		uint32_t len = f.size() - 14 - 20;
+		return m[0] == 0x00 && m[6] == (seq >> 8) && m[7] == (seq & 0xff)
+			&& net::tools::calc_sum(m, len) == 0x0000;
+	}
+
+
+	struct result_t {
+		uint32_t	frames_;
+		uint32_t	replies_;
+		uint32_t	lost_;
+		uint32_t	intr_;
+		double		us_;
+	};
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	ping をワイヤー速度で与える
+		@param[in]	num		フレーム数
+		@param[in]	len		ICMP メッセージ長
+		@param[in]	batch	割り込みを保留するフレーム数（割り込みの遅れ）
+		@return 結果
+	*/
+	//-----------------------------------------------------------------//
+	result_t stream_(uint32_t num, uint32_t len, uint32_t batch)
+	{
+		std::vector<FRAME> req;
+		for(uint32_t i = 0; i < 16; ++i) req.push_back(ping_(i, len));
+		uint32_t clk = wire_clk_(req[0].size());
+
+		edmac_.reset_count();
+		uint32_t replies = 0;
+		edmac_.set_output([&](const uint8_t* p, uint32_t n) { ++replies; });
+		auto t0 = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < num; ++i) {
+			if((i % batch) == 0) edmac_.hold(true);
+			const auto& f = req[i & 15];
+			edmac_.recv(f.data(), f.size());
+			if((i % batch) == (batch - 1)) edmac_.hold(false);
+			device::sim::space::step(clk);
+		}
+		edmac_.hold(false);
+		flush_();
+		auto t1 = std::chrono::steady_clock::now();
+		edmac_.set_output([](const uint8_t* p, uint32_t n) { sent_.emplace_back(p, p + n); });
+
+		result_t r;
+		r.frames_ = num;
+		r.replies_ = replies;
+		r.lost_ = edmac_.get_lost();
+		r.intr_ = edmac_.get_intr();
+		r.us_ = std::chrono::duration<double, std::micro>(t1 - t0).count();
+		return r;
+	}
+
+
+	void report_(const char* name, const result_t& r, uint32_t len)
+	{
+		double fps = r.frames_ / (r.us_ / 1e6);
+		printf("ether_test: %-22s %5.2f intr/frame, lost %u, replies %u/%u, host %.2f us/frame (%.0f Mbps)\n",
+			name, static_cast<double>(r.intr_) / r.frames_, r.lost_, r.replies_, r.frames_,
+			r.us_ / r.frames_, fps * (14 + 20 + len) * 8 * 2 / 1e6);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+	sim::space::attach(edmac_);
+	edmac_.set_output([](const uint8_t* p, uint32_t n) { sent_.emplace_back(p, p + n); });
+
+	eth_.at_info().ip.set(192, 168, 0, 10);
+	eth_.at_info().mask.set(255, 255, 255, 0);
+	eth_.at_info().gw.set(192, 168, 0, 1);
+	std::memcpy(eth_.at_info().mac, MAC, 6);
+
+	ethd_.start(4);
+	CHECK(ethd_.open(MAC));
+	ethd_.set_intr_task(ethd_process_);
+
+	{  // 間引き無し：TC 割り込みを毎フレーム
+		link_up_(0);
+		CHECK(EDMAC0::TRIMD() == 0);
+		CHECK(EDMAC0::EESIPR.TCIP() == 1 && EDMAC0::EESIPR.TWBIP() == 0);
+		for(uint8_t i = 0; i < 20; ++i) {
+			CHECK(send_raw_(i) == 0);
+			flush_();
+		}
+		CHECK(edmac_.get_send_num() == 20);
+		CHECK(edmac_.get_intr() == 20);
+		CHECK(ethd_.get_stat().send_request_ == 20);
+	}
+
+	{  // 間引き（４フレーム毎）：TWB 割り込み
+		link_up_(4);
+		CHECK(EDMAC0::TRIMD.TIS() == 1 && EDMAC0::TRIMD.TIM() == 1);
+		CHECK(EDMAC0::EESIPR.TCIP() == 0 && EDMAC0::EESIPR.TWBIP() == 1);
+		for(uint8_t i = 0; i < 20; ++i) {
+			CHECK(send_raw_(i) == 0);
+			flush_();
+		}
+		CHECK(edmac_.get_send_num() == 20);
+		CHECK(edmac_.get_intr() == 5);
+		bool order = sent_.size() == 20;
+		for(uint32_t i = 0; order && i < 20; ++i) {
+			if(sent_[i][14] != i) order = false;
+		}
+		CHECK(order);  // リングを何周しても、順番に送信する
+	}
+
+	{  // 送信リングが満杯になる場合（間隔５、ワイヤーが止まっている間に８フレーム）
+		link_up_(5);
+		for(uint8_t i = 0; i < TXDN; ++i) {
+			CHECK(send_raw_(i) == 0);
+		}
+		CHECK(send_raw_(TXDN) != 0);  // 空きが無い
+		// ５フレーム目と、リングを埋めた８フレーム目で割り込み
+		for(uint32_t i = 0; i < TXDN; ++i) {
+			sim::space::step(wire_clk_(60));
+			if(i == 4) CHECK(edmac_.get_intr() == 1);
+			if(i == 6) CHECK(edmac_.get_intr() == 1);
+		}
+		CHECK(edmac_.get_send_num() == TXDN);
+		CHECK(edmac_.get_intr() == 2);
+		CHECK(send_raw_(0) == 0);
+		flush_();
+	}
+
+	{  // 割り込みが遅れて、受信フレームが溜まった場合
+		link_up_(4);
+		edmac_.hold(true);
+		for(uint16_t i = 0; i < RXDN; ++i) {
+			auto f = ping_(i, 64);
+			CHECK(edmac_.recv(f.data(), f.size()));
+		}
+		{
+			auto f = ping_(99, 64);
+			CHECK(!edmac_.recv(f.data(), f.size()));  // 受信リングが満杯
+		}
+		auto rr = ethd_.get_stat().recv_request_;
+		edmac_.hold(false);  // １回の割り込みで、全て処理する
+		CHECK(edmac_.get_intr() == 1);
+		CHECK((ethd_.get_stat().recv_request_ - rr) == RXDN);
+		flush_();
+		bool ok = sent_.size() == RXDN;
+		for(uint16_t i = 0; ok && i < RXDN; ++i) {
+			if(!is_reply_(sent_[i], i)) ok = false;
+		}
+		CHECK(ok);
+
+		// 受信リングが全て空いている事
+		edmac_.reset_count();
+		edmac_.hold(true);
+		for(uint16_t i = 0; i < RXDN; ++i) {
+			auto f = ping_(i, 64);
+			edmac_.recv(f.data(), f.size());
+		}
+		edmac_.hold(false);
+		CHECK(edmac_.get_lost() == 0);
+		flush_();
+	}
+
+	{  // ping をワイヤー速度で与える（結果は表示のみ）
+		static const uint32_t NUM = 20000;
+		static const uint32_t LEN = 64;
+		link_up_(0);
+		auto a = stream_(NUM, LEN, 1);
+		link_up_(4);
+		auto b = stream_(NUM, LEN, 1);
+		auto c = stream_(NUM, LEN, 4);
+		CHECK(a.replies_ == NUM && a.lost_ == 0);
+		CHECK(b.replies_ == NUM && b.lost_ == 0);
+		CHECK(c.replies_ == NUM && c.lost_ == 0);
+		CHECK(b.intr_ < a.intr_);
+		CHECK(c.intr_ < b.intr_);
+		report_("TC every frame", a, LEN);
+		report_("TWB every 4", b, LEN);
+		report_("TWB every 4, RX batch 4", c, LEN);
+	}
+
+	return sim_test::result::report("ether_test");
+}
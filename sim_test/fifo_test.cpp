@@ -0,0 +1,330 @@
+//=====================================================================//
+/*!	@file
+	@brief	fixed_fifo のホスト・テスト、ベンチマーク @n
+			・変更前の実装（legacy::fixed_fifo）と、同じ操作列で比較する。@n
+			・SIZE が２のべき乗の場合、格納可能数は SIZE（変更前は SIZE - 1）@n
+			  満杯の境界で、put_span、複数格納が止まる事 @n
+			・SIZE が２のべき乗で無い場合、変更前と全く同じ動作をする事 @n
+			・１バイト、４バイト、wave_t で、put/get 一組当たりと、ブロックの @n
+			  複数格納、取得の時間を、変更前と比較して表示する。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <chrono>
+#include "common/fixed_fifo.hpp"
+#include "sound/sound_out.hpp"
+#include "check.hpp"
+
+namespace legacy {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  変更前の固定サイズ FIFO クラス（比較用、put/get 部分のみ）
+		@param[in]	UNIT	基本形
+		@param[in]	SIZE	バッファサイズ
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <class UNIT, uint32_t SIZE>
+	class fixed_fifo {
+
+		volatile uint32_t	get_;
+		volatile uint32_t	put_;
+
+		UNIT	buff_[SIZE];
+
+	public:
+		fixed_fifo() noexcept : get_(0), put_(0) { }
+
+		inline uint32_t size() const noexcept { return SIZE; }
+
+		uint32_t length() const noexcept {
+			if(put_ >= get_) return (put_ - get_);
+			else return (SIZE + put_ - get_);
+		}
+
+		inline void put_go() noexcept {
+			volatile auto put = put_;
+			++put;
+			if(put >= SIZE) {
+				put = 0;
+			}
+			put_ = put;
+		}
+
+		void put(const UNIT& v) noexcept {
+			buff_[put_] = v;
+			put_go();
+		}
+
+		inline void get_go() noexcept {
+			volatile auto get = get_;
+			++get;
+			if(get >= SIZE) {
+				get = 0;
+			}
+			get_ = get;
+		}
+
+		UNIT get() noexcept {
+			UNIT v = buff_[get_];
+			get_go();
+			return v;
+		}
+
+		inline uint16_t pos_get() const noexcept { return get_; }
+
+		inline uint16_t pos_put() const noexcept { return put_; }
+	};
+}
+
+namespace {
+
+	uint32_t	rand_ = 2463534242;
+
+	uint32_t xorshift_() noexcept
+	{
+		rand_ ^= rand_ << 13;
+		rand_ ^= rand_ >> 17;
+		rand_ ^= rand_ << 5;
+		return rand_;
+	}
+
+
+	// 同じ操作列を与え、取り出す値、長さ、位置が変更前と同じ事
+	template <uint32_t SIZE>
+	void compare_(uint32_t loop) noexcept
+	{
+		legacy::fixed_fifo<uint8_t, SIZE> ref;
+		utils::fixed_fifo<uint8_t, SIZE> dut;
+
+		uint8_t cnt = 0;
+		uint32_t diff = 0;
+		for(uint32_t i = 0; i < loop; ++i) {
+			auto r = xorshift_();
+			if((r & 1) != 0 && ref.length() < (SIZE - 1)) {  // 変更前の満杯判定
+				ref.put(cnt);
+				dut.put(cnt);
+				++cnt;
+			} else if(ref.length() > 0) {
+				if(ref.get() != dut.get()) ++diff;
+			}
+			if(ref.length() != dut.length()) ++diff;
+			if(ref.pos_put() != dut.pos_put() || ref.pos_get() != dut.pos_get()) ++diff;
+		}
+		CHECK(diff == 0);
+	}
+
+
+	// 格納可能数の境界（満杯まで入れて、もう入らない事、一つ出せば入る事、順番通りに出る事）
+	template <uint32_t SIZE>
+	uint32_t capacity_() noexcept
+	{
+		utils::fixed_fifo<uint16_t, SIZE> dut;
+		uint32_t cap = dut.capacity();
+		uint32_t err = 0;
+		// 途中から始めて、バッファ終端での折り返しを含める
+		for(uint32_t i = 0; i < (SIZE / 2 + 1); ++i) {
+			dut.put(0);
+			dut.get();
+		}
+		for(uint32_t i = 0; i < cap; ++i) {
+			if(dut.put_span() == 0) ++err;
+			dut.put(i);
+		}
+		if(dut.length() != cap) ++err;
+		if(dut.put_span() != 0) ++err;
+		uint16_t v = 0xffff;
+		if(dut.put(&v, 1) != 0) ++err;
+		if(dut.get() != 0) ++err;
+		if(dut.put_span() == 0) ++err;
+		if(dut.put(&v, 1) != 1) ++err;
+		if(dut.length() != cap) ++err;
+		for(uint32_t i = 1; i < cap; ++i) {
+			if(dut.get() != i) ++err;
+		}
+		if(dut.get() != v) ++err;
+		if(dut.length() != 0) ++err;
+
+		// 複数格納は、格納可能数で止まる
+		uint16_t src[SIZE + 4];
+		for(uint32_t i = 0; i < (SIZE + 4); ++i) src[i] = i;
+		if(dut.put(src, SIZE + 4) != cap) ++err;
+		uint16_t dst[SIZE + 4];
+		if(dut.get(dst, SIZE + 4) != cap) ++err;
+		for(uint32_t i = 0; i < cap; ++i) {
+			if(dst[i] != i) ++err;
+		}
+		CHECK(err == 0);
+		return cap;
+	}
+
+
+	// 連続領域、複数格納、取得
+	template <uint32_t SIZE>
+	void bulk_() noexcept
+	{
+		utils::fixed_fifo<uint8_t, SIZE> dut;
+		uint8_t src[SIZE * 2];
+		uint8_t dst[SIZE * 2];
+		for(uint32_t i = 0; i < sizeof(src); ++i) src[i] = i * 7 + 3;
+
+		uint32_t pos = 0;
+		uint32_t err = 0;
+		for(uint32_t i = 0; i < 1000; ++i) {
+			uint32_t n = xorshift_() % SIZE;
+			uint32_t m = dut.put(&src[pos], n);
+			if(m > n) ++err;
+			if(dut.get(dst, m) != m) ++err;
+			for(uint32_t j = 0; j < m; ++j) {
+				if(dst[j] != src[pos + j]) ++err;
+			}
+			pos = (pos + m) % SIZE;
+			if(dut.put_span() == 0 && dut.length() < (SIZE - 1)) ++err;
+			if(dut.get_span() > dut.length()) ++err;
+		}
+		CHECK(err == 0);
+	}
+
+
+	template <class UNIT>
+	UNIT make_(uint32_t i) noexcept { return static_cast<UNIT>(i); }
+
+	template <>
+	sound::wave_t make_(uint32_t i) noexcept
+	{
+		sound::wave_t w;
+		w.l_ch = i;
+		w.r_ch = i >> 16;
+		return w;
+	}
+
+	inline uint32_t value_(uint32_t v) noexcept { return v; }
+	inline uint32_t value_(const sound::wave_t& w) noexcept { return w.l_ch + w.r_ch; }
+
+
+	// put/get 一組当たり（ns）
+	template <class UNIT, class FIFO>
+	double bench_(FIFO& fifo, uint32_t loop) noexcept
+	{
+		auto t0 = std::chrono::steady_clock::now();
+		uint32_t sum = 0;
+		for(uint32_t i = 0; i < loop; ++i) {
+			fifo.put(make_<UNIT>(i));
+			fifo.put(make_<UNIT>(i + 1));
+			sum += value_(fifo.get());
+			sum += value_(fifo.get());
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		volatile uint32_t sink = sum;
+		(void)sink;
+		auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+		return static_cast<double>(ns) / (loop * 2);
+	}
+
+
+	// 変更前は複数格納、取得が無いので、一つずつ put/get する
+	template <class UNIT, uint32_t SIZE>
+	void bulk_put_(legacy::fixed_fifo<UNIT, SIZE>& fifo, const UNIT* src, uint32_t n) noexcept
+	{
+		for(uint32_t i = 0; i < n; ++i) fifo.put(src[i]);
+	}
+
+	template <class UNIT, uint32_t SIZE>
+	void bulk_get_(legacy::fixed_fifo<UNIT, SIZE>& fifo, UNIT* dst, uint32_t n) noexcept
+	{
+		for(uint32_t i = 0; i < n; ++i) dst[i] = fifo.get();
+	}
+
+	template <class UNIT, uint32_t SIZE, bool POW2>
+	void bulk_put_(utils::fixed_fifo<UNIT, SIZE, POW2>& fifo, const UNIT* src, uint32_t n) noexcept
+	{
+		fifo.put(src, n);
+	}
+
+	template <class UNIT, uint32_t SIZE, bool POW2>
+	void bulk_get_(utils::fixed_fifo<UNIT, SIZE, POW2>& fifo, UNIT* dst, uint32_t n) noexcept
+	{
+		fifo.get(dst, n);
+	}
+
+
+	// ブロック（BLK 個）の格納、取得、１個当たり（ns）
+	template <class UNIT, uint32_t BLK, class FIFO>
+	double bulk_bench_(FIFO& fifo, uint32_t loop) noexcept
+	{
+		UNIT src[BLK];
+		UNIT dst[BLK];
+		for(uint32_t i = 0; i < BLK; ++i) src[i] = make_<UNIT>(i * 3);
+		auto t0 = std::chrono::steady_clock::now();
+		uint32_t sum = 0;
+		for(uint32_t i = 0; i < loop; ++i) {
+			bulk_put_(fifo, src, BLK);
+			bulk_get_(fifo, dst, BLK);
+			sum += value_(dst[i % BLK]);
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		volatile uint32_t sink = sum;
+		(void)sink;
+		auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+		return static_cast<double>(ns) / (static_cast<double>(loop) * BLK);
+	}
+
+
+	template <class UNIT>
+	void bench_type_(const char* name) noexcept
+	{
+		static const uint32_t loop = 10000000;
+		static const uint32_t BLK = 64;
+		static const uint32_t bloop = loop / BLK;
+		legacy::fixed_fifo<UNIT, 256> ref;
+		utils::fixed_fifo<UNIT, 256> pow2;
+		utils::fixed_fifo<UNIT, 250> mod;
+		auto a = bench_<UNIT>(ref, loop);
+		auto b = bench_<UNIT>(pow2, loop);
+		auto c = bench_<UNIT>(mod, loop);
+		auto d = bulk_bench_<UNIT, BLK>(ref, bloop);
+		auto e = bulk_bench_<UNIT, BLK>(pow2, bloop);
+		auto f = bulk_bench_<UNIT, BLK>(mod, bloop);
+		printf("fifo_test: %-8s put/get legacy(256) %.2f, pow2(256) %.2f, non-pow2(250) %.2f ns;"
+			" block(%u) legacy %.2f, pow2 %.2f, non-pow2 %.2f ns / unit\n",
+			name, a, b, c, BLK, d, e, f);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	compare_<64>(100000);
+	compare_<256>(100000);
+	compare_<100>(100000);
+	compare_<3>(10000);
+
+	CHECK(capacity_<64>() == 64);  // 変更前は 63
+	CHECK(capacity_<2>() == 2);    // 変更前は 1
+	CHECK(capacity_<256>() == 256);  // 変更前は 255
+	CHECK(capacity_<100>() == 99);  // 変更前と同じ
+	CHECK(capacity_<3>() == 2);
+
+	bulk_<64>();
+	bulk_<100>();
+
+	{  // ２のべき乗の length() は、put_/get_ の差（満杯でも曖昧にならない）
+		utils::fixed_fifo<char, 8> dut;
+		for(int i = 0; i < 8; ++i) dut.put(i);
+		CHECK(dut.length() == 8);
+		CHECK(dut.put_span() == 0);
+		CHECK(dut.pos_put() == dut.pos_get());
+		dut.clear();
+		CHECK(dut.length() == 0);
+	}
+
+	// ベンチマーク（結果は表示のみ）
+	bench_type_<uint8_t>("uint8_t");
+	bench_type_<uint32_t>("uint32_t");
+	bench_type_<sound::wave_t>("wave_t");
+
+	return sim_test::result::report("fifo_test");
+}
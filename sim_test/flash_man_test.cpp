@@ -0,0 +1,379 @@
+//=====================================================================//
+/*!	@file
+	@brief	utils::flash_man のホスト・テスト（RAM のフラッシュ I/O） @n
+			・フラッシュ I/O は、ブランク状態を持ち、消去せずに同じワード @n
+			  を二度書いたら数える。@n
+			・ランダムな書き込み、削除を、参照（std::map）と比べ、@n
+			  再起動（start）後も同じ事 @n
+			・電源断：指定した回数目の書き込み（ワード）、消去で止め、@n
+			  そのワードは不定値、ブロックは途中まで消去された状態にする。@n
+			  レコードの途中、コミット・ワードの途中、ガベージ・コレク @n
+			  ションの途中で止めても、再起動後、全ての ID が古い値か新しい @n
+			  値を持ち、書き込みを続けられる事 @n
+			・64K バイトを超えるセグメント
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include "common/flash_man.hpp"
+#include "check.hpp"
+
+namespace {
+
+	uint32_t	rand_ = 2463534242;
+
+	uint32_t xorshift_() noexcept
+	{
+		rand_ ^= rand_ << 13;
+		rand_ ^= rand_ >> 17;
+		rand_ ^= rand_ << 5;
+		return rand_;
+	}
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	RAM のフラッシュ I/O（flash_io の代わり） @n
+				電源断の後は、書き込み、消去が全て失敗する。
+		@param[in]	SIZE	容量
+		@param[in]	BLOCK	ブロック・サイズ
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <uint32_t SIZE, uint32_t BLOCK>
+	class ram_fio {
+	public:
+		static const uint32_t data_flash_block = BLOCK;
+		static const uint32_t data_flash_size  = SIZE;
+		static const uint32_t data_flash_word  = 4;
+
+		enum class cut_type : uint8_t {
+			NONE,
+			HEAD,	///< セグメント・ヘッダー
+			BODY,	///< レコード（ID、LEN、データ）
+			COMMIT,	///< コミット・ワード
+			ERASE,	///< 消去
+		};
+
+	private:
+		uint8_t		mem_[SIZE];
+		bool		blank_[SIZE];
+
+		uint32_t	ops_;
+		uint32_t	cut_;
+		bool		dead_;
+		cut_type	type_;
+
+		uint32_t	reprog_;
+
+		// 書き込み、消去の回数を数え、電源断なら「true」
+		bool tick_() noexcept
+		{
+			++ops_;
+			if(cut_ == 0 || ops_ != cut_) return false;
+			dead_ = true;
+			return true;
+		}
+
+	public:
+		ram_fio() noexcept : ops_(0), cut_(0), dead_(false), type_(cut_type::NONE), reprog_(0)
+		{
+			std::memset(mem_, 0xFF, sizeof(mem_));
+			for(auto& b : blank_) b = true;
+		}
+
+		void set_cut(uint32_t n) noexcept
+		{
+			ops_ = 0;
+			cut_ = n;
+			dead_ = false;
+			type_ = cut_type::NONE;
+		}
+
+		bool is_dead() const noexcept { return dead_; }
+
+		cut_type get_cut_type() const noexcept { return type_; }
+
+		uint32_t get_reprog() const noexcept { return reprog_; }
+
+		bool read(uint32_t org, void* dst, uint32_t len) noexcept
+		{
+			if((org + len) > SIZE) return false;
+			std::memcpy(dst, &mem_[org], len);
+			return true;
+		}
+
+		bool erase_check(uint32_t org, uint32_t len = data_flash_block) noexcept
+		{
+			for(uint32_t i = 0; i < len; ++i) {
+				if(!blank_[org + i]) return false;
+			}
+			return true;
+		}
+
+		bool erase(uint32_t org) noexcept
+		{
+			if(dead_ || (org % BLOCK) != 0) return false;
+			if(tick_()) {  // 途中まで消去
+				uint32_t n = xorshift_() % BLOCK;
+				for(uint32_t i = 0; i < n; ++i) {
+					mem_[org + i] = xorshift_();
+					blank_[org + i] = (xorshift_() & 1) != 0;
+				}
+				type_ = cut_type::ERASE;
+				return false;
+			}
+			std::memset(&mem_[org], 0xFF, BLOCK);
+			for(uint32_t i = 0; i < BLOCK; ++i) blank_[org + i] = true;
+			return true;
+		}
+
+		bool write(uint32_t org, const void* src, uint32_t len) noexcept
+		{
+			if(dead_ || (org & 3) != 0 || (org + len) > SIZE) return false;
+			auto p = static_cast<const uint8_t*>(src);
+			for(uint32_t w = 0; w < len; w += 4) {
+				for(uint32_t i = 0; i < 4; ++i) {
+					if(!blank_[org + w + i]) ++reprog_;
+				}
+				if(tick_()) {  // ワードの途中で電源断（不定値）
+					for(uint32_t i = 0; i < 4; ++i) {
+						mem_[org + w + i] = xorshift_();
+						blank_[org + w + i] = false;
+					}
+					if(len == 8 && p[0] == 0x46 && p[1] == 0x4D) {
+						type_ = cut_type::HEAD;
+					} else if(len == 4 && (p[0] | (p[1] << 8)) == (~(p[2] | (p[3] << 8)) & 0xFFFF)) {
+						type_ = cut_type::COMMIT;
+					} else {
+						type_ = cut_type::BODY;
+					}
+					return false;
+				}
+				for(uint32_t i = 0; i < 4; ++i) {
+					mem_[org + w + i] = (w + i) < len ? p[w + i] : 0xFF;
+					blank_[org + w + i] = false;
+				}
+			}
+			return true;
+		}
+	};
+
+	typedef ram_fio<32768, 64> FIO;
+	typedef utils::flash_man<FIO, 64, 1024> FM;
+
+	static const uint32_t KEY_NUM = 12;
+
+	std::string value_(uint32_t id, uint32_t gen, uint32_t mul = 1)
+	{
+		std::string s = "id" + std::to_string(id) + "-gen" + std::to_string(gen) + "-";
+		uint32_t n = ((id * 7 + gen * 3) % 90) * mul;
+		for(uint32_t i = 0; i < n; ++i) s += static_cast<char>('a' + (i + gen) % 26);
+		return s;
+	}
+
+
+	template <class M>
+	bool equal_(M& fm, uint32_t id, const std::map<uint32_t, std::string>& ref)
+	{
+		static char tmp[32768];
+		bool have = fm.read(id, tmp, sizeof(tmp));
+		auto it = ref.find(id);
+		if(it == ref.end()) return !have && !fm.probe(id);
+		return have && fm.get_size(id) == static_cast<int32_t>(it->second.size())
+			&& std::memcmp(tmp, it->second.data(), it->second.size()) == 0;
+	}
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	書き込み、削除の手順（gen 番目の操作は、常に同じ）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct work_t {
+		std::map<uint32_t, std::string>	ref;	///< 確定した値
+		uint32_t	gen;
+
+		work_t() : ref(), gen(0) { }
+
+		// 一つ進める（失敗したら「false」、ref は変えない）
+		bool step(FM& fm, uint32_t& id, bool& del, std::string& val)
+		{
+			id = (gen * 2654435761u >> 7) % KEY_NUM;
+			del = ((gen * 40503u) >> 5) % 10 == 0 && ref.count(id) != 0;
+			bool ok;
+			if(del) {
+				ok = fm.remove(id);
+				if(ok) ref.erase(id);
+			} else {
+				val = value_(id, gen);
+				ok = fm.write(id, val.data(), val.size());
+				if(ok) ref[id] = val;
+			}
+			++gen;
+			return ok;
+		}
+	};
+
+	FIO		base_;
+	FIO		fio_;
+}
+
+int main(int argc, char** argv)
+{
+	{  // ランダムな書き込み、削除、再起動
+		auto& fio = fio_;
+		FM fm(fio);
+		fm.start();
+		std::map<uint32_t, std::string> ref;
+		uint32_t err = 0;
+		for(uint32_t i = 0; i < 50000; ++i) {
+			uint32_t id = xorshift_() % 40;
+			if((xorshift_() % 20) == 0) {
+				if(ref.count(id) != 0) {
+					if(!fm.remove(id)) ++err;
+					ref.erase(id);
+				}
+				continue;
+			}
+			auto s = value_(id, i);
+			if(!fm.write(id, s.data(), s.size())) ++err;
+			ref[id] = s;
+		}
+		CHECK(err == 0);
+		for(uint32_t id = 0; id < 40; ++id) {
+			if(!equal_(fm, id, ref)) ++err;
+		}
+		CHECK(err == 0);
+		CHECK(fm.get_counter().gc_ > 0);
+		CHECK(fio.get_reprog() == 0);
+
+		FM fm2(fio);
+		fm2.start();
+		for(uint32_t id = 0; id < 40; ++id) {
+			if(!equal_(fm2, id, ref)) ++err;
+		}
+		CHECK(err == 0);
+	}
+
+	{  // 電源断
+		// ガベージ・コレクションが始まるまで進めた状態を、基点にする
+		work_t base;
+		{
+			FM fm(base_);
+			fm.start();
+			uint32_t id;
+			bool del;
+			std::string val;
+			while(fm.get_counter().gc_ < 3) base.step(fm, id, del, val);
+		}
+
+		uint32_t fails = 0;
+		uint32_t runs = 0;
+		uint32_t kind[5] = { 0 };
+		uint32_t gc = 0;
+		for(uint32_t cut = 1; cut < 6000; ++cut) {
+			fio_ = base_;
+			work_t w = base;
+			uint32_t id = 0;
+			bool del = false;
+			std::string val;
+			bool in_gc = false;
+			{
+				FM fm(fio_);
+				fm.start();
+				fio_.set_cut(cut);
+				for(uint32_t i = 0; i < 1000; ++i) {
+					auto c = fm.get_counter();
+					if(!w.step(fm, id, del, val)) {
+						in_gc = fm.get_counter().move_ != c.move_
+							|| fm.get_counter().erase_ != c.erase_
+							|| fio_.get_cut_type() == FIO::cut_type::ERASE;
+						break;
+					}
+				}
+			}
+			if(!fio_.is_dead()) continue;
+			++runs;
+			auto type = static_cast<uint32_t>(fio_.get_cut_type());
+			++kind[type];
+			if(in_gc) ++gc;
+			fio_.set_cut(0);
+
+			FM fm(fio_);
+			fm.start();
+			bool ok = true;
+			for(uint32_t i = 0; i < KEY_NUM; ++i) {
+				if(i != id) {
+					if(!equal_(fm, i, w.ref)) ok = false;
+					continue;
+				}
+				// 途中だった ID は、古い値か新しい値
+				auto nref = w.ref;
+				if(del) nref.erase(i);
+				else nref[i] = val;
+				if(!equal_(fm, i, w.ref) && !equal_(fm, i, nref)) ok = false;
+			}
+			// 続けて書ける事
+			for(uint32_t i = 0; i < 200 && ok; ++i) {
+				bool d;
+				std::string v;
+				if(!w.step(fm, id, d, v)) ok = false;
+			}
+			for(uint32_t i = 0; i < KEY_NUM && ok; ++i) {
+				if(!equal_(fm, i, w.ref)) ok = false;
+			}
+			if(fio_.get_reprog() != 0) ok = false;
+			if(!ok) {
+				if(fails < 5) printf("flash_man_test: power cut at %u (%u%s) failed\n", cut, type,
+					in_gc ? ", gc" : "");
+				++fails;
+			}
+		}
+		CHECK(runs > 5000);
+		CHECK(fails == 0);
+		CHECK(kind[static_cast<uint32_t>(FIO::cut_type::BODY)] > 0);
+		CHECK(kind[static_cast<uint32_t>(FIO::cut_type::COMMIT)] > 0);
+		CHECK(kind[static_cast<uint32_t>(FIO::cut_type::HEAD)] > 0);
+		CHECK(kind[static_cast<uint32_t>(FIO::cut_type::ERASE)] > 0);
+		CHECK(gc > 0);
+	}
+
+	{  // 64K バイトを超えるセグメント（有効なバイト数、最大レコード長）
+		typedef ram_fio<3 * 81920, 1024> BFIO;
+		typedef utils::flash_man<BFIO, 64, 81920> BFM;
+		static BFIO fio;
+		BFM fm(fio);
+		fm.start();
+		CHECK(BFM::DATA_MAX < 0x8000);
+		std::map<uint32_t, std::string> ref;
+		uint32_t err = 0;
+		for(uint32_t i = 0; i < 2000; ++i) {
+			uint32_t id = xorshift_() % 20;
+			auto s = value_(id, i, 40);
+			if(!fm.write(id, s.data(), s.size())) ++err;
+			ref[id] = s;
+		}
+		std::string big(BFM::DATA_MAX, 'x');
+		if(!fm.write(100, big.data(), big.size())) ++err;
+		ref[100] = big;
+		CHECK(!fm.write(101, big.data(), big.size() + 1));
+		CHECK(err == 0);
+		CHECK(fm.get_counter().gc_ > 0);
+
+		BFM fm2(fio);
+		fm2.start();
+		for(const auto& kv : ref) {
+			if(!equal_(fm2, kv.first, ref)) ++err;
+		}
+		CHECK(err == 0);
+		CHECK(fio.get_reprog() == 0);
+	}
+
+	return sim_test::result::report("flash_man_test");
+}
@@ -0,0 +1,337 @@
+//=====================================================================//
+/*!	@file
+	@brief	utils::format のホスト・テスト（snprintf との比較） @n
+			・整数（%d、%u、%x、%X、%o、フラグ、幅）@n
+			・浮動小数点（%f、%e、%g、精度、幅、フラグ）を、ランダムな @n
+			  float と境界値で、snprintf（double に変換）と比較 @n
+			・%g（精度無し）は、最短で元の値に戻る桁である事 @n
+			・%y（固定小数点）は、整数演算の参照実装（四捨五入）と比較 @n
+			・文字列、文字、リテラル、余分な引数 @n
+			・１回当たりの時間、サイクル数を snprintf と比較（表示）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include "common/format.hpp"
+#include "bench.hpp"
+#include "check.hpp"
+
+namespace {
+
+	uint32_t	rand_ = 123456789;
+
+	uint32_t xorshift_() noexcept
+	{
+		rand_ ^= rand_ << 13;
+		rand_ ^= rand_ >> 17;
+		rand_ ^= rand_ << 5;
+		return rand_;
+	}
+
+
+	float to_float_(uint32_t bits) noexcept
+	{
+		float v;
+		std::memcpy(&v, &bits, sizeof(v));
+		return v;
+	}
+
+
+	uint32_t	diff_num_ = 0;
+
+	// 違いがあれば、最初の数個を表示
+	bool diff_(const char* form, const char* a, const char* b) noexcept
+	{
+		if(strcmp(a, b) == 0) return false;
+		if(diff_num_ < 10) {
+			printf("format_test: '%s': '%s' != '%s'\n", form, a, b);
+		}
+		++diff_num_;
+		return true;
+	}
+
+
+	template <typename T, typename U>
+	bool compare_(const char* form, T val, U ref) noexcept
+	{
+		char a[128];
+		char b[128];
+		utils::sformat(form, a, sizeof(a)) % val;
+		snprintf(b, sizeof(b), form, ref);
+		return diff_(form, a, b);
+	}
+
+
+	// %W.P:Ny の参照実装（絶対値を四捨五入、符号は残す）
+	void ref_fixed_(char* out, uint32_t size, int16_t width, uint8_t prec, uint8_t bits,
+		int32_t val) noexcept
+	{
+		bool nega = val < 0;
+		uint64_t m = nega ? -static_cast<int64_t>(val) : val;
+		uint64_t p10 = 1;
+		for(uint8_t i = 0; i < prec; ++i) p10 *= 10;
+		uint64_t s = m * p10;
+		uint64_t q = s >> bits;
+		uint64_t r = s & ((static_cast<uint64_t>(1) << bits) - 1);
+		if((r << 1) >= (static_cast<uint64_t>(1) << bits)) ++q;
+		char tmp[320];
+		if(prec > 0) {
+			snprintf(tmp, sizeof(tmp), "%s%llu.%0*llu", nega ? "-" : "",
+				static_cast<unsigned long long>(q / p10), prec,
+				static_cast<unsigned long long>(q % p10));
+		} else {
+			snprintf(tmp, sizeof(tmp), "%s%llu", nega ? "-" : "",
+				static_cast<unsigned long long>(q));
+		}
+		uint32_t len = strlen(tmp);
+		uint32_t pad = static_cast<uint32_t>(width) > len ? width - len : 0;
+		if((pad + len) >= size) {
+			out[0] = 0;
+			return;
+		}
+		memset(out, ' ', pad);
+		memcpy(out + pad, tmp, len + 1);
+	}
+
+
+	volatile char	sink_;
+
+	// 同じ値の列で、sformat と snprintf を計って表示
+	template <typename T, typename U>
+	void bench_(const char* form, const T* val, const U* ref, uint32_t num) noexcept
+	{
+		char a[128];
+		auto fmt = sim_test::bench(200000, [&](uint32_t i) {
+			utils::sformat(form, a, sizeof(a)) % val[i % num];
+			sink_ = a[0];
+		});
+		auto lib = sim_test::bench(200000, [&](uint32_t i) {
+			snprintf(a, sizeof(a), form, ref[i % num]);
+			sink_ = a[0];
+		});
+		printf("format_test: %-8s sformat %6.1f ns %6.0f cycles/call, snprintf %6.1f ns %6.0f cycles/call\n",
+			form, fmt.ns_, fmt.cycle_, lib.ns_, lib.cycle_);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	{  // 整数
+		static const char* sfs[] = {
+			"%d", "%5d", "%-5d|", "%05d", "%+d", "%+6d", "%-+6d|", "%12d", "[%d]"
+		};
+		static const char* ufs[] = {
+			"%u", "%x", "%X", "%08x", "%08X", "%o", "%-10x|", "%3u", "%010u"
+		};
+		static const int32_t edge[] = {
+			0, 1, -1, 9, -9, 10, 99, 100, -100, 12345, -2147483647 - 1, 2147483647
+		};
+		uint32_t err = 0;
+		for(auto f : sfs) {
+			for(auto v : edge) if(compare_(f, v, v)) ++err;
+			for(uint32_t i = 0; i < 20000; ++i) {
+				int32_t v = xorshift_();
+				v >>= xorshift_() & 31;  // 桁数を散らす
+				if(compare_(f, v, v)) ++err;
+			}
+			int16_t s = xorshift_();
+			if(compare_(f, s, static_cast<int32_t>(s))) ++err;
+			int8_t c = xorshift_();
+			if(compare_(f, c, static_cast<int32_t>(c))) ++err;
+		}
+		for(auto f : ufs) {
+			for(auto v : edge) if(compare_(f, static_cast<uint32_t>(v), static_cast<uint32_t>(v))) ++err;
+			for(uint32_t i = 0; i < 20000; ++i) {
+				uint32_t v = xorshift_() >> (xorshift_() & 31);
+				if(compare_(f, v, v)) ++err;
+			}
+			uint16_t s = xorshift_();
+			if(compare_(f, s, static_cast<uint32_t>(s))) ++err;
+		}
+		CHECK(err == 0);
+	}
+
+	{  // 浮動小数点（精度、幅、フラグ）
+		static const char* ffs[] = {
+			"%f", "%.0f", "%.1f", "%3.2f", "%5.2f", "%4.3f", "%7.2f", "%-8.2f|", "%+f", "%08.3f",
+			"%10.4f", "%e", "%E", "%.0e", "%.3e", "%10.3e", "%-12.2e|", "%+.4e",
+			"%.3g", "%10.3g", "%.6G"
+		};
+		static const float edge[] = {
+			0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 1.5f, 2.5f, -2.5f, 0.05f, 0.125f, 9.995f, 99.5f,
+			3.14159265f, 123.456f, 65536.0f, 1e-7f, 1e10f, 1.8446744e19f, 3.4028235e38f,
+			1.17549435e-38f, 1.4e-45f
+		};
+		uint32_t err = 0;
+		for(auto f : ffs) {
+			for(auto v : edge) if(compare_(f, v, static_cast<double>(v))) ++err;
+			for(uint32_t i = 0; i < 20000; ++i) {
+				uint32_t bits = xorshift_();
+				if(strchr(f, 'f') != nullptr) {
+					// %f は、指数を 2^-30 から 2^40 程度に絞る（桁数の上限）
+					bits = (bits & 0x807fffff) | (((xorshift_() % 70) + 97) << 23);
+				}
+				float v = to_float_(bits);
+				if(!std::isfinite(v)) continue;
+				if(compare_(f, v, static_cast<double>(v))) ++err;
+			}
+		}
+		CHECK(err == 0);
+	}
+
+	{  // %f は、大きな値でも全ての桁が正しい
+		uint32_t err = 0;
+		for(uint32_t i = 0; i < 2000; ++i) {
+			float v = to_float_((xorshift_() & 0x807fffff) | (((xorshift_() % 40) + 190) << 23));
+			if(compare_("%.2f", v, static_cast<double>(v))) ++err;
+		}
+		CHECK(err == 0);
+	}
+
+	{  // %g（精度無し）は、最短で元に戻る桁
+		uint32_t err = 0;
+		for(uint32_t i = 0; i < 50000; ++i) {
+			float v = to_float_(xorshift_() & 0x7fffffff);
+			if(!std::isfinite(v) || v == 0.0f) continue;
+			char a[64];
+			utils::sformat("%g", a, sizeof(a)) % v;
+			if(strtof(a, nullptr) != v) {
+				diff_("%g", a, "(round trip)");
+				++err;
+				continue;
+			}
+			// 有効桁数が、元に戻る最短の桁数を超えない事
+			char t[64];
+			for(uint32_t n = 1; n < 10; ++n) {
+				snprintf(t, sizeof(t), "%.*e", n - 1, static_cast<double>(v));
+				if(strtof(t, nullptr) == v) {
+					// 最短の桁数（先頭、末尾の 0 は数えない）
+					const char* s = a;
+					while(*s == '0' || *s == '.') ++s;
+					uint32_t sig = 0;
+					uint32_t zero = 0;
+					for(; *s != 0 && *s != 'e' && *s != 'E'; ++s) {
+						if(*s == '.') continue;
+						if(*s == '0') {
+							++zero;
+						} else {
+							sig += zero + 1;
+							zero = 0;
+						}
+					}
+					if(sig > n) {
+						diff_("%g", a, t);
+						++err;
+					}
+					break;
+				}
+			}
+		}
+		CHECK(err == 0);
+	}
+
+	{  // %y（固定小数点）
+		struct fix_t {
+			const char*	form;
+			int16_t		width;
+			uint8_t		prec;
+			uint8_t		bits;
+		};
+		static const fix_t fys[] = {
+			{ "%2.2:8y", 2, 2, 8 }, { "%2.4:8y", 2, 4, 8 }, { "%7.3:16y", 7, 3, 16 },
+			{ "%5.1:4y", 5, 1, 4 }, { "%1.5:12y", 1, 5, 12 }
+		};
+		uint32_t err = 0;
+		for(const auto& f : fys) {
+			for(uint32_t i = 0; i < 20000; ++i) {
+				int32_t v = static_cast<int32_t>(xorshift_()) >> (xorshift_() & 15);
+				char a[64];
+				char b[64];
+				utils::sformat(f.form, a, sizeof(a)) % v;
+				ref_fixed_(b, sizeof(b), f.width, f.prec, f.bits, v);
+				if(diff_(f.form, a, b)) ++err;
+			}
+		}
+		CHECK(err == 0);
+	}
+
+	{  // 文字列、文字、リテラル、複数の引数
+		uint32_t err = 0;
+		if(compare_("%s", "abc", "abc")) ++err;
+		if(compare_("%6s|", "abc", "abc")) ++err;
+		if(compare_("%-6s|", "abc", "abc")) ++err;
+		if(compare_("%c", 'x', 'x')) ++err;
+		if(compare_("100%% %d", 5, 5)) ++err;
+		if(compare_("literal only", 0, 0)) ++err;
+		char a[128];
+		char b[128];
+		utils::sformat("[%s] %5d|%-4x|%7.3f|%+.2e", a, sizeof(a))
+			% "adc" % -42 % 255u % 3.14159f % -0.001234f;
+		snprintf(b, sizeof(b), "[%s] %5d|%-4x|%7.3f|%+.2e", "adc", -42, 255u,
+			static_cast<double>(3.14159f), static_cast<double>(-0.001234f));
+		if(diff_("multi", a, b)) ++err;
+		CHECK(err == 0);
+	}
+
+	{  // 引数が余っても、フォーマット式の終端の先を読まない
+		char a[64];
+		auto f = utils::sformat("ab %d cd", a, sizeof(a)) % 1 % 2 % 3;
+		CHECK(strcmp(a, "ab 1 cd") == 0);
+		CHECK(f.get_error() == utils::sformat::error::different);
+	}
+
+	{  // バッファ長で切り詰められる（snprintf と同じ）
+		char a[8];
+		utils::sformat("%d-%s", a, sizeof(a)) % 123456 % "abcdef";
+		CHECK(strcmp(a, "123456-") == 0);
+	}
+
+	{  // ベンチマーク（結果は表示のみ）
+		static const uint32_t NUM = 1024;
+		static int32_t	ival[NUM];
+		static uint32_t	uval[NUM];
+		static float	fval[NUM];
+		static double	dval[NUM];
+		for(uint32_t i = 0; i < NUM; ++i) {
+			ival[i] = static_cast<int32_t>(xorshift_()) >> (xorshift_() & 31);
+			uval[i] = xorshift_();
+			fval[i] = static_cast<float>(ival[i]) / 1000.0f;
+			dval[i] = fval[i];
+		}
+		bench_("%d", ival, ival, NUM);
+		bench_("%08x", uval, uval, NUM);
+		bench_("%7.3f", fval, dval, NUM);
+		bench_("%e", fval, dval, NUM);
+		bench_("%g", fval, dval, NUM);
+
+		char a[128];
+		auto fix = sim_test::bench(200000, [&](uint32_t i) {
+			utils::sformat("%7.3:16y", a, sizeof(a)) % ival[i % NUM];
+			sink_ = a[0];
+		});
+		printf("format_test: %-8s sformat %6.1f ns %6.0f cycles/call\n", "%7.3:16y", fix.ns_, fix.cycle_);
+
+		// ロガーの１行
+		auto fmt = sim_test::bench(100000, [&](uint32_t i) {
+			auto n = i % NUM;
+			utils::sformat("[%s] %5d|%-4x|%7.3f|%+.2e", a, sizeof(a))
+				% "adc" % ival[n] % uval[n] % fval[n] % fval[n];
+			sink_ = a[0];
+		});
+		auto lib = sim_test::bench(100000, [&](uint32_t i) {
+			auto n = i % NUM;
+			snprintf(a, sizeof(a), "[%s] %5d|%-4x|%7.3f|%+.2e", "adc", ival[n], uval[n], dval[n], dval[n]);
+			sink_ = a[0];
+		});
+		printf("format_test: log line sformat %6.1f ns %6.0f cycles/call, snprintf %6.1f ns %6.0f cycles/call\n",
+			fmt.ns_, fmt.cycle_, lib.ns_, lib.cycle_);
+	}
+
+	return sim_test::result::report("format_test");
+}
@@ -0,0 +1,152 @@
+//=====================================================================//
+/*!	@file
+	@brief	iica_io のホスト・テスト（IO_SIM の RIIC モデル使用） @n
+			・トランザクション（レジスター読み書き、NACK）@n
+			・割り込みの recv の後ろに、トランザクションを登録しても、 @n
+			  recv がストップを出してから、次のスタートを出す事 @n
+			・割り込みの send（非同期）でも同じ事、NACK でも止まらない事
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstring>
+#include "common/renesas.hpp"
+#include "common/iica_io.hpp"
+#include "check.hpp"
+
+namespace {
+
+	typedef device::iica_io<device::RIIC0> I2C;
+	I2C		i2c_;
+
+	typedef device::sim::riic_model<device::RIIC0, device::ICU> MODEL;
+
+	static const uint32_t SLICE = F_PCLKB / 10000;  // 100us
+
+	// 終わるまで進める（最大 100ms）
+	bool wait_(device::i2c_trans& t) noexcept
+	{
+		for(uint32_t i = 0; i < 1000 && t.probe(); ++i) {
+			device::sim::space::step(SLICE);
+		}
+		return t.state_ == device::i2c_trans::state::done;
+	}
+
+	bool wait_recv_() noexcept
+	{
+		for(uint32_t i = 0; i < 1000 && !I2C::get_recv_state(); ++i) {
+			device::sim::space::step(SLICE);
+		}
+		return I2C::get_recv_state();
+	}
+
+	bool wait_send_() noexcept
+	{
+		for(uint32_t i = 0; i < 1000 && !I2C::get_send_state(); ++i) {
+			device::sim::space::step(SLICE);
+		}
+		return I2C::get_send_state();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+
+	MODEL model;
+	sim::space::attach(model);
+	auto reg = model.add_slave(0x68);
+	for(uint32_t i = 0; i < 256; ++i) reg[i] = i * 7 + 3;
+
+	CHECK(i2c_.start(I2C::speed::fast, 2));
+
+	{  // トランザクション
+		static const uint8_t src[3] = { 0x11, 0x22, 0x33 };
+		i2c_trans wr;
+		wr.set_write(0x68, 0x40, src, 3);
+		CHECK(i2c_.trans(wr));
+		CHECK(wait_(wr));
+		CHECK(memcmp(&reg[0x40], src, 3) == 0);
+
+		for(uint16_t len = 1; len <= 5; ++len) {
+			uint8_t dst[8] = { 0 };
+			i2c_trans rd;
+			rd.set_read(0x68, 0x3E, dst, len);
+			CHECK(i2c_.trans(rd));
+			CHECK(wait_(rd));
+			CHECK(memcmp(dst, &reg[0x3E], len) == 0);
+		}
+
+		uint8_t dst[2];
+		i2c_trans miss;
+		miss.set_read(0x50, 0x00, dst, 2);
+		CHECK(i2c_.trans(miss));
+		wait_(miss);
+		CHECK(miss.state_ == i2c_trans::state::error);
+		CHECK(!model.probe_busy());
+	}
+
+	{  // 割り込みの recv の後ろに、トランザクションを登録
+		for(uint16_t len = 1; len <= 4; ++len) {
+			uint8_t ptr = 0x10;
+			i2c_trans set;
+			set.set_send(0x68, &ptr, 1);
+			CHECK(i2c_.trans(set));
+			CHECK(wait_(set));
+
+			uint8_t dst[8] = { 0 };
+			uint8_t tdst[4] = { 0 };
+			i2c_trans rd;
+			rd.set_read(0x68, 0x80, tdst, 4);
+			auto starts = model.get_starts();
+			CHECK(i2c_.recv(0x68, dst, len));
+			CHECK(i2c_.trans(rd));
+			CHECK(!I2C::probe_trans());  // recv が終わるまで始めない
+			CHECK(wait_recv_());
+			CHECK(memcmp(dst, &reg[0x10], len) == 0);
+			CHECK(wait_(rd));
+			CHECK(memcmp(tdst, &reg[0x80], 4) == 0);
+			// recv、書き込み（レジスター）、リスタート
+			CHECK((model.get_starts() - starts) == 3);
+			CHECK(!model.probe_busy());
+		}
+
+		// NACK でも、ストップを出して、次に進む
+		uint8_t dst[2];
+		uint8_t tdst[2] = { 0 };
+		i2c_trans rd;
+		rd.set_read(0x68, 0x20, tdst, 2);
+		CHECK(i2c_.recv(0x51, dst, 2));
+		CHECK(i2c_.trans(rd));
+		CHECK(wait_recv_());
+		CHECK(wait_(rd));
+		CHECK(memcmp(tdst, &reg[0x20], 2) == 0);
+	}
+
+	{  // 割り込みの send（非同期）の後ろに、トランザクションを登録
+		static const uint8_t src[3] = { 0x60, 0xAA, 0x55 };
+		uint8_t tdst[2] = { 0 };
+		i2c_trans rd;
+		rd.set_read(0x68, 0x60, tdst, 2);
+		CHECK(i2c_.send(0x68, src, 3, false));
+		CHECK(i2c_.trans(rd));
+		CHECK(!I2C::probe_trans());
+		CHECK(wait_send_());
+		CHECK(wait_(rd));
+		CHECK(tdst[0] == 0xAA && tdst[1] == 0x55);
+
+		i2c_trans rd2;
+		rd2.set_read(0x68, 0x60, tdst, 1);
+		CHECK(i2c_.send(0x52, src, 3, false));
+		CHECK(i2c_.trans(rd2));
+		CHECK(wait_send_());
+		CHECK(wait_(rd2));
+		CHECK(!model.probe_busy());
+	}
+
+	return sim_test::result::report("i2c_test");
+}
@@ -0,0 +1,88 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ホスト・テスト用、ループバック・イーサーネット・ドライバー @n
+			net::ethernet のドライバーとして使い、２つのスタックを繋ぐ。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace sim_test {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	ループバック・イーサーネット・ドライバー @n
+				send したフレームは、相手（peer）の受信キューに入る。
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class loop_ethd {
+	public:
+		static const uint32_t TXD_NUM = 4;
+		static const uint32_t RXD_NUM = 4;
+
+		typedef std::vector<uint8_t> FRAME;
+
+	private:
+		loop_ethd*			peer_;
+		std::deque<FRAME>	recv_;
+		uint8_t				send_[1536];
+
+	public:
+		uint32_t	drop_;		///< 送信フレームを捨てる間隔（０なら捨てない）
+		uint32_t	lose_;		///< 次に送る、このフレーム数を捨てる
+		uint32_t	send_num_;
+		std::vector<FRAME>	log_;	///< 送信したフレーム（TCP のみ）
+
+		loop_ethd() : peer_(nullptr), recv_(), send_{ 0 }, drop_(0), lose_(0), send_num_(0),
+			log_() { }
+
+		void connect(loop_ethd& peer) { peer_ = &peer; }
+
+		void enable_interrupt(bool flag = true) { }
+
+		int32_t send_buff(void** buf, uint16_t& len)
+		{
+			*buf = send_;
+			len = sizeof(send_);
+			return 0;
+		}
+
+		int32_t send(uint32_t len)
+		{
+			if(len > sizeof(send_)) return -1;
+			FRAME f(send_, send_ + len);
+			++send_num_;
+			if(f.size() > (14 + 9) && f[12] == 0x08 && f[13] == 0x00 && f[14 + 9] == 6) {
+				log_.push_back(f);
+			}
+			if(drop_ > 0 && (send_num_ % drop_) == 0) return 0;
+			if(lose_ > 0) {
+				--lose_;
+				return 0;
+			}
+			peer_->recv_.push_back(f);
+			return 0;
+		}
+
+		int32_t recv_buff(void** buf)
+		{
+			if(recv_.empty()) return 0;
+			*buf = recv_.front().data();
+			return recv_.front().size();
+		}
+
+		int32_t recv_buff_release()
+		{
+			if(!recv_.empty()) recv_.pop_front();
+			return 0;
+		}
+
+		bool empty() const { return recv_.empty(); }
+	};
+}
@@ -0,0 +1,153 @@
+//=====================================================================//
+/*!	@file
+	@brief	mmc_io（SD カード SPI モード）のホスト・テスト @n
+			IO_SIM の RSPI、DMAC モデルに、SD カード・モデルを繋ぐ。@n
+			・初期化（CMD0、CMD8、ACMD41、CMD58）で、SDv2 ブロック・ @n
+			  アドレスと判定される事 @n
+			・単一、複数セクターの読み書き（データ・ブロックは DMAC）@n
+			・先読み（シーケンシャル・アクセスの時だけ、CMD18 でまとめて読む）@n
+			・終端を越える読み出しは、エラーになる事 @n
+			・SPI が止まった時、rspi_dma_io の終了待ちが打ち切られる事
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstring>
+#include "common/renesas.hpp"
+#include "common/rspi_dma_io.hpp"
+#include "ff13c/mmc_io.hpp"
+#include "check.hpp"
+
+namespace {
+
+	static const uint32_t SECTORS = 2048;
+	static const uint32_t RAN = 8;
+
+	typedef device::rspi_dma_io<device::RSPI0, device::DMAC3, device::DMAC4> SPI;
+	SPI		spi_;
+
+	typedef device::PORT<device::PORT1, device::bitpos::B7> SDC_SELECT;
+	typedef device::PORT<device::PORT2, device::bitpos::B5> SDC_DETECT;
+	typedef fatfs::mmc_io<SPI, SDC_SELECT, device::NULL_PORT, SDC_DETECT,
+		device::NULL_PORT, RAN> MMC;
+	MMC		mmc_(spi_, 20000000);
+
+	uint8_t	buff_[512 * 4];
+
+	uint8_t pattern_(uint32_t sector, uint32_t i) noexcept
+	{
+		return (sector * 31) ^ (i * 7) ^ (i >> 8);
+	}
+
+	bool check_(const uint8_t* buff, uint32_t sector, uint32_t count) noexcept
+	{
+		for(uint32_t s = 0; s < count; ++s) {
+			for(uint32_t i = 0; i < 512; ++i) {
+				if(buff[s * 512 + i] != pattern_(sector + s, i)) return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+
+	sim::dmac_model<DMAC3, ICU> dm3;
+	sim::dmac_model<DMAC4, ICU> dm4;
+	sim::rspi_model<RSPI0> sm;
+	sim::space::attach(dm3);
+	sim::space::attach(dm4);
+	sim::space::attach(sm);
+
+	sim::sdc_spi_model sdc(SECTORS);
+	sm.set_response([&](uint32_t tx) { return sdc(tx); });
+	auto& img = sdc.at_image();
+	for(uint32_t s = 0; s < SECTORS; ++s) {
+		for(uint32_t i = 0; i < 512; ++i) img[s * 512 + i] = pattern_(s, i);
+	}
+
+	{  // 初期化
+		mmc_.start();
+		CHECK(mmc_.disk_initialize(0) == 0);
+		CHECK(mmc_.card_type() == 0x0C);  // CT_SD2 | CT_BLOCK
+		CHECK(sdc.get_command_count(41) == 2);
+		DWORD n = 0;
+		CHECK(mmc_.disk_ioctl(0, GET_SECTOR_COUNT, &n) == RES_OK);
+		CHECK(n == SECTORS);
+	}
+
+	{  // 読み出し
+		auto dn = dm4.get_count();
+		CHECK(mmc_.disk_read(0, buff_, 5, 1) == RES_OK);
+		CHECK(check_(buff_, 5, 1));
+		CHECK(sdc.get_command_count(17) == 1);
+		CHECK((dm4.get_count() - dn) >= 512);  // データ・ブロックは DMAC
+
+		// ランダム・アクセスでは、先読みしない
+		CHECK(mmc_.disk_read(0, buff_, 10, 4) == RES_OK);
+		CHECK(check_(buff_, 10, 4));
+		CHECK(sdc.get_command_count(18) == 1);
+		CHECK(sdc.get_command_count(12) == 1);
+		CHECK(sdc.get_read_count() == 5);
+
+		// シーケンシャル・アクセスなら、RAN セクターをまとめて読む
+		CHECK(mmc_.disk_read(0, buff_, 14, 1) == RES_OK);
+		CHECK(check_(buff_, 14, 1));
+		CHECK(sdc.get_read_count() == (5 + RAN));
+		bool ok = true;
+		for(uint32_t s = 15; s < (14 + RAN); ++s) {
+			if(mmc_.disk_read(0, buff_, s, 1) != RES_OK || !check_(buff_, s, 1)) ok = false;
+		}
+		CHECK(ok);
+		CHECK(sdc.get_read_count() == (5 + RAN));
+	}
+
+	{  // 書き込み
+		for(uint32_t i = 0; i < sizeof(buff_); ++i) buff_[i] = i * 3 + 1;
+		CHECK(mmc_.disk_write(0, buff_, 100, 1) == RES_OK);
+		CHECK(memcmp(&img[100 * 512], buff_, 512) == 0);
+		CHECK(mmc_.disk_write(0, buff_, 200, 3) == RES_OK);
+		CHECK(memcmp(&img[200 * 512], buff_, 512 * 3) == 0);
+		CHECK(sdc.get_write_count() == 4);
+		CHECK(sdc.get_command_count(23) == 1);
+
+		// 先読みと重なる書き込みの後は、カードから読み直す
+		auto rn = sdc.get_read_count();
+		CHECK(mmc_.disk_write(0, buff_, 16, 1) == RES_OK);
+		uint8_t tmp[512];
+		CHECK(mmc_.disk_read(0, tmp, 16, 1) == RES_OK);
+		CHECK(memcmp(tmp, buff_, 512) == 0);
+		CHECK(sdc.get_read_count() > rn);
+	}
+
+	{  // 終端を越える読み出し
+		CHECK(mmc_.disk_read(0, buff_, SECTORS - 1, 2) == RES_ERROR);
+		CHECK(mmc_.disk_read(0, buff_, SECTORS, 1) == RES_ERROR);
+		CHECK(mmc_.disk_read(0, buff_, SECTORS - 1, 1) == RES_OK);
+		CHECK(check_(buff_, SECTORS - 1, 1));
+	}
+
+	{  // SPI が止まったら、終了待ちを打ち切る
+		sim::space::detach(sm);
+		CHECK(!spi_.recv(buff_, 512));
+		CHECK(spi_.get_timeout_count() == 1);
+		CHECK(DMAC4::DMCNT.DTE() == 0);
+		CHECK(DMAC3::DMCNT.DTE() == 0);
+		CHECK(RSPI0::SPCR.SPTIE() == 0);
+		CHECK(RSPI0::SPCR.SPE() == 1);
+
+		// 戻れば、続けて使える
+		sim::space::attach(sm);
+		CHECK(mmc_.disk_read(0, buff_, 300, 2) == RES_OK);
+		CHECK(check_(buff_, 300, 2));
+		CHECK(spi_.get_timeout_count() == 1);
+	}
+
+	return sim_test::result::report("mmc_test");
+}
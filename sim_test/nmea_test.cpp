@@ -0,0 +1,304 @@
+//=====================================================================//
+/*!	@file
+	@brief	nmea_dec のホスト・テスト（記録した NMEA ログのデコード） @n
+			・複数システム（GN、GP、GL）のログを、シリアルから分割して受信 @n
+			・チェックサム・エラー、途中で途切れたセンテンス、独自センテンス @n
+			・緯度、経度（1e-7 度）、高度、DOP、速度、方向、衛星情報、時間 @n
+			・「service」と「input」で、同じ結果になる事 @n
+			・使用衛星数（GSA）はシステム毎、GN はシステムＩＤで振り分ける @n
+			・センテンス／秒（ホスト上での目安）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include "common/nmea_dec.hpp"
+#include "check.hpp"
+
+namespace {
+
+	// 記録したログ（１秒毎の３エポック）
+	static const char* log_[] = {
+		// エポック１：GPS + GLONASS、３D 測位
+		"$GNGGA,023015.000,3540.8742,N,13946.0275,E,1,12,0.85,40.3,M,39.4,M,,*42\r\n"
+		"$GNGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.52,0.85,1.26*16\r\n"
+		"$GNGSA,A,3,70,71,80,,,,,,,,,,1.52,0.85,1.26*1B\r\n"
+		"$GPGSV,3,1,10,05,45,310,38,13,62,041,42,15,37,073,40,18,14,133,33*7F\r\n"
+		"$GPGSV,3,2,10,20,21,205,36,23,09,318,30,24,28,054,39,29,70,169,44*7E\r\n"
+		"$GPGSV,3,3,10,30,04,240,,31,02,300,*7A\r\n"
+		"$GLGSV,1,1,03,70,55,100,35,71,40,200,37,80,20,020,31*58\r\n"
+		"$GNRMC,023015.000,A,3540.8742,N,13946.0275,E,0.15,271.30,181020,,,A*7E\r\n"
+		"$GNVTG,271.30,T,,M,0.15,N,0.28,K,A*2A\r\n",
+		// エポック２：独自センテンス、チェックサム・エラー、途中で途切れたセンテンス、
+		// GPS の可視衛星が減る、NMEA 4.10 のシグナルＩＤ
+		"$PMTK010,002*2D\r\n"
+		"$GNGGA,023016.000,3540.8745,N,13946.0279,E,1,12,0.85,99.9,M,39.4,M,,*4C\r\n"
+		"$GNGSA,A,3,05,13,15\r\n"
+		"$GNGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.60,0.90,1.32*16\r\n"
+		"$GNGSA,A,3,70,71,80,,,,,,,,,,1.60,0.90,1.32*1B\r\n"
+		"$GPGSV,2,1,08,05,45,311,38,13,62,042,41,15,37,074,40,18,14,134,32*77\r\n"
+		"$GPGSV,2,2,08,20,21,206,35,23,09,319,29,24,28,055,38,29,70,170,44*77\r\n"
+		"$GLGSV,1,1,03,70,55,101,34,71,40,201,36,80,20,021,30,1*45\r\n"
+		"$GNRMC,023016.000,A,3540.8745,N,13946.0279,E,1.94,88.25,181020,,,A*4E\r\n"
+		"$GNVTG,88.25,T,,M,1.94,N,3.59,K,A*17\r\n",
+		// エポック３：南半球、西経、GPS のみ、チェックサムが小文字
+		"$GPGGA,235959.000,3351.6250,S,15112.5000,W,2,07,1.20,-12.5,M,20.1,M,,*7b\r\n"
+		"$GPRMC,235959.000,A,3351.6250,S,15112.5000,W,0.00,0.00,311220,,,D*60\r\n"
+		"$GPVTG,0.00,T,,M,0.00,N,0.00,K,D*38\r\n"
+	};
+
+	// システム毎の GSA（GN は NMEA 4.10 のシステムＩＤ付き）
+	static const char* gsa_ =
+		"$GPGSA,A,3,05,13,15,18,20,23,24,29,,,,,1.52,0.85,1.26*08\r\n"
+		"$GLGSA,A,3,70,71,80,,,,,,,,,,1.52,0.85,1.26*19\r\n"
+		"$GNGSA,A,3,02,07,11,30,,,,,,,,,1.40,0.80,1.15,3*0D\r\n"
+		"$GNGSA,A,3,194,195,,,,,,,,,,,1.40,0.80,1.15,5*0C\r\n";
+
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	シリアル・モデル（ログを少しずつ受信する）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class sci_model {
+		const char*	src_;
+		uint32_t	len_;
+		uint32_t	pos_;
+		uint32_t	avail_;
+
+	public:
+		sci_model() : src_(nullptr), len_(0), pos_(0), avail_(0) { }
+
+		void set(const char* src) { src_ = src; len_ = strlen(src); pos_ = 0; avail_ = 0; }
+
+		// 受信したバイト数を進める（１フレーム分）
+		void receive(uint32_t n)
+		{
+			avail_ += n;
+			if((pos_ + avail_) > len_) avail_ = len_ - pos_;
+		}
+
+		bool empty() const { return pos_ >= len_; }
+
+		void auto_crlf(bool f) { }
+		void start(uint32_t baud, uint16_t intr) { }
+		uint32_t recv_length() const { return avail_; }
+		uint16_t get_error_count() const { return 0; }
+		void flush_recv() { pos_ += avail_; avail_ = 0; }
+		char getch()
+		{
+			if(avail_ == 0) return 0;
+			--avail_;
+			return src_[pos_++];
+		}
+		void puts(const char* s) { }
+	};
+
+	typedef utils::nmea_dec<sci_model> NMEA;
+
+	sci_model	sci_;
+	NMEA		nmea_(sci_);
+
+	sci_model	dummy_;
+	NMEA		nmea_ch_(dummy_);
+	NMEA		nmea_gsa_(dummy_);
+	NMEA		nmea_bench_(dummy_);
+
+
+	uint32_t	rand_ = 521288629;
+
+	uint32_t xorshift_() noexcept
+	{
+		rand_ ^= rand_ << 13;
+		rand_ ^= rand_ >> 17;
+		rand_ ^= rand_ << 5;
+		return rand_;
+	}
+
+
+	uint16_t view_num_(const NMEA& n, NMEA::talker tk)
+	{
+		uint16_t num = 0;
+		for(uint16_t i = 0; i < n.get_satellite_info_num(); ++i) {
+			if(n.get_satellite_info(i).tk_ == tk) ++num;
+		}
+		return num;
+	}
+
+
+	// エポック毎に、service で受信した結果を検査 @n
+	// VTG を受信するまでは RMC で、以降は VTG でエポックが完了する
+	void check_epoch_(uint32_t epoch)
+	{
+		uint16_t pdop;
+		uint16_t hdop;
+		uint16_t vdop;
+		nmea_.get_dop(pdop, hdop, vdop);
+		const auto& cnt = nmea_.get_counter();
+		if(epoch == 1) {  // 最初の RMC（速度は RMC のノットから）
+			CHECK(nmea_.get_speed() == 27);            // 0.15 knot
+			CHECK(nmea_.get_course() == 27130);
+			CHECK(nmea_.get_gmtime() == 1602988215);
+			CHECK(cnt.sentence_ == 8);
+		} else if(epoch == 2) {
+			CHECK(nmea_.is_position());
+			CHECK(nmea_.get_lat_e7() == 356812367);    // 35 + 40.8742 / 60
+			CHECK(nmea_.get_lon_e7() == 1397671250);   // 139 + 46.0275 / 60
+			CHECK(nmea_.get_altitude_cm() == 4030);
+			CHECK(nmea_.get_satellite_num() == 12);
+			CHECK(pdop == 152 && hdop == 85 && vdop == 126);
+			CHECK(nmea_.get_fix_mode() == 3);
+			// システムＩＤ無しの GNGSA は、GN に数える（最後の GSA）
+			CHECK(nmea_.get_satellite_use(NMEA::talker::GN) == 3);
+			CHECK(nmea_.get_satellite_use(NMEA::talker::GP) == 0);
+			CHECK(nmea_.get_speed() == 28);            // VTG の km/h を優先
+			CHECK(nmea_.get_course() == 27130);
+			CHECK(nmea_.get_gmtime() == 1602988215);   // 2020/10/18 02:30:15 UTC
+			CHECK(strcmp(nmea_.get_time(), "023015.000") == 0);
+			CHECK(strcmp(nmea_.get_date(), "181020") == 0);
+			CHECK(strcmp(nmea_.get_lat(), "3540.8742") == 0);
+			CHECK(strcmp(nmea_.get_altitude(), "40.3") == 0);
+			CHECK(nmea_.get_satellite_view(NMEA::talker::GP) == 10);
+			CHECK(nmea_.get_satellite_view(NMEA::talker::GL) == 3);
+			CHECK(nmea_.get_satellite_info_num() == 13);
+			CHECK(view_num_(nmea_, NMEA::talker::GP) == 10);
+			{  // 追尾していない衛星（C/N 無し）
+				const auto& t = nmea_.get_satellite_info(9);
+				CHECK(t.no_ == 31 && t.elv_ == 2 && t.azi_ == 300 && t.cn_ == 0);
+			}
+			CHECK(cnt.sentence_ == 9 && cnt.sum_error_ == 0 && cnt.format_error_ == 0);
+		} else if(epoch == 3) {
+			// GGA はチェックサム・エラーで捨てられ、高度、文字列は前のまま
+			CHECK(nmea_.get_altitude_cm() == 4030);
+			CHECK(strcmp(nmea_.get_time(), "023015.000") == 0);
+			// 位置、時間は RMC から
+			CHECK(nmea_.get_lat_e7() == 356812417);
+			CHECK(nmea_.get_lon_e7() == 1397671317);
+			CHECK(nmea_.get_gmtime() == 1602988216);
+			CHECK(pdop == 160 && hdop == 90 && vdop == 132);
+			CHECK(nmea_.get_speed() == 359);
+			CHECK(nmea_.get_course() == 8825);
+			// GPS の衛星は入れ替わり、GLONASS は残る
+			CHECK(nmea_.get_satellite_view(NMEA::talker::GP) == 8);
+			CHECK(nmea_.get_satellite_info_num() == 11);
+			CHECK(view_num_(nmea_, NMEA::talker::GP) == 8);
+			CHECK(view_num_(nmea_, NMEA::talker::GL) == 3);
+			{
+				const auto& t = nmea_.get_satellite_info(0);
+				CHECK(t.no_ == 5 && t.elv_ == 45 && t.azi_ == 311 && t.cn_ == 38
+					&& t.tk_ == NMEA::talker::GP);
+				const auto& u = nmea_.get_satellite_info(10);
+				CHECK(u.no_ == 80 && u.elv_ == 20 && u.azi_ == 21 && u.cn_ == 30
+					&& u.tk_ == NMEA::talker::GL);
+			}
+			CHECK(cnt.sentence_ == 17);
+			CHECK(cnt.sum_error_ == 1);
+			CHECK(cnt.format_error_ == 1);
+			CHECK(cnt.ignore_ == 1);
+		} else if(epoch == 4) {
+			CHECK(nmea_.is_position());
+			CHECK(nmea_.get_lat_e7() == -338604167);   // 33 + 51.625 / 60 (S)
+			CHECK(nmea_.get_lon_e7() == -1512083333);  // 151 + 12.5 / 60 (W)
+			CHECK(nmea_.get_altitude_cm() == -1250);
+			CHECK(nmea_.get_satellite_num() == 7);
+			CHECK(strcmp(nmea_.get_quality(), "2") == 0);
+			CHECK(nmea_.get_speed() == 0);
+			CHECK(nmea_.get_gmtime() == 1609459199);   // 2020/12/31 23:59:59 UTC
+			// time.c の関数（ホストでも、システムの物では無い）
+			time_t t = nmea_.get_gmtime();
+			auto m = rx_time::gmtime(&t);
+			CHECK(m->tm_year == 120 && m->tm_mon == 11 && m->tm_mday == 31 && m->tm_hour == 23);
+			CHECK(rx_time::localtime(&t)->tm_year == 121);  // JST（+9）
+			CHECK(rx_time::mktime(m) == t);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	nmea_.start();
+
+	{  // シリアルから、ランダムな長さで受信（センテンスの途中で区切られる）
+		uint32_t epoch = 0;
+		for(auto l : log_) {
+			sci_.set(l);
+			uint32_t loop = 0;
+			while(!sci_.empty() && loop < 10000) {
+				sci_.receive(1 + (xorshift_() % 40));
+				if(nmea_.service()) {
+					++epoch;
+					check_epoch_(epoch);
+				}
+				++loop;
+			}
+		}
+		CHECK(epoch == 4);
+		CHECK(nmea_.get_id() == 4);
+	}
+
+	{  // １文字毎の入力でも、同じ結果
+		uint32_t epoch = 0;
+		for(auto l : log_) {
+			for(const char* p = l; *p != 0; ++p) {
+				if(nmea_ch_.input(*p)) ++epoch;
+			}
+		}
+		CHECK(epoch == 4);
+		CHECK(nmea_ch_.get_lat_e7() == nmea_.get_lat_e7());
+		CHECK(nmea_ch_.get_lon_e7() == nmea_.get_lon_e7());
+		CHECK(nmea_ch_.get_satellite_info_num() == nmea_.get_satellite_info_num());
+		const auto& a = nmea_ch_.get_counter();
+		const auto& b = nmea_.get_counter();
+		CHECK(a.sentence_ == b.sentence_ && a.sum_error_ == b.sum_error_
+			&& a.format_error_ == b.format_error_ && a.ignore_ == b.ignore_);
+	}
+
+	{  // 使用衛星数は、GSA のトーカー、システムＩＤ毎
+		for(const char* p = gsa_; *p != 0; ++p) nmea_gsa_.input(*p);
+		CHECK(nmea_gsa_.get_counter().sentence_ == 4);
+		CHECK(nmea_gsa_.get_satellite_use(NMEA::talker::GP) == 8);
+		CHECK(nmea_gsa_.get_satellite_use(NMEA::talker::GL) == 3);
+		CHECK(nmea_gsa_.get_satellite_use(NMEA::talker::GA) == 4);
+		CHECK(nmea_gsa_.get_satellite_use(NMEA::talker::GQ) == 2);
+		CHECK(nmea_gsa_.get_satellite_use(NMEA::talker::GN) == 0);
+		uint16_t pdop;
+		uint16_t hdop;
+		uint16_t vdop;
+		nmea_gsa_.get_dop(pdop, hdop, vdop);
+		CHECK(pdop == 140 && hdop == 80 && vdop == 115);
+	}
+
+	{  // センテンス／秒（ログを繰り返し入力、結果は表示のみ）
+		static const uint32_t loop = 20000;
+		uint32_t bytes = 0;
+		auto t0 = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < loop; ++i) {
+			for(auto l : log_) {
+				for(const char* p = l; *p != 0; ++p) nmea_bench_.input(*p);
+			}
+		}
+		auto us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+		for(auto l : log_) bytes += strlen(l);
+		bytes *= loop;
+		auto n = nmea_bench_.get_counter().sentence_;
+		// VTG 毎に１エポック（最初だけ、VTG の前の RMC でも）
+		CHECK(nmea_bench_.get_id() == (loop * 3 + 1));
+		printf("nmea_test: %u sentences, %.0f sentences/s, %.1f ns/byte (host)\n",
+			n, n * 1e6 / us, us * 1000.0 / bytes);
+	}
+
+	{  // 度分から度への変換（小数部は０で埋める）
+		char tmp[16];
+		CHECK(NMEA::conv_latlon("3540.8742", tmp, sizeof(tmp)));
+		CHECK(strcmp(tmp, "35.6812") == 0);
+		CHECK(NMEA::conv_latlon("00102.5000", tmp, sizeof(tmp)));
+		CHECK(strcmp(tmp, "1.0416") == 0);
+		CHECK(!NMEA::conv_latlon("", tmp, sizeof(tmp)));
+	}
+
+	return sim_test::result::report("nmea_test");
+}
@@ -0,0 +1,216 @@
+#pragma once
+//=====================================================================//
+/*!	@file
+	@brief	ホスト・テスト用、RAM ディスク（FatFs のディスク・デバイス）@n
+			mmc_io と同じメンバー関数（disk_initialize、disk_status、@n
+			disk_read、disk_write、disk_ioctl）を持つので、sector_cache の @n
+			DEV にも使える。@n
+			・「format」で、FAT16 の空のボリューム（MBR 無し）を作る。@n
+			  （ffconf.h は FF_USE_MKFS が０なので、f_mkfs を使わない）@n
+			・読み書きのコマンド数、セクター数を数える。@n
+			・読み込みの度に、関数（バッファ、セクター、数）を呼べる。@n
+			※ FatFs の disk_xxx は、テスト側で、このクラスに繋ぐ。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstring>
+#include <functional>
+#include <vector>
+#include "ff13c/source/ff.h"
+#include "ff13c/source/diskio.h"
+
+namespace sim_test {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	RAM ディスク・クラス
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	class ram_disk {
+	public:
+		static const uint32_t SS = 512;	///< セクター・サイズ
+
+		typedef std::function<void (const BYTE* buff, DWORD sector, UINT count)> READ_FUNC;
+
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		/*!
+			@brief	アクセス・カウンター
+		*/
+		//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+		struct counter_t {
+			uint32_t	read_cmd_;		///< disk_read の回数
+			uint32_t	read_sector_;	///< 読み込んだセクター数
+			uint32_t	write_cmd_;		///< disk_write の回数
+			uint32_t	write_sector_;	///< 書き込んだセクター数
+			uint32_t	sync_;			///< CTRL_SYNC の回数
+
+			counter_t() noexcept : read_cmd_(0), read_sector_(0), write_cmd_(0),
+				write_sector_(0), sync_(0) { }
+		};
+
+	private:
+		std::vector<BYTE>	image_;
+		counter_t			counter_;
+		READ_FUNC			read_func_;
+
+		static void put16_(BYTE* p, uint32_t v) noexcept
+		{
+			p[0] = v;
+			p[1] = v >> 8;
+		}
+
+		static void put32_(BYTE* p, uint32_t v) noexcept
+		{
+			put16_(p, v);
+			put16_(p + 2, v >> 16);
+		}
+
+	public:
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	コンストラクター
+			@param[in]	sectors	セクター数
+		*/
+		//-----------------------------------------------------------------//
+		ram_disk(uint32_t sectors) noexcept : image_(sectors * SS, 0), counter_(),
+			read_func_() { }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	FAT16 の空のボリュームを作る @n
+					（クラスターは１セクター、FAT は１つ、ルート・ディレクトリーは 512 エントリー）
+			@return クラスター数が FAT16 の範囲なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool format() noexcept
+		{
+			uint32_t tot = image_.size() / SS;
+			static const uint32_t RSV = 1;
+			static const uint32_t ROOT = 512;
+			static const uint32_t ROOT_SECS = ROOT * 32 / SS;
+			uint32_t fatsz = ((tot - RSV - ROOT_SECS + 2) * 2 + SS - 1) / SS;
+			uint32_t ncl = tot - RSV - ROOT_SECS - fatsz;
+			if(ncl < 4086 || ncl > 65525 || tot > 0xffff) return false;
+
+			std::memset(&image_[0], 0, (RSV + fatsz + ROOT_SECS) * SS);
+			BYTE* bs = &image_[0];
+			static const BYTE jmp[] = { 0xEB, 0x3C, 0x90 };
+			std::memcpy(bs, jmp, sizeof(jmp));
+			std::memcpy(bs + 3, "MSDOS5.0", 8);
+			put16_(bs + 11, SS);		// BPB_BytsPerSec
+			bs[13] = 1;					// BPB_SecPerClus
+			put16_(bs + 14, RSV);		// BPB_RsvdSecCnt
+			bs[16] = 1;					// BPB_NumFATs
+			put16_(bs + 17, ROOT);		// BPB_RootEntCnt
+			put16_(bs + 19, tot);		// BPB_TotSec16
+			bs[21] = 0xF8;				// BPB_Media
+			put16_(bs + 22, fatsz);		// BPB_FATSz16
+			put16_(bs + 24, 63);		// BPB_SecPerTrk
+			put16_(bs + 26, 255);		// BPB_NumHeads
+			bs[36] = 0x80;				// BS_DrvNum
+			bs[38] = 0x29;				// BS_BootSig
+			put32_(bs + 39, 0x12345678);	// BS_VolID
+			std::memcpy(bs + 43, "NO NAME    ", 11);
+			std::memcpy(bs + 54, "FAT16   ", 8);
+			put16_(bs + 510, 0xAA55);
+
+			BYTE* fat = &image_[RSV * SS];
+			put16_(fat + 0, 0xFFF8);
+			put16_(fat + 2, 0xFFFF);
+			return true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	イメージの参照
+			@return イメージ
+		*/
+		//-----------------------------------------------------------------//
+		std::vector<BYTE>& at_image() noexcept { return image_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	カウンターの取得
+			@return カウンター
+		*/
+		//-----------------------------------------------------------------//
+		const counter_t& get_counter() const noexcept { return counter_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	カウンターのリセット
+		*/
+		//-----------------------------------------------------------------//
+		void reset_counter() noexcept { counter_ = counter_t(); }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	読み込みの度に呼ぶ関数を設定
+			@param[in]	func	関数（空なら呼ばない）
+		*/
+		//-----------------------------------------------------------------//
+		void set_read_func(READ_FUNC func) noexcept { read_func_ = func; }
+
+
+		DSTATUS disk_status(BYTE drv) const noexcept
+		{
+			return drv == 0 ? 0 : STA_NOINIT;
+		}
+
+
+		DSTATUS disk_initialize(BYTE drv) noexcept
+		{
+			return disk_status(drv);
+		}
+
+
+		DRESULT disk_read(BYTE drv, BYTE* buff, DWORD sector, UINT count) noexcept
+		{
+			if(drv != 0 || count == 0) return RES_PARERR;
+			if((static_cast<uint64_t>(sector) + count) * SS > image_.size()) return RES_ERROR;
+			std::memcpy(buff, &image_[sector * SS], count * SS);
+			++counter_.read_cmd_;
+			counter_.read_sector_ += count;
+			if(read_func_) read_func_(buff, sector, count);
+			return RES_OK;
+		}
+
+
+		DRESULT disk_write(BYTE drv, const BYTE* buff, DWORD sector, UINT count) noexcept
+		{
+			if(drv != 0 || count == 0) return RES_PARERR;
+			if((static_cast<uint64_t>(sector) + count) * SS > image_.size()) return RES_ERROR;
+			std::memcpy(&image_[sector * SS], buff, count * SS);
+			++counter_.write_cmd_;
+			counter_.write_sector_ += count;
+			return RES_OK;
+		}
+
+
+		DRESULT disk_ioctl(BYTE drv, BYTE ctrl, void* buff) noexcept
+		{
+			if(drv != 0) return RES_PARERR;
+			switch(ctrl) {
+			case CTRL_SYNC:
+				++counter_.sync_;
+				return RES_OK;
+			case GET_SECTOR_COUNT:
+				*static_cast<DWORD*>(buff) = image_.size() / SS;
+				return RES_OK;
+			case GET_BLOCK_SIZE:
+				*static_cast<DWORD*>(buff) = 1;
+				return RES_OK;
+			default:
+				return RES_PARERR;
+			}
+		}
+	};
+}
@@ -0,0 +1,294 @@
+//=====================================================================//
+/*!	@file
+	@brief	render（graphics::render）のスパン描画、ビットマップ展開の @n
+			ホスト・テスト、ベンチマーク @n
+			・fill_box、line_h、draw_bitmap、draw_text、scroll が、従来の @n
+			  １ピクセル毎の描画と、フレームバッファで一致する事 @n
+			  （奇数アドレス、奇数幅、画面外、クリッピング領域、背景の有無）@n
+			・それぞれの１回当たりの時間、サイクル数を比較して表示する。
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include "common/format.hpp"
+#include "graphics/font8x16.hpp"
+#include "graphics/graphics.hpp"
+#include "check.hpp"
+#include "bench.hpp"
+
+namespace {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	GLCDC の代わり（フレームバッファだけを持つ）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct glc_t {
+		static const int16_t width  = 480;
+		static const int16_t height = 272;
+
+		uint16_t	fb_[512 * height];
+
+		void* get_fbp() const noexcept { return const_cast<uint16_t*>(fb_); }
+	};
+
+	typedef graphics::font<graphics::font8x16, graphics::kfont_null> FONT;
+	typedef graphics::render<glc_t, FONT> RENDER;
+
+	graphics::font8x16		afont_;
+	graphics::kfont_null	kfont_;
+	FONT	font_(afont_, kfont_);
+
+	glc_t	glc_;
+	RENDER	render_(glc_, font_);	///< スパン描画
+	glc_t	glc_ref_;
+	RENDER	render_ref_(glc_ref_, font_);	///< 従来の描画（１ピクセル毎）
+
+	static const vtx::srect FULL(0, 0, glc_t::width, glc_t::height);
+
+	static const char* TEXT = "The quick brown fox jumps over the lazy dog. 0123456789";
+
+
+	//-----------------------------------------------------------------//
+	/*
+		従来の描画（１ピクセル毎、render_ref_ に描く）
+	*/
+	//-----------------------------------------------------------------//
+	// クリップしてから、１ピクセルずつ書く（従来の line_h）
+	void ref_line_h_(int16_t y, int16_t x, int16_t w) noexcept
+	{
+		const auto& c = render_ref_.get_clip();
+		if(w <= 0) return;
+		if(y < c.org.y || y >= c.end_y()) return;
+		if(x < c.org.x) {
+			w -= c.org.x - x;
+			x = c.org.x;
+		}
+		if((x + w) > c.end_x()) w = c.end_x() - x;
+		uint16_t* out = &glc_ref_.fb_[y * RENDER::line_offset + x];
+		for(int16_t i = 0; i < w; ++i) {
+			*out++ = render_ref_.get_fore_color().rgb565;
+		}
+	}
+
+
+	void ref_fill_box_(const vtx::srect& rect) noexcept
+	{
+		for(int16_t yy = rect.org.y; yy < (rect.org.y + rect.size.y); ++yy) {
+			ref_line_h_(yy, rect.org.x, rect.size.x);
+		}
+	}
+
+
+	void ref_draw_bitmap_(const vtx::spos& pos, const void* img, const vtx::spos& ssz, bool back) noexcept
+	{
+		const uint8_t* p = static_cast<const uint8_t*>(img);
+		uint8_t k = 1;
+		uint8_t c = *p++;
+		vtx::spos loc = pos;
+		for(int16_t i = 0; i < ssz.y; ++i) {
+			loc.x = pos.x;
+			for(int16_t j = 0; j < ssz.x; ++j) {
+				if(c & k) render_ref_.fast_plot(loc, render_ref_.get_fore_color().rgb565);
+				else if(back) render_ref_.fast_plot(loc, render_ref_.get_back_color().rgb565);
+				k <<= 1;
+				if(k == 0) {
+					k = 1;
+					c = *p++;
+				}
+				++loc.x;
+			}
+			++loc.y;
+		}
+	}
+
+
+	int16_t ref_draw_text_(const vtx::spos& pos, const char* str, bool back) noexcept
+	{
+		auto p = pos;
+		char ch;
+		while((ch = *str++) != 0) {
+			ref_draw_bitmap_(p, FONT::a_type::get(ch),
+				vtx::spos(FONT::a_type::width, FONT::a_type::height), back);
+			p.x += FONT::a_type::width;
+		}
+		return p.x;
+	}
+
+
+	void ref_scroll_(int16_t h) noexcept
+	{
+		auto fb = glc_ref_.fb_;
+		static const int32_t lo = RENDER::line_offset;
+		if(h > 0) {
+			for(int32_t i = 0; i < (lo * (glc_t::height - h)); ++i) {
+				fb[i] = fb[i + (lo * h)];
+			}
+		} else if(h < 0) {
+			h = -h;
+			for(int32_t i = (lo * (glc_t::height - h)) - 1; i >= 0; --i) {
+				fb[i + (lo * h)] = fb[i];
+			}
+		}
+	}
+
+
+	// 両方のフレームバッファを、同じ内容にする
+	void init_() noexcept
+	{
+		uint32_t x = 2463534242;
+		for(auto& v : glc_.fb_) {
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			v = x;
+		}
+		std::memcpy(glc_ref_.fb_, glc_.fb_, sizeof(glc_.fb_));
+	}
+
+
+	bool same_() noexcept
+	{
+		return std::memcmp(glc_.fb_, glc_ref_.fb_, sizeof(glc_.fb_)) == 0;
+	}
+
+
+	void set_clip_(const vtx::srect& clip) noexcept
+	{
+		render_.set_clip(clip);
+		render_ref_.set_clip(clip);
+	}
+
+
+	void set_color_(const graphics::share_color& fc, const graphics::share_color& bc) noexcept
+	{
+		render_.set_fore_color(fc);
+		render_.set_back_color(bc);
+		render_ref_.set_fore_color(fc);
+		render_ref_.set_back_color(bc);
+	}
+
+
+	// 様々な配置で、fill_box と line_h を比較
+	bool fill_() noexcept
+	{
+		static const vtx::srect rects[] = {
+			{ 0, 0, 1, 1 },   { 1, 0, 1, 3 },   { 1, 1, 2, 2 },   { 3, 5, 7, 9 },
+			{ 2, 7, 8, 3 },   { 5, 9, 31, 4 },  { 100, 50, 200, 100 },
+			{ -20, -7, 60, 30 }, { 470, 260, 40, 40 }, { -5, 100, 500, 3 },
+			{ 10, 10, 0, 5 }, { 10, 10, 5, -1 }, { 600, 10, 5, 5 }, { 10, -30, 5, 20 },
+		};
+		init_();
+		for(const auto& r : rects) {
+			render_.fill_box(r);
+			ref_fill_box_(r);
+			render_.line_h(r.org.y + r.size.y, r.org.x + 1, r.size.x + 3);
+			ref_line_h_(r.org.y + r.size.y, r.org.x + 1, r.size.x + 3);
+		}
+		return same_();
+	}
+
+
+	// 様々な幅、位置で draw_bitmap を比較
+	bool bitmap_(bool back) noexcept
+	{
+		uint8_t bits[64 * 40 / 8 + 1];
+		uint32_t x = 88172645;
+		for(auto& v : bits) {
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			v = x;
+		}
+		bits[0] = 0xff;  // 全て前景の８ピクセル
+		init_();
+		static const int16_t ws[] = { 1, 3, 7, 8, 9, 13, 16, 31, 32, 33, 40, 64 };
+		int16_t y = -10;
+		for(auto w : ws) {
+			int16_t h = sizeof(bits) * 8 / w;
+			if(h > 40) h = 40;
+			for(int16_t xx : { -5, 0, 3, 101, 470 }) {
+				render_.draw_bitmap(vtx::spos(xx, y), bits, vtx::spos(w, h), back);
+				ref_draw_bitmap_(vtx::spos(xx, y), bits, vtx::spos(w, h), back);
+			}
+			y += 23;
+		}
+		return same_();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	set_color_(graphics::def_color::White, graphics::def_color::Navy);
+
+	// 塗りつぶし（画面全体、クリッピング領域）
+	CHECK(fill_());
+	set_clip_(vtx::srect(13, 21, 101, 77));
+	CHECK(fill_());
+	set_clip_(FULL);
+
+	// ビットマップ（背景なし、背景あり、クリッピング領域）
+	CHECK(bitmap_(false));
+	CHECK(bitmap_(true));
+	set_clip_(vtx::srect(7, 3, 300, 200));
+	CHECK(bitmap_(false));
+	CHECK(bitmap_(true));
+	set_clip_(FULL);
+
+	// 色を変えると、展開テーブルを作り直す
+	set_color_(graphics::def_color::Red, graphics::def_color::Green);
+	CHECK(bitmap_(true));
+
+	// テキスト（draw_text はフォントのビットマップを描く）
+	init_();
+	for(int16_t y = -8; y < glc_t::height; y += 17) {
+		bool back = (y / 17) & 1;
+		auto a = render_.draw_text(vtx::spos(y / 2 - 5, y), TEXT, false, back);
+		auto b = ref_draw_text_(vtx::spos(y / 2 - 5, y), TEXT, back);
+		CHECK(a == b);
+	}
+	CHECK(same_());
+
+	// スクロール（上、下）
+	init_();
+	render_.scroll(16);
+	ref_scroll_(16);
+	CHECK(same_());
+	render_.scroll(-5);
+	ref_scroll_(-5);
+	CHECK(same_());
+
+	{  // ベンチマーク（結果は表示のみ）
+		set_color_(graphics::def_color::White, graphics::def_color::Navy);
+		auto fill = sim_test::bench(200, [](uint32_t i) { render_.fill_box(vtx::srect(i & 1, 0, 479, 272)); });
+		auto fill_ref = sim_test::bench(200, [](uint32_t i) { ref_fill_box_(vtx::srect(i & 1, 0, 479, 272)); });
+		auto text = sim_test::bench(200, [](uint32_t i) {
+			for(int16_t y = 0; y < glc_t::height; y += 16) render_.draw_text(vtx::spos(0, y), TEXT, false, true);
+		});
+		auto text_ref = sim_test::bench(200, [](uint32_t i) {
+			for(int16_t y = 0; y < glc_t::height; y += 16) ref_draw_text_(vtx::spos(0, y), TEXT, true);
+		});
+		auto tran = sim_test::bench(200, [](uint32_t i) {
+			for(int16_t y = 0; y < glc_t::height; y += 16) render_.draw_text(vtx::spos(0, y), TEXT, false, false);
+		});
+		auto tran_ref = sim_test::bench(200, [](uint32_t i) {
+			for(int16_t y = 0; y < glc_t::height; y += 16) ref_draw_text_(vtx::spos(0, y), TEXT, false);
+		});
+		auto scrl = sim_test::bench(200, [](uint32_t i) { render_.scroll(16); });
+		auto scrl_ref = sim_test::bench(200, [](uint32_t i) { ref_scroll_(16); });
+
+		auto rep = [](const char* name, const sim_test::bench_t& t, const sim_test::bench_t& r) {
+			printf("render_test: %-24s %8.1f us (%9.0f cycles), per-pixel %8.1f us (%9.0f cycles), x%.1f\n",
+				name, t.ns_ / 1000.0, t.cycle_, r.ns_ / 1000.0, r.cycle_, r.ns_ / t.ns_);
+		};
+		rep("fill_box 479x272", fill, fill_ref);
+		rep("draw_text 17 lines, back", text, text_ref);
+		rep("draw_text 17 lines", tran, tran_ref);
+		rep("scroll 16 lines", scrl, scrl_ref);
+	}
+
+	return sim_test::result::report("render_test");
+}
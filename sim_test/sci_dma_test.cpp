@@ -0,0 +1,176 @@
+//=====================================================================//
+/*!	@file
+	@brief	sci_dma_io のホスト・テスト（IO_SIM の SCI、DMAC モデル使用） @n
+			・TXI 起動の DMAC 送信で、全ての文字が TDR に届く事 @n
+			・RXI 起動の DMAC（リピート転送）で、受信バッファに入る事 @n
+			・受信アイドルの検出 @n
+			・受信オーバーフロー（格納出来る数を超えた分だけ、古い方から捨てる）@n
+			  ２のべき乗のサイズ（全体に格納）、それ以外（一つ少ない）の両方
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstring>
+#include "common/renesas.hpp"
+#include "common/fixed_fifo.hpp"
+#include "common/sci_dma_io.hpp"
+#include "check.hpp"
+
+namespace {
+
+	typedef utils::fixed_fifo<char, 256> RBF;
+	typedef utils::fixed_fifo<char, 512> SBF;
+
+	typedef device::sci_dma_io<device::SCI1, RBF, SBF, device::DMAC1, device::DMAC2> SCI;
+	SCI		sci_;
+
+	typedef utils::fixed_fifo<char, 250> RBF2;
+	typedef device::sci_dma_io<device::SCI2, RBF2, SBF, device::DMAC0, device::DMAC3> SCIN;
+	SCIN	sci2_;
+
+	uint32_t	seq_;
+
+	template <class SM>
+	void recv_(SM& sm, uint32_t len) noexcept
+	{
+		for(uint32_t i = 0; i < len; ++i) {
+			char ch = seq_ * 7 + 1;
+			sm.recv(&ch, 1);
+			++seq_;
+		}
+	}
+
+	// 受信バッファの内容が、連番の first から並んでいるか
+	template <class S>
+	bool check_(S& sci, uint32_t first, uint32_t len) noexcept
+	{
+		if(sci.recv_length() != len) return false;
+		char tmp[1024];
+		if(sci.read(tmp, len) != len) return false;
+		for(uint32_t i = 0; i < len; ++i) {
+			if(tmp[i] != static_cast<char>((first + i) * 7 + 1)) return false;
+		}
+		return true;
+	}
+
+	// cap: 受信バッファに格納出来る数
+	template <class S, class SM>
+	void overflow_(S& sci, SM& sm, uint32_t cap) noexcept
+	{
+		sci.flush_recv();
+		auto ovf = sci.get_overflow_count();
+
+		// 丁度一杯までは、オーバーフローしない
+		seq_ = 0;
+		recv_(sm, cap);
+		CHECK(sci.get_overflow_count() == ovf);
+		CHECK(check_(sci, 0, cap));
+
+		// 一杯から 10 個溢れたら、古い 10 個だけ捨てる
+		seq_ = 0;
+		recv_(sm, cap);
+		sci.get_recv_count();
+		recv_(sm, 10);
+		CHECK(sci.get_overflow_count() == (ovf + 1));
+		CHECK(check_(sci, 10, cap));
+
+		// 先に５個読んでから、溢れさせる
+		seq_ = 0;
+		recv_(sm, cap);
+		char tmp[8];
+		CHECK(sci.read(tmp, 5) == 5);
+		recv_(sm, 8);
+		CHECK(sci.get_overflow_count() == (ovf + 2));
+		CHECK(check_(sci, 8, cap));
+
+		// 一周以上、読まずに受信したら、最新の cap 個が残る
+		seq_ = 0;
+		recv_(sm, 3);
+		sci.get_recv_count();
+		recv_(sm, 600);
+		CHECK(sci.get_overflow_count() == (ovf + 3));
+		CHECK(check_(sci, 603 - cap, cap));
+
+		// 溢れた後も、続けて受信出来る
+		seq_ = 0;
+		recv_(sm, 20);
+		CHECK(sci.get_overflow_count() == (ovf + 3));
+		CHECK(check_(sci, 0, 20));
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+
+	sim::dmac_model<DMAC1, ICU> tdm;
+	sim::dmac_model<DMAC2, ICU> rdm;
+	sim::sci_model<SCI1> sm;
+	sim::space::attach(tdm);
+	sim::space::attach(rdm);
+	sim::space::attach(sm);
+
+	CHECK(sci_.start(3000000, 2));
+
+	{  // 送信
+		static const char* msg = "The quick brown fox jumps over the lazy dog.";
+		uint32_t n = 0;
+		for(int i = 0; i < 100; ++i) {
+			sci_.puts(msg);
+			n += strlen(msg);
+		}
+		CHECK(sm.get_send().size() == n);
+		CHECK(sci_.get_send_count() == n);
+		CHECK(memcmp(sm.get_send().data(), msg, strlen(msg)) == 0);
+		CHECK(memcmp(&sm.get_send()[n - strlen(msg)], msg, strlen(msg)) == 0);
+		CHECK(tdm.get_count() == n);
+		CHECK(sci_.send_length() == 0);
+
+		sm.clear_send();
+		sci_.putch('\n');
+		CHECK(sm.get_send().size() == 2 && sm.get_send()[0] == '\r' && sm.get_send()[1] == '\n');
+	}
+
+	{  // 受信
+		sm.recv("abc", 3);
+		CHECK(rdm.get_count() == 3);
+		CHECK(sci_.recv_length() == 3);
+		CHECK(sci_.getch() == 'a');
+		char tmp[8];
+		CHECK(sci_.read(tmp, sizeof(tmp)) == 2);
+		CHECK(tmp[0] == 'b' && tmp[1] == 'c');
+		CHECK(sci_.get_recv_count() == 3);
+
+		// アイドル検出
+		sci_.service();
+		sci_.service();
+		CHECK(sci_.get_idle_count() == 1);
+		sm.recv("d", 1);
+		sci_.service();
+		CHECK(sci_.get_idle_count() == 0);
+		CHECK(sci_.getch() == 'd');
+		CHECK(sci_.get_overflow_count() == 0);
+	}
+
+	{  // 受信オーバーフロー
+		overflow_(sci_, sm, 256);
+
+		sim::dmac_model<DMAC0, ICU> tdm2;
+		sim::dmac_model<DMAC3, ICU> rdm2;
+		sim::sci_model<SCI2> sm2;
+		sim::space::attach(tdm2);
+		sim::space::attach(rdm2);
+		sim::space::attach(sm2);
+		CHECK(sci2_.start(115200, 2));
+		overflow_(sci2_, sm2, 249);
+		sim::space::detach(sm2);
+		sim::space::detach(rdm2);
+		sim::space::detach(tdm2);
+	}
+
+	return sim_test::result::report("sci_dma_test");
+}
@@ -0,0 +1,84 @@
+//=====================================================================//
+/*!	@file
+	@brief	sci_io のホスト・テスト（IO_SIM の SCI モデル使用） @n
+			・割り込み送信で、全ての文字が TDR に届く事 @n
+			・受信データが RXI 経由で、受信バッファに入る事 @n
+			・ポーリング（割り込みレベル０）でも送受信出来る事
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstring>
+#include "common/renesas.hpp"
+#include "common/fixed_fifo.hpp"
+#include "common/sci_io.hpp"
+#include "check.hpp"
+
+namespace {
+
+	typedef utils::fixed_fifo<char, 256> RBF;
+	typedef utils::fixed_fifo<char, 64> SBF;
+
+	typedef device::sci_io<device::SCI9, RBF, SBF> SCI;
+	SCI		sci_;
+
+	typedef device::sci_io<device::SCI2, RBF, SBF> SCIP;
+	SCIP	scip_;
+}
+
+int main(int argc, char** argv)
+{
+	using namespace device;
+
+	init_interrupt();
+
+	{  // 割り込み
+		sim::sci_model<SCI9> sm;
+		sim::space::attach(sm);
+		CHECK(sci_.start(115200, 2));
+
+		static const char* msg = "The quick brown fox jumps over the lazy dog.";
+		uint32_t n = 0;
+		for(int i = 0; i < 100; ++i) {
+			sci_.puts(msg);
+			n += strlen(msg);
+		}
+		CHECK(sm.get_send().size() == n);
+		CHECK(memcmp(sm.get_send().data(), msg, strlen(msg)) == 0);
+		CHECK(memcmp(&sm.get_send()[n - strlen(msg)], msg, strlen(msg)) == 0);
+
+		sm.clear_send();
+		sci_.auto_crlf();
+		sci_.putch('\n');
+		CHECK(sm.get_send().size() == 2 && sm.get_send()[0] == '\r' && sm.get_send()[1] == '\n');
+
+		sm.recv("abc", 3);
+		CHECK(sci_.recv_length() == 3);
+		CHECK(sci_.getch() == 'a');
+		CHECK(sci_.getch() == 'b');
+		CHECK(sci_.getch() == 'c');
+		CHECK(sci_.recv_length() == 0);
+
+		// ICU の IPR、IER が設定されている事（ref8_ 経由）
+		auto rxv = static_cast<uint8_t>(SCI9::get_rx_vec());
+		CHECK(ICU::IPR[rxv] == 2);
+		sim::space::detach(sm);
+	}
+
+	{  // ポーリング
+		sim::sci_model<SCI2> sm;
+		sim::space::attach(sm);
+		CHECK(scip_.start(9600, 0));
+		scip_.puts("poll");
+		CHECK(sm.get_send().size() == 4 && memcmp(sm.get_send().data(), "poll", 4) == 0);
+		sm.recv("xy", 2);
+		CHECK(scip_.recv_length() == 1);
+		CHECK(scip_.getch() == 'x');
+		CHECK(scip_.getch() == 'y');
+		sim::space::detach(sm);
+	}
+
+	return sim_test::result::report("sci_test");
+}
@@ -0,0 +1,279 @@
+//=====================================================================//
+/*!	@file
+	@brief	FatFs セクター・キャッシュ（fatfs::sector_cache）のホスト・テスト @n
+			RAM ディスク（FAT16）の上で、キャッシュ無しと、キャッシュ有りで @n
+			同じ操作を行い、比較する。@n
+			・ファイルの内容、ディスク・イメージが、キャッシュ無しと一致する事 @n
+			・ディレクトリーを繰り返し走査すると、メタデータ・キャッシュに @n
+			  ヒットし、デバイスの読み込みが減る事 @n
+			・連続する１セクターの書き込みを、マルチブロックにまとめる事 @n
+			・書き込み待ちは f_sync（CTRL_SYNC）まで書かず、読み込みには @n
+			  書き込み待ちの内容が見える事 @n
+			・カードの取り外しで、書き込み待ちを破棄する事
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <vector>
+#include "ff13c/sector_cache.hpp"
+#include "ram_disk.hpp"
+#include "check.hpp"
+
+namespace {
+
+	static const uint32_t SECTORS = 8192;  // 4M バイト
+
+	typedef fatfs::sector_cache<sim_test::ram_disk, 16, 8, 8> CACHE;
+
+	sim_test::ram_disk	plain_(SECTORS);
+	CACHE				cache_(SECTORS);
+
+	// FatFs の disk_xxx を繋ぐデバイス（キャッシュ無し、有り）
+	bool	use_cache_ = false;
+
+	FATFS	fatfs_;
+}
+
+extern "C" {
+
+	DSTATUS disk_initialize(BYTE drv) {
+		if(use_cache_) return cache_.disk_initialize(drv);
+		else return plain_.disk_initialize(drv);
+	}
+
+	DSTATUS disk_status(BYTE drv) {
+		if(use_cache_) return cache_.disk_status(drv);
+		else return plain_.disk_status(drv);
+	}
+
+	DRESULT disk_read(BYTE drv, BYTE* buff, DWORD sector, UINT count) {
+		if(use_cache_) return cache_.disk_read(drv, buff, sector, count);
+		else return plain_.disk_read(drv, buff, sector, count);
+	}
+
+	DRESULT disk_write(BYTE drv, const BYTE* buff, DWORD sector, UINT count) {
+		if(use_cache_) return cache_.disk_write(drv, buff, sector, count);
+		else return plain_.disk_write(drv, buff, sector, count);
+	}
+
+	DRESULT disk_ioctl(BYTE drv, BYTE ctrl, void* buff) {
+		if(use_cache_) return cache_.disk_ioctl(drv, ctrl, buff);
+		else return plain_.disk_ioctl(drv, ctrl, buff);
+	}
+
+	DWORD get_fattime(void) {
+		return ((2020 - 1980) << 25) | (1 << 21) | (1 << 16);
+	}
+}
+
+namespace {
+
+	static const uint32_t FILES = 40;
+
+	uint8_t pattern_(uint32_t id, uint32_t pos) noexcept
+	{
+		return (pos * 13) ^ (pos >> 8) ^ (id * 0x5b);
+	}
+
+
+	uint32_t file_size_(uint32_t id) noexcept
+	{
+		return 100 + id * 1531;
+	}
+
+
+	// 小さな書き込みで、ファイルを作る（f_close で書き出す）
+	bool make_files_() noexcept
+	{
+		if(f_mkdir("/dir") != FR_OK) return false;
+		for(uint32_t id = 0; id < FILES; ++id) {
+			char path[32];
+			snprintf(path, sizeof(path), "/dir/file_%02u.bin", id);
+			FIL fil;
+			if(f_open(&fil, path, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) return false;
+			uint32_t size = file_size_(id);
+			uint8_t tmp[97];
+			for(uint32_t pos = 0; pos < size; pos += sizeof(tmp)) {
+				UINT n = size - pos;
+				if(n > sizeof(tmp)) n = sizeof(tmp);
+				for(UINT i = 0; i < n; ++i) tmp[i] = pattern_(id, pos + i);
+				UINT bw;
+				if(f_write(&fil, tmp, n, &bw) != FR_OK || bw != n) return false;
+			}
+			if(f_close(&fil) != FR_OK) return false;
+		}
+		return true;
+	}
+
+
+	// 全ファイルの内容を確認（ディレクトリーを走査して開く）
+	bool verify_files_() noexcept
+	{
+		DIR dir;
+		if(f_opendir(&dir, "/dir") != FR_OK) return false;
+		uint32_t num = 0;
+		FILINFO fno;
+		while(f_readdir(&dir, &fno) == FR_OK && fno.fname[0] != 0) {
+			uint32_t id;
+			if(sscanf(fno.fname, "file_%02u.bin", &id) != 1 || id >= FILES) return false;
+			if(fno.fsize != file_size_(id)) return false;
+			char path[FF_LFN_BUF + 8];
+			snprintf(path, sizeof(path), "/dir/%s", fno.fname);
+			FIL fil;
+			if(f_open(&fil, path, FA_READ) != FR_OK) return false;
+			uint8_t tmp[300];
+			uint32_t pos = 0;
+			UINT rl;
+			while(f_read(&fil, tmp, sizeof(tmp), &rl) == FR_OK && rl > 0) {
+				for(UINT i = 0; i < rl; ++i) {
+					if(tmp[i] != pattern_(id, pos + i)) return false;
+				}
+				pos += rl;
+			}
+			f_close(&fil);
+			if(pos != file_size_(id)) return false;
+			++num;
+		}
+		f_closedir(&dir);
+		return num == FILES;
+	}
+
+
+	// ディレクトリーの走査と、ファイル情報の取得
+	uint32_t walk_(uint32_t loop) noexcept
+	{
+		uint32_t num = 0;
+		for(uint32_t i = 0; i < loop; ++i) {
+			DIR dir;
+			if(f_opendir(&dir, "/dir") != FR_OK) return 0;
+			FILINFO fno;
+			while(f_readdir(&dir, &fno) == FR_OK && fno.fname[0] != 0) {
+				char path[FF_LFN_BUF + 8];
+				snprintf(path, sizeof(path), "/dir/%s", fno.fname);
+				FILINFO st;
+				if(f_stat(path, &st) != FR_OK) return 0;
+				++num;
+			}
+			f_closedir(&dir);
+		}
+		return num;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	CHECK(plain_.format());
+	CHECK(cache_.format());
+
+	// キャッシュ無し
+	use_cache_ = false;
+	CHECK(f_mount(&fatfs_, "", 1) == FR_OK);
+	CHECK(make_files_());
+	CHECK(verify_files_());
+	plain_.reset_counter();
+	CHECK(walk_(4) == (FILES * 4));
+	auto plain_walk = plain_.get_counter();
+	f_mount(nullptr, "", 0);
+
+	// キャッシュ有り
+	use_cache_ = true;
+	cache_.set_meta_buff(fatfs_.win);
+	CHECK(f_mount(&fatfs_, "", 1) == FR_OK);
+	cache_.reset_counter();
+	cache_.sim_test::ram_disk::reset_counter();
+	CHECK(make_files_());
+	{
+		// 連続する１セクターの書き込みをまとめる
+		const auto& c = cache_.get_counter();
+		const auto& d = cache_.sim_test::ram_disk::get_counter();
+		CHECK(c.write_cmd_ == d.write_cmd_);
+		CHECK(d.write_cmd_ < (c.write_sector_ / 2));
+	}
+	CHECK(verify_files_());
+
+	cache_.invalidate();
+	cache_.reset_counter();
+	cache_.sim_test::ram_disk::reset_counter();
+	CHECK(walk_(4) == (FILES * 4));
+	{
+		const auto& c = cache_.get_counter();
+		const auto& d = cache_.sim_test::ram_disk::get_counter();
+		CHECK(c.meta_hit_ > (c.meta_miss_ * 4));
+		// ディレクトリー、FAT はメタデータ・プールに収まるので、２回目以降はデバイスを読まない
+		CHECK(d.read_sector_ <= c.meta_miss_);
+		CHECK(d.read_sector_ < (plain_walk.read_sector_ / 4));
+		printf("sector_cache_test: walk x4, device read %u -> %u sectors (meta hit %u, miss %u)\n",
+			plain_walk.read_sector_, d.read_sector_, c.meta_hit_, c.meta_miss_);
+	}
+
+	// f_close で書き出すので、キャッシュ無しと同じイメージ
+	CHECK(cache_.at_image() == plain_.at_image());
+
+	{  // 書き込み待ちは、f_sync まで書かない（読み込みには見える）
+		// （ファイルを伸ばすと FAT を書くので、ファイルの範囲内で書く）
+		FIL fil;
+		CHECK(f_open(&fil, "/dir/file_10.bin", FA_WRITE | FA_READ) == FR_OK);
+		CHECK(f_lseek(&fil, 1000) == FR_OK);
+		static const uint8_t text[] = "write-back";
+		UINT bw;
+		CHECK(f_write(&fil, text, sizeof(text), &bw) == FR_OK && bw == sizeof(text));
+		auto w = cache_.sim_test::ram_disk::get_counter().write_cmd_;
+		// ファイルのバッファから書き出す（ライトバック・バッファに入る）
+		CHECK(f_lseek(&fil, 5000) == FR_OK);
+		CHECK(cache_.sim_test::ram_disk::get_counter().write_cmd_ == w);
+		CHECK(f_lseek(&fil, 1000) == FR_OK);
+		uint8_t tmp[sizeof(text)];
+		UINT rl;
+		CHECK(f_read(&fil, tmp, sizeof(tmp), &rl) == FR_OK && rl == sizeof(tmp));
+		CHECK(std::memcmp(tmp, text, sizeof(text)) == 0);
+		CHECK(f_sync(&fil) == FR_OK);
+		CHECK(cache_.sim_test::ram_disk::get_counter().write_cmd_ > w);
+		CHECK(cache_.sim_test::ram_disk::get_counter().sync_ > 0);
+		f_close(&fil);
+
+		// キャッシュ無しで同じ書き込み
+		use_cache_ = false;
+		CHECK(f_mount(&fatfs_, "", 1) == FR_OK);
+		CHECK(f_open(&fil, "/dir/file_10.bin", FA_WRITE | FA_READ) == FR_OK);
+		CHECK(f_lseek(&fil, 1000) == FR_OK);
+		CHECK(f_write(&fil, text, sizeof(text), &bw) == FR_OK && bw == sizeof(text));
+		CHECK(f_close(&fil) == FR_OK);
+		f_mount(nullptr, "", 0);
+		CHECK(cache_.at_image() == plain_.at_image());
+	}
+
+	{  // カードの取り外しで、書き込み待ちを破棄する
+		use_cache_ = true;
+		CHECK(f_mount(&fatfs_, "", 1) == FR_OK);
+		auto org = cache_.at_image();
+		FIL fil;
+		CHECK(f_open(&fil, "/dir/file_01.bin", FA_WRITE) == FR_OK);
+		static const uint8_t text[] = "lost";
+		UINT bw;
+		CHECK(f_write(&fil, text, sizeof(text), &bw) == FR_OK);
+		CHECK(f_lseek(&fil, 1500) == FR_OK);  // ライトバック・バッファへ
+		cache_.card_removed();
+		CHECK(cache_.flush() == RES_OK);
+		CHECK(cache_.at_image() == org);
+		f_mount(nullptr, "", 0);
+
+		// 再マウントすれば、元の内容が読める
+		CHECK(f_mount(&fatfs_, "", 1) == FR_OK);
+		CHECK(f_open(&fil, "/dir/file_01.bin", FA_READ) == FR_OK);
+		uint8_t tmp[8];
+		UINT rl;
+		CHECK(f_read(&fil, tmp, sizeof(tmp), &rl) == FR_OK && rl == sizeof(tmp));
+		bool ok = true;
+		for(uint32_t i = 0; i < sizeof(tmp); ++i) {
+			if(tmp[i] != pattern_(1, i)) ok = false;
+		}
+		CHECK(ok);
+		f_close(&fil);
+		f_mount(nullptr, "", 0);
+	}
+
+	return sim_test::result::report("sector_cache_test");
+}
@@ -0,0 +1,281 @@
+//=====================================================================//
+/*!	@file
+	@brief	snd_mgr（ブロック・ミキサー）のホスト・テスト、ベンチマーク @n
+			・変更前の実装（legacy::snd_mgr）と、同じリクエスト列で比較する。@n
+			  既定のボリューム、パン、等速のワンショットでは、ビット単位で一致する事 @n
+			  （変更前は、ループの折り返しでバッファの残りが無音になるので、@n
+			    ループは比較しない）@n
+			・中央のパンなら、「render」の L、R は、モノラルと一致する事 @n
+			・ボイス・フレーム当たりのサイクル数と、1MHz 当たりのボイス数（44.1KHz）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "sound/snd_mgr.hpp"
+#include "check.hpp"
+
+namespace legacy {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief  変更前のサウンド・マネージャー（比較用、発音とミックス部分のみ）
+		@param[in]	CTXMAX	最大登録数
+		@param[in]	SNDMAX	同時発音数
+		@param[in]	RDRLEN	レンダリング・バッファ長さ
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	template <uint32_t CTXMAX, uint32_t SNDMAX, uint32_t RDRLEN>
+	class snd_mgr {
+
+		struct ctx_t {
+			const int8_t*	org_;
+			uint32_t		len_;
+			ctx_t() : org_(nullptr), len_(0) { }
+		};
+		ctx_t	ctx_[CTXMAX];
+
+		struct snd_t {
+			uint32_t	ctx_;
+			uint32_t	pos_;
+			bool		loop_;
+			snd_t() : ctx_(CTXMAX), pos_(0), loop_(false) { }
+		};
+		snd_t	snd_[SNDMAX];
+
+		int16_t	final_[RDRLEN];
+
+	public:
+		uint32_t set_sound(const int8_t* org, uint32_t len)
+		{
+			for(uint32_t i = 0; i < CTXMAX; ++i) {
+				if(ctx_[i].len_ == 0) {
+					ctx_[i].org_ = org;
+					ctx_[i].len_ = len;
+					return i;
+				}
+			}
+			return CTXMAX;
+		}
+
+		uint32_t request(uint32_t ctxhnd, bool loop = false) noexcept
+		{
+			if(ctxhnd >= CTXMAX) return SNDMAX;
+
+			for(uint32_t i = 0; i < SNDMAX; ++i) {
+				if(snd_[i].ctx_ < CTXMAX) {
+					continue;
+				}
+				snd_[i].ctx_  = ctxhnd;
+				snd_[i].pos_  = 0;
+				snd_[i].loop_ = loop;
+				return i;
+			}
+			return SNDMAX;
+		}
+
+		bool status(uint32_t sndhnd) const noexcept
+		{
+			if(sndhnd >= SNDMAX) return false;
+			return snd_[sndhnd].ctx_ < CTXMAX;
+		}
+
+		void update() noexcept
+		{
+			for(uint32_t i = 0; i < RDRLEN; ++i) {
+				final_[i] = 0;
+			}
+
+			for(uint32_t i = 0; i < SNDMAX; ++i) {
+				snd_t& snd = snd_[i];
+				if(snd.ctx_ >= CTXMAX) {
+					continue;
+				}
+				ctx_t& ctx = ctx_[snd.ctx_];
+				const int8_t* org = ctx.org_;
+				for(uint32_t j = 0; j < RDRLEN; ++j) {
+					if(snd.pos_ >= ctx.len_) {
+						if(snd.loop_) {
+							snd.pos_ = 0;
+						} else {
+							snd.ctx_ = CTXMAX;
+						}
+						break;
+					}
+					final_[j] += org[snd.pos_];
+					++snd.pos_;
+				}
+			}
+
+			// 最終ゲイン調整
+			for(uint32_t i = 0; i < RDRLEN; ++i) {
+				final_[i] *= 256 / SNDMAX;
+			}
+		}
+
+		const int16_t* get_buffer() const noexcept { return final_; }
+	};
+}
+
+namespace {
+
+	uint32_t	rand_ = 1;
+	uint32_t rand_next_() noexcept
+	{
+		rand_ = rand_ * 1103515245 + 12345;
+		return rand_ >> 8;
+	}
+
+	// 登録した波形は、snd_mgr の shared_ptr が持つので、snd_mgr は破棄しない
+	int8_t* make_wave_(uint32_t len, bool full) noexcept
+	{
+		int8_t* p = new int8_t[len];
+		for(uint32_t i = 0; i < len; ++i) {
+			p[i] = full ? ((i & 1) ? 127 : -128) : static_cast<int8_t>(rand_next_());
+		}
+		return p;
+	}
+
+	typedef utils::fixed_fifo<sound::wave_t, 512> FIFO;
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief  変更前のミキサーとの比較（ランダムなワンショットのリクエスト）
+		@param[in]	frames	比較するフレーム数
+		@return 全て一致したら「true」
+	*/
+	//-----------------------------------------------------------------//
+	template <uint32_t CTXMAX, uint32_t SNDMAX, uint32_t RDRLEN>
+	bool compare_(uint32_t frames) noexcept
+	{
+		typedef sound::snd_mgr<CTXMAX, SNDMAX, RDRLEN> MGR;
+		typedef legacy::snd_mgr<CTXMAX, SNDMAX, RDRLEN> OLD;
+		auto& mgr = *new MGR;
+		auto& ster = *new MGR;  // render（ステレオ）用
+		OLD old;
+
+		for(uint32_t i = 0; i < CTXMAX; ++i) {
+			// 最後は、全ボイスで重ねても飽和しない最大振幅
+			uint32_t len = (i == (CTXMAX - 1)) ? RDRLEN * 2 : (rand_next_() % (RDRLEN * 3)) + 1;
+			const int8_t* w = make_wave_(len, i == (CTXMAX - 1));
+			mgr.set_sound(w, len);
+			ster.set_sound(w, len);
+			old.set_sound(w, len);
+		}
+
+		bool ok = true;
+		FIFO fifo;
+		for(uint32_t f = 0; f < frames; ++f) {
+			uint32_t req = rand_next_() % (SNDMAX + 1);
+			for(uint32_t i = 0; i < req; ++i) {
+				uint32_t ctx = rand_next_() % CTXMAX;
+				// 変更前は、空きが無い時は鳴らさない（新しい方は奪う）ので、空きがある時だけ
+				bool free = false;
+				for(uint32_t j = 0; j < SNDMAX; ++j) {
+					if(!old.status(j)) free = true;
+				}
+				if(!free) break;
+				auto h = old.request(ctx);
+				if(mgr.request(ctx) != h) ok = false;
+				ster.request(ctx);
+			}
+			old.update();
+			mgr.update();
+			const int16_t* a = old.get_buffer();
+			const int16_t* b = mgr.get_buffer();
+			for(uint32_t i = 0; i < RDRLEN; ++i) {
+				if(a[i] != b[i]) ok = false;
+			}
+			if(ster.render(fifo, RDRLEN) != RDRLEN) ok = false;
+			for(uint32_t i = 0; i < RDRLEN; ++i) {
+				auto t = fifo.get();  // wave_t は符号付きの値を uint16_t で持つ
+				if(static_cast<int16_t>(t.l_ch) != a[i] || static_cast<int16_t>(t.r_ch) != a[i]) ok = false;
+			}
+		}
+		return ok;
+	}
+
+
+	uint64_t cycle_() noexcept
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		return __rdtsc();
+#else
+		return 0;
+#endif
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief  ベンチマーク（全ボイスをループで鳴らし続ける）
+		@param[in]	title	表示
+		@param[in]	pitch	ピッチ（16.16）
+		@param[in]	loop	update の回数
+	*/
+	//-----------------------------------------------------------------//
+	template <class MGR>
+	void bench_(const char* title, uint32_t pitch, uint32_t loop) noexcept
+	{
+		auto& mgr = *new MGR;
+		static const uint32_t LEN = 4000;
+		auto h = mgr.set_sound(make_wave_(LEN, false), LEN);
+		for(uint32_t i = 0; i < mgr.sound_max(); ++i) {
+			mgr.request(h, true, MGR::VOLUME_MAX, (i & 1) ? 0x2000 : -0x2000, pitch);
+		}
+		mgr.update();  // ウォーム・アップ
+
+		auto st = std::chrono::steady_clock::now();
+		auto cs = cycle_();
+		for(uint32_t i = 0; i < loop; ++i) mgr.update();
+		auto cyc = cycle_() - cs;
+		auto d = std::chrono::steady_clock::now() - st;
+		double vf = static_cast<double>(mgr.sound_max()) * mgr.get_length() * loop;
+		double ns = std::chrono::duration<double, std::nano>(d).count() / vf;
+		if(cyc > 0) {
+			double cpf = static_cast<double>(cyc) / vf;
+			printf("snd_mgr_test: %s: %.2f ns, %.1f cycles / voice-frame, %.1f voices / MHz (44.1KHz)\n",
+				title, ns, cpf, 1e6 / (cpf * 44100.0));
+		} else {
+			printf("snd_mgr_test: %s: %.2f ns / voice-frame\n", title, ns);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	// spinv と同じ構成（SNDMAX が２のべき乗で無い）
+	CHECK((compare_<9, 6, 184>(2000)));
+	// SNDMAX が２のべき乗、ブロックより長いバッファ
+	CHECK((compare_<8, 4, 300>(1000)));
+	// 単一ボイス（ゲインは 256 倍）
+	CHECK((compare_<3, 1, 64>(500)));
+
+	{  // ボリューム、パン（左右の振り分け）
+		typedef sound::snd_mgr<1, 1, 32> MGR;
+		auto& mgr = *new MGR;
+		FIFO fifo;
+		auto h = mgr.set_sound(make_wave_(1000, true), 1000);
+		mgr.request(h, true, MGR::VOLUME_MAX, -32768);
+		CHECK(mgr.render(fifo, 32) == 32);
+		auto t = fifo.get();
+		CHECK(static_cast<int16_t>(t.l_ch) == -128 * 256 && t.r_ch == 0);
+		mgr.set_pan(0, 32767);
+		mgr.set_volume(0, 0x4000);
+		while(fifo.length() > 0) fifo.get();
+		CHECK(mgr.render(fifo, 32) == 32);
+		t = fifo.get();
+		CHECK(t.l_ch == 0 && static_cast<int16_t>(t.r_ch) == -128 * 128);
+	}
+
+	bench_<sound::snd_mgr<4, 32, 512> >("32 voices, pitch 1.0 ", sound::snd_mgr<4, 32, 512>::PITCH_ONE, 2000);
+	bench_<sound::snd_mgr<4, 32, 512> >("32 voices, pitch 1.37", 0x15eb8, 2000);
+
+	return sim_test::result::report("snd_mgr_test");
+}
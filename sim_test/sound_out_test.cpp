@@ -0,0 +1,194 @@
+//=====================================================================//
+/*!	@file
+	@brief	sound_out（FIFO から波形メモリへの補充）のホスト・テスト @n
+			・１サンプルずつ移動する参照モデルと、波形メモリが一致する事 @n
+			  （波形メモリ、FIFO の折り返し、符号反転、不足分の無音）@n
+			・モノラル、ステレオの put、FIFO が満杯の場合の put @n
+			・アンダーランは、再生中（start、put から stop、mute まで）だけ数える事
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <deque>
+#include "sound/sound_out.hpp"
+#include "check.hpp"
+
+namespace {
+
+	static const uint32_t OUTS = 32;
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	参照モデル（１サンプルずつ移動する）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct ref_t {
+		std::deque<uint32_t>	fifo_;
+		uint32_t	wave_[OUTS];
+		uint32_t	w_put_;
+
+		ref_t() noexcept : w_put_(0) {
+			for(auto& w : wave_) w = 0x80008000;
+		}
+
+		void put(const int16_t* src, uint32_t num, uint32_t ch) noexcept
+		{
+			for(uint32_t i = 0; i < num; ++i) {
+				uint16_t l = src[i * ch];
+				uint16_t r = src[i * ch + ch - 1];
+				fifo_.push_back(l | (static_cast<uint32_t>(r) << 16));
+			}
+		}
+
+		void service(uint32_t num) noexcept
+		{
+			for(uint32_t i = 0; i < num; ++i) {
+				uint32_t v = 0;
+				if(!fifo_.empty()) {
+					v = fifo_.front();
+					fifo_.pop_front();
+				}
+				wave_[w_put_] = v ^ 0x80008000;
+				w_put_ = (w_put_ + 1) & (OUTS - 1);
+			}
+		}
+	};
+
+
+	int16_t pcm_[512 * 2];
+
+	void make_pcm_() noexcept
+	{
+		uint32_t x = 2463534242;
+		for(auto& v : pcm_) {
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			v = x;
+		}
+	}
+
+
+	template <class SOUND_OUT>
+	bool same_(SOUND_OUT& out, const ref_t& ref) noexcept
+	{
+		for(uint32_t i = 0; i < OUTS; ++i) {
+			const auto* w = out.get_wave(i);
+			uint32_t v = w->l_ch | (static_cast<uint32_t>(w->r_ch) << 16);
+			if(v != ref.wave_[i]) return false;
+		}
+		return out.at_fifo().length() == ref.fifo_.size();
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	様々な長さの put と service を繰り返して、参照モデルと比較
+		@param[in]	ch	チャネル数
+		@return 一致したら「true」
+	*/
+	//-----------------------------------------------------------------//
+	template <class SOUND_OUT>
+	bool refill_(uint32_t ch) noexcept
+	{
+		static SOUND_OUT out;
+		out.mute();
+		out.start(0);
+		ref_t ref;
+		uint32_t x = 88172645;
+		uint32_t pos = 0;
+		for(int loop = 0; loop < 2000; ++loop) {
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			uint32_t n = x % 23;
+			if((pos + n) > 512) pos = 0;
+			auto m = out.put(&pcm_[pos * ch], n, ch);
+			ref.put(&pcm_[pos * ch], m, ch);
+			pos += m;
+			uint32_t s = (x >> 8) % 19;
+			out.service(s);
+			ref.service(s);
+			if(!same_(out, ref)) return false;
+		}
+		return true;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	make_pcm_();
+
+	// 参照モデルと比較（FIFO のサイズは２のべき乗、それ以外）
+	CHECK((refill_<utils::sound_out<64, OUTS> >(2)));
+	CHECK((refill_<utils::sound_out<50, OUTS> >(2)));
+	CHECK((refill_<utils::sound_out<64, OUTS> >(1)));
+	CHECK((refill_<utils::sound_out<50, OUTS> >(1)));
+
+	typedef utils::sound_out<50, OUTS> SOUND_OUT;
+	static SOUND_OUT out;
+	out.mute();
+
+	{  // 停止中（start、put の前）は、無音を出力するだけで数えない
+		CHECK(!out.is_play());
+		for(int i = 0; i < 10; ++i) out.service(8);
+		CHECK(out.get_underrun() == 0);
+		CHECK(out.get_wave(0)->l_ch == 0x8000 && out.get_wave(OUTS - 1)->r_ch == 0x8000);
+	}
+
+	{  // put で再生を始め、不足したブロック毎に数える
+		CHECK(out.put(pcm_, 20) == 20);
+		CHECK(out.is_play());
+		out.service(8);
+		out.service(8);
+		CHECK(out.get_underrun() == 0);
+		out.service(8);  // 4 サンプル不足
+		CHECK(out.get_underrun() == 1);
+		out.service(8);  // 全て不足（再生中）
+		CHECK(out.get_underrun() == 2);
+		CHECK(out.at_fifo().length() == 0);
+	}
+
+	{  // stop の後は、FIFO の残りを出力し、不足を数えない
+		out.reset_underrun();
+		CHECK(out.put(pcm_, 12) == 12);
+		out.stop();
+		CHECK(!out.is_play());
+		out.service(8);
+		out.service(8);
+		out.service(8);
+		CHECK(out.at_fifo().length() == 0);
+		CHECK(out.get_underrun() == 0);
+		// 書き込み位置は (10 + 4) * 8 = 112 → 16、12 サンプルの後は無音
+		CHECK(out.get_wave(16)->l_ch == (static_cast<uint16_t>(pcm_[0]) ^ 0x8000));
+		CHECK(out.get_wave(27)->r_ch == (static_cast<uint16_t>(pcm_[23]) ^ 0x8000));
+		CHECK(out.get_wave(28)->l_ch == 0x8000 && out.get_wave(28)->r_ch == 0x8000);
+	}
+
+	{  // FIFO が満杯なら、書けた数を返す
+		auto n = out.put(pcm_, 100);
+		CHECK(n < 100 && n == out.at_fifo().length());
+		CHECK(out.put(pcm_, 1) == 0);
+	}
+
+	{  // mute で FIFO を捨て、再生を止める
+		out.mute();
+		CHECK(!out.is_play() && out.at_fifo().length() == 0);
+		for(int i = 0; i < 10; ++i) out.service(8);
+		CHECK(out.get_underrun() == 0);
+	}
+
+	{  // start は再生中にする（DMA の位置に合わせる）
+		out.start(OUTS + 5);
+		CHECK(out.is_play());
+		out.service(3);
+		CHECK(out.get_underrun() == 1);
+		out.stop();
+	}
+
+	return sim_test::result::report("sound_out_test");
+}
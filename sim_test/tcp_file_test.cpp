@@ -0,0 +1,277 @@
+//=====================================================================//
+/*!	@file
+	@brief	TCP ファイル送信（net::tcp_send_file）のホスト・テスト @n
+			RAM ディスク（FAT16）のファイルを、ループバックの TCP で送る。@n
+			・送信バッファへの直接読み込みで、内容が正しく届く事 @n
+			  （途中のオフセット、送信バッファの折り返しを含む）@n
+			・データ・セクターの殆どを、FatFs のウィンドウを通さず、送信 @n
+			  バッファへ直接読み込む事 @n
+			・中間バッファ（f_read + send）と比較したスループット（表示）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <chrono>
+#include <unistd.h>
+#include <fcntl.h>
+#include "net2/ethernet.hpp"
+#include "net2/tcp_file.hpp"
+#include "loop_ethd.hpp"
+#include "ram_disk.hpp"
+#include "check.hpp"
+
+namespace {
+
+	volatile uint32_t	counter_ = 0;
+
+	sim_test::ram_disk	disk_(16384);  // 8M バイト
+}
+
+extern "C" {
+	uint32_t get_counter() { return counter_; }
+	time_t get_time() { return 0; }
+
+	DSTATUS disk_initialize(BYTE drv) {
+		return disk_.disk_initialize(drv);
+	}
+
+	DSTATUS disk_status(BYTE drv) {
+		return disk_.disk_status(drv);
+	}
+
+	DRESULT disk_read(BYTE drv, BYTE* buff, DWORD sector, UINT count) {
+		return disk_.disk_read(drv, buff, sector, count);
+	}
+
+	DRESULT disk_write(BYTE drv, const BYTE* buff, DWORD sector, UINT count) {
+		return disk_.disk_write(drv, buff, sector, count);
+	}
+
+	DRESULT disk_ioctl(BYTE drv, BYTE ctrl, void* buff) {
+		return disk_.disk_ioctl(drv, ctrl, buff);
+	}
+
+	DWORD get_fattime(void) {
+		return ((2020 - 1980) << 25) | (1 << 21) | (1 << 16);
+	}
+}
+
+namespace {
+
+	typedef sim_test::loop_ethd loop_ethd;
+	typedef net::ethernet<loop_ethd, 1, 2> ETHERNET;
+
+	loop_ethd	ethd_cl_;
+	loop_ethd	ethd_sv_;
+	ETHERNET	eth_cl_(ethd_cl_);
+	ETHERNET	eth_sv_(ethd_sv_);
+
+	auto& tcp_cl_ = eth_cl_.at_ipv4().at_tcp();
+	auto& tcp_sv_ = eth_sv_.at_ipv4().at_tcp();
+
+	static const uint16_t PORT = 80;
+	static const uint32_t FILE_SIZE = 1024 * 1024;
+
+	uint8_t	cl_send_[2048];
+	uint8_t	cl_recv_[8192];
+	uint8_t	sv_send_[8192];
+	uint8_t	sv_recv_[2048];
+
+	FATFS	fatfs_;
+
+	uint8_t pattern_(uint32_t pos) noexcept
+	{
+		return (pos * 7) ^ (pos >> 9) ^ (pos >> 17);
+	}
+
+
+	void step_()
+	{
+		for(int i = 0; i < 8; ++i) {
+			eth_cl_.process();
+			eth_sv_.process();
+			if(ethd_cl_.empty() && ethd_sv_.empty()) break;
+		}
+		++counter_;
+		eth_cl_.service();
+		eth_sv_.service();
+	}
+
+
+	void setup_(net::net_info& info, uint8_t id)
+	{
+		static const uint8_t mac[6] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x00 };
+		std::memcpy(info.mac, mac, 6);
+		info.mac[5] = id;
+		info.ip.set(192, 168, 0, id);
+		info.mask.set(255, 255, 255, 0);
+		info.gw.set(192, 168, 0, 1);
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	ファイルの範囲を送って、クライアントで受け取る
+		@param[in]	sv		サーバー・ディスクリプタ
+		@param[in]	cl		クライアント・ディスクリプタ
+		@param[in]	ofs		ファイル・オフセット
+		@param[in]	len		送るバイト数
+		@param[in]	direct	「true」なら tcp_send_file、「false」なら f_read + send
+		@param[out]	us		かかった時間（マイクロ秒）
+		@return 全て正しく届いたら「true」
+	*/
+	//-----------------------------------------------------------------//
+	bool transfer_(uint32_t sv, uint32_t cl, uint32_t ofs, uint32_t len, bool direct, double& us)
+	{
+		FIL fil;
+		if(f_open(&fil, "/test.bin", FA_READ) != FR_OK) return false;
+
+		auto t0 = std::chrono::steady_clock::now();
+		uint32_t sent = 0;
+		uint32_t rcvd = 0;
+		uint32_t err = 0;
+		uint8_t tmp[1024];
+		uint32_t tmp_pos = 0;
+		uint32_t tmp_len = 0;
+		if(!direct) f_lseek(&fil, ofs);
+		for(int i = 0; i < 100000 && rcvd < len; ++i) {
+			if(direct) {
+				while(sent < len) {
+					int l = net::tcp_send_file(tcp_sv_, sv, &fil, ofs + sent, len - sent);
+					if(l <= 0) break;
+					sent += l;
+				}
+			} else {
+				// 変更前の方法：中間バッファに読んで、送れた分だけ進める
+				while(sent < len) {
+					if(tmp_pos >= tmp_len) {
+						UINT n = len - sent;
+						if(n > sizeof(tmp)) n = sizeof(tmp);
+						UINT rl;
+						if(f_read(&fil, tmp, n, &rl) != FR_OK || rl == 0) break;
+						tmp_pos = 0;
+						tmp_len = rl;
+					}
+					int l = tcp_sv_.send(sv, &tmp[tmp_pos], tmp_len - tmp_pos);
+					if(l <= 0) break;
+					tmp_pos += l;
+					sent += l;
+				}
+			}
+			step_();
+			static uint8_t buf[2048];
+			int l;
+			while((l = tcp_cl_.recv(cl, buf, sizeof(buf))) > 0) {
+				for(int j = 0; j < l; ++j) {
+					if(buf[j] != pattern_(ofs + rcvd + j)) ++err;
+				}
+				rcvd += l;
+			}
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+		f_close(&fil);
+		return rcvd == len && err == 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	// TCP のデバッグ出力（stdout）を捨てる
+	static char outbuf[65536];
+	setvbuf(stdout, outbuf, _IOFBF, sizeof(outbuf));
+	fflush(stdout);
+	int out = dup(1);
+	int null = open("/dev/null", O_WRONLY);
+	dup2(null, 1);
+
+	CHECK(disk_.format());
+	CHECK(f_mount(&fatfs_, "", 1) == FR_OK);
+
+	{  // テスト・ファイル
+		FIL fil;
+		CHECK(f_open(&fil, "/test.bin", FA_WRITE | FA_CREATE_ALWAYS) == FR_OK);
+		static uint8_t tmp[4096];
+		bool ok = true;
+		for(uint32_t pos = 0; pos < FILE_SIZE; pos += sizeof(tmp)) {
+			for(uint32_t i = 0; i < sizeof(tmp); ++i) tmp[i] = pattern_(pos + i);
+			UINT bw;
+			if(f_write(&fil, tmp, sizeof(tmp), &bw) != FR_OK || bw != sizeof(tmp)) ok = false;
+		}
+		CHECK(ok);
+		CHECK(f_close(&fil) == FR_OK);
+	}
+
+	double raw_us;
+	{  // RAM ディスクからの読み込み（参考）
+		FIL fil;
+		CHECK(f_open(&fil, "/test.bin", FA_READ) == FR_OK);
+		static uint8_t tmp[8192];
+		auto t0 = std::chrono::steady_clock::now();
+		UINT rl;
+		uint32_t total = 0;
+		while(f_read(&fil, tmp, sizeof(tmp), &rl) == FR_OK && rl > 0) total += rl;
+		raw_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+		CHECK(total == FILE_SIZE);
+		f_close(&fil);
+	}
+
+	ethd_cl_.connect(ethd_sv_);
+	ethd_sv_.connect(ethd_cl_);
+	setup_(eth_cl_.at_info(), 10);
+	setup_(eth_sv_.at_info(), 20);
+
+	uint32_t sv;
+	uint32_t cl;
+	CHECK(tcp_sv_.open(sv_send_, sizeof(sv_send_), sv_recv_, sizeof(sv_recv_), sv));
+	CHECK(tcp_sv_.start(sv, net::ip_adrs(), PORT, true));
+	CHECK(tcp_cl_.open(cl_send_, sizeof(cl_send_), cl_recv_, sizeof(cl_recv_), cl));
+	CHECK(tcp_cl_.start(cl, net::ip_adrs(192, 168, 0, 20), PORT, false));
+	for(int i = 0; i < 200; ++i) {
+		step_();
+		if(tcp_cl_.connected(cl) && tcp_sv_.connected(sv)) break;
+	}
+	CHECK(tcp_sv_.connected(sv));
+
+	// 送信バッファに読み込んだセクター数
+	uint32_t direct = 0;
+	disk_.set_read_func([&direct](const BYTE* buff, DWORD sector, UINT count) {
+		if(buff >= sv_send_ && buff < (sv_send_ + sizeof(sv_send_))) direct += count;
+	});
+
+	{  // 途中のオフセット、半端な長さ
+		double us;
+		CHECK(transfer_(sv, cl, 1000, 5000, true, us));
+		CHECK(transfer_(sv, cl, 511, 20000, true, us));
+	}
+
+	double direct_us;
+	double buffer_us;
+	{  // ファイル全体
+		direct = 0;
+		disk_.reset_counter();
+		CHECK(transfer_(sv, cl, 0, FILE_SIZE, true, direct_us));
+		uint32_t secs = FILE_SIZE / sim_test::ram_disk::SS;
+		// 送信バッファの折り返し、ACK で空いた領域が１セクターに満たない所は、
+		// ウィンドウを通る（8K のバッファで、１M バイトなら２割弱）
+		CHECK(direct >= (secs * 3 / 4));
+		// ウィンドウを通ったセクターも、読み直さない（FAT の読み込み分だけ多い）
+		CHECK(disk_.get_counter().read_sector_ < (secs + secs / 32));
+
+		direct = 0;
+		CHECK(transfer_(sv, cl, 0, FILE_SIZE, false, buffer_us));
+		CHECK(direct == 0);
+	}
+
+	dup2(out, 1);
+	close(null);
+	close(out);
+
+	printf("tcp_file_test: RAM disk f_read %.1f MB/s, 1 MiB over loopback: direct %.1f MB/s, f_read + send %.1f MB/s\n",
+		FILE_SIZE / raw_us, FILE_SIZE / direct_us, FILE_SIZE / buffer_us);
+
+	return sim_test::result::report("tcp_file_test");
+}
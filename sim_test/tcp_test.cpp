@@ -0,0 +1,294 @@
+//=====================================================================//
+/*!	@file
+	@brief	net2 TCP のホスト・テスト（ループバック・イーサーネット・ドライバー） @n
+			・２つのスタック（クライアント、サーバー）を、フレーム・キューで接続 @n
+			・ARP 解決、接続、データ転送（順番、内容） @n
+			・受信側 SWS 回避（RFC 1122 4.2.3.3）：広告する右端は、@n
+			  min(MSS, 受信バッファの半分) 以上でしか進まない事 @n
+			・フレーム損失時の再送 @n
+			・高速再送したセグメントの ACK で、RTT を計測しない事（Karn） @n
+			・受信バッファ一杯（ゼロ・ウィンドウ）が続いても、再送タイム @n
+			  アウトを待たずに進む事、スループット（表示）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <chrono>
+#include <deque>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include "net2/ethernet.hpp"
+#include "loop_ethd.hpp"
+#include "check.hpp"
+
+namespace {
+
+	volatile uint32_t	counter_ = 0;
+}
+
+extern "C" {
+	uint32_t get_counter() { return counter_; }
+	time_t get_time() { return 0; }
+}
+
+namespace {
+
+	typedef sim_test::loop_ethd loop_ethd;
+
+	typedef net::ethernet<loop_ethd, 1, 2> ETHERNET;
+
+	loop_ethd	ethd_cl_;
+	loop_ethd	ethd_sv_;
+	ETHERNET	eth_cl_(ethd_cl_);
+	ETHERNET	eth_sv_(ethd_sv_);
+
+	auto& tcp_cl_ = eth_cl_.at_ipv4().at_tcp();
+	auto& tcp_sv_ = eth_sv_.at_ipv4().at_tcp();
+
+	static const uint16_t PORT = 3000;
+	static const uint16_t MSS = 1460;
+	static const uint16_t SV_RECV_SIZE = 4096;
+
+	uint8_t	cl_send_[8192];
+	uint8_t	cl_recv_[2048];
+	uint8_t	sv_send_[2048];
+	uint8_t	sv_recv_[SV_RECV_SIZE];
+
+
+	// 届いているフレームを処理
+	void flush_()
+	{
+		for(int i = 0; i < 8; ++i) {
+			eth_cl_.process();
+			eth_sv_.process();
+			if(ethd_cl_.empty() && ethd_sv_.empty()) break;
+		}
+	}
+
+
+	// １０ｍｓ分の動作（受信処理、サービス）
+	void step_()
+	{
+		flush_();
+		++counter_;
+		eth_cl_.service();
+		eth_sv_.service();
+	}
+
+
+	void setup_(net::net_info& info, uint8_t id)
+	{
+		static const uint8_t mac[6] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x00 };
+		std::memcpy(info.mac, mac, 6);
+		info.mac[5] = id;
+		info.ip.set(192, 168, 0, id);
+		info.mask.set(255, 255, 255, 0);
+		info.gw.set(192, 168, 0, 1);
+	}
+
+
+	struct seg_t {
+		uint32_t	ack;
+		uint16_t	win;
+		uint16_t	len;
+		uint8_t		flags;
+	};
+
+	seg_t get_seg_(const loop_ethd::FRAME& f)
+	{
+		const uint8_t* ip = &f[14];
+		uint16_t ip_len = (ip[2] << 8) | ip[3];
+		const uint8_t* tcp = ip + (ip[0] & 15) * 4;
+		uint16_t hlen = (tcp[12] >> 4) * 4;
+		seg_t s;
+		s.ack = (tcp[8] << 24) | (tcp[9] << 16) | (tcp[10] << 8) | tcp[11];
+		s.win = (tcp[14] << 8) | tcp[15];
+		s.len = ip_len - (ip[0] & 15) * 4 - hlen;
+		s.flags = tcp[13];
+		return s;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	// TCP のデバッグ出力（stdout）を捨てる
+	static char outbuf[65536];
+	setvbuf(stdout, outbuf, _IOFBF, sizeof(outbuf));
+	fflush(stdout);
+	int out = dup(1);
+	int null = open("/dev/null", O_WRONLY);
+	dup2(null, 1);
+
+	ethd_cl_.connect(ethd_sv_);
+	ethd_sv_.connect(ethd_cl_);
+	setup_(eth_cl_.at_info(), 10);
+	setup_(eth_sv_.at_info(), 20);
+
+	uint32_t sv_desc;
+	uint32_t cl_desc;
+	CHECK(tcp_sv_.open(sv_send_, sizeof(sv_send_), sv_recv_, sizeof(sv_recv_), sv_desc));
+	CHECK(tcp_sv_.start(sv_desc, net::ip_adrs(), PORT, true));
+	CHECK(tcp_cl_.open(cl_send_, sizeof(cl_send_), cl_recv_, sizeof(cl_recv_), cl_desc));
+	CHECK(tcp_cl_.start(cl_desc, net::ip_adrs(192, 168, 0, 20), PORT, false));
+
+	for(int i = 0; i < 200; ++i) {
+		step_();
+		if(tcp_cl_.connected(cl_desc) && tcp_sv_.connected(sv_desc)) break;
+	}
+	CHECK(tcp_cl_.connected(cl_desc));
+	CHECK(tcp_sv_.connected(sv_desc));
+
+	// クライアント -> サーバー、サーバーは、少しずつ読み出す
+	static const uint32_t total = 64 * 1024;
+	uint32_t sent = 0;
+	uint32_t rcvd = 0;
+	uint32_t err = 0;
+	ethd_sv_.log_.clear();
+	for(int i = 0; i < 20000 && rcvd < total; ++i) {
+		while(sent < total) {
+			uint8_t tmp[512];
+			uint32_t n = total - sent;
+			if(n > sizeof(tmp)) n = sizeof(tmp);
+			for(uint32_t j = 0; j < n; ++j) tmp[j] = (sent + j) * 13 + ((sent + j) >> 8);
+			int l = tcp_cl_.send(cl_desc, tmp, n);
+			if(l <= 0) break;
+			sent += l;
+		}
+		step_();
+		// サーバーは、１０ｍｓ毎に１００バイト（ウィンドウが少しずつ空く）
+		uint8_t tmp[100];
+		int l = tcp_sv_.recv(sv_desc, tmp, sizeof(tmp));
+		for(int j = 0; j < l; ++j) {
+			if(tmp[j] != static_cast<uint8_t>((rcvd + j) * 13 + ((rcvd + j) >> 8))) ++err;
+		}
+		if(l > 0) rcvd += l;
+	}
+	CHECK(rcvd == total);
+	CHECK(err == 0);
+
+	{  // サーバーが広告した右端（ACK + ウィンドウ）の移動量
+		uint32_t step = SV_RECV_SIZE / 2;
+		if(step > MSS) step = MSS;
+		uint32_t small = 0;
+		uint32_t updates = 0;
+		uint32_t zero = 0;
+		bool first = true;
+		uint32_t edge = 0;
+		for(const auto& f : ethd_sv_.log_) {
+			auto s = get_seg_(f);
+			if((s.flags & 0x10) == 0) continue;  // ACK 以外
+			uint32_t e = s.ack + s.win;
+			if(s.win == 0) ++zero;
+			if(!first && e != edge) {
+				int32_t d = static_cast<int32_t>(e - edge);
+				if(d > 0 && static_cast<uint32_t>(d) < step) ++small;
+				if(s.len == 0 && d > 0) ++updates;
+			}
+			edge = e;
+			first = false;
+		}
+		CHECK(small == 0);    // 小さなウィンドウ更新をしない
+		CHECK(updates > 0);   // ウィンドウ更新の ACK を送っている
+		CHECK(zero > 0);      // 受信バッファが一杯になる状況を検査している
+	}
+
+	{  // フレーム損失（７フレームに１つ捨てる）でも、全て届く
+		ethd_cl_.drop_ = 7;
+		ethd_sv_.drop_ = 7;
+		static const uint32_t total = 16 * 1024;
+		uint32_t sent = 0;
+		uint32_t rcvd = 0;
+		uint32_t err = 0;
+		for(int i = 0; i < 50000 && rcvd < total; ++i) {
+			while(sent < total) {
+				uint8_t tmp[256];
+				uint32_t n = total - sent;
+				if(n > sizeof(tmp)) n = sizeof(tmp);
+				for(uint32_t j = 0; j < n; ++j) tmp[j] = (sent + j) ^ 0x5a;
+				int l = tcp_sv_.send(sv_desc, tmp, n);
+				if(l <= 0) break;
+				sent += l;
+			}
+			step_();
+			uint8_t tmp[512];
+			int l = tcp_cl_.recv(cl_desc, tmp, sizeof(tmp));
+			for(int j = 0; j < l; ++j) {
+				if(tmp[j] != static_cast<uint8_t>((rcvd + j) ^ 0x5a)) ++err;
+			}
+			if(l > 0) rcvd += l;
+		}
+		CHECK(rcvd == total);
+		CHECK(err == 0);
+		ethd_cl_.drop_ = 0;
+		ethd_sv_.drop_ = 0;
+	}
+
+	{  // 高速再送：先頭セグメントを落し、５００ｍｓ後に後続の重複 ACK を受ける
+		for(int i = 0; i < 50; ++i) step_();
+		uint8_t tmp[512];
+		while(tcp_sv_.recv(sv_desc, tmp, sizeof(tmp)) > 0) ;
+		for(int i = 0; i < 10; ++i) step_();  // ウィンドウ更新を受ける
+		auto rto = tcp_cl_.get_rto(cl_desc);
+		for(uint32_t j = 0; j < sizeof(tmp); ++j) tmp[j] = j;
+		ethd_cl_.lose_ = 1;
+		for(int i = 0; i < 4; ++i) {  // ５１２バイトのセグメントを４つ
+			CHECK(tcp_cl_.send(cl_desc, tmp, sizeof(tmp)) == sizeof(tmp));
+			eth_cl_.service();
+		}
+		counter_ += 50;
+		flush_();  // ３つの重複 ACK、高速再送、その ACK
+		CHECK(tcp_sv_.get_recv_length(sv_desc) == 1460);  // 高速再送は MSS 分
+		CHECK(tcp_cl_.get_rto(cl_desc) == rto);  // 再送したセグメントの RTT（500ms）を使わない
+		uint32_t rcvd = 0;
+		for(int i = 0; i < 1000 && rcvd < 2048; ++i) {
+			step_();
+			int l = tcp_sv_.recv(sv_desc, tmp, sizeof(tmp));
+			if(l > 0) rcvd += l;
+		}
+		CHECK(rcvd == 2048);
+	}
+
+	double mbps;
+	uint32_t ticks;
+	{  // スループット（クライアント -> サーバー、1M バイト）
+		static const uint32_t total = 1024 * 1024;
+		uint32_t sent = 0;
+		uint32_t rcvd = 0;
+		auto t0 = std::chrono::steady_clock::now();
+		uint32_t c0 = counter_;
+		while(rcvd < total && (counter_ - c0) < 100000) {
+			while(sent < total) {
+				static uint8_t tmp[1024];
+				uint32_t n = total - sent;
+				if(n > sizeof(tmp)) n = sizeof(tmp);
+				int l = tcp_cl_.send(cl_desc, tmp, n);
+				if(l <= 0) break;
+				sent += l;
+			}
+			step_();
+			static uint8_t tmp[1024];
+			int l;
+			while((l = tcp_sv_.recv(sv_desc, tmp, sizeof(tmp))) > 0) rcvd += l;
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		CHECK(rcvd == total);
+		auto us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+		mbps = static_cast<double>(total) / (us > 0 ? us : 1);
+		ticks = counter_ - c0;
+		// ゼロ・ウィンドウ・プローブの後、再送タイムアウトを待たずに進む事
+		CHECK(ticks < 2000);
+	}
+
+	dup2(out, 1);
+	close(null);
+	close(out);
+
+	printf("tcp_test: 1 MiB loopback: %.1f MB/s (host), %u ticks (%.1f KiB/tick)\n",
+		mbps, ticks, 1024.0 / ticks);
+
+	return sim_test::result::report("tcp_test");
+}
@@ -0,0 +1,299 @@
+//=====================================================================//
+/*!	@file
+	@brief	Widget ディレクター（gui::widget_director）の部分更新のホスト・テスト @n
+			・render のクリッピング領域が、矩形（org から org + size）として @n
+			  全ての描画（点、ライン、塗りつぶし、ビットマップ）に効く事 @n
+			・widget の再描画が、ダーティー矩形の内側だけを書き換え、外側の @n
+			  ピクセル（重なる widget を含む）を書き換えない事 @n
+			・ダーティー矩形の内側は、全体の再描画と同じになる事 @n
+			・部分更新と全体の再描画の、描画ピクセル数、時間（表示）
+    @author 平松邦仁 (hira@rvf-rc45.net)
+	@copyright	Copyright (C) 2020 Kunihito Hiramatsu @n
+				Released under the MIT license @n
+				https://github.com/hirakuni45/RX/blob/master/LICENSE
+*/
+//=====================================================================//
+#include <cstdio>
+#include <chrono>
+#include <vector>
+#include "common/format.hpp"
+#include "graphics/font8x16.hpp"
+#include "graphics/graphics.hpp"
+#include "graphics/widget_director.hpp"
+#include "check.hpp"
+
+namespace {
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	GLCDC の代わり（フレームバッファだけを持つ）
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct glc_t {
+		static const int16_t width  = 480;
+		static const int16_t height = 272;
+
+		uint16_t	fb_[512 * height];
+
+		void* get_fbp() const noexcept { return const_cast<uint16_t*>(fb_); }
+
+		void sync_vpos() noexcept { }
+	};
+
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	/*!
+		@brief	タッチ・パネルの代わり
+	*/
+	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
+	struct touch_t {
+		struct touch_pos {
+			vtx::spos	pos;
+		};
+
+		touch_pos	pos_;
+		uint16_t	num_;
+
+		touch_t() noexcept : pos_(), num_(0) { }
+
+		uint16_t get_touch_num() const noexcept { return num_; }
+
+		const touch_pos& get_touch_pos(uint8_t idx) const noexcept { return pos_; }
+
+		void set(int16_t x, int16_t y) noexcept { pos_.pos.set(x, y); num_ = 1; }
+
+		void release() noexcept { num_ = 0; }
+	};
+
+	typedef graphics::font<graphics::font8x16, graphics::kfont_null> FONT;
+	typedef graphics::render<glc_t, FONT> RENDER;
+	typedef gui::widget_director<RENDER, touch_t, 16> WIDD;
+
+	graphics::font8x16		afont_;
+	graphics::kfont_null	kfont_;
+	FONT	font_(afont_, kfont_);
+
+	glc_t	glc_;
+	RENDER	render_(glc_, font_);
+	touch_t	touch_;
+	WIDD	widd_(render_, touch_);
+
+	static const uint16_t SENTINEL = 0x1234;
+
+	static const vtx::srect FULL(0, 0, glc_t::width, glc_t::height);
+
+	std::vector<uint16_t> snapshot_()
+	{
+		return std::vector<uint16_t>(glc_.fb_, glc_.fb_ + sizeof(glc_.fb_) / sizeof(uint16_t));
+	}
+
+
+	void fill_(uint16_t c) noexcept
+	{
+		for(auto& v : glc_.fb_) v = c;
+	}
+
+
+	bool inside_(const vtx::srect& r, int16_t x, int16_t y) noexcept
+	{
+		return x >= r.org.x && x < r.end_x() && y >= r.org.y && y < r.end_y();
+	}
+
+
+	//-----------------------------------------------------------------//
+	/*!
+		@brief	矩形の内側は ref と同じ、外側は SENTINEL のままか検査
+		@param[in]	ref		全体を再描画した結果
+		@param[in]	rects	ダーティー矩形
+		@param[in]	num		矩形の数
+		@return 正しければ「true」
+	*/
+	//-----------------------------------------------------------------//
+	bool only_inside_(const std::vector<uint16_t>& ref, const vtx::srect* rects, uint32_t num) noexcept
+	{
+		for(int16_t y = 0; y < glc_t::height; ++y) {
+			for(int16_t x = 0; x < glc_t::width; ++x) {
+				auto c = glc_.fb_[y * RENDER::line_offset + x];
+				bool in = false;
+				for(uint32_t i = 0; i < num; ++i) {
+					if(inside_(rects[i], x, y)) in = true;
+				}
+				if(in) {
+					if(c != ref[y * RENDER::line_offset + x]) return false;
+				} else {
+					if(c != SENTINEL) return false;
+				}
+			}
+		}
+		return true;
+	}
+
+
+	// クリッピング領域の外を書き換えない事（各描画関数）
+	template <class DRAW>
+	bool clip_only_(const vtx::srect& clip, DRAW draw) noexcept
+	{
+		fill_(SENTINEL);
+		render_.set_clip(clip);
+		render_.set_fore_color(graphics::def_color::White);
+		draw();
+		render_.set_clip(FULL);
+		bool drawn = false;
+		for(int16_t y = 0; y < glc_t::height; ++y) {
+			for(int16_t x = 0; x < glc_t::width; ++x) {
+				auto c = glc_.fb_[y * RENDER::line_offset + x];
+				if(c == SENTINEL) continue;
+				if(!inside_(clip, x, y)) return false;
+				drawn = true;
+			}
+		}
+		return drawn;
+	}
+}
+
+bool insert_widget(gui::widget* w) { return widd_.insert(w); }
+void remove_widget(gui::widget* w) { widd_.remove(w); }
+
+namespace {
+
+	gui::frame	frame_(vtx::srect(10, 10, 300, 200), "Frame");
+	gui::button	button1_(vtx::srect(40, 40, 100, 40), "1");
+	gui::button	button2_(vtx::srect(120, 60, 100, 40), "2");  // button1 と重なる
+	gui::button	button3_(vtx::srect(350, 40, 100, 40), "3");
+
+	vtx::srect rect_(const gui::widget& w) noexcept
+	{
+		return vtx::srect(w.get_final_position(), w.get_location().size);
+	}
+
+
+	double bench_(uint32_t loop, bool all) noexcept
+	{
+		auto t0 = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < loop; ++i) {
+			if(i & 1) touch_.release();
+			else touch_.set(50, 50);
+			if(all) widd_.redraw_all();
+			widd_.update();
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::micro>(t1 - t0).count() / loop;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	{  // render のクリッピング領域
+		vtx::srect clip(100, 50, 120, 80);
+		static const uint8_t bits[8] = { 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81 };
+		CHECK(clip_only_(clip, [] { render_.fill_box(FULL); }));
+		CHECK(clip_only_(clip, [] { render_.line_h(60, 0, glc_t::width); }));
+		CHECK(clip_only_(clip, [] { render_.line_v(110, 0, glc_t::height); }));
+		CHECK(clip_only_(clip, [] {
+			for(int16_t i = 0; i < 300; ++i) render_.plot(vtx::spos(i, i / 2), 0xffff);
+		}));
+		CHECK(clip_only_(clip, [&] {
+			for(int16_t y = 40; y < 140; y += 8) {
+				for(int16_t x = 90; x < 240; x += 8) {
+					render_.draw_bitmap(vtx::spos(x, y), bits, vtx::spos(8, 8), true);
+				}
+			}
+		}));
+		CHECK(clip_only_(clip, [] { render_.round_box(vtx::srect(80, 30, 300, 200), 10); }));
+		// 内側は、クリッピングしない場合と同じ
+		fill_(SENTINEL);
+		render_.fill_box(vtx::srect(150, 70, 20, 20));
+		auto ref = snapshot_();
+		CHECK(clip_only_(clip, [] { render_.fill_box(vtx::srect(150, 70, 20, 20)); }));
+		CHECK(snapshot_() == ref);
+
+		// フレームからはみ出す領域は、フレームに制限する
+		render_.set_clip(vtx::srect(-10, 200, 100, 100));
+		const auto& c = render_.get_clip();
+		CHECK(c.org.x == 0 && c.org.y == 200 && c.size.x == 90 && c.size.y == 72);
+		render_.set_clip(FULL);
+	}
+
+	frame_.enable();
+	button1_.enable();
+	button2_.enable();
+	button3_.enable();
+
+	// 最初は、全体を描画する
+	fill_(SENTINEL);
+	widd_.update();
+	CHECK(widd_.get_counter().frame_ == 1);
+	CHECK(widd_.get_counter().widget_ == 4);
+
+	{  // button1 を押す：button1 の矩形だけ書き換える（重なる button2 の外側は残す）
+		fill_(SENTINEL);
+		widd_.reset_counter();
+		touch_.set(50, 50);
+		widd_.update();
+		const auto& c = widd_.get_counter();
+		CHECK(c.frame_ == 1);
+		CHECK(c.dirty_ == 1);
+		CHECK(c.widget_ == 3);  // frame、button1、button2（クリップ）
+		auto part = snapshot_();
+		auto r = rect_(button1_);
+		uint32_t area = r.size.x * r.size.y;
+		CHECK(c.pixel_ == (area * 2 + 20 * 20));
+		CHECK(render_.get_clip().org == FULL.org && render_.get_clip().size == FULL.size);
+
+		// 同じ状態で全体を再描画して、矩形の内側を比較
+		fill_(SENTINEL);
+		widd_.redraw_all();
+		widd_.update();
+		auto full = snapshot_();
+		std::memcpy(glc_.fb_, &part[0], sizeof(glc_.fb_));
+		CHECK(only_inside_(full, &r, 1));
+		CHECK(part != full);
+	}
+
+	{  // 離す（button1）と、button3 のステート変更：２つの矩形
+		fill_(SENTINEL);
+		widd_.reset_counter();
+		touch_.release();
+		button3_.set_state(gui::widget::STATE::STALL);
+		widd_.update();
+		const auto& c = widd_.get_counter();
+		CHECK(c.dirty_ == 2);
+		CHECK(button1_.get_select_id() == 1);
+		auto part = snapshot_();
+		vtx::srect rs[2] = { rect_(button1_), rect_(button3_) };
+
+		// redraw_all は ENABLE の widget だけなので、button3 を戻してから
+		fill_(SENTINEL);
+		button3_.set_state(gui::widget::STATE::ENABLE);
+		widd_.redraw_all();
+		widd_.update();
+		auto full = snapshot_();
+		std::memcpy(glc_.fb_, &part[0], sizeof(glc_.fb_));
+		CHECK(only_inside_(full, rs, 2));
+	}
+
+	{  // 何も変化しなければ、描画しない
+		fill_(SENTINEL);
+		widd_.reset_counter();
+		widd_.update();
+		CHECK(widd_.get_counter().frame_ == 0);
+		bool same = true;
+		for(auto v : glc_.fb_) {
+			if(v != SENTINEL) same = false;
+		}
+		CHECK(same);
+	}
+
+	{  // ボタンを押す、離すの繰り返し（部分更新、全体の再描画）
+		widd_.reset_counter();
+		auto part = bench_(1000, false);
+		auto np = widd_.get_counter().pixel_ / 1000;
+		widd_.reset_counter();
+		auto full = bench_(1000, true);
+		auto nf = widd_.get_counter().pixel_ / 1000;
+		CHECK(np < nf);
+		printf("widget_test: button press/release: dirty rect %u pixels %.2f us, redraw all %u pixels %.2f us\n",
+			np, part, nf, full);
+	}
+
+	return sim_test::result::report("widget_test");
+}
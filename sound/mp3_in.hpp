@@ -283,18 +283,25 @@ namespace sound {
 
 				mad_synth_frame(&mad_synth_, &mad_frame_);
 
-				for(uint32_t i = 0; i < mad_synth_.pcm.length; ++i) {
-					while((out.at_fifo().size() - out.at_fifo().length()) < 8) {
-					}
-					sound::wave_t t;
-					if(MAD_NCHANNELS(&mad_frame_.header) == 1) {
-						t.l_ch = t.r_ch = MadFixedToSshort(mad_synth_.pcm.samples[0][i]);
-					} else {
-						t.l_ch = MadFixedToSshort(mad_synth_.pcm.samples[0][i]);
-						t.r_ch = MadFixedToSshort(mad_synth_.pcm.samples[1][i]);
+				{  // インターリーブした PCM をまとめて書き込む
+					uint32_t ch = MAD_NCHANNELS(&mad_frame_.header) == 1 ? 1 : 2;
+					int16_t tmp[64 * 2];
+					uint32_t i = 0;
+					while(i < mad_synth_.pcm.length) {
+						uint32_t n = mad_synth_.pcm.length - i;
+						if(n > 64) n = 64;
+						for(uint32_t j = 0; j < n; ++j) {
+							if(ch == 1) {
+								tmp[j] = MadFixedToSshort(mad_synth_.pcm.samples[0][i + j]);
+							} else {
+								tmp[j * 2 + 0] = MadFixedToSshort(mad_synth_.pcm.samples[0][i + j]);
+								tmp[j * 2 + 1] = MadFixedToSshort(mad_synth_.pcm.samples[1][i + j]);
+							}
+						}
+						out.put_wait(tmp, n, ch);
+						i += n;
 					}
-					out.at_fifo().put(t);
-					++pos;
+					pos += mad_synth_.pcm.length;
 				}
 
 				{
@@ -312,6 +319,7 @@ namespace sound {
 			mad_frame_finish(&mad_frame_);
 			mad_stream_finish(&mad_stream_);
 
+			out.stop();  // 入力の終わり（FIFO の残りの不足は、アンダーランに数えない）
 			return status;
 		}
 	};
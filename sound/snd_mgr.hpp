@@ -3,7 +3,11 @@
 /*!	@file
 	@brief	サウンド・マネージャー @n
 			登録した PCM 波形データの発音制御 @n
-			非常にシンプルな構成で、基本的な動作のみ実装
+			・ボイス毎に BLK フレーム単位でミックスする。@n
+			・ボリューム、パンは Q15、ピッチは 16.16 固定小数点（線形補間）@n
+			・ミックスは 32 ビットで累積し、16 ビットに飽和させる。@n
+			・空きボイスが無い場合、最も古いワンショットのボイスを止めて使う。@n
+			・「render」で sound_out の FIFO に直接書き込める。
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2018 Kunihito Hiramatsu @n
 				Released under the MIT license @n
@@ -12,6 +16,7 @@
 //=====================================================================//
 #include <memory>
 #include "sound/wav_in.hpp"
+#include "sound/sound_out.hpp"
 
 namespace sound {
 
@@ -21,11 +26,21 @@ namespace sound {
 		@param[in]	CTXMAX	最大登録数
 		@param[in]	SNDMAX	同時発音数
 		@param[in]	RDRLEN	レンダリング・バッファ長さ
+		@param[in]	BLK		ミックスのブロック・フレーム数
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	template <uint32_t CTXMAX, uint32_t SNDMAX, uint32_t RDRLEN>
+	template <uint32_t CTXMAX, uint32_t SNDMAX, uint32_t RDRLEN, uint32_t BLK = 32>
 	class snd_mgr {
 
+		static_assert(BLK > 0 && BLK <= 64, "BLK out of range (1 to 64)");
+		static_assert(SNDMAX > 0 && SNDMAX <= 256, "SNDMAX out of range (1 to 256)");
+
+	public:
+		static const int16_t  VOLUME_MAX = 0x7fff;	///< ボリューム最大（1.0 として扱う）
+		static const uint32_t PITCH_ONE  = 0x10000;	///< 等速のピッチ（16.16）
+
+	private:
+
 		typedef std::shared_ptr<const int8_t> WAV_PTR;
 
 		struct ctx_t {
@@ -38,8 +53,14 @@ namespace sound {
 		struct snd_t {
 			uint32_t	ctx_;
 			uint32_t	pos_;
+			uint32_t	frac_;	///< 位置の小数部（16 ビット）
+			uint32_t	step_;	///< ピッチ（16.16）
+			int16_t		vol_;
+			int16_t		pan_;
+			uint32_t	age_;
 			bool		loop_;
-			snd_t() : ctx_(CTXMAX), pos_(0), loop_(false) { }
+			snd_t() : ctx_(CTXMAX), pos_(0), frac_(0), step_(PITCH_ONE),
+				vol_(VOLUME_MAX), pan_(0), age_(0), loop_(false) { }
 		};
 		snd_t	snd_[SNDMAX];
 
@@ -47,13 +68,128 @@ namespace sound {
 
 		uint32_t	dec_;
 
+		int32_t		acc_[BLK * 2];	///< L, R の累積
+		int32_t		master_;	///< マスター・ボリューム（0x8000 が 1.0）
+		uint32_t	age_;
+
+		// Q15 のボリュームを、ゲイン（0x8000 が 1.0）に変換
+		static int32_t gain_(int16_t v) noexcept
+		{
+			if(v >= VOLUME_MAX) return 0x8000;
+			else if(v < 0) return 0;
+			return v;
+		}
+
+		static int16_t sat_(int32_t v) noexcept
+		{
+			if(v > 32767) return 32767;
+			else if(v < -32768) return -32768;
+			return v;
+		}
+
+
+		// ブロック内で、補間の次サンプルが範囲内のフレーム数
+		static uint32_t span_(const snd_t& snd, uint32_t len, uint32_t n) noexcept
+		{
+			if((snd.pos_ + 1) >= len) return 0;
+			uint64_t rem = (static_cast<uint64_t>(len - 1 - snd.pos_) << 16) - snd.frac_;
+			uint64_t k = (rem + snd.step_ - 1) / snd.step_;
+			return k < n ? k : n;
+		}
+
+
+		// １ボイスを num フレーム累積（終端でループ、又は停止）
+		void mix_voice_(snd_t& snd, int32_t* acc, uint32_t num) noexcept
+		{
+			const ctx_t& ctx = ctx_[snd.ctx_];
+			const int8_t* org = ctx.org_.get();
+			uint32_t len = ctx.len_;
+
+			// ボリューム、パン、マスターの合成（0x8000 が 1.0）
+			// 既定値（ボリューム最大、中央、マスター初期値）では、以前の
+			// ミキサーの「256 / SNDMAX」倍と、ビット単位で同じになる。
+			int32_t gl = 0x8000;
+			int32_t gr = 0x8000;
+			if(snd.pan_ > 0) gl -= snd.pan_ + 1;
+			else if(snd.pan_ < 0) gr += snd.pan_;
+			int32_t vol = gain_(snd.vol_);
+			gl = (((gl * vol) >> 15) * master_) >> 15;
+			gr = (((gr * vol) >> 15) * master_) >> 15;
+
+			uint32_t step = snd.step_;
+			uint32_t i = 0;
+			while(i < num) {
+				uint32_t n = span_(snd, len, num - i);
+				if(n > 0) {
+					uint32_t pos = snd.pos_;
+					uint32_t frac = snd.frac_;
+					i += n;
+					if(step == PITCH_ONE && frac == 0) {
+						while(n > 0) {
+							int32_t s = static_cast<int32_t>(org[pos]) << 8;
+							acc[0] += (s * gl) >> 15;
+							acc[1] += (s * gr) >> 15;
+							acc += 2;
+							++pos;
+							--n;
+						}
+					} else {
+						while(n > 0) {
+							int32_t s0 = org[pos];
+							int32_t s = (s0 << 8) + (((org[pos + 1] - s0) * static_cast<int32_t>(frac)) >> 8);
+							acc[0] += (s * gl) >> 15;
+							acc[1] += (s * gr) >> 15;
+							acc += 2;
+							frac += step;
+							pos += frac >> 16;
+							frac &= 0xffff;
+							--n;
+						}
+					}
+					snd.pos_ = pos;
+					snd.frac_ = frac;
+				} else if(snd.pos_ >= len) {
+					if(!snd.loop_ || len == 0) {
+						snd.ctx_ = CTXMAX;
+						return;
+					}
+					snd.pos_ %= len;
+				} else {  // 最後のサンプル（次はループ先頭、又は無音）
+					int32_t s0 = org[snd.pos_];
+					int32_t s1 = snd.loop_ ? org[0] : 0;
+					int32_t s = (s0 << 8) + (((s1 - s0) * static_cast<int32_t>(snd.frac_)) >> 8);
+					acc[0] += (s * gl) >> 15;
+					acc[1] += (s * gr) >> 15;
+					acc += 2;
+					snd.frac_ += step;
+					snd.pos_ += snd.frac_ >> 16;
+					snd.frac_ &= 0xffff;
+					++i;
+				}
+			}
+		}
+
+
+		// 全ボイスを num フレーム（BLK 以下）ミックス
+		void mix_(uint32_t num) noexcept
+		{
+			for(uint32_t i = 0; i < (num * 2); ++i) {
+				acc_[i] = 0;
+			}
+			for(uint32_t i = 0; i < SNDMAX; ++i) {
+				if(snd_[i].ctx_ < CTXMAX) {
+					mix_voice_(snd_[i], acc_, num);
+				}
+			}
+		}
+
 	public:
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  コンストラクター
 		*/
 		//-----------------------------------------------------------------//
-		snd_mgr() noexcept : dec_(0) { }
+		snd_mgr() noexcept : dec_(0), master_((256 / SNDMAX) << 7), age_(0) { }
 
 
 		//-----------------------------------------------------------------//
@@ -140,29 +276,96 @@ namespace sound {
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief  サウンド・リクエスト
+			@brief  サウンド・リクエスト @n
+					空きが無い場合、最も古いワンショットのボイスを使う
 			@param[in]	ctxhnd	コンテキスト・ハンドル
 			@param[in]	loop	ループの場合「true」
+			@param[in]	vol		ボリューム（Q15）
+			@param[in]	pan		パン（-32768:左、0:中央、32767:右）
+			@param[in]	pitch	ピッチ（16.16、PITCH_ONE で等速）
 			@return	発音ハンドル
 		*/
 		//-----------------------------------------------------------------//
-		uint32_t request(uint32_t ctxhnd, bool loop = false) noexcept
+		uint32_t request(uint32_t ctxhnd, bool loop = false, int16_t vol = VOLUME_MAX,
+			int16_t pan = 0, uint32_t pitch = PITCH_ONE) noexcept
 		{
-			if(ctxhnd >= CTXMAX) return SNDMAX;
+			if(ctxhnd >= CTXMAX || pitch == 0) return SNDMAX;
 
+			uint32_t idx = SNDMAX;
 			for(uint32_t i = 0; i < SNDMAX; ++i) {
-				if(snd_[i].ctx_ < CTXMAX) {
-					continue;
+				const snd_t& snd = snd_[i];
+				if(snd.ctx_ >= CTXMAX) {
+					idx = i;
+					break;
+				}
+				if(!snd.loop_ && (idx >= SNDMAX || (age_ - snd.age_) > (age_ - snd_[idx].age_))) {
+					idx = i;
 				}
-				snd_[i].ctx_  = ctxhnd;
-				snd_[i].pos_  = 0;
-				snd_[i].loop_ = loop;
-				return i;
 			}
-			return SNDMAX;
+			if(idx >= SNDMAX) return SNDMAX;
+
+			snd_t& snd = snd_[idx];
+			snd.ctx_  = ctxhnd;
+			snd.pos_  = 0;
+			snd.frac_ = 0;
+			snd.step_ = pitch;
+			snd.vol_  = vol;
+			snd.pan_  = pan;
+			snd.age_  = age_++;
+			snd.loop_ = loop;
+			return idx;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ボリュームの設定
+			@param[in]	sndhnd	発音ハンドル
+			@param[in]	vol		ボリューム（Q15）
+		*/
+		//-----------------------------------------------------------------//
+		void set_volume(uint32_t sndhnd, int16_t vol) noexcept
+		{
+			if(sndhnd < SNDMAX) snd_[sndhnd].vol_ = vol;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  パンの設定
+			@param[in]	sndhnd	発音ハンドル
+			@param[in]	pan		パン（-32768:左、0:中央、32767:右）
+		*/
+		//-----------------------------------------------------------------//
+		void set_pan(uint32_t sndhnd, int16_t pan) noexcept
+		{
+			if(sndhnd < SNDMAX) snd_[sndhnd].pan_ = pan;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  ピッチの設定
+			@param[in]	sndhnd	発音ハンドル
+			@param[in]	pitch	ピッチ（16.16、PITCH_ONE で等速）
+		*/
+		//-----------------------------------------------------------------//
+		void set_pitch(uint32_t sndhnd, uint32_t pitch) noexcept
+		{
+			if(sndhnd < SNDMAX && pitch > 0) snd_[sndhnd].step_ = pitch;
 		}
 
 
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  マスター・ボリュームの設定
+			@param[in]	vol		ボリューム（Q15、VOLUME_MAX で 1.0）@n
+								初期値は、(256 / SNDMAX) / 256
+		*/
+		//-----------------------------------------------------------------//
+		void set_master(int16_t vol) noexcept { master_ = gain_(vol); }
+
+
 		//-----------------------------------------------------------------//
 		/*!
 			@brief  サウンド停止
@@ -210,35 +413,47 @@ namespace sound {
 		{
 			dec_ = dec;
 
-			for(uint32_t i = 0; i < (RDRLEN - dec); ++i) {
-				final_[i] = 0;
-			}
-
-			for(uint32_t i = 0; i < (SNDMAX - dec); ++i) {
-				snd_t& snd = snd_[i];
-				if(snd.ctx_ >= CTXMAX) {
-					continue;
-				}
-				ctx_t& ctx = ctx_[snd.ctx_];
-				const int8_t* org = ctx.org_.get();
-				for(uint32_t j = 0; j < RDRLEN; ++j) {
-					if(snd.pos_ >= ctx.len_) {
-						if(snd.loop_) {
-							snd.pos_ = 0;
-						} else {
-							snd.ctx_ = CTXMAX;
-						}
-						break;
-					}
-					final_[j] += org[snd.pos_];
-					++snd.pos_;
+			uint32_t pos = 0;
+			while(pos < (RDRLEN - dec)) {
+				uint32_t n = RDRLEN - dec - pos;
+				if(n > BLK) n = BLK;
+				mix_(n);
+				for(uint32_t i = 0; i < n; ++i) {
+					final_[pos + i] = sat_((acc_[i * 2] + acc_[i * 2 + 1]) >> 1);
 				}
+				pos += n;
 			}
+		}
 
-			// 最終ゲイン調整
-			for(uint32_t i = 0; i < (RDRLEN - dec); ++i) {
-				final_[i] *= 256 / SNDMAX;
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief  sound_out の FIFO に直接レンダリング（ステレオ） @n
+					FIFO の空きが無くなった場合、そこで終了する
+			@param[in]	fifo	sound_out の FIFO
+			@param[in]	num		レンダリングするフレーム数
+			@return	レンダリングしたフレーム数
+		*/
+		//-----------------------------------------------------------------//
+		template <class FIFO>
+		uint32_t render(FIFO& fifo, uint32_t num) noexcept
+		{
+			uint32_t pos = 0;
+			while(pos < num) {
+				uint32_t n = fifo.put_span();
+				if(n == 0) break;
+				if(n > (num - pos)) n = num - pos;
+				if(n > BLK) n = BLK;
+				mix_(n);
+				wave_t* dst = fifo.put_ptr();
+				for(uint32_t i = 0; i < n; ++i) {
+					dst[i].l_ch = sat_(acc_[i * 2 + 0]);
+					dst[i].r_ch = sat_(acc_[i * 2 + 1]);
+				}
+				fifo.put_go(n);
+				pos += n;
 			}
+			return pos;
 		}
 
 
@@ -1,13 +1,20 @@
 #pragma once
 //=====================================================================//
 /*!	@file
-	@brief	オーディオ出力クラス
+	@brief	オーディオ出力クラス @n
+			・FIFO から波形メモリへの移動は、最大２セグメントのブロック転送で、@n
+			  符号反転は L/R を 32 ビットで同時に行う。@n
+			・FIFO が足りない場合、残りを無音で埋めて、アンダーラン数を数える。@n
+			  （波形メモリの位置は DMA と同期したまま）@n
+			・アンダーランは、再生中（start、put から stop、mute まで）だけ数える。@n
+			・デコーダーは、インターリーブされた int16 の列を「put」で書き込める。
     @author 平松邦仁 (hira@rvf-rc45.net)
 	@copyright	Copyright (C) 2018 Kunihito Hiramatsu @n
 				Released under the MIT license @n
 				https://github.com/hirakuni45/RX/blob/master/LICENSE
 */
 //=====================================================================//
+#include <cstring>
 #include "common/fixed_fifo.hpp"
 
 namespace sound {
@@ -17,7 +24,7 @@ namespace sound {
 		@brief	オーディオ出力構造体
 	*/
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++//
-	struct wave_t {
+	struct alignas(4) wave_t {
 		uint16_t	l_ch;
 		uint16_t	r_ch;
 
@@ -45,18 +52,43 @@ namespace utils {
 
 	private:
 
+		static_assert((OUTS & (OUTS - 1)) == 0, "OUTS must be a power of two");
+
 		sound::wave_t	wave_[OUTS];
 		uint32_t	w_put_;
 
 		FIFO		fifo_;
 
+		volatile uint32_t	underrun_;
+		volatile bool		play_;
+
+		// 符号反転しながら移動（L/R を 32 ビットで処理）
+		static void copy_(sound::wave_t* dst, const sound::wave_t* src, uint32_t n) noexcept
+		{
+			uint32_t* d = reinterpret_cast<uint32_t*>(dst);
+			const uint32_t* s = reinterpret_cast<const uint32_t*>(src);
+			while(n >= 4) {
+				d[0] = s[0] ^ 0x80008000;
+				d[1] = s[1] ^ 0x80008000;
+				d[2] = s[2] ^ 0x80008000;
+				d[3] = s[3] ^ 0x80008000;
+				d += 4;
+				s += 4;
+				n -= 4;
+			}
+			while(n > 0) {
+				*d++ = *s++ ^ 0x80008000;
+				--n;
+			}
+		}
+
 	public:
 		//-----------------------------------------------------------------//
 		/*!
 			@brief	コンストラクター
 		*/
 		//-----------------------------------------------------------------//
-		sound_out() noexcept : w_put_(0), fifo_()
+		sound_out() noexcept : w_put_(0), fifo_(), underrun_(0), play_(false)
 		{ }
 
 
@@ -67,6 +99,7 @@ namespace utils {
 		//-----------------------------------------------------------------//
 		void mute() noexcept
 		{
+			play_ = false;
 			fifo_.clear();
 			for(uint32_t i = 0; i < OUTS; ++i) {
 				wave_[i].zero();
@@ -110,25 +143,127 @@ namespace utils {
 		void start(uint32_t org) noexcept
 		{
 			w_put_ = org & (OUTS - 1);
+			play_ = true;
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	停止（入力の終わり） @n
+					FIFO の残りはそのまま出力し、以後の不足はアンダーランに数えない
+		*/
+		//-----------------------------------------------------------------//
+		void stop() noexcept { play_ = false; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	再生中か調べる
+			@return 再生中なら「true」
+		*/
+		//-----------------------------------------------------------------//
+		bool is_play() const noexcept { return play_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	インターリーブされた PCM の書き込み @n
+					FIFO の空きが無くなった場合、そこで終了する
+			@param[in]	src		PCM（int16、ステレオの場合 L, R の順）
+			@param[in]	num		サンプル数（ステレオの場合 L/R の組数）
+			@param[in]	ch		チャネル数（１又は２）
+			@return 書き込んだサンプル数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t put(const int16_t* src, uint32_t num, uint32_t ch = 2) noexcept
+		{
+			uint32_t total = 0;
+			while(total < num) {
+				auto n = fifo_.put_span();
+				if(n == 0) break;
+				if(n > (num - total)) n = num - total;
+				auto dst = fifo_.put_ptr();
+				if(ch == 2) {
+					std::memcpy(static_cast<void*>(dst), src, n * sizeof(sound::wave_t));
+					src += n * 2;
+				} else {
+					for(uint32_t i = 0; i < n; ++i) {
+						dst[i].l_ch = dst[i].r_ch = src[i];
+					}
+					src += n;
+				}
+				fifo_.put_go(n);
+				total += n;
+			}
+			if(total > 0) play_ = true;
+			return total;
 		}
 
 
 		//-----------------------------------------------------------------//
 		/*!
-			@brief	サービス
+			@brief	インターリーブされた PCM の書き込み（全て書き込むまで待つ）
+			@param[in]	src		PCM（int16、ステレオの場合 L, R の順）
+			@param[in]	num		サンプル数（ステレオの場合 L/R の組数）
+			@param[in]	ch		チャネル数（１又は２）
+		*/
+		//-----------------------------------------------------------------//
+		void put_wait(const int16_t* src, uint32_t num, uint32_t ch = 2) noexcept
+		{
+			while(num > 0) {
+				auto n = put(src, num, ch);
+				src += n * ch;
+				num -= n;
+			}
+		}
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	アンダーラン数の取得
+			@return アンダーラン数
+		*/
+		//-----------------------------------------------------------------//
+		uint32_t get_underrun() const noexcept { return underrun_; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	アンダーラン数のリセット
+		*/
+		//-----------------------------------------------------------------//
+		void reset_underrun() noexcept { underrun_ = 0; }
+
+
+		//-----------------------------------------------------------------//
+		/*!
+			@brief	サービス（DMA の転送に合わせて割り込みから呼ぶ） @n
+					FIFO が足りない場合、残りを無音にする（再生中ならアンダーラン）
 			@param[in]	num	波形メモリに移動する数
 		*/
 		//-----------------------------------------------------------------//
 		void service(uint32_t num) noexcept
 		{
-			if(fifo_.length() < num) return;
-
-			for(uint32_t i = 0; i < num; ++i) {
-				wave_[w_put_] = fifo_.get();
-				wave_[w_put_].l_ch ^= 0x8000;
-				wave_[w_put_].r_ch ^= 0x8000;
-				++w_put_;
-				w_put_ &= (OUTS - 1);
+			uint32_t len = fifo_.length();
+			if(play_ && len < num) {
+				++underrun_;
+			}
+			while(num > 0) {
+				uint32_t n = OUTS - w_put_;  // 波形メモリの終端まで
+				if(n > num) n = num;
+				if(len > 0) {
+					auto span = fifo_.get_span();  // FIFO の終端まで
+					if(n > span) n = span;
+					copy_(&wave_[w_put_], fifo_.get_ptr(), n);
+					fifo_.get_go(n);
+					len -= n;
+				} else {
+					for(uint32_t i = 0; i < n; ++i) {
+						wave_[w_put_ + i].zero();
+					}
+				}
+				w_put_ = (w_put_ + n) & (OUTS - 1);
+				num -= n;
 			}
 		}
 	};
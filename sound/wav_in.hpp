@@ -247,45 +247,18 @@ namespace sound {
 					break;
 				}
 				if(bits_ == 16) {
-					const uint16_t* src = reinterpret_cast<const uint16_t*>(tmp);
-					for(uint32_t i = 0; i < 256; ++i) {
-						while((out.at_fifo().size() - out.at_fifo().length()) < 8) {
-						}
-						sound::wave_t t;
-						if(get_channel() == 2) {
-							t.l_ch = src[0];
-							t.r_ch = src[1];
-							src += 2;
-						} else {
-							t.l_ch = src[0];
-							t.r_ch = t.l_ch;
-							++src;
-						}
-						out.at_fifo().put(t);
-						++pos;
-					}
+					out.put_wait(reinterpret_cast<const int16_t*>(tmp), 256, get_channel());
 				} else {  // 8 bits
+					int16_t pcm[256 * 2];
 					const uint8_t* src = reinterpret_cast<const uint8_t*>(tmp);
-					for(uint32_t i = 0; i < 256; ++i) {
-						while((out.at_fifo().size() - out.at_fifo().length()) < 8) {
-						}
-						sound::wave_t t;
-						if(get_channel() == 2) {
-							t.l_ch = static_cast<uint16_t>(src[0] ^ 0x80) << 8;
-							t.l_ch |= (src[0] & 0x7f) << 1;
-							t.r_ch = static_cast<uint16_t>(src[1] ^ 0x80) << 8;
-							t.r_ch |= (src[1] & 0x7f) << 1;
-							src += 2;
-						} else {
-							t.l_ch = static_cast<uint16_t>(src[0] ^ 0x80) << 8;
-							t.l_ch |= (src[0] & 0x7f) << 1;
-							t.r_ch = t.l_ch;
-							++src;
-						}
-						out.at_fifo().put(t);
-						++pos;
+					for(uint32_t i = 0; i < (256 * get_channel()); ++i) {
+						uint16_t v = static_cast<uint16_t>(src[i] ^ 0x80) << 8;
+						v |= (src[i] & 0x7f) << 1;
+						pcm[i] = v;
 					}
+					out.put_wait(pcm, 256, get_channel());
 				}
+				pos += 256;
 
 				{
 					uint32_t s = pos / rate_;
@@ -298,6 +271,7 @@ namespace sound {
 				}
 				data_pos_ += unit;
 			}
+			out.stop();  // 入力の終わり（FIFO の残りの不足は、アンダーランに数えない）
 			return status;
 		}
 